@@ -8,6 +8,7 @@
 #include "font_awesome_symbols.h"
 #include "assets/lang_config.h"
 #include "mcp_server.h"
+#include "profiler.h"
 
 #include <cstring>
 #include <esp_log.h>
@@ -219,7 +220,7 @@ void Application::DismissAlert() {
     if (device_state_ == kDeviceStateIdle) {
         auto display = Board::GetInstance().GetDisplay();
         display->SetStatus(Lang::Strings::STANDBY);
-        display->SetEmotion("neutral");
+        display->SetEmotion(kEmotionNeutral);
         display->SetChatMessage("system", "");
     }
 }
@@ -351,6 +352,9 @@ void Application::Start() {
     /* Start the clock timer to update the status bar */
     esp_timer_start_periodic(clock_timer_handle_, 1000000);
 
+    /* Start sampling task and heap statistics */
+    Profiler::GetInstance().Start();
+
     /* Wait for the network to be ready */
     board.StartNetwork();
 
@@ -400,6 +404,9 @@ void Application::Start() {
             SetDeviceState(kDeviceStateIdle);
         });
     });
+    protocol_->OnIncomingMcp([](const std::string& payload) {
+        McpServer::GetInstance().ParseMessage(payload);
+    });
     protocol_->OnIncomingJson([this, display](const cJSON* root) {
         // Parse JSON data
         auto type = cJSON_GetObjectItem(root, "type");
@@ -426,6 +433,7 @@ void Application::Start() {
                 auto text = cJSON_GetObjectItem(root, "text");
                 if (cJSON_IsString(text)) {
                     ESP_LOGI(TAG, "<< %s", text->valuestring);
+                    // 和状态切换放在同一优先级，保证不会在状态重置之后才显示旧消息
                     Schedule([this, display, message = std::string(text->valuestring)]() {
                         display->SetChatMessage("assistant", message.c_str());
                     });
@@ -442,9 +450,9 @@ void Application::Start() {
         } else if (strcmp(type->valuestring, "llm") == 0) {
             auto emotion = cJSON_GetObjectItem(root, "emotion");
             if (cJSON_IsString(emotion)) {
-                Schedule([this, display, emotion_str = std::string(emotion->valuestring)]() {
-                    display->SetEmotion(emotion_str.c_str());
-                });
+                Schedule([this, display, emotion_id = EmotionFromString(emotion->valuestring)]() {
+                    display->SetEmotion(emotion_id);
+                }, kSchedulePriorityProtocol, "emotion");
             }
         } else if (strcmp(type->valuestring, "mcp") == 0) {
             auto payload = cJSON_GetObjectItem(root, "payload");
@@ -517,21 +525,112 @@ void Application::OnClockTimer() {
 
     // Print the debug info every 10 seconds
     if (clock_ticks_ % 10 == 0) {
-        // SystemInfo::PrintTaskCpuUsage(pdMS_TO_TICKS(1000));
-        // SystemInfo::PrintTaskList();
         SystemInfo::PrintHeapStats();
     }
+    if (clock_ticks_ % 60 == 0) {
+        PrintScheduleStats();
+    }
+#if CONFIG_USE_AUDIO_DEBUGGER
+    // Export the audio trace while idle, so that frames in flight are not split across exports
+    if (clock_ticks_ % 5 == 0 && device_state_ == kDeviceStateIdle) {
+        Schedule([this]() {
+            audio_service_.DumpTrace();
+        }, kSchedulePriorityBackground, "audio_trace");
+    }
+#endif
+#if CONFIG_SEND_PROFILER_TELEMETRY
+    if (clock_ticks_ % 30 == 0) {
+        Schedule([this]() {
+            if (protocol_ && protocol_->IsAudioChannelOpened()) {
+                auto frame = Profiler::GetInstance().GetTelemetryFrame();
+                if (!frame.empty()) {
+                    protocol_->SendTelemetry(frame);
+                }
+            }
+        }, kSchedulePriorityBackground);
+    }
+#endif
 }
 
 // Add a async task to MainLoop
-void Application::Schedule(std::function<void()> callback) {
+void Application::Schedule(MainTask callback, SchedulePriority priority, const char* coalesce_key) {
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        main_tasks_.push_back(std::move(callback));
+        auto& tasks = main_tasks_[priority];
+        // 只和队尾的同名任务合并，不让新任务越过在它之前排队的其他任务
+        if (coalesce_key != nullptr && !tasks.empty()) {
+            auto& task = tasks.back();
+            if (task.coalesce_key != nullptr && strcmp(task.coalesce_key, coalesce_key) == 0) {
+                // Keep the enqueue time of the pending task, only the latest callback matters
+                task.callback = std::move(callback);
+                schedule_coalesced_++;
+                return;
+            }
+        }
+        tasks.push_back(ScheduledTask{std::move(callback), esp_timer_get_time(), coalesce_key});
     }
     xEventGroupSetBits(event_group_, MAIN_EVENT_SCHEDULE);
 }
 
+size_t Application::PendingTaskCount() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (auto& tasks : main_tasks_) {
+        count += tasks.size();
+    }
+    return count;
+}
+
+// Run the pending task with the highest priority, returns false if there is none
+bool Application::RunNextTask() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (int priority = 0; priority < kSchedulePriorityCount; priority++) {
+        auto& tasks = main_tasks_[priority];
+        if (tasks.empty()) {
+            continue;
+        }
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+
+        auto latency_us = esp_timer_get_time() - task.enqueue_time;
+        int bucket = latency_us < 1000 ? 0 : latency_us < 5000 ? 1 : latency_us < 20000 ? 2 : latency_us < 100000 ? 3 : 4;
+        schedule_latency_[priority][bucket]++;
+        lock.unlock();
+
+        task.callback();
+        return true;
+    }
+    return false;
+}
+
+void Application::SendPendingAudio() {
+    while (auto packet = audio_service_.PopPacketFromSendQueue()) {
+        auto trace_id = packet->trace_id;
+        if (!protocol_->SendAudio(std::move(packet))) {
+            break;
+        }
+        audio_service_.TraceFrame(kAudioTraceSend, trace_id);
+    }
+}
+
+void Application::PrintScheduleStats() {
+    static const char* const kPriorityNames[kSchedulePriorityCount] = { "protocol", "background" };
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int priority = 0; priority < kSchedulePriorityCount; priority++) {
+        auto& counts = schedule_latency_[priority];
+        if (counts[0] + counts[1] + counts[2] + counts[3] + counts[4] == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "Schedule latency %s: <1ms %lu, <5ms %lu, <20ms %lu, <100ms %lu, >=100ms %lu", kPriorityNames[priority],
+            counts[0], counts[1], counts[2], counts[3], counts[4]);
+        memset(counts, 0, sizeof(counts));
+    }
+    if (schedule_coalesced_ > 0) {
+        ESP_LOGI(TAG, "Schedule coalesced: %lu", schedule_coalesced_);
+        schedule_coalesced_ = 0;
+    }
+}
+
 // The Main Event Loop controls the chat state and websocket connection
 // If other tasks need to access the websocket or chat state,
 // they should use Schedule to call this function
@@ -551,11 +650,7 @@ void Application::MainEventLoop() {
         }
 
         if (bits & MAIN_EVENT_SEND_AUDIO) {
-            while (auto packet = audio_service_.PopPacketFromSendQueue()) {
-                if (!protocol_->SendAudio(std::move(packet))) {
-                    break;
-                }
-            }
+            SendPendingAudio();
         }
 
         if (bits & MAIN_EVENT_WAKE_WORD_DETECTED) {
@@ -570,11 +665,13 @@ void Application::MainEventLoop() {
         }
 
         if (bits & MAIN_EVENT_SCHEDULE) {
-            std::unique_lock<std::mutex> lock(mutex_);
-            auto tasks = std::move(main_tasks_);
-            lock.unlock();
-            for (auto& task : tasks) {
-                task();
+            // 只执行本轮开始时已经排队的任务；执行期间新加入的任务会重新设置 MAIN_EVENT_SCHEDULE，
+            // 留到下一轮，这样连续产生的任务不会让唤醒词、VAD 和错误事件一直得不到处理
+            for (size_t pending = PendingTaskCount(); pending > 0 && RunNextTask(); pending--) {
+                // A slow task must not hold back the audio that is ready to send
+                if (xEventGroupClearBits(event_group_, MAIN_EVENT_SEND_AUDIO) & MAIN_EVENT_SEND_AUDIO) {
+                    SendPendingAudio();
+                }
             }
         }
     }
@@ -622,6 +719,7 @@ void Application::AbortSpeaking(AbortReason reason) {
     ESP_LOGI(TAG, "Abort speaking");
     aborted_ = true;
     protocol_->SendAbortSpeaking(reason);
+    McpServer::GetInstance().CancelPendingCalls();
 }
 
 void Application::SetListeningMode(ListeningMode mode) {
@@ -650,18 +748,18 @@ void Application::SetDeviceState(DeviceState state) {
         case kDeviceStateUnknown:
         case kDeviceStateIdle:
             display->SetStatus(Lang::Strings::STANDBY);
-            display->SetEmotion("neutral");
+            display->SetEmotion(kEmotionNeutral);
             audio_service_.EnableVoiceProcessing(false);
             audio_service_.EnableWakeWordDetection(true);
             break;
         case kDeviceStateConnecting:
             display->SetStatus(Lang::Strings::CONNECTING);
-            display->SetEmotion("neutral");
+            display->SetEmotion(kEmotionNeutral);
             display->SetChatMessage("system", "");
             break;
         case kDeviceStateListening:
             display->SetStatus(Lang::Strings::LISTENING);
-            display->SetEmotion("neutral");
+            display->SetEmotion(kEmotionNeutral);
 
             // Make sure the audio processor is running
             if (!audio_service_.IsAudioProcessorRunning()) {
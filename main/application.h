@@ -16,6 +16,7 @@
 #include "ota.h"
 #include "audio_service.h"
 #include "device_state_event.h"
+#include "main_task.h"
 
 #define MAIN_EVENT_SCHEDULE (1 << 0)
 #define MAIN_EVENT_SEND_AUDIO (1 << 1)
@@ -43,7 +44,8 @@ public:
     void Start();
     DeviceState GetDeviceState() const { return device_state_; }
     bool IsVoiceDetected() const { return audio_service_.IsVoiceDetected(); }
-    void Schedule(std::function<void()> callback);
+    // 同一优先级内按顺序执行；coalesce_key 不为空时，队尾尚未执行的同名任务会被新任务替换
+    void Schedule(MainTask callback, SchedulePriority priority = kSchedulePriorityProtocol, const char* coalesce_key = nullptr);
     void SetDeviceState(DeviceState state);
     void Alert(const char* status, const char* message, const char* emotion = "", const std::string_view& sound = "");
     void DismissAlert();
@@ -64,8 +66,17 @@ private:
     Application();
     ~Application();
 
+    struct ScheduledTask {
+        MainTask callback;
+        int64_t enqueue_time;
+        const char* coalesce_key;
+    };
+
     std::mutex mutex_;
-    std::deque<std::function<void()>> main_tasks_;
+    std::deque<ScheduledTask> main_tasks_[kSchedulePriorityCount];
+    // 任务排队时间的分布：<1ms, <5ms, <20ms, <100ms, >=100ms
+    uint32_t schedule_latency_[kSchedulePriorityCount][5] = {};
+    uint32_t schedule_coalesced_ = 0;
     std::unique_ptr<Protocol> protocol_;
     EventGroupHandle_t event_group_ = nullptr;
     esp_timer_handle_t clock_timer_handle_ = nullptr;
@@ -81,6 +92,10 @@ private:
     TaskHandle_t check_new_version_task_handle_ = nullptr;
 
     void MainEventLoop();
+    size_t PendingTaskCount();
+    bool RunNextTask();
+    void SendPendingAudio();
+    void PrintScheduleStats();
     void OnWakeWordDetected();
     void CheckNewVersion(Ota& ota);
     void ShowActivationCode(const std::string& code, const std::string& message);
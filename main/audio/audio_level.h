@@ -0,0 +1,95 @@
+#ifndef AUDIO_LEVEL_H
+#define AUDIO_LEVEL_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include <esp_timer.h>
+
+#define AUDIO_LEVEL_STALE_MS 300        // No frames for this long reads as silence
+#define AUDIO_LEVEL_METER_FLOOR_BITS 6  // 0 on the meter is 2^6 RMS, about -54 dBFS
+
+struct AudioLevel {
+    uint16_t rms = 0;       // 0-32767
+    uint16_t peak = 0;
+
+    // RMS on a log scale for level meters, 0 at the floor and 255 at full scale
+    uint8_t Meter() const {
+        if (rms == 0) {
+            return 0;
+        }
+        // log2 in Q8, the mantissa is used as a linear approximation of the fraction
+        int exponent = 31 - __builtin_clz(rms);
+        int fraction = exponent >= 8 ? (rms >> (exponent - 8)) & 0xFF : (rms << (8 - exponent)) & 0xFF;
+        int log2_q8 = (exponent << 8) | fraction;
+        int meter = (log2_q8 - (AUDIO_LEVEL_METER_FLOOR_BITS << 8)) * 255 / ((15 - AUDIO_LEVEL_METER_FLOOR_BITS) << 8);
+        return meter < 0 ? 0 : (meter > 255 ? 255 : meter);
+    }
+};
+
+/*
+ * 音频电平，在已有的音频帧上用定点数计算 RMS 和峰值，写入一个原子变量。
+ * 只能由一个任务更新，任意任务都可以随时读取，不需要加锁。
+ */
+class AudioLevelMeter {
+public:
+    // Update with one frame, stride is 2 to measure one channel of interleaved stereo
+    void Update(const int16_t* samples, size_t count, size_t stride = 1) {
+        if (count == 0) {
+            return;
+        }
+        int64_t sum = 0;
+        uint32_t frame_peak = 0;
+        for (size_t i = 0; i < count; i++) {
+            int32_t sample = samples[i * stride];
+            sum += sample * sample;
+            uint32_t magnitude = sample < 0 ? -sample : sample;
+            frame_peak = magnitude > frame_peak ? magnitude : frame_peak;
+        }
+        uint32_t mean_square = sum / count;
+
+        // Rise at once and fall back over a few frames, so meters read smoothly at any rate
+        mean_square_ = mean_square >= mean_square_ ? mean_square : mean_square_ - (mean_square_ - mean_square) / 4;
+        peak_ = frame_peak >= peak_ ? frame_peak : std::max(frame_peak, peak_ - peak_ / 8);
+
+        uint32_t rms = SquareRoot(mean_square_);
+        uint32_t peak = peak_ > 32767 ? 32767 : peak_;
+        level_.store((rms > 32767 ? 32767 : rms) | (peak << 16), std::memory_order_relaxed);
+        update_time_ms_.store(esp_timer_get_time() / 1000, std::memory_order_relaxed);
+    }
+
+    AudioLevel GetLevel() const {
+        AudioLevel level;
+        uint32_t now_ms = esp_timer_get_time() / 1000;
+        if (now_ms - update_time_ms_.load(std::memory_order_relaxed) > AUDIO_LEVEL_STALE_MS) {
+            return level;
+        }
+        uint32_t value = level_.load(std::memory_order_relaxed);
+        level.rms = value & 0xFFFF;
+        level.peak = value >> 16;
+        return level;
+    }
+
+private:
+    std::atomic<uint32_t> level_{0};            // RMS in the low half, peak in the high half
+    std::atomic<uint32_t> update_time_ms_{0};
+    uint32_t mean_square_ = 0;
+    uint32_t peak_ = 0;
+
+    static uint32_t SquareRoot(uint32_t value) {
+        uint32_t result = 0;
+        for (uint32_t bit = 1u << 30; bit != 0; bit >>= 2) {
+            if (value >= result + bit) {
+                value -= result + bit;
+                result = (result >> 1) + bit;
+            } else {
+                result >>= 1;
+            }
+        }
+        return result;
+    }
+};
+
+#endif // AUDIO_LEVEL_H
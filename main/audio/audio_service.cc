@@ -60,7 +60,13 @@ void AudioService::Initialize(AudioCodec* codec) {
 #endif
 
     audio_processor_->OnOutput([this](std::vector<int16_t>&& data) {
-        PushTaskToEncodeQueue(kAudioTaskTypeEncodeToSendQueue, std::move(data));
+        auto frame_id = audio_trace_.NewFrameId();
+        auto capture_time = capture_time_us_.exchange(0);
+        if (capture_time > 0) {
+            audio_trace_.Record(kAudioTraceCapture, frame_id, capture_time);
+        }
+        audio_trace_.Record(kAudioTraceAfeOut, frame_id);
+        PushTaskToEncodeQueue(kAudioTaskTypeEncodeToSendQueue, std::move(data), frame_id);
     });
 
     audio_processor_->OnVadStateChange([this](bool speaking) {
@@ -89,6 +95,11 @@ void AudioService::Initialize(AudioCodec* codec) {
         .skip_unhandled_events = true,
     };
     esp_timer_create(&audio_power_timer_args, &audio_power_timer_);
+
+#if CONFIG_USE_AUDIO_DEBUGGER
+    audio_debugger_ = std::make_unique<AudioDebugger>();
+    audio_trace_.Initialize();
+#endif
 }
 
 void AudioService::Start() {
@@ -183,13 +194,12 @@ bool AudioService::ReadAudioData(std::vector<int16_t>& data, int sample_rate, in
 
     /* Update the last input time */
     last_input_time_ = std::chrono::steady_clock::now();
-    debug_statistics_.input_count++;
+    debug_counters_.input_count.fetch_add(1, std::memory_order_relaxed);
+    // The microphone is the first channel when the reference channel is interleaved
+    input_level_.Update(data.data(), data.size() / codec_->input_channels(), codec_->input_channels());
 
 #if CONFIG_USE_AUDIO_DEBUGGER
     // 音频调试：发送原始音频数据
-    if (audio_debugger_ == nullptr) {
-        audio_debugger_ = std::make_unique<AudioDebugger>();
-    }
     audio_debugger_->Feed(data);
 #endif
 
@@ -251,6 +261,8 @@ void AudioService::AudioInputTask() {
             std::vector<int16_t> data;
             int samples = audio_processor_->GetFeedSize();
             if (samples > 0) {
+                int64_t expected = 0;
+                capture_time_us_.compare_exchange_strong(expected, esp_timer_get_time());
                 if (ReadAudioData(data, 16000, samples)) {
                     audio_processor_->Feed(std::move(data));
                     continue;
@@ -283,10 +295,12 @@ void AudioService::AudioOutputTask() {
             esp_timer_start_periodic(audio_power_timer_, AUDIO_POWER_CHECK_INTERVAL_MS * 1000);
         }
         codec_->OutputData(task->pcm);
+        audio_trace_.Record(kAudioTracePlayback, task->frame_id);
+        output_level_.Update(task->pcm.data(), task->pcm.size());
 
         /* Update the last output time */
         last_output_time_ = std::chrono::steady_clock::now();
-        debug_statistics_.playback_count++;
+        debug_counters_.playback_count.fetch_add(1, std::memory_order_relaxed);
 
 #if CONFIG_USE_SERVER_AEC
         /* Record the timestamp for server AEC */
@@ -322,6 +336,7 @@ void AudioService::OpusCodecTask() {
             auto task = std::make_unique<AudioTask>();
             task->type = kAudioTaskTypeDecodeToPlaybackQueue;
             task->timestamp = packet->timestamp;
+            task->frame_id = packet->trace_id;
 
             SetDecodeSampleRate(packet->sample_rate, packet->frame_duration);
             if (opus_decoder_->Decode(std::move(packet->payload), task->pcm)) {
@@ -332,6 +347,7 @@ void AudioService::OpusCodecTask() {
                     output_resampler_.Process(task->pcm.data(), task->pcm.size(), resampled.data());
                     task->pcm = std::move(resampled);
                 }
+                audio_trace_.Record(kAudioTraceDecode, task->frame_id);
 
                 lock.lock();
                 audio_playback_queue_.push_back(std::move(task));
@@ -340,7 +356,7 @@ void AudioService::OpusCodecTask() {
                 ESP_LOGE(TAG, "Failed to decode audio");
                 lock.lock();
             }
-            debug_statistics_.decode_count++;
+            debug_counters_.decode_count.fetch_add(1, std::memory_order_relaxed);
         }
         
         /* Encode the audio to send queue */
@@ -354,10 +370,13 @@ void AudioService::OpusCodecTask() {
             packet->frame_duration = OPUS_FRAME_DURATION_MS;
             packet->sample_rate = 16000;
             packet->timestamp = task->timestamp;
+            packet->trace_id = task->frame_id;
+            audio_trace_.Record(kAudioTraceEncodeStart, task->frame_id);
             if (!opus_encoder_->Encode(std::move(task->pcm), packet->payload)) {
                 ESP_LOGE(TAG, "Failed to encode audio");
                 continue;
             }
+            audio_trace_.Record(kAudioTraceEncodeEnd, task->frame_id);
 
             if (task->type == kAudioTaskTypeEncodeToSendQueue) {
                 {
@@ -371,7 +390,7 @@ void AudioService::OpusCodecTask() {
                 std::lock_guard<std::mutex> lock(audio_queue_mutex_);
                 audio_testing_queue_.push_back(std::move(packet));
             }
-            debug_statistics_.encode_count++;
+            debug_counters_.encode_count.fetch_add(1, std::memory_order_relaxed);
             lock.lock();
         }
     }
@@ -394,10 +413,11 @@ void AudioService::SetDecodeSampleRate(int sample_rate, int frame_duration) {
     }
 }
 
-void AudioService::PushTaskToEncodeQueue(AudioTaskType type, std::vector<int16_t>&& pcm) {
+void AudioService::PushTaskToEncodeQueue(AudioTaskType type, std::vector<int16_t>&& pcm, uint32_t frame_id) {
     auto task = std::make_unique<AudioTask>();
     task->type = type;
     task->pcm = std::move(pcm);
+    task->frame_id = frame_id;
     
     /* Push the task to the encode queue */
     std::unique_lock<std::mutex> lock(audio_queue_mutex_);
@@ -418,6 +438,10 @@ void AudioService::PushTaskToEncodeQueue(AudioTaskType type, std::vector<int16_t
 }
 
 bool AudioService::PushPacketToDecodeQueue(std::unique_ptr<AudioStreamPacket> packet, bool wait) {
+    if (packet->trace_id == 0) {
+        packet->trace_id = audio_trace_.NewFrameId();
+        audio_trace_.Record(kAudioTraceReceive, packet->trace_id);
+    }
     std::unique_lock<std::mutex> lock(audio_queue_mutex_);
     if (audio_decode_queue_.size() >= MAX_DECODE_PACKETS_IN_QUEUE) {
         if (wait) {
@@ -570,4 +594,12 @@ void AudioService::CheckAndUpdateAudioPowerState() {
     if (!codec_->input_enabled() && !codec_->output_enabled()) {
         esp_timer_stop(audio_power_timer_);
     }
-}
\ No newline at end of file
+}
+
+void AudioService::DumpTrace() {
+#if CONFIG_USE_AUDIO_DEBUGGER
+    audio_trace_.Export([this](const std::string& chunk) {
+        audio_debugger_->SendTrace(chunk);
+    });
+#endif
+}
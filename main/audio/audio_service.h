@@ -6,6 +6,7 @@
 #include <condition_variable>
 #include <chrono>
 #include <mutex>
+#include <atomic>
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -19,6 +20,8 @@
 #include "audio_codec.h"
 #include "audio_processor.h"
 #include "processors/audio_debugger.h"
+#include "audio_trace.h"
+#include "audio_level.h"
 #include "wake_word.h"
 #include "protocol.h"
 
@@ -69,6 +72,7 @@ struct AudioTask {
     AudioTaskType type;
     std::vector<int16_t> pcm;
     uint32_t timestamp;
+    uint32_t frame_id = 0;
 };
 
 struct DebugStatistics {
@@ -106,6 +110,20 @@ public:
     void PlaySound(const std::string_view& sound);
     bool ReadAudioData(std::vector<int16_t>& data, int sample_rate, int samples);
     void ResetDecoder();
+    DebugStatistics GetDebugStatistics() const {
+        return DebugStatistics{
+            debug_counters_.input_count.load(std::memory_order_relaxed),
+            debug_counters_.decode_count.load(std::memory_order_relaxed),
+            debug_counters_.encode_count.load(std::memory_order_relaxed),
+            debug_counters_.playback_count.load(std::memory_order_relaxed),
+        };
+    }
+    // Microphone and speaker levels, cheap enough to poll from UI timers
+    AudioLevel GetInputLevel() const { return input_level_.GetLevel(); }
+    AudioLevel GetOutputLevel() const { return output_level_.GetLevel(); }
+    void TraceFrame(AudioTraceStage stage, uint32_t frame_id) { audio_trace_.Record(stage, frame_id); }
+    // Send the recorded frame trace through the audio debugger, if enabled
+    void DumpTrace();
 
 private:
     AudioCodec* codec_ = nullptr;
@@ -118,7 +136,18 @@ private:
     OpusResampler input_resampler_;
     OpusResampler reference_resampler_;
     OpusResampler output_resampler_;
-    DebugStatistics debug_statistics_;
+    // 每个计数只由一个音频任务增加，其他任务（如 Profiler）随时读取
+    struct {
+        std::atomic<uint32_t> input_count{0};
+        std::atomic<uint32_t> decode_count{0};
+        std::atomic<uint32_t> encode_count{0};
+        std::atomic<uint32_t> playback_count{0};
+    } debug_counters_;
+    AudioTrace audio_trace_;
+    AudioLevelMeter input_level_;
+    AudioLevelMeter output_level_;
+    // 下一个上行帧的采集时间（近似为送入处理器的第一块数据的读取时间）
+    std::atomic<int64_t> capture_time_us_{0};
 
     EventGroupHandle_t event_group_;
 
@@ -151,7 +180,7 @@ private:
     void AudioInputTask();
     void AudioOutputTask();
     void OpusCodecTask();
-    void PushTaskToEncodeQueue(AudioTaskType type, std::vector<int16_t>&& pcm);
+    void PushTaskToEncodeQueue(AudioTaskType type, std::vector<int16_t>&& pcm, uint32_t frame_id = 0);
     void SetDecodeSampleRate(int sample_rate, int frame_duration);
     void CheckAndUpdateAudioPowerState();
 };
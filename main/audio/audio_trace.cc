@@ -0,0 +1,203 @@
+#include "audio_trace.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+
+#include <vector>
+#include <algorithm>
+#include <new>
+
+#define TAG "AudioTrace"
+
+namespace {
+
+struct TraceEvent {
+    uint32_t frame_id;
+    int64_t time_us;
+    AudioTraceStage stage;
+};
+
+// 以起点阶段命名的区间，上行最后一个阶段是发送，下行是写入 I2S
+const char* const kSegmentNames[kAudioTraceStageCount] = {
+    "afe",              // capture -> afe_out
+    "encode_queue",     // afe_out -> encode_start
+    "encode",           // encode_start -> encode_end
+    "send_queue",       // encode_end -> send
+    nullptr,
+    "decode",           // receive -> decode
+    "playback",         // decode -> playback
+    nullptr,
+};
+
+} // namespace
+
+AudioTrace::~AudioTrace() {
+    if (ring_ != nullptr) {
+        for (uint32_t i = 0; i < capacity_; i++) {
+            ring_[i].~Entry();
+        }
+        heap_caps_free(ring_);
+    }
+}
+
+void AudioTrace::Initialize() {
+    if (ring_ != nullptr) {
+        return;
+    }
+    capacity_ = AUDIO_TRACE_RING_SIZE;
+    void* memory = heap_caps_malloc(sizeof(Entry) * capacity_, MALLOC_CAP_SPIRAM);
+    if (memory == nullptr) {
+        capacity_ = AUDIO_TRACE_RING_SIZE_INTERNAL;
+        memory = heap_caps_malloc(sizeof(Entry) * capacity_, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (memory == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate trace ring");
+        capacity_ = 0;
+        return;
+    }
+    auto ring = (Entry*)memory;
+    for (uint32_t i = 0; i < capacity_; i++) {
+        new (&ring[i]) Entry();
+        ring[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    ring_ = ring;
+    ESP_LOGI(TAG, "Tracing audio frames, ring size %lu", capacity_);
+}
+
+uint32_t AudioTrace::NewFrameId() {
+    if (ring_ == nullptr) {
+        return 0;
+    }
+    uint32_t frame_id = next_frame_id_.fetch_add(1, std::memory_order_relaxed);
+    return frame_id != 0 ? frame_id : next_frame_id_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AudioTrace::Record(AudioTraceStage stage, uint32_t frame_id, int64_t time_us) {
+    if (ring_ == nullptr || frame_id == 0) {
+        return;
+    }
+    if (time_us == 0) {
+        time_us = esp_timer_get_time();
+    }
+    uint32_t index = head_.fetch_add(1, std::memory_order_relaxed);
+    auto& entry = ring_[index & (capacity_ - 1)];
+    entry.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry.frame_id = frame_id;
+    entry.time_us = time_us;
+    entry.stage = stage;
+    entry.sequence.store(index + 1, std::memory_order_release);
+}
+
+size_t AudioTrace::Export(std::function<void(const std::string& chunk)> writer, AudioTraceStats* stats) {
+    if (stats != nullptr) {
+        *stats = {};
+    }
+    if (ring_ == nullptr) {
+        return 0;
+    }
+    uint32_t head = head_.load(std::memory_order_acquire);
+    uint32_t start = exported_;
+    if (head == start) {
+        return 0;
+    }
+    if (head - start > capacity_) {
+        ESP_LOGW(TAG, "Dropped %lu entries", head - start - capacity_);
+        start = head - capacity_;
+    }
+    exported_ = head;
+
+    // Entries still being written or already overwritten are skipped
+    std::vector<TraceEvent> events;
+    events.reserve(head - start);
+    for (uint32_t index = start; index != head; index++) {
+        auto& entry = ring_[index & (capacity_ - 1)];
+        uint32_t sequence = entry.sequence.load(std::memory_order_acquire);
+        TraceEvent event = { entry.frame_id, entry.time_us, entry.stage };
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence == index + 1 && entry.sequence.load(std::memory_order_relaxed) == sequence) {
+            events.push_back(event);
+        }
+    }
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.frame_id != b.frame_id ? a.frame_id < b.frame_id : a.time_us < b.time_us;
+    });
+
+    // 每一帧的各个区间输出为一对异步事件，流水线上相互重叠的帧才能正确显示。
+    // 每个分块单独成为一个完整的 JSON 对象并带有序号，UDP 丢包或乱序时接收端仍能解析其余分块
+    uint32_t export_id = ++export_count_;
+    uint32_t seq = 0;
+    std::string chunk;
+    char buffer[160];
+    bool first = true;
+    auto begin_chunk = [&]() {
+        snprintf(buffer, sizeof(buffer), "{\"export\":%lu,\"seq\":%lu,\"events\":[", export_id, seq++);
+        chunk = buffer;
+        first = true;
+    };
+    begin_chunk();
+
+    AudioTraceStats result = {};
+    int64_t uplink_total = 0, downlink_total = 0;
+    auto append = [&](const char* name, const char* category, char phase, uint32_t frame_id, int64_t time_us) {
+        snprintf(buffer, sizeof(buffer), "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"id\":%lu,\"ts\":%lld,\"pid\":1,\"tid\":%d}",
+            first ? "" : ",", name, category, phase, frame_id, time_us, category[0] == 'u' ? 1 : 2);
+        first = false;
+        chunk += buffer;
+        if (chunk.size() >= AUDIO_TRACE_CHUNK_SIZE) {
+            chunk += "]}";
+            writer(chunk);
+            begin_chunk();
+        }
+    };
+
+    for (size_t i = 0; i < events.size();) {
+        size_t end = i;
+        while (end < events.size() && events[end].frame_id == events[i].frame_id) {
+            end++;
+        }
+        bool uplink = events[i].stage < kAudioTraceReceive;
+        const char* category = uplink ? "uplink" : "downlink";
+        for (size_t j = i; j + 1 < end; j++) {
+            auto name = kSegmentNames[events[j].stage];
+            if (name == nullptr) {
+                continue;
+            }
+            append(name, category, 'b', events[j].frame_id, events[j].time_us);
+            append(name, category, 'e', events[j].frame_id, events[j + 1].time_us);
+        }
+
+        // Device side latency, from the microphone to the network and from the network to the speaker
+        auto first_stage = events[i].stage;
+        auto last_stage = events[end - 1].stage;
+        int64_t latency = events[end - 1].time_us - events[i].time_us;
+        if (first_stage == kAudioTraceCapture && last_stage == kAudioTraceSend) {
+            uplink_total += latency;
+            result.uplink_max_us = std::max(result.uplink_max_us, latency);
+            result.uplink_frames++;
+        } else if (first_stage == kAudioTraceReceive && last_stage == kAudioTracePlayback) {
+            downlink_total += latency;
+            result.downlink_max_us = std::max(result.downlink_max_us, latency);
+            result.downlink_frames++;
+        }
+        result.frames++;
+        i = end;
+    }
+    chunk += "],\"last\":true}";
+    writer(chunk);
+
+    if (result.uplink_frames > 0) {
+        result.uplink_avg_us = uplink_total / result.uplink_frames;
+    }
+    if (result.downlink_frames > 0) {
+        result.downlink_avg_us = downlink_total / result.downlink_frames;
+    }
+    if (stats != nullptr) {
+        *stats = result;
+    }
+    ESP_LOGI(TAG, "Exported %u frames in %lu chunks, uplink avg %lld max %lld ms (%d), downlink avg %lld max %lld ms (%d)",
+        result.frames, seq, result.uplink_avg_us / 1000, result.uplink_max_us / 1000, result.uplink_frames,
+        result.downlink_avg_us / 1000, result.downlink_max_us / 1000, result.downlink_frames);
+    return result.frames;
+}
@@ -0,0 +1,76 @@
+#ifndef AUDIO_TRACE_H
+#define AUDIO_TRACE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#define AUDIO_TRACE_RING_SIZE 2048          // PSRAM, must be a power of two
+#define AUDIO_TRACE_RING_SIZE_INTERNAL 256  // Without PSRAM
+#define AUDIO_TRACE_CHUNK_SIZE 1024         // Events per datagram are flushed past this size
+
+enum AudioTraceStage : uint8_t {
+    kAudioTraceCapture,
+    kAudioTraceAfeOut,
+    kAudioTraceEncodeStart,
+    kAudioTraceEncodeEnd,
+    kAudioTraceSend,
+    kAudioTraceReceive,
+    kAudioTraceDecode,
+    kAudioTracePlayback,
+    kAudioTraceStageCount
+};
+
+// 一次导出中完整帧的设备端延迟，上行从采集到发送，下行从接收到写入 I2S
+struct AudioTraceStats {
+    size_t frames;
+    int uplink_frames;
+    int64_t uplink_avg_us;
+    int64_t uplink_max_us;
+    int downlink_frames;
+    int64_t downlink_avg_us;
+    int64_t downlink_max_us;
+};
+
+/*
+ * 音频帧链路追踪。每一帧分配一个单调递增的 id，各阶段的时间戳写入无锁环形缓冲，
+ * 可导出为 Chrome trace-event JSON，用 chrome://tracing 或 Perfetto 打开。
+ * 上行帧从采集到发送，下行帧从接收到写入 I2S，id 为 0 的帧不记录。
+ */
+class AudioTrace {
+public:
+    AudioTrace() = default;
+    ~AudioTrace();
+    AudioTrace(const AudioTrace&) = delete;
+    AudioTrace& operator=(const AudioTrace&) = delete;
+
+    // Allocate the ring buffer, nothing is recorded before this is called
+    void Initialize();
+    uint32_t NewFrameId();
+    // time_us of 0 means now, safe to call from any task
+    void Record(AudioTraceStage stage, uint32_t frame_id, int64_t time_us = 0);
+    // Export the entries recorded since the last export. Every chunk passed to the writer is a complete
+    // JSON object {"export":N,"seq":S,"events":[...]}, the last one also has "last":true, so that each
+    // chunk can be sent as one UDP datagram and reassembled by scripts/audio_debug_server.py.
+    // Returns the number of frames exported, must not be called from more than one task at a time.
+    size_t Export(std::function<void(const std::string& chunk)> writer, AudioTraceStats* stats = nullptr);
+
+private:
+    struct Entry {
+        std::atomic<uint32_t> sequence;     // Index + 1 once written, 0 while being written
+        uint32_t frame_id;
+        int64_t time_us;
+        AudioTraceStage stage;
+    };
+
+    Entry* ring_ = nullptr;
+    uint32_t capacity_ = 0;
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> next_frame_id_{1};
+    uint32_t exported_ = 0;
+    uint32_t export_count_ = 0;
+};
+
+#endif
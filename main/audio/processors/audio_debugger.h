@@ -2,6 +2,7 @@
 #define AUDIO_DEBUGGER_H
 
 #include <vector>
+#include <string>
 #include <cstdint>
 
 #include <sys/socket.h>
@@ -13,10 +14,14 @@ public:
     ~AudioDebugger();
 
     void Feed(const std::vector<int16_t>& data);
+    // 音频链路追踪数据发送到同一地址的下一个端口，避免与 PCM 数据混在一起。
+    // 每个分块是一个完整的 JSON 对象，带有导出序号和分块序号，由接收端重新拼成 trace 文件
+    void SendTrace(const std::string& chunk);
 
 private:
     int udp_sockfd_ = -1;
     struct sockaddr_in udp_server_addr_;
+    struct sockaddr_in udp_trace_addr_;
 };
 
 #endif 
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "afsk_demod.h"
+#include "afsk_frame.h"
+#include "board.h"
 #include <cstring>
 #include <algorithm>
+#include <limits>
 #include "esp_log.h"
 
 #ifndef M_PI
@@ -14,11 +17,18 @@ namespace audio_wifi_config
     void ReceiveWifiCredentialsFromAudio(Application *app,
                                        WifiConfigurationAp *wifi_ap)
     {
-        const int kInputSampleRate = 16000;                                    // Input sampling rate
-        const float kDownsampleStep = static_cast<float>(kInputSampleRate) / static_cast<float>(kAudioSampleRate); // Downsampling step
+        const size_t kReadSamples = 480;                                       // 30ms at 16kHz
+        const size_t kMaxProbabilities = 16;
         std::vector<int16_t> audio_data;
-        AudioSignalProcessor signal_processor(kAudioSampleRate, kMarkFrequency, kSpaceFrequency, kBitRate, kWindowSize);
-        AudioDataBuffer data_buffer;
+        audio_data.reserve(kReadSamples * 2);
+        float probabilities[kMaxProbabilities];
+        // The sender picks the bit rate, both are demodulated all the time
+        AudioSignalProcessor signal_processor(kMarkFrequency, kSpaceFrequency, kBitRate);
+        AudioSignalProcessor fast_signal_processor(kFastMarkFrequency, kFastSpaceFrequency, kFastBitRate);
+        FrameDecoder frame_decoder("normal");
+        FrameDecoder fast_frame_decoder("fast");
+        AudioDataBuffer data_buffer;  // Unframed transfers from older senders
+        int input_channels = Board::GetInstance().GetAudioCodec()->input_channels();
 
         while (true)
         {
@@ -29,75 +39,58 @@ namespace audio_wifi_config
                 continue;
             }
             
-            if (!app->GetAudioService().ReadAudioData(audio_data, 16000, 480)) { // 16kHz, 480 samples corresponds to 30ms data
+            if (!app->GetAudioService().ReadAudioData(audio_data, kInputSampleRate, kReadSamples)) {
                 // 读取音频失败，短暂延迟后重试
                 ESP_LOGI(kLogTag, "Failed to read audio data, retrying.");
                 vTaskDelay(pdMS_TO_TICKS(10));
                 continue;
             }
             
-            // Downsample the audio data
-            std::vector<float> downsampled_data;
-            size_t last_index = 0;
-
-            if (kDownsampleStep > 1.0f)
+            // Only the microphone channel is used when the reference channel is interleaved
+            size_t frames = audio_data.size() / input_channels;
+            std::string wifi_ssid, wifi_password;
+            bool received = false;
+
+            size_t probability_count = signal_processor.ProcessAudioSamples(audio_data.data(),
+                frames, input_channels, probabilities, kMaxProbabilities);
+            if (frame_decoder.ProcessProbabilityData(probabilities, probability_count))
             {
-                downsampled_data.reserve(audio_data.size() / static_cast<size_t>(kDownsampleStep));
-                for (size_t i = 0; i < audio_data.size(); ++i)
-                {
-                    size_t sample_index = static_cast<size_t>(i / kDownsampleStep);
-                    if ((sample_index + 1) > last_index)
-                    {
-                        downsampled_data.push_back(static_cast<float>(audio_data[i]));
-                        last_index = sample_index + 1;
-                    }
-                }
+                received = ParseCredentials(*frame_decoder.decoded_payload, wifi_ssid, wifi_password);
+                frame_decoder.decoded_payload.reset();
             }
-            else
+            else if (data_buffer.ProcessProbabilityData(probabilities, probability_count, 0.5f) &&
+                     data_buffer.decoded_text.has_value())
             {
-                downsampled_data.reserve(audio_data.size());
-                for (int16_t sample : audio_data)
+                // Split SSID and password by newline character
+                size_t newline_position = data_buffer.decoded_text->find('\n');
+                if (newline_position != std::string::npos)
                 {
-                    downsampled_data.push_back(static_cast<float>(sample));
+                    wifi_ssid = data_buffer.decoded_text->substr(0, newline_position);
+                    wifi_password = data_buffer.decoded_text->substr(newline_position + 1);
+                    received = true;
                 }
+                data_buffer.decoded_text.reset();  // Clear processed data
             }
-            
-            // Process audio samples to get probability data
-            auto probabilities = signal_processor.ProcessAudioSamples(downsampled_data);
-            
-            // Feed probability data to the data buffer
-            if (data_buffer.ProcessProbabilityData(probabilities, 0.5f))
+
+            probability_count = fast_signal_processor.ProcessAudioSamples(audio_data.data(),
+                frames, input_channels, probabilities, kMaxProbabilities);
+            if (!received && fast_frame_decoder.ProcessProbabilityData(probabilities, probability_count))
             {
-                // If complete data was received, extract WiFi credentials
-                if (data_buffer.decoded_text.has_value())
+                received = ParseCredentials(*fast_frame_decoder.decoded_payload, wifi_ssid, wifi_password);
+                fast_frame_decoder.decoded_payload.reset();
+            }
+
+            if (received)
+            {
+                ESP_LOGI(kLogTag, "WiFi SSID: %s, Password: %s", wifi_ssid.c_str(), wifi_password.c_str());
+                if (wifi_ap->ConnectToWifi(wifi_ssid, wifi_password))
                 {
-                    ESP_LOGI(kLogTag, "Received text data: %s", data_buffer.decoded_text->c_str());
-                    
-                    // Split SSID and password by newline character
-                    std::string wifi_ssid, wifi_password;
-                    size_t newline_position = data_buffer.decoded_text->find('\n');
-                    if (newline_position != std::string::npos)
-                    {
-                        wifi_ssid = data_buffer.decoded_text->substr(0, newline_position);
-                        wifi_password = data_buffer.decoded_text->substr(newline_position + 1);
-                        ESP_LOGI(kLogTag, "WiFi SSID: %s, Password: %s", wifi_ssid.c_str(), wifi_password.c_str());
-                    }
-                    else
-                    {
-                        ESP_LOGE(kLogTag, "Invalid data format, no newline character found");
-                        continue;
-                    }
-                    
-                    if (wifi_ap->ConnectToWifi(wifi_ssid, wifi_password))
-                    {
-                        wifi_ap->Save(wifi_ssid, wifi_password);  // Save WiFi credentials
-                        esp_restart();                            // Restart device to apply new WiFi configuration
-                    }
-                    else
-                    {
-                        ESP_LOGE(kLogTag, "Failed to connect to WiFi with received credentials");
-                    }
-                    data_buffer.decoded_text.reset();  // Clear processed data
+                    wifi_ap->Save(wifi_ssid, wifi_password);  // Save WiFi credentials
+                    esp_restart();                            // Restart device to apply new WiFi configuration
+                }
+                else
+                {
+                    ESP_LOGE(kLogTag, "Failed to connect to WiFi with received credentials");
                 }
             }
             vTaskDelay(pdMS_TO_TICKS(1));  // 1ms delay
@@ -113,125 +106,165 @@ namespace audio_wifi_config
     const std::vector<uint8_t> kDefaultEndTransmissionPattern = {
         0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0};
 
-    // FrequencyDetector implementation
-    FrequencyDetector::FrequencyDetector(float frequency, size_t window_size)
-        : frequency_(frequency), window_size_(window_size)
+    // Decimator implementation
+    Decimator::Decimator(float cutoff)
+        : history_index_(0), phase_(0)
     {
-        frequency_bin_ = std::floor(frequency_ * static_cast<float>(window_size_));
-        angular_frequency_ = 2.0f * M_PI * frequency_;
-        cos_coefficient_ = std::cos(angular_frequency_);
-        sin_coefficient_ = std::sin(angular_frequency_);
-        filter_coefficient_ = 2.0f * cos_coefficient_;
-
-        // Initialize state buffer
-        state_buffer_.push_back(0.0f);
-        state_buffer_.push_back(0.0f);
-    }
-
-    void FrequencyDetector::Reset()
-    {
-        state_buffer_.clear();
-        state_buffer_.push_back(0.0f);
-        state_buffer_.push_back(0.0f);
+        // Blackman windowed sinc, normalized to unity gain at DC
+        const int center = kDecimatorTaps / 2;
+        float sum = 0.0f;
+        for (size_t i = 0; i < kDecimatorTaps; ++i)
+        {
+            int n = static_cast<int>(i) - center;
+            float sinc = n == 0 ? 2.0f * cutoff : std::sin(2.0f * M_PI * cutoff * n) / (M_PI * n);
+            float window = 0.42f - 0.5f * std::cos(2.0f * M_PI * i / (kDecimatorTaps - 1)) +
+                           0.08f * std::cos(4.0f * M_PI * i / (kDecimatorTaps - 1));
+            taps_[i] = sinc * window;
+            sum += taps_[i];
+        }
+        for (float &tap : taps_)
+        {
+            tap /= sum;
+        }
+        memset(history_, 0, sizeof(history_));
     }
 
-    void FrequencyDetector::ProcessSample(float sample)
+    size_t Decimator::Process(const int16_t *samples, size_t count, size_t stride, float *output)
     {
-        if (state_buffer_.size() < 2)
+        size_t output_count = 0;
+        for (size_t i = 0; i < count; ++i)
         {
-            return;
-        }
+            float sample = static_cast<float>(samples[i * stride]);
+            history_[history_index_] = sample;
+            history_[history_index_ + kDecimatorTaps] = sample;
+            history_index_ = history_index_ + 1 < kDecimatorTaps ? history_index_ + 1 : 0;
 
-        float s_minus_2 = state_buffer_.front();  // S[-2]
-        state_buffer_.pop_front();
-        float s_minus_1 = state_buffer_.front();  // S[-1]
-        state_buffer_.pop_front();
-
-        float s_current = sample + filter_coefficient_ * s_minus_1 - s_minus_2;
+            // Only the samples that are kept are filtered
+            if (++phase_ < kDecimationFactor)
+            {
+                continue;
+            }
+            phase_ = 0;
 
-        state_buffer_.push_back(s_minus_1);  // Put S[-1] back
-        state_buffer_.push_back(s_current);  // Add new S[0]
+            // Four independent accumulators keep the FPU pipeline busy
+            const float *history = &history_[history_index_];
+            float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+            size_t j = 0;
+            for (; j + 4 <= kDecimatorTaps; j += 4)
+            {
+                acc0 += taps_[j] * history[j];
+                acc1 += taps_[j + 1] * history[j + 1];
+                acc2 += taps_[j + 2] * history[j + 2];
+                acc3 += taps_[j + 3] * history[j + 3];
+            }
+            for (; j < kDecimatorTaps; ++j)
+            {
+                acc0 += taps_[j] * history[j];
+            }
+            output[output_count++] = (acc0 + acc1) + (acc2 + acc3);
+        }
+        return output_count;
     }
 
-    float FrequencyDetector::GetAmplitude() const
+    // FrequencyDetector implementation
+    FrequencyDetector::FrequencyDetector(size_t bin, size_t window_size)
     {
-        if (state_buffer_.size() < 2)
-        {
-            return 0.0f;
-        }
+        const float kDampingFactor = 0.9999f;
+        float angular_frequency = 2.0f * M_PI * static_cast<float>(bin) / static_cast<float>(window_size);
+        cos_coefficient_ = kDampingFactor * std::cos(angular_frequency);
+        sin_coefficient_ = kDampingFactor * std::sin(angular_frequency);
+        damping_ = std::pow(kDampingFactor, static_cast<float>(window_size));
+        Reset();
+    }
 
-        float s_minus_1 = state_buffer_[1];                      // S[-1]
-        float s_minus_2 = state_buffer_[0];                      // S[-2]
-        float real_part = cos_coefficient_ * s_minus_1 - s_minus_2;  // Real part
-        float imaginary_part = sin_coefficient_ * s_minus_1;         // Imaginary part
+    void FrequencyDetector::Reset()
+    {
+        real_ = 0.0f;
+        imaginary_ = 0.0f;
+    }
 
-        return std::sqrt(real_part * real_part + imaginary_part * imaginary_part) / 
-               (static_cast<float>(window_size_) / 2.0f);
+    float FrequencyDetector::GetAmplitude() const
+    {
+        return std::sqrt(real_ * real_ + imaginary_ * imaginary_);
     }
 
     // AudioSignalProcessor implementation
-    AudioSignalProcessor::AudioSignalProcessor(size_t sample_rate, size_t mark_frequency, size_t space_frequency,
-                                             size_t bit_rate, size_t window_size)
-        : input_buffer_size_(window_size), output_sample_count_(0)
+    AudioSignalProcessor::AudioSignalProcessor(size_t mark_frequency, size_t space_frequency, size_t bit_rate)
+        : decimator_(3000.0f / kInputSampleRate),
+          window_size_(std::min(kAudioSampleRate / bit_rate, kWindowSize)),
+          window_index_(0),
+          mark_detector_(mark_frequency * window_size_ / kAudioSampleRate, window_size_),
+          space_detector_(space_frequency * window_size_ / kAudioSampleRate, window_size_),
+          bit_phase_(0.0f),
+          bit_period_(window_size_),
+          last_decision_(0.0f)
     {
-        if (sample_rate % bit_rate != 0)
+        if (kAudioSampleRate % bit_rate != 0 || mark_frequency * window_size_ % kAudioSampleRate != 0 ||
+            space_frequency * window_size_ % kAudioSampleRate != 0)
         {
             // On ESP32 we can continue execution, but log the error
-            ESP_LOGW(kLogTag, "Sample rate %zu is not divisible by bit rate %zu", sample_rate, bit_rate);
+            ESP_LOGW(kLogTag, "Mark %u Hz and space %u Hz do not fall on DFT bins at %u bps",
+                     mark_frequency, space_frequency, bit_rate);
         }
-
-        float normalized_mark_freq = static_cast<float>(mark_frequency) / static_cast<float>(sample_rate);
-        float normalized_space_freq = static_cast<float>(space_frequency) / static_cast<float>(sample_rate);
-
-        mark_detector_ = std::make_unique<FrequencyDetector>(normalized_mark_freq, window_size);
-        space_detector_ = std::make_unique<FrequencyDetector>(normalized_space_freq, window_size);
-
-        samples_per_bit_ = sample_rate / bit_rate;  // Number of samples per bit
+        memset(window_, 0, sizeof(window_));
     }
 
-    std::vector<float> AudioSignalProcessor::ProcessAudioSamples(const std::vector<float> &samples)
+    size_t AudioSignalProcessor::ProcessAudioSamples(const int16_t *samples, size_t count, size_t stride,
+                                                     float *probabilities, size_t max_probabilities)
     {
-        std::vector<float> result;
-
-        for (float sample : samples)
+        // Gains of the bit clock loop, the phase follows each transition a quarter of the way
+        // and the bit period slowly follows the clock of the sender
+        const float kPhaseGain = 0.25f;
+        const float kPeriodGain = 0.01f;
+        const float kMinBitPeriod = window_size_ * 0.95f;
+        const float kMaxBitPeriod = window_size_ * 1.05f;
+        size_t result_count = 0;
+
+        while (count > 0)
         {
-            if (input_buffer_.size() < input_buffer_size_)
-            {
-                input_buffer_.push_back(sample);  // Just add, don't process yet
-            }
-            else
+            size_t input_count = std::min(count, kProcessBlockSize * kDecimationFactor);
+            size_t block_size = decimator_.Process(samples, input_count, stride, block_);
+            samples += input_count * stride;
+            count -= input_count;
+
+            for (size_t i = 0; i < block_size; ++i)
             {
-                // Input buffer is full, process the data
-                input_buffer_.pop_front();   // Remove oldest sample
-                input_buffer_.push_back(sample);  // Add new sample
-                output_sample_count_++;
+                float sample = block_[i];
+                float old_sample = window_[window_index_];
+                window_[window_index_] = sample;
+                window_index_ = window_index_ + 1 < window_size_ ? window_index_ + 1 : 0;
+                mark_detector_.Update(sample, old_sample);
+                space_detector_.Update(sample, old_sample);
+
+                float mark_amplitude = mark_detector_.GetAmplitude();
+                float space_amplitude = space_detector_.GetAmplitude();
+                float decision = mark_amplitude - space_amplitude;
+
+                // The one bit window straddles a bit boundary evenly when mark and space cross,
+                // which should happen half a bit away from the sampling point
+                bit_phase_ += 1.0f;
+                if ((decision > 0.0f) != (last_decision_ > 0.0f))
+                {
+                    float error = bit_period_ * 0.5f - bit_phase_;
+                    bit_phase_ += error * kPhaseGain;
+                    bit_period_ = std::clamp(bit_period_ - error * kPeriodGain, kMinBitPeriod, kMaxBitPeriod);
+                }
+                last_decision_ = decision;
 
-                if (output_sample_count_ >= samples_per_bit_)
+                if (bit_phase_ >= bit_period_)
                 {
-                    // Process all samples in the window using Goertzel algorithm
-                    for (float window_sample : input_buffer_)
+                    bit_phase_ -= bit_period_;
+                    if (result_count < max_probabilities)
                     {
-                        mark_detector_->ProcessSample(window_sample);
-                        space_detector_->ProcessSample(window_sample);
+                        // Avoid division by zero
+                        probabilities[result_count++] = mark_amplitude /
+                            (space_amplitude + mark_amplitude + std::numeric_limits<float>::epsilon());
                     }
-
-                    float mark_amplitude = mark_detector_->GetAmplitude();   // Mark amplitude
-                    float space_amplitude = space_detector_->GetAmplitude(); // Space amplitude
-
-                    // Avoid division by zero
-                    float mark_probability = mark_amplitude / 
-                                           (space_amplitude + mark_amplitude + std::numeric_limits<float>::epsilon());
-                    result.push_back(mark_probability);
-
-                    // Reset detector windows
-                    mark_detector_->Reset();
-                    space_detector_->Reset();
-                    output_sample_count_ = 0;  // Reset output counter
                 }
             }
         }
 
-        return result;
+        return result_count;
     }
 
     // AudioDataBuffer implementation
@@ -276,11 +309,11 @@ namespace audio_wifi_config
         bit_buffer_.clear();
     }
 
-    bool AudioDataBuffer::ProcessProbabilityData(const std::vector<float> &probabilities, float threshold)
+    bool AudioDataBuffer::ProcessProbabilityData(const float *probabilities, size_t count, float threshold)
     {
-        for (float probability : probabilities)
+        for (size_t i = 0; i < count; ++i)
         {
-            uint8_t bit = (probability > threshold) ? 1 : 0;
+            uint8_t bit = (probabilities[i] > threshold) ? 1 : 0;
 
             if (identifier_buffer_.size() >= identifier_buffer_size_)
             {
@@ -3,18 +3,26 @@
 #include <vector>
 #include <deque>
 #include <string>
-#include <memory>
 #include <optional>
 #include <cmath>
 #include "wifi_configuration_ap.h"
 #include "application.h"
 
 // Audio signal processing constants for WiFi configuration via audio
-const size_t kAudioSampleRate = 6400;
+// The 16 kHz input is filtered and decimated by 2, mark and space fall on exact DFT bins of a one bit window
+const size_t kInputSampleRate = 16000;
+const size_t kDecimationFactor = 2;
+const size_t kAudioSampleRate = kInputSampleRate / kDecimationFactor;
 const size_t kMarkFrequency = 1800;
 const size_t kSpaceFrequency = 1500;
 const size_t kBitRate = 100;
-const size_t kWindowSize = 64;
+const size_t kWindowSize = kAudioSampleRate / kBitRate;
+// Fast mode for quiet rooms, the tones are two bins apart in the shorter window
+const size_t kFastMarkFrequency = 1800;
+const size_t kFastSpaceFrequency = 1400;
+const size_t kFastBitRate = 200;
+const size_t kDecimatorTaps = 31;
+const size_t kProcessBlockSize = 256;   // Decimated samples processed at a time
 
 namespace audio_wifi_config
 {
@@ -22,28 +30,55 @@ namespace audio_wifi_config
     void ReceiveWifiCredentialsFromAudio(Application *app, WifiConfigurationAp *wifi_ap);
 
     /**
-     * Goertzel algorithm implementation for single frequency detection
-     * Used to detect specific audio frequencies in the AFSK demodulation process
+     * Low-pass FIR filter followed by integer decimation
+     * The history is stored twice so that every output is one contiguous dot product
+     */
+    class Decimator
+    {
+    private:
+        float taps_[kDecimatorTaps];               // Windowed-sinc coefficients
+        float history_[kDecimatorTaps * 2];        // Input history, mirrored
+        size_t history_index_;                     // Position of the oldest sample
+        size_t phase_;                             // Input samples since the last output
+
+    public:
+        /**
+         * Constructor
+         * @param cutoff Normalized cutoff frequency (f / input sample rate)
+         */
+        explicit Decimator(float cutoff);
+
+        /**
+         * Filter and decimate a block of samples
+         * @param samples Input samples
+         * @param count Number of input frames
+         * @param stride Distance between consecutive samples, 2 to take one channel of interleaved stereo
+         * @param output Output buffer, must hold count / kDecimationFactor + 1 samples
+         * @return Number of output samples
+         */
+        size_t Process(const int16_t *samples, size_t count, size_t stride, float *output);
+    };
+
+    /**
+     * Sliding DFT for a single frequency bin
+     * Updated once per sample in O(1), the damping factor keeps rounding errors from accumulating
      */
     class FrequencyDetector
     {
     private:
-        float frequency_;              // Target frequency (normalized, i.e., f / fs)
-        size_t window_size_;           // Window size for analysis
-        float frequency_bin_;          // Frequency bin
-        float angular_frequency_;      // Angular frequency
-        float cos_coefficient_;        // cos(w)
-        float sin_coefficient_;        // sin(w)
-        float filter_coefficient_;     // 2 * cos(w)
-        std::deque<float> state_buffer_;  // Circular buffer for storing S[-1] and S[-2]
+        float real_;                   // Current bin value
+        float imaginary_;
+        float cos_coefficient_;        // r * cos(w)
+        float sin_coefficient_;        // r * sin(w)
+        float damping_;                // r ^ N, applied to the sample leaving the window
 
     public:
         /**
          * Constructor
-         * @param frequency Normalized frequency (f / fs)
+         * @param bin DFT bin index (f * N / fs)
          * @param window_size Window size for analysis
          */
-        FrequencyDetector(float frequency, size_t window_size);
+        FrequencyDetector(size_t bin, size_t window_size);
 
         /**
          * Reset the detector state
@@ -51,10 +86,17 @@ namespace audio_wifi_config
         void Reset();
 
         /**
-         * Process one audio sample
-         * @param sample Input audio sample
+         * Slide the window by one sample
+         * @param new_sample Sample entering the window
+         * @param old_sample Sample leaving the window
          */
-        void ProcessSample(float sample);
+        inline void Update(float new_sample, float old_sample)
+        {
+            float real = real_ + new_sample - damping_ * old_sample;
+            float imaginary = imaginary_;
+            real_ = real * cos_coefficient_ - imaginary * sin_coefficient_;
+            imaginary_ = real * sin_coefficient_ + imaginary * cos_coefficient_;
+        }
 
         /**
          * Calculate current amplitude
@@ -65,36 +107,43 @@ namespace audio_wifi_config
 
     /**
      * Audio signal processor for Mark/Space frequency pair detection
-     * Processes audio signals to extract digital data using AFSK demodulation
+     * Decimates the input, tracks both tones with sliding DFTs and recovers the bit clock
+     * from mark/space transitions, so a sender whose clock drifts is still sampled mid-bit
      */
     class AudioSignalProcessor
     {
     private:
-        std::deque<float> input_buffer_;             // Input sample buffer
-        size_t input_buffer_size_;                   // Input buffer size = window size
-        size_t output_sample_count_;                 // Output sample counter
-        size_t samples_per_bit_;                     // Samples per bit threshold
-        std::unique_ptr<FrequencyDetector> mark_detector_;   // Mark frequency detector
-        std::unique_ptr<FrequencyDetector> space_detector_;  // Space frequency detector
+        Decimator decimator_;                        // Anti-aliasing filter and decimator
+        float block_[kProcessBlockSize + 1];         // Decimated samples
+        float window_[kWindowSize];                  // Samples in the DFT window, at most one bit at kBitRate
+        size_t window_size_;                         // Samples per bit
+        size_t window_index_;                        // Position of the oldest sample in the window
+        FrequencyDetector mark_detector_;            // Mark frequency detector
+        FrequencyDetector space_detector_;           // Space frequency detector
+        float bit_phase_;                            // Samples since the last bit decision
+        float bit_period_;                           // Estimated samples per bit of the sender
+        float last_decision_;                        // Mark minus space of the previous sample
 
     public:
         /**
          * Constructor
-         * @param sample_rate Audio sampling rate
          * @param mark_frequency Mark frequency for digital '1'
          * @param space_frequency Space frequency for digital '0'
-         * @param bit_rate Data transmission bit rate
-         * @param window_size Analysis window size
+         * @param bit_rate Data transmission bit rate, at least kBitRate
          */
-        AudioSignalProcessor(size_t sample_rate, size_t mark_frequency, size_t space_frequency,
-                           size_t bit_rate, size_t window_size);
+        AudioSignalProcessor(size_t mark_frequency, size_t space_frequency, size_t bit_rate);
 
         /**
-         * Process input audio samples
-         * @param samples Input audio sample vector
-         * @return Vector of Mark probability values (0.0 to 1.0)
+         * Process input audio samples at kInputSampleRate
+         * @param samples Input samples
+         * @param count Number of input frames
+         * @param stride Distance between consecutive samples
+         * @param probabilities Output Mark probability values (0.0 to 1.0), one per bit
+         * @param max_probabilities Size of the output buffer
+         * @return Number of probabilities written
          */
-        std::vector<float> ProcessAudioSamples(const std::vector<float> &samples);
+        size_t ProcessAudioSamples(const int16_t *samples, size_t count, size_t stride,
+                                   float *probabilities, size_t max_probabilities);
     };
 
     /**
@@ -143,11 +192,12 @@ namespace audio_wifi_config
 
         /**
          * Process probability data and attempt to decode
-         * @param probabilities Vector of Mark probabilities
+         * @param probabilities Mark probabilities
+         * @param count Number of probabilities
          * @param threshold Decision threshold for bit detection
          * @return true if complete data was successfully received and decoded
          */
-        bool ProcessProbabilityData(const std::vector<float> &probabilities, float threshold = 0.5f);
+        bool ProcessProbabilityData(const float *probabilities, size_t count, float threshold = 0.5f);
 
         /**
          * Calculate checksum for ASCII text
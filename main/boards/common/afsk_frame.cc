@@ -0,0 +1,207 @@
+#include "afsk_frame.h"
+#include <cstring>
+#include <algorithm>
+#include "esp_log.h"
+
+namespace audio_wifi_config
+{
+    static const char *kLogTag = "AUDIO_WIFI_FRAME";
+
+    // Generator polynomials 171 and 133 (octal), the newest bit is bit 6 of the register
+    static const uint8_t kPolynomialA = 0x79;
+    static const uint8_t kPolynomialB = 0x5B;
+    static const size_t kStateCount = 1 << kFrameTailBits;
+    static const size_t kHeaderSoftBits = (kFrameHeaderSize * 8 + kFrameTailBits) * 2;
+    // Sync word errors tolerated, the preamble is still at least 6 bits away
+    static const int kSyncMaxErrors = 1;
+
+    uint8_t Crc8(const uint8_t *data, size_t length)
+    {
+        uint8_t crc = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            crc ^= data[i];
+            for (int j = 0; j < 8; ++j)
+            {
+                crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+            }
+        }
+        return crc;
+    }
+
+    uint16_t Crc16(const uint8_t *data, size_t length, uint16_t crc)
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            crc ^= static_cast<uint16_t>(data[i]) << 8;
+            for (int j = 0; j < 8; ++j)
+            {
+                crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+            }
+        }
+        return crc;
+    }
+
+    bool ParseCredentials(const std::string &payload, std::string &ssid, std::string &password)
+    {
+        if (payload.empty())
+        {
+            return false;
+        }
+        size_t ssid_length = static_cast<uint8_t>(payload[0]);
+        if (ssid_length == 0 || 1 + ssid_length > payload.size())
+        {
+            return false;
+        }
+        ssid = payload.substr(1, ssid_length);
+        password = payload.substr(1 + ssid_length);
+        return true;
+    }
+
+    FrameDecoder::FrameDecoder(const char *name)
+        : name_(name)
+    {
+        soft_bits_.reserve(kFrameMaxDecodedBits * 2);
+        decisions_.resize(kFrameMaxDecodedBits);
+        Reset();
+    }
+
+    void FrameDecoder::Reset()
+    {
+        current_state_ = FrameReceptionState::kSearching;
+        sync_register_ = 0;
+        soft_bits_.clear();
+        expected_soft_bits_ = 0;
+    }
+
+    void FrameDecoder::ViterbiDecode(const uint8_t *soft_bits, size_t soft_bit_count, uint8_t *output)
+    {
+        static_assert(kStateCount == 64, "Decisions are stored in one uint64_t per step");
+
+        // Coded output pair of each 7 bit register value
+        uint8_t outputs[kStateCount * 2];
+        for (size_t reg = 0; reg < kStateCount * 2; ++reg)
+        {
+            outputs[reg] = (__builtin_parity(reg & kPolynomialA) << 1) | __builtin_parity(reg & kPolynomialB);
+        }
+
+        // The encoder starts in state 0
+        uint32_t metrics[kStateCount];
+        uint32_t next_metrics[kStateCount];
+        std::fill(metrics, metrics + kStateCount, UINT32_MAX / 2);
+        metrics[0] = 0;
+
+        size_t steps = soft_bit_count / 2;
+        for (size_t step = 0; step < steps; ++step)
+        {
+            uint8_t soft_a = soft_bits[step * 2];
+            uint8_t soft_b = soft_bits[step * 2 + 1];
+            // Distance of the received pair from each of the four possible pairs
+            uint32_t branch[4] = {
+                static_cast<uint32_t>(soft_a) + soft_b,
+                static_cast<uint32_t>(soft_a) + (255 - soft_b),
+                static_cast<uint32_t>(255 - soft_a) + soft_b,
+                static_cast<uint32_t>(255 - soft_a) + (255 - soft_b),
+            };
+            uint64_t decisions = 0;
+            for (size_t state = 0; state < kStateCount; ++state)
+            {
+                // Both predecessors shifted the same input bit into bit 5 of this state
+                size_t input = state >> (kFrameTailBits - 1);
+                size_t previous = (state << 1) & (kStateCount - 1);
+                size_t reg = (input << kFrameTailBits) | previous;
+                uint32_t metric0 = metrics[previous] + branch[outputs[reg]];
+                uint32_t metric1 = metrics[previous | 1] + branch[outputs[reg | 1]];
+                if (metric1 < metric0)
+                {
+                    next_metrics[state] = metric1;
+                    decisions |= 1ULL << state;
+                }
+                else
+                {
+                    next_metrics[state] = metric0;
+                }
+            }
+            decisions_[step] = decisions;
+            memcpy(metrics, next_metrics, sizeof(metrics));
+        }
+
+        // The tail brings the encoder back to state 0
+        size_t data_bits = steps - kFrameTailBits;
+        memset(output, 0, data_bits / 8);
+        size_t state = 0;
+        for (size_t step = steps; step-- > 0;)
+        {
+            size_t input = state >> (kFrameTailBits - 1);
+            if (step < data_bits && input)
+            {
+                output[step / 8] |= 0x80 >> (step % 8);
+            }
+            state = ((state << 1) & (kStateCount - 1)) | ((decisions_[step] >> state) & 1);
+        }
+    }
+
+    bool FrameDecoder::ProcessProbabilityData(const float *probabilities, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            float probability = std::clamp(probabilities[i], 0.0f, 1.0f);
+
+            switch (current_state_)
+            {
+            case FrameReceptionState::kSearching:
+                sync_register_ = (sync_register_ << 1) | (probability > 0.5f ? 1 : 0);
+                if (__builtin_popcount(sync_register_ ^ kFrameSyncWord) <= kSyncMaxErrors)
+                {
+                    soft_bits_.clear();
+                    expected_soft_bits_ = kHeaderSoftBits;
+                    current_state_ = FrameReceptionState::kHeader;
+                }
+                break;
+
+            case FrameReceptionState::kHeader:
+            case FrameReceptionState::kPayload:
+            {
+                soft_bits_.push_back(static_cast<uint8_t>(probability * 255.0f + 0.5f));
+                if (soft_bits_.size() < expected_soft_bits_)
+                {
+                    break;
+                }
+
+                if (current_state_ == FrameReceptionState::kHeader)
+                {
+                    ViterbiDecode(soft_bits_.data(), soft_bits_.size(), header_);
+                    if (Crc8(header_, 2) != header_[2] || header_[0] != kFrameVersion ||
+                        header_[1] == 0 || header_[1] > kFrameMaxPayloadSize)
+                    {
+                        ESP_LOGW(kLogTag, "%s: invalid header", name_);
+                        Reset();
+                        break;
+                    }
+                    soft_bits_.clear();
+                    expected_soft_bits_ = ((header_[1] + 2) * 8 + kFrameTailBits) * 2;
+                    current_state_ = FrameReceptionState::kPayload;
+                    break;
+                }
+
+                // The CRC covers the header as well
+                uint8_t payload[kFrameMaxPayloadSize + 2];
+                size_t payload_size = header_[1];
+                ViterbiDecode(soft_bits_.data(), soft_bits_.size(), payload);
+                uint16_t crc = Crc16(payload, payload_size, Crc16(header_, kFrameHeaderSize));
+                uint16_t received_crc = (payload[payload_size] << 8) | payload[payload_size + 1];
+                Reset();
+                if (crc != received_crc)
+                {
+                    ESP_LOGW(kLogTag, "%s: CRC mismatch: expected %04x, got %04x", name_, received_crc, crc);
+                    break;
+                }
+                ESP_LOGI(kLogTag, "%s: received %u bytes", name_, payload_size);
+                decoded_payload = std::string(reinterpret_cast<char *>(payload), payload_size);
+                return true;
+            }
+            }
+        }
+        return false;
+    }
+}
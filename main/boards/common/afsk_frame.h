@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <optional>
+
+// Framed credential transfer, see scripts/acoustic_wifi_encode.py for the sender
+//
+// preamble (1010...) | sync word | FEC(header) | FEC(payload + CRC-16)
+// header  = version, payload length, CRC-8 of both
+// payload = SSID length, SSID, password
+//
+// Header and payload are each encoded with the K=7 rate 1/2 convolutional code (171, 133 octal)
+// and terminated with 6 zero bits, so a corrupted header is rejected before waiting for the payload
+const uint16_t kFrameSyncWord = 0x2DD4;
+const uint8_t kFrameVersion = 1;
+const size_t kFrameHeaderSize = 3;
+const size_t kFrameMaxPayloadSize = 1 + 32 + 64;
+const size_t kFrameConstraintLength = 7;
+const size_t kFrameTailBits = kFrameConstraintLength - 1;
+const size_t kFrameMaxDecodedBits = (kFrameMaxPayloadSize + 2) * 8 + kFrameTailBits;
+
+namespace audio_wifi_config
+{
+    /**
+     * CRC-8 (polynomial 0x07) used for the frame header
+     */
+    uint8_t Crc8(const uint8_t *data, size_t length);
+
+    /**
+     * CRC-16/CCITT-FALSE used for the header and payload
+     */
+    uint16_t Crc16(const uint8_t *data, size_t length, uint16_t crc = 0xFFFF);
+
+    /**
+     * Split a decoded payload into SSID and password
+     * @return false if the SSID length does not fit the payload
+     */
+    bool ParseCredentials(const std::string &payload, std::string &ssid, std::string &password);
+
+    /**
+     * Frame reception state machine states
+     */
+    enum class FrameReceptionState
+    {
+        kSearching,  // Looking for the sync word
+        kHeader,     // Collecting the coded header
+        kPayload     // Collecting the coded payload
+    };
+
+    /**
+     * Receiver for framed transfers
+     * Soft bits from the demodulator are decoded with a Viterbi decoder, frames whose CRC
+     * does not match are dropped without ever reaching ConnectToWifi
+     */
+    class FrameDecoder
+    {
+    private:
+        FrameReceptionState current_state_;      // Current reception state
+        uint16_t sync_register_;                 // Last 16 hard bits
+        std::vector<uint8_t> soft_bits_;         // Coded soft bits of the current block, 0 = space, 255 = mark
+        size_t expected_soft_bits_;              // Coded bits in the current block
+        uint8_t header_[kFrameHeaderSize];       // Decoded header
+        std::vector<uint64_t> decisions_;        // Viterbi survivor decisions, one bit per state
+        const char *name_;                       // Used in logs
+
+        /**
+         * Decode a terminated block of coded soft bits
+         * @param output Decoded bytes, (soft bits / 2 - tail) / 8 of them
+         */
+        void ViterbiDecode(const uint8_t *soft_bits, size_t soft_bit_count, uint8_t *output);
+
+        /**
+         * Go back to searching for the sync word
+         */
+        void Reset();
+
+    public:
+        std::optional<std::string> decoded_payload;  // Payload of the last frame that passed the CRC
+
+        /**
+         * Constructor
+         * @param name Name of the bit rate mode, used in logs
+         */
+        explicit FrameDecoder(const char *name);
+
+        /**
+         * Process probability data and attempt to decode
+         * @param probabilities Mark probabilities
+         * @param count Number of probabilities
+         * @return true if a frame was received and passed the CRC
+         */
+        bool ProcessProbabilityData(const float *probabilities, size_t count);
+    };
+}
@@ -0,0 +1,54 @@
+#include "camera_preview.h"
+
+bool CameraPreviewScaler::Prepare(int src_width, int src_height, int max_width) {
+    int width = src_width;
+    int height = src_height;
+    if (max_width > 0 && max_width < src_width) {
+        width = max_width;
+        height = src_height * max_width / src_width;
+    }
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    // 列映射取决于源尺寸，源分辨率变化时即使目标尺寸相同也要重建
+    if (width == width_ && height == height_ && src_width == src_width_ && src_height == src_height_) {
+        return true;
+    }
+    x_map_.resize(width);
+    for (int x = 0; x < width; x++) {
+        x_map_[x] = (uint16_t)(((2 * x + 1) * src_width) / (2 * width));
+    }
+    src_width_ = src_width;
+    src_height_ = src_height;
+    width_ = width;
+    height_ = height;
+    return true;
+}
+
+void CameraPreviewScaler::Convert(const uint16_t* src, uint16_t* dst) const {
+    if (width_ == src_width_ && height_ == src_height_) {
+        // 尺寸相同时每次处理两个像素，交换每个16位字内的字节
+        auto src32 = (const uint32_t*)src;
+        auto dst32 = (uint32_t*)dst;
+        size_t pixels = (size_t)width_ * height_;
+        for (size_t i = 0; i < pixels / 2; i++) {
+            uint32_t v = src32[i];
+            dst32[i] = ((v & 0xFF00FF00u) >> 8) | ((v & 0x00FF00FFu) << 8);
+        }
+        if (pixels & 1) {
+            dst[pixels - 1] = __builtin_bswap16(src[pixels - 1]);
+        }
+        return;
+    }
+
+    // 字节交换和缩放在同一遍中完成，避免 LVGL 再做软件缩放
+    const uint16_t* x_map = x_map_.data();
+    for (int y = 0; y < height_; y++) {
+        const uint16_t* src_row = src + (size_t)(((2 * y + 1) * src_height_) / (2 * height_)) * src_width_;
+        uint16_t* dst_row = dst + (size_t)y * width_;
+        for (int x = 0; x < width_; x++) {
+            dst_row[x] = __builtin_bswap16(src_row[x_map[x]]);
+        }
+    }
+}
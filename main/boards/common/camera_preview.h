@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/*
+ * 摄像头 RGB565 帧的预览缩放，字节交换和最近邻缩放在同一遍中完成。
+ * 目标尺寸只缩小不放大并保持宽高比，列映射在源或目标尺寸变化时重建。
+ */
+class CameraPreviewScaler {
+public:
+    // Returns false when the target would be empty
+    bool Prepare(int src_width, int src_height, int max_width);
+    // src is the big endian frame from the camera, dst holds width() * height() native pixels
+    void Convert(const uint16_t* src, uint16_t* dst) const;
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+
+private:
+    int src_width_ = 0;
+    int src_height_ = 0;
+    int width_ = 0;
+    int height_ = 0;
+    std::vector<uint16_t> x_map_;   // Source column of each target column
+};
@@ -6,12 +6,21 @@
 
 #include <esp_log.h>
 #include <esp_heap_caps.h>
+#include <esp_timer.h>
 #include <img_converters.h>
 #include <cstring>
+#include <algorithm>
+#include <functional>
 
 #define TAG "Esp32Camera"
 
 Esp32Camera::Esp32Camera(const camera_config_t& config) {
+    // 预览图片的内存在第一次拍照时按显示尺寸分配，之后重复使用
+    memset(&preview_image_, 0, sizeof(preview_image_));
+    preview_image_.header.magic = LV_IMAGE_HEADER_MAGIC;
+    preview_image_.header.cf = LV_COLOR_FORMAT_RGB565;
+    preview_image_.header.flags = LV_IMAGE_FLAGS_ALLOCATED | LV_IMAGE_FLAGS_MODIFIABLE;
+
     // camera init
     esp_err_t err = esp_camera_init(&config); // 配置上面定义的参数
     if (err != ESP_OK) {
@@ -23,51 +32,25 @@ Esp32Camera::Esp32Camera(const camera_config_t& config) {
     if (s->id.PID == GC0308_PID) {
         s->set_hmirror(s, 0);  // 这里控制摄像头镜像 写1镜像 写0不镜像
     }
-
-    // 初始化预览图片的内存
-    memset(&preview_image_, 0, sizeof(preview_image_));
-    preview_image_.header.magic = LV_IMAGE_HEADER_MAGIC;
-    preview_image_.header.cf = LV_COLOR_FORMAT_RGB565;
-    preview_image_.header.flags = LV_IMAGE_FLAGS_ALLOCATED | LV_IMAGE_FLAGS_MODIFIABLE;
-
-    switch (config.frame_size) {
-        case FRAMESIZE_SVGA:
-            preview_image_.header.w = 800;
-            preview_image_.header.h = 600;
-            break;
-        case FRAMESIZE_VGA:
-            preview_image_.header.w = 640;
-            preview_image_.header.h = 480;
-            break;
-        case FRAMESIZE_QVGA:
-            preview_image_.header.w = 320;
-            preview_image_.header.h = 240;
-            break;
-        case FRAMESIZE_128X128:
-            preview_image_.header.w = 128;
-            preview_image_.header.h = 128;
-            break;
-        case FRAMESIZE_240X240:
-            preview_image_.header.w = 240;
-            preview_image_.header.h = 240;
-            break;
-        default:
-            ESP_LOGE(TAG, "Unsupported frame size: %d, image preview will not be shown", config.frame_size);
-            preview_image_.data_size = 0;
-            preview_image_.data = nullptr;
-            return;
-    }
-
-    preview_image_.header.stride = preview_image_.header.w * 2;
-    preview_image_.data_size = preview_image_.header.w * preview_image_.header.h * 2;
-    preview_image_.data = (uint8_t*)heap_caps_malloc(preview_image_.data_size, MALLOC_CAP_SPIRAM);
-    if (preview_image_.data == nullptr) {
-        ESP_LOGE(TAG, "Failed to allocate memory for preview image");
-        return;
-    }
 }
 
 Esp32Camera::~Esp32Camera() {
+    if (encoder_task_ != nullptr) {
+        vTaskDelete(encoder_task_);
+        encoder_task_ = nullptr;
+    }
+    if (jpeg_queue_ != nullptr) {
+        vQueueDelete(jpeg_queue_);
+    }
+    if (free_chunks_ != nullptr) {
+        vQueueDelete(free_chunks_);
+    }
+    if (chunk_arena_ != nullptr) {
+        heap_caps_free(chunk_arena_);
+    }
+    if (scaled_frame_ != nullptr) {
+        heap_caps_free(scaled_frame_);
+    }
     if (fb_) {
         esp_camera_fb_return(fb_);
         fb_ = nullptr;
@@ -84,11 +67,40 @@ void Esp32Camera::SetExplainUrl(const std::string& url, const std::string& token
     explain_token_ = token;
 }
 
-bool Esp32Camera::Capture() {
-    if (encoder_thread_.joinable()) {
-        encoder_thread_.join();
+bool Esp32Camera::PreparePreviewBuffer(int src_width, int src_height, int max_width) {
+    if (!preview_scaler_.Prepare(src_width, src_height, max_width)) {
+        return false;
+    }
+    int width = preview_scaler_.width();
+    int height = preview_scaler_.height();
+    if (preview_image_.data != nullptr && preview_image_.header.w == width && preview_image_.header.h == height) {
+        return true;
+    }
+
+    size_t data_size = width * height * 2;
+    if (preview_image_.data == nullptr || preview_image_.data_size != data_size) {
+        if (preview_image_.data != nullptr) {
+            heap_caps_free((void*)preview_image_.data);
+            preview_image_.data = nullptr;
+            preview_image_.data_size = 0;
+        }
+        preview_image_.data = (uint8_t*)heap_caps_malloc(data_size, MALLOC_CAP_SPIRAM);
+        if (preview_image_.data == nullptr) {
+            ESP_LOGE(TAG, "Failed to allocate memory for preview image");
+            return false;
+        }
     }
+    preview_image_.header.w = width;
+    preview_image_.header.h = height;
+    preview_image_.header.stride = width * 2;
+    preview_image_.data_size = data_size;
+    ESP_LOGI(TAG, "Preview buffer %dx%d allocated for %dx%d frames", width, height, src_width, src_height);
+    return true;
+}
 
+bool Esp32Camera::Capture() {
+    // 等待正在进行的编码用完 fb_ 之后再归还它
+    std::lock_guard<std::mutex> lock(mutex_);
     int frames_to_get = 2;
     // Try to get a stable frame
     for (int i = 0; i < frames_to_get; i++) {
@@ -101,31 +113,36 @@ bool Esp32Camera::Capture() {
             return false;
         }
     }
+    int64_t frame_time = esp_timer_get_time();
 
-    // 如果预览图片 buffer 为空，则跳过预览
+    // 如果不是 RGB565 格式，则跳过预览
     // 但仍返回 true，因为此时图像可以上传至服务器
-    if (preview_image_.data_size == 0) {
-        ESP_LOGW(TAG, "Skip preview because of unsupported frame size");
-        return true;
-    }
-    if (preview_image_.data == nullptr) {
-        ESP_LOGE(TAG, "Preview image data is not initialized");
+    if (fb_->format != PIXFORMAT_RGB565 || fb_->len < fb_->width * fb_->height * 2) {
+        ESP_LOGW(TAG, "Skip preview because of unsupported pixel format");
         return true;
     }
-    // 显示预览图片
+    // 显示预览图片，宽度与 LcdDisplay 的预览区域一致
     auto display = Board::GetInstance().GetDisplay();
-    if (display != nullptr) {
-        auto src = (uint16_t*)fb_->buf;
-        auto dst = (uint16_t*)preview_image_.data;
-        size_t pixel_count = fb_->len / 2;
-        for (size_t i = 0; i < pixel_count; i++) {
-            // 交换每个16位字内的字节
-            dst[i] = __builtin_bswap16(src[i]);
+    if (display != nullptr && display->width() > 0) {
+#if CONFIG_USE_WECHAT_MESSAGE_STYLE
+        // 聊天气泡最多占屏幕宽度的 70%、高度的 50%
+        int max_width = std::min(display->width() * 70 / 100,
+            display->height() * 50 / 100 * fb_->width / fb_->height);
+#else
+        // 表情区域的预览缩放到屏幕宽度的一半
+        int max_width = display->width() / 2;
+#endif
+        if (!PreparePreviewBuffer(fb_->width, fb_->height, max_width)) {
+            return true;
         }
+        preview_scaler_.Convert((const uint16_t*)fb_->buf, (uint16_t*)preview_image_.data);
         display->SetPreviewImage(&preview_image_);
+        ESP_LOGI(TAG, "Preview %dx%d -> %dx%d, frame to screen latency %lld us", fb_->width, fb_->height,
+            preview_image_.header.w, preview_image_.header.h, esp_timer_get_time() - frame_time);
     }
     return true;
 }
+
 bool Esp32Camera::SetHMirror(bool enabled) {
     sensor_t *s = esp_camera_sensor_get();
     if (s == nullptr) {
@@ -160,6 +177,129 @@ bool Esp32Camera::SetVFlip(bool enabled) {
     return true;
 }
 
+bool Esp32Camera::InitializeEncoder() {
+    if (encoder_task_ != nullptr) {
+        return true;
+    }
+
+    if (chunk_arena_ == nullptr) {
+        chunk_arena_ = (uint8_t*)heap_caps_aligned_alloc(16, JPEG_CHUNK_SIZE * JPEG_CHUNK_COUNT, MALLOC_CAP_SPIRAM);
+        if (chunk_arena_ == nullptr) {
+            ESP_LOGE(TAG, "Failed to allocate JPEG chunk arena");
+            return false;
+        }
+    }
+    if (free_chunks_ == nullptr) {
+        free_chunks_ = xQueueCreate(JPEG_CHUNK_COUNT, sizeof(uint8_t*));
+        if (free_chunks_ == nullptr) {
+            ESP_LOGE(TAG, "Failed to create JPEG chunk queue");
+            return false;
+        }
+        for (int i = 0; i < JPEG_CHUNK_COUNT; i++) {
+            uint8_t* slot = chunk_arena_ + i * JPEG_CHUNK_SIZE;
+            xQueueSend(free_chunks_, &slot, 0);
+        }
+    }
+    if (jpeg_queue_ == nullptr) {
+        // 多留一个位置给结束标记
+        jpeg_queue_ = xQueueCreate(JPEG_CHUNK_COUNT + 1, sizeof(JpegChunk));
+        if (jpeg_queue_ == nullptr) {
+            ESP_LOGE(TAG, "Failed to create JPEG queue");
+            return false;
+        }
+    }
+
+    xTaskCreate([](void* arg) {
+        Esp32Camera* camera = (Esp32Camera*)arg;
+        camera->EncoderTask();
+        vTaskDelete(NULL);
+    }, "jpeg_encoder", 4096, this, 1, &encoder_task_);
+    return encoder_task_ != nullptr;
+}
+
+// fmt2jpg_cb 在回调返回后会复用自己的输出缓冲区，所以这里必须拷贝一次压缩后的数据；
+// 之后 arena 中的块直接交给 HTTP 写出，不再拷贝
+size_t Esp32Camera::OnJpegData(const uint8_t* data, size_t len) {
+    size_t offset = 0;
+    while (offset < len) {
+        if (pending_chunk_.data == nullptr) {
+            // 没有空闲槽位时阻塞，直到上传线程归还
+            xQueueReceive(free_chunks_, &pending_chunk_.data, portMAX_DELAY);
+            pending_chunk_.len = 0;
+        }
+        size_t n = std::min(JPEG_CHUNK_SIZE - pending_chunk_.len, len - offset);
+        memcpy(pending_chunk_.data + pending_chunk_.len, data + offset, n);
+        pending_chunk_.len += n;
+        offset += n;
+        if (pending_chunk_.len == JPEG_CHUNK_SIZE) {
+            FlushPendingChunk();
+        }
+    }
+    return len;
+}
+
+void Esp32Camera::FlushPendingChunk() {
+    if (pending_chunk_.data != nullptr && pending_chunk_.len > 0) {
+        xQueueSend(jpeg_queue_, &pending_chunk_, portMAX_DELAY);
+    } else if (pending_chunk_.data != nullptr) {
+        xQueueSend(free_chunks_, &pending_chunk_.data, portMAX_DELAY);
+    }
+    pending_chunk_ = {};
+}
+
+void Esp32Camera::EncoderTask() {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        auto src = fb_->buf;
+        size_t width = fb_->width;
+        size_t height = fb_->height;
+        size_t len = fb_->len;
+        pixformat_t format = fb_->format;
+        if (format == PIXFORMAT_JPEG) {
+            // 摄像头已经输出 JPEG，直接分块上传
+            OnJpegData(src, len);
+            FlushPendingChunk();
+            JpegChunk end = {nullptr, 0};
+            xQueueSend(jpeg_queue_, &end, portMAX_DELAY);
+            continue;
+        }
+        int downscale = encode_params_.downscale;
+        if (downscale > 1 && format == PIXFORMAT_RGB565) {
+            // 隔行隔列取样缩小，RGB565 字节序保持不变
+            size_t scaled_width = width / downscale;
+            size_t scaled_height = height / downscale;
+            size_t scaled_size = scaled_width * scaled_height * 2;
+            if (scaled_frame_size_ < scaled_size) {
+                heap_caps_free(scaled_frame_);
+                scaled_frame_ = (uint8_t*)heap_caps_malloc(scaled_size, MALLOC_CAP_SPIRAM);
+                scaled_frame_size_ = scaled_frame_ != nullptr ? scaled_size : 0;
+            }
+            if (scaled_frame_ != nullptr) {
+                DownscaleRgb565((const uint16_t*)fb_->buf, width, height, downscale, (uint16_t*)scaled_frame_);
+                src = scaled_frame_;
+                width = scaled_width;
+                height = scaled_height;
+                len = scaled_size;
+            }
+        }
+
+        bool encoded = fmt2jpg_cb(src, len, width, height, format, encode_params_.quality,
+            [](void* arg, size_t index, const void* data, size_t len) -> unsigned int {
+                auto camera = (Esp32Camera*)arg;
+                return camera->OnJpegData((const uint8_t*)data, len);
+            }, this);
+        if (!encoded) {
+            ESP_LOGE(TAG, "Failed to encode %ux%u frame of format %d", width, height, format);
+        }
+        FlushPendingChunk();
+
+        // 结束标记
+        JpegChunk end = {nullptr, 0};
+        xQueueSend(jpeg_queue_, &end, portMAX_DELAY);
+    }
+}
+
 /**
  * @brief 将摄像头捕获的图像发送到远程服务器进行AI分析和解释
  * 
@@ -168,9 +308,10 @@ bool Esp32Camera::SetVFlip(bool enabled) {
  * 问题对图像进行AI分析并返回结果。
  * 
  * 实现特点：
- * - 使用独立线程编码JPEG，与主线程分离
+ * - 使用常驻的编码任务编码JPEG，与建立连接和上传并行进行
+ * - 根据上传预算选择JPEG质量和缩小倍数
+ * - 编码输出拷贝一次到固定的PSRAM chunk arena，块直接交给HTTP写出，上传后槽位循环使用，无需逐块分配内存
  * - 采用分块传输编码(chunked transfer encoding)优化内存使用
- * - 通过队列机制实现编码线程和发送线程的数据同步
  * - 支持设备ID、客户端ID和认证令牌的HTTP头部配置
  * 
  * @param question 要向AI提出的关于图像的问题，将作为表单字段发送
@@ -180,34 +321,39 @@ bool Esp32Camera::SetVFlip(bool enabled) {
  *                  {"success": false, "message": "错误信息"}
  * 
  * @note 调用此函数前必须先调用SetExplainUrl()设置服务器URL
- * @note 函数会等待之前的编码线程完成后再开始新的处理
+ * @note 函数返回前总会等待本次编码完成
  * @warning 如果摄像头缓冲区为空或网络连接失败，将返回错误信息
  */
 std::string Esp32Camera::Explain(const std::string& question) {
+    // 编码任务读取 fb_ 并独占 jpeg_queue_，同一时间只能有一次上传
+    std::lock_guard<std::mutex> lock(mutex_);
     if (explain_url_.empty()) {
         return "{\"success\": false, \"message\": \"Image explain URL or token is not set\"}";
     }
+    if (fb_ == nullptr) {
+        return "{\"success\": false, \"message\": \"No photo captured\"}";
+    }
+    if (!InitializeEncoder()) {
+        return "{\"success\": false, \"message\": \"Failed to start JPEG encoder\"}";
+    }
 
-    // 创建局部的 JPEG 队列, 40 entries is about to store 512 * 40 = 20480 bytes of JPEG data
-    QueueHandle_t jpeg_queue = xQueueCreate(40, sizeof(JpegChunk));
-    if (jpeg_queue == nullptr) {
-        ESP_LOGE(TAG, "Failed to create JPEG queue");
-        return "{\"success\": false, \"message\": \"Failed to create JPEG queue\"}";
-    }
-
-    // We spawn a thread to encode the image to JPEG
-    encoder_thread_ = std::thread([this, jpeg_queue]() {
-        frame2jpg_cb(fb_, 80, [](void* arg, size_t index, const void* data, size_t len) -> unsigned int {
-            auto jpeg_queue = (QueueHandle_t)arg;
-            JpegChunk chunk = {
-                .data = (uint8_t*)heap_caps_aligned_alloc(16, len, MALLOC_CAP_SPIRAM),
-                .len = len
-            };
-            memcpy(chunk.data, data, len);
-            xQueueSend(jpeg_queue, &chunk, portMAX_DELAY);
-            return len;
-        }, jpeg_queue);
-    });
+    // 先启动编码，与建立连接并行进行；arena 写满后编码任务会等待上传
+    encode_params_ = jpeg_budget_.Choose(fb_->width, fb_->height, fb_->format == PIXFORMAT_RGB565,
+        EXPLAIN_UPLOAD_BUDGET);
+    int64_t start_time = esp_timer_get_time();
+    xTaskNotifyGive(encoder_task_);
+
+    // 上传线程把块直接写入 HTTP，然后把槽位归还给编码任务
+    auto drain_chunks = [this](std::function<void(const JpegChunk&)> on_chunk) {
+        JpegChunk chunk;
+        while (xQueueReceive(jpeg_queue_, &chunk, portMAX_DELAY) == pdPASS) {
+            if (chunk.data == nullptr) {
+                break; // The last chunk
+            }
+            on_chunk(chunk);
+            xQueueSend(free_chunks_, &chunk.data, portMAX_DELAY);
+        }
+    };
 
     auto network = Board::GetInstance().GetNetwork();
     auto http = network->CreateHttp(3);
@@ -224,17 +370,8 @@ std::string Esp32Camera::Explain(const std::string& question) {
     http->SetHeader("Transfer-Encoding", "chunked");
     if (!http->Open("POST", explain_url_)) {
         ESP_LOGE(TAG, "Failed to connect to explain URL");
-        // Clear the queue
-        encoder_thread_.join();
-        JpegChunk chunk;
-        while (xQueueReceive(jpeg_queue, &chunk, portMAX_DELAY) == pdPASS) {
-            if (chunk.data != nullptr) {
-                heap_caps_free(chunk.data);
-            } else {
-                break;
-            }
-        }
-        vQueueDelete(jpeg_queue);
+        // Wait for the encoder to finish and recycle the chunks
+        drain_chunks([](const JpegChunk&) {});
         return "{\"success\": false, \"message\": \"Failed to connect to explain URL\"}";
     }
     
@@ -259,23 +396,14 @@ std::string Esp32Camera::Explain(const std::string& question) {
 
     // 第三块：JPEG数据
     size_t total_sent = 0;
-    while (true) {
-        JpegChunk chunk;
-        if (xQueueReceive(jpeg_queue, &chunk, portMAX_DELAY) != pdPASS) {
-            ESP_LOGE(TAG, "Failed to receive JPEG chunk");
-            break;
-        }
-        if (chunk.data == nullptr) {
-            break; // The last chunk
-        }
+    drain_chunks([&http, &total_sent](const JpegChunk& chunk) {
         http->Write((const char*)chunk.data, chunk.len);
         total_sent += chunk.len;
-        heap_caps_free(chunk.data);
-    }
-    // Wait for the encoder thread to finish
-    encoder_thread_.join();
-    // 清理队列
-    vQueueDelete(jpeg_queue);
+    });
+    int64_t encode_time = esp_timer_get_time() - start_time;
+
+    // 根据实际压缩结果修正体积估计，供下次选择质量使用
+    jpeg_budget_.Update(encode_params_, fb_->width, fb_->height, total_sent);
 
     {
         // 第四块：multipart尾部
@@ -296,7 +424,8 @@ std::string Esp32Camera::Explain(const std::string& question) {
 
     // Get remain task stack size
     size_t remain_stack_size = uxTaskGetStackHighWaterMark(nullptr);
-    ESP_LOGI(TAG, "Explain image size=%dx%d, compressed size=%d, remain stack size=%d, question=%s\n%s",
-        fb_->width, fb_->height, total_sent, remain_stack_size, question.c_str(), result.c_str());
+    ESP_LOGI(TAG, "Explain image size=%dx%d, quality=%d, downscale=%d, compressed size=%d, encode+upload=%lldms, remain stack size=%d, question=%s\n%s",
+        fb_->width, fb_->height, encode_params_.quality, encode_params_.downscale, total_sent, encode_time / 1000,
+        remain_stack_size, question.c_str(), result.c_str());
     return result;
 }
@@ -3,26 +3,53 @@
 
 #include <esp_camera.h>
 #include <lvgl.h>
-#include <thread>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <freertos/task.h>
 
 #include "camera.h"
+#include "camera_preview.h"
+#include "jpeg_budget.h"
+
+#define JPEG_CHUNK_SIZE 4096
+#define JPEG_CHUNK_COUNT 8
+#define EXPLAIN_UPLOAD_BUDGET (48 * 1024)
 
 struct JpegChunk {
-    uint8_t* data;
+    uint8_t* data;  // 指向 chunk arena 中的槽位，nullptr 表示编码结束
     size_t len;
 };
 
 class Esp32Camera : public Camera {
 private:
+    // Explain() 持有到编码任务用完 fb_ 为止，Capture() 因此会等待正在进行的编码
+    std::mutex mutex_;
     camera_fb_t* fb_ = nullptr;
     lv_img_dsc_t preview_image_;
     std::string explain_url_;
     std::string explain_token_;
-    std::thread encoder_thread_;
+    CameraPreviewScaler preview_scaler_;
+
+    // 常驻的 JPEG 编码任务，块数据在固定的 PSRAM arena 中循环使用
+    TaskHandle_t encoder_task_ = nullptr;
+    QueueHandle_t free_chunks_ = nullptr;
+    QueueHandle_t jpeg_queue_ = nullptr;
+    uint8_t* chunk_arena_ = nullptr;
+    uint8_t* scaled_frame_ = nullptr;
+    size_t scaled_frame_size_ = 0;
+    JpegChunk pending_chunk_ = {};
+    JpegEncodeParams encode_params_;
+    JpegBudget jpeg_budget_;
+
+    bool PreparePreviewBuffer(int src_width, int src_height, int max_width);
+    bool InitializeEncoder();
+    void EncoderTask();
+    size_t OnJpegData(const uint8_t* data, size_t len);
+    void FlushPendingChunk();
 
 public:
     Esp32Camera(const camera_config_t& config);
@@ -0,0 +1,48 @@
+#include "jpeg_budget.h"
+
+// 相对质量 80 的体积比例
+static float SizeRatio(int quality) {
+    return quality >= 80 ? 1.0f : (quality >= 60 ? 0.7f : 0.5f);
+}
+
+JpegEncodeParams JpegBudget::Choose(size_t width, size_t height, bool can_downscale, size_t budget) const {
+    static const JpegEncodeParams candidates[] = {
+        {80, 1},
+        {60, 1},
+        {80, 2},
+        {60, 2},
+        {40, 2},
+    };
+
+    JpegEncodeParams params;
+    for (const auto& candidate : candidates) {
+        if (candidate.downscale > 1 && !can_downscale) {
+            break;
+        }
+        params = candidate;
+        size_t pixels = (width / candidate.downscale) * (height / candidate.downscale);
+        if (pixels * bytes_per_pixel_ * SizeRatio(candidate.quality) <= budget) {
+            break;
+        }
+    }
+    return params;
+}
+
+void JpegBudget::Update(const JpegEncodeParams& params, size_t width, size_t height, size_t encoded_size) {
+    size_t pixels = (width / params.downscale) * (height / params.downscale);
+    if (pixels > 0 && encoded_size > 0) {
+        float measured = encoded_size / (pixels * SizeRatio(params.quality));
+        bytes_per_pixel_ = (bytes_per_pixel_ + measured) / 2;
+    }
+}
+
+void DownscaleRgb565(const uint16_t* in, size_t width, size_t height, int factor, uint16_t* out) {
+    size_t scaled_width = width / factor;
+    size_t scaled_height = height / factor;
+    for (size_t y = 0; y < scaled_height; y++) {
+        const uint16_t* row = in + y * factor * width;
+        for (size_t x = 0; x < scaled_width; x++) {
+            *out++ = row[x * factor];
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+struct JpegEncodeParams {
+    int quality = 80;
+    int downscale = 1;
+};
+
+/*
+ * 根据上传预算选择 JPEG 质量和缩小倍数。
+ * 体积按质量 80 时每像素的字节数估计，每次编码后用实际大小修正。
+ */
+class JpegBudget {
+public:
+    // Only RGB565 frames can be downscaled before encoding
+    JpegEncodeParams Choose(size_t width, size_t height, bool can_downscale, size_t budget) const;
+    void Update(const JpegEncodeParams& params, size_t width, size_t height, size_t encoded_size);
+
+    float bytes_per_pixel() const { return bytes_per_pixel_; }
+
+private:
+    float bytes_per_pixel_ = 0.25f;
+};
+
+// Keep every factor-th pixel of every factor-th row, the byte order is unchanged
+void DownscaleRgb565(const uint16_t* in, size_t width, size_t height, int factor, uint16_t* out);
@@ -0,0 +1,248 @@
+#include "servo_motion.h"
+
+#include <esp_log.h>
+
+#include <algorithm>
+#include <cmath>
+
+#define TAG "ServoMotion"
+
+ServoMotion::ServoMotion(int servos) : servos_(std::min(servos, SERVO_MAX_SERVOS)) {
+    for (int i = 0; i < SERVO_MAX_SERVOS; i++) {
+        output_[i] = 90 * 256;
+        planned_[i] = output_[i];
+    }
+
+    esp_timer_create_args_t timer_args = {
+        .callback = [](void* arg) {
+            auto self = static_cast<ServoMotion*>(arg);
+            self->OnTimer();
+        },
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "servo_motion",
+        .skip_unhandled_events = true,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &timer_));
+}
+
+ServoMotion::~ServoMotion() {
+    Cancel();
+    esp_timer_delete(timer_);
+    for (int i = 0; i < servos_; i++) {
+        Detach(i);
+    }
+}
+
+void ServoMotion::Attach(int index, int pin) {
+    if (index < 0 || index >= servos_ || pin < 0) {
+        return;
+    }
+
+    static bool timer_configured = false;
+    if (!timer_configured) {
+        ledc_timer_config_t ledc_timer = {
+            .speed_mode = LEDC_LOW_SPEED_MODE,
+            .duty_resolution = LEDC_TIMER_13_BIT,
+            .timer_num = LEDC_TIMER_1,
+            .freq_hz = 1000000 / SERVO_PWM_PERIOD_US,
+            .clk_cfg = LEDC_AUTO_CLK,
+        };
+        ESP_ERROR_CHECK(ledc_timer_config(&ledc_timer));
+        timer_configured = true;
+    }
+
+    // Each servo keeps its own channel, attaching again only reconfigures it
+    ledc_channel_config_t ledc_channel = {
+        .gpio_num = pin,
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .channel = (ledc_channel_t)(LEDC_CHANNEL_1 + index),
+        .intr_type = LEDC_INTR_DISABLE,
+        .timer_sel = LEDC_TIMER_1,
+        .duty = 0,
+        .hpoint = 0,
+    };
+    ESP_ERROR_CHECK(ledc_channel_config(&ledc_channel));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    attached_[index] = true;
+    duty_[index] = 0;
+}
+
+void ServoMotion::Detach(int index) {
+    if (index < 0 || index >= servos_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!attached_[index]) {
+        return;
+    }
+    ESP_ERROR_CHECK(ledc_stop(LEDC_LOW_SPEED_MODE, (ledc_channel_t)(LEDC_CHANNEL_1 + index), 0));
+    attached_[index] = false;
+}
+
+void ServoMotion::SetSpeedLimit(int index, int degrees_per_second) {
+    if (index < 0 || index >= servos_) {
+        return;
+    }
+    // At least one step per tick so that slow limits still arrive
+    speed_limit_[index] = degrees_per_second > 0 ?
+        std::max(1, degrees_per_second * 256 * SERVO_MOTION_TICK_MS / 1000) : 0;
+}
+
+bool ServoMotion::Move(const int* targets, int time_ms, uint8_t mask) {
+    ServoSegment segment;
+    segment.type = kServoSegmentMove;
+    segment.ticks = std::max(1, (time_ms + SERVO_MOTION_TICK_MS / 2) / SERVO_MOTION_TICK_MS);
+    for (int i = 0; i < servos_; i++) {
+        if (mask & (1 << i)) {
+            segment.mask |= 1 << i;
+            segment.position[i] = std::clamp(targets[i], 0, 180);
+        }
+    }
+    return Append(segment);
+}
+
+bool ServoMotion::Oscillate(const int* amplitude, const int* center, const double* phase,
+                            int period_ms, float cycles) {
+    int time_ms = std::lround(period_ms * cycles);
+    if (time_ms < SERVO_MOTION_TICK_MS || period_ms <= 0) {
+        return true;
+    }
+
+    ServoSegment segment;
+    segment.type = kServoSegmentOscillate;
+    segment.ticks = time_ms / SERVO_MOTION_TICK_MS;
+    segment.phase_step = (uint64_t(1) << 32) * SERVO_MOTION_TICK_MS / period_ms;
+    for (int i = 0; i < servos_; i++) {
+        segment.mask |= 1 << i;
+        segment.position[i] = center[i];
+        segment.amplitude[i] = amplitude[i];
+        double cycle = phase[i] / (2 * M_PI);
+        segment.phase[i] = (uint16_t)std::lround((cycle - std::floor(cycle)) * 65536);
+    }
+    return Append(segment);
+}
+
+bool ServoMotion::Hold(int time_ms) {
+    ServoSegment segment;
+    segment.type = kServoSegmentHold;
+    segment.ticks = std::max(1, (time_ms + SERVO_MOTION_TICK_MS / 2) / SERVO_MOTION_TICK_MS);
+    return Append(segment);
+}
+
+bool ServoMotion::Append(const ServoSegment& segment) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this]() {
+        return cancelled_ || queue_.size() < SERVO_MOTION_QUEUE_SIZE;
+    });
+    if (cancelled_) {
+        return false;
+    }
+
+    queue_.push_back(segment);
+    if (queue_.back().ticks == 0) {
+        queue_.back().ticks = 1;
+    }
+    ServoSegmentPositions(queue_.back(), planned_, servos_, queue_.back().ticks, planned_);
+
+    if (!running_) {
+        running_ = true;
+        ESP_ERROR_CHECK(esp_timer_start_periodic(timer_, SERVO_MOTION_TICK_MS * 1000));
+    }
+    return true;
+}
+
+void ServoMotion::Cancel() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    if (active_ || !queue_.empty()) {
+        ESP_LOGI(TAG, "Motion cancelled, %u segments dropped", queue_.size());
+    }
+    queue_.clear();
+    active_ = false;
+    std::copy(output_, output_ + servos_, planned_);
+    if (running_) {
+        esp_timer_stop(timer_);
+        running_ = false;
+    }
+    condition_.notify_all();
+}
+
+void ServoMotion::Resume() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = false;
+}
+
+void ServoMotion::WaitUntilIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this]() {
+        return !active_ && queue_.empty();
+    });
+}
+
+bool ServoMotion::IsBusy() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return active_ || !queue_.empty();
+}
+
+int ServoMotion::GetPosition(int index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (planned_[index] + 128) >> 8;
+}
+
+void ServoMotion::OnTimer() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!active_) {
+        if (queue_.empty()) {
+            // Cancelled while this tick was waiting for the lock
+            return;
+        }
+        segment_ = queue_.front();
+        queue_.pop_front();
+        std::copy(output_, output_ + servos_, start_);
+        tick_ = 0;
+        active_ = true;
+        condition_.notify_all();
+    }
+
+    tick_++;
+    int32_t positions[SERVO_MAX_SERVOS];
+    ServoSegmentPositions(segment_, start_, servos_, tick_, positions);
+    WriteOutputs(positions);
+
+    if (tick_ >= segment_.ticks) {
+        active_ = false;
+        if (queue_.empty()) {
+            esp_timer_stop(timer_);
+            running_ = false;
+            condition_.notify_all();
+        }
+    }
+}
+
+void ServoMotion::WriteOutputs(const int32_t* positions) {
+    for (int i = 0; i < servos_; i++) {
+        int32_t position = positions[i];
+        if (speed_limit_[i] > 0) {
+            position = std::clamp(position, output_[i] - speed_limit_[i], output_[i] + speed_limit_[i]);
+        }
+        output_[i] = position;
+        if (!attached_[i]) {
+            continue;
+        }
+
+        int32_t angle = std::clamp(position + trim_[i] * 256, 0, 180 * 256);
+        int64_t pulse = SERVO_MIN_PULSEWIDTH_US * 256 +
+            (int64_t)angle * (SERVO_MAX_PULSEWIDTH_US - SERVO_MIN_PULSEWIDTH_US) / 180;
+        uint32_t duty = (pulse * ((1 << LEDC_TIMER_13_BIT) - 1) + SERVO_PWM_PERIOD_US * 128) /
+            (SERVO_PWM_PERIOD_US * 256);
+        if (duty == duty_[i]) {
+            continue;
+        }
+        duty_[i] = duty;
+        auto channel = (ledc_channel_t)(LEDC_CHANNEL_1 + i);
+        ESP_ERROR_CHECK(ledc_set_duty(LEDC_LOW_SPEED_MODE, channel, duty));
+        ESP_ERROR_CHECK(ledc_update_duty(LEDC_LOW_SPEED_MODE, channel));
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+#include <driver/ledc.h>
+#include <esp_timer.h>
+
+#include "servo_trajectory.h"
+
+#define SERVO_MIN_PULSEWIDTH_US 500     // 0 度
+#define SERVO_MAX_PULSEWIDTH_US 2500    // 180 度
+#define SERVO_PWM_PERIOD_US 20000       // 50 Hz
+#define SERVO_MOTION_QUEUE_SIZE 16      // Planning blocks when this many segments are waiting
+
+/*
+ * 舵机运动引擎，所有舵机由同一个 esp_timer 按节拍驱动。
+ * 动作在任意任务中规划入队后立即返回（队列满时等待），可以随时取消。
+ * 每个节拍只写入占空比变化了的通道。
+ */
+class ServoMotion {
+public:
+    ServoMotion(int servos);
+    ~ServoMotion();
+
+    void Attach(int index, int pin);
+    void Detach(int index);
+    void SetTrim(int index, int trim) { trim_[index] = trim; }
+    // Maximum speed in degrees per second, 0 to disable
+    void SetSpeedLimit(int index, int degrees_per_second);
+
+    // Planning calls return false after Cancel() until Resume()
+    bool Move(const int* targets, int time_ms, uint8_t mask = 0xFF);
+    // Positions are center + amplitude * sin(2 pi t / period + phase), phase in radians
+    bool Oscillate(const int* amplitude, const int* center, const double* phase, int period_ms,
+                   float cycles);
+    bool Hold(int time_ms);
+    bool Append(const ServoSegment& segment);
+
+    // Drops every queued segment, the servos stop where they are
+    void Cancel();
+    void Resume();
+    void WaitUntilIdle();
+    bool IsBusy();
+
+    // Position in degrees once every queued segment has run
+    int GetPosition(int index);
+
+private:
+    int servos_;
+    esp_timer_handle_t timer_ = nullptr;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<ServoSegment> queue_;
+    bool running_ = false;
+    bool cancelled_ = false;
+
+    ServoSegment segment_;
+    bool active_ = false;
+    uint32_t tick_ = 0;
+    int32_t start_[SERVO_MAX_SERVOS];
+    int32_t output_[SERVO_MAX_SERVOS];      // Q8 degrees, what the servos were last told
+    int32_t planned_[SERVO_MAX_SERVOS];     // Q8 degrees at the end of the queue
+    int32_t speed_limit_[SERVO_MAX_SERVOS] = {};    // Q8 degrees per tick
+    int trim_[SERVO_MAX_SERVOS] = {};
+    bool attached_[SERVO_MAX_SERVOS] = {};
+    uint32_t duty_[SERVO_MAX_SERVOS] = {};
+
+    void OnTimer();
+    void WriteOutputs(const int32_t* positions);
+};
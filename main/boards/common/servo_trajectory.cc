@@ -0,0 +1,65 @@
+#include "servo_trajectory.h"
+
+#include <cmath>
+
+#define SERVO_SINE_TABLE_BITS 8
+
+int32_t ServoSine(uint32_t phase) {
+    // One cycle in 256 entries plus the wrap, interpolated to well below one PWM step
+    static const auto* table = [] {
+        static int16_t values[(1 << SERVO_SINE_TABLE_BITS) + 1];
+        for (int i = 0; i <= (1 << SERVO_SINE_TABLE_BITS); i++) {
+            values[i] = std::lround(32767.0 * std::sin(2.0 * M_PI * i / (1 << SERVO_SINE_TABLE_BITS)));
+        }
+        return values;
+    }();
+
+    uint32_t index = phase >> (32 - SERVO_SINE_TABLE_BITS);
+    int32_t fraction = (phase >> (16 - SERVO_SINE_TABLE_BITS)) & 0xFFFF;
+    return table[index] + (((table[index + 1] - table[index]) * fraction) >> 16);
+}
+
+int32_t ServoMinJerk(int32_t progress) {
+    if (progress <= 0) {
+        return 0;
+    }
+    if (progress >= 65536) {
+        return 65536;
+    }
+    int64_t t = progress;
+    int64_t t2 = (t * t) >> 16;
+    int64_t t3 = (t2 * t) >> 16;
+    int64_t shape = 10 * 65536 - 15 * t + 6 * t2;
+    return (t3 * shape) >> 16;
+}
+
+void ServoSegmentPositions(const ServoSegment& segment, const int32_t* start, int servos,
+                           uint32_t tick, int32_t* positions) {
+    if (segment.type == kServoSegmentMove) {
+        int32_t progress = segment.ticks > 0 ? (int64_t)tick * 65536 / segment.ticks : 65536;
+        int32_t shape = ServoMinJerk(progress);
+        for (int i = 0; i < servos; i++) {
+            if (segment.mask & (1 << i)) {
+                int32_t distance = segment.position[i] * 256 - start[i];
+                positions[i] = start[i] + (((int64_t)distance * shape) >> 16);
+            } else {
+                positions[i] = start[i];
+            }
+        }
+    } else if (segment.type == kServoSegmentOscillate) {
+        // The first tick is at the start phase, like the first sample of the old oscillator
+        uint32_t phase_offset = (tick - 1) * segment.phase_step;
+        for (int i = 0; i < servos; i++) {
+            if (segment.mask & (1 << i)) {
+                uint32_t phase = ((uint32_t)segment.phase[i] << 16) + phase_offset;
+                positions[i] = segment.position[i] * 256 + ((segment.amplitude[i] * ServoSine(phase) + 64) >> 7);
+            } else {
+                positions[i] = start[i];
+            }
+        }
+    } else {
+        for (int i = 0; i < servos; i++) {
+            positions[i] = start[i];
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#define SERVO_MAX_SERVOS 7          // LEDC channels 1-7, channel 0 is left to the backlight
+#define SERVO_MOTION_TICK_MS 10     // All servos are sampled together at this interval
+
+enum ServoSegmentType {
+    kServoSegmentHold,
+    kServoSegmentMove,
+    kServoSegmentOscillate,
+};
+
+/*
+ * 一段舵机轨迹，所有舵机共用同一个时长。
+ * 入队时把参数换算成定点数，定时器每个节拍只做整数运算。
+ */
+struct ServoSegment {
+    ServoSegmentType type = kServoSegmentHold;
+    uint32_t ticks = 0;
+    uint32_t phase_step = 0;                    // Oscillation cycles per tick in Q32
+    uint8_t mask = 0;                           // Servos driven by this segment, the others hold
+    int16_t position[SERVO_MAX_SERVOS] = {};    // Target of a move, or center of an oscillation, in degrees
+    int16_t amplitude[SERVO_MAX_SERVOS] = {};   // Degrees
+    uint16_t phase[SERVO_MAX_SERVOS] = {};      // Start phase in Q16 cycles
+};
+
+// Sine of a phase in Q32 cycles, in Q15
+int32_t ServoSine(uint32_t phase);
+
+// Minimum jerk profile 10t^3 - 15t^4 + 6t^5, starts and stops with zero velocity and acceleration.
+// Progress and result are in Q16.
+int32_t ServoMinJerk(int32_t progress);
+
+// Positions in Q8 degrees at tick 1 to segment.ticks, start holds the positions when the segment began
+void ServoSegmentPositions(const ServoSegment& segment, const int32_t* start, int servos,
+                           uint32_t tick, int32_t* positions);
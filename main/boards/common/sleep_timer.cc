@@ -2,6 +2,7 @@
 #include "application.h"
 #include "board.h"
 #include "display.h"
+#include "settings.h"
 
 #include <esp_log.h>
 #include <esp_sleep.h>
@@ -99,6 +100,7 @@ void SleepTimer::CheckTimer() {
             on_enter_deep_sleep_mode_();
         }
 
+        Settings::Flush();
         esp_deep_sleep_start();
     }
 }
@@ -1,4 +1,5 @@
 #include "system_reset.h"
+#include "settings.h"
 
 #include <esp_log.h>
 #include <nvs_flash.h>
@@ -38,6 +39,7 @@ void SystemReset::CheckButtons() {
 
 void SystemReset::ResetNvsFlash() {
     ESP_LOGI(TAG, "Resetting NVS flash");
+    Settings::Reset();
     esp_err_t ret = nvs_flash_erase();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to erase NVS flash");
@@ -5,7 +5,10 @@
 #include <cJSON.h>
 #include <esp_log.h>
 
+#include <atomic>
 #include <cstring>
+#include <mutex>
+#include <stdexcept>
 
 #include "application.h"
 #include "board.h"
@@ -23,6 +26,7 @@ struct ElectronBotActionParams {
     int speed;
     int direction;
     int amount;
+    uint32_t generation;
 };
 
 class ElectronBotController {
@@ -31,6 +35,9 @@ private:
     TaskHandle_t action_task_handle_ = nullptr;
     QueueHandle_t action_queue_;
     bool is_action_in_progress_ = false;
+    // 每次停止加一，入队时记下当时的值，早于最近一次停止的动作出队后直接丢弃
+    std::atomic<uint32_t> stop_generation_{0};
+    std::mutex stop_mutex_;
 
     enum ActionType {
         // 手部动作 1-12
@@ -70,8 +77,17 @@ private:
 
         while (true) {
             if (xQueueReceive(controller->action_queue_, &params, pdMS_TO_TICKS(1000)) == pdTRUE) {
+                // 检查和 Resume() 与停止工具互斥，停止不会夹在两者之间被 Resume() 撤销
+                {
+                    std::lock_guard<std::mutex> lock(controller->stop_mutex_);
+                    if (params.generation != controller->stop_generation_.load()) {
+                        ESP_LOGI(TAG, "丢弃停止前的动作: %d", params.action_type);
+                        continue;
+                    }
+                    controller->is_action_in_progress_ = true;  // 开始执行动作
+                    controller->electron_bot_.Resume();
+                }
                 ESP_LOGI(TAG, "执行动作: %d", params.action_type);
-                controller->is_action_in_progress_ = true;  // 开始执行动作
 
                 // 执行相应的动作
                 if (params.action_type >= ACTION_HAND_LEFT_UP &&
@@ -95,18 +111,26 @@ private:
                     // 复位动作
                     controller->electron_bot_.Home(true);
                 }
+                // 动作只是规划入队，等舵机执行完或者被取消
+                controller->electron_bot_.WaitUntilIdle();
                 controller->is_action_in_progress_ = false;  // 动作执行完毕
             }
             vTaskDelay(pdMS_TO_TICKS(20));
         }
     }
 
+    // 队列满时抛出异常，由 McpServer 把错误返回给调用方
     void QueueAction(int action_type, int steps, int speed, int direction, int amount) {
         ESP_LOGI(TAG, "动作控制: 类型=%d, 步数=%d, 速度=%d, 方向=%d, 幅度=%d", action_type, steps,
                  speed, direction, amount);
 
-        ElectronBotActionParams params = {action_type, steps, speed, direction, amount};
-        xQueueSend(action_queue_, &params, portMAX_DELAY);
+        ElectronBotActionParams params = {action_type, steps, speed, direction, amount,
+                                          stop_generation_.load()};
+        // 不阻塞调用工具的线程
+        if (xQueueSend(action_queue_, &params, 0) != pdTRUE) {
+            ESP_LOGW(TAG, "动作队列已满，忽略动作: %d", action_type);
+            throw std::runtime_error("Action queue is full, wait for the current actions to finish");
+        }
         StartActionTaskIfNeeded();
     }
 
@@ -249,9 +273,13 @@ public:
         // 系统工具
         mcp_server.AddTool("self.electron.stop", "立即停止", PropertyList(),
                            [this](const PropertyList& properties) -> ReturnValue {
-                               // 清空队列但保持任务常驻
-                               xQueueReset(action_queue_);
-                               is_action_in_progress_ = false;
+                               // 清空队列并取消正在执行的动作，任务保持常驻
+                               {
+                                   std::lock_guard<std::mutex> lock(stop_mutex_);
+                                   stop_generation_++;
+                                   xQueueReset(action_queue_);
+                                   electron_bot_.Stop();
+                               }
                                QueueAction(ACTION_HOME, 1, 1000, 0, 0);
                                return true;
                            });
@@ -28,7 +28,8 @@ public:
     virtual ~ElectronEmojiDisplay() = default;
 
     // 重写表情设置方法
-    virtual void SetEmotion(const char* emotion) override;
+    using Display::SetEmotion;
+    virtual void SetEmotion(Emotion emotion) override;
 
     // 重写聊天消息设置方法
     virtual void SetChatMessage(const char* role, const char* content) override;
@@ -41,11 +42,6 @@ private:
 
     lv_obj_t* emotion_gif_;  ///< GIF表情组件
 
-    // 表情映射
-    struct EmotionMap {
-        const char* name;
-        const lv_image_dsc_t* gif;
-    };
-
-    static const EmotionMap emotion_maps_[];
+    // 表情映射，按 Emotion 枚举索引
+    static const lv_image_dsc_t* const emotion_gifs_[kEmotionCount];
 };
\ No newline at end of file
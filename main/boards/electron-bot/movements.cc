@@ -3,11 +3,9 @@
 #include <algorithm>
 #include <cstring>
 
-#include "oscillator.h"
-
 static const char* TAG = "Movements";
 
-Otto::Otto() {
+Otto::Otto() : motion_(SERVO_COUNT) {
     is_otto_resting_ = false;
     for (int i = 0; i < SERVO_COUNT; i++) {
         servo_pins_[i] = -1;
@@ -19,10 +17,6 @@ Otto::~Otto() {
     DetachServos();
 }
 
-unsigned long IRAM_ATTR millis() {
-    return (unsigned long)(esp_timer_get_time() / 1000ULL);
-}
-
 void Otto::Init(int right_pitch, int right_roll, int left_pitch, int left_roll, int body,
                 int head) {
     servo_pins_[RIGHT_PITCH] = right_pitch;
@@ -42,7 +36,7 @@ void Otto::Init(int right_pitch, int right_roll, int left_pitch, int left_roll,
 void Otto::AttachServos() {
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].Attach(servo_pins_[i]);
+            motion_.Attach(i, servo_pins_[i]);
         }
     }
 }
@@ -50,7 +44,7 @@ void Otto::AttachServos() {
 void Otto::DetachServos() {
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].Detach();
+            motion_.Detach(i);
         }
     }
 }
@@ -69,66 +63,38 @@ void Otto::SetTrims(int right_pitch, int right_roll, int left_pitch, int left_ro
 
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].SetTrim(servo_trim_[i]);
+            motion_.SetTrim(i, servo_trim_[i]);
         }
     }
 }
 
+///////////////////////////////////////////////////////////////////
+//-- MOTION QUEUE -----------------------------------------------//
+///////////////////////////////////////////////////////////////////
+void Otto::Stop() {
+    motion_.Cancel();
+    // 舵机可能停在半路，下一次 Home() 需要重新复位
+    is_otto_resting_ = false;
+}
+
+void Otto::Resume() {
+    motion_.Resume();
+}
+
+void Otto::WaitUntilIdle() {
+    motion_.WaitUntilIdle();
+}
+
 ///////////////////////////////////////////////////////////////////
 //-- BASIC MOTION FUNCTIONS -------------------------------------//
 ///////////////////////////////////////////////////////////////////
-void Otto::MoveServos(int time, int servo_target[]) {
+bool Otto::MoveServos(int time, int servo_target[]) {
     if (GetRestState() == true) {
         SetRestState(false);
     }
 
-    final_time_ = millis() + time;
-    if (time > 10) {
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1) {
-                increment_[i] = (servo_target[i] - servo_[i].GetPosition()) / (time / 10.0);
-            }
-        }
-
-        for (int iteration = 1; millis() < final_time_; iteration++) {
-            partial_time_ = millis() + 10;
-            for (int i = 0; i < SERVO_COUNT; i++) {
-                if (servo_pins_[i] != -1) {
-                    servo_[i].SetPosition(servo_[i].GetPosition() + increment_[i]);
-                }
-            }
-            vTaskDelay(pdMS_TO_TICKS(10));
-        }
-    } else {
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1) {
-                servo_[i].SetPosition(servo_target[i]);
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(time));
-    }
-
-    // final adjustment to the target.
-    bool f = true;
-    int adjustment_count = 0;
-    while (f && adjustment_count < 10) {
-        f = false;
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1 && servo_target[i] != servo_[i].GetPosition()) {
-                f = true;
-                break;
-            }
-        }
-        if (f) {
-            for (int i = 0; i < SERVO_COUNT; i++) {
-                if (servo_pins_[i] != -1) {
-                    servo_[i].SetPosition(servo_target[i]);
-                }
-            }
-            vTaskDelay(pdMS_TO_TICKS(10));
-            adjustment_count++;
-        }
-    };
+    // 所有舵机按最小加加速度曲线同时到达目标，Stop() 之后不会入队
+    return motion_.Move(servo_target, time);
 }
 
 void Otto::MoveSingle(int position, int servo_number) {
@@ -142,33 +108,19 @@ void Otto::MoveSingle(int position, int servo_number) {
     }
 
     if (servo_number >= 0 && servo_number < SERVO_COUNT && servo_pins_[servo_number] != -1) {
-        servo_[servo_number].SetPosition(position);
+        int target[SERVO_COUNT] = {};
+        target[servo_number] = position;
+        motion_.Move(target, 0, 1 << servo_number);
     }
 }
 
 void Otto::OscillateServos(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
                            double phase_diff[SERVO_COUNT], float cycle = 1) {
+    int center[SERVO_COUNT];
     for (int i = 0; i < SERVO_COUNT; i++) {
-        if (servo_pins_[i] != -1) {
-            servo_[i].SetO(offset[i]);
-            servo_[i].SetA(amplitude[i]);
-            servo_[i].SetT(period);
-            servo_[i].SetPh(phase_diff[i]);
-        }
+        center[i] = offset[i] + 90;
     }
-
-    double ref = millis();
-    double end_time = period * cycle + ref;
-
-    while (millis() < end_time) {
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1) {
-                servo_[i].Refresh();
-            }
-        }
-        vTaskDelay(5);
-    }
-    vTaskDelay(pdMS_TO_TICKS(10));
+    motion_.Oscillate(amplitude, center, phase_diff, period, cycle);
 }
 
 void Otto::Execute(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
@@ -177,16 +129,8 @@ void Otto::Execute(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int peri
         SetRestState(false);
     }
 
-    int cycles = (int)steps;
-
-    //-- Execute complete cycles
-    if (cycles >= 1)
-        for (int i = 0; i < cycles; i++)
-            OscillateServos(amplitude, offset, period, phase_diff);
-
-    //-- Execute the final not complete cycle
-    OscillateServos(amplitude, offset, period, phase_diff, (float)steps - cycles);
-    vTaskDelay(pdMS_TO_TICKS(10));
+    //-- All the cycles, including the final not complete one, run as one continuous oscillation
+    OscillateServos(amplitude, offset, period, phase_diff, steps);
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -194,11 +138,15 @@ void Otto::Execute(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int peri
 ///////////////////////////////////////////////////////////////////
 void Otto::Home(bool hands_down) {
     if (is_otto_resting_ == false) {  // Go to rest position only if necessary
-        MoveServos(1000, servo_initial_);
-        is_otto_resting_ = true;
+        if (MoveServos(1000, servo_initial_)) {
+            is_otto_resting_ = true;
+        }
     }
 
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    // Stop() 可能正好在复位动作入队后取消，这时后面的 Hold 也会失败，舵机不一定在初始位置
+    if (!motion_.Hold(1000)) {
+        is_otto_resting_ = false;
+    }
 }
 
 bool Otto::GetRestState() {
@@ -230,7 +178,7 @@ void Otto::HandAction(int action, int times, int amount, int period) {
 
     int current_positions[SERVO_COUNT];
     for (int i = 0; i < SERVO_COUNT; i++) {
-        current_positions[i] = (servo_pins_[i] != -1) ? servo_[i].GetPosition() : servo_initial_[i];
+        current_positions[i] = (servo_pins_[i] != -1) ? motion_.GetPosition(i) : servo_initial_[i];
     }
 
     switch (action) {
@@ -264,7 +212,7 @@ void Otto::HandAction(int action, int times, int amount, int period) {
             for (int i = 0; i < times; i++) {
                 current_positions[LEFT_PITCH] = 150 + (i % 2 == 0 ? -30 : 30);
                 MoveServos(period / 10, current_positions);
-                vTaskDelay(pdMS_TO_TICKS(period / 10));
+                motion_.Hold(period / 10);
             }
             memcpy(current_positions, servo_initial_, sizeof(current_positions));
             MoveServos(period, current_positions);
@@ -276,7 +224,7 @@ void Otto::HandAction(int action, int times, int amount, int period) {
             for (int i = 0; i < times; i++) {
                 current_positions[RIGHT_PITCH] = 30 + (i % 2 == 0 ? 30 : -30);
                 MoveServos(period / 10, current_positions);
-                vTaskDelay(pdMS_TO_TICKS(period / 10));
+                motion_.Hold(period / 10);
             }
             memcpy(current_positions, servo_initial_, sizeof(current_positions));
             MoveServos(period, current_positions);
@@ -290,7 +238,7 @@ void Otto::HandAction(int action, int times, int amount, int period) {
                 current_positions[LEFT_PITCH] = 150 + (i % 2 == 0 ? -30 : 30);
                 current_positions[RIGHT_PITCH] = 30 + (i % 2 == 0 ? 30 : -30);
                 MoveServos(period / 10, current_positions);
-                vTaskDelay(pdMS_TO_TICKS(period / 10));
+                motion_.Hold(period / 10);
             }
             memcpy(current_positions, servo_initial_, sizeof(current_positions));
             MoveServos(period, current_positions);
@@ -358,7 +306,7 @@ void Otto::BodyAction(int action, int times, int amount, int period) {
     int current_positions[SERVO_COUNT];
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            current_positions[i] = servo_[i].GetPosition();
+            current_positions[i] = motion_.GetPosition(i);
         } else {
             current_positions[i] = servo_initial_[i];
         }
@@ -385,7 +333,7 @@ void Otto::BodyAction(int action, int times, int amount, int period) {
 
     current_positions[BODY] = target_angle;
     MoveServos(period, current_positions);
-    vTaskDelay(pdMS_TO_TICKS(100));
+    motion_.Hold(100);
 }
 
 //---------------------------------------------------------
@@ -405,7 +353,7 @@ void Otto::HeadAction(int action, int times, int amount, int period) {
     int current_positions[SERVO_COUNT];
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            current_positions[i] = servo_[i].GetPosition();
+            current_positions[i] = motion_.GetPosition(i);
         } else {
             current_positions[i] = servo_initial_[i];
         }
@@ -428,12 +376,12 @@ void Otto::HeadAction(int action, int times, int amount, int period) {
             // 先抬头
             current_positions[HEAD] = head_center + amount;
             MoveServos(period / 3, current_positions);
-            vTaskDelay(pdMS_TO_TICKS(period / 6));
+            motion_.Hold(period / 6);
 
             // 再低头
             current_positions[HEAD] = head_center - amount;
             MoveServos(period / 3, current_positions);
-            vTaskDelay(pdMS_TO_TICKS(period / 6));
+            motion_.Hold(period / 6);
 
             // 回到中心
             current_positions[HEAD] = head_center;
@@ -455,7 +403,7 @@ void Otto::HeadAction(int action, int times, int amount, int period) {
                 current_positions[HEAD] = head_center - amount;
                 MoveServos(period / 2, current_positions);
 
-                vTaskDelay(pdMS_TO_TICKS(50));  // 短暂停顿
+                motion_.Hold(50);  // 短暂停顿
             }
 
             // 回到中心
@@ -6,7 +6,14 @@
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "oscillator.h"
+#include "servo_motion.h"
+
+#include <atomic>
+#include <cmath>
+
+#ifndef DEG2RAD
+#define DEG2RAD(g) ((g) * M_PI) / 180
+#endif
 
 //-- Constants
 #define FORWARD 1
@@ -45,8 +52,14 @@ public:
     void SetTrims(int right_pitch, int right_roll, int left_pitch, int left_roll, int body,
                   int head);
 
+    //-- Motion queue. The functions below only plan their motions and return
+    //-- once the last segment is queued, Stop() drops everything until Resume()
+    void Stop();
+    void Resume();
+    void WaitUntilIdle();
+
     //-- Predetermined Motion Functions
-    void MoveServos(int time, int servo_target[]);
+    bool MoveServos(int time, int servo_target[]);
     void MoveSingle(int position, int servo_number);
     void OscillateServos(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
                          double phase_diff[SERVO_COUNT], float cycle);
@@ -70,17 +83,13 @@ public:
     // action: 1=抬头, 2=低头, 3=点头, 4=回中心, 5=连续点头
 
 private:
-    Oscillator servo_[SERVO_COUNT];
+    ServoMotion motion_;
 
     int servo_pins_[SERVO_COUNT];
     int servo_trim_[SERVO_COUNT];
     int servo_initial_[SERVO_COUNT] = {180, 180, 0, 0, 90, 90};
 
-    unsigned long final_time_;
-    unsigned long partial_time_;
-    float increment_[SERVO_COUNT];
-
-    bool is_otto_resting_;
+    std::atomic<bool> is_otto_resting_;  // Stop() clears it from the MCP thread
 
     void Execute(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
                  double phase_diff[SERVO_COUNT], float steps);
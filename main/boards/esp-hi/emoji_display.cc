@@ -107,39 +107,44 @@ EmojiWidget::~EmojiWidget()
 
 }
 
-void EmojiWidget::SetEmotion(const char* emotion)
+void EmojiWidget::SetEmotion(Emotion emotion)
 {
-    if (!player_) {
+    if (!player_ || emotion >= kEmotionCount) {
         return;
     }
 
-    using Param = std::tuple<int, bool, int>;
-    static const std::unordered_map<std::string, Param> emotion_map = {
-        {"happy",       {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"laughing",    {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"funny",       {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"loving",      {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"embarrassed", {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"confident",   {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"delicious",   {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"sad",         {MMAP_EMOJI_SAD_LOOP_AAF,   true, 25}},
-        {"crying",      {MMAP_EMOJI_SAD_LOOP_AAF,   true, 25}},
-        {"sleepy",      {MMAP_EMOJI_SAD_LOOP_AAF,   true, 25}},
-        {"silly",       {MMAP_EMOJI_SAD_LOOP_AAF,   true, 25}},
-        {"angry",       {MMAP_EMOJI_ANGER_LOOP_AAF, true, 25}},
-        {"surprised",   {MMAP_EMOJI_PANIC_LOOP_AAF, true, 25}},
-        {"shocked",     {MMAP_EMOJI_PANIC_LOOP_AAF, true, 25}},
-        {"thinking",    {MMAP_EMOJI_HAPPY_LOOP_AAF, true, 25}},
-        {"winking",     {MMAP_EMOJI_BLINK_QUICK_AAF, true, 5}},
-        {"relaxed",     {MMAP_EMOJI_SCORN_LOOP_AAF, true, 25}},
-        {"confused",    {MMAP_EMOJI_SCORN_LOOP_AAF, true, 25}},
+    struct Param {
+        int aaf;    // -1 表示保持当前动画
+        bool repeat;
+        int fps;
+    };
+    static const Param emotion_params[kEmotionCount] = {
+        {-1,                          false, 0},  // neutral
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // happy
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // laughing
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // funny
+        {MMAP_EMOJI_SAD_LOOP_AAF,     true, 25},  // sad
+        {MMAP_EMOJI_ANGER_LOOP_AAF,   true, 25},  // angry
+        {MMAP_EMOJI_SAD_LOOP_AAF,     true, 25},  // crying
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // loving
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // embarrassed
+        {MMAP_EMOJI_PANIC_LOOP_AAF,   true, 25},  // surprised
+        {MMAP_EMOJI_PANIC_LOOP_AAF,   true, 25},  // shocked
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // thinking
+        {MMAP_EMOJI_BLINK_QUICK_AAF,  true, 5},   // winking
+        {-1,                          false, 0},  // cool
+        {MMAP_EMOJI_SCORN_LOOP_AAF,   true, 25},  // relaxed
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // delicious
+        {-1,                          false, 0},  // kissy
+        {MMAP_EMOJI_HAPPY_LOOP_AAF,   true, 25},  // confident
+        {MMAP_EMOJI_SAD_LOOP_AAF,     true, 25},  // sleepy
+        {MMAP_EMOJI_SAD_LOOP_AAF,     true, 25},  // silly
+        {MMAP_EMOJI_SCORN_LOOP_AAF,   true, 25},  // confused
     };
 
-    auto it = emotion_map.find(emotion);
-    if (it != emotion_map.end()) {
-        const auto& [aaf, repeat, fps] = it->second;
-        player_->StartPlayer(aaf, repeat, fps);
-    } else if (strcmp(emotion, "neutral") == 0) {
+    const auto& param = emotion_params[emotion];
+    if (param.aaf >= 0) {
+        player_->StartPlayer(param.aaf, param.repeat, param.fps);
     }
 }
 
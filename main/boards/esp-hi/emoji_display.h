@@ -36,7 +36,8 @@ public:
     EmojiWidget(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t panel_io);
     virtual ~EmojiWidget();
 
-    virtual void SetEmotion(const char* emotion) override;
+    using Display::SetEmotion;
+    virtual void SetEmotion(Emotion emotion) override;
     virtual void SetStatus(const char* status) override;
     anim::EmojiPlayer* GetPlayer()
     {
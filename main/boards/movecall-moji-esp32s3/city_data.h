@@ -1,10 +1,10 @@
 /*
  * @Date: 2025-01-27
- * @Description: 城市经纬度数据，从CSV文件自动生成
+ * @Description: 城市经纬度数据接口，数据在 city_data_impl.cc 中，从CSV文件自动生成
  * @Generated: 自动生成，请勿手动编辑
  */
-#include <cstddef>
 #pragma once
+#include <cstddef>
 
 struct CityData {
     const char* id;       // 城市ID
@@ -15,3230 +15,16 @@ struct CityData {
     double lon;           // 经度
 };
 
-static const CityData city_coordinates[] = {
-    {"WX4FBXXFKE4F", "北京市", "北京/北京", "Beijing", 39.900000, 116.400000},
-    {"WX4G0URR276S", "北京市/东城区", "北京/东城", "Dongcheng", 39.926952, 116.410117},
-    {"WX4EPCD9BMPN", "北京市/西城区", "北京/西城", "Xicheng", 39.910912, 116.359655},
-    {"WX4G17JWZEK7", "北京市/朝阳区", "北京/朝阳", "Chaoyang", 39.920000, 116.430000},
-    {"WX4DWN2X06KM", "北京市/丰台区", "北京/丰台", "Fengtai", 39.850000, 116.280000},
-    {"WX4DUXSF6714", "北京市/石景山区", "北京/石景山", "Shijingshan", 39.900000, 116.220000},
-    {"WX4EQ2XJD7V2", "北京市/海淀区", "北京/海淀", "Haidian", 39.950000, 116.300000},
-    {"WX4E1VJ3N56X", "北京市/门头沟区", "北京/门头沟", "Mentougou", 39.930000, 116.100000},
-    {"WX4D4S7291H4", "北京市/房山区", "北京/房山", "Fangshan", 39.750000, 116.130000},
-    {"WX4GN7JYY527", "北京市/通州区", "北京/通州", "Tongzhou", 39.920000, 116.650000},
-    {"WX4UQ3MYNN0Q", "北京市/顺义区", "北京/顺义", "Shunyi", 40.130000, 116.650000},
-    {"WX4SUCU47R3T", "北京市/昌平区", "北京/昌平", "Changping", 40.220000, 116.230000},
-    {"WX4DP0SUJ2YC", "北京市/大兴区", "北京/大兴", "Daxing", 39.730000, 116.330000},
-    {"WX4VMUP35BZ0", "北京市/怀柔区", "北京/怀柔", "Huairou", 40.320000, 116.630000},
-    {"WX5K31KNJY1W", "北京市/平谷区", "北京/平谷", "Pinggu", 40.130000, 117.120000},
-    {"WX5JDT1H236N", "北京市/密云区", "北京/密云", "Miyun", 40.370000, 116.830000},
-    {"WX4QNGWY2FE8", "北京市/延庆区", "北京/延庆", "Yanqing", 40.450000, 115.970000},
-    {"WWGQDCW6TBW1", "天津市", "天津/天津", "Tianjin", 39.120000, 117.200000},
-    {"WWGQE0U6VS5D", "天津市/和平区", "天津/和平", "Heping", 39.115942, 117.208226},
-    {"WWGQEFZMJC1W", "天津市/河东区", "天津/河东", "Hedong", 39.127299, 117.245313},
-    {"WWGQ7R6ZUMF7", "天津市/河西区", "天津/河西", "Hexi", 39.108570, 117.217097},
-    {"WWGQ9STVVP3Y", "天津市/南开区", "天津/南开", "Nankai", 39.137074, 117.144344},
-    {"WWGQDWRQSXXW", "天津市/河北区", "天津/河北", "Hebei", 39.146818, 117.190336},
-    {"WWGQC9YRXSBV", "天津市/红桥区", "天津/红桥", "Hongqiao", 39.166200, 117.145137},
-    {"WWGQM4R38052", "天津市/东丽区", "天津/东丽", "Dongli", 39.080000, 117.300000},
-    {"WWGNW7KUC8EN", "天津市/西青区", "天津/西青", "Xiqing", 39.130000, 117.000000},
-    {"WWGMZ01DBNXT", "天津市/津南区", "天津/津南", "Jinnan", 38.980000, 117.380000},
-    {"WWGR17G3NCFH", "天津市/北辰区", "天津/北辰", "Beichen", 39.220000, 117.130000},
-    {"WX50P0FTHSHF", "天津市/武清区", "天津/武清", "Wuqing", 39.380000, 117.030000},
-    {"WX53VNZ3B0EM", "天津市/宝坻区", "天津/宝坻", "Baodi", 39.720000, 117.300000},
-    {"WWGTYKJXE1UQ", "天津市/滨海新区", "天津/滨海新区", "Binhaixinqu", 39.002763, 117.704221},
-    {"WWGZ9PCCUGRS", "天津市/宁河区", "天津/宁河", "Ninghe", 39.330000, 117.820000},
-    {"WWGJKWFX9MYZ", "天津市/静海区", "天津/静海", "Jinghai", 38.930000, 116.920000},
-    {"WX57ZDBH4M0G", "天津市/蓟州区", "天津/蓟州", "Jixian", 40.050000, 117.400000},
-    {"WWC2MYYCM6J5", "河北省/石家庄市", "河北/石家庄/石家庄", "Shijiazhuang", 38.050000, 114.520000},
-    {"WWC2QK2826WW", "河北省/石家庄市/长安区", "河北/石家庄/长安", "Changan", 38.036099, 114.533177},
-    {"WWC2HQR941EY", "河北省/石家庄市/桥西区", "河北/石家庄/桥西", "Qiaoxi", 38.003263, 114.454971},
-    {"WWC2KWC5J30V", "河北省/石家庄市/新华区", "河北/石家庄/新华", "Xinhua", 38.050295, 114.457166},
-    {"WWC0M54UVCB4", "河北省/石家庄市/井陉矿区", "河北/石家庄/井陉", "Jingxing", 38.030000, 114.130000},
-    {"WWC2NNFBK813", "河北省/石家庄市/裕华区", "河北/石家庄/裕华", "Yuhua", 38.005872, 114.525456},
-    {"WWC8M50SUCVF", "河北省/石家庄市/藁城区", "河北/石家庄/藁城", "Gaocheng", 38.030000, 114.830000},
-    {"WWC28UQ8P492", "河北省/石家庄市/鹿泉区", "河北/石家庄/鹿泉", "Luquan", 38.080000, 114.300000},
-    {"WW9X2ZVDFXU1", "河北省/石家庄市/栾城区", "河北/石家庄/栾城", "Luancheng", 37.880000, 114.650000},
-    {"WWC0M73KEJJ4", "河北省/石家庄市/井陉县", "河北/石家庄/井陉", "Jingxing", 38.031348, 114.138815},
-    {"WWC3P0GRF7RY", "河北省/石家庄市/正定县", "河北/石家庄/正定", "Zhengding", 38.150000, 114.570000},
-    {"WWC6WEUYBRNZ", "河北省/石家庄市/行唐县", "河北/石家庄/行唐", "Xingtang", 38.430000, 114.550000},
-    {"WWC3FS39WJMP", "河北省/石家庄市/灵寿县", "河北/石家庄/灵寿", "Lingshou", 38.300000, 114.370000},
-    {"WW9MZUC5VS12", "河北省/石家庄市/高邑县", "河北/石家庄/高邑", "Gaoyi", 37.600000, 114.600000},
-    {"WWCCJQQNDECG", "河北省/石家庄市/深泽县", "河北/石家庄/深泽", "Shenze", 38.180000, 115.200000},
-    {"WW9Q6C8GXHVW", "河北省/石家庄市/赞皇县", "河北/石家庄/赞皇", "Zanhuang", 37.670000, 114.380000},
-    {"WWCC0NQWE5V7", "河北省/石家庄市/无极县", "河北/石家庄/无极", "Wuji", 38.180000, 114.970000},
-    {"WWC1WEJYKUGC", "河北省/石家庄市/平山县", "河北/石家庄/平山", "Pingshan", 38.250000, 114.200000},
-    {"WW9QVBNVTQJ1", "河北省/石家庄市/元氏县", "河北/石家庄/元氏", "Yuanshi", 37.750000, 114.520000},
-    {"WW9WG8HVWY49", "河北省/石家庄市/赵县", "河北/石家庄/赵县", "Zhaoxian", 37.750000, 114.770000},
-    {"WW9ZTZHSH874", "河北省/石家庄市/辛集市", "河北/石家庄/辛集", "Xinji", 37.920000, 115.220000},
-    {"WWCB3E4KC3BD", "河北省/石家庄市/晋州市", "河北/石家庄/晋州", "Jinzhou", 38.030000, 115.030000},
-    {"WWCD1T7KVWJU", "河北省/石家庄市/新乐市", "河北/石家庄/新乐", "Xinle", 38.350000, 114.680000},
-    {"WXH13WQT7XKN", "河北省/唐山市", "河北/唐山/唐山", "Tangshan", 39.630000, 118.200000},
-    {"WXH12T28ZCYU", "河北省/唐山市/路南区", "河北/唐山/路南", "Lunan", 39.623705, 118.148001},
-    {"WXH13T4TDV3W", "河北省/唐山市/路北区", "河北/唐山/路北", "Lubei", 39.623166, 118.194471},
-    {"WXH4P1N2GBRN", "河北省/唐山市/古冶区", "河北/唐山/古冶", "Guye", 39.732187, 118.441371},
-    {"WXH1DVXJJ7JU", "河北省/唐山市/开平区", "河北/唐山/开平", "Kaiping", 39.669759, 118.255696},
-    {"WX5CP7MZCQWS", "河北省/唐山市/丰南区", "河北/唐山/丰南", "Fengnan", 39.570000, 118.100000},
-    {"WXH494BF8D4K", "河北省/唐山市/丰润区", "河北/唐山/丰润", "Fengrun", 39.830000, 118.170000},
-    {"WWUNZ5FRFWND", "河北省/唐山市/曹妃甸区", "河北/唐山/曹妃甸", "Caofeidian", 39.177236, 118.435823},
-    {"WXH2SWU0HMTY", "河北省/唐山市/滦南县", "河北/唐山/滦南", "Luannan", 39.500000, 118.680000},
-    {"WXH838HQ4U9G", "河北省/唐山市/乐亭县", "河北/唐山/乐亭", "Leting", 39.420000, 118.900000},
-    {"WXHHKMJFXY6X", "河北省/唐山市/迁西县", "河北/唐山/迁西", "Qianxi", 40.150000, 118.320000},
-    {"WX5DZ5BMGFFD", "河北省/唐山市/玉田县", "河北/唐山/玉田", "Yutian", 39.880000, 117.730000},
-    {"WX5US4896NYS", "河北省/唐山市/遵化市", "河北/唐山/遵化", "Zunhua", 40.180000, 117.950000},
-    {"WXH7TJ6TQKXN", "河北省/唐山市/迁安市", "河北/唐山/迁安", "Qianan", 40.020000, 118.700000},
-    {"WXH6JH68W3P4", "河北省/唐山市/滦州市", "河北/唐山/滦州", "Luanxian", 39.750000, 118.700000},
-    {"WXJ51T411GRX", "河北省/秦皇岛市", "河北/秦皇岛/秦皇岛", "Qinhuangdao", 39.930000, 119.600000},
-    {"WXJ528H2CCFH", "河北省/秦皇岛市/海港区", "河北/秦皇岛/海港", "Haigang", 39.946428, 119.559137},
-    {"WXJ5MMTY1TV3", "河北省/秦皇岛市/山海关区", "河北/秦皇岛/山海关", "Shanhaiguan", 39.977563, 119.769931},
-    {"WXHFWFFDTF1H", "河北省/秦皇岛市/北戴河区", "河北/秦皇岛/北戴河", "Beidaihe", 39.830000, 119.480000},
-    {"WXHFC5UTU6GD", "河北省/秦皇岛市/抚宁区", "河北/秦皇岛/抚宁", "Funing", 39.880000, 119.230000},
-    {"WXHTFF8EPCUE", "河北省/秦皇岛市/青龙满族自治县", "河北/秦皇岛/青龙", "Qinglong", 40.400000, 118.950000},
-    {"WXH9ZG0VQ22K", "河北省/秦皇岛市/昌黎县", "河北/秦皇岛/昌黎", "Changli", 39.700000, 119.170000},
-    {"WXHDBGYMZFB6", "河北省/秦皇岛市/卢龙县", "河北/秦皇岛/卢龙", "Lulong", 39.880000, 118.870000},
-    {"WW92M43YCQG0", "河北省/邯郸市", "河北/邯郸/邯郸", "Handan", 36.620000, 114.480000},
-    {"WW92J5JNFTQ4", "河北省/邯郸市/邯山区", "河北/邯郸/邯山", "Hanshan", 36.580167, 114.484521},
-    {"WW92MJQVK1XG", "河北省/邯郸市/丛台区", "河北/邯郸/丛台", "Congtai", 36.636194, 114.486991},
-    {"WW92KTBK4BK7", "河北省/邯郸市/复兴区", "河北/邯郸/复兴", "Fuxing", 36.638720, 114.456034},
-    {"WW3PQKGPBU90", "河北省/邯郸市/峰峰矿区", "河北/邯郸/峰峰", "Fengfeng", 36.458111, 114.185062},
-    {"WW3XUMDZ1VU6", "河北省/邯郸市/肥乡区", "河北/邯郸/肥乡", "Feixiang", 36.550000, 114.800000},
-    {"WW93JP9G12GN", "河北省/邯郸市/永年区", "河北/邯郸/永年", "Yongnian", 36.780000, 114.480000},
-    {"WW3WB1RDPE4S", "河北省/邯郸市/临漳县", "河北/邯郸/临漳", "Linzhang", 36.350000, 114.620000},
-    {"WW3X1XGKJSJY", "河北省/邯郸市/成安县", "河北/邯郸/成安", "Chengan", 36.430000, 114.680000},
-    {"WW3YKK9DM6PJ", "河北省/邯郸市/大名县", "河北/邯郸/大名", "Daming", 36.280000, 115.150000},
-    {"WW8B497GWYP5", "河北省/邯郸市/涉县", "河北/邯郸/涉县", "Shexian", 36.570000, 113.670000},
-    {"WW3QF93DN5JH", "河北省/邯郸市/磁县", "河北/邯郸/磁县", "Cixian", 36.350000, 114.370000},
-    {"WW9CKYBHP92R", "河北省/邯郸市/邱县", "河北/邯郸/邱县", "Qiuxian", 36.820000, 115.170000},
-    {"WW9DJCJF94B4", "河北省/邯郸市/鸡泽县", "河北/邯郸/鸡泽", "Jize", 36.920000, 114.870000},
-    {"WW3XX2CRRHGK", "河北省/邯郸市/广平县", "河北/邯郸/广平", "Guangping", 36.480000, 114.930000},
-    {"WW3ZZDNFSTX3", "河北省/邯郸市/馆陶县", "河北/邯郸/馆陶", "Guantao", 36.530000, 115.300000},
-    {"WW3WZKCQX57K", "河北省/邯郸市/魏县", "河北/邯郸/魏县", "Weixian", 36.370000, 114.930000},
-    {"WW99PZ8510UQ", "河北省/邯郸市/曲周县", "河北/邯郸/曲周", "Quzhou", 36.780000, 114.950000},
-    {"WW90Y9JBUZGG", "河北省/邯郸市/武安市", "河北/邯郸/武安", "Wuan", 36.700000, 114.200000},
-    {"WW96VH3U3KG5", "河北省/邢台市", "河北/邢台", "Xingtai", 37.070000, 114.480000},
-    {"WW96VECQ55CT", "河北省/邢台市/桥东区", "河北/邢台/桥东", "Qiaodong", 37.067549, 114.501359},
-    {"WW96UDKYNGT7", "河北省/邢台市/桥西区", "河北/邢台/桥西", "Qiaoxi", 37.059307, 114.462386},
-    {"WW96VH3U3KG5", "河北省/邢台市/邢台县", "河北/邢台/邢台", "Xingtai", 37.070000, 114.480000},
-    {"WW9KVTBME3SP", "河北省/邢台市/临城县", "河北/邢台/临城", "Lincheng", 37.430000, 114.500000},
-    {"WW9KJYQBJRVN", "河北省/邢台市/内丘县", "河北/邢台/内丘", "Neiqiu", 37.300000, 114.520000},
-    {"WW9T3DEMMDTV", "河北省/邢台市/柏乡县", "河北/邢台/柏乡", "Baixiang", 37.500000, 114.680000},
-    {"WW9S7XKGWBDS", "河北省/邢台市/隆尧县", "河北/邢台/隆尧", "Longyao", 37.350000, 114.770000},
-    {"WW9E1X73VTTV", "河北省/邢台市/任县", "河北/邢台/任县", "Renxian", 37.130000, 114.680000},
-    {"WW9D3XEKTEVV", "河北省/邢台市/南和县", "河北/邢台/南和", "Nanhe", 37.000000, 114.680000},
-    {"WW9WP0D0QH6C", "河北省/邢台市/宁晋县", "河北/邢台/宁晋", "Ningjin", 37.620000, 114.920000},
-    {"WW9G9XDQ1QBS", "河北省/邢台市/巨鹿县", "河北/邢台/巨鹿", "Julu", 37.220000, 115.030000},
-    {"WW9VW84KPEHD", "河北省/邢台市/新河县", "河北/邢台/新河", "Xinhe", 37.530000, 115.250000},
-    {"WW9FUK3SMKZ5", "河北省/邢台市/广宗县", "河北/邢台/广宗", "Guangzong", 37.070000, 115.150000},
-    {"WW9FCS6K3KBE", "河北省/邢台市/平乡县", "河北/邢台/平乡", "Pingxiang", 37.070000, 115.030000},
-    {"WW9FQS42PESS", "河北省/邢台市/威县", "河北/邢台/威县", "Weixian", 36.980000, 115.250000},
-    {"WWD6BHKK6KG7", "河北省/邢台市/清河县", "河北/邢台/清河", "Qinghe", 37.070000, 115.670000},
-    {"WWD1SK2DC1FH", "河北省/邢台市/临西县", "河北/邢台/临西", "Linxi", 36.850000, 115.500000},
-    {"WWDH3X35SBES", "河北省/邢台市/南宫市", "河北/邢台/南宫", "Nangong", 37.350000, 115.380000},
-    {"WW93TS26G3UH", "河北省/邢台市/沙河市", "河北/邢台/沙河", "Shahe", 36.850000, 114.500000},
-    {"WWFJ5S4DNJ0T", "河北省/保定市", "河北/保定/保定", "Baoding", 38.870000, 115.470000},
-    {"WWFJ5JMBF7CD", "河北省/保定市/竞秀区", "河北/保定/竞秀", "Jingxiu", 38.876645, 115.452331},
-    {"WWFJHN3UNPX7", "河北省/保定市/莲池区", "河北/保定/莲池", "Lianchi", 38.882716, 115.490952},
-    {"WWFJ84TKNY22", "河北省/保定市/满城区", "河北/保定/满城", "Mancheng", 38.950000, 115.320000},
-    {"WWFHECCGX5C4", "河北省/保定市/清苑区", "河北/保定/清苑", "Qingyuan", 38.770000, 115.480000},
-    {"WWFJZXMGBR4N", "河北省/保定市/徐水区", "河北/保定/徐水", "Xushui", 39.020000, 115.650000},
-    {"WX421K89XKQ4", "河北省/保定市/涞水县", "河北/保定/涞水", "Laishui", 39.400000, 115.720000},
-    {"WWCJN0RMDUFV", "河北省/保定市/阜平县", "河北/保定/阜平", "Fuping", 38.850000, 114.180000},
-    {"WWFR6KVHKD8D", "河北省/保定市/定兴县", "河北/保定/定兴", "Dingxing", 39.270000, 115.770000},
-    {"WWCU2QJZH5W1", "河北省/保定市/唐县", "河北/保定/唐县", "Tangxian", 38.750000, 114.980000},
-    {"WWFK49KRMD97", "河北省/保定市/高阳县", "河北/保定/高阳", "Gaoyang", 38.680000, 115.780000},
-    {"WWFQHSVFWXW5", "河北省/保定市/容城县", "河北/保定/容城", "Rongcheng", 39.050000, 115.870000},
-    {"WWCXCE7QMETV", "河北省/保定市/涞源县", "河北/保定/涞源", "Laiyuan", 39.350000, 114.680000},
-    {"WWCUK2C8M7PH", "河北省/保定市/望都县", "河北/保定/望都", "Wangdu", 38.720000, 115.150000},
-    {"WWFMQJ1TKVC7", "河北省/保定市/安新县", "河北/保定/安新", "Anxin", 38.920000, 115.930000},
-    {"WWFPU72W35DJ", "河北省/保定市/易县", "河北/保定/易县", "Yixian", 39.350000, 115.500000},
-    {"WWCEDN9CZ9YC", "河北省/保定市/曲阳县", "河北/保定/曲阳", "Quyang", 38.620000, 114.700000},
-    {"WWF4VV5D0PVV", "河北省/保定市/蠡县", "河北/保定/蠡县", "Lixian", 38.480000, 115.570000},
-    {"WWCUGUG15KWH", "河北省/保定市/顺平县", "河北/保定/顺平", "Shunping", 38.830000, 115.130000},
-    {"WWF4EXDEQP88", "河北省/保定市/博野县", "河北/保定/博野", "Boye", 38.450000, 115.470000},
-    {"WWFTCBJ6YNDT", "河北省/保定市/雄县", "河北/保定/雄县", "Xiongxian", 38.980000, 116.100000},
-    {"WX42WGNG8V7T", "河北省/保定市/涿州市", "河北/保定/涿州", "Zhuozhou", 39.480000, 115.970000},
-    {"WWCG0HQE70MQ", "河北省/保定市/定州市", "河北/保定/定州", "Dingzhou", 38.520000, 114.970000},
-    {"WWF484JKWZ07", "河北省/保定市/安国市", "河北/保定/安国", "Anguo", 38.420000, 115.320000},
-    {"WWFRSPZ3UEMH", "河北省/保定市/高碑店市", "河北/保定/高碑店", "Gaobeidian", 39.330000, 115.850000},
-    {"WX38NPJ1DP88", "河北省/张家口市", "河北/张家口/张家口", "Zhangjiakou", 40.820000, 114.880000},
-    {"WX38N3543Y5E", "河北省/张家口市/桥东区", "河北/张家口/桥东", "Qiaodong", 40.787162, 114.888233},
-    {"WX38JY8ZKHXS", "河北省/张家口市/桥西区", "河北/张家口/桥西", "Qiaoxi", 40.818225, 114.863272},
-    {"WX1YFP0B5K9C", "河北省/张家口市/宣化区", "河北/张家口/宣化", "Xuanhua", 40.600000, 115.050000},
-    {"WX1YRM11239W", "河北省/张家口市/下花园区", "河北/张家口/下花园", "Xiahuayuan", 40.501322, 115.280927},
-    {"WX1XFD29CWXF", "河北省/张家口市/万全区", "河北/张家口/万全", "Wanquan", 40.750000, 114.720000},
-    {"WX3CP43599T9", "河北省/张家口市/崇礼区", "河北/张家口/崇礼", "Chongli", 40.970000, 115.270000},
-    {"WX3D451UPEYZ", "河北省/张家口市/张北县", "河北/张家口/张北", "Zhangbei", 41.150000, 114.700000},
-    {"WX3W04X9ZT6W", "河北省/张家口市/康保县", "河北/张家口/康保", "Kangbao", 41.850000, 114.620000},
-    {"WX6M0CF1M7HB", "河北省/张家口市/沽源县", "河北/张家口/沽源", "Guyuan", 41.670000, 115.700000},
-    {"WX319QQKM7P3", "河北省/张家口市/尚义县", "河北/张家口/尚义", "Shangyi", 41.080000, 113.970000},
-    {"WX16XN7R46RV", "河北省/张家口市/蔚县", "河北/张家口/蔚县", "Yuxian", 39.850000, 114.570000},
-    {"WX1HNP85CY46", "河北省/张家口市/阳原县", "河北/张家口/阳原", "Yangyuan", 40.120000, 114.170000},
-    {"WX1R7EWPGJRZ", "河北省/张家口市/怀安县", "河北/张家口/怀安", "Huaian", 40.670000, 114.420000},
-    {"WX4JUDX551G5", "河北省/张家口市/怀来县", "河北/张家口/怀来", "Huailai", 40.400000, 115.520000},
-    {"WX1VTYUWS9E4", "河北省/张家口市/涿鹿县", "河北/张家口/涿鹿", "Zhuolu", 40.380000, 115.220000},
-    {"WX62GC2B68GG", "河北省/张家口市/赤城县", "河北/张家口/赤城", "Chicheng", 40.920000, 115.830000},
-    {"WX7C5D6581T3", "河北省/承德市", "河北/承德/承德", "Chengde", 40.970000, 117.930000},
-    {"WX7C5DZJSF0K", "河北省/承德市/双桥区", "河北/承德/双桥", "Shuangqiao", 40.973093, 117.937063},
-    {"WX7C02NE1C46", "河北省/承德市/双滦区", "河北/承德/双滦", "Shuangluan", 40.957552, 117.793428},
-    {"WX5WTM1EG05G", "河北省/承德市/鹰手营子矿区", "河北/承德/鹰手营", "Yingshouying", 40.545688, 117.654782},
-    {"WXHPCJBY2WF7", "河北省/承德市/承德县", "河北/承德/承德县", "Chengdexian", 40.770000, 118.170000},
-    {"WX5W40P3Y6R2", "河北省/承德市/兴隆县", "河北/承德/兴隆", "Xinglong", 40.430000, 117.520000},
-    {"WX72VGJ4E1J0", "河北省/承德市/滦平县", "河北/承德/滦平", "Luanping", 40.930000, 117.330000},
-    {"WX7ENF146Y60", "河北省/承德市/隆化县", "河北/承德/隆化", "Longhua", 41.320000, 117.720000},
-    {"WX6FQKJZQH8M", "河北省/承德市/丰宁满族自治县", "河北/承德/丰宁", "Fengning", 41.200000, 116.650000},
-    {"WXHQBP480HE1", "河北省/承德市/宽城满族自治县", "河北/承德/宽城", "Kuancheng", 40.600000, 118.480000},
-    {"WX7WX3NGVYE8", "河北省/承德市/围场满族蒙古族自治县", "河北/承德/围场", "Weichang", 41.930000, 117.750000},
-    {"WXK3HXU4K3VY", "河北省/承德市/平泉市", "河北/承德/平泉", "Pingquan", 41.000000, 118.680000},
-    {"WWG1FS318M6P", "河北省/沧州市", "河北/沧州/沧州", "Cangzhou", 38.300000, 116.830000},
-    {"WWG1GNZ4XV45", "河北省/沧州市/新华区", "河北/沧州/新华", "Xinhua", 38.313903, 116.860535},
-    {"WWG1FQN3QJUR", "河北省/沧州市/运河区", "河北/沧州/运河", "Yunhe", 38.309573, 116.826473},
-    {"WWG1GKQ1SMKP", "河北省/沧州市/沧县", "河北/沧州/沧县", "Cangxian", 38.300000, 116.870000},
-    {"WWG56R38Z332", "河北省/沧州市/青县", "河北/沧州/青县", "Qingxian", 38.580000, 116.820000},
-    {"WWDZ7XYDCZCC", "河北省/沧州市/东光县", "河北/沧州/东光", "Dongguang", 37.880000, 116.530000},
-    {"WWG8CM6767JJ", "河北省/沧州市/海兴县", "河北/沧州/海兴", "Haixing", 38.130000, 117.480000},
-    {"WWG27QUCRFP5", "河北省/沧州市/盐山县", "河北/沧州/盐山", "Yanshan", 38.050000, 117.220000},
-    {"WWF6EGBYFX5Z", "河北省/沧州市/肃宁县", "河北/沧州/肃宁", "Suning", 38.430000, 115.830000},
-    {"WWFBRE4KG1FF", "河北省/沧州市/南皮县", "河北/沧州/南皮", "Nanpi", 38.030000, 116.700000},
-    {"WWDY02926S39", "河北省/沧州市/吴桥县", "河北/沧州/吴桥", "Wuqiao", 37.620000, 116.380000},
-    {"WWF94QKN85GE", "河北省/沧州市/献县", "河北/沧州/献县", "Xianxian", 38.180000, 116.120000},
-    {"WWG28DMTGF2E", "河北省/沧州市/孟村回族自治县", "河北/沧州/孟村", "Mengcun", 38.070000, 117.100000},
-    {"WWFBSD7TVF7G", "河北省/沧州市/泊头市", "河北/沧州/泊头", "Botou", 38.070000, 116.570000},
-    {"WWFS3BV2Q54S", "河北省/沧州市/任丘市", "河北/沧州/任丘", "Renqiu", 38.720000, 116.100000},
-    {"WWG6Q359MNQJ", "河北省/沧州市/黄骅市", "河北/沧州/黄骅", "Huanghua", 38.370000, 117.350000},
-    {"WWFD97YYUP1R", "河北省/沧州市/河间市", "河北/沧州/河间", "Hejian", 38.430000, 116.080000},
-    {"WX4BZD6KEJFY", "河北省/廊坊市", "河北/廊坊/廊坊", "Langfang", 39.520000, 116.700000},
-    {"WX4BXR409T9P", "河北省/廊坊市/安次区", "河北/廊坊/安次", "Anci", 39.501459, 116.688603},
-    {"WX4BZDTY2B9D", "河北省/廊坊市/广阳区", "河北/廊坊/广阳", "Guangyang", 39.521645, 116.704708},
-    {"WX48Q6P06KTR", "河北省/廊坊市/固安县", "河北/廊坊/固安", "Guan", 39.430000, 116.300000},
-    {"WWFZEJBXWG20", "河北省/廊坊市/永清县", "河北/廊坊/永清", "Yongqing", 39.320000, 116.500000},
-    {"WX54NRUV1974", "河北省/廊坊市/香河县", "河北/廊坊/香河", "Xianghe", 39.770000, 117.000000},
-    {"WWFUJVP7GFZH", "河北省/廊坊市/大城县", "河北/廊坊/大城", "Dacheng", 38.700000, 116.630000},
-    {"WWFV4K4F5TNT", "河北省/廊坊市/文安县", "河北/廊坊/文安", "Wenan", 38.870000, 116.470000},
-    {"WX54VGYJZDF4", "河北省/廊坊市/大厂回族自治县", "河北/廊坊/大厂", "Dachang", 39.880000, 116.980000},
-    {"WWFY2TZYH86C", "河北省/廊坊市/霸州市", "河北/廊坊/霸州", "Bazhou", 39.100000, 116.400000},
-    {"WX55RYPU2SNV", "河北省/廊坊市/三河市", "河北/廊坊/三河", "Sanhe", 39.980000, 117.070000},
-    {"WWDQ8KE95MGB", "河北省/衡水市", "河北/衡水/衡水", "Hengshui", 37.730000, 115.680000},
-    {"WWDQ8J7UXJP4", "河北省/衡水市/桃城区", "河北/衡水/桃城", "Taocheng", 37.734717, 115.669522},
-    {"WWDJTZ7T05TG", "河北省/衡水市/冀州区", "河北/衡水/冀州", "Jizhou", 37.570000, 115.570000},
-    {"WWDM3Q29Z6YJ", "河北省/衡水市/枣强县", "河北/衡水/枣强", "Zaoqiang", 37.520000, 115.720000},
-    {"WWDRHUVJRWYX", "河北省/衡水市/武邑县", "河北/衡水/武邑", "Wuyi", 37.820000, 115.880000},
-    {"WWF2R5NHCCU4", "河北省/衡水市/武强县", "河北/衡水/武强", "Wuqiang", 38.030000, 115.980000},
-    {"WWF33X81BKW8", "河北省/衡水市/饶阳县", "河北/衡水/饶阳", "Raoyang", 38.230000, 115.730000},
-    {"WWF1KXX1GHE0", "河北省/衡水市/安平县", "河北/衡水/安平", "Anping", 38.230000, 115.520000},
-    {"WWDKQZQG8BES", "河北省/衡水市/故城县", "河北/衡水/故城", "Gucheng", 37.350000, 115.970000},
-    {"WWDWMZ14RM7E", "河北省/衡水市/景县", "河北/衡水/景县", "Jingxian", 37.700000, 116.270000},
-    {"WWDX7N1BEPTM", "河北省/衡水市/阜城县", "河北/衡水/阜城", "Fucheng", 37.870000, 116.150000},
-    {"WWF0M3KFW1SY", "河北省/衡水市/深州市", "河北/衡水/深州", "Shenzhou", 38.020000, 115.550000},
-    {"WW8P3NH2TPDT", "山西省/太原市", "山西/太原/太原", "Taiyuan", 37.870000, 112.550000},
-    {"WW8N9SDCPJGB", "山西省/太原市/小店区", "山西/太原/小店区", "Xiaodianqu", 37.730000, 112.570000},
-    {"WW8P3K9XEM94", "山西省/太原市/迎泽区", "山西/太原/迎泽", "Yingze", 37.862951, 112.557133},
-    {"WW8P96QC7QG2", "山西省/太原市/杏花岭区", "山西/太原/杏花岭", "Xinghualing", 37.893470, 112.564345},
-    {"WQXZZ8CQMBQZ", "山西省/太原市/尖草坪区", "山西/太原/尖草坪区", "Jiancaopingqu", 37.930000, 112.480000},
-    {"WW8P25YZ9Y3R", "山西省/太原市/万柏林区", "山西/太原/万柏林", "Wanbailin", 37.858836, 112.509347},
-    {"WQXYX3ENTGXR", "山西省/太原市/晋源区", "山西/太原/晋源", "Jinyuan", 37.714454, 112.471418},
-    {"WQXVUSFGBSPB", "山西省/太原市/清徐县", "山西/太原/清徐", "Qingxu", 37.600000, 112.350000},
-    {"WWB0EF7VC635", "山西省/太原市/阳曲县", "山西/太原/阳曲", "Yangqu", 38.070000, 112.670000},
-    {"WQZ2XD7TYF35", "山西省/太原市/娄烦县", "山西/太原/娄烦", "Loufan", 38.070000, 111.780000},
-    {"WQXZ8RPSN2Q4", "山西省/太原市/古交市", "山西/太原/古交", "Gujiao", 37.920000, 112.170000},
-    {"WX0S40QDCME0", "山西省/大同市", "山西/大同/大同", "Datong", 40.080000, 113.300000},
-    {"WX0MN2HGDW9C", "山西省/大同市/新荣区", "山西/大同/新荣", "Xinrong", 40.254542, 113.132854},
-    {"WX0ECZRGWVHT", "山西省/大同市/平城区", "山西/大同/平城", "Pingcheng", 40.074634, 113.290968},
-    {"WX07WD7XW8FZ", "山西省/大同市/云冈区", "山西/大同/云冈", "Yungang", 40.003887, 113.142296},
-    {"WX0G9P0ZXUG7", "山西省/大同市/云州区", "山西/大同/云州", "Datongxian", 40.030000, 113.600000},
-    {"WX0VSMNHR17W", "山西省/大同市/阳高县", "山西/大同/阳高", "Yanggao", 40.370000, 113.750000},
-    {"WX1JGYNX8DJ7", "山西省/大同市/天镇县", "山西/大同/天镇", "Tianzhen", 40.420000, 114.080000},
-    {"WX160XBJJ124", "山西省/大同市/广灵县", "山西/大同/广灵", "Guangling", 39.770000, 114.280000},
-    {"WX10R658RUTR", "山西省/大同市/灵丘县", "山西/大同/灵丘", "Lingqiu", 39.430000, 114.230000},
-    {"WX0CFG5JRBRU", "山西省/大同市/浑源县", "山西/大同/浑源", "Hunyuan", 39.700000, 113.680000},
-    {"WX05S9C8UK6Y", "山西省/大同市/左云县", "山西/大同/左云", "Zuoyun", 40.000000, 112.700000},
-    {"WW8Z267HHZ3U", "山西省/阳泉市", "山西/阳泉", "Yangquan", 37.850000, 113.570000},
-    {"WW8Z267HHZ3U", "山西省/阳泉市/城区", "山西/阳泉/阳泉", "Yangquan", 37.850000, 113.570000},
-    {"WW8Z27W1UTPU", "山西省/阳泉市/矿区", "山西/阳泉/矿区", "Kuangqu", 37.856468, 113.574117},
-    {"WW8ZBG80FZ2F", "山西省/阳泉市/郊区", "山西/阳泉/郊区", "Jiaoqu", 37.944199, 113.587766},
-    {"WW8Z13R8CYSX", "山西省/阳泉市/平定县", "山西/阳泉/平定", "Pingding", 37.800000, 113.620000},
-    {"WWB8SKR25D88", "山西省/阳泉市/盂县", "山西/阳泉/盂县", "Yuxian", 38.080000, 113.400000},
-    {"WW2MYN52R11E", "山西省/长治市", "山西/长治/长治", "Changzhi", 36.200000, 113.120000},
-    {"WW2MYN8DKWC5", "山西省/长治市/潞州区", "山西/长治/潞州", "Luzhou", 36.203121, 113.116116},
-    {"WW2MH7KCBNT6", "山西省/长治市/上党区", "山西/长治/上党", "Shangdang", 36.053345, 113.044860},
-    {"WW2Q8EUEQDSX", "山西省/长治市/屯留区", "山西/长治/屯留", "Tunliu", 36.320000, 112.880000},
-    {"WW2W8MSM94YG", "山西省/长治市/潞城区", "山西/长治/潞城", "Lucheng", 36.330000, 113.220000},
-    {"WW2RUD06XVT9", "山西省/长治市/襄垣县", "山西/长治/襄垣", "Xiangyuan", 36.530000, 113.050000},
-    {"WW2TVNJ0Q947", "山西省/长治市/平顺县", "山西/长治/平顺", "Pingshun", 36.200000, 113.430000},
-    {"WW2XSH8GCMPS", "山西省/长治市/黎城县", "山西/长治/黎城", "Licheng", 36.500000, 113.380000},
-    {"WW2MRZMWR0JB", "山西省/长治市/壶关县", "山西/长治/壶关", "Huguan", 36.120000, 113.200000},
-    {"WW2M2RMQM85B", "山西省/长治市/长子县", "山西/长治/长子", "Zhangzi", 36.120000, 112.870000},
-    {"WW81XBWY79DG", "山西省/长治市/武乡县", "山西/长治/武乡", "Wuxiang", 36.830000, 112.850000},
-    {"WW81HD1SK2DC", "山西省/长治市/沁县", "山西/长治/沁县", "Qinxian", 36.750000, 112.700000},
-    {"WQRZSHS5YTNU", "山西省/长治市/沁源县", "山西/长治/沁源", "Qinyuan", 36.500000, 112.330000},
-    {"WW23BS9T8PB1", "山西省/晋城市", "山西/晋城", "Jincheng", 35.489572, 112.875595},
-    {"WW23BS9T8PB1", "山西省/晋城市/城区", "山西/晋城/晋城", "Jincheng", 35.489572, 112.875595},
-    {"WQRFBXQGP6ND", "山西省/晋城市/沁水县", "山西/晋城/沁水", "Qinshui", 35.680000, 112.180000},
-    {"WQRCY4VTZZ7E", "山西省/晋城市/阳城县", "山西/晋城/阳城", "Yangcheng", 35.480000, 112.420000},
-    {"WW2E9989W73T", "山西省/晋城市/陵川县", "山西/晋城/陵川", "Lingchuan", 35.780000, 113.270000},
-    {"WW21ZW863X9U", "山西省/晋城市/泽州县", "山西/晋城/泽州", "Zezhou", 35.500000, 112.830000},
-    {"WW279T1Y4EWW", "山西省/晋城市/高平市", "山西/晋城/高平", "Gaoping", 35.800000, 112.920000},
-    {"WQZZWRV1BGKH", "山西省/朔州市", "山西/朔州/朔州", "Shuozhou", 39.330000, 112.430000},
-    {"WQZZWM9DTY1H", "山西省/朔州市/朔城区", "山西/朔州/朔城", "Shuocheng", 39.317784, 112.425404},
-    {"WRP8ZK5QCQ57", "山西省/朔州市/平鲁区", "山西/朔州/平鲁", "Pinglu", 39.530000, 112.120000},
-    {"WX00Z63H8TCQ", "山西省/朔州市/山阴县", "山西/朔州/山阴", "Shanyin", 39.520000, 112.820000},
-    {"WX02ZRZ5MNKG", "山西省/朔州市/应县", "山西/朔州/应县", "Yingxian", 39.550000, 113.180000},
-    {"WRPGRQ4HKUNM", "山西省/朔州市/右玉县", "山西/朔州/右玉", "Youyu", 39.980000, 112.470000},
-    {"WX06T4Y6DFPK", "山西省/朔州市/怀仁市", "山西/朔州/怀仁", "Huairen", 39.830000, 113.080000},
-    {"WW8NMEQJCMJE", "山西省/晋中市", "山西/晋中/晋中", "Jinzhong", 37.680000, 112.750000},
-    {"WW8NMWF7B000", "山西省/晋中市/榆次区", "山西/晋中/榆次", "Yuci", 37.698856, 112.744789},
-    {"WW86FSQHRUC7", "山西省/晋中市/榆社县", "山西/晋中/榆社", "Yushe", 37.070000, 112.970000},
-    {"WW8DGU3S2KZ5", "山西省/晋中市/左权县", "山西/晋中/左权", "Zuoquan", 37.070000, 113.370000},
-    {"WW8U27EPHB3G", "山西省/晋中市/和顺县", "山西/晋中/和顺", "Heshun", 37.330000, 113.570000},
-    {"WW8Y529B6H2C", "山西省/晋中市/昔阳县", "山西/晋中/昔阳", "Xiyang", 37.620000, 113.700000},
-    {"WW8RRRZ4VPUC", "山西省/晋中市/寿阳县", "山西/晋中/寿阳", "Shouyang", 37.880000, 113.180000},
-    {"WW8HCHH7M1DD", "山西省/晋中市/太谷县", "山西/晋中/太谷", "Taigu", 37.420000, 112.550000},
-    {"WQXUKPK5W8WU", "山西省/晋中市/祁县", "山西/晋中/祁县", "Qixian", 37.350000, 112.330000},
-    {"WQXG82RTNQQ4", "山西省/晋中市/平遥县", "山西/晋中/平遥", "Pingyao", 37.180000, 112.170000},
-    {"WQX3XKK6VCBS", "山西省/晋中市/灵石县", "山西/晋中/灵石", "Lingshi", 36.850000, 111.770000},
-    {"WQXDDV1EMH2D", "山西省/晋中市/介休市", "山西/晋中/介休", "Jiexiu", 37.030000, 111.920000},
-    {"WQNZJRJNM3JV", "山西省/运城市", "山西/运城/运城", "Yuncheng", 35.020000, 110.980000},
-    {"WQNZMBKZZMSR", "山西省/运城市/盐湖区", "山西/运城/盐湖", "Yanhu", 35.027149, 111.001713},
-    {"WQNZBWU784FT", "山西省/运城市/临猗县", "山西/运城/临猗", "Linyi", 35.150000, 110.770000},
-    {"WQQC9BPBQNTD", "山西省/运城市/万荣县", "山西/运城/万荣", "Wanrong", 35.420000, 110.830000},
-    {"WQR14G7BTVDG", "山西省/运城市/闻喜县", "山西/运城/闻喜", "Wenxi", 35.350000, 111.220000},
-    {"WQQFT0VCH2VR", "山西省/运城市/稷山县", "山西/运城/稷山", "Jishan", 35.600000, 110.970000},
-    {"WQR4DU7VTC6B", "山西省/运城市/新绛县", "山西/运城/新绛", "Xinjiang", 35.620000, 111.220000},
-    {"WQR3FFFVCRME", "山西省/运城市/绛县", "山西/运城/绛县", "Jiangxian", 35.480000, 111.570000},
-    {"WQR2V45T7SGN", "山西省/运城市/垣曲县", "山西/运城/垣曲", "Yuanqu", 35.300000, 111.670000},
-    {"WQPPFYGGTFFV", "山西省/运城市/夏县", "山西/运城/夏县", "Xiaxian", 35.150000, 111.220000},
-    {"WQPN4UEGMYDF", "山西省/运城市/平陆县", "山西/运城/平陆", "Pinglu", 34.830000, 111.220000},
-    {"WQNTQSFWNUVD", "山西省/运城市/芮城县", "山西/运城/芮城", "Ruicheng", 34.700000, 110.680000},
-    {"WQNW2TTQSRR8", "山西省/运城市/永济市", "山西/运城/永济", "Yongji", 34.880000, 110.420000},
-    {"WQQDX0C30BYX", "山西省/运城市/河津市", "山西/运城/河津", "Hejin", 35.600000, 110.700000},
-    {"WWB4T4PKXRH7", "山西省/忻州市", "山西/忻州/忻州", "Xinzhou", 38.420000, 112.730000},
-    {"WWB4MRNMS0C8", "山西省/忻州市/忻府区", "山西/忻州/忻府", "Xinfu", 38.403658, 112.739470},
-    {"WWB6FJPDJZBM", "山西省/忻州市/定襄县", "山西/忻州/定襄", "Dingxiang", 38.480000, 112.950000},
-    {"WWBS34D4S729", "山西省/忻州市/五台县", "山西/忻州/五台县", "Wutaixian", 38.730000, 113.250000},
-    {"WWBQ60RXJZBK", "山西省/忻州市/代县", "山西/忻州/代县", "Daixian", 39.070000, 112.950000},
-    {"WWBWCHD0H32E", "山西省/忻州市/繁峙县", "山西/忻州/繁峙", "Fanshi", 39.180000, 113.250000},
-    {"WQZVG7WR7WVJ", "山西省/忻州市/宁武县", "山西/忻州/宁武", "Ningwu", 39.000000, 112.300000},
-    {"WQZD710CQN3J", "山西省/忻州市/静乐县", "山西/忻州/静乐", "Jingle", 38.370000, 111.930000},
-    {"WQZY34M992PB", "山西省/忻州市/神池县", "山西/忻州/神池", "Shenchi", 39.080000, 112.200000},
-    {"WQZT31W8VVSF", "山西省/忻州市/五寨县", "山西/忻州/五寨", "Wuzhai", 38.900000, 111.850000},
-    {"WQZK4V4GC6VS", "山西省/忻州市/岢岚县", "山西/忻州/岢岚", "Kelan", 38.700000, 111.570000},
-    {"WRP00BFMHSJF", "山西省/忻州市/河曲县", "山西/忻州/河曲", "Hequ", 39.380000, 111.130000},
-    {"WQYBPZT229EC", "山西省/忻州市/保德县", "山西/忻州/保德", "Baode", 39.022488, 111.086564},
-    {"WRP234PB6K9Z", "山西省/忻州市/偏关县", "山西/忻州/偏关", "Pianguan", 39.430000, 111.500000},
-    {"WWBHKD9DS76C", "山西省/忻州市/原平市", "山西/忻州/原平", "Yuanping", 38.730000, 112.700000},
-    {"WQRM38NMHR7P", "山西省/临汾市", "山西/临汾/临汾", "Linfen", 36.080000, 111.520000},
-    {"WQRM4ZVRFJJK", "山西省/临汾市/尧都区", "山西/临汾/尧都", "Yaodou", 36.079086, 111.573465},
-    {"WQR68W1ZZ32K", "山西省/临汾市/曲沃县", "山西/临汾/曲沃", "Quwo", 35.630000, 111.470000},
-    {"WQR7Q22N2DVB", "山西省/临汾市/翼城县", "山西/临汾/翼城", "Yicheng", 35.730000, 111.720000},
-    {"WQRHPEUB5HY0", "山西省/临汾市/襄汾县", "山西/临汾/襄汾", "Xiangfen", 35.880000, 111.430000},
-    {"WQRQJP5EE9G0", "山西省/临汾市/洪洞县", "山西/临汾/洪洞", "Hongtong", 36.250000, 111.670000},
-    {"WQRW6FC8J409", "山西省/临汾市/古县", "山西/临汾/古县", "Guxian", 36.270000, 111.920000},
-    {"WQRVDKCVN86M", "山西省/临汾市/安泽县", "山西/临汾/安泽", "Anze", 36.150000, 112.250000},
-    {"WQRS8U0H7VGZ", "山西省/临汾市/浮山县", "山西/临汾/浮山", "Fushan", 35.970000, 111.830000},
-    {"WQQTQEF9WZV8", "山西省/临汾市/吉县", "山西/临汾/吉县", "Jixian", 36.100000, 110.680000},
-    {"WQQU9UPUQJVX", "山西省/临汾市/乡宁县", "山西/临汾/乡宁", "Xiangning", 35.970000, 110.830000},
-    {"WQQZ2PJTNHC2", "山西省/临汾市/大宁县", "山西/临汾/大宁", "Daning", 36.470000, 110.750000},
-    {"WQWBU30BBRG5", "山西省/临汾市/隰县", "山西/临汾/隰县", "Xixian", 36.700000, 110.930000},
-    {"WQW9JMY2CBFC", "山西省/临汾市/永和县", "山西/临汾/永和", "Yonghe", 36.770000, 110.630000},
-    {"WQQZPWJCZS56", "山西省/临汾市/蒲县", "山西/临汾/蒲县", "Puxian", 36.420000, 111.080000},
-    {"WQX26ZFV9RJT", "山西省/临汾市/汾西县", "山西/临汾/汾西", "Fenxi", 36.650000, 111.570000},
-    {"WQR4TU6TE13B", "山西省/临汾市/侯马市", "山西/临汾/侯马", "Houma", 35.620000, 111.350000},
-    {"WQX2N3258WJG", "山西省/临汾市/霍州市", "山西/临汾/霍州", "Huozhou", 36.570000, 111.720000},
-    {"WQXJ2UGJEGPU", "山西省/吕梁市", "山西/吕梁/吕梁", "Lvliang", 37.512405, 111.131000},
-    {"WQXJ2Y63UDVV", "山西省/吕梁市/离石区", "山西/吕梁/离石", "Lishi", 37.520000, 111.130000},
-    {"WQXSVJFMX1WP", "山西省/吕梁市/文水县", "山西/吕梁/文水", "Wenshui", 37.430000, 112.020000},
-    {"WQXV85C0S7M4", "山西省/吕梁市/交城县", "山西/吕梁/交城", "Jiaocheng", 37.550000, 112.150000},
-    {"WQZ4BE5PGXV2", "山西省/吕梁市/兴县", "山西/吕梁/兴县", "Xingxian", 38.470000, 111.120000},
-    {"WQWZVKT4V2TZ", "山西省/吕梁市/临县", "山西/吕梁/临县", "Linxian", 37.950000, 110.980000},
-    {"WQWUGTFVT39X", "山西省/吕梁市/柳林县", "山西/吕梁/柳林", "Liulin", 37.430000, 110.900000},
-    {"WQWF3ZXUW5VT", "山西省/吕梁市/石楼县", "山西/吕梁/石楼", "Shilou", 37.000000, 110.830000},
-    {"WQZ3V0ET5T5N", "山西省/吕梁市/岚县", "山西/吕梁/岚县", "Lanxian", 38.280000, 111.670000},
-    {"WQXP7PG4YZG3", "山西省/吕梁市/方山县", "山西/吕梁/方山", "Fangshan", 37.880000, 111.230000},
-    {"WQXH3GWZ1B2E", "山西省/吕梁市/中阳县", "山西/吕梁/中阳", "Zhongyang", 37.330000, 111.180000},
-    {"WQX466JMGG98", "山西省/吕梁市/交口县", "山西/吕梁/交口", "Jiaokou", 36.970000, 111.200000},
-    {"WQX7R6UQMVBW", "山西省/吕梁市/孝义市", "山西/吕梁/孝义", "Xiaoyi", 37.150000, 111.770000},
-    {"WQXKP8G9QZ91", "山西省/吕梁市/汾阳市", "山西/吕梁/汾阳", "Fenyang", 37.270000, 111.780000},
-    {"WRR2Q2Z7CXWM", "内蒙古自治区/呼和浩特市", "内蒙古/呼和浩特/呼和浩特", "Huhehaote", 40.830000, 111.730000},
-    {"WRR2KVG2VVPD", "内蒙古自治区/呼和浩特市/新城区", "内蒙古/呼和浩特/新城", "Xincheng", 40.856937, 111.658773},
-    {"WRR25UV015EU", "内蒙古自治区/呼和浩特市/回民区", "内蒙古/呼和浩特/回民", "Huimin", 40.807362, 111.617022},
-    {"WRPRV49XB01Z", "内蒙古自治区/呼和浩特市/玉泉区", "内蒙古/呼和浩特/玉泉", "Yuquan", 40.752369, 111.667102},
-    {"WRR2J9TZ4PWB", "内蒙古自治区/呼和浩特市/赛罕区", "内蒙古/呼和浩特/赛罕", "Saihan", 40.790732, 111.695003},
-    {"WRPP8UF7HWJV", "内蒙古自治区/呼和浩特市/土默特左旗", "内蒙古/呼和浩特/土左旗", "Tuzuoqi", 40.720000, 111.130000},
-    {"WRPJ1FYVCB0D", "内蒙古自治区/呼和浩特市/托克托县", "内蒙古/呼和浩特/托县", "Tuoxian", 40.270000, 111.180000},
-    {"WRPT8WBYDCE4", "内蒙古自治区/呼和浩特市/和林格尔县", "内蒙古/呼和浩特/和林", "Helin", 40.380000, 111.820000},
-    {"WRP7J74YUE7E", "内蒙古自治区/呼和浩特市/清水河县", "内蒙古/呼和浩特/清水河", "Qingshuihe", 39.920000, 111.680000},
-    {"WRR38N7KM5P3", "内蒙古自治区/呼和浩特市/武川县", "内蒙古/呼和浩特/武川", "Wuchuan", 41.080000, 111.450000},
-    {"WRNP70PG2MPX", "内蒙古自治区/包头市", "内蒙古/包头/包头", "Baotou", 40.650000, 109.830000},
-    {"WRNNZFRK4QU1", "内蒙古自治区/包头市/东河区", "内蒙古/包头/东河", "Donghe", 40.574606, 110.038134},
-    {"WRNP5Q3XD0CZ", "内蒙古自治区/包头市/昆都仑区", "内蒙古/包头/昆都仑", "Kundoulun", 40.641094, 109.832470},
-    {"WRNPHWXVC6JX", "内蒙古自治区/包头市/青山区", "内蒙古/包头/青山", "Qingshan", 40.642173, 109.895958},
-    {"WRNRM5VSXDT8", "内蒙古自治区/包头市/石拐区", "内蒙古/包头/石拐", "Shiguai", 40.670799, 110.266672},
-    {"WRQJVB46BMM3", "内蒙古自治区/包头市/白云鄂博矿区", "内蒙古/包头/白云鄂博", "Baiyunebo", 41.792493, 109.943293},
-    {"WRNNYQBHVKJV", "内蒙古自治区/包头市/九原区", "内蒙古/包头/九原", "Jiuyuan", 40.599440, 109.962391},
-    {"WRNWFCW1QSHU", "内蒙古自治区/包头市/土默特右旗", "内蒙古/包头/土右旗", "Tuyouqi", 40.570000, 110.520000},
-    {"WRQ32JRCNF7E", "内蒙古自治区/包头市/固阳县", "内蒙古/包头/固阳", "Guyang", 41.030000, 110.050000},
-    {"WRQQZ7FJ2MU1", "内蒙古自治区/包头市/达尔罕茂明安联合旗", "内蒙古/包头/达茂旗", "Damaoqi", 41.989305, 110.360429},
-    {"WR5CWTXYQRVP", "内蒙古自治区/乌海市", "内蒙古/乌海/乌海", "Wuhai", 39.670000, 106.820000},
-    {"WR5CY9QS9051", "内蒙古自治区/乌海市/海勃湾区", "内蒙古/乌海/海勃湾", "Haibowan", 39.690256, 106.818055},
-    {"WRH027BW6C3P", "内蒙古自治区/乌海市/海南区", "内蒙古/乌海/海南", "Hainan", 39.440626, 106.886792},
-    {"WR5BSX8JK31B", "内蒙古自治区/乌海市/乌达区", "内蒙古/乌海/乌达", "Wuda", 39.504996, 106.721376},
-    {"WXS86P4BSG4G", "内蒙古自治区/赤峰市", "内蒙古/赤峰/赤峰", "Chifeng", 42.270000, 118.920000},
-    {"WXS8DG25QSRP", "内蒙古自治区/赤峰市/红山区", "内蒙古/赤峰/红山", "Hongshan", 42.293825, 118.949263},
-    {"WXKZ4KD9EVGY", "内蒙古自治区/赤峰市/元宝山区", "内蒙古/赤峰/元宝山", "Yuanbaoshan", 42.036727, 119.282164},
-    {"WXS8D1XPE0CR", "内蒙古自治区/赤峰市/松山区", "内蒙古/赤峰/松山", "Songshan", 42.284923, 118.925759},
-    {"WXV3SKPEDBCE", "内蒙古自治区/赤峰市/阿鲁科尔沁旗", "内蒙古/赤峰/阿鲁旗", "Aluqi", 43.880000, 120.080000},
-    {"WXUFHW3F5D5Y", "内蒙古自治区/赤峰市/巴林左旗", "内蒙古/赤峰/巴林左旗", "Balinzuoqi", 43.980000, 119.380000},
-    {"WXSRS6SF7KJ2", "内蒙古自治区/赤峰市/巴林右旗", "内蒙古/赤峰/巴林右旗", "Balinyouqi", 43.520000, 118.670000},
-    {"WXGBN31KKM5F", "内蒙古自治区/赤峰市/林西县", "内蒙古/赤峰/林西", "Linxi", 43.600000, 118.050000},
-    {"WXEW1QFK62V0", "内蒙古自治区/赤峰市/克什克腾旗", "内蒙古/赤峰/克什克腾", "Keshiketeng", 43.280000, 117.480000},
-    {"WXSU6GNH7E1G", "内蒙古自治区/赤峰市/翁牛特旗", "内蒙古/赤峰/翁牛特", "Wengniute", 42.951796, 119.308930},
-    {"WXKQMGUUKTYV", "内蒙古自治区/赤峰市/喀喇沁旗", "内蒙古/赤峰/喀喇沁", "Kalaqin", 41.901243, 118.735974},
-    {"WXKUEMJ3WD11", "内蒙古自治区/赤峰市/宁城县", "内蒙古/赤峰/宁城", "Ningcheng", 41.600000, 119.330000},
-    {"WXT0XSQXM7W2", "内蒙古自治区/赤峰市/敖汉旗", "内蒙古/赤峰/敖汉", "Aohan", 42.300000, 119.870000},
-    {"WXYBNKF2CT25", "内蒙古自治区/通辽市", "内蒙古/通辽/通辽", "Tongliao", 43.620000, 122.270000},
-    {"Y8N2K43REK6R", "内蒙古自治区/通辽市/科尔沁区", "内蒙古/通辽/科尔沁", "Keerqin", 45.057616, 121.466703},
-    {"WXZEN1WGUK0Z", "内蒙古自治区/通辽市/科尔沁左翼中旗", "内蒙古/通辽/科左中旗", "Kezuozhongqi", 44.130000, 123.320000},
-    {"WXXH24U9CSK3", "内蒙古自治区/通辽市/科尔沁左翼后旗", "内蒙古/通辽/科左后旗", "Kezuohouqi", 42.950000, 122.350000},
-    {"WXY201PUQV5D", "内蒙古自治区/通辽市/开鲁县", "内蒙古/通辽/开鲁", "Kailu", 43.600000, 121.300000},
-    {"WXWE4FY0Q9KF", "内蒙古自治区/通辽市/库伦旗", "内蒙古/通辽/库伦", "Kulun", 42.730000, 121.770000},
-    {"WXTGC2WEKFBQ", "内蒙古自治区/通辽市/奈曼旗", "内蒙古/通辽/奈曼", "Naiman", 42.850000, 120.650000},
-    {"WXVVQQNFE1UM", "内蒙古自治区/通辽市/扎鲁特旗", "内蒙古/通辽/扎鲁特", "Zhalute", 44.550000, 120.870000},
-    {"Y8J548QRRP4M", "内蒙古自治区/通辽市/霍林郭勒市", "内蒙古/通辽/霍林郭勒", "Huolinguole", 45.530000, 119.650000},
-    {"WRN16S9GJRQ1", "内蒙古自治区/鄂尔多斯市", "内蒙古/鄂尔多斯/鄂尔多斯", "Eerduosi", 39.620000, 109.800000},
-    {"WRN4X1583F0B", "内蒙古自治区/鄂尔多斯市/东胜区", "内蒙古/鄂尔多斯/东胜", "Dongsheng", 39.820000, 110.000000},
-    {"WRN17F23YKG3", "内蒙古自治区/鄂尔多斯市/康巴什区", "内蒙古/鄂尔多斯/康巴什", "Kangbashi", 39.607412, 109.852911},
-    {"WRNJZW4PEF1G", "内蒙古自治区/鄂尔多斯市/达拉特旗", "内蒙古/鄂尔多斯/达拉特", "Dalate", 40.420000, 110.020000},
-    {"WRP18ZD2U8JG", "内蒙古自治区/鄂尔多斯市/准格尔旗", "内蒙古/鄂尔多斯/准格尔", "Zhungeer", 39.680000, 111.130000},
-    {"WQU3QRRWBSHK", "内蒙古自治区/鄂尔多斯市/鄂托克前旗", "内蒙古/鄂尔多斯/鄂前旗", "Eqianqi", 38.229483, 107.511548},
-    {"WQUY8CT6E2E1", "内蒙古自治区/鄂尔多斯市/鄂托克旗", "内蒙古/鄂尔多斯/鄂托克", "Etuoke", 39.120000, 107.970000},
-    {"WRJ69FZ6XD5S", "内蒙古自治区/鄂尔多斯市/杭锦旗", "内蒙古/鄂尔多斯/杭锦旗", "Hangjinqi", 39.830000, 108.720000},
-    {"WQV7SFYJKCD8", "内蒙古自治区/鄂尔多斯市/乌审旗", "内蒙古/鄂尔多斯/乌审旗", "Wushenqi", 38.600000, 108.850000},
-    {"WQYP3CHPF6K3", "内蒙古自治区/鄂尔多斯市/伊金霍洛旗", "内蒙古/鄂尔多斯/伊金霍洛", "Yijinhuoluo", 39.250000, 109.770000},
-    {"Y8TPTQNF5V3X", "内蒙古自治区/呼伦贝尔市", "内蒙古/内蒙古/呼伦贝尔", "Hulunbeier", 49.164191, 119.771396},
-    {"Y8V0J2JZ730B", "内蒙古自治区/呼伦贝尔市/海拉尔区", "内蒙古/呼伦贝尔/海拉尔", "Hailaer", 49.220000, 119.770000},
-    {"Y8G9TKZ0EY3K", "内蒙古自治区/呼伦贝尔市/扎赉诺尔区", "内蒙古/呼伦贝尔/扎赉诺尔", "Zhalainuoer", 49.508634, 117.662364},
-    {"Y8XCC9U1ED2C", "内蒙古自治区/呼伦贝尔市/阿荣旗", "内蒙古/呼伦贝尔/阿荣旗", "Arongqi", 48.130000, 123.470000},
-    {"YB8E9PDNHQBS", "内蒙古自治区/呼伦贝尔市/莫力达瓦达斡尔族自治旗", "内蒙古/呼伦贝尔/莫力达瓦", "Molidawa", 48.470000, 124.500000},
-    {"YBBJGD9F14VV", "内蒙古自治区/呼伦贝尔市/鄂伦春自治旗", "内蒙古/呼伦贝尔/鄂伦春旗", "Elunchunqi", 50.243584, 123.906262},
-    {"Y8T76RN47M5Q", "内蒙古自治区/呼伦贝尔市/鄂温克族自治旗", "内蒙古/呼伦贝尔/鄂温克旗", "Ewenkeqi", 48.422655, 119.990073},
-    {"Y8V1S4ZDQ3WD", "内蒙古自治区/呼伦贝尔市/陈巴尔虎旗", "内蒙古/呼伦贝尔/陈旗", "Chenqi", 49.497923, 119.717608},
-    {"Y8SS1PUGYH77", "内蒙古自治区/呼伦贝尔市/新巴尔虎左旗", "内蒙古/呼伦贝尔/新左旗", "Xinzuoqi", 48.558864, 118.878855},
-    {"Y8DVQFRGVYH1", "内蒙古自治区/呼伦贝尔市/新巴尔虎右旗", "内蒙古/呼伦贝尔/新右旗", "Xinyouqi", 48.748387, 116.674714},
-    {"Y8GD09U2RMGS", "内蒙古自治区/呼伦贝尔市/满洲里市", "内蒙古/呼伦贝尔/满洲里", "Manzhouli", 49.580000, 117.450000},
-    {"Y8VB770UUCUF", "内蒙古自治区/呼伦贝尔市/牙克石市", "内蒙古/呼伦贝尔/牙克石", "Yakeshi", 49.280000, 120.730000},
-    {"Y8X2CNRZF23B", "内蒙古自治区/呼伦贝尔市/扎兰屯市", "内蒙古/呼伦贝尔/扎兰屯", "Zhalantun", 47.980000, 122.750000},
-    {"Y8VMYB06UYXJ", "内蒙古自治区/呼伦贝尔市/额尔古纳市", "内蒙古/呼伦贝尔/额尔古纳", "Eerguna", 50.230000, 120.180000},
-    {"Y9N2VK0NVNP7", "内蒙古自治区/呼伦贝尔市/根河市", "内蒙古/呼伦贝尔/根河", "Genhe", 50.780000, 121.520000},
-    {"WRHRG8C39PEC", "内蒙古自治区/巴彦淖尔市", "内蒙古/内蒙古/巴彦淖尔", "Bayanzhuor", 40.741723, 107.382136},
-    {"WRHRGFQ3CQS6", "内蒙古自治区/巴彦淖尔市/临河区", "内蒙古/巴彦淖尔/临河", "Linhe", 40.750000, 107.400000},
-    {"WRKCZDPBCG73", "内蒙古自治区/巴彦淖尔市/五原县", "内蒙古/巴彦淖尔/五原", "Wuyuan", 41.100000, 108.270000},
-    {"WRHJ7MCE68ZU", "内蒙古自治区/巴彦淖尔市/磴口县", "内蒙古/巴彦淖尔/磴口", "Dengkou", 40.330000, 107.020000},
-    {"WRJR8KUE0QPV", "内蒙古自治区/巴彦淖尔市/乌拉特前旗", "内蒙古/巴彦淖尔/乌前旗", "Wuqianqi", 40.720000, 108.650000},
-    {"WRMHMRTFG38V", "内蒙古自治区/巴彦淖尔市/乌拉特中旗", "内蒙古/巴彦淖尔/乌中旗", "Wuzhongqi", 41.570000, 108.520000},
-    {"WRK1U6JBZG69", "内蒙古自治区/巴彦淖尔市/乌拉特后旗", "内蒙古/巴彦淖尔/乌后旗", "Wuhouqi", 41.100000, 107.070000},
-    {"WRK0W3BPRBQF", "内蒙古自治区/巴彦淖尔市/杭锦后旗", "内蒙古/巴彦淖尔/杭锦后旗", "Hangjinhouqi", 40.880000, 107.150000},
-    {"WX23NNWFJD1D", "内蒙古自治区/乌兰察布市", "内蒙古/内蒙古/乌兰察布", "Wulanchabu", 40.993091, 113.124742},
-    {"WX23MTKCJ427", "内蒙古自治区/乌兰察布市/集宁区", "内蒙古/乌兰察布/集宁", "Jining", 41.030000, 113.100000},
-    {"WX209TDGZ0EG", "内蒙古自治区/乌兰察布市/卓资县", "内蒙古/乌兰察布/卓资", "Zhuozi", 40.900000, 112.570000},
-    {"WX3N65SM0W15", "内蒙古自治区/乌兰察布市/化德县", "内蒙古/乌兰察布/化德", "Huade", 41.900000, 114.000000},
-    {"WX2SR7YN29RS", "内蒙古自治区/乌兰察布市/商都县", "内蒙古/乌兰察布/商都", "Shangdu", 41.550000, 113.530000},
-    {"WX2BX3UZK26D", "内蒙古自治区/乌兰察布市/兴和县", "内蒙古/乌兰察布/兴和", "Xinghe", 40.880000, 113.880000},
-    {"WRPYXD32MGWG", "内蒙古自治区/乌兰察布市/凉城县", "内蒙古/乌兰察布/凉城", "Liangcheng", 40.530000, 112.480000},
-    {"WX0XBRU29NYZ", "内蒙古自治区/乌兰察布市/察哈尔右翼前旗", "内蒙古/乌兰察布/察右前旗", "Chayouqianqi", 40.780000, 113.220000},
-    {"WX24FBYXJJX5", "内蒙古自治区/乌兰察布市/察哈尔右翼中旗", "内蒙古/乌兰察布/察右中旗", "Chayouzhongqi", 41.270000, 112.630000},
-    {"WX27Z3XPV0HC", "内蒙古自治区/乌兰察布市/察哈尔右翼后旗", "内蒙古/乌兰察布/察右后旗", "Chayouhouqi", 41.450000, 113.180000},
-    {"WRRKJY3RW8UZ", "内蒙古自治区/乌兰察布市/四子王旗", "内蒙古/乌兰察布/四子王旗", "Siziwangqi", 41.520000, 111.700000},
-    {"WX0QNB13F470", "内蒙古自治区/乌兰察布市/丰镇市", "内蒙古/乌兰察布/丰镇", "Fengzhen", 40.430000, 113.150000},
-    {"Y8NY1ECCRVK4", "内蒙古自治区/兴安盟", "内蒙古/兴安盟/兴安", "Xingan", 46.075530, 122.060847},
-    {"Y8NY1KD57NS4", "内蒙古自治区/兴安盟/乌兰浩特市", "内蒙古/兴安盟/乌兰浩特", "Wulanhaote", 46.080000, 122.050000},
-    {"Y8MK3HF77T3W", "内蒙古自治区/兴安盟/阿尔山市", "内蒙古/兴安盟/阿尔山", "Aershan", 47.180000, 119.930000},
-    {"Y8NWN6G3JYMN", "内蒙古自治区/兴安盟/科尔沁右翼前旗", "内蒙古/兴安盟/科右前旗", "Keyouqianqi", 46.070000, 121.920000},
-    {"Y8N2K15G20SV", "内蒙古自治区/兴安盟/科尔沁右翼中旗", "内蒙古/兴安盟/科右中旗", "Keyouzhongqi", 45.050000, 121.470000},
-    {"Y8R3UDVJCX65", "内蒙古自治区/兴安盟/扎赉特旗", "内蒙古/兴安盟/扎赉特", "Zhalaite", 46.730000, 122.900000},
-    {"Y8N6NMHTDM4H", "内蒙古自治区/兴安盟/突泉县", "内蒙古/兴安盟/突泉", "Tuquan", 45.380000, 121.570000},
-    {"WXF9BT6Y0JY4", "内蒙古自治区/锡林郭勒盟", "内蒙古/内蒙古/锡林郭勒", "Xilinguole", 43.931267, 116.041382},
-    {"WRZ8K4JREJGB", "内蒙古自治区/锡林郭勒盟/二连浩特市", "内蒙古/锡林郭勒/二连浩特", "Erlianhaote", 43.650000, 111.980000},
-    {"WXF9CJPWG18C", "内蒙古自治区/锡林郭勒盟/锡林浩特市", "内蒙古/锡林郭勒/锡林浩特", "Xilinhaote", 43.930000, 116.070000},
-    {"WXCF2PQT74VK", "内蒙古自治区/锡林郭勒盟/阿巴嘎旗", "内蒙古/锡林郭勒/阿巴嘎", "Abaga", 44.030000, 114.970000},
-    {"WXBC3WWUFBMN", "内蒙古自治区/锡林郭勒盟/苏尼特左旗", "内蒙古/锡林郭勒/苏左旗", "Suzuoqi", 43.850000, 113.630000},
-    {"WX855QMHZ385", "内蒙古自治区/锡林郭勒盟/苏尼特右旗", "内蒙古/锡林郭勒/苏右旗", "Suyouqi", 42.750000, 112.650000},
-    {"Y854VWWVNX18", "内蒙古自治区/锡林郭勒盟/东乌珠穆沁旗", "内蒙古/锡林郭勒/东乌旗", "Dongwuqi", 45.520000, 116.970000},
-    {"WXGTS599QD7D", "内蒙古自治区/锡林郭勒盟/西乌珠穆沁旗", "内蒙古/锡林郭勒/西乌旗", "Xiwuqi", 44.580000, 117.600000},
-    {"WX3YREWVHWP7", "内蒙古自治区/锡林郭勒盟/太仆寺旗", "内蒙古/锡林郭勒/太仆寺", "Taibusiqi", 41.900000, 115.300000},
-    {"WX8BNR8RX4XF", "内蒙古自治区/锡林郭勒盟/镶黄旗", "内蒙古/锡林郭勒/镶黄旗", "Xianghuang", 42.230000, 113.830000},
-    {"WX9B8UKRQ5X0", "内蒙古自治区/锡林郭勒盟/正镶白旗", "内蒙古/锡林郭勒/正镶白旗", "Zhengxiangbaiqi", 42.300000, 115.000000},
-    {"WXD2REKS5FV5", "内蒙古自治区/锡林郭勒盟/正蓝旗", "内蒙古/锡林郭勒/正蓝旗", "Zhenglanqi", 42.250000, 116.000000},
-    {"WX6ZFQDU79YS", "内蒙古自治区/锡林郭勒盟/多伦县", "内蒙古/锡林郭勒/多伦", "Duolun", 42.180000, 116.470000},
-    {"WQGJJBDMKH1Z", "内蒙古自治区/阿拉善盟", "内蒙古/阿拉善盟/阿拉善", "Alashanmeng", 38.851327, 105.724700},
-    {"WQGHUSF91KWU", "内蒙古自治区/阿拉善盟/阿拉善左旗", "内蒙古/阿拉善盟/阿左旗", "Azuoqi", 38.830000, 105.670000},
-    {"WQBR1B1HE9XH", "内蒙古自治区/阿拉善盟/阿拉善右旗", "内蒙古/阿拉善盟/阿右旗", "Ayouqi", 39.200000, 101.680000},
-    {"WPRWREDT4QH5", "内蒙古自治区/阿拉善盟/额济纳旗", "内蒙古/阿拉善盟/额济纳", "Ejina", 41.900000, 100.880000},
-    {"WXRVB9QYXKY8", "辽宁省/沈阳市", "辽宁/沈阳/沈阳", "Shenyang", 41.800000, 123.430000},
-    {"WXRV8R5T04M6", "辽宁省/沈阳市/和平区", "辽宁/沈阳/和平", "Heping", 41.787370, 123.414237},
-    {"WXRVC0PX7PW6", "辽宁省/沈阳市/沈河区", "辽宁/沈阳/沈河", "Shenhe", 41.793277, 123.452820},
-    {"WXRVC3ZWVKNY", "辽宁省/沈阳市/大东区", "辽宁/沈阳/大东", "Dadong", 41.802787, 123.463903},
-    {"WXRVBVE1P9RF", "辽宁省/沈阳市/皇姑区", "辽宁/沈阳/皇姑", "Huanggu", 41.822383, 123.435849},
-    {"WXRTZ3E3MWSD", "辽宁省/沈阳市/铁西区", "辽宁/沈阳/铁西", "Tiexi", 41.800482, 123.370184},
-    {"WXRTN8KHBPBG", "辽宁省/沈阳市/苏家屯区", "辽宁/沈阳/苏家屯", "Sujiatun", 41.662387, 123.338014},
-    {"WXRV318CHCYF", "辽宁省/沈阳市/浑南区", "辽宁/沈阳/浑南", "Hunnan", 41.712523, 123.443626},
-    {"WXRZ4WVR9X2Z", "辽宁省/沈阳市/沈北新区", "辽宁/沈阳/沈北新区", "Shenbeixinqu", 42.050125, 123.515576},
-    {"WXRTTZCUTWXC", "辽宁省/沈阳市/于洪区", "辽宁/沈阳/于洪", "Yuhong", 41.791427, 123.302211},
-    {"WXRK0W3ZX2BR", "辽宁省/沈阳市/辽中区", "辽宁/沈阳/辽中", "Liaozhong", 41.520000, 122.720000},
-    {"WXXENYKSZ3D7", "辽宁省/沈阳市/康平县", "辽宁/沈阳/康平", "Kangping", 42.750000, 123.350000},
-    {"WXXCB0CHKQJP", "辽宁省/沈阳市/法库县", "辽宁/沈阳/法库", "Faku", 42.500000, 123.400000},
-    {"WXRQFVFG9RMW", "辽宁省/沈阳市/新民市", "辽宁/沈阳/新民", "Xinmin", 42.000000, 122.820000},
-    {"WWYMRT0VRMUG", "辽宁省/大连市", "辽宁/大连/大连", "Dalian", 38.920000, 121.620000},
-    {"WWYMRUZ825SR", "辽宁省/大连市/中山区", "辽宁/大连/中山", "Zhongshan", 38.917757, 121.639944},
-    {"WWYMRHPCCQV0", "辽宁省/大连市/西岗区", "辽宁/大连/西岗", "Xigang", 38.913911, 121.607383},
-    {"WWYMQF687P5G", "辽宁省/大连市/沙河口区", "辽宁/大连/沙河口", "Shahekou", 38.904042, 121.589260},
-    {"WWYMT706MWWC", "辽宁省/大连市/甘井子区", "辽宁/大连/甘井子", "Ganjingzi", 38.952448, 121.520364},
-    {"WWYHZDFNGU9B", "辽宁省/大连市/旅顺口区", "辽宁/大连/旅顺", "Lvshun", 38.820000, 121.270000},
-    {"WWYW3MGNP831", "辽宁省/大连市/金州区", "辽宁/大连/金州", "Jinzhou", 39.100000, 121.700000},
-    {"WXN8PH938UQD", "辽宁省/大连市/普兰店区", "辽宁/大连/普兰店", "Pulandian", 39.400000, 121.950000},
-    {"WWZPMKUH348F", "辽宁省/大连市/长海县", "辽宁/大连/长海", "Changhai", 39.270000, 122.580000},
-    {"WXNC2HTENP33", "辽宁省/大连市/瓦房店市", "辽宁/大连/瓦房店", "Wafangdian", 39.620000, 122.000000},
-    {"WXP3Y7PM38QK", "辽宁省/大连市/庄河市", "辽宁/大连/庄河", "Zhuanghe", 39.700000, 122.980000},
-    {"WXR3Y6P2CEQ3", "辽宁省/鞍山市", "辽宁/鞍山/鞍山", "Anshan", 41.100000, 122.980000},
-    {"WXR3WXG75MXF", "辽宁省/鞍山市/铁东区", "辽宁/鞍山/铁东", "Tiedong", 41.088039, 122.985570},
-    {"WXR3YJ7CFEBU", "辽宁省/鞍山市/铁西区", "辽宁/鞍山/铁西", "Tiexi", 41.118027, 122.964242},
-    {"WXR6P6YFMX3P", "辽宁省/鞍山市/立山区", "辽宁/鞍山/立山", "Lishan", 41.148345, 123.023423},
-    {"WXR3TSJ16Y0M", "辽宁省/鞍山市/千山区", "辽宁/鞍山/千山", "Qianshan", 41.067142, 122.943997},
-    {"WXR53SZXBZ04", "辽宁省/鞍山市/台安县", "辽宁/鞍山/台安", "Taian", 41.380000, 122.420000},
-    {"WXPTJKCB00NX", "辽宁省/鞍山市/岫岩满族自治县", "辽宁/鞍山/岫岩", "Xiuyan", 40.280000, 123.280000},
-    {"WXR281GRM0R6", "辽宁省/鞍山市/海城市", "辽宁/鞍山/海城", "Haicheng", 40.880000, 122.700000},
-    {"WZ2NM0P2XMU7", "辽宁省/抚顺市", "辽宁/抚顺", "Fushun", 41.880000, 123.980000},
-    {"WZ2N5S6KN57F", "辽宁省/抚顺市/新抚区", "辽宁/抚顺/新抚", "Xinfu", 41.859988, 123.907161},
-    {"WZ2NN6TY9GD5", "辽宁省/抚顺市/东洲区", "辽宁/抚顺/东洲", "Dongzhou", 41.850806, 124.032632},
-    {"WZ2N0DUD49TM", "辽宁省/抚顺市/望花区", "辽宁/抚顺/望花", "Wanghua", 41.851396, 123.778267},
-    {"WZ2NK21ZFVU4", "辽宁省/抚顺市/顺城区", "辽宁/抚顺/顺城", "Shuncheng", 41.881244, 123.939295},
-    {"WZ2NM0P2XMU7", "辽宁省/抚顺市/抚顺县", "辽宁/抚顺/抚顺", "Fushun", 41.880000, 123.980000},
-    {"WZ2VMHSNF5V4", "辽宁省/抚顺市/新宾满族自治县", "辽宁/抚顺/新宾", "Xinbin", 41.730000, 125.030000},
-    {"WZ2ZD85FQBZ4", "辽宁省/抚顺市/清原满族自治县", "辽宁/抚顺/清原", "Qingyuan", 42.100000, 124.920000},
-    {"WZ24BQQTFN10", "辽宁省/本溪市", "辽宁/本溪/本溪", "Benxi", 41.300000, 123.770000},
-    {"WZ24BQ12PBKE", "辽宁省/本溪市/平山区", "辽宁/本溪/平山", "Pingshan", 41.297609, 123.763042},
-    {"WZ25072ECFZP", "辽宁省/本溪市/溪湖区", "辽宁/本溪/溪湖", "Xihu", 41.327106, 123.761758},
-    {"WZ24CRSSZ4XW", "辽宁省/本溪市/明山区", "辽宁/本溪/明山", "Mingshan", 41.306677, 123.811422},
-    {"WXRCZ9ZBN5KC", "辽宁省/本溪市/南芬区", "辽宁/本溪/南芬", "Nanfen", 41.098498, 123.738934},
-    {"WZ263DV24Y4T", "辽宁省/本溪市/本溪满族自治县", "辽宁/本溪/本溪县", "Benxixian", 41.191897, 124.174812},
-    {"WZ34U2VP4TW7", "辽宁省/本溪市/桓仁满族自治县", "辽宁/本溪/桓仁", "Huanren", 41.270000, 125.350000},
-    {"WZ0KQ36Y0N4N", "辽宁省/丹东市", "辽宁/丹东/丹东", "Dandong", 40.130000, 124.380000},
-    {"WZ0KQD3FZ5SH", "辽宁省/丹东市/元宝区", "辽宁/丹东/元宝", "Yuanbao", 40.134921, 124.389916},
-    {"WZ0KJU8HT4GY", "辽宁省/丹东市/振兴区", "辽宁/丹东/振兴", "Zhenxing", 40.103633, 124.354468},
-    {"WZ0KRQ39DEES", "辽宁省/丹东市/振安区", "辽宁/丹东/振安", "Zhenan", 40.156680, 124.422338},
-    {"WZ0XXQWJ2WR9", "辽宁省/丹东市/宽甸满族自治县", "辽宁/丹东/宽甸", "Kuandian", 40.730000, 124.780000},
-    {"WZ06C4578DTW", "辽宁省/丹东市/东港市", "辽宁/丹东/东港", "Donggang", 39.870000, 124.150000},
-    {"WZ0NP79N2D92", "辽宁省/丹东市/凤城市", "辽宁/丹东/凤城", "Fengcheng", 40.450000, 124.070000},
-    {"WXQ1U6H0VE63", "辽宁省/锦州市", "辽宁/锦州/锦州", "Jinzhou", 41.100000, 121.130000},
-    {"WXQ1UHYC3BYW", "辽宁省/锦州市/古塔区", "辽宁/锦州/古塔", "Guta", 41.115179, 121.122635},
-    {"WXQ1USRK37ND", "辽宁省/锦州市/凌河区", "辽宁/锦州/凌河", "Linghe", 41.112959, 121.145273},
-    {"WXQ1GEM4133K", "辽宁省/锦州市/太和区", "辽宁/锦州/太和", "Taihe", 41.107071, 121.098231},
-    {"WXQV4ZM045RV", "辽宁省/锦州市/黑山县", "辽宁/锦州/黑山", "Heishan", 41.700000, 122.120000},
-    {"WXQHQ8KCZ9PG", "辽宁省/锦州市/义县", "辽宁/锦州/义县", "Yixian", 41.530000, 121.230000},
-    {"WXQ61QU2EUQ2", "辽宁省/锦州市/凌海市", "辽宁/锦州/凌海", "Linghai", 41.170000, 121.350000},
-    {"WXQSETH19DN9", "辽宁省/锦州市/北镇市", "辽宁/锦州/北镇", "Beizhen", 41.600000, 121.800000},
-    {"WXNZM7TPVMMZ", "辽宁省/营口市", "辽宁/营口/营口", "Yingkou", 40.670000, 122.230000},
-    {"WXNZMGYQRGJ3", "辽宁省/营口市/站前区", "辽宁/营口/站前", "Zhanqian", 40.671103, 122.253796},
-    {"WXNZKFB1WQ8W", "辽宁省/营口市/西市区", "辽宁/营口/西市", "Xishi", 40.664814, 122.201197},
-    {"WXNUFE2R2G8Q", "辽宁省/营口市/鲅鱼圈区", "辽宁/营口/鲅鱼圈", "Bayuquan", 40.229078, 122.102427},
-    {"WXPP2TQ3Y2NH", "辽宁省/营口市/老边区", "辽宁/营口/老边", "Laobian", 40.678554, 122.374582},
-    {"WXPJB4SE19U7", "辽宁省/营口市/盖州市", "辽宁/营口/盖州", "Gaizhou", 40.400000, 122.350000},
-    {"WXPP781G2VHR", "辽宁省/营口市/大石桥市", "辽宁/营口/大石桥", "Dashiqiao", 40.650000, 122.500000},
-    {"WXQX09T2HRXX", "辽宁省/阜新市", "辽宁/阜新", "Fuxin", 42.020000, 121.670000},
-    {"WXQWBPZKWZJP", "辽宁省/阜新市/海州区", "辽宁/阜新/海州", "Haizhou", 42.011157, 121.650878},
-    {"WXQX7M6TS6QZ", "辽宁省/阜新市/新邱区", "辽宁/阜新/新邱", "Xinqiu", 42.085461, 121.787072},
-    {"WXQWBXRTH6U9", "辽宁省/阜新市/太平区", "辽宁/阜新/太平", "Taiping", 42.008472, 121.673086},
-    {"WXQMDVBQ32Q8", "辽宁省/阜新市/清河门区", "辽宁/阜新/清河门", "Qinghemen", 41.780707, 121.410318},
-    {"WXQX0F15G7PB", "辽宁省/阜新市/细河区", "辽宁/阜新/细河", "Xihe", 42.023365, 121.675107},
-    {"WXQX09T2HRXX", "辽宁省/阜新市/阜新蒙古族自治县", "辽宁/阜新/阜新", "Fuxin", 42.020000, 121.670000},
-    {"WXX1H5P97UW5", "辽宁省/阜新市/彰武县", "辽宁/阜新/彰武", "Zhangwu", 42.380000, 122.530000},
-    {"WXRDFBCXJJ8E", "辽宁省/辽阳市", "辽宁/辽阳/辽阳", "Liaoyang", 41.270000, 123.170000},
-    {"WXRDFB8SDS8U", "辽宁省/辽阳市/白塔区", "辽宁/辽阳/白塔", "Baita", 41.268192, 123.168520},
-    {"WXRDEP0XSWZ9", "辽宁省/辽阳市/文圣区", "辽宁/辽阳/文圣", "Wensheng", 41.260479, 123.179601},
-    {"WXRD7R0FH78C", "辽宁省/辽阳市/宏伟区", "辽宁/辽阳/宏伟", "Hongwei", 41.215572, 123.190911},
-    {"WXRCCPMX97XY", "辽宁省/辽阳市/弓长岭区", "辽宁/辽阳/弓长岭", "Gongchangling", 41.130000, 123.450000},
-    {"WXRDDVW12EKS", "辽宁省/辽阳市/太子河区", "辽宁/辽阳/太子河", "Taizihe", 41.251148, 123.175992},
-    {"WXRD2XBGFUGJ", "辽宁省/辽阳市/辽阳县", "辽宁/辽阳/辽阳县", "Liaoyangxian", 41.220000, 123.070000},
-    {"WXREWKQ0VR9K", "辽宁省/辽阳市/灯塔市", "辽宁/辽阳/灯塔", "Dengta", 41.420000, 123.330000},
-    {"WXQCCV8TM5T4", "辽宁省/盘锦市", "辽宁/盘锦/盘锦", "Panjin", 41.120000, 122.070000},
-    {"WXQF36JKNZY5", "辽宁省/盘锦市/双台子区", "辽宁/盘锦/双台子", "Shuangtaizi", 41.188473, 122.054627},
-    {"WXQF1SKD6DJB", "辽宁省/盘锦市/兴隆台区", "辽宁/盘锦/兴隆台", "Xinglongtai", 41.156556, 122.064401},
-    {"WXQC1U0TV1TJ", "辽宁省/盘锦市/大洼区", "辽宁/盘锦/大洼", "Dawa", 40.980000, 122.070000},
-    {"WXQF8TK68J6D", "辽宁省/盘锦市/盘山县", "辽宁/盘锦/盘山", "Panshan", 41.250000, 122.020000},
-    {"WZ809BF6B5HR", "辽宁省/铁岭市", "辽宁/铁岭", "Tieling", 42.280000, 123.830000},
-    {"WZ809CWFNRS9", "辽宁省/铁岭市/银州区", "辽宁/铁岭/银州", "Yinzhou", 42.284014, 123.836448},
-    {"WZ860BQ0C5BJ", "辽宁省/铁岭市/清河区", "辽宁/铁岭/清河", "Qinghe", 42.540586, 124.142804},
-    {"WZ809BF6B5HR", "辽宁省/铁岭市/铁岭县", "辽宁/铁岭/铁岭", "Tieling", 42.280000, 123.830000},
-    {"WZ8EN4F269K6", "辽宁省/铁岭市/西丰县", "辽宁/铁岭/西丰", "Xifeng", 42.730000, 124.720000},
-    {"WZ85RGYGED4B", "辽宁省/铁岭市/昌图县", "辽宁/铁岭/昌图", "Changtu", 42.780000, 124.100000},
-    {"WXXCE7QMETV4", "辽宁省/铁岭市/调兵山市", "辽宁/铁岭/调兵山", "Diaobingshan", 42.470000, 123.550000},
-    {"WZ84N3GZSQZH", "辽宁省/铁岭市/开原市", "辽宁/铁岭/开原", "Kaiyuan", 42.550000, 124.030000},
-    {"WXMSKZT4B3TT", "辽宁省/朝阳市", "辽宁/朝阳", "Chaoyang", 41.570000, 120.450000},
-    {"WXMSKY7S59FX", "辽宁省/朝阳市/双塔区", "辽宁/朝阳/双塔", "Shuangta", 41.563350, 120.448076},
-    {"WXMSEBQHS8M0", "辽宁省/朝阳市/龙城区", "辽宁/朝阳/龙城", "Longcheng", 41.574413, 120.407610},
-    {"WXMSKZT4B3TT", "辽宁省/朝阳市/朝阳县", "辽宁/朝阳/朝阳", "Chaoyang", 41.570000, 120.450000},
-    {"WXM5D0XUMP37", "辽宁省/朝阳市/建平县", "辽宁/朝阳/建平县", "Jianpingxian", 41.400000, 119.630000},
-    {"WXM4JQFC0DDQ", "辽宁省/朝阳市/喀喇沁左翼蒙古族自治县", "辽宁/朝阳/喀左", "Kazuo", 41.170078, 119.765764},
-    {"WXMVU1QN8UYB", "辽宁省/朝阳市/北票市", "辽宁/朝阳/北票", "Beipiao", 41.800000, 120.770000},
-    {"WXKFTJ26TTKF", "辽宁省/朝阳市/凌源市", "辽宁/朝阳/凌源", "Lingyuan", 41.250000, 119.400000},
-    {"WXJZTSCEPN4J", "辽宁省/葫芦岛市", "辽宁/葫芦岛/葫芦岛", "Huludao", 40.720000, 120.830000},
-    {"WXJZYQD81CPK", "辽宁省/葫芦岛市/连山区", "辽宁/葫芦岛/连山", "Lianshan", 40.773016, 120.864114},
-    {"WXJZWZKMQZ1B", "辽宁省/葫芦岛市/龙港区", "辽宁/葫芦岛/龙港", "Longgang", 40.734124, 120.888697},
-    {"WXMCGDGR793Z", "辽宁省/葫芦岛市/南票区", "辽宁/葫芦岛/南票", "Nanpiao", 41.105226, 120.744362},
-    {"WXJT6HJ9H0Z0", "辽宁省/葫芦岛市/绥中县", "辽宁/葫芦岛/绥中", "Suizhong", 40.320000, 120.330000},
-    {"WXM0NP59WRD8", "辽宁省/葫芦岛市/建昌县", "辽宁/葫芦岛/建昌", "Jianchang", 40.820000, 119.800000},
-    {"WXJZ549SEUU4", "辽宁省/葫芦岛市/兴城市", "辽宁/葫芦岛/兴城", "Xingcheng", 40.620000, 120.720000},
-    {"WZC1EXZ0P9HU", "吉林省/长春市", "吉林/长春/长春", "Changchun", 43.900000, 125.320000},
-    {"WZC1S28RV6C8", "吉林省/长春市/南关区", "吉林/长春/南关", "Nanguan", 43.861514, 125.343588},
-    {"WZC1GXR20WUC", "吉林省/长春市/宽城区", "吉林/长春/宽城", "Kuancheng", 43.941229, 125.320043},
-    {"WZC16G5QZFCH", "吉林省/长春市/朝阳区", "吉林/长春/朝阳", "Chaoyang", 43.831130, 125.281897},
-    {"WZC1SC1BURVN", "吉林省/长春市/二道区", "吉林/长春/二道", "Erdao", 43.863086, 125.367583},
-    {"WZC1D5U5DSMG", "吉林省/长春市/绿园区", "吉林/长春/绿园", "Lvyuan", 43.878645, 125.249749},
-    {"WZ9REDW47HPB", "吉林省/长春市/双阳区", "吉林/长春/双阳", "Shuangyang", 43.520000, 125.670000},
-    {"WZC7PM687S82", "吉林省/长春市/九台区", "吉林/长春/九台", "Jiutai", 44.150000, 125.830000},
-    {"WZCHB81R92M3", "吉林省/长春市/农安县", "吉林/长春/农安", "Nongan", 44.430000, 125.180000},
-    {"WZCYZXNZKTX6", "吉林省/长春市/榆树市", "吉林/长春/榆树", "Yushu", 44.820000, 126.550000},
-    {"WZCMK67YN39K", "吉林省/长春市/德惠市", "吉林/长春/德惠", "Dehui", 44.530000, 125.700000},
-    {"WZCCRENBK8PQ", "吉林省/吉林市", "吉林/吉林/吉林", "Jilin", 43.830000, 126.550000},
-    {"WZF18HHC353Z", "吉林省/吉林市/昌邑区", "吉林/吉林/昌邑", "Changyi", 43.879628, 126.569069},
-    {"WZCCZC7DHYG6", "吉林省/吉林市/龙潭区", "吉林/吉林/龙潭", "Longtan", 43.908614, 126.556529},
-    {"WZCCR7HPJ434", "吉林省/吉林市/船营区", "吉林/吉林/船营", "Chuanying", 43.831170, 126.535250},
-    {"WZCCRC5DQCN8", "吉林省/吉林市/丰满区", "吉林/吉林/丰满", "Fengman", 43.819361, 126.556619},
-    {"WZCBQTFKPWH8", "吉林省/吉林市/永吉县", "吉林/吉林/永吉", "Yongji", 43.670000, 126.500000},
-    {"WZF89QYZKN9Q", "吉林省/吉林市/蛟河市", "吉林/吉林/蛟河", "Jiaohe", 43.720000, 127.330000},
-    {"WZDH7Y3YRH94", "吉林省/吉林市/桦甸市", "吉林/吉林/桦甸", "Huadian", 42.970000, 126.730000},
-    {"WZFK8Y6JM2HV", "吉林省/吉林市/舒兰市", "吉林/吉林/舒兰", "Shulan", 44.420000, 126.950000},
-    {"WZ9SK6FCCUK3", "吉林省/吉林市/磐石市", "吉林/吉林/磐石", "Panshi", 42.950000, 126.050000},
-    {"WZ8MTDUGMP22", "吉林省/四平市", "吉林/四平/四平", "Siping", 43.170000, 124.350000},
-    {"WZ8MMQJ39H3U", "吉林省/四平市/铁西区", "吉林/四平/铁西", "Tiexi", 43.143592, 124.339531},
-    {"WZ8MWBGVB73M", "吉林省/四平市/铁东区", "吉林/四平/铁东", "Tiedong", 43.159422, 124.403356},
-    {"WZ8QMNNM6CR3", "吉林省/四平市/梨树县", "吉林/四平/梨树", "Lishu", 43.320000, 124.330000},
-    {"WZ9NE78SJ9EY", "吉林省/四平市/伊通满族自治县", "吉林/四平/伊通", "Yitong", 43.350000, 125.300000},
-    {"WZ8Z2QGJUG9Z", "吉林省/四平市/公主岭市", "吉林/四平/公主岭", "Gongzhuling", 43.500000, 124.820000},
-    {"WXXZD69FQS42", "吉林省/四平市/双辽市", "吉林/四平/双辽", "Shuangliao", 43.520000, 123.500000},
-    {"WZ8GZQHFH76E", "吉林省/辽源市", "吉林/辽源/辽源", "Liaoyuan", 42.880000, 125.130000},
-    {"WZ8UP3SBV311", "吉林省/辽源市/龙山区", "吉林/辽源/龙山", "Longshan", 42.898999, 125.130041},
-    {"WZ8UPWNQ8XWM", "吉林省/辽源市/西安区", "吉林/辽源/西安", "Xian", 42.924741, 125.142891},
-    {"WZ96B98JJ08H", "吉林省/辽源市/东丰县", "吉林/辽源/东丰", "Dongfeng", 42.680000, 125.530000},
-    {"WZ8UHMQ5P5GS", "吉林省/辽源市/东辽县", "吉林/辽源/东辽", "Dongliao", 42.920000, 125.000000},
-    {"WZ3T3SEQVEVF", "吉林省/通化市", "吉林/通化/通化", "Tonghua", 41.730000, 125.930000},
-    {"WZ3T6H1964E1", "吉林省/通化市/东昌区", "吉林/通化/东昌", "Dongchang", 41.726302, 125.949416},
-    {"WZ3TSH3130W1", "吉林省/通化市/二道江区", "吉林/通化/二道江", "Erdaojiang", 41.771610, 126.036581},
-    {"WZ3MJE87E7HH", "吉林省/通化市/通化县", "吉林/通化/通化县", "Tonghuaxian", 41.680000, 125.750000},
-    {"WZ9DGCSJPBEH", "吉林省/通化市/辉南县", "吉林/通化/辉南", "Huinan", 42.680000, 126.030000},
-    {"WZ92T0CFC75P", "吉林省/通化市/柳河县", "吉林/通化/柳河", "Liuhe", 42.280000, 125.730000},
-    {"WZ93GYM7HQ8K", "吉林省/通化市/梅河口市", "吉林/通化/梅河口", "Meihekou", 42.530000, 125.680000},
-    {"WZ39ZM9MR5E6", "吉林省/通化市/集安市", "吉林/通化/集安", "Jian", 41.120000, 126.180000},
-    {"WZ3YSC05ZW82", "吉林省/白山市", "吉林/白山/白山", "Baishan", 41.930000, 126.420000},
-    {"WZ3YSE3P5FF2", "吉林省/白山市/浑江区", "吉林/白山/浑江", "Hunjiang", 41.942897, 126.410229},
-    {"WZ6PJDT5559T", "吉林省/白山市/江源区", "吉林/白山/江源", "Jiangyuan", 42.025986, 126.811197},
-    {"WZD8B3FQNGYV", "吉林省/白山市/抚松县", "吉林/白山/抚松", "Fusong", 42.330000, 127.280000},
-    {"WZD1JQSVYHUG", "吉林省/白山市/靖宇县", "吉林/白山/靖宇", "Jingyu", 42.400000, 126.800000},
-    {"WZ75TK22UX8K", "吉林省/白山市/长白朝鲜族自治县", "吉林/白山/长白", "Changbai", 41.420000, 128.200000},
-    {"WZ6JZ9MY8KF0", "吉林省/白山市/临江市", "吉林/白山/临江", "Linjiang", 41.800000, 126.900000},
-    {"YB0B8REJKCCB", "吉林省/松原市", "吉林/松原/松原", "Songyuan", 45.130000, 124.820000},
-    {"YB0BBNUMJJ5Z", "吉林省/松原市/宁江区", "吉林/松原/宁江", "Ningjiang", 45.169801, 124.810744},
-    {"WZBX23CR6X91", "吉林省/松原市/前郭尔罗斯蒙古族自治县", "吉林/松原/前郭", "Qianguo", 44.879062, 124.465937},
-    {"WZB5VHZMXQK2", "吉林省/松原市/长岭县", "吉林/松原/长岭", "Changling", 44.280000, 123.980000},
-    {"YB00N5SSE2Q8", "吉林省/松原市/乾安县", "吉林/松原/乾安", "Qianan", 45.020000, 124.020000},
-    {"WZCXGSKGQZDX", "吉林省/松原市/扶余市", "吉林/松原/扶余", "Fuyu", 44.980000, 126.020000},
-    {"Y8P7E0F5F2QK", "吉林省/白城市", "吉林/白城/白城", "Baicheng", 45.620000, 122.830000},
-    {"Y8P7E2V4U0EB", "吉林省/白城市/洮北区", "吉林/白城/洮北", "Taobei", 45.619829, 122.845178},
-    {"Y8PSG6XX856R", "吉林省/白城市/镇赉县", "吉林/白城/镇赉", "Zhenlai", 45.850000, 123.200000},
-    {"WXZWBZ0P7VEF", "吉林省/白城市/通榆县", "吉林/白城/通榆", "Tongyu", 44.820000, 123.080000},
-    {"Y8P3CUJDMK7W", "吉林省/白城市/洮南市", "吉林/白城/洮南", "Taonan", 45.330000, 122.780000},
-    {"YB06U51BTYU8", "吉林省/白城市/大安市", "吉林/白城/大安", "Daan", 45.500000, 124.280000},
-    {"WZS5FZSMRDT6", "吉林省/延边朝鲜族自治州", "吉林/吉林/延边", "Yanbian", 42.888793, 129.502015},
-    {"WZS5FY540EQG", "吉林省/延边朝鲜族自治州/延吉市", "吉林/延边/延吉", "Yanji", 42.880000, 129.500000},
-    {"WZSK6Q7Q6K8D", "吉林省/延边朝鲜族自治州/图们市", "吉林/延边/图们", "Tumen", 42.970000, 129.830000},
-    {"WZENTZQ0X9FP", "吉林省/延边朝鲜族自治州/敦化市", "吉林/延边/敦化", "Dunhua", 43.370000, 128.230000},
-    {"WZSEYSHXC5JZ", "吉林省/延边朝鲜族自治州/珲春市", "吉林/延边/珲春", "Hunchun", 42.870000, 130.370000},
-    {"WZS5340C29F7", "吉林省/延边朝鲜族自治州/龙井市", "吉林/延边/龙井", "Longjing", 42.770000, 129.420000},
-    {"WZE9ZQQGJYES", "吉林省/延边朝鲜族自治州/和龙市", "吉林/延边/和龙", "Helong", 42.530000, 129.000000},
-    {"WZSQ2W1J61K3", "吉林省/延边朝鲜族自治州/汪清县", "吉林/延边/汪清", "Wangqing", 43.320000, 129.750000},
-    {"WZETM1Y05WW7", "吉林省/延边朝鲜族自治州/安图县", "吉林/延边/安图", "Antu", 43.120000, 128.900000},
-    {"YB1UX38K6DY1", "黑龙江省/哈尔滨市", "黑龙江/哈尔滨/哈尔滨", "Haerbin", 45.800000, 126.530000},
-    {"YB4H315RDCJ7", "黑龙江省/哈尔滨市/道里区", "黑龙江/哈尔滨/道里", "Daoli", 45.753857, 126.611034},
-    {"YB4H63BZXBM3", "黑龙江省/哈尔滨市/南岗区", "黑龙江/哈尔滨/南岗", "Nangang", 45.757972, 126.662747},
-    {"YB4H3ZFGN2W9", "黑龙江省/哈尔滨市/道外区", "黑龙江/哈尔滨/道外", "Daowai", 45.790160, 126.643458},
-    {"YB453MUK1XKZ", "黑龙江省/哈尔滨市/平房区", "黑龙江/哈尔滨/平房", "Pingfang", 45.603602, 126.623339},
-    {"YB1UW9V2RYRM", "黑龙江省/哈尔滨市/松北区", "黑龙江/哈尔滨/松北", "Songbei", 45.800706, 126.504134},
-    {"YB4H40KX05JS", "黑龙江省/哈尔滨市/香坊区", "黑龙江/哈尔滨/香坊", "Xiangfang", 45.705717, 126.656578},
-    {"YB4J07UDZU0V", "黑龙江省/哈尔滨市/呼兰区", "黑龙江/哈尔滨/呼兰", "Hulan", 45.900000, 126.580000},
-    {"YB46BYDJJRHB", "黑龙江省/哈尔滨市/阿城区", "黑龙江/哈尔滨/阿城", "Acheng", 45.520000, 126.950000},
-    {"YB1F47R7MKFZ", "黑龙江省/哈尔滨市/双城区", "黑龙江/哈尔滨/双城", "Shuangcheng", 45.370000, 126.320000},
-    {"YBHPEBR3TCC6", "黑龙江省/哈尔滨市/依兰县", "黑龙江/哈尔滨/依兰", "Yilan", 46.320000, 129.550000},
-    {"YB5SEX55HE4W", "黑龙江省/哈尔滨市/方正县", "黑龙江/哈尔滨/方正", "Fangzheng", 45.830000, 128.830000},
-    {"YB4SKBS1561S", "黑龙江省/哈尔滨市/宾县", "黑龙江/哈尔滨/宾县", "Binxian", 45.750000, 127.480000},
-    {"YB4W5H9G7NT6", "黑龙江省/哈尔滨市/巴彦县", "黑龙江/哈尔滨/巴彦", "Bayan", 46.080000, 127.400000},
-    {"YB5J3KUW5HZ6", "黑龙江省/哈尔滨市/木兰县", "黑龙江/哈尔滨/木兰", "Mulan", 45.950000, 128.030000},
-    {"YB5T9B8FSMN5", "黑龙江省/哈尔滨市/通河县", "黑龙江/哈尔滨/通河", "Tonghe", 45.970000, 128.750000},
-    {"YB5681ZJ3WPD", "黑龙江省/哈尔滨市/延寿县", "黑龙江/哈尔滨/延寿", "Yanshou", 45.450000, 128.330000},
-    {"YB4CR843E4FZ", "黑龙江省/哈尔滨市/尚志市", "黑龙江/哈尔滨/尚志", "Shangzhi", 45.220000, 127.950000},
-    {"WZFRT37VCWZV", "黑龙江省/哈尔滨市/五常市", "黑龙江/哈尔滨/五常", "Wuchang", 44.920000, 127.150000},
-    {"YB2JK81THR6Z", "黑龙江省/齐齐哈尔市", "黑龙江/齐齐哈尔/齐齐哈尔", "Qiqihaer", 47.330000, 123.950000},
-    {"YB2JHT6R1S07", "黑龙江省/齐齐哈尔市/龙沙区", "黑龙江/齐齐哈尔/龙沙", "Longsha", 47.315219, 123.950909},
-    {"YB2JKS0YCQ6G", "黑龙江省/齐齐哈尔市/建华区", "黑龙江/齐齐哈尔/建华", "Jianhua", 47.352267, 123.948842},
-    {"YB2JM19MGX06", "黑龙江省/齐齐哈尔市/铁锋区", "黑龙江/齐齐哈尔/铁锋", "Tiefeng", 47.338366, 123.971594},
-    {"YB2H1RZYG2NG", "黑龙江省/齐齐哈尔市/昂昂溪区", "黑龙江/齐齐哈尔/昂昂溪", "Angangxi", 47.153106, 123.815723},
-    {"Y8RUT1EPZEJ9", "黑龙江省/齐齐哈尔市/富拉尔基区", "黑龙江/齐齐哈尔/富拉尔基", "Fulaerji", 47.206852, 123.622613},
-    {"Y8RQK1Z9YNGK", "黑龙江省/齐齐哈尔市/碾子山区", "黑龙江/齐齐哈尔/碾子山", "Nianzishan", 47.514833, 122.881655},
-    {"Y8RVPUJ1HQZZ", "黑龙江省/齐齐哈尔市/梅里斯达斡尔族区", "黑龙江/齐齐哈尔/梅里斯", "Meilisi", 47.307338, 123.746073},
-    {"Y8RT700VNP3P", "黑龙江省/齐齐哈尔市/龙江县", "黑龙江/齐齐哈尔/龙江", "Longjiang", 47.330000, 123.180000},
-    {"YB907K29JWGV", "黑龙江省/齐齐哈尔市/依安县", "黑龙江/齐齐哈尔/依安", "Yian", 47.880000, 125.300000},
-    {"Y8PZBQZEW6YJ", "黑龙江省/齐齐哈尔市/泰来县", "黑龙江/齐齐哈尔/泰来", "Tailai", 46.400000, 123.420000},
-    {"WQ1PJ9PBXYZY", "黑龙江省/齐齐哈尔市/甘南县", "黑龙江/齐齐哈尔/甘南", "Gannan", 47.922406, 123.507429},
-    {"YB8803K79NNG", "黑龙江省/齐齐哈尔市/富裕县", "黑龙江/齐齐哈尔/富裕", "Fuyu", 47.820000, 124.470000},
-    {"YB990PXEP8FW", "黑龙江省/齐齐哈尔市/克山县", "黑龙江/齐齐哈尔/克山", "Keshan", 48.030000, 125.870000},
-    {"YB9C0ZS7N0ZN", "黑龙江省/齐齐哈尔市/克东县", "黑龙江/齐齐哈尔/克东", "Kedong", 48.030000, 126.250000},
-    {"YB3WV12DHGJU", "黑龙江省/齐齐哈尔市/拜泉县", "黑龙江/齐齐哈尔/拜泉", "Baiquan", 47.600000, 126.080000},
-    {"YB8GC3X83ZH8", "黑龙江省/齐齐哈尔市/讷河市", "黑龙江/齐齐哈尔/讷河", "Nehe", 48.480000, 124.870000},
-    {"YBJ1SQ97WHN1", "黑龙江省/鸡西市", "黑龙江/鸡西/鸡西", "Jixi", 45.300000, 130.970000},
-    {"YBJ1SQGYT1DK", "黑龙江省/鸡西市/鸡冠区", "黑龙江/鸡西/鸡冠", "Jiguan", 45.301875, 130.973385},
-    {"YBJ14TUZ328F", "黑龙江省/鸡西市/恒山区", "黑龙江/鸡西/恒山", "Hengshan", 45.208615, 130.897691},
-    {"YBJ1CR053BCD", "黑龙江省/鸡西市/滴道区", "黑龙江/鸡西/滴道", "Didao", 45.346632, 130.836259},
-    {"YBHBTBM79KJ9", "黑龙江省/鸡西市/梨树区", "黑龙江/鸡西/梨树", "Lishu", 45.089887, 130.689644},
-    {"YBJ1VHCVWHQH", "黑龙江省/鸡西市/城子河区", "黑龙江/鸡西/城子河", "Chengzihe", 45.334677, 131.003646},
-    {"YBHC0YJYHJ40", "黑龙江省/鸡西市/麻山区", "黑龙江/鸡西/麻山", "Mashan", 45.209797, 130.470717},
-    {"YBJ1RVTBQ7QU", "黑龙江省/鸡西市/鸡东县", "黑龙江/鸡西/鸡东", "Jidong", 45.250000, 131.130000},
-    {"YBNS6H1JDD6U", "黑龙江省/鸡西市/虎林市", "黑龙江/鸡西/虎林", "Hulin", 45.770000, 132.980000},
-    {"YBJG0U0GCXQV", "黑龙江省/鸡西市/密山市", "黑龙江/鸡西/密山", "Mishan", 45.550000, 131.870000},
-    {"YBKTK25TPP2R", "黑龙江省/鹤岗市", "黑龙江/鹤岗/鹤岗", "Hegang", 47.330000, 130.270000},
-    {"YBKTK9ZXWXMJ", "黑龙江省/鹤岗市/向阳区", "黑龙江/鹤岗/向阳", "Xiangyang", 47.340042, 130.286464},
-    {"YBKTHM9MY5ZV", "黑龙江省/鹤岗市/工农区", "黑龙江/鹤岗/工农", "Gongnong", 47.316377, 130.266877},
-    {"YBKTHT42W0KK", "黑龙江省/鹤岗市/南山区", "黑龙江/鹤岗/南山", "Nanshan", 47.312710, 130.279232},
-    {"YBKSG3XTUZZY", "黑龙江省/鹤岗市/兴安区", "黑龙江/鹤岗/兴安", "Xingan", 47.250480, 130.231461},
-    {"YBKTM320X96D", "黑龙江省/鹤岗市/东山区", "黑龙江/鹤岗/东山", "Dongshan", 47.336061, 130.309163},
-    {"YBKTKUY2JGPC", "黑龙江省/鹤岗市/兴山区", "黑龙江/鹤岗/兴山", "Xingshan", 47.355210, 130.295705},
-    {"YBMN9JEMXFYE", "黑龙江省/鹤岗市/萝北县", "黑龙江/鹤岗/萝北", "Luobei", 47.580000, 130.830000},
-    {"YBMUBR41ZWVC", "黑龙江省/鹤岗市/绥滨县", "黑龙江/鹤岗/绥滨", "Suibin", 47.280000, 131.850000},
-    {"YBM322SX2QPB", "黑龙江省/双鸭山市", "黑龙江/双鸭山/双鸭山", "Shuangyashan", 46.630000, 131.150000},
-    {"YBM327K9XWEB", "黑龙江省/双鸭山市/尖山区", "黑龙江/双鸭山/尖山", "Jianshan", 46.644122, 131.150306},
-    {"YBM309937NQC", "黑龙江省/双鸭山市/岭东区", "黑龙江/双鸭山/岭东", "Lingdong", 46.590519, 131.156640},
-    {"YBM3H3UFWQUM", "黑龙江省/双鸭山市/四方台区", "黑龙江/双鸭山/四方台", "Sifangtai", 46.592111, 131.326377},
-    {"YBM2VYTWQGYK", "黑龙江省/双鸭山市/宝山区", "黑龙江/双鸭山/宝山", "Baoshan", 46.574885, 131.393349},
-    {"YBM1ZCJGWRNZ", "黑龙江省/双鸭山市/集贤县", "黑龙江/双鸭山/集贤", "Jixian", 46.720000, 131.130000},
-    {"YBMDPHJC6851", "黑龙江省/双鸭山市/友谊县", "黑龙江/双鸭山/友谊", "Youyi", 46.780000, 131.800000},
-    {"YBNP8231E3BD", "黑龙江省/双鸭山市/宝清县", "黑龙江/双鸭山/宝清", "Baoqing", 46.320000, 132.200000},
-    {"YBR61XWMU274", "黑龙江省/双鸭山市/饶河县", "黑龙江/双鸭山/饶河", "Raohe", 46.800000, 134.020000},
-    {"YB2BVPSH4JM5", "黑龙江省/大庆市", "黑龙江/大庆/大庆", "Daqing", 46.580000, 125.030000},
-    {"YB2CNFHX4NTR", "黑龙江省/大庆市/萨尔图区", "黑龙江/大庆/萨尔图", "Saertu", 46.594255, 125.107591},
-    {"YB2BZK58SVC8", "黑龙江省/大庆市/龙凤区", "黑龙江/大庆/龙凤", "Longfeng", 46.560175, 125.128304},
-    {"YB2C3K7R3S8U", "黑龙江省/大庆市/让胡路区", "黑龙江/大庆/让胡路", "Ranghulu", 46.650592, 124.864148},
-    {"YB0ZCY60RJRM", "黑龙江省/大庆市/红岗区", "黑龙江/大庆/红岗", "Honggang", 46.396709, 124.884649},
-    {"YB0VBHBYKM2C", "黑龙江省/大庆市/大同区", "黑龙江/大庆/大同", "Datong", 46.037936, 124.805901},
-    {"YB15FX6VF96N", "黑龙江省/大庆市/肇州县", "黑龙江/大庆/肇州", "Zhaozhou", 45.700000, 125.270000},
-    {"YB0FYQ8MPPPB", "黑龙江省/大庆市/肇源县", "黑龙江/大庆/肇源", "Zhaoyuan", 45.520000, 125.080000},
-    {"YB2U3KZE3VKW", "黑龙江省/大庆市/林甸县", "黑龙江/大庆/林甸", "Lindian", 47.180000, 124.870000},
-    {"YB26XUMTX1MB", "黑龙江省/大庆市/杜尔伯特蒙古族自治县", "黑龙江/大庆/杜尔伯特", "Duerbote", 46.870000, 124.450000},
-    {"YB7XT0YP7SYK", "黑龙江省/伊春市", "黑龙江/伊春", "Yichun", 47.730000, 128.900000},
-    {"YB7XT0YP7SYK", "黑龙江省/伊春市/伊春区", "黑龙江/伊春/伊春", "Yichun", 47.730000, 128.900000},
-    {"YB7UJSZC9867", "黑龙江省/伊春市/南岔区", "黑龙江/伊春/南岔", "Nancha", 47.135727, 129.275847},
-    {"YBE85XJG6JSD", "黑龙江省/伊春市/友好区", "黑龙江/伊春/友好", "Youhao", 47.851540, 128.833672},
-    {"YB7YN7JHFQPS", "黑龙江省/伊春市/西林区", "黑龙江/伊春/西林", "Xilin", 47.478265, 129.305069},
-    {"YB7RRZCRPCKP", "黑龙江省/伊春市/翠峦区", "黑龙江/伊春/翠峦", "Cuiluan", 47.724446, 128.662943},
-    {"YBS4EQTGB7WF", "黑龙江省/伊春市/新青区", "黑龙江/伊春/新青", "Xinqing", 48.288322, 129.525738},
-    {"YB7YFPPRTC7W", "黑龙江省/伊春市/美溪区", "黑龙江/伊春/美溪", "Meixi", 47.632521, 129.121536},
-    {"YBKJ9NCD4RU8", "黑龙江省/伊春市/金山屯区", "黑龙江/伊春/金山屯", "Jinshantun", 47.410511, 129.421108},
-    {"YBECTPUZR61H", "黑龙江省/伊春市/五营区", "黑龙江/伊春/五营", "Wuying", 48.120000, 129.250000},
-    {"YB7XD8PSR3Q1", "黑龙江省/伊春市/乌马河区", "黑龙江/伊春/乌马河", "Wumahe", 47.725346, 128.792357},
-    {"YBS5SK90GZCD", "黑龙江省/伊春市/汤旺河区", "黑龙江/伊春/汤旺河", "Tangwanghe", 48.452624, 129.563304},
-    {"YB7EXBBDYQEK", "黑龙江省/伊春市/带岭区", "黑龙江/伊春/带岭", "Dailing", 47.026112, 129.013411},
-    {"YBSH3P2G88DK", "黑龙江省/伊春市/乌伊岭区", "黑龙江/伊春/乌伊岭", "Wuyiling", 48.600000, 129.420000},
-    {"YBS42JM8VY66", "黑龙江省/伊春市/红星区", "黑龙江/伊春/红星", "Hongxing", 48.237010, 129.382803},
-    {"YBE8ZV54FR97", "黑龙江省/伊春市/上甘岭区", "黑龙江/伊春/上甘岭", "Shangganling", 47.972315, 129.016669},
-    {"YBSWNF7FDHQM", "黑龙江省/伊春市/嘉荫县", "黑龙江/伊春/嘉荫", "Jiayin", 48.880000, 130.380000},
-    {"YB7530MQ64YB", "黑龙江省/伊春市/铁力市", "黑龙江/伊春/铁力", "Tieli", 46.980000, 128.020000},
-    {"YBKDQEKD30TF", "黑龙江省/佳木斯市", "黑龙江/佳木斯/佳木斯", "Jiamusi", 46.820000, 130.370000},
-    {"YBKDQ2EMSQK6", "黑龙江省/佳木斯市/向阳区", "黑龙江/佳木斯/向阳", "Xiangyang", 46.805482, 130.357435},
-    {"YBKDQ9F6QKK4", "黑龙江省/佳木斯市/前进区", "黑龙江/佳木斯/前进", "Qianjin", 46.811780, 130.367133},
-    {"YBKDR5R7872K", "黑龙江省/佳木斯市/东风区", "黑龙江/佳木斯/东风", "Dongfeng", 46.820230, 130.395710},
-    {"YBKDM3PEMWE3", "黑龙江省/佳木斯市/郊区", "黑龙江/佳木斯/郊区", "Jiaoqu", 46.807844, 130.319378},
-    {"YBHYGPYJM88E", "黑龙江省/佳木斯市/桦南县", "黑龙江/佳木斯/桦南", "Huanan", 46.230000, 130.570000},
-    {"YBKGQXERKG29", "黑龙江省/佳木斯市/桦川县", "黑龙江/佳木斯/桦川", "Huachuan", 47.020000, 130.720000},
-    {"YBK3GFYMCRK7", "黑龙江省/佳木斯市/汤原县", "黑龙江/佳木斯/汤原", "Tangyuan", 46.730000, 129.900000},
-    {"YBQPPD6J7GCC", "黑龙江省/佳木斯市/同江市", "黑龙江/佳木斯/同江", "Tongjiang", 47.650000, 132.520000},
-    {"YBMUU3T71YRK", "黑龙江省/佳木斯市/富锦市", "黑龙江/佳木斯/富锦", "Fujin", 47.250000, 132.030000},
-    {"YBX7PT7XWV91", "黑龙江省/佳木斯市/抚远市", "黑龙江/佳木斯/抚远", "Fuyuan", 48.370000, 134.280000},
-    {"YBJH7VFZU4T1", "黑龙江省/七台河市", "黑龙江/七台河/七台河", "Qitaihe", 45.780000, 130.950000},
-    {"YBJHEK0MQBYU", "黑龙江省/七台河市/新兴区", "黑龙江/七台河/新兴", "Xinxing", 45.813894, 130.924715},
-    {"YBJHM6BQSK9F", "黑龙江省/七台河市/桃山区", "黑龙江/七台河/桃山", "Taoshan", 45.763317, 131.012491},
-    {"YBJHQQE0652T", "黑龙江省/七台河市/茄子河区", "黑龙江/七台河/茄子河", "Qiezihe", 45.782837, 131.060115},
-    {"YBHU70W1JD0S", "黑龙江省/七台河市/勃利县", "黑龙江/七台河/勃利", "Boli", 45.750000, 130.570000},
-    {"WZUJT5EC6FK4", "黑龙江省/牡丹江市", "黑龙江/牡丹江/牡丹江", "Mudanjiang", 44.580000, 129.600000},
-    {"WZUJTE6JFGW6", "黑龙江省/牡丹江市/东安区", "黑龙江/牡丹江/东安", "Dongan", 44.579406, 129.619573},
-    {"WZUJTY0EEW1Y", "黑龙江省/牡丹江市/阳明区", "黑龙江/牡丹江/阳明", "Yangming", 44.594140, 129.628525},
-    {"WZUJSY0ES6N0", "黑龙江省/牡丹江市/爱民区", "黑龙江/牡丹江/爱民", "Aimin", 44.594117, 129.584618},
-    {"WZUJT6F2NJN7", "黑龙江省/牡丹江市/西安区", "黑龙江/牡丹江/西安", "Xian", 44.575681, 129.609069},
-    {"YBH9SQEEXH03", "黑龙江省/牡丹江市/林口县", "黑龙江/牡丹江/林口", "Linkou", 45.300000, 130.270000},
-    {"WZVK8QKT22PV", "黑龙江省/牡丹江市/绥芬河市", "黑龙江/牡丹江/绥芬河", "Suifenhe", 44.420000, 131.150000},
-    {"WZUJ81EXHD0Q", "黑龙江省/牡丹江市/海林市", "黑龙江/牡丹江/海林", "Hailin", 44.570000, 129.380000},
-    {"WZUH61TJMXJN", "黑龙江省/牡丹江市/宁安市", "黑龙江/牡丹江/宁安", "Ningan", 44.350000, 129.470000},
-    {"WZUZD13VBQVV", "黑龙江省/牡丹江市/穆棱市", "黑龙江/牡丹江/穆棱", "Muling", 44.920000, 130.520000},
-    {"WZV4XWWWM7QM", "黑龙江省/牡丹江市/东宁市", "黑龙江/牡丹江/东宁", "Dongning", 44.070000, 131.120000},
-    {"YBFTUGSP7QCT", "黑龙江省/黑河市", "黑龙江/黑河/黑河", "Heihe", 50.250000, 127.480000},
-    {"YBFTV5V9G6CF", "黑龙江省/黑河市/爱辉区", "黑龙江/黑河/爱辉", "Aihui", 50.250407, 127.493047},
-    {"YB9P8ZPU52Q6", "黑龙江省/黑河市/嫩江县", "黑龙江/黑河/嫩江", "Nenjiang", 49.170000, 125.200000},
-    {"YBG653UBRVZH", "黑龙江省/黑河市/逊克县", "黑龙江/黑河/逊克", "Xunke", 49.580000, 128.470000},
-    {"YBF91HXS758Z", "黑龙江省/黑河市/孙吴县", "黑龙江/黑河/孙吴", "Sunwu", 49.420000, 127.320000},
-    {"YB9FRH101ETS", "黑龙江省/黑河市/北安市", "黑龙江/黑河/北安", "Beian", 48.230000, 126.520000},
-    {"YB9SPBB13PS3", "黑龙江省/黑河市/五大连池市", "黑龙江/黑河/五大连池", "Wudalianchi", 48.520000, 126.200000},
-    {"YB63388P2QN8", "黑龙江省/绥化市", "黑龙江/绥化/绥化", "Suihua", 46.630000, 126.980000},
-    {"YB6333XQVSWR", "黑龙江省/绥化市/北林区", "黑龙江/绥化/北林", "Beilin", 46.635400, 126.979195},
-    {"YB3FQJ5UT8EX", "黑龙江省/绥化市/望奎县", "黑龙江/绥化/望奎", "Wangkui", 46.830000, 126.480000},
-    {"YB1Z1X4Q330T", "黑龙江省/绥化市/兰西县", "黑龙江/绥化/兰西", "Lanxi", 46.270000, 126.280000},
-    {"YB39T3Z4WYXN", "黑龙江省/绥化市/青冈县", "黑龙江/绥化/青冈", "Qinggang", 46.680000, 126.100000},
-    {"YB6DTY1PZ37S", "黑龙江省/绥化市/庆安县", "黑龙江/绥化/庆安", "Qingan", 46.880000, 127.520000},
-    {"YB3S2UVE6TKN", "黑龙江省/绥化市/明水县", "黑龙江/绥化/明水", "Mingshui", 47.180000, 125.900000},
-    {"YB6KU1X7HWMH", "黑龙江省/绥化市/绥棱县", "黑龙江/绥化/绥棱", "Suiling", 47.250000, 127.100000},
-    {"YB1PGYYE8DVM", "黑龙江省/绥化市/安达市", "黑龙江/绥化/安达", "Anda", 46.400000, 125.330000},
-    {"YB1W4DZC4Y2W", "黑龙江省/绥化市/肇东市", "黑龙江/绥化/肇东", "Zhaodong", 46.070000, 125.980000},
-    {"YB6Q138SZ3Q5", "黑龙江省/绥化市/海伦市", "黑龙江/绥化/海伦", "Hailun", 47.470000, 126.970000},
-    {"YBBQB6TMV95Z", "黑龙江省/大兴安岭地区", "黑龙江/大兴安岭/大兴安岭", "Daxinganling", 50.420000, 124.120000},
-    {"Y9RJK4ZSEGWJ", "黑龙江省/大兴安岭地区/漠河市", "黑龙江/大兴安岭/漠河", "Mohe", 52.970000, 122.530000},
-    {"YBBNZ69JB91R", "黑龙江省/大兴安岭地区/加格达奇区", "黑龙江/大兴安岭/加格达奇", "Jiagedaqi", 50.420000, 124.070000},
-    {"YC4N3CPTNFUT", "黑龙江省/大兴安岭地区/呼玛县", "黑龙江/大兴安岭/呼玛", "Huma", 51.730000, 126.650000},
-    {"YC29TSEF0DGK", "黑龙江省/大兴安岭地区/塔河县", "黑龙江/大兴安岭/塔河", "Tahe", 52.320000, 124.700000},
-    {"WTW3SJ5ZBJUY", "上海市", "上海/上海", "Shanghai", 31.230000, 121.470000},
-    {"WTW3SMGJ8NHW", "上海市/黄浦区", "上海/黄浦", "Huangpu", 31.233735, 121.479956},
-    {"WTW37HNSSJ68", "上海市/徐汇区", "上海/徐汇区", "Xujiahui", 31.180000, 121.430000},
-    {"WTW3DGZ6DG22", "上海市/长宁区", "上海/长宁", "Changning", 31.222218, 121.419987},
-    {"WTW3GB8WWK6S", "上海市/静安区", "上海/静安", "Jingan", 31.249003, 121.454816},
-    {"WTW3F34NJJ19", "上海市/普陀区", "上海/普陀", "Putuo", 31.251667, 121.390903},
-    {"WTW3UGFJ7BJR", "上海市/虹口区", "上海/虹口", "Hongkou", 31.266619, 121.500717},
-    {"WTW3V712JSV7", "上海市/杨浦区", "上海/杨浦", "Yangpu", 31.261623, 121.521735},
-    {"WTW3414PNURY", "上海市/闵行区", "上海/闵行", "Minhang", 31.120000, 121.380000},
-    {"WTW6SK5N30JR", "上海市/宝山区", "上海/宝山", "Baoshan", 31.400000, 121.480000},
-    {"WTW4X8D1EZCZ", "上海市/嘉定区", "上海/嘉定", "Jiading", 31.380000, 121.270000},
-    {"WTW3T7RMWMB4", "上海市/浦东新区", "上海/浦东新区", "Pudong", 31.220000, 121.530000},
-    {"WTQQBVVG9ZMN", "上海市/金山区", "上海/金山", "Jinshan", 30.750000, 121.330000},
-    {"WTW0W2VDYEPR", "上海市/松江区", "上海/松江", "Songjiang", 31.030000, 121.220000},
-    {"WTW1HNSVUSCG", "上海市/青浦区", "上海/青浦", "Qingpu", 31.150000, 121.120000},
-    {"WTQRUHGF01UB", "上海市/奉贤区", "上海/奉贤", "Fengxian", 30.920000, 121.470000},
-    {"WTW7FS0ZC50Z", "上海市/崇明区", "上海/崇明", "Chongming", 31.620000, 121.400000},
-    {"WTSQQYHVQ973", "江苏省/南京市", "江苏/南京/南京", "Nanjing", 32.070000, 118.780000},
-    {"WTSQR4WJNP42", "江苏省/南京市/玄武区", "江苏/南京/玄武", "Xuanwu", 32.050762, 118.792680},
-    {"WTSQR0GVT2DZ", "江苏省/南京市/秦淮区", "江苏/南京/秦淮", "Qinhuai", 32.041201, 118.789559},
-    {"WTSQJDMYP91J", "江苏省/南京市/建邺区", "江苏/南京/建邺", "Jianye", 32.005583, 118.726482},
-    {"WTSQQTCEZ5DT", "江苏省/南京市/鼓楼区", "江苏/南京/鼓楼", "Gulou", 32.068382, 118.764571},
-    {"WTSQ7682Y34B", "江苏省/南京市/浦口区", "江苏/南京/浦口", "Pukou", 32.050000, 118.620000},
-    {"WTSQXKQHG41K", "江苏省/南京市/栖霞区", "江苏/南京/栖霞", "Qixia", 32.104251, 118.803537},
-    {"WTSQNB0QZZ03", "江苏省/南京市/雨花台区", "江苏/南京/雨花台", "Yuhuatai", 31.993384, 118.773870},
-    {"WTSTB2RFJXXJ", "江苏省/南京市/江宁区", "江苏/南京/江宁", "Jiangning", 31.950000, 118.850000},
-    {"WTU8011K7TN4", "江苏省/南京市/六合区", "江苏/南京/六合", "Luhe", 32.350000, 118.830000},
-    {"WTSSH3EWX58K", "江苏省/南京市/溧水区", "江苏/南京/溧水", "Lishui", 31.650000, 119.020000},
-    {"WTSD1PMY2Z2C", "江苏省/南京市/高淳区", "江苏/南京/高淳", "Gaochun", 31.330000, 118.880000},
-    {"WTTE97PU94T9", "江苏省/无锡市", "江苏/无锡/无锡", "Wuxi", 31.570000, 120.300000},
-    {"WTTEF8S5Q6BN", "江苏省/无锡市/锡山区", "江苏/无锡/锡山", "Xishan", 31.600000, 120.350000},
-    {"WTTS1REQ6G7M", "江苏省/无锡市/惠山区", "江苏/无锡/惠山", "Huishan", 31.682915, 120.293892},
-    {"WTTE2GZFGHHT", "江苏省/无锡市/滨湖区", "江苏/无锡/滨湖", "Binhu", 31.529883, 120.278112},
-    {"WTTE96Y2VC2D", "江苏省/无锡市/梁溪区", "江苏/无锡/梁溪", "Liangxi", 31.567976, 120.298137},
-    {"WTTE4V50PN9N", "江苏省/无锡市/新吴区", "江苏/无锡/新吴", "Xinwu", 31.492346, 120.359646},
-    {"WTTT2Z1YYP5B", "江苏省/无锡市/江阴市", "江苏/无锡/江阴", "Jiangyin", 31.900000, 120.270000},
-    {"WTT4QE46BRED", "江苏省/无锡市/宜兴市", "江苏/无锡/宜兴", "Yixing", 31.350000, 119.820000},
-    {"WW56FQXV5ZHB", "江苏省/徐州市", "江苏/徐州/徐州", "Xuzhou", 34.270000, 117.180000},
-    {"WW5746R8PEEU", "江苏省/徐州市/鼓楼区", "江苏/徐州/鼓楼", "Gulou", 34.289723, 117.179816},
-    {"WW56GGZFDN77", "江苏省/徐州市/云龙区", "江苏/徐州/云龙", "Yunlong", 34.254461, 117.245841},
-    {"WW5EBUURF35H", "江苏省/徐州市/贾汪区", "江苏/徐州/贾汪", "Jiawang", 34.436609, 117.460771},
-    {"WW56FDJWX2QH", "江苏省/徐州市/泉山区", "江苏/徐州/泉山", "Quanshan", 34.245503, 117.188048},
-    {"WW566Q28FVU3", "江苏省/徐州市/铜山区", "江苏/徐州/铜山", "Tongshan", 34.180000, 117.170000},
-    {"WW4VMKCW0UVD", "江苏省/徐州市/丰县", "江苏/徐州/丰县", "Fengxian", 34.700000, 116.600000},
-    {"WW5JSF3UFMPR", "江苏省/徐州市/沛县", "江苏/徐州/沛县", "Peixian", 34.730000, 116.930000},
-    {"WW5BU529F4N8", "江苏省/徐州市/睢宁县", "江苏/徐州/睢宁", "Suining", 33.900000, 117.950000},
-    {"WWH5T4EY4BS0", "江苏省/徐州市/新沂市", "江苏/徐州/新沂", "Xinyi", 34.380000, 118.350000},
-    {"WW5GHPB86PWW", "江苏省/徐州市/邳州市", "江苏/徐州/邳州", "Pizhou", 34.320000, 117.950000},
-    {"WTTKC92GVT6S", "江苏省/常州市", "江苏/常州/常州", "Changzhou", 31.780000, 119.950000},
-    {"WTTKCCXTT1RS", "江苏省/常州市/天宁区", "江苏/常州/天宁", "Tianning", 31.781652, 119.970241},
-    {"WTTKBMF9SWCP", "江苏省/常州市/钟楼区", "江苏/常州/钟楼", "Zhonglou", 31.804342, 119.897427},
-    {"WTTM1FVWGGDE", "江苏省/常州市/新北区", "江苏/常州/新北", "Xinbei", 31.832690, 119.967434},
-    {"WTTK3N6Q7S9D", "江苏省/常州市/武进区", "江苏/常州/武进", "Wujin", 31.720000, 119.930000},
-    {"WTTH8GUJNUYP", "江苏省/常州市/金坛区", "江苏/常州/金坛", "Jintan", 31.750000, 119.570000},
-    {"WTSFWZFDVB90", "江苏省/常州市/溧阳市", "江苏/常州/溧阳", "Liyang", 31.420000, 119.480000},
-    {"WTTDPCGXTWUS", "江苏省/苏州市", "江苏/苏州/苏州", "Suzhou", 31.300000, 120.580000},
-    {"WTTDP3RN2FHT", "江苏省/苏州市/虎丘区", "江苏/苏州/虎丘", "Huqiu", 31.297014, 120.562630},
-    {"WTTCCH80FWRR", "江苏省/苏州市/吴中区", "江苏/苏州/吴中", "Wuzhong", 31.270000, 120.630000},
-    {"WTTF3NYNX9V0", "江苏省/苏州市/相城区", "江苏/苏州/相城", "Xiangcheng", 31.371212, 120.638451},
-    {"WTTF295B36E7", "江苏省/苏州市/姑苏区", "江苏/苏州/姑苏", "Gusu", 31.338558, 120.613118},
-    {"WTTC34246TPK", "江苏省/苏州市/吴江区", "江苏/苏州/吴江", "Wujiang", 31.170000, 120.630000},
-    {"WTTU59XQWGTU", "江苏省/苏州市/常熟市", "江苏/苏州/常熟", "Changshu", 31.650000, 120.750000},
-    {"WTTTR1VB4WE5", "江苏省/苏州市/张家港市", "江苏/苏州/张家港", "Zhangjiagang", 31.870000, 120.550000},
-    {"WTW48BWCWRFR", "江苏省/苏州市/昆山市", "江苏/苏州/昆山", "Kunshan", 31.380000, 120.980000},
-    {"WTW4GTQ3D8BV", "江苏省/苏州市/太仓市", "江苏/苏州/太仓", "Taicang", 31.450000, 121.100000},
-    {"WTTVYTY1H0HF", "江苏省/南通市", "江苏/南通/南通", "Nantong", 31.980000, 120.880000},
-    {"WTTYN5DEE05E", "江苏省/南通市/崇川区", "江苏/南通/崇川", "Chongchuan", 32.012015, 120.853176},
-    {"WTTYJPWNWDG6", "江苏省/南通市/港闸区", "江苏/南通/港闸", "Gangzha", 32.034517, 120.814187},
-    {"WTWN7PBRX3RJ", "江苏省/南通市/通州区", "江苏/南通/通州", "Tongzhou", 32.080000, 121.070000},
-    {"WTWPVE8TDSTJ", "江苏省/南通市/如东县", "江苏/南通/如东", "Rudong", 32.320000, 121.180000},
-    {"WTWT00WUFMYT", "江苏省/南通市/启东市", "江苏/南通/启东", "Qidong", 31.820000, 121.650000},
-    {"WTV8RDHRSTU0", "江苏省/南通市/如皋市", "江苏/南通/如皋", "Rugao", 32.400000, 120.570000},
-    {"WTWJMR1QCXH8", "江苏省/南通市/海门市", "江苏/南通/海门", "Haimen", 31.900000, 121.170000},
-    {"WTV9HVT12RV9", "江苏省/南通市/海安市", "江苏/南通/海安", "Haian", 32.550000, 120.450000},
-    {"WWHUBFTRE77P", "江苏省/连云港市", "江苏/连云港/连云港", "Lianyungang", 34.600000, 119.220000},
-    {"WWHVG800SD6K", "江苏省/连云港市/连云区", "江苏/连云港/连云", "Lianyun", 34.760841, 119.333693},
-    {"WWHUBHNHSXN8", "江苏省/连云港市/海州区", "江苏/连云港/海州", "Haizhou", 34.607744, 119.188129},
-    {"WWHWNSSE3NTF", "江苏省/连云港市/赣榆区", "江苏/连云港/赣榆", "Ganyu", 34.830000, 119.120000},
-    {"WWHKQTVXVDDC", "江苏省/连云港市/东海县", "江苏/连云港/东海", "Donghai", 34.530000, 118.770000},
-    {"WWHG1S55YRKV", "江苏省/连云港市/灌云县", "江苏/连云港/灌云", "Guanyun", 34.300000, 119.250000},
-    {"WWHCGUH42S6N", "江苏省/连云港市/灌南县", "江苏/连云港/灌南", "Guannan", 34.080000, 119.350000},
-    {"WTUXK27DXN0R", "江苏省/淮安市", "江苏/淮安/淮安", "Huaian", 33.620000, 119.020000},
-    {"WTUYDYQNZ73S", "江苏省/淮安市/淮安区", "江苏/淮安/淮安区", "Huaianqu", 33.521837, 119.309090},
-    {"WTUXKD5HBN2U", "江苏省/淮安市/淮阴区", "江苏/淮安/淮阴区", "Huaiyinqu", 33.630000, 119.030000},
-    {"WTUWUKKSCM9V", "江苏省/淮安市/清江浦区", "江苏/淮安/清江浦", "Qingjiangpu", 33.554465, 119.021129},
-    {"WTUT2N16E9YJ", "江苏省/淮安市/洪泽区", "江苏/淮安/洪泽", "Hongze", 33.300000, 118.830000},
-    {"WWHB4J3YB2MU", "江苏省/淮安市/涟水县", "江苏/淮安/涟水", "Lianshui", 33.780000, 119.270000},
-    {"WTU78P6WBJG5", "江苏省/淮安市/盱眙县", "江苏/淮安/盱眙", "Xuyi", 33.000000, 118.480000},
-    {"WTUEU75ERN0K", "江苏省/淮安市/金湖县", "江苏/淮安/金湖", "Jinhu", 33.020000, 119.020000},
-    {"WTVMWP4TCFT7", "江苏省/盐城市", "江苏/盐城/盐城", "Yancheng", 33.350000, 120.150000},
-    {"WTVMZNCD8D11", "江苏省/盐城市/亭湖区", "江苏/盐城/亭湖", "Tinghu", 33.392011, 120.192513},
-    {"WTVMW5D93FM6", "江苏省/盐城市/盐都区", "江苏/盐城/盐都", "Yandu", 33.330000, 120.150000},
-    {"WTVSV7GS42WD", "江苏省/盐城市/大丰区", "江苏/盐城/大丰", "Dafeng", 33.200000, 120.470000},
-    {"WWJ48CUJQYN4", "江苏省/盐城市/响水县", "江苏/盐城/响水", "Xiangshui", 34.200000, 119.570000},
-    {"WWJ1QCCEC7H5", "江苏省/盐城市/滨海县", "江苏/盐城/滨海", "Binhai", 33.980000, 119.830000},
-    {"WWJ0NJ7WY26S", "江苏省/盐城市/阜宁县", "江苏/盐城/阜宁", "Funing", 33.780000, 119.800000},
-    {"WWJ80M7QU06U", "江苏省/盐城市/射阳县", "江苏/盐城/射阳", "Sheyang", 33.780000, 120.250000},
-    {"WTVNQJ58YK4W", "江苏省/盐城市/建湖县", "江苏/盐城/建湖", "Jianhu", 33.470000, 119.800000},
-    {"WTVDCKPV15VD", "江苏省/盐城市/东台市", "江苏/盐城/东台", "Dongtai", 32.850000, 120.300000},
-    {"WTUBM40RTTUB", "江苏省/扬州市", "江苏/扬州/扬州", "Yangzhou", 32.400000, 119.400000},
-    {"WTUBM9EEUXN3", "江苏省/扬州市/广陵区", "江苏/扬州/广陵", "Guangling", 32.396617, 119.426395},
-    {"WTUBJN87JTKZ", "江苏省/扬州市/邗江区", "江苏/扬州/邗江", "Hanjiang", 32.380000, 119.400000},
-    {"WTV02RTWKYJJ", "江苏省/扬州市/江都区", "江苏/扬州/江都", "Jiangdu", 32.430000, 119.550000},
-    {"WTUV49RDG2ZX", "江苏省/扬州市/宝应县", "江苏/扬州/宝应", "Baoying", 33.230000, 119.300000},
-    {"WTSZ8484RK10", "江苏省/扬州市/仪征市", "江苏/扬州/仪征", "Yizheng", 32.270000, 119.180000},
-    {"WTUFMXQM2DYS", "江苏省/扬州市/高邮市", "江苏/扬州/高邮", "Gaoyou", 32.780000, 119.430000},
-    {"WTSZNJUFDEP9", "江苏省/镇江市", "江苏/镇江/镇江", "Zhenjiang", 32.200000, 119.450000},
-    {"WTSZNMZSH2F7", "江苏省/镇江市/京口区", "江苏/镇江/京口", "Jingkou", 32.200246, 119.464831},
-    {"WTSZJJM4K9X5", "江苏省/镇江市/润州区", "江苏/镇江/润州", "Runzhou", 32.197203, 119.406483},
-    {"WTSYY1HFFDPE", "江苏省/镇江市/丹徒区", "江苏/镇江/丹徒", "Dantu", 32.130000, 119.450000},
-    {"WTTN0CKJWBQ5", "江苏省/镇江市/丹阳市", "江苏/镇江/丹阳", "Danyang", 32.000000, 119.570000},
-    {"WTTPQE63277W", "江苏省/镇江市/扬中市", "江苏/镇江/扬中", "Yangzhong", 32.230000, 119.820000},
-    {"WTSTZB2FNR8M", "江苏省/镇江市/句容市", "江苏/镇江/句容", "Jurong", 31.950000, 119.170000},
-    {"WTV28G74FW3J", "江苏省/泰州市", "江苏/泰州/泰州", "Taizhou", 32.450000, 119.920000},
-    {"WTV2BEPNYDNT", "江苏省/泰州市/海陵区", "江苏/泰州/海陵", "Hailing", 32.493236, 119.914686},
-    {"WTTPZGGEZ968", "江苏省/泰州市/高港区", "江苏/泰州/高港", "Gaogang", 32.321055, 119.876958},
-    {"WTV3N04D9ZMK", "江苏省/泰州市/姜堰区", "江苏/泰州/姜堰", "Jiangyan", 32.520000, 120.150000},
-    {"WTV5R2BHGKV1", "江苏省/泰州市/兴化市", "江苏/泰州/兴化", "Xinghua", 32.920000, 119.850000},
-    {"WTTW0V1FN0EU", "江苏省/泰州市/靖江市", "江苏/泰州/靖江", "Jingjiang", 32.020000, 120.270000},
-    {"WTTR507GUDWK", "江苏省/泰州市/泰兴市", "江苏/泰州/泰兴", "Taixing", 32.170000, 120.020000},
-    {"WWH1780CEFBR", "江苏省/宿迁市", "江苏/宿迁/宿迁", "Suqian", 33.970000, 118.280000},
-    {"WWH14X18FKV8", "江苏省/宿迁市/宿城区", "江苏/宿迁/宿城", "Sucheng", 33.964388, 118.237027},
-    {"WWH1HKMVPFDW", "江苏省/宿迁市/宿豫区", "江苏/宿迁/宿豫", "Suyu", 33.950000, 118.320000},
-    {"WWH6NTJTTT4U", "江苏省/宿迁市/沭阳县", "江苏/宿迁/沭阳", "Shuyang", 34.130000, 118.770000},
-    {"WTURUDS1HRTG", "江苏省/宿迁市/泗阳县", "江苏/宿迁/泗阳", "Siyang", 33.720000, 118.680000},
-    {"WTUN6JJ0VSJN", "江苏省/宿迁市/泗洪县", "江苏/宿迁/泗洪", "Sihong", 33.470000, 118.220000},
-    {"WTMKQ069CCJ7", "浙江省/杭州市", "浙江/杭州/杭州", "Hangzhou", 30.280000, 120.150000},
-    {"WTMKN3V5ZZP4", "浙江省/杭州市/上城区", "浙江/杭州/上城", "Shangcheng", 30.244670, 120.164679},
-    {"WTMKQ9J9W5W9", "浙江省/杭州市/下城区", "浙江/杭州/下城", "Xiacheng", 30.284090, 120.176277},
-    {"WTMKPHX3CWBD", "浙江省/杭州市/江干区", "浙江/杭州/江干", "Jianggan", 30.259431, 120.200451},
-    {"WTMKMZBFE71F", "浙江省/杭州市/拱墅区", "浙江/杭州/拱墅", "Gongshu", 30.321338, 120.136670},
-    {"WTMKJSBWTWPD", "浙江省/杭州市/西湖区", "浙江/杭州/西湖", "Xihu", 30.261616, 120.125445},
-    {"WTM7Z7SRBC17", "浙江省/杭州市/滨江区", "浙江/杭州/滨江", "Binjiang", 30.210992, 120.207286},
-    {"WTME8U3BYPEU", "浙江省/杭州市/萧山区", "浙江/杭州/萧山", "Xiaoshan", 30.170000, 120.270000},
-    {"WTMT13ZC35J8", "浙江省/杭州市/余杭区", "浙江/杭州/余杭", "Yuhang", 30.420000, 120.300000},
-    {"WTM6CW2VVW48", "浙江省/杭州市/富阳区", "浙江/杭州/富阳", "Fuyang", 30.050000, 119.950000},
-    {"WTM5UR1QW0QN", "浙江省/杭州市/临安区", "浙江/杭州/临安", "Linan", 30.230000, 119.720000},
-    {"WTM1E0VJ94EK", "浙江省/杭州市/桐庐县", "浙江/杭州/桐庐", "Tonglu", 29.800000, 119.670000},
-    {"WTK8KSE02PBV", "浙江省/杭州市/淳安县", "浙江/杭州/淳安", "Chunan", 29.600000, 119.030000},
-    {"WTHZDQ9J3QQ3", "浙江省/杭州市/建德市", "浙江/杭州/建德", "Jiande", 29.480000, 119.280000},
-    {"WTQ3VZQP879N", "浙江省/宁波市", "浙江/宁波/宁波", "Ningbo", 29.880000, 121.550000},
-    {"WTQ3VU7BB6FN", "浙江省/宁波市/海曙区", "浙江/宁波/海曙", "Haishu", 29.862358, 121.546911},
-    {"WTQ6JCNY16W8", "浙江省/宁波市/江北区", "浙江/宁波/江北", "Jiangbei", 29.889349, 121.551080},
-    {"WTQDKB86YU3K", "浙江省/宁波市/北仑区", "浙江/宁波/北仑", "Beilun", 29.930000, 121.850000},
-    {"WTQD3U1Z3SDM", "浙江省/宁波市/镇海区", "浙江/宁波/镇海", "Zhenhai", 29.950000, 121.720000},
-    {"WTQ3TQRKQ701", "浙江省/宁波市/鄞州区", "浙江/宁波/鄞州", "Yinzhou", 29.830000, 121.530000},
-    {"WTQ2DT8GC08G", "浙江省/宁波市/奉化区", "浙江/宁波/奉化", "Fenghua", 29.650000, 121.400000},
-    {"WTNXTNXJ2Y63", "浙江省/宁波市/象山县", "浙江/宁波/象山", "Xiangshan", 29.480000, 121.870000},
-    {"WTNQE4Q8K5DE", "浙江省/宁波市/宁海县", "浙江/宁波/宁海", "Ninghai", 29.280000, 121.430000},
-    {"WTQ4UFF9RTER", "浙江省/宁波市/余姚市", "浙江/宁波/余姚", "Yuyao", 30.030000, 121.150000},
-    {"WTQ5WSKBZXXU", "浙江省/宁波市/慈溪市", "浙江/宁波/慈溪", "Cixi", 30.170000, 121.230000},
-    {"WSVZ695PCF71", "浙江省/温州市", "浙江/温州/温州", "Wenzhou", 28.000000, 120.700000},
-    {"WSVZ3KXMRYFJ", "浙江省/温州市/鹿城区", "浙江/温州/鹿城", "Lucheng", 28.018822, 120.651161},
-    {"WSVYVJ955QS4", "浙江省/温州市/龙湾区", "浙江/温州/龙湾", "Longwan", 27.936036, 120.807182},
-    {"WSVZ0EF4XCF7", "浙江省/温州市/瓯海区", "浙江/温州/瓯海", "Ouhai", 27.970257, 120.610992},
-    {"WSYNKF69X852", "浙江省/温州市/洞头区", "浙江/温州/洞头", "Dongtou", 27.830000, 121.150000},
-    {"WTJB4HS3XU64", "浙江省/温州市/永嘉县", "浙江/温州/永嘉", "Yongjia", 28.150000, 120.680000},
-    {"WSVTRTHMKTU5", "浙江省/温州市/平阳县", "浙江/温州/平阳", "Pingyang", 27.670000, 120.570000},
-    {"WSVS7Y0X57DC", "浙江省/温州市/苍南县", "浙江/温州/苍南", "Cangnan", 27.500000, 120.400000},
-    {"WSVQH3PW4Z3D", "浙江省/温州市/文成县", "浙江/温州/文成", "Wencheng", 27.780000, 120.080000},
-    {"WSVHU6CQYHW0", "浙江省/温州市/泰顺县", "浙江/温州/泰顺", "Taishun", 27.570000, 119.720000},
-    {"WSVY110N4XR6", "浙江省/温州市/瑞安市", "浙江/温州/瑞安", "Ruian", 27.780000, 120.630000},
-    {"WTN002CJ5K0D", "浙江省/温州市/乐清市", "浙江/温州/乐清", "Yueqing", 28.130000, 120.950000},
-    {"WTMYGTZ7WZMY", "浙江省/嘉兴市", "浙江/嘉兴/嘉兴", "Jiaxing", 30.750000, 120.750000},
-    {"WTMYUMUKSM74", "浙江省/嘉兴市/南湖区", "浙江/嘉兴/南湖", "Nanhu", 30.750160, 120.778728},
-    {"WTMZ49N98592", "浙江省/嘉兴市/秀洲区", "浙江/嘉兴/秀洲", "Xiuzhou", 30.767488, 120.704729},
-    {"WTMZX85620Z4", "浙江省/嘉兴市/嘉善县", "浙江/嘉兴/嘉善", "Jiashan", 30.850000, 120.920000},
-    {"WTQJ8MC45K2X", "浙江省/嘉兴市/海盐县", "浙江/嘉兴/海盐", "Haiyan", 30.530000, 120.950000},
-    {"WTMVDJU6PU6P", "浙江省/嘉兴市/海宁市", "浙江/嘉兴/海宁", "Haining", 30.530000, 120.680000},
-    {"WTQN9UU06QU3", "浙江省/嘉兴市/平湖市", "浙江/嘉兴/平湖", "Pinghu", 30.700000, 121.020000},
-    {"WTMWR8H2STU5", "浙江省/嘉兴市/桐乡市", "浙江/嘉兴/桐乡", "Tongxiang", 30.630000, 120.570000},
-    {"WTMRU3PTDC3X", "浙江省/湖州市", "浙江/湖州/湖州", "Huzhou", 30.900000, 120.080000},
-    {"WTMRWCC28EGN", "浙江省/湖州市/吴兴区", "浙江/湖州/吴兴", "Wuxing", 30.859330, 120.181185},
-    {"WTMXS06SWBWE", "浙江省/湖州市/南浔区", "浙江/湖州/南浔", "Nanxun", 30.851758, 120.413888},
-    {"WTMM9VZ6PS7X", "浙江省/湖州市/德清县", "浙江/湖州/德清", "Deqing", 30.530000, 119.970000},
-    {"WTT22RH887PG", "浙江省/湖州市/长兴县", "浙江/湖州/长兴", "Changxing", 31.020000, 119.900000},
-    {"WTMN72H2DJU5", "浙江省/湖州市/安吉县", "浙江/湖州/安吉", "Anji", 30.630000, 119.680000},
-    {"WTMDXTK6STK4", "浙江省/绍兴市", "浙江/绍兴/绍兴", "Shaoxing", 30.000000, 120.570000},
-    {"WTMDXGDTS1BB", "浙江省/绍兴市/越城区", "浙江/绍兴/越城", "Yuecheng", 29.990883, 120.578557},
-    {"WTMEJ7UZ1MF4", "浙江省/绍兴市/柯桥区", "浙江/绍兴/柯桥", "Keqiao", 30.080426, 120.471668},
-    {"WTMFY6YC7JSR", "浙江省/绍兴市/上虞区", "浙江/绍兴/上虞", "Shangyu", 30.030000, 120.870000},
-    {"WTJZZ4K9YNTF", "浙江省/绍兴市/新昌县", "浙江/绍兴/新昌", "Xinchang", 29.500000, 120.900000},
-    {"WTM3PFKGD19C", "浙江省/绍兴市/诸暨市", "浙江/绍兴/诸暨", "Zhuji", 29.720000, 120.230000},
-    {"WTMBM2F7YP9T", "浙江省/绍兴市/嵊州市", "浙江/绍兴/嵊州", "Shengzhou", 29.580000, 120.820000},
-    {"WTJJ6TY7R0FK", "浙江省/金华市", "浙江/金华/金华", "Jinhua", 29.080000, 119.650000},
-    {"WTJJ2Z9CP0HZ", "浙江省/金华市/婺城区", "浙江/金华/婺城", "Wucheng", 29.089223, 119.566919},
-    {"WTJJE9F5QTST", "浙江省/金华市/金东区", "浙江/金华/金东", "Jindong", 29.101998, 119.688090},
-    {"WTJHQT468Q7X", "浙江省/金华市/武义县", "浙江/金华/武义", "Wuyi", 28.900000, 119.820000},
-    {"WTJPXCJYWMYU", "浙江省/金华市/浦江县", "浙江/金华/浦江", "Pujiang", 29.450000, 119.880000},
-    {"WTJTK2QKW2KX", "浙江省/金华市/磐安县", "浙江/金华/磐安", "Panan", 29.050000, 120.430000},
-    {"WTHYNPKFFDZ9", "浙江省/金华市/兰溪市", "浙江/金华/兰溪", "Lanxi", 29.220000, 119.450000},
-    {"WTJQSMBKCGCH", "浙江省/金华市/义乌市", "浙江/金华/义乌", "Yiwu", 29.300000, 120.070000},
-    {"WTJQXFKB659G", "浙江省/金华市/东阳市", "浙江/金华/东阳", "Dongyang", 29.280000, 120.230000},
-    {"WTJK7M54TWQZ", "浙江省/金华市/永康市", "浙江/金华/永康", "Yongkang", 28.900000, 120.030000},
-    {"WTHS8FW3RYBK", "浙江省/衢州市", "浙江/衢州/衢州", "Quzhou", 28.930000, 118.870000},
-    {"WTHSBF5GZDBN", "浙江省/衢州市/柯城区", "浙江/衢州/柯城", "Kecheng", 28.971607, 118.866556},
-    {"WTHSF7DHTZE9", "浙江省/衢州市/衢江区", "浙江/衢州/衢江", "Qujiang", 28.980000, 118.930000},
-    {"WTHK2VPDSNMR", "浙江省/衢州市/常山县", "浙江/衢州/常山", "Changshan", 28.900000, 118.520000},
-    {"WTHJWWYY9CXF", "浙江省/衢州市/开化县", "浙江/衢州/开化", "Kaihua", 29.130000, 118.420000},
-    {"WTHTPUBBN20R", "浙江省/衢州市/龙游县", "浙江/衢州/龙游", "Longyou", 29.030000, 119.170000},
-    {"WTH7E3B2YK6Y", "浙江省/衢州市/江山市", "浙江/衢州/江山", "Jiangshan", 28.750000, 118.620000},
-    {"WTQFSTR6DMK4", "浙江省/舟山市", "浙江/舟山/舟山", "Zhoushan", 30.000000, 122.200000},
-    {"WTQFF2YX0JWG", "浙江省/舟山市/定海区", "浙江/舟山/定海", "Dinghai", 30.020000, 122.100000},
-    {"WTQFRH0PKS9T", "浙江省/舟山市/普陀区", "浙江/舟山/普陀", "Putuo", 29.950000, 122.300000},
-    {"WTQUHDZ742SN", "浙江省/舟山市/岱山县", "浙江/舟山/岱山", "Daishan", 30.250000, 122.200000},
-    {"WTRNF6JR5Z1W", "浙江省/舟山市/嵊泗县", "浙江/舟山/嵊泗", "Shengsi", 30.730000, 122.450000},
-    {"WTN74CS48NB0", "浙江省/台州市", "浙江/台州/台州", "Taizhou", 28.661049, 121.415405},
-    {"WTN75JN9H56X", "浙江省/台州市/椒江区", "浙江/台州/椒江", "Jiaojiang", 28.680000, 121.430000},
-    {"WTN4ZXD47G1F", "浙江省/台州市/黄岩区", "浙江/台州/黄岩", "Huangyan", 28.650000, 121.270000},
-    {"WTN6D4F4WFPU", "浙江省/台州市/路桥区", "浙江/台州/路桥", "Luqiao", 28.580000, 121.380000},
-    {"WTNMDJ4HQCRY", "浙江省/台州市/三门县", "浙江/台州/三门", "Sanmen", 29.120000, 121.380000},
-    {"WTNJDNGQE3SF", "浙江省/台州市/天台县", "浙江/台州/天台", "Tiantai", 29.130000, 121.030000},
-    {"WTJU5R8GUYHF", "浙江省/台州市/仙居县", "浙江/台州/仙居", "Xianju", 28.870000, 120.730000},
-    {"WTN33UDGJZR3", "浙江省/台州市/温岭市", "浙江/台州/温岭", "Wenling", 28.370000, 121.370000},
-    {"WTNHH5UZKTCC", "浙江省/台州市/临海市", "浙江/台州/临海", "Linhai", 28.850000, 121.120000},
-    {"WTN0N8UVPSPF", "浙江省/台州市/玉环市", "浙江/台州/玉环", "Yuhuan", 28.130000, 121.230000},
-    {"WTJ3BG5J683H", "浙江省/丽水市", "浙江/丽水/丽水", "Lishui", 28.450000, 119.920000},
-    {"WTJ3BE42ZV8K", "浙江省/丽水市/莲都区", "浙江/丽水/莲都", "Liandou", 28.449256, 119.908208},
-    {"WTJ81H91XHK6", "浙江省/丽水市/青田县", "浙江/丽水/青田", "Qingtian", 28.150000, 120.280000},
-    {"WTJ6UR863G14", "浙江省/丽水市/缙云县", "浙江/丽水/缙云", "Jinyun", 28.650000, 120.070000},
-    {"WTHFDN3Z06MV", "浙江省/丽水市/遂昌县", "浙江/丽水/遂昌", "Suichang", 28.600000, 119.270000},
-    {"WTHCYG4TMB3H", "浙江省/丽水市/松阳县", "浙江/丽水/松阳", "Songyang", 28.450000, 119.480000},
-    {"WSVPBZH4YGYJ", "浙江省/丽水市/云和县", "浙江/丽水/云和", "Yunhe", 28.120000, 119.570000},
-    {"WSUTJH1D4J1V", "浙江省/丽水市/庆元县", "浙江/丽水/庆元", "Qingyuan", 27.620000, 119.050000},
-    {"WSVP4JXGM413", "浙江省/丽水市/景宁畲族自治县", "浙江/丽水/景宁", "Jingning", 27.980000, 119.630000},
-    {"WSUXWZGCF5QK", "浙江省/丽水市/龙泉市", "浙江/丽水/龙泉", "Longquan", 28.080000, 119.130000},
-    {"WTEMH46Z5N09", "安徽省/合肥市", "安徽/合肥/合肥", "Hefei", 31.830000, 117.250000},
-    {"WTEMJRCVVPNG", "安徽省/合肥市/瑶海区", "安徽/合肥/瑶海", "Yaohai", 31.860003, 117.303653},
-    {"WTEMK79QR10U", "安徽省/合肥市/庐阳区", "安徽/合肥/庐阳", "Luyang", 31.880657, 117.259098},
-    {"WTEMHNWW0T6B", "安徽省/合肥市/蜀山区", "安徽/合肥/蜀山", "Shushan", 31.853170, 117.255046},
-    {"WTEKVK45X268", "安徽省/合肥市/包河区", "安徽/合肥/包河", "Baohe", 31.795036, 117.304087},
-    {"WTG2F2B9DYU6", "安徽省/合肥市/长丰县", "安徽/合肥/长丰", "Changfeng", 32.480000, 117.170000},
-    {"WTET35E43QSX", "安徽省/合肥市/肥东县", "安徽/合肥/肥东", "Feidong", 31.880000, 117.470000},
-    {"WTEK6Q2W6US6", "安徽省/合肥市/肥西县", "安徽/合肥/肥西", "Feixi", 31.720000, 117.170000},
-    {"WTE3UBBSQN4R", "安徽省/合肥市/庐江县", "安徽/合肥/庐江", "Lujiang", 31.250000, 117.280000},
-    {"WTEGF0W764FN", "安徽省/合肥市/巢湖市", "安徽/合肥/巢湖", "Chaohu", 31.600000, 117.870000},
-    {"WTS4JZ3WMZMC", "安徽省/芜湖市", "安徽/芜湖/芜湖", "Wuhu", 31.330000, 118.380000},
-    {"WTS4MC9MZDPC", "安徽省/芜湖市/镜湖区", "安徽/芜湖/镜湖", "Jinghu", 31.342246, 118.379735},
-    {"WTS4JS2RHCZP", "安徽省/芜湖市/弋江区", "安徽/芜湖/弋江", "Yijiang", 31.313621, 118.367256},
-    {"WTS4MYYQ3PU2", "安徽省/芜湖市/鸠江区", "安徽/芜湖/鸠江", "Jiujiang", 31.371201, 118.386318},
-    {"WTS1E5SRHQ7U", "安徽省/芜湖市/三山区", "安徽/芜湖/三山", "Sanshan", 31.221634, 118.262860},
-    {"WTS34NSJCKB5", "安徽省/芜湖市/芜湖县", "安徽/芜湖/芜湖县", "Wuhuxian", 31.150000, 118.570000},
-    {"WTS0C9YW5EUJ", "安徽省/芜湖市/繁昌县", "安徽/芜湖/繁昌", "Fanchang", 31.080000, 118.200000},
-    {"WTKPUSV60CG0", "安徽省/芜湖市/南陵县", "安徽/芜湖/南陵", "Nanling", 30.920000, 118.330000},
-    {"WTEF53FXXNUU", "安徽省/芜湖市/无为县", "安徽/芜湖/无为", "Wuwei", 31.300000, 117.920000},
-    {"WTG7R0CSBHZ9", "安徽省/蚌埠市", "安徽/蚌埠/蚌埠", "Bengbu", 32.920000, 117.380000},
-    {"WTG7RJRKC1JS", "安徽省/蚌埠市/龙子湖区", "安徽/蚌埠/龙子湖", "Longzihu", 32.944700, 117.387936},
-    {"WTG7QTS5ZCZY", "安徽省/蚌埠市/蚌山区", "安徽/蚌埠/蚌山", "Bangshan", 32.945906, 117.361794},
-    {"WTG7Q4CZWYZ0", "安徽省/蚌埠市/禹会区", "安徽/蚌埠/禹会", "Yuhui", 32.931469, 117.336687},
-    {"WTG7W3QPX264", "安徽省/蚌埠市/淮上区", "安徽/蚌埠/淮上", "Huaishang", 32.967140, 117.353525},
-    {"WTG7D6PB5VKY", "安徽省/蚌埠市/怀远县", "安徽/蚌埠/怀远", "Huaiyuan", 32.970000, 117.180000},
-    {"WTGUD6V8EPFU", "安徽省/蚌埠市/五河县", "安徽/蚌埠/五河", "Wuhe", 33.150000, 117.880000},
-    {"WTGMT9TZ44HQ", "安徽省/蚌埠市/固镇县", "安徽/蚌埠/固镇", "Guzhen", 33.320000, 117.320000},
-    {"WTG1WKHG98G5", "安徽省/淮南市", "安徽/淮南/淮南", "Huainan", 32.630000, 117.000000},
-    {"WTG1XKXRXCUK", "安徽省/淮南市/大通区", "安徽/淮南/大通", "Datong", 32.633439, 117.047648},
-    {"WTG1WXT7P1DE", "安徽省/淮南市/田家庵区", "安徽/淮南/田家庵", "Tianjiaan", 32.649144, 117.011908},
-    {"WTG17P43HDN1", "安徽省/淮南市/谢家集区", "安徽/淮南/谢家集", "Xiejiaji", 32.602111, 116.853877},
-    {"WTG1DKZB05SG", "安徽省/淮南市/八公山区", "安徽/淮南/八公山", "Bagongshan", 32.633534, 116.828277},
-    {"WTG46R3TR6CK", "安徽省/淮南市/潘集区", "安徽/淮南/潘集", "Panji", 32.780000, 116.820000},
-    {"WTG400BGM1U4", "安徽省/淮南市/凤台县", "安徽/淮南/凤台", "Fengtai", 32.700000, 116.720000},
-    {"WTG137H870PQ", "安徽省/淮南市/寿县", "安徽/淮南/寿县", "Shouxian", 32.580000, 116.780000},
-    {"WTSK2DC1FHK3", "安徽省/马鞍山市", "安徽/马鞍山/马鞍山", "Maanshan", 31.700000, 118.500000},
-    {"WTSK2NZB4F92", "安徽省/马鞍山市/花山区", "安徽/马鞍山/花山", "Huashan", 31.721663, 118.487325},
-    {"WTSK0RUJXNMJ", "安徽省/马鞍山市/雨山区", "安徽/马鞍山/雨山", "Yushan", 31.684176, 118.493349},
-    {"WTSE832M8GRH", "安徽省/马鞍山市/博望区", "安徽/马鞍山/博望", "Bowang", 31.560563, 118.839496},
-    {"WTS72PD80470", "安徽省/马鞍山市/当涂县", "安徽/马鞍山/当涂", "Dangtu", 31.550000, 118.480000},
-    {"WTEURQMY3KWD", "安徽省/马鞍山市/含山县", "安徽/马鞍山/含山", "Hanshan", 31.720000, 118.100000},
-    {"WTSHMW6QKUT4", "安徽省/马鞍山市/和县", "安徽/马鞍山/和县", "Hexian", 31.720000, 118.370000},
-    {"WW511U7JJ68Q", "安徽省/淮北市", "安徽/淮北/淮北", "Huaibei", 33.950000, 116.800000},
-    {"WW516K5Z0HHM", "安徽省/淮北市/杜集区", "安徽/淮北/杜集", "Duji", 33.992923, 116.822783},
-    {"WW511W7NGXEQ", "安徽省/淮北市/相山区", "安徽/淮北/相山", "Xiangshan", 33.961314, 116.788943},
-    {"WW50F48Y0143", "安徽省/淮北市/烈山区", "安徽/淮北/烈山", "Lieshan", 33.896604, 116.807674},
-    {"WW50CNVQ64QC", "安徽省/淮北市/濉溪县", "安徽/淮北/濉溪", "Suixi", 33.920000, 116.770000},
-    {"WT7ZCN9UKCZS", "安徽省/铜陵市", "安徽/铜陵/铜陵", "Tongling", 30.930000, 117.820000},
-    {"WTEB1B0QM30H", "安徽省/铜陵市/铜官区", "安徽/铜陵/铜官", "Tongguan", 30.938579, 117.850911},
-    {"WTEB071JWRYP", "安徽省/铜陵市/义安区", "安徽/铜陵/义安", "Yian", 30.954966, 117.786073},
-    {"WT7ZBEHWGP9G", "安徽省/铜陵市/郊区", "安徽/铜陵/郊区", "Jiaoqu", 30.911234, 117.801721},
-    {"WT7QDUY2MYY1", "安徽省/铜陵市/枞阳县", "安徽/铜陵/枞阳", "Zongyang", 30.700000, 117.200000},
-    {"WT7JXTC4NSMZ", "安徽省/安庆市", "安徽/安庆/安庆", "Anqing", 30.530000, 117.050000},
-    {"WT7M86G5V7M9", "安徽省/安庆市/迎江区", "安徽/安庆/迎江", "Yingjiang", 30.513815, 117.085652},
-    {"WT7JYF8EW2Y7", "安徽省/安庆市/大观区", "安徽/安庆/大观", "Daguan", 30.556331, 117.016344},
-    {"WT7JZB7C371F", "安徽省/安庆市/宜秀区", "安徽/安庆/宜秀", "Yixiu", 30.543597, 117.064532},
-    {"WT7NF83HBR41", "安徽省/安庆市/怀宁县", "安徽/安庆/怀宁", "Huaining", 30.720000, 116.830000},
-    {"WT6YK858TVGG", "安徽省/安庆市/潜山市", "安徽/安庆/潜山", "Qianshan", 30.630000, 116.570000},
-    {"WT6TJG95X75S", "安徽省/安庆市/太湖县", "安徽/安庆/太湖", "Taihu", 30.430000, 116.270000},
-    {"WT6ED2SH2P7E", "安徽省/安庆市/宿松县", "安徽/安庆/宿松", "Susong", 30.150000, 116.120000},
-    {"WT6GRHGZCP1F", "安徽省/安庆市/望江县", "安徽/安庆/望江", "Wangjiang", 30.130000, 116.680000},
-    {"WT6XX856R8B4", "安徽省/安庆市/岳西县", "安徽/安庆/岳西", "Yuexi", 30.850000, 116.350000},
-    {"WTE0TK2RKE82", "安徽省/安庆市/桐城市", "安徽/安庆/桐城", "Tongcheng", 31.050000, 116.950000},
-    {"WTK1H2DTJ1U4", "安徽省/黄山市", "安徽/黄山/黄山", "Huangshan", 29.710646, 118.315421},
-    {"WTK1HDM78CE1", "安徽省/黄山市/屯溪区", "安徽/黄山/屯溪", "Tunxi", 29.720000, 118.330000},
-    {"WTKH25GWK92K", "安徽省/黄山市/黄山区", "安徽/黄山/黄山区", "Huangshanqu", 30.300000, 118.130000},
-    {"WTK1SWQ6KSMG", "安徽省/黄山市/徽州区", "安徽/黄山/徽州", "Huizhou", 29.829664, 118.331538},
-    {"WTK1YVWJ7586", "安徽省/黄山市/歙县", "安徽/黄山/歙县", "Shexian", 29.870000, 118.430000},
-    {"WTK13M211D6G", "安徽省/黄山市/休宁县", "安徽/黄山/休宁", "Xiuning", 29.780000, 118.180000},
-    {"WT7F78D4BHMK", "安徽省/黄山市/黟县", "安徽/黄山/黟县", "Yixian", 29.930000, 117.930000},
-    {"WT79YV9J6GD4", "安徽省/黄山市/祁门县", "安徽/黄山/祁门", "Qimen", 29.870000, 117.720000},
-    {"WTSPU2JCPU6T", "安徽省/滁州市", "安徽/滁州/滁州", "Chuzhou", 32.300000, 118.320000},
-    {"WTSPEZRV0DD3", "安徽省/滁州市/琅琊区", "安徽/滁州/琅琊", "Langya", 32.296557, 118.300462},
-    {"WTSPGVC6CSNS", "安徽省/滁州市/南谯区", "安徽/滁州/南谯", "Nanqiao", 32.331885, 118.291585},
-    {"WTU0WGQ4GN2M", "安徽省/滁州市/来安县", "安徽/滁州/来安", "Laian", 32.450000, 118.430000},
-    {"WTSNE79S49XY", "安徽省/滁州市/全椒县", "安徽/滁州/全椒", "Quanjiao", 32.100000, 118.270000},
-    {"WTG9J9USVXX2", "安徽省/滁州市/定远县", "安徽/滁州/定远", "Dingyuan", 32.530000, 117.670000},
-    {"WTGDGRGCES45", "安徽省/滁州市/凤阳县", "安徽/滁州/凤阳", "Fengyang", 32.870000, 117.570000},
-    {"WTUD5BV5KCZ6", "安徽省/滁州市/天长市", "安徽/滁州/天长", "Tianchang", 32.700000, 119.000000},
-    {"WTGFKXQMM6BH", "安徽省/滁州市/明光市", "安徽/滁州/明光", "Mingguang", 32.780000, 117.980000},
-    {"WTF75T383SE2", "安徽省/阜阳市", "安徽/阜阳/阜阳", "Fuyang", 32.900000, 115.820000},
-    {"WTF754S5EV8V", "安徽省/阜阳市/颍州区", "安徽/阜阳/颍州", "Yingzhou", 32.885458, 115.801554},
-    {"WTF7HRBMJFDV", "安徽省/阜阳市/颍东区", "安徽/阜阳/颍东", "Yingdong", 32.914538, 115.851424},
-    {"WTF774JHUPCK", "安徽省/阜阳市/颍泉区", "安徽/阜阳/颍泉", "Yingquan", 32.926883, 115.802938},
-    {"WTCUNS4QXWU9", "安徽省/阜阳市/临泉县", "安徽/阜阳/临泉", "Linquan", 33.070000, 115.250000},
-    {"WTFHWYRVM20T", "安徽省/阜阳市/太和县", "安徽/阜阳/太和", "Taihe", 33.170000, 115.620000},
-    {"WTF1WH4G90Y7", "安徽省/阜阳市/阜南县", "安徽/阜阳/阜南", "Funan", 32.630000, 115.580000},
-    {"WTF9TU15X2GE", "安徽省/阜阳市/颍上县", "安徽/阜阳/颍上", "Yingshang", 32.630000, 116.270000},
-    {"WTFJ0EHJ0C17", "安徽省/阜阳市/界首市", "安徽/阜阳/界首", "Jieshou", 33.240000, 115.340000},
-    {"WTGPMFNHZW6H", "安徽省/宿州市", "安徽/宿州/宿州", "Suzhou", 33.630000, 116.980000},
-    {"WTGPMU22MZ76", "安徽省/宿州市/埇桥区", "安徽/宿州/埇桥", "Yongqiao", 33.641592, 116.972030},
-    {"WW4EZ9GRP901", "安徽省/宿州市/砀山县", "安徽/宿州/砀山", "Dangshan", 34.420000, 116.350000},
-    {"WW54KY3BFMZ3", "安徽省/宿州市/萧县", "安徽/宿州/萧县", "Xiaoxian", 34.180000, 116.930000},
-    {"WTGWFGT6CT2C", "安徽省/宿州市/灵璧县", "安徽/宿州/灵璧", "Lingbi", 33.550000, 117.550000},
-    {"WTGY6QVE5H6G", "安徽省/宿州市/泗县", "安徽/宿州/泗县", "Sixian", 33.480000, 117.880000},
-    {"WTDUEP89WV0P", "安徽省/六安市", "安徽/六安/六安", "Luan", 31.770000, 116.500000},
-    {"WTDUEU1VNR0U", "安徽省/六安市/金安区", "安徽/六安/金安", "Jinan", 31.751385, 116.534655},
-    {"WTDUD6N3923E", "安徽省/六安市/裕安区", "安徽/六安/裕安", "Yuan", 31.739761, 116.474703},
-    {"WTDMMBFJSUSW", "安徽省/六安市/叶集区", "安徽/六安/叶集", "Yeji", 31.865441, 115.919705},
-    {"WTDXVV3PZKGD", "安徽省/六安市/霍邱县", "安徽/六安/霍邱", "Huoqiu", 32.330000, 116.270000},
-    {"WTE5HBCY43PQ", "安徽省/六安市/舒城县", "安徽/六安/舒城", "Shucheng", 31.470000, 116.930000},
-    {"WTDKMY6Q7U8F", "安徽省/六安市/金寨县", "安徽/六安/金寨", "Jinzhai", 31.720000, 115.920000},
-    {"WTDDXHHYM2NZ", "安徽省/六安市/霍山县", "安徽/六安/霍山", "Huoshan", 31.400000, 116.330000},
-    {"WW42DDHQT937", "安徽省/亳州市", "安徽/亳州/亳州", "Bozhou", 33.850000, 115.780000},
-    {"WW42DRPXTXVB", "安徽省/亳州市/谯城区", "安徽/亳州/谯城", "Qiaocheng", 33.877672, 115.773483},
-    {"WTFWSWHU4KCH", "安徽省/亳州市/涡阳县", "安徽/亳州/涡阳", "Guoyang", 33.520000, 116.220000},
-    {"WTFVK8EEVCEB", "安徽省/亳州市/蒙城县", "安徽/亳州/蒙城", "Mengcheng", 33.270000, 116.570000},
-    {"WTFSS4Y28PZU", "安徽省/亳州市/利辛县", "安徽/亳州/利辛", "Lixin", 33.150000, 116.200000},
-    {"WT7W3R63DQMH", "安徽省/池州市", "安徽/池州/池州", "Chizhou", 30.670000, 117.480000},
-    {"WT7WE4YHS47Y", "安徽省/池州市/贵池区", "安徽/池州/贵池", "Guichi", 30.689720, 117.562128},
-    {"WT75NZE35WSM", "安徽省/池州市/东至县", "安徽/池州/东至", "Dongzhi", 30.100000, 117.020000},
-    {"WT7ECM6K62M1", "安徽省/池州市/石台县", "安徽/池州/石台", "Shitai", 30.220000, 117.480000},
-    {"WT7Y3EXV0N15", "安徽省/池州市/青阳县", "安徽/池州/青阳", "Qingyang", 30.650000, 117.850000},
-    {"WTS2N4R0GD1V", "安徽省/宣城市", "安徽/宣城/宣城", "Xuancheng", 30.950000, 118.750000},
-    {"WTS2N4PBR954", "安徽省/宣城市/宣州区", "安徽/宣城/宣州", "Xuanzhou", 30.948535, 118.751204},
-    {"WTS9PG0CQK87", "安徽省/宣城市/郎溪县", "安徽/宣城/郎溪", "Langxi", 31.130000, 119.170000},
-    {"WTKZV3NVX9MZ", "安徽省/宣城市/广德县", "安徽/宣城/广德", "Guangde", 30.900000, 119.420000},
-    {"WTKNWKB0RYYC", "安徽省/宣城市/泾县", "安徽/宣城/泾县", "Jingxian", 30.700000, 118.400000},
-    {"WTK74F1FKQ38", "安徽省/宣城市/绩溪县", "安徽/宣城/绩溪", "Jixi", 30.070000, 118.600000},
-    {"WTKK30QCV1JG", "安徽省/宣城市/旌德县", "安徽/宣城/旌德", "Jingde", 30.280000, 118.530000},
-    {"WTKW72N8DVY5", "安徽省/宣城市/宁国市", "安徽/宣城/宁国", "Ningguo", 30.630000, 118.980000},
-    {"WSSU6EXX52RE", "福建省/福州市", "福建/福州/福州", "Fuzhou", 26.080000, 119.300000},
-    {"WSSU6SWYKMJ0", "福建省/福州市/鼓楼区", "福建/福州/鼓楼", "Gulou", 26.085389, 119.299010},
-    {"WSSU4ZQ6D7WR", "福建省/福州市/台江区", "福建/福州/台江", "Taijiang", 26.055900, 119.309225},
-    {"WSSU4N0Z7VJ9", "福建省/福州市/仓山区", "福建/福州/仓山", "Cangshan", 26.049856, 119.268777},
-    {"WSSGY5V35CQZ", "福建省/福州市/马尾区", "福建/福州/马尾", "Mawei", 25.992459, 119.450739},
-    {"WSSU7K8V49R4", "福建省/福州市/晋安区", "福建/福州/晋安", "Jinan", 26.085155, 119.323656},
-    {"WSSGXXXY1YGK", "福建省/福州市/长乐区", "福建/福州/长乐", "Changle", 25.970000, 119.520000},
-    {"WSSSYB7YF1Q6", "福建省/福州市/闽侯县", "福建/福州/闽侯", "Minhou", 26.150000, 119.130000},
-    {"WSSVPCX44CGZ", "福建省/福州市/连江县", "福建/福州/连江", "Lianjiang", 26.200000, 119.530000},
-    {"WSTN8KT9HVV0", "福建省/福州市/罗源县", "福建/福州/罗源", "Luoyuan", 26.480000, 119.550000},
-    {"WSST0MPYTDR0", "福建省/福州市/闽清县", "福建/福州/闽清", "Minqing", 26.220000, 118.850000},
-    {"WSSE4M6PTVE9", "福建省/福州市/永泰县", "福建/福州/永泰", "Yongtai", 25.870000, 118.930000},
-    {"WST1JTV0U2C3", "福建省/福州市/平潭县", "福建/福州/平潭", "Pingtan", 25.520000, 119.780000},
-    {"WSSFKD1VGEEB", "福建省/福州市/福清市", "福建/福州/福清", "Fuqing", 25.720000, 119.380000},
-    {"WS7GQBRNR6V8", "福建省/厦门市", "福建/厦门/厦门", "Xiamen", 24.480000, 118.080000},
-    {"WS7GNFTT1KYV", "福建省/厦门市/思明区", "福建/厦门/思明", "Siming", 24.448211, 118.077684},
-    {"WS7GMCC298MV", "福建省/厦门市/海沧区", "福建/厦门/海沧", "Haicang", 24.487240, 118.027912},
-    {"WSK52QUM8ZN2", "福建省/厦门市/湖里区", "福建/厦门/湖里", "Huli", 24.515600, 118.141864},
-    {"WS7GZ62HZ7FN", "福建省/厦门市/集美区", "福建/厦门/集美", "Jimei", 24.578626, 118.092355},
-    {"WSKH8TFNWW1K", "福建省/厦门市/同安区", "福建/厦门/同安", "Tongan", 24.730000, 118.150000},
-    {"WSKH4DNJVNBP", "福建省/厦门市/翔安区", "福建/厦门/翔安", "Xiangan", 24.621386, 118.243318},
-    {"WSS8S6CQZBPG", "福建省/莆田市", "福建/莆田/莆田", "Putian", 25.416656, 119.016953},
-    {"WSS8EVMHKZX6", "福建省/莆田市/城厢区", "福建/莆田/城厢", "Chengxiang", 25.430000, 119.000000},
-    {"WSS8Y1JBZPUE", "福建省/莆田市/涵江区", "福建/莆田/涵江", "Hanjiang", 25.450000, 119.100000},
-    {"WSS8SM7SRP86", "福建省/莆田市/荔城区", "福建/莆田/荔城", "Licheng", 25.430000, 119.020000},
-    {"WSKZ5N0G42QG", "福建省/莆田市/秀屿区", "福建/莆田/秀屿", "Xiuyu", 25.170195, 119.312659},
-    {"WSS2KDKNUQVB", "福建省/莆田市/仙游县", "福建/莆田/仙游", "Xianyou", 25.370000, 118.680000},
-    {"WSETKW23BDUT", "福建省/三明市", "福建/三明/三明", "Sanming", 26.270000, 117.620000},
-    {"WSETKZPX8XNH", "福建省/三明市/梅列区", "福建/三明/梅列", "Meilie", 26.275129, 117.640945},
-    {"WSETK0KH29J0", "福建省/三明市/三元区", "福建/三明/三元", "Sanyuan", 26.237460, 117.603178},
-    {"WSEQ4BW2MUQ1", "福建省/三明市/明溪县", "福建/三明/明溪", "Mingxi", 26.370000, 117.200000},
-    {"WSEHFMCTX39R", "福建省/三明市/清流县", "福建/三明/清流", "Qingliu", 26.180000, 116.820000},
-    {"WSDVQQMCY4BM", "福建省/三明市/宁化县", "福建/三明/宁化", "Ninghua", 26.270000, 116.650000},
-    {"WSEF1WXC251P", "福建省/三明市/大田县", "福建/三明/大田", "Datian", 25.700000, 117.850000},
-    {"WSSHCK0539DF", "福建省/三明市/尤溪县", "福建/三明/尤溪", "Youxi", 26.170000, 118.180000},
-    {"WSEY0JUZ0UTQ", "福建省/三明市/沙县", "福建/三明/沙县", "Shaxian", 26.400000, 117.780000},
-    {"WSG8145193HS", "福建省/三明市/将乐县", "福建/三明/将乐", "Jiangle", 26.730000, 117.470000},
-    {"WSG342BXFGKQ", "福建省/三明市/泰宁县", "福建/三明/泰宁", "Taining", 26.900000, 117.170000},
-    {"WSG0DS3006D0", "福建省/三明市/建宁县", "福建/三明/建宁", "Jianning", 26.830000, 116.830000},
-    {"WSE7YCD0RPP0", "福建省/三明市/永安市", "福建/三明/永安", "Yongan", 25.980000, 117.370000},
-    {"WSKMS3KBE2JM", "福建省/泉州市", "福建/泉州/泉州", "Quanzhou", 24.880000, 118.670000},
-    {"WSKMDQV4EHBK", "福建省/泉州市/鲤城区", "福建/泉州/鲤城", "Licheng", 24.910581, 118.582435},
-    {"WSKME5B5PD5M", "福建省/泉州市/丰泽区", "福建/泉州/丰泽", "Fengze", 24.894173, 118.608725},
-    {"WSKMUKDMV3H2", "福建省/泉州市/洛江区", "福建/泉州/洛江", "Luojiang", 24.942704, 118.666651},
-    {"WSKWCVKYYD0V", "福建省/泉州市/泉港区", "福建/泉州/泉港", "Quangang", 25.122783, 118.911833},
-    {"WSKQRKED2DHM", "福建省/泉州市/惠安县", "福建/泉州/惠安", "Huian", 25.030000, 118.800000},
-    {"WSKN97B53DDZ", "福建省/泉州市/安溪县", "福建/泉州/安溪", "Anxi", 25.070000, 118.180000},
-    {"WSS05CR7TY17", "福建省/泉州市/永春县", "福建/泉州/永春", "Yongchun", 25.320000, 118.300000},
-    {"WSS146HKQ8T9", "福建省/泉州市/德化县", "福建/泉州/德化", "Dehua", 25.500000, 118.230000},
-    {"WSK5H226V4KW", "福建省/泉州市/金门县", "福建/泉州/金门", "Jinmen", 24.435452, 118.312332},
-    {"WSKKEVYQ9QHK", "福建省/泉州市/石狮市", "福建/泉州/石狮", "Shishi", 24.730000, 118.650000},
-    {"WSKM4Q76FR2E", "福建省/泉州市/晋江市", "福建/泉州/晋江", "Jinjiang", 24.820000, 118.580000},
-    {"WSKNJC9SVCMG", "福建省/泉州市/南安市", "福建/泉州/南安", "Nanan", 24.970000, 118.380000},
-    {"WS7EMPWP7EQ3", "福建省/漳州市", "福建/漳州/漳州", "Zhangzhou", 24.520000, 117.650000},
-    {"WS7EMNTE8EBT", "福建省/漳州市/芗城区", "福建/漳州/芗城", "Xiangcheng", 24.513866, 117.649177},
-    {"WS7EQMNJDJ9T", "福建省/漳州市/龙文区", "福建/漳州/龙文", "Longwen", 24.505979, 117.704861},
-    {"WS72JZVNG5T4", "福建省/漳州市/云霄县", "福建/漳州/云霄", "Yunxiao", 23.950000, 117.330000},
-    {"WS79K88R2WH8", "福建省/漳州市/漳浦县", "福建/漳州/漳浦", "Zhangpu", 24.130000, 117.620000},
-    {"WS5QFQPG5BKZ", "福建省/漳州市/诏安县", "福建/漳州/诏安", "Zhaoan", 23.720000, 117.180000},
-    {"WS7SP3YVVUES", "福建省/漳州市/长泰县", "福建/漳州/长泰", "Changtai", 24.620000, 117.750000},
-    {"WS5WB4MYT24Q", "福建省/漳州市/东山县", "福建/漳州/东山", "Dongshan", 23.700000, 117.430000},
-    {"WS77QZDPR5R1", "福建省/漳州市/南靖县", "福建/漳州/南靖", "Nanjing", 24.520000, 117.370000},
-    {"WS76THRM8172", "福建省/漳州市/平和县", "福建/漳州/平和", "Pinghe", 24.370000, 117.300000},
-    {"WS7W66Y8P6PC", "福建省/漳州市/华安县", "福建/漳州/华安", "Huaan", 25.020000, 117.530000},
-    {"WS7G14CZSFRE", "福建省/漳州市/龙海市", "福建/漳州/龙海", "Longhai", 24.450000, 117.820000},
-    {"WSSP952Z8846", "福建省/南平市", "福建/南平/南平", "Nanping", 26.650000, 118.170000},
-    {"WSSP91VC9V9P", "福建省/南平市/延平区", "福建/南平/延平", "Yanping", 26.640761, 118.176918},
-    {"WSGGRZK2G3R8", "福建省/南平市/建阳区", "福建/南平/建阳", "Jianyang", 27.330000, 118.120000},
-    {"WSGB2WG36FN7", "福建省/南平市/顺昌县", "福建/南平/顺昌", "Shunchang", 26.800000, 117.800000},
-    {"WSUQC4WVV1JZ", "福建省/南平市/浦城县", "福建/南平/浦城", "Pucheng", 27.920000, 118.530000},
-    {"WSGKTZM47HJP", "福建省/南平市/光泽县", "福建/南平/光泽", "Guangze", 27.550000, 117.330000},
-    {"WSUKWGSVYEGQ", "福建省/南平市/松溪县", "福建/南平/松溪", "Songxi", 27.530000, 118.780000},
-    {"WSUE8QXCV9Z1", "福建省/南平市/政和县", "福建/南平/政和", "Zhenghe", 27.370000, 118.850000},
-    {"WSGE9QD3F3V1", "福建省/南平市/邵武市", "福建/南平/邵武", "Shaowu", 27.370000, 117.480000},
-    {"WSGVVZ6GFR4Y", "福建省/南平市/武夷山市", "福建/南平/武夷山", "Wuyishan", 27.770000, 118.030000},
-    {"WSU1U2TVPV4W", "福建省/南平市/建瓯市", "福建/南平/建瓯", "Jianou", 27.030000, 118.320000},
-    {"WS7NZ16DHEHU", "福建省/龙岩市", "福建/龙岩/龙岩", "Longyan", 25.100000, 117.030000},
-    {"WS7NZ1KRFSM0", "福建省/龙岩市/新罗区", "福建/龙岩/新罗", "Xinluo", 25.100993, 117.032318},
-    {"WS7H8K0HQJUX", "福建省/龙岩市/永定区", "福建/龙岩/永定", "Yongding", 24.720000, 116.730000},
-    {"WSDDZW5QXSBP", "福建省/龙岩市/长汀县", "福建/龙岩/长汀", "Changting", 25.830000, 116.350000},
-    {"WS6Y90NQYD7Y", "福建省/龙岩市/上杭县", "福建/龙岩/上杭", "Shanghang", 25.050000, 116.420000},
-    {"WS6WCCM6N54S", "福建省/龙岩市/武平县", "福建/龙岩/武平", "Wuping", 25.100000, 116.100000},
-    {"WSE42DNVB5T8", "福建省/龙岩市/连城县", "福建/龙岩/连城", "Liancheng", 25.720000, 116.750000},
-    {"WS7RZVWXHMCF", "福建省/龙岩市/漳平市", "福建/龙岩/漳平", "Zhangping", 25.300000, 117.420000},
-    {"WSSZXXPU1B76", "福建省/宁德市", "福建/宁德/宁德", "Ningde", 26.670000, 119.520000},
-    {"WSSZXY1127B3", "福建省/宁德市/蕉城区", "福建/宁德/蕉城", "Jiaocheng", 26.664053, 119.521648},
-    {"WSV2FTM76EJM", "福建省/宁德市/霞浦县", "福建/宁德/霞浦", "Xiapu", 26.880000, 120.000000},
-    {"WSSRNNXPEX1U", "福建省/宁德市/古田县", "福建/宁德/古田", "Gutian", 26.580000, 118.750000},
-    {"WSU95KWS6GWP", "福建省/宁德市/屏南县", "福建/宁德/屏南", "Pingnan", 26.920000, 118.980000},
-    {"WSUUR2C0RG4K", "福建省/宁德市/寿宁县", "福建/宁德/寿宁", "Shouning", 27.470000, 119.500000},
-    {"WSUF73J3QW3J", "福建省/宁德市/周宁县", "福建/宁德/周宁", "Zhouning", 27.120000, 119.330000},
-    {"WSV6BMHD0RZV", "福建省/宁德市/柘荣县", "福建/宁德/柘荣", "Zherong", 27.230000, 119.900000},
-    {"WSV449Y2RJFK", "福建省/宁德市/福安市", "福建/宁德/福安", "Fuan", 27.080000, 119.650000},
-    {"WSV7RXM8C130", "福建省/宁德市/福鼎市", "福建/宁德/福鼎", "Fuding", 27.330000, 120.220000},
-    {"WT47HJP3HEMP", "江西省/南昌市", "江西/南昌/南昌", "Nanchang", 28.680000, 115.850000},
-    {"WT47JNXDRDZB", "江西省/南昌市/东湖区", "江西/南昌/东湖", "Donghu", 28.688450, 115.894421},
-    {"WT47H9XDJYVW", "江西省/南昌市/西湖区", "江西/南昌/西湖", "Xihu", 28.660964, 115.872370},
-    {"WT46VFGN0UR8", "江西省/南昌市/青云谱区", "江西/南昌/青云谱", "Qingyunpu", 28.624558, 115.920911},
-    {"WT4737UYM11F", "江西省/南昌市/湾里区", "江西/南昌/湾里", "Wanli", 28.717967, 115.725734},
-    {"WT47NWJMXSFE", "江西省/南昌市/青山湖区", "江西/南昌/青山湖", "Qingshanhu", 28.686273, 115.957242},
-    {"WT47789T9EG2", "江西省/南昌市/新建区", "江西/南昌/新建", "Xinjian", 28.700000, 115.820000},
-    {"WT46QJ3EUC9R", "江西省/南昌市/南昌县", "江西/南昌/南昌县", "Nanchangxian", 28.550000, 115.930000},
-    {"WT4HJ7UZQJUC", "江西省/南昌市/安义县", "江西/南昌/安义", "Anyi", 28.850000, 115.550000},
-    {"WT49MU95PR79", "江西省/南昌市/进贤县", "江西/南昌/进贤", "Jinxian", 28.370000, 116.270000},
-    {"WT5QD22W4GKR", "江西省/景德镇市", "江西/景德镇/景德镇", "Jingdezhen", 29.270000, 117.170000},
-    {"WT5QD3W9X9C9", "江西省/景德镇市/昌江区", "江西/景德镇/昌江", "Changjiang", 29.276085, 117.178440},
-    {"WT5QDYKEYQ0Z", "江西省/景德镇市/珠山区", "江西/景德镇/珠山", "Zhushan", 29.302588, 117.197611},
-    {"WT5RH4DUEHBD", "江西省/景德镇市/浮梁县", "江西/景德镇/浮梁", "Fuliang", 29.370000, 117.250000},
-    {"WT5KC1U4MZ3T", "江西省/景德镇市/乐平市", "江西/景德镇/乐平", "Leping", 28.970000, 117.120000},
-    {"WSBVNTZH3M2C", "江西省/萍乡市", "江西/萍乡/萍乡", "Pingxiang", 27.630000, 113.850000},
-    {"WSBVR1T8GMD4", "江西省/萍乡市/安源区", "江西/萍乡/安源", "Anyuan", 27.650000, 113.870000},
-    {"WSBV7CX8VJD6", "江西省/萍乡市/湘东区", "江西/萍乡/湘东", "Xiangdong", 27.650000, 113.730000},
-    {"WSC42FZGEQW3", "江西省/萍乡市/莲花县", "江西/萍乡/莲花", "Lianhua", 27.130000, 113.950000},
-    {"WSBYTE6SU0WQ", "江西省/萍乡市/上栗县", "江西/萍乡/上栗", "Shangli", 27.880000, 113.800000},
-    {"WSCJ4VFH7T69", "江西省/萍乡市/芦溪县", "江西/萍乡/芦溪", "Luxi", 27.630000, 114.030000},
-    {"WT62ZWSX5CM0", "江西省/九江市", "江西/九江/九江", "Jiujiang", 29.700000, 116.000000},
-    {"WT62Z37EEZFR", "江西省/九江市/濂溪区", "江西/九江/濂溪", "Lianxi", 29.670596, 115.987637},
-    {"WT63PK1YEZYT", "江西省/九江市/浔阳区", "江西/九江/浔阳", "Xunyang", 29.730162, 115.985239},
-    {"WT62MW8HMU0E", "江西省/九江市/柴桑区", "江西/九江/柴桑", "Chaisang", 29.611653, 115.906009},
-    {"WT1YE0MQ07KX", "江西省/九江市/武宁县", "江西/九江/武宁", "Wuning", 29.270000, 115.100000},
-    {"WT1MPHG242PZ", "江西省/九江市/修水县", "江西/九江/修水", "Xiushui", 29.030000, 114.570000},
-    {"WT4M5HFBP84R", "江西省/九江市/永修县", "江西/九江/永修", "Yongxiu", 29.030000, 115.800000},
-    {"WT4QF7M5SS28", "江西省/九江市/德安县", "江西/九江/德安", "Dean", 29.330000, 115.770000},
-    {"WT4WE8RWN5QZ", "江西省/九江市/都昌县", "江西/九江/都昌", "Duchang", 29.270000, 116.180000},
-    {"WT69HSHVF39J", "江西省/九江市/湖口县", "江西/九江/湖口", "Hukou", 29.730000, 116.220000},
-    {"WT6FH5JH5GFZ", "江西省/九江市/彭泽县", "江西/九江/彭泽", "Pengze", 29.900000, 116.550000},
-    {"WT62B5H6D352", "江西省/九江市/瑞昌市", "江西/九江/瑞昌", "Ruichang", 29.680000, 115.670000},
-    {"WT4Q7JJ8PW6M", "江西省/九江市/共青城市", "江西/九江/共青城", "Gongqingcheng", 29.251133, 115.803777},
-    {"WT62Z5N49CH0", "江西省/九江市/庐山市", "江西/九江/庐山", "Lushan", 29.680000, 115.980000},
-    {"WSCWR06PNPFU", "江西省/新余市", "江西/新余/新余", "Xinyu", 27.820000, 114.920000},
-    {"WSCWPT88FMNQ", "江西省/新余市/渝水区", "江西/新余/渝水", "Yushui", 27.803807, 114.939757},
-    {"WSCW32KPHXVK", "江西省/新余市/分宜县", "江西/新余/分宜", "Fenyi", 27.820000, 114.670000},
-    {"WT50ZFRU8TYY", "江西省/鹰潭市", "江西/鹰潭/鹰潭", "Yingtan", 28.270000, 117.070000},
-    {"WT50XJK5D5EG", "江西省/鹰潭市/月湖区", "江西/鹰潭/月湖", "Yuehu", 28.242350, 117.031951},
-    {"WT506M9SZM12", "江西省/鹰潭市/余江区", "江西/鹰潭/余江", "Yujiang", 28.200000, 116.820000},
-    {"WT52GKHYZYP5", "江西省/鹰潭市/贵溪市", "江西/鹰潭/贵溪", "Guixi", 28.280000, 117.220000},
-    {"WS9DZQ1QXHGR", "江西省/赣州市", "江西/赣州/赣州", "Ganzhou", 25.830000, 114.930000},
-    {"WS9DYUXD78Q3", "江西省/赣州市/章贡区", "江西/赣州/章贡", "Zhanggong", 25.821006, 114.916464},
-    {"WS99GJQQHF99", "江西省/赣州市/南康区", "江西/赣州/南康", "Nankang", 25.650000, 114.750000},
-    {"WS9G0VKRWJX1", "江西省/赣州市/赣县区", "江西/赣州/赣县", "Ganxian", 25.870000, 115.000000},
-    {"WS98RK33PNGM", "江西省/赣州市/信丰县", "江西/赣州/信丰", "Xinfeng", 25.380000, 114.930000},
-    {"WS926PGJSP5V", "江西省/赣州市/大余县", "江西/赣州/大余", "Dayu", 25.400000, 114.350000},
-    {"WS96Y0WPYKTD", "江西省/赣州市/上犹县", "江西/赣州/上犹", "Shangyou", 25.800000, 114.530000},
-    {"WS960YW9R51R", "江西省/赣州市/崇义县", "江西/赣州/崇义", "Chongyi", 25.700000, 114.300000},
-    {"WS6NCWC0UGE9", "江西省/赣州市/安远县", "江西/赣州/安远", "Anyuan", 25.130000, 115.380000},
-    {"WS3TGBS1XBEN", "江西省/赣州市/龙南县", "江西/赣州/龙南", "Longnan", 24.920000, 114.780000},
-    {"WS3UCX43CQB9", "江西省/赣州市/定南县", "江西/赣州/定南", "Dingnan", 24.780000, 115.030000},
-    {"WS3KVCWGJQMH", "江西省/赣州市/全南县", "江西/赣州/全南", "Quannan", 24.750000, 114.520000},
-    {"WSDW8HE1JVY0", "江西省/赣州市/宁都县", "江西/赣州/宁都", "Ningdu", 26.480000, 116.020000},
-    {"WSD5DKN38YTG", "江西省/赣州市/于都县", "江西/赣州/于都", "Yudu", 25.950000, 115.420000},
-    {"WSDJBC5R3GDP", "江西省/赣州市/兴国县", "江西/赣州/兴国", "Xingguo", 26.330000, 115.350000},
-    {"WSD3DSK6V9CK", "江西省/赣州市/会昌县", "江西/赣州/会昌", "Huichang", 25.600000, 115.780000},
-    {"WS6JZWJB2345", "江西省/赣州市/寻乌县", "江西/赣州/寻乌", "Xunwu", 24.950000, 115.650000},
-    {"WSDTZ1HZM7WZ", "江西省/赣州市/石城县", "江西/赣州/石城", "Shicheng", 26.330000, 116.330000},
-    {"WSDE0R63YVWV", "江西省/赣州市/瑞金市", "江西/赣州/瑞金", "Ruijin", 25.880000, 116.030000},
-    {"WSCF23JCKNQJ", "江西省/吉安市", "江西/吉安/吉安", "Jian", 27.120000, 114.980000},
-    {"WSCF2TUZXCE3", "江西省/吉安市/吉州区", "江西/吉安/吉州", "Jizhou", 27.147139, 114.989770},
-    {"WSCF14EX1KWY", "江西省/吉安市/青原区", "江西/吉安/青原", "Qingyuan", 27.085272, 115.009752},
-    {"WSC9YS79SJ3X", "江西省/吉安市/吉安县", "江西/吉安/吉安县", "Jianxian", 27.050000, 114.900000},
-    {"WSCFGG5PGRY0", "江西省/吉安市/吉水县", "江西/吉安/吉水", "Jishui", 27.220000, 115.130000},
-    {"WSFJ0KHDPV0V", "江西省/吉安市/峡江县", "江西/吉安/峡江", "Xiajiang", 27.620000, 115.330000},
-    {"WSFJCZREYZHW", "江西省/吉安市/新干县", "江西/吉安/新干", "Xingan", 27.770000, 115.400000},
-    {"WSF56TMW9CN7", "江西省/吉安市/永丰县", "江西/吉安/永丰", "Yongfeng", 27.320000, 115.430000},
-    {"WSC8QNV1640E", "江西省/吉安市/泰和县", "江西/吉安/泰和", "Taihe", 26.800000, 114.880000},
-    {"WS9MVCNZM7TP", "江西省/吉安市/遂川县", "江西/吉安/遂川", "Suichuan", 26.330000, 114.520000},
-    {"WS9WEFSNZVEH", "江西省/吉安市/万安县", "江西/吉安/万安", "Wanan", 26.470000, 114.780000},
-    {"WSCEB0RSP9FT", "江西省/吉安市/安福县", "江西/吉安/安福", "Anfu", 27.380000, 114.620000},
-    {"WSC1R65EPUJ7", "江西省/吉安市/永新县", "江西/吉安/永新", "Yongxin", 26.950000, 114.230000},
-    {"WSC2020Z7CP8", "江西省/吉安市/井冈山市", "江西/吉安/井冈山", "Jinggangshan", 26.720000, 114.270000},
-    {"WSCQ4UBFXPTE", "江西省/宜春市", "江西/宜春/宜春", "Yichun", 27.800000, 114.380000},
-    {"WSCQ5TJWH7TG", "江西省/宜春市/袁州区", "江西/宜春/袁州", "Yuanzhou", 27.801953, 114.419365},
-    {"WT45389JSGG8", "江西省/宜春市/奉新县", "江西/宜春/奉新", "Fengxin", 28.700000, 115.380000},
-    {"WSCRGZJ6U7BM", "江西省/宜春市/万载县", "江西/宜春/万载", "Wanzai", 28.120000, 114.430000},
-    {"WT18X545WJ6V", "江西省/宜春市/上高县", "江西/宜春/上高", "Shanggao", 28.230000, 114.920000},
-    {"WT197YKJRZ7N", "江西省/宜春市/宜丰县", "江西/宜春/宜丰", "Yifeng", 28.380000, 114.780000},
-    {"WT4H0ZE7CY44", "江西省/宜春市/靖安县", "江西/宜春/靖安", "Jingan", 28.870000, 115.350000},
-    {"WT16699XQ1MP", "江西省/宜春市/铜鼓县", "江西/宜春/铜鼓", "Tonggu", 28.530000, 114.370000},
-    {"WT426TSKVT12", "江西省/宜春市/丰城市", "江西/宜春/丰城", "Fengcheng", 28.200000, 115.780000},
-    {"WSFPSVYRS57B", "江西省/宜春市/樟树市", "江西/宜春/樟树", "Zhangshu", 28.070000, 115.530000},
-    {"WT419M9Y7ZGP", "江西省/宜春市/高安市", "江西/宜春/高安", "Gaoan", 28.420000, 115.370000},
-    {"WSFXR95RZD21", "江西省/抚州市", "江西/抚州/抚州", "Fuzhou", 28.000000, 116.350000},
-    {"WSFWYTUM7M71", "江西省/抚州市/临川区", "江西/抚州/临川", "Linchuan", 27.937789, 116.307250},
-    {"WT4BTG05DVQT", "江西省/抚州市/东乡区", "江西/抚州/东乡", "Dongxiang", 28.230000, 116.620000},
-    {"WSFUTZR67UPP", "江西省/抚州市/南城县", "江西/抚州/南城", "Nancheng", 27.550000, 116.630000},
-    {"WSG5K9FD12YG", "江西省/抚州市/黎川县", "江西/抚州/黎川", "Lichuan", 27.300000, 116.920000},
-    {"WSFFGENXCZCB", "江西省/抚州市/南丰县", "江西/抚州/南丰", "Nanfeng", 27.220000, 116.530000},
-    {"WSFTBZ35BZPY", "江西省/抚州市/崇仁县", "江西/抚州/崇仁", "Chongren", 27.770000, 116.050000},
-    {"WSFK5C2Z6DEG", "江西省/抚州市/乐安县", "江西/抚州/乐安", "Anle", 27.430000, 115.830000},
-    {"WSFSSXKF6K1P", "江西省/抚州市/宜黄县", "江西/抚州/宜黄", "Yihuang", 27.550000, 116.220000},
-    {"WSGNC4TMF1NZ", "江西省/抚州市/金溪县", "江西/抚州/金溪", "Jinxi", 27.920000, 116.770000},
-    {"WSGJXFXU0WQB", "江西省/抚州市/资溪县", "江西/抚州/资溪", "Zixi", 27.700000, 117.070000},
-    {"WSF8WUM8H6W2", "江西省/抚州市/广昌县", "江西/抚州/广昌", "Guangchang", 26.830000, 116.320000},
-    {"WT5CU7PJK0RS", "江西省/上饶市", "江西/上饶/上饶", "Shangrao", 28.450000, 117.970000},
-    {"WT5CU22FHTT0", "江西省/上饶市/信州区", "江西/上饶/信州", "Xinzhou", 28.434363, 117.961435},
-    {"WTH19R80C84G", "江西省/上饶市/广丰区", "江西/上饶/广丰", "Guangfeng", 28.430000, 118.180000},
-    {"WT5CERD8Z0HG", "江西省/上饶市/上饶县", "江西/上饶/上饶县", "Shangraoxian", 28.430000, 117.920000},
-    {"WTH54V510EQZ", "江西省/上饶市/玉山县", "江西/上饶/玉山", "Yushan", 28.680000, 118.250000},
-    {"WT59N76XBY9H", "江西省/上饶市/铅山县", "江西/上饶/铅山", "Yanshan", 28.320000, 117.700000},
-    {"WT59SJ9WQXGX", "江西省/上饶市/横峰县", "江西/上饶/横峰", "Hengfeng", 28.420000, 117.600000},
-    {"WT5984JCVRDQ", "江西省/上饶市/弋阳县", "江西/上饶/弋阳", "Yiyang", 28.400000, 117.430000},
-    {"WT4GR0EV95CB", "江西省/上饶市/余干县", "江西/上饶/余干", "Yugan", 28.700000, 116.680000},
-    {"WT4UYZK90PC6", "江西省/上饶市/鄱阳县", "江西/上饶/鄱阳", "Poyang", 29.000000, 116.670000},
-    {"WT55RBXV8EYB", "江西省/上饶市/万年县", "江西/上饶/万年", "Wannian", 28.700000, 117.070000},
-    {"WT5Y3SZC851N", "江西省/上饶市/婺源县", "江西/上饶/婺源", "Wuyuan", 29.250000, 117.850000},
-    {"WT5SEQ5VGX4H", "江西省/上饶市/德兴市", "江西/上饶/德兴", "Dexing", 28.950000, 117.570000},
-    {"WWE0TGW4PX6N", "山东省/济南市", "山东/济南/济南", "Jinan", 36.670000, 116.980000},
-    {"WWE284B4BBUM", "山东省/济南市/历下区", "山东/济南/历下", "Lixia", 36.665974, 117.070351},
-    {"WWE0W0NUVUJF", "山东省/济南市/市中区", "山东/济南/市中", "Shizhong", 36.651228, 116.991946},
-    {"WWE0S00VDXD2", "山东省/济南市/槐荫区", "山东/济南/槐荫", "Huaiyin", 36.651375, 116.895672},
-    {"WWE0TUZRX4XE", "山东省/济南市/天桥区", "山东/济南/天桥", "Tianqiao", 36.677785, 116.981703},
-    {"WWE0XTRF5FPF", "山东省/济南市/历城区", "山东/济南/历城", "Licheng", 36.679584, 117.059154},
-    {"WW7PBM8PNJUD", "山东省/济南市/长清区", "山东/济南/长清", "Changqing", 36.550000, 116.730000},
-    {"WWE8FKWTX2PU", "山东省/济南市/章丘区", "山东/济南/章丘", "Zhangqiu", 36.720000, 117.530000},
-    {"WWE67KHBPGXH", "山东省/济南市/济阳区", "山东/济南/济阳", "Jiyang", 36.980000, 117.220000},
-    {"WW7WJ9SSV9R7", "山东省/济南市/莱芜区", "山东/济南/莱芜", "Laiwu", 36.220000, 117.670000},
-    {"WW7V0SRQUYT1", "山东省/济南市/钢城区", "山东/济南/钢城", "Gangcheng", 36.059696, 117.805577},
-    {"WW6Y3US63DJM", "山东省/济南市/平阴县", "山东/济南/平阴", "Pingyin", 36.280000, 116.450000},
-    {"WWEK3CFHBB5R", "山东省/济南市/商河县", "山东/济南/商河", "Shanghe", 37.320000, 117.150000},
-    {"WWMT5Q64CR3G", "山东省/青岛市", "山东/青岛/青岛", "Qingdao", 36.070000, 120.380000},
-    {"WWMT5ZMFHXY8", "山东省/青岛市/市南区", "山东/青岛/市南", "Shinan", 36.075367, 120.407268},
-    {"WWMT716RYYZN", "山东省/青岛市/市北区", "山东/青岛/市北", "Shibei", 36.087336, 120.369600},
-    {"WWMKWU0KKVZP", "山东省/青岛市/黄岛区", "山东/青岛/黄岛", "Huangdao", 35.970000, 120.180000},
-    {"WWMTM7G9DRY8", "山东省/青岛市/崂山区", "山东/青岛/崂山", "Laoshan", 36.100000, 120.470000},
-    {"WWMTSKH8YQNC", "山东省/青岛市/李沧区", "山东/青岛/李沧", "Licang", 36.145181, 120.427600},
-    {"WWMWE96JVNUD", "山东省/青岛市/城阳区", "山东/青岛/城阳", "Chengyang", 36.306718, 120.391151},
-    {"WWMWUYV0B7T9", "山东省/青岛市/即墨区", "山东/青岛/即墨", "Jimo", 36.380000, 120.450000},
-    {"WWMQ76G0JDNC", "山东省/青岛市/胶州市", "山东/青岛/胶州", "Jiaozhou", 36.270000, 120.030000},
-    {"WWT31X8GJ8FW", "山东省/青岛市/平度市", "山东/青岛/平度", "Pingdu", 36.780000, 119.950000},
-    {"WWT9WPCRMD0K", "山东省/青岛市/莱西市", "山东/青岛/莱西", "Laixi", 36.870000, 120.500000},
-    {"WWECQQCKH37Z", "山东省/淄博市", "山东/淄博/淄博", "Zibo", 36.820000, 118.050000},
-    {"WWEBH2ZZKMW6", "山东省/淄博市/淄川区", "山东/淄博/淄川", "Zichuan", 36.567894, 117.971039},
-    {"WWECMKMEVJWC", "山东省/淄博市/张店区", "山东/淄博/张店", "Zhangdian", 36.806246, 118.011927},
-    {"WW7Z9SXGBJ1H", "山东省/淄博市/博山区", "山东/淄博/博山", "Boshan", 36.500000, 117.850000},
-    {"WWS17YZKJC3R", "山东省/淄博市/临淄区", "山东/淄博/临淄", "Linzi", 36.820000, 118.300000},
-    {"WWEC65NRD14N", "山东省/淄博市/周村区", "山东/淄博/周村", "Zhoucun", 36.800000, 117.870000},
-    {"WWEFQFPJZ7T8", "山东省/淄博市/桓台县", "山东/淄博/桓台", "Huantai", 36.970000, 118.080000},
-    {"WWEG3N9FUYPW", "山东省/淄博市/高青县", "山东/淄博/高青", "Gaoqing", 37.170000, 117.820000},
-    {"WWKJC42GB8F6", "山东省/淄博市/沂源县", "山东/淄博/沂源", "Yiyuan", 36.180000, 118.170000},
-    {"WW5QJDVC4NKQ", "山东省/枣庄市", "山东/枣庄/枣庄", "Zaozhuang", 34.820000, 117.320000},
-    {"WW5W6FVXU1BH", "山东省/枣庄市/市中区", "山东/枣庄/市中", "Shizhong", 34.865079, 117.550449},
-    {"WW5MUP4UEN0T", "山东省/枣庄市/薛城区", "山东/枣庄/薛城", "Xuecheng", 34.800000, 117.250000},
-    {"WW5TG9EJUTF9", "山东省/枣庄市/峄城区", "山东/枣庄/峄城", "Yicheng", 34.770000, 117.580000},
-    {"WW5SXJ22GG4D", "山东省/枣庄市/台儿庄区", "山东/枣庄/台儿庄", "Taierzhuang", 34.570000, 117.730000},
-    {"WW5X8VB2PY7F", "山东省/枣庄市/山亭区", "山东/枣庄/山亭", "Shanting", 35.099979, 117.455515},
-    {"WW5R9F45BCGR", "山东省/枣庄市/滕州市", "山东/枣庄/滕州", "Tengzhou", 35.080000, 117.150000},
-    {"WWSKUMUVE3TR", "山东省/东营市", "山东/东营", "Dongying", 37.430000, 118.670000},
-    {"WWSKUMUVE3TR", "山东省/东营市/东营区", "山东/东营/东营", "Dongying", 37.430000, 118.670000},
-    {"WWSR3PYFVPVC", "山东省/东营市/河口区", "山东/东营/河口", "Hekou", 37.880000, 118.530000},
-    {"WWSMC9JRR5WZ", "山东省/东营市/垦利区", "山东/东营/垦利", "Kenli", 37.580000, 118.550000},
-    {"WWSJ4Z50BDQU", "山东省/东营市/利津县", "山东/东营/利津", "Lijin", 37.480000, 118.250000},
-    {"WWS4YK2HRUYG", "山东省/东营市/广饶县", "山东/东营/广饶", "Guangrao", 37.070000, 118.400000},
-    {"WWWM51WDH1FX", "山东省/烟台市", "山东/烟台/烟台", "Yantai", 37.450000, 121.430000},
-    {"WWWMD3UUQFEK", "山东省/烟台市/芝罘区", "山东/烟台/芝罘", "Zhifu", 37.539654, 121.394757},
-    {"WWWJR4ET3F8V", "山东省/烟台市/福山区", "山东/烟台/福山", "Fushan", 37.500000, 121.250000},
-    {"WWWKXHF6M35C", "山东省/烟台市/牟平区", "山东/烟台/牟平", "Mouping", 37.380000, 121.600000},
-    {"WWWM7KTCG82S", "山东省/烟台市/莱山区", "山东/烟台/莱山", "Laishan", 37.510373, 121.439932},
-    {"WWTZER0UHBKF", "山东省/烟台市/长岛县", "山东/烟台/长岛", "Changdao", 37.920000, 120.730000},
-    {"WWTWNMZZPS9Q", "山东省/烟台市/龙口市", "山东/烟台/龙口", "Longkou", 37.650000, 120.520000},
-    {"WWTF6S501GEH", "山东省/烟台市/莱阳市", "山东/烟台/莱阳", "Laiyang", 36.980000, 120.700000},
-    {"WWT7906M5W3D", "山东省/烟台市/莱州市", "山东/烟台/莱州", "Laizhou", 37.180000, 119.930000},
-    {"WWTZ5SZMQYVZ", "山东省/烟台市/蓬莱市", "山东/烟台/蓬莱", "Penglai", 37.820000, 120.750000},
-    {"WWTSEG0852FV", "山东省/烟台市/招远市", "山东/烟台/招远", "Zhaoyuan", 37.370000, 120.400000},
-    {"WWTUJW38PPFN", "山东省/烟台市/栖霞市", "山东/烟台/栖霞", "Qixia", 37.300000, 120.830000},
-    {"WWW1HZDEP8GQ", "山东省/烟台市/海阳市", "山东/烟台/海阳", "Haiyang", 36.780000, 121.150000},
-    {"WWS8Z342UPZ7", "山东省/潍坊市", "山东/潍坊/潍坊", "Weifang", 36.700000, 119.150000},
-    {"WWS8UQ5420B5", "山东省/潍坊市/潍城区", "山东/潍坊/潍城", "Weicheng", 36.727686, 119.019013},
-    {"WWSC0Y8YQWYN", "山东省/潍坊市/寒亭区", "山东/潍坊/寒亭", "Hanting", 36.775097, 119.213964},
-    {"WWS8X8DJ79MY", "山东省/潍坊市/坊子区", "山东/潍坊/坊子", "Fangzi", 36.654046, 119.160620},
-    {"WWS8YF36CENQ", "山东省/潍坊市/奎文区", "山东/潍坊/奎文", "Kuiwen", 36.707185, 119.126546},
-    {"WWKRC0QBMJMV", "山东省/潍坊市/临朐县", "山东/潍坊/临朐", "Linqu", 36.520000, 118.530000},
-    {"WWS2ZC40FXVE", "山东省/潍坊市/昌乐县", "山东/潍坊/昌乐", "Changle", 36.700000, 118.820000},
-    {"WWS0XV7HRPDD", "山东省/潍坊市/青州市", "山东/潍坊/青州", "Qingzhou", 36.680000, 118.470000},
-    {"WWKUV187JWKU", "山东省/潍坊市/诸城市", "山东/潍坊/诸城", "Zhucheng", 36.000000, 119.400000},
-    {"WWS3VCB99D29", "山东省/潍坊市/寿光市", "山东/潍坊/寿光", "Shouguang", 36.880000, 118.730000},
-    {"WWKZ0RYU1K4N", "山东省/潍坊市/安丘市", "山东/潍坊/安丘", "Anqiu", 36.430000, 119.200000},
-    {"WWMNUYZ2C5XC", "山东省/潍坊市/高密市", "山东/潍坊/高密", "Gaomi", 36.380000, 119.750000},
-    {"WWSCTPBRMDHU", "山东省/潍坊市/昌邑市", "山东/潍坊/昌邑", "Changyi", 36.870000, 119.400000},
-    {"WW6CSB4BQYSD", "山东省/济宁市", "山东/济宁/济宁", "Jining", 35.420000, 116.580000},
-    {"WW6CMJDJ434E", "山东省/济宁市/任城区", "山东/济宁/任城", "Rencheng", 35.407053, 116.589761},
-    {"WW744X9JB264", "山东省/济宁市/兖州区", "山东/济宁/兖州", "Yanzhou", 35.550000, 116.830000},
-    {"WW5Q16G3NY6N", "山东省/济宁市/微山县", "山东/济宁/微山", "Weishan", 34.820000, 117.130000},
-    {"WW4ZN7TCY0BK", "山东省/济宁市/鱼台县", "山东/济宁/鱼台", "Yutai", 35.000000, 116.650000},
-    {"WW4XW2R1D3V6", "山东省/济宁市/金乡县", "山东/济宁/金乡", "Jinxiang", 35.070000, 116.300000},
-    {"WW69X0HBMQWF", "山东省/济宁市/嘉祥县", "山东/济宁/嘉祥", "Jiaxiang", 35.420000, 116.330000},
-    {"WW6G686NKDZ0", "山东省/济宁市/汶上县", "山东/济宁/汶上", "Wenshang", 35.730000, 116.480000},
-    {"WW76UT92V1CY", "山东省/济宁市/泗水县", "山东/济宁/泗水", "Sishui", 35.670000, 117.270000},
-    {"WW6E9MNYH59Q", "山东省/济宁市/梁山县", "山东/济宁/梁山", "Liangshan", 35.800000, 116.080000},
-    {"WW74MVNHX8DP", "山东省/济宁市/曲阜市", "山东/济宁/曲阜", "Qufu", 35.580000, 116.980000},
-    {"WW71MSQGYW39", "山东省/济宁市/邹城市", "山东/济宁/邹城", "Zoucheng", 35.400000, 116.970000},
-    {"WW7MBNP039PE", "山东省/泰安市", "山东/泰安/泰安", "Taian", 36.200000, 117.080000},
-    {"WW7MCKDBY7F5", "山东省/泰安市/泰山区", "山东/泰安/泰山", "Taishan", 36.191861, 117.129292},
-    {"WW7JZ5Y9R8ZJ", "山东省/泰安市/岱岳区", "山东/泰安/岱岳", "Daiyue", 36.187811, 117.035625},
-    {"WW753ZEPM723", "山东省/泰安市/宁阳县", "山东/泰安/宁阳", "Ningyang", 35.770000, 116.800000},
-    {"WW6U6KFG7TQW", "山东省/泰安市/东平县", "山东/泰安/东平", "Dongping", 35.930000, 116.470000},
-    {"WW7SRGJ3PVKF", "山东省/泰安市/新泰市", "山东/泰安/新泰", "Xintai", 35.920000, 117.770000},
-    {"WW7JC4M7F0YF", "山东省/泰安市/肥城市", "山东/泰安/肥城", "Feicheng", 36.180000, 116.770000},
-    {"WWWV6YM1F4ZV", "山东省/威海市", "山东/威海/威海", "Weihai", 37.520000, 122.120000},
-    {"WWWV6FGFUY36", "山东省/威海市/环翠区", "山东/威海/环翠", "Huancui", 37.500964, 122.118393},
-    {"WWWG9K41ENS5", "山东省/威海市/文登区", "山东/威海/文登", "Wendeng", 37.200000, 122.050000},
-    {"WWX53WXDBY0N", "山东省/威海市/荣成市", "山东/威海/荣成", "Rongcheng", 37.170000, 122.420000},
-    {"WWW6J3P6W6B4", "山东省/威海市/乳山市", "山东/威海/乳山", "Rushan", 36.920000, 121.530000},
-    {"WWKCX8PB3YE6", "山东省/日照市", "山东/日照/日照", "Rizhao", 35.420000, 119.520000},
-    {"WWKCW318GJPW", "山东省/日照市/东港区", "山东/日照/东港", "Donggang", 35.425572, 119.456545},
-    {"WWHZG1C62BEP", "山东省/日照市/岚山区", "山东/日照/岚山", "Lanshan", 35.122308, 119.313276},
-    {"WWKG2KNFC740", "山东省/日照市/五莲县", "山东/日照/五莲", "Wulian", 35.750000, 119.200000},
-    {"WWKD2J1KE8WP", "山东省/日照市/莒县", "山东/日照/莒县", "Juxian", 35.580000, 118.830000},
-    {"WWHPMHEV4CS4", "山东省/临沂市", "山东/临沂/临沂", "Linyi", 35.050000, 118.350000},
-    {"WWHPKVN1B7SS", "山东省/临沂市/兰山区", "山东/临沂/兰山", "Lanshan", 35.052200, 118.341997},
-    {"WWHP5E068244", "山东省/临沂市/罗庄区", "山东/临沂/罗庄", "Luozhuang", 34.997378, 118.279166},
-    {"WWHPW5YPSX1Q", "山东省/临沂市/河东区", "山东/临沂/河东", "Hedong", 35.090285, 118.397107},
-    {"WWK4PZEJZ06D", "山东省/临沂市/沂南县", "山东/临沂/沂南", "Yinan", 35.550000, 118.470000},
-    {"WWHHVN7U4GU0", "山东省/临沂市/郯城县", "山东/临沂/郯城", "Tancheng", 34.620000, 118.350000},
-    {"WWK7E383W76V", "山东省/临沂市/沂水县", "山东/临沂/沂水", "Yishui", 35.780000, 118.620000},
-    {"WW5YM1KZEQDE", "山东省/临沂市/兰陵县", "山东/临沂/兰陵", "Lanling", 34.856822, 117.999830},
-    {"WW7BSKXNSHX9", "山东省/临沂市/费县", "山东/临沂/费县", "Feixian", 35.270000, 117.970000},
-    {"WW79UWXD3XTH", "山东省/临沂市/平邑县", "山东/临沂/平邑", "Pingyi", 35.500000, 117.630000},
-    {"WWK80H367EQ4", "山东省/临沂市/莒南县", "山东/临沂/莒南", "Junan", 35.180000, 118.830000},
-    {"WW7G5WDH04T7", "山东省/临沂市/蒙阴县", "山东/临沂/蒙阴", "Mengyin", 35.720000, 117.930000},
-    {"WWHQEUYR9RU3", "山东省/临沂市/临沭县", "山东/临沂/临沭", "Linshu", 34.920000, 118.650000},
-    {"WWDTN3X443VR", "山东省/德州市", "山东/德州/德州", "Dezhou", 37.450000, 116.300000},
-    {"WWDTN3D6R378", "山东省/德州市/德城区", "山东/德州/德城", "Decheng", 37.450039, 116.293689},
-    {"WWDUKEEXJB7G", "山东省/德州市/陵城区", "山东/德州/陵城", "Lingxian", 37.330000, 116.570000},
-    {"WWEN1MUX5HXQ", "山东省/德州市/宁津县", "山东/德州/宁津", "Ningjin", 37.650000, 116.780000},
-    {"WWEQZJ9S2NRW", "山东省/德州市/庆云县", "山东/德州/庆云", "Qingyun", 37.780000, 117.380000},
-    {"WWE5E2QJHQK4", "山东省/德州市/临邑县", "山东/德州/临邑", "Linyi", 37.180000, 116.870000},
-    {"WWE12ENZ81JW", "山东省/德州市/齐河县", "山东/德州/齐河", "Qihe", 36.800000, 116.750000},
-    {"WWDG3QTDZWHQ", "山东省/德州市/平原县", "山东/德州/平原", "Pingyuan", 37.170000, 116.430000},
-    {"WWD6PWS97GJP", "山东省/德州市/夏津县", "山东/德州/夏津", "Xiajin", 36.950000, 116.000000},
-    {"WWDE9PXW5NBU", "山东省/德州市/武城县", "山东/德州/武城", "Wucheng", 37.220000, 116.070000},
-    {"WWEQESS30VZ8", "山东省/德州市/乐陵市", "山东/德州/乐陵", "Leling", 37.730000, 117.230000},
-    {"WWDFJFZKGFZN", "山东省/德州市/禹城市", "山东/德州/禹城", "Yucheng", 36.930000, 116.630000},
-    {"WW6RR5W09UKP", "山东省/聊城市", "山东/聊城/聊城", "Liaocheng", 36.450000, 115.980000},
-    {"WW6RR28NEJY1", "山东省/聊城市/东昌府区", "山东/聊城/东昌府", "Dongchangfu", 36.434558, 115.982803},
-    {"WW6M6XKQM812", "山东省/聊城市/阳谷县", "山东/聊城/阳谷", "Yanggu", 36.120000, 115.780000},
-    {"WW6Q05KR43E2", "山东省/聊城市/莘县", "山东/聊城/莘县", "Shenxian", 36.230000, 115.670000},
-    {"WWD8J74TVQ4X", "山东省/聊城市/茌平县", "山东/聊城/茌平", "Chiping", 36.580000, 116.250000},
-    {"WW6WTMDTT6FE", "山东省/聊城市/东阿县", "山东/聊城/东阿", "Donge", 36.330000, 116.250000},
-    {"WW6PD8VX3UYK", "山东省/聊城市/冠县", "山东/聊城/冠县", "Guanxian", 36.480000, 115.430000},
-    {"WWD9SZUP761S", "山东省/聊城市/高唐县", "山东/聊城/高唐", "Gaotang", 36.870000, 116.230000},
-    {"WWD38U64V3UU", "山东省/聊城市/临清市", "山东/聊城/临清", "Linqing", 36.850000, 115.700000},
-    {"WWEUSKZ4K1P9", "山东省/滨州市", "山东/滨州/滨州", "Binzhou", 37.380000, 117.970000},
-    {"WWEUVMYTH3FB", "山东省/滨州市/滨城区", "山东/滨州/滨城", "Bincheng", 37.429914, 118.013263},
-    {"WWSN2P5DKT27", "山东省/滨州市/沾化区", "山东/滨州/沾化", "Zhanhua", 37.700000, 118.130000},
-    {"WWET1Z0BU6QH", "山东省/滨州市/惠民县", "山东/滨州/惠民", "Huimin", 37.480000, 117.500000},
-    {"WWEW5D74SS6T", "山东省/滨州市/阳信县", "山东/滨州/阳信", "Yangxin", 37.630000, 117.580000},
-    {"WWEWSH99NTG8", "山东省/滨州市/无棣县", "山东/滨州/无棣", "Wudi", 37.730000, 117.600000},
-    {"WWS524GWKTBQ", "山东省/滨州市/博兴县", "山东/滨州/博兴", "Boxing", 37.150000, 118.130000},
-    {"WWE9Z1B3EF69", "山东省/滨州市/邹平市", "山东/滨州/邹平", "Zouping", 36.880000, 117.730000},
-    {"WW607X60CDS4", "山东省/菏泽市", "山东/菏泽/菏泽", "Heze", 35.240163, 115.469125},
-    {"WW60D38662MB", "山东省/菏泽市/牡丹区", "山东/菏泽/牡丹", "Mudan", 35.252768, 115.411825},
-    {"WW4PTB7981VF", "山东省/菏泽市/定陶区", "山东/菏泽/定陶", "Dingtao", 35.070000, 115.570000},
-    {"WW4NHUW7KNEF", "山东省/菏泽市/曹县", "山东/菏泽/曹县", "Caoxian", 34.830000, 115.530000},
-    {"WW4TCRNUSN1M", "山东省/菏泽市/单县", "山东/菏泽/单县", "Shanxian", 34.800000, 116.080000},
-    {"WW4QUFMNX8NW", "山东省/菏泽市/成武县", "山东/菏泽/成武", "Chengwu", 34.950000, 115.880000},
-    {"WW693KQGUN33", "山东省/菏泽市/巨野县", "山东/菏泽/巨野", "Juye", 35.400000, 116.080000},
-    {"WW66W0C9HBCR", "山东省/菏泽市/郓城县", "山东/菏泽/郓城", "Yuncheng", 35.600000, 115.930000},
-    {"WW64K72D30D4", "山东省/菏泽市/鄄城县", "山东/菏泽/鄄城", "Juancheng", 35.570000, 115.500000},
-    {"WW3BDWW8YKEM", "山东省/菏泽市/东明县", "山东/菏泽/东明", "Dongming", 35.280000, 115.080000},
-    {"WW0V9QP93VS8", "河南省/郑州市", "河南/郑州/郑州", "Zhengzhou", 34.750000, 113.620000},
-    {"WW0V9JVYNWC8", "河南省/郑州市/中原区", "河南/郑州/中原", "Zhongyuan", 34.749449, 113.606810},
-    {"WW0V9C9B6YEV", "河南省/郑州市/二七区", "河南/郑州/二七", "Erqi", 34.725115, 113.634118},
-    {"WW0VDXJ1BPHH", "河南省/郑州市/管城回族区", "河南/郑州/管城", "Guancheng", 34.755588, 113.671423},
-    {"WW0VFR2EUERG", "河南省/郑州市/金水区", "河南/郑州/金水", "Jinshui", 34.801229, 113.654455},
-    {"WW0W1DZCPQ6N", "河南省/郑州市/上街区", "河南/郑州/上街", "Shangjie", 34.820000, 113.280000},
-    {"WW0Y378GUEEZ", "河南省/郑州市/惠济区", "河南/郑州/惠济", "Huiji", 34.868523, 113.610847},
-    {"WW1J92W6TMP7", "河南省/郑州市/中牟县", "河南/郑州/中牟", "Zhongmou", 34.720000, 113.970000},
-    {"WW0MFCTTBVCC", "河南省/郑州市/巩义市", "河南/郑州/巩义", "Gongyi", 34.770000, 112.980000},
-    {"WW0TU7X25TBT", "河南省/郑州市/荥阳市", "河南/郑州/荥阳", "Xingyang", 34.780000, 113.400000},
-    {"WW0SKJBZC6X9", "河南省/郑州市/新密市", "河南/郑州/新密", "Xinmi", 34.530000, 113.380000},
-    {"WW0GEYRDT0F3", "河南省/郑州市/新郑市", "河南/郑州/新郑", "Xinzheng", 34.400000, 113.730000},
-    {"WW0KH51FMCSX", "河南省/郑州市/登封市", "河南/郑州/登封", "Dengfeng", 34.470000, 113.030000},
-    {"WW1MBZNSXN1M", "河南省/开封市", "河南/开封/开封", "Kaifeng", 34.800000, 114.300000},
-    {"WW1Q444M0R4Q", "河南省/开封市/龙亭区", "河南/开封/龙亭", "Longting", 34.816571, 114.348807},
-    {"WW1MFR3EUQW8", "河南省/开封市/顺河回族区", "河南/开封/顺河", "Shunhe", 34.801246, 114.358941},
-    {"WW1MCVJWFGY2", "河南省/开封市/鼓楼区", "河南/开封/鼓楼", "Gulou", 34.789387, 114.342397},
-    {"WW1MCGJKPY32", "河南省/开封市/禹王台区", "河南/开封/禹王台", "Yuwangtai", 34.777942, 114.342261},
-    {"WW1MSP3R5F6Y", "河南省/开封市/祥符区", "河南/开封/祥符", "Xiangfu", 34.757837, 114.435475},
-    {"WW1SECSHRFG1", "河南省/开封市/杞县", "河南/开封/杞县", "Qixian", 34.550000, 114.780000},
-    {"WW1KHUFS83F7", "河南省/开封市/通许县", "河南/开封/通许", "Tongxu", 34.480000, 114.470000},
-    {"WW15Y1ZR4C4C", "河南省/开封市/尉氏县", "河南/开封/尉氏", "Weishi", 34.420000, 114.180000},
-    {"WW1WHFC35YMQ", "河南省/开封市/兰考县", "河南/开封/兰考", "Lankao", 34.820000, 114.820000},
-    {"WQPUYY7S4GV2", "河南省/洛阳市", "河南/洛阳/洛阳", "Luoyang", 34.620000, 112.450000},
-    {"WQPVR4HUTRT6", "河南省/洛阳市/老城区", "河南/洛阳/老城", "Laocheng", 34.684651, 112.462810},
-    {"WQPVNJZ60FQ0", "河南省/洛阳市/西工区", "河南/洛阳/西工", "Xigong", 34.660847, 112.422106},
-    {"WQPVRC7XNMRC", "河南省/洛阳市/瀍河回族区", "河南/洛阳/瀍河", "Chanhe", 34.680948, 112.494099},
-    {"WQPVJMRRPS1G", "河南省/洛阳市/涧西区", "河南/洛阳/涧西", "Jianxi", 34.658969, 112.389431},
-    {"WW0N9C670PS3", "河南省/洛阳市/吉利区", "河南/洛阳/吉利", "Jili", 34.900000, 112.580000},
-    {"WQPUZN3QU0QH", "河南省/洛阳市/洛龙区", "河南/洛阳/洛龙", "Luolong", 34.620454, 112.457951},
-    {"WQPYNKT52YS4", "河南省/洛阳市/孟津县", "河南/洛阳/孟津", "Mengjin", 34.830000, 112.430000},
-    {"WQPV8094SMJ5", "河南省/洛阳市/新安县", "河南/洛阳/新安", "Xinan", 34.720000, 112.150000},
-    {"WQP25VRNY82K", "河南省/洛阳市/栾川县", "河南/洛阳/栾川", "Luanchuan", 33.780000, 111.620000},
-    {"WQPDQBUDPM6K", "河南省/洛阳市/嵩县", "河南/洛阳/嵩县", "Songxian", 34.150000, 112.100000},
-    {"WQPFR2F4HVQK", "河南省/洛阳市/汝阳县", "河南/洛阳/汝阳", "Ruyang", 34.150000, 112.470000},
-    {"WQPU2KPTW6QH", "河南省/洛阳市/宜阳县", "河南/洛阳/宜阳", "Yiyang", 34.520000, 112.170000},
-    {"WQP7SDTN18D0", "河南省/洛阳市/洛宁县", "河南/洛阳/洛宁", "Luoning", 34.380000, 111.650000},
-    {"WQPGY1VXPC59", "河南省/洛阳市/伊川县", "河南/洛阳/伊川", "Yichuan", 34.420000, 112.420000},
-    {"WW0JW67UUMPP", "河南省/洛阳市/偃师市", "河南/洛阳/偃师", "Yanshi", 34.730000, 112.780000},
-    {"WW02P7XHT0KB", "河南省/平顶山市", "河南/平顶山/平顶山", "Pingdingshan", 33.770000, 113.180000},
-    {"WTBXCVVWGV3X", "河南省/平顶山市/新华区", "河南/平顶山/新华", "Xinhua", 33.738828, 113.287746},
-    {"WTBXFV7X18K5", "河南省/平顶山市/卫东区", "河南/平顶山/卫东", "Weidong", 33.736097, 113.328851},
-    {"WW02BEK9YDH8", "河南省/平顶山市/石龙区", "河南/平顶山/石龙", "Shilong", 33.900000, 112.880000},
-    {"WTBXFEC4SER7", "河南省/平顶山市/湛河区", "河南/平顶山/湛河", "Zhanhe", 33.727101, 113.314565},
-    {"WW02SZXJ3CYB", "河南省/平顶山市/宝丰县", "河南/平顶山/宝丰", "Baofeng", 33.880000, 113.070000},
-    {"WTBX726FWQJZ", "河南省/平顶山市/叶县", "河南/平顶山/叶县", "Yexian", 33.620000, 113.350000},
-    {"WTBRCH772XTX", "河南省/平顶山市/鲁山县", "河南/平顶山/鲁山", "Lushan", 33.730000, 112.900000},
-    {"WW0922H394YZ", "河南省/平顶山市/郏县", "河南/平顶山/郏县", "Jiaxian", 33.970000, 113.220000},
-    {"WTBTRNNDX9ZJ", "河南省/平顶山市/舞钢市", "河南/平顶山/舞钢", "Wugang", 33.300000, 113.520000},
-    {"WW04RS2Q9T9V", "河南省/平顶山市/汝州市", "河南/平顶山/汝州", "Ruzhou", 34.170000, 112.830000},
-    {"WW3M645C7VU9", "河南省/安阳市/文峰区", "河南/安阳/文峰", "Wenfeng", 36.090334, 114.351020},
-    {"WW3M6GBCXPV8", "河南省/安阳市", "河南/安阳", "Anyang", 36.100000, 114.380000},
-    {"WW3M6J4GNWC1", "河南省/安阳市/北关区", "河南/安阳/北关", "Beiguan", 36.107119, 114.349760},
-    {"WW3M2VSG55XX", "河南省/安阳市/殷都区", "河南/安阳/殷都", "Yindou", 36.109849, 114.297434},
-    {"WW3M36GRRPTQ", "河南省/安阳市/龙安区", "河南/安阳/龙安", "Longan", 36.095494, 114.317515},
-    {"WW3M6GBCXPV8", "河南省/安阳市/安阳县", "河南/安阳/安阳", "Anyang", 36.100000, 114.380000},
-    {"WW3K6551HJ7F", "河南省/安阳市/汤阴县", "河南/安阳/汤阴", "Tangyin", 35.920000, 114.350000},
-    {"WW36MVNUT2TP", "河南省/安阳市/滑县", "河南/安阳/滑县", "Huaxian", 35.580000, 114.520000},
-    {"WW3SW87XUJ9X", "河南省/安阳市/内黄县", "河南/安阳/内黄", "Neihuang", 35.950000, 114.900000},
-    {"WW2VNN34YPR7", "河南省/安阳市/林州市", "河南/安阳/林州", "Linzhou", 36.070000, 113.820000},
-    {"WW372S04V500", "河南省/鹤壁市", "河南/鹤壁/鹤壁", "Hebi", 35.750000, 114.280000},
-    {"WW3HT9QF0RGY", "河南省/鹤壁市/鹤山区", "河南/鹤壁/鹤山", "Heshan", 35.954518, 114.157235},
-    {"WW3HNNYPHZ0B", "河南省/鹤壁市/山城区", "河南/鹤壁/山城", "Shancheng", 35.897693, 114.178367},
-    {"WW372F92W3ME", "河南省/鹤壁市/淇滨区", "河南/鹤壁/淇滨", "Qibin", 35.741365, 114.292764},
-    {"WW36YTSBB3YY", "河南省/鹤壁市/浚县", "河南/鹤壁/浚县", "Xunxian", 35.670000, 114.550000},
-    {"WW34W8VCHBGZ", "河南省/鹤壁市/淇县", "河南/鹤壁/淇县", "Qixian", 35.600000, 114.200000},
-    {"WW2BZF5MQKGW", "河南省/新乡市", "河南/新乡", "Xinxiang", 35.300000, 113.900000},
-    {"WW2BZ4VP4ZYC", "河南省/新乡市/红旗区", "河南/新乡/红旗", "Hongqi", 35.304436, 113.869298},
-    {"WW2BYFWJJFTX", "河南省/新乡市/卫滨区", "河南/新乡/卫滨", "Weibin", 35.302692, 113.859813},
-    {"WW3121D1WKYR", "河南省/新乡市/凤泉区", "河南/新乡/凤泉", "Fengquan", 35.384501, 113.909273},
-    {"WW2BZVJ83JVK", "河南省/新乡市/牧野区", "河南/新乡/牧野", "Muye", 35.315626, 113.902867},
-    {"WW2BZF5MQKGW", "河南省/新乡市/新乡县", "河南/新乡/新乡", "Xinxiang", 35.300000, 113.900000},
-    {"WW2BDHTQSUW1", "河南省/新乡市/获嘉县", "河南/新乡/获嘉", "Huojia", 35.270000, 113.650000},
-    {"WW1P3KWMJ3X6", "河南省/新乡市/原阳县", "河南/新乡/原阳", "Yuanyang", 35.050000, 113.970000},
-    {"WW1PYWVGSFGV", "河南省/新乡市/延津县", "河南/新乡/延津", "Yanjin", 35.150000, 114.200000},
-    {"WW1R7SWJ51XF", "河南省/新乡市/封丘县", "河南/新乡/封丘", "Fengqiu", 35.050000, 114.420000},
-    {"WW381XGQVETF", "河南省/新乡市/长垣县", "河南/新乡/长垣", "Changyuan", 35.200000, 114.680000},
-    {"WW317SR5ZWKC", "河南省/新乡市/卫辉市", "河南/新乡/卫辉", "Weihui", 35.400000, 114.070000},
-    {"WW2CSZKC3PHE", "河南省/新乡市/辉县市", "河南/新乡/辉县", "Huixian", 35.460000, 113.770000},
-    {"WW2835D5K7BE", "河南省/焦作市", "河南/焦作/焦作", "Jiaozuo", 35.220000, 113.250000},
-    {"WW282RRS2F2Y", "河南省/焦作市/解放区", "河南/焦作/解放", "Jiefang", 35.240763, 113.224444},
-    {"WW22RQSXG9EB", "河南省/焦作市/中站区", "河南/焦作/中站", "Zhongzhan", 35.237239, 113.176501},
-    {"WW28DD4PFZ4S", "河南省/焦作市/马村区", "河南/焦作/马村", "Macun", 35.256496, 113.315856},
-    {"WW28349N3ETT", "河南省/焦作市/山阳区", "河南/焦作/山阳", "Shanyang", 35.215021, 113.248516},
-    {"WW28MJMJWEFR", "河南省/焦作市/修武县", "河南/焦作/修武", "Xiuwu", 35.230000, 113.430000},
-    {"WW22HFX01GNV", "河南省/焦作市/博爱县", "河南/焦作/博爱", "Boai", 35.170000, 113.070000},
-    {"WW0XSJBB36PX", "河南省/焦作市/武陟县", "河南/焦作/武陟", "Wuzhi", 35.100000, 113.380000},
-    {"WW0QTNY3FZZQ", "河南省/焦作市/温县", "河南/焦作/温县", "Wenxian", 34.930000, 113.080000},
-    {"WW0R9F15G9ZP", "河南省/焦作市/沁阳市", "河南/焦作/沁阳", "Qinyang", 35.080000, 112.930000},
-    {"WW0NW37GHRX1", "河南省/焦作市/孟州市", "河南/焦作/孟州", "Mengzhou", 34.900000, 112.780000},
-    {"WW3G3XDR3729", "河南省/濮阳市", "河南/濮阳", "Puyang", 35.770000, 115.030000},
-    {"WW3GD3N1D5CE", "河南省/濮阳市/华龙区", "河南/濮阳/华龙", "Hualong", 35.777256, 115.068142},
-    {"WW3U5X7UDMJ9", "河南省/濮阳市/清丰县", "河南/濮阳/清丰", "Qingfeng", 35.900000, 115.120000},
-    {"WW3VM2NJ4X3Z", "河南省/濮阳市/南乐县", "河南/濮阳/南乐", "Nanle", 36.080000, 115.200000},
-    {"WW6HH3BTCHDH", "河南省/濮阳市/范县", "河南/濮阳/范县", "Fanxian", 35.870000, 115.500000},
-    {"WW6KU1X7HWMH", "河南省/濮阳市/台前县", "河南/濮阳/台前", "Taiqian", 36.000000, 115.850000},
-    {"WW3G3XDR3729", "河南省/濮阳市/濮阳县", "河南/濮阳/濮阳", "Puyang", 35.770000, 115.030000},
-    {"WW0CWDZP17BC", "河南省/许昌市", "河南/许昌/许昌", "Xuchang", 34.030000, 113.850000},
-    {"WW0CTFQUC063", "河南省/许昌市/魏都区", "河南/许昌/魏都", "Weidou", 34.026848, 113.816689},
-    {"WW0FJUQZWUZD", "河南省/许昌市/建安区", "河南/许昌/建安", "Jianan", 34.126222, 113.816943},
-    {"WW11YXTYUUEZ", "河南省/许昌市/鄢陵县", "河南/许昌/鄢陵", "Yanling", 34.100000, 114.200000},
-    {"WW08W61WE9KG", "河南省/许昌市/襄城县", "河南/许昌/襄城", "Xiangcheng", 33.850000, 113.480000},
-    {"WW0DQH6QDTSM", "河南省/许昌市/禹州市", "河南/许昌/禹州", "Yuzhou", 34.170000, 113.470000},
-    {"WW0FSVSCCNKE", "河南省/许昌市/长葛市", "河南/许昌/长葛", "Changge", 34.220000, 113.770000},
-    {"WTCP494CDTDN", "河南省/漯河市", "河南/漯河/漯河", "Luohe", 33.580000, 114.020000},
-    {"WTCNFQTJ89KK", "河南省/漯河市/源汇区", "河南/漯河/源汇", "Yuanhui", 33.566931, 114.012021},
-    {"WTCP44TJ8VH0", "河南省/漯河市/郾城区", "河南/漯河/郾城", "Yancheng", 33.588923, 114.001045},
-    {"WTCPH4KRB0VV", "河南省/漯河市/召陵区", "河南/漯河/召陵", "Zhaoling", 33.587914, 114.087875},
-    {"WTBY1J8ZZGEM", "河南省/漯河市/舞阳县", "河南/漯河/舞阳", "Wuyang", 33.430000, 113.600000},
-    {"WW102S9RC2VQ", "河南省/漯河市/临颍县", "河南/漯河/临颍", "Linying", 33.820000, 113.930000},
-    {"WQPJF7T25VCT", "河南省/三门峡市", "河南/三门峡/三门峡", "Sanmenxia", 34.780000, 111.200000},
-    {"WQPJF4089RWV", "河南省/三门峡市/湖滨区", "河南/三门峡/湖滨", "Hubin", 34.771855, 111.182390},
-    {"WQNVRSVYPSG6", "河南省/三门峡市/陕州区", "河南/三门峡/陕州", "Shanxian", 34.700000, 111.080000},
-    {"WQPMYCTVGTZ3", "河南省/三门峡市/渑池县", "河南/三门峡/渑池", "Mianchi", 34.770000, 111.750000},
-    {"WQNCXN85SS19", "河南省/三门峡市/卢氏县", "河南/三门峡/卢氏", "Lushi", 34.050000, 111.050000},
-    {"WQPT9WJ1RVTB", "河南省/三门峡市/义马市", "河南/三门峡/义马", "Yima", 34.750000, 111.870000},
-    {"WQNU6UJJD4RU", "河南省/三门峡市/灵宝市", "河南/三门峡/灵宝", "Lingbao", 34.520000, 110.870000},
-    {"WTB58RQWFJC5", "河南省/南阳市", "河南/南阳/南阳", "Nanyang", 33.000000, 112.520000},
-    {"WTB5BB88DRS4", "河南省/南阳市/宛城区", "河南/南阳/宛城", "Wancheng", 33.005803, 112.533748},
-    {"WTB58TBXWEYG", "河南省/南阳市/卧龙区", "河南/南阳/卧龙", "Wolong", 32.991878, 112.522948},
-    {"WMZYW6MP8US5", "河南省/南阳市/南召县", "河南/南阳/南召", "Nanzhao", 33.500000, 112.430000},
-    {"WTBM72S5FCE0", "河南省/南阳市/方城县", "河南/南阳/方城", "Fangcheng", 33.270000, 113.000000},
-    {"WMZM2F3Q038U", "河南省/南阳市/西峡县", "河南/南阳/西峡", "Xixia", 33.280000, 111.480000},
-    {"WMZGCUGMSW32", "河南省/南阳市/镇平县", "河南/南阳/镇平", "Zhenping", 33.030000, 112.230000},
-    {"WMZS10WDJYSC", "河南省/南阳市/内乡县", "河南/南阳/内乡", "Neixiang", 33.050000, 111.850000},
-    {"WMZK2Z1K0R8G", "河南省/南阳市/淅川县", "河南/南阳/淅川", "Xichuan", 33.130000, 111.480000},
-    {"WTBK1B945WX1", "河南省/南阳市/社旗县", "河南/南阳/社旗", "Sheqi", 33.050000, 112.930000},
-    {"WTB4P8B739CF", "河南省/南阳市/唐河县", "河南/南阳/唐河", "Tanghe", 32.700000, 112.830000},
-    {"WMZCH84F8XRU", "河南省/南阳市/新野县", "河南/南阳/新野", "Xinye", 32.520000, 112.350000},
-    {"WTB8HKZ2GT2E", "河南省/南阳市/桐柏县", "河南/南阳/桐柏", "Tongbai", 32.370000, 113.400000},
-    {"WMZ9YMNNV393", "河南省/南阳市/邓州市", "河南/南阳/邓州", "Dengzhou", 32.680000, 112.080000},
-    {"WW45ZXMVB36N", "河南省/商丘市", "河南/商丘/商丘", "Shangqiu", 34.450000, 115.650000},
-    {"WW45YWXD3T0C", "河南省/商丘市/梁园区", "河南/商丘/梁园", "Liangyuan", 34.445299, 115.608510},
-    {"WW45XSKNVP4C", "河南省/商丘市/睢阳区", "河南/商丘/睢阳", "Suiyang", 34.389777, 115.647801},
-    {"WW1V5GG4GKNJ", "河南省/商丘市/民权县", "河南/商丘/民权", "Minquan", 34.650000, 115.130000},
-    {"WW1GFRRMV36Y", "河南省/商丘市/睢县", "河南/商丘/睢县", "Suixian", 34.450000, 115.070000},
-    {"WW45BPMMYC2Q", "河南省/商丘市/宁陵县", "河南/商丘/宁陵", "Ningling", 34.450000, 115.320000},
-    {"WW1CZDQBHSR6", "河南省/商丘市/柘城县", "河南/商丘/柘城", "Zhecheng", 34.070000, 115.300000},
-    {"WW47SNR6S8V1", "河南省/商丘市/虞城县", "河南/商丘/虞城", "Yucheng", 34.400000, 115.850000},
-    {"WW4DDX7K1NKP", "河南省/商丘市/夏邑县", "河南/商丘/夏邑", "Xiayi", 34.230000, 116.130000},
-    {"WW4BCQVWRDK3", "河南省/商丘市/永城市", "河南/商丘/永城", "Yongcheng", 33.920000, 116.430000},
-    {"WT9NG9P4ZDHG", "河南省/信阳市", "河南/信阳/信阳", "Xinyang", 32.130000, 114.070000},
-    {"WT9NER49RVET", "河南省/信阳市/浉河区", "河南/信阳/浉河", "Shihe", 32.118775, 114.052843},
-    {"WT9NSU5T2MR4", "河南省/信阳市/平桥区", "河南/信阳/平桥", "Pingqiao", 32.102981, 114.119817},
-    {"WT9RNJY4W7J9", "河南省/信阳市/罗山县", "河南/信阳/罗山", "Luoshan", 32.200000, 114.530000},
-    {"WT9WNT5DH09S", "河南省/信阳市/光山县", "河南/信阳/光山", "Guangshan", 32.020000, 114.900000},
-    {"WT9EVYJF1525", "河南省/信阳市/新县", "河南/信阳/新县", "Xinxian", 31.630000, 114.870000},
-    {"WTDHCVP8QVSS", "河南省/信阳市/商城县", "河南/信阳/商城", "Shangcheng", 31.800000, 115.400000},
-    {"WTDR065W56GC", "河南省/信阳市/固始县", "河南/信阳/固始", "Gushi", 32.180000, 115.680000},
-    {"WT9YC946C60E", "河南省/信阳市/潢川县", "河南/信阳/潢川", "Huangchuan", 32.130000, 115.030000},
-    {"WTF03ZXWQYHT", "河南省/信阳市/淮滨县", "河南/信阳/淮滨", "Huaibin", 32.430000, 115.400000},
-    {"WTC849PU6V0D", "河南省/信阳市/息县", "河南/信阳/息县", "Xixian", 32.350000, 114.730000},
-    {"WTCX2BMDDWHP", "河南省/周口市", "河南/周口/周口", "Zhoukou", 33.620000, 114.650000},
-    {"WTCX2VDHGZTY", "河南省/周口市/川汇区", "河南/周口/川汇", "Chuanhui", 33.649233, 114.645250},
-    {"WW13FF2BPHMD", "河南省/周口市/扶沟县", "河南/周口/扶沟", "Fugou", 34.070000, 114.380000},
-    {"WW12Q1N5Q2TT", "河南省/周口市/西华县", "河南/周口/西华", "Xihua", 33.800000, 114.530000},
-    {"WTCQXZCNMT12", "河南省/周口市/商水县", "河南/周口/商水", "Shangshui", 33.530000, 114.600000},
-    {"WTCY42R3J76B", "河南省/周口市/沈丘县", "河南/周口/沈丘", "Shenqiu", 33.400000, 115.070000},
-    {"WTCZMMY16W9U", "河南省/周口市/郸城县", "河南/周口/郸城", "Dancheng", 33.650000, 115.200000},
-    {"WTCXYHM56P8X", "河南省/周口市/淮阳县", "河南/周口/淮阳", "Huaiyang", 33.730000, 114.880000},
-    {"WW19V6R0NUR4", "河南省/周口市/太康县", "河南/周口/太康", "Taikang", 34.070000, 114.850000},
-    {"WW40EVCGP195", "河南省/周口市/鹿邑县", "河南/周口/鹿邑", "Luyi", 33.870000, 115.480000},
-    {"WTCWQ97SK5CW", "河南省/周口市/项城市", "河南/周口/项城", "Xiangcheng", 33.450000, 114.900000},
-    {"WTC5DEFF6TD5", "河南省/驻马店市", "河南/驻马店/驻马店", "Zhumadian", 32.980000, 114.020000},
-    {"WTC59FGT5T22", "河南省/驻马店市/驿城区", "河南/驻马店/驿城", "Yicheng", 32.974977, 113.988111},
-    {"WTCJFSDUDE40", "河南省/驻马店市/西平县", "河南/驻马店/西平", "Xiping", 33.380000, 114.020000},
-    {"WTCM228GGCX8", "河南省/驻马店市/上蔡县", "河南/驻马店/上蔡", "Shangcai", 33.270000, 114.270000},
-    {"WTCE86P00T7N", "河南省/驻马店市/平舆县", "河南/驻马店/平舆", "Pingyu", 32.970000, 114.630000},
-    {"WTC36Y8UZ0MW", "河南省/驻马店市/正阳县", "河南/驻马店/正阳", "Zhengyang", 32.600000, 114.380000},
-    {"WTC4DE4CFE4J", "河南省/驻马店市/确山县", "河南/驻马店/确山", "Queshan", 32.800000, 114.020000},
-    {"WTBD4SMPG6H6", "河南省/驻马店市/泌阳县", "河南/驻马店/泌阳", "Biyang", 32.720000, 113.320000},
-    {"WTC7DP7NUJGG", "河南省/驻马店市/汝南县", "河南/驻马店/汝南", "Runan", 33.000000, 114.350000},
-    {"WTCHD4U28XCH", "河南省/驻马店市/遂平县", "河南/驻马店/遂平", "Suiping", 33.150000, 114.000000},
-    {"WTCF23VYS4QP", "河南省/驻马店市/新蔡县", "河南/驻马店/新蔡", "Xincai", 32.750000, 114.980000},
-    {"WW0P9B6381U6", "河南省/济源市", "河南/济源/济源", "Jiyuan", 35.070000, 112.580000},
-    {"WT3Q0FW9ZJ3Q", "湖北省/武汉市", "湖北/武汉/武汉", "Wuhan", 30.600000, 114.300000},
-    {"WT3Q15127BGF", "湖北省/武汉市/江岸区", "湖北/武汉/江岸", "Jiangan", 30.602464, 114.303640},
-    {"WT3Q05M8D0GQ", "湖北省/武汉市/江汉区", "湖北/武汉/江汉", "Jianghan", 30.603881, 114.265456},
-    {"WT3JYZUB3PKY", "湖北省/武汉市/硚口区", "湖北/武汉/硚口", "Qiaokou", 30.584647, 114.209454},
-    {"WT3JYFXEDP1P", "湖北省/武汉市/汉阳区", "湖北/武汉/汉阳", "Hanyang", 30.556365, 114.213268},
-    {"WT3MC4WT3FKT", "湖北省/武汉市/武昌区", "湖北/武汉/武昌", "Wuchang", 30.556639, 114.310766},
-    {"WT3Q6F0VYYG8", "湖北省/武汉市/青山区", "湖北/武汉/青山", "Qingshan", 30.641893, 114.379987},
-    {"WT3M9BFEN0YH", "湖北省/武汉市/洪山区", "湖北/武汉/洪山", "Hongshan", 30.502687, 114.338416},
-    {"WT3NJN4YMV8N", "湖北省/武汉市/东西湖区", "湖北/武汉/东西湖", "Dongxihu", 30.620000, 114.130000},
-    {"WT3H7VVXDGNX", "湖北省/武汉市/汉南区", "湖北/武汉/汉南", "Hannan", 30.311211, 114.078725},
-    {"WT3JFYFJ7T4T", "湖北省/武汉市/蔡甸区", "湖北/武汉/蔡甸", "Caidian", 30.580000, 114.030000},
-    {"WT3K9MJ39443", "湖北省/武汉市/江夏区", "湖北/武汉/江夏", "Jiangxia", 30.350000, 114.320000},
-    {"WT3RDE9WY1J4", "湖北省/武汉市/黄陂区", "湖北/武汉/黄陂", "Huangpi", 30.870000, 114.370000},
-    {"WT3XS24F3BU6", "湖北省/武汉市/新洲区", "湖北/武汉/新洲", "Xinzhou", 30.850000, 114.800000},
-    {"WT3GC9DRC209", "湖北省/黄石市", "湖北/黄石/黄石", "Huangshi", 30.200000, 115.030000},
-    {"WT3GFQ2E83RH", "湖北省/黄石市/黄石港区", "湖北/黄石/黄石港", "Huangshigang", 30.225370, 115.060521},
-    {"WT3GG9EZF2J9", "湖北省/黄石市/西塞山区", "湖北/黄石/西塞山", "Xisaishan", 30.200000, 115.120000},
-    {"WT3G8NNE5PV2", "湖北省/黄石市/下陆区", "湖北/黄石/下陆", "Xialu", 30.180000, 114.970000},
-    {"WT3EY9EXU019", "湖北省/黄石市/铁山区", "湖北/黄石/铁山", "Tieshan", 30.200000, 114.900000},
-    {"WT3CV6N0FE3C", "湖北省/黄石市/阳新县", "湖北/黄石/阳新", "Yangxin", 29.850000, 115.200000},
-    {"WT3G0PW95NTM", "湖北省/黄石市/大冶市", "湖北/黄石/大冶", "Daye", 30.100000, 114.970000},
-    {"WMYC8VK3H18J", "湖北省/十堰市", "湖北/十堰/十堰", "Shiyan", 32.636442, 110.781155},
-    {"WMYC3Y8SV0MN", "湖北省/十堰市/茅箭区", "湖北/十堰/茅箭", "Maojian", 32.600000, 110.820000},
-    {"WMYC8ZG8115H", "湖北省/十堰市/张湾区", "湖北/十堰/张湾", "Zhangwan", 32.650000, 110.780000},
-    {"WMYFCB88T5T4", "湖北省/十堰市/郧阳区", "湖北/十堰/郧阳", "Yunxian", 32.830000, 110.820000},
-    {"WMYE8XMQUMZE", "湖北省/十堰市/郧西县", "湖北/十堰/郧西", "Yunxi", 33.000000, 110.420000},
-    {"WMWRK77135MQ", "湖北省/十堰市/竹山县", "湖北/十堰/竹山", "Zhushan", 32.230000, 110.230000},
-    {"WMWPBEXTTK9V", "湖北省/十堰市/竹溪县", "湖北/十堰/竹溪", "Zhuxi", 32.320000, 109.720000},
-    {"WMWWRWPJK123", "湖北省/十堰市/房县", "湖北/十堰/房县", "Fangxian", 32.070000, 110.730000},
-    {"WMZ31TW3KRG1", "湖北省/十堰市/丹江口市", "湖北/十堰/丹江口", "Danjiangkou", 32.550000, 111.520000},
-    {"WMRNSHZ87YY1", "湖北省/宜昌市", "湖北/宜昌/宜昌", "Yichang", 30.700000, 111.280000},
-    {"WMRNSPPT7TUH", "湖北省/宜昌市/西陵区", "湖北/宜昌/西陵", "Xiling", 30.713213, 111.279987},
-    {"WMRNMGN3GBDB", "湖北省/宜昌市/伍家岗区", "湖北/宜昌/伍家岗", "Wujiagang", 30.646665, 111.355183},
-    {"WMRNEGFZKJCH", "湖北省/宜昌市/点军区", "湖北/宜昌/点军", "Dianjun", 30.695704, 111.262495},
-    {"WMRJXW7VJMW8", "湖北省/宜昌市/猇亭区", "湖北/宜昌/猇亭", "Xiaoting", 30.533267, 111.428724},
-    {"WMRPJ1SB0P8P", "湖北省/宜昌市/夷陵区", "湖北/宜昌/夷陵", "Yiling", 30.770000, 111.320000},
-    {"WMX2U0N7ZEBC", "湖北省/宜昌市/远安县", "湖北/宜昌/远安", "Yuanan", 31.070000, 111.630000},
-    {"WMWF25JDYP96", "湖北省/宜昌市/兴山县", "湖北/宜昌/兴山", "Xingshan", 31.350000, 110.750000},
-    {"WMQZMKMJV2TC", "湖北省/宜昌市/秭归县", "湖北/宜昌/秭归", "Zigui", 30.830000, 110.980000},
-    {"WMRJ3FYU9G8T", "湖北省/宜昌市/长阳土家族自治县", "湖北/宜昌/长阳", "Changyang", 30.470000, 111.180000},
-    {"WMQEY3ERVBJ1", "湖北省/宜昌市/五峰土家族自治县", "湖北/宜昌/五峰", "Wufeng", 30.200000, 110.670000},
-    {"WMRKBN5KV4XR", "湖北省/宜昌市/宜都市", "湖北/宜昌/宜都", "Yidu", 30.400000, 111.450000},
-    {"WMRRRDEEWB3J", "湖北省/宜昌市/当阳市", "湖北/宜昌/当阳", "Dangyang", 30.820000, 111.780000},
-    {"WMRMP7S7TG0S", "湖北省/宜昌市/枝江市", "湖北/宜昌/枝江", "Zhijiang", 30.430000, 111.770000},
-    {"WMXY3PVX93RV", "湖北省/襄阳市", "湖北/襄阳/襄阳", "Xiangyang", 32.080000, 112.200000},
-    {"WMXWPE9J39Q2", "湖北省/襄阳市/襄城区", "湖北/襄阳/襄城", "Xiangcheng", 32.012322, 112.127911},
-    {"WMXWR9FQ1X17", "湖北省/襄阳市/樊城区", "湖北/襄阳/樊城", "Fancheng", 32.046814, 112.129621},
-    {"WMXYBV9K9THS", "湖北省/襄阳市/襄州区", "湖北/襄阳/襄州", "Xiangzhou", 32.155036, 112.183184},
-    {"WMXSBC25GV7U", "湖北省/襄阳市/南漳县", "湖北/襄阳/南漳", "Nanzhang", 31.780000, 111.830000},
-    {"WMXRSDT43S40", "湖北省/襄阳市/谷城县", "湖北/襄阳/谷城", "Gucheng", 32.270000, 111.650000},
-    {"WMXJ7E9F2YSR", "湖北省/襄阳市/保康县", "湖北/襄阳/保康", "Baokang", 31.880000, 111.250000},
-    {"WMZ2JNEE5T7P", "湖北省/襄阳市/老河口市", "湖北/襄阳/老河口", "Laohekou", 32.380000, 111.670000},
-    {"WT8NV9N4C6JE", "湖北省/襄阳市/枣阳市", "湖北/襄阳/枣阳", "Zaoyang", 32.130000, 112.750000},
-    {"WMXU6Q3YQSD6", "湖北省/襄阳市/宜城市", "湖北/襄阳/宜城", "Yicheng", 31.720000, 112.250000},
-    {"WT3SYNJHF48X", "湖北省/鄂州市", "湖北/鄂州/鄂州", "Ezhou", 30.400000, 114.880000},
-    {"WT3E17UHSWMM", "湖北省/鄂州市/梁子湖区", "湖北/鄂州/梁子湖", "Liangzihu", 30.080000, 114.670000},
-    {"WT3TDX5CTXP7", "湖北省/鄂州市/华容区", "湖北/鄂州/华容", "Huarong", 30.536795, 114.724634},
-    {"WT3SYQ9ZG5M7", "湖北省/鄂州市/鄂城区", "湖北/鄂州/鄂城", "Echeng", 30.403265, 114.886572},
-    {"WMXB90VDC7PZ", "湖北省/荆门市", "湖北/荆门/荆门", "Jingmen", 31.030000, 112.200000},
-    {"WMXB9J4RH898", "湖北省/荆门市/东宝区", "湖北/荆门/东宝", "Dongbao", 31.054061, 112.195668},
-    {"WMXB1PTX96XF", "湖北省/荆门市/掇刀区", "湖北/荆门/掇刀", "Duodao", 30.980000, 112.200000},
-    {"WT2N9UF22NU3", "湖北省/荆门市/沙洋县", "湖北/荆门/沙洋", "Shayang", 30.700000, 112.580000},
-    {"WT813F662JHK", "湖北省/荆门市/钟祥市", "湖北/荆门/钟祥", "Zhongxiang", 31.170000, 112.580000},
-    {"WT82MXHBT507", "湖北省/荆门市/京山市", "湖北/荆门/京山", "Jingshan", 31.020000, 113.100000},
-    {"WT3PBQDH23US", "湖北省/孝感市", "湖北/孝感/孝感", "Xiaogan", 30.930000, 113.920000},
-    {"WT2ZZUXQMFTK", "湖北省/孝感市/孝南区", "湖北/孝感/孝南", "Xiaonan", 30.919361, 113.905474},
-    {"WT91C2YKMQPR", "湖北省/孝感市/孝昌县", "湖北/孝感/孝昌", "Xiaochang", 31.250000, 113.970000},
-    {"WT95SG5SSDX9", "湖北省/孝感市/大悟县", "湖北/孝感/大悟", "Dawu", 31.570000, 114.120000},
-    {"WT8BKRN0X55E", "湖北省/孝感市/云梦县", "湖北/孝感/云梦", "Yunmeng", 31.020000, 113.750000},
-    {"WT8B0670UF1V", "湖北省/孝感市/应城市", "湖北/孝感/应城", "Yingcheng", 30.950000, 113.570000},
-    {"WT8CFUE0ZYRZ", "湖北省/孝感市/安陆市", "湖北/孝感/安陆", "Anlu", 31.270000, 113.680000},
-    {"WT2YQ78MPNPG", "湖北省/孝感市/汉川市", "湖北/孝感/汉川", "Hanchuan", 30.650000, 113.830000},
-    {"WMRU9C7MH9C3", "湖北省/荆州市", "湖北/荆州", "Jingzhou", 30.330000, 112.230000},
-    {"WMRU6PDDV99V", "湖北省/荆州市/沙市区", "湖北/荆州/沙市", "Shashi", 30.320000, 112.240000},
-    {"WMRU9C7MH9C3", "湖北省/荆州市/荆州区", "湖北/荆州/荆州", "Jingzhou", 30.330000, 112.230000},
-    {"WMRG1F56KW32", "湖北省/荆州市/公安县", "湖北/荆州/公安", "Gongan", 30.070000, 112.230000},
-    {"WT238SSDNDUS", "湖北省/荆州市/监利县", "湖北/荆州/监利", "Jianli", 29.820000, 112.880000},
-    {"WMRFY4V9RVEX", "湖北省/荆州市/江陵县", "湖北/荆州/江陵", "Jiangling", 30.030000, 112.420000},
-    {"WMRCJSPJVCDT", "湖北省/荆州市/石首市", "湖北/荆州/石首", "Shishou", 29.730000, 112.400000},
-    {"WT29T8GV8DEK", "湖北省/荆州市/洪湖市", "湖北/荆州/洪湖", "Honghu", 29.800000, 113.450000},
-    {"WMR7XQH7JZB8", "湖北省/荆州市/松滋市", "湖北/荆州/松滋", "Songzi", 30.180000, 111.770000},
-    {"WT3TJZMB152J", "湖北省/黄冈市", "湖北/黄冈/黄冈", "Huanggang", 30.450000, 114.870000},
-    {"WT3TNHBFY1PX", "湖北省/黄冈市/黄州区", "湖北/黄冈/黄州", "Huangzhou", 30.436728, 114.874345},
-    {"WT3WMBJB9JB5", "湖北省/黄冈市/团风县", "湖北/黄冈/团风", "Tuanfeng", 30.630000, 114.870000},
-    {"WT99BNREPWDS", "湖北省/黄冈市/红安县", "湖北/黄冈/红安", "Hongan", 31.280000, 114.620000},
-    {"WT6P1GRDQZUE", "湖北省/黄冈市/罗田县", "湖北/黄冈/罗田", "Luotian", 30.780000, 115.400000},
-    {"WT6QBJU7DR7Q", "湖北省/黄冈市/英山县", "湖北/黄冈/英山", "Yingshan", 30.750000, 115.670000},
-    {"WT3VPP301EMT", "湖北省/黄冈市/浠水县", "湖北/黄冈/浠水", "Xishui", 30.450000, 115.270000},
-    {"WT65FXJW9BQQ", "湖北省/黄冈市/蕲春县", "湖北/黄冈/蕲春", "Qichun", 30.230000, 115.430000},
-    {"WT67N5CSSY3M", "湖北省/黄冈市/黄梅县", "湖北/黄冈/黄梅", "Huangmei", 30.080000, 115.930000},
-    {"WT9C3S4K9M28", "湖北省/黄冈市/麻城市", "湖北/黄冈/麻城", "Macheng", 31.180000, 115.030000},
-    {"WT61V6HBY5KC", "湖北省/黄冈市/武穴市", "湖北/黄冈/武穴", "Wuxue", 29.850000, 115.550000},
-    {"WT33C6J2C563", "湖北省/咸宁市", "湖北/咸宁/咸宁", "Xianning", 29.850000, 114.320000},
-    {"WT33BG1B7CC8", "湖北省/咸宁市/咸安区", "湖北/咸宁/咸安", "Xianan", 29.855399, 114.293338},
-    {"WT2FXCEQNM5D", "湖北省/咸宁市/嘉鱼县", "湖北/咸宁/嘉鱼", "Jiayu", 29.980000, 113.900000},
-    {"WT0YQHC1W5PQ", "湖北省/咸宁市/通城县", "湖北/咸宁/通城", "Tongcheng", 29.250000, 113.820000},
-    {"WT304G6J5X68", "湖北省/咸宁市/崇阳县", "湖北/咸宁/崇阳", "Chongyang", 29.550000, 114.030000},
-    {"WT32MUWBMRVJ", "湖北省/咸宁市/通山县", "湖北/咸宁/通山", "Tongshan", 29.600000, 114.520000},
-    {"WT2CP6KGS3D9", "湖北省/咸宁市/赤壁市", "湖北/咸宁/赤壁", "Chibi", 29.720000, 113.880000},
-    {"WT8S7Y3W2KX4", "湖北省/随州市", "湖北/随州/随州", "Suizhou", 31.720000, 113.370000},
-    {"WT8S7WJG9YYR", "湖北省/随州市/曾都区", "湖北/随州/曾都", "Zengdou", 31.718168, 113.364914},
-    {"WT8T4P1VBGB4", "湖北省/随州市/随县", "湖北/随州/随县", "Suixian", 31.855866, 113.293451},
-    {"WT8GYH1PY5PR", "湖北省/随州市/广水市", "湖北/随州/广水", "Guangshui", 31.620000, 113.820000},
-    {"WMMU75CW7CKH", "湖北省/恩施土家族苗族自治州", "湖北/恩施", "Enshi", 30.300000, 109.470000},
-    {"WMMU75CW7CKH", "湖北省/恩施土家族苗族自治州/恩施市", "湖北/恩施/恩施", "Enshi", 30.300000, 109.470000},
-    {"WMMKQGBQKCRH", "湖北省/恩施土家族苗族自治州/利川市", "湖北/恩施/利川", "Lichuan", 30.300000, 108.930000},
-    {"WMQN0FWCYM6Q", "湖北省/恩施土家族苗族自治州/建始县", "湖北/恩施/建始", "Jianshi", 30.600000, 109.730000},
-    {"WMW2WS7Z77D8", "湖北省/恩施土家族苗族自治州/巴东县", "湖北/恩施/巴东", "Badong", 31.050000, 110.330000},
-    {"WMMFE38YHVHF", "湖北省/恩施土家族苗族自治州/宣恩县", "湖北/恩施/宣恩", "Xuanen", 29.980000, 109.480000},
-    {"WMM8GG0DE34B", "湖北省/恩施土家族苗族自治州/咸丰县", "湖北/恩施/咸丰", "Xianfeng", 29.680000, 109.150000},
-    {"WMJZCMYWKYB7", "湖北省/恩施土家族苗族自治州/来凤县", "湖北/恩施/来凤", "Laifeng", 29.520000, 109.400000},
-    {"WMQ4PG1KHGFX", "湖北省/恩施土家族苗族自治州/鹤峰县", "湖北/恩施/鹤峰", "Hefeng", 29.900000, 110.030000},
-    {"WT2SV8EY0D76", "湖北省/仙桃市", "湖北/仙桃/仙桃", "Xiantao", 30.370000, 113.450000},
-    {"WT2M09U9QEH8", "湖北省/潜江市", "湖北/潜江/潜江", "Qianjiang", 30.420000, 112.880000},
-    {"WT2QRPRCSNKH", "湖北省/天门市", "湖北/天门/天门", "Tianmen", 30.670000, 113.170000},
-    {"WMW7Q9T3W529", "湖北省/神农架林区", "湖北/神农架/神农架", "Shennongjia", 31.517304, 110.332175},
-    {"WT029G15ETRJ", "湖南省/长沙市", "湖南/长沙/长沙", "Changsha", 28.230000, 112.930000},
-    {"WT027GXDDZVH", "湖南省/长沙市/芙蓉区", "湖南/长沙/芙蓉", "Furong", 28.188643, 113.026782},
-    {"WSBRGN2DUPB7", "湖南省/长沙市/天心区", "湖南/长沙/天心", "Tianxin", 28.115901, 112.984257},
-    {"WT029SWNTQ9M", "湖南省/长沙市/岳麓区", "湖南/长沙/岳麓", "Yuelu", 28.238761, 112.925947},
-    {"WT02FBTQR9TC", "湖南省/长沙市/开福区", "湖南/长沙/开福", "Kaifu", 28.260664, 112.979951},
-    {"WT02H4GSFM21", "湖南省/长沙市/雨花区", "湖南/长沙/雨花", "Yuhua", 28.140950, 113.032247},
-    {"WT01RK950X33", "湖南省/长沙市/望城区", "湖南/长沙/望城", "Wangcheng", 28.370000, 112.820000},
-    {"WT02TNDSJP30", "湖南省/长沙市/长沙县", "湖南/长沙/长沙县", "Changshaxian", 28.249322, 113.074938},
-    {"WT0B1SWCDUM4", "湖南省/长沙市/浏阳市", "湖南/长沙/浏阳", "Liuyang", 28.150000, 113.630000},
-    {"WT009NU2JJDW", "湖南省/长沙市/宁乡市", "湖南/长沙/宁乡", "Ningxiang", 28.250000, 112.550000},
-    {"WSBQQ66C8040", "湖南省/株洲市", "湖南/株洲/株洲", "Zhuzhou", 27.830000, 113.130000},
-    {"WSBQRPW5R0E0", "湖南省/株洲市/荷塘区", "湖南/株洲/荷塘", "Hetang", 27.859142, 113.167724},
-    {"WSBQNDXN4W0R", "湖南省/株洲市/芦淞区", "湖南/株洲/芦淞", "Lusong", 27.788234, 113.146928},
-    {"WSBQTGJS3ZM1", "湖南省/株洲市/石峰区", "湖南/株洲/石峰", "Shifeng", 27.878576, 113.111883},
-    {"WSBQM479QTF1", "湖南省/株洲市/天元区", "湖南/株洲/天元", "Tianyuan", 27.829988, 113.076377},
-    {"WSBMWDBCBUTQ", "湖南省/株洲市/渌口区", "湖南/株洲/渌口", "Lukou", 27.700979, 113.138276},
-    {"WSB9DGHQKKUC", "湖南省/株洲市/攸县", "湖南/株洲/攸县", "Youxian", 27.000000, 113.330000},
-    {"WSB8RQY12DPE", "湖南省/株洲市/茶陵县", "湖南/株洲/茶陵", "Chaling", 26.800000, 113.530000},
-    {"WS8YSUSC1JU8", "湖南省/株洲市/炎陵县", "湖南/株洲/炎陵", "Yanling", 26.480000, 113.770000},
-    {"WSBTQM1T7TUG", "湖南省/株洲市/醴陵市", "湖南/株洲/醴陵", "Liling", 27.670000, 113.480000},
-    {"WSBQ3F31E8P0", "湖南省/湘潭市", "湖南/湘潭", "Xiangtan", 27.830000, 112.930000},
-    {"WSBQ3PSWU03K", "湖南省/湘潭市/雨湖区", "湖南/湘潭/雨湖", "Yuhu", 27.859742, 112.901861},
-    {"WSBQDD9F5K58", "湖南省/湘潭市/岳塘区", "湖南/湘潭/岳塘", "Yuetang", 27.875426, 112.963973},
-    {"WSBQ3F31E8P0", "湖南省/湘潭市/湘潭县", "湖南/湘潭/湘潭", "Xiangtan", 27.830000, 112.930000},
-    {"WSBJB8JFGN9T", "湖南省/湘潭市/湘乡市", "湖南/湘潭/湘乡", "Xiangxiang", 27.730000, 112.530000},
-    {"WSBNBKW84135", "湖南省/湘潭市/韶山市", "湖南/湘潭/韶山", "Shaoshan", 27.930000, 112.520000},
-    {"WSB118FZZ57Y", "湖南省/衡阳市", "湖南/衡阳/衡阳", "Hengyang", 26.900000, 112.570000},
-    {"WSB148ETSU8F", "湖南省/衡阳市/珠晖区", "湖南/衡阳/珠晖", "Zhuhui", 26.898247, 112.614875},
-    {"WSB0FX94CB94", "湖南省/衡阳市/雁峰区", "湖南/衡阳/雁峰", "Yanfeng", 26.892260, 112.611313},
-    {"WSB161E8EB7F", "湖南省/衡阳市/石鼓区", "湖南/衡阳/石鼓", "Shigu", 26.946804, 112.592863},
-    {"WSB117TP0EC6", "湖南省/衡阳市/蒸湘区", "湖南/衡阳/蒸湘", "Zhengxiang", 26.914979, 112.561821},
-    {"WSB5J0XQZ2HM", "湖南省/衡阳市/南岳区", "湖南/衡阳/南岳", "Nanyue", 27.250000, 112.730000},
-    {"WKZCMJ9RDU2U", "湖南省/衡阳市/衡阳县", "湖南/衡阳/衡阳县", "Hengyangxian", 26.970000, 112.370000},
-    {"WSB05F5C931H", "湖南省/衡阳市/衡南县", "湖南/衡阳/衡南", "Hengnan", 26.730000, 112.670000},
-    {"WSB6BMJ6JXGV", "湖南省/衡阳市/衡山县", "湖南/衡阳/衡山", "Hengshan", 27.230000, 112.870000},
-    {"WSB641Z8MVBK", "湖南省/衡阳市/衡东县", "湖南/衡阳/衡东", "Hengdong", 27.080000, 112.950000},
-    {"WKZ8R75KC3G6", "湖南省/衡阳市/祁东县", "湖南/衡阳/祁东", "Qidong", 26.780000, 112.120000},
-    {"WS8NRCWGESFY", "湖南省/衡阳市/耒阳市", "湖南/衡阳/耒阳", "Leiyang", 26.420000, 112.850000},
-    {"WKXYM38EEUCW", "湖南省/衡阳市/常宁市", "湖南/衡阳/常宁", "Changning", 26.420000, 112.380000},
-    {"WKZ7089YZ20M", "湖南省/邵阳市", "湖南/邵阳/邵阳", "Shaoyang", 27.250000, 111.470000},
-    {"WKZ6CN1JMM0C", "湖南省/邵阳市/双清区", "湖南/邵阳/双清", "Shuangqing", 27.236036, 111.490857},
-    {"WKZ4ZSP7H0ES", "湖南省/邵阳市/大祥区", "湖南/邵阳/大祥", "Daxiang", 27.224640, 111.433473},
-    {"WKZ7008UVZQF", "湖南省/邵阳市/北塔区", "湖南/邵阳/北塔", "Beita", 27.249695, 111.446598},
-    {"WKZ7NBTYG8PM", "湖南省/邵阳市/邵东县", "湖南/邵阳/邵东", "Shaodong", 27.250000, 111.750000},
-    {"WKZ72J7QT1P7", "湖南省/邵阳市/新邵县", "湖南/邵阳/新邵", "Xinshao", 27.320000, 111.450000},
-    {"WKZ1S50Q6UV9", "湖南省/邵阳市/邵阳县", "湖南/邵阳/邵阳县", "Shaoyangxian", 27.000000, 111.270000},
-    {"WKYFQ9196W2T", "湖南省/邵阳市/隆回县", "湖南/邵阳/隆回", "Longhui", 27.120000, 111.030000},
-    {"WKY9UH69ETRX", "湖南省/邵阳市/洞口县", "湖南/邵阳/洞口", "Dongkou", 27.050000, 110.570000},
-    {"WKWR4W8Z9P0U", "湖南省/邵阳市/绥宁县", "湖南/邵阳/绥宁", "Suining", 26.580000, 110.150000},
-    {"WKWY67QTBJNG", "湖南省/邵阳市/新宁县", "湖南/邵阳/新宁", "Xinning", 26.430000, 110.850000},
-    {"WKWQN2S86K61", "湖南省/邵阳市/城步苗族自治县", "湖南/邵阳/城步", "Chengbu", 26.370000, 110.320000},
-    {"WKY8J6N39C4U", "湖南省/邵阳市/武冈市", "湖南/邵阳/武冈", "Wugang", 26.730000, 110.630000},
-    {"WT0RN4EKXHCD", "湖南省/岳阳市", "湖南/岳阳", "Yueyang", 29.370000, 113.120000},
-    {"WT0RN5QNW4KR", "湖南省/岳阳市/岳阳楼区", "湖南/岳阳/岳阳楼", "Yueyanglou", 29.374451, 113.123737},
-    {"WT0X9MY4SEDS", "湖南省/岳阳市/云溪区", "湖南/岳阳/云溪", "Yunxi", 29.475394, 113.266493},
-    {"WT0RE7SWF39G", "湖南省/岳阳市/君山区", "湖南/岳阳/君山", "Junshan", 29.463753, 113.000664},
-    {"WT0RN4EKXHCD", "湖南省/岳阳市/岳阳县", "湖南/岳阳/岳阳", "Yueyang", 29.370000, 113.120000},
-    {"WT0PCTFYRNGG", "湖南省/岳阳市/华容县", "湖南/岳阳/华容", "Huarong", 29.520000, 112.570000},
-    {"WT070TH9NEKX", "湖南省/岳阳市/湘阴县", "湖南/岳阳/湘阴", "Xiangyin", 28.680000, 112.880000},
-    {"WT0G2S66JU43", "湖南省/岳阳市/平江县", "湖南/岳阳/平江", "Pingjiang", 28.720000, 113.580000},
-    {"WT07V4YK4VP7", "湖南省/岳阳市/汨罗市", "湖南/岳阳/汨罗", "Miluo", 28.800000, 113.080000},
-    {"WT0XWNDM6WK3", "湖南省/岳阳市/临湘市", "湖南/岳阳/临湘", "Linxiang", 29.480000, 113.470000},
-    {"WMPMM26US87X", "湖南省/常德市", "湖南/常德/常德", "Changde", 29.050000, 111.680000},
-    {"WMPMM3CHK06D", "湖南省/常德市/武陵区", "湖南/常德/武陵", "Wuling", 29.058196, 111.677574},
-    {"WMPMJ5PRMJ98", "湖南省/常德市/鼎城区", "湖南/常德/鼎城", "Dingcheng", 29.021660, 111.675212},
-    {"WMPZ27XXYMQP", "湖南省/常德市/安乡县", "湖南/常德/安乡", "Anxiang", 29.420000, 112.170000},
-    {"WMPS7VN4DN7R", "湖南省/常德市/汉寿县", "湖南/常德/汉寿", "Hanshou", 28.900000, 111.970000},
-    {"WMR2WCVZ78R6", "湖南省/常德市/澧县", "湖南/常德/澧县", "Lixian", 29.630000, 111.750000},
-    {"WMPRS9JN9TFH", "湖南省/常德市/临澧县", "湖南/常德/临澧", "Linli", 29.450000, 111.650000},
-    {"WMPK2V168Q2Z", "湖南省/常德市/桃源县", "湖南/常德/桃源", "Taoyuan", 28.900000, 111.480000},
-    {"WMR0Q8B7YPEM", "湖南省/常德市/石门县", "湖南/常德/石门", "Shimen", 29.580000, 111.380000},
-    {"WMR89EV1XBMZ", "湖南省/常德市/津市市", "湖南/常德/津市", "Jinshi", 29.640000, 111.870000},
-    {"WMNT9YCY99D6", "湖南省/张家界市", "湖南/张家界/张家界", "Zhangjiajie", 29.130000, 110.470000},
-    {"WMNTEJXJNE5N", "湖南省/张家界市/永定区", "湖南/张家界/永定", "Yongding", 29.122885, 110.532357},
-    {"WMNWGPJ2PST9", "湖南省/张家界市/武陵源区", "湖南/张家界/武陵源", "Wulingyuan", 29.350000, 110.530000},
-    {"WMPP2EEPGTMR", "湖南省/张家界市/慈利县", "湖南/张家界/慈利", "Cili", 29.420000, 111.120000},
-    {"WMNR680G3J0Z", "湖南省/张家界市/桑植县", "湖南/张家界/桑植", "Sangzhi", 29.400000, 110.150000},
-    {"WMPFEYKZJDQM", "湖南省/益阳市", "湖南/益阳/益阳", "Yiyang", 28.600000, 112.320000},
-    {"WMPFEV7VN8Z5", "湖南省/益阳市/资阳区", "湖南/益阳/资阳", "Ziyang", 28.594155, 112.318671},
-    {"WMPFTN3R4F2V", "湖南省/益阳市/赫山区", "湖南/益阳/赫山区", "Heshanqu", 28.600000, 112.370000},
-    {"WMPZJSRNVUFW", "湖南省/益阳市/南县", "湖南/益阳/南县", "Nanxian", 29.380000, 112.400000},
-    {"WMPDR3ER337R", "湖南省/益阳市/桃江县", "湖南/益阳/桃江", "Taojiang", 28.530000, 112.120000},
-    {"WMP16Y7VMZ6Y", "湖南省/益阳市/安化县", "湖南/益阳/安化", "Anhua", 28.380000, 111.220000},
-    {"WMPUJ7BX7VC9", "湖南省/益阳市/沅江市", "湖南/益阳/沅江", "Yuanjiang", 28.850000, 112.380000},
-    {"WS86EV4EKUK4", "湖南省/郴州市", "湖南/郴州/郴州", "Chenzhou", 25.780000, 113.020000},
-    {"WS86EW2H7GJD", "湖南省/郴州市/北湖区", "湖南/郴州/北湖", "Beihu", 25.787031, 113.005539},
-    {"WS86U09ZVUSD", "湖南省/郴州市/苏仙区", "湖南/郴州/苏仙", "Suxian", 25.800000, 113.030000},
-    {"WS84MHP2P7SK", "湖南省/郴州市/桂阳县", "湖南/郴州/桂阳", "Guiyang", 25.730000, 112.730000},
-    {"WS826PZTTZ0M", "湖南省/郴州市/宜章县", "湖南/郴州/宜章", "Yizhang", 25.400000, 112.950000},
-    {"WS8KTSUFM103", "湖南省/郴州市/永兴县", "湖南/郴州/永兴", "Yongxing", 26.130000, 113.100000},
-    {"WKXCT09Q6C8G", "湖南省/郴州市/嘉禾县", "湖南/郴州/嘉禾", "Jiahe", 25.580000, 112.370000},
-    {"WS2PC4H6TJD9", "湖南省/郴州市/临武县", "湖南/郴州/临武", "Linwu", 25.280000, 112.550000},
-    {"WS8C6G5PXCPY", "湖南省/郴州市/汝城县", "湖南/郴州/汝城", "Rucheng", 25.550000, 113.680000},
-    {"WS9H2E9R12M7", "湖南省/郴州市/桂东县", "湖南/郴州/桂东", "Guidong", 26.080000, 113.930000},
-    {"WS8XCS8DY29X", "湖南省/郴州市/安仁县", "湖南/郴州/安仁", "Anren", 26.700000, 113.270000},
-    {"WS8EB9E86PP2", "湖南省/郴州市/资兴市", "湖南/郴州/资兴", "Zixing", 25.980000, 113.230000},
-    {"WKXQ7GRJYT07", "湖南省/永州市", "湖南/永州/永州", "Yongzhou", 26.430000, 111.620000},
-    {"WKXMHN5QNGN0", "湖南省/永州市/零陵区", "湖南/永州/零陵", "Lingling", 26.225411, 111.625855},
-    {"WKXQ7E2TUMP7", "湖南省/永州市/冷水滩区", "湖南/永州/冷水滩", "Lengshuitan", 26.430000, 111.600000},
-    {"WKXX1NWXTZHU", "湖南省/永州市/祁阳县", "湖南/永州/祁阳", "Qiyang", 26.580000, 111.850000},
-    {"WKXNHJZX5UWN", "湖南省/永州市/东安县", "湖南/永州/东安", "Dongan", 26.400000, 111.280000},
-    {"WKX7SXTN1WFH", "湖南省/永州市/双牌县", "湖南/永州/双牌", "Shuangpai", 25.970000, 111.650000},
-    {"WKX35PD542YQ", "湖南省/永州市/道县", "湖南/永州/道县", "Daoxian", 25.530000, 111.580000},
-    {"WKRPV6H49J8C", "湖南省/永州市/江永县", "湖南/永州/江永", "Jiangyong", 25.280000, 111.330000},
-    {"WKX9EH2FY1CH", "湖南省/永州市/宁远县", "湖南/永州/宁远", "Ningyuan", 25.600000, 111.930000},
-    {"WKXB2DQYZQY8", "湖南省/永州市/蓝山县", "湖南/永州/蓝山", "Lanshan", 25.370000, 112.180000},
-    {"WKXG3WS4GW0Y", "湖南省/永州市/新田县", "湖南/永州/新田", "Xintian", 25.920000, 112.220000},
-    {"WKRR5PFH4KNQ", "湖南省/永州市/江华瑶族自治县", "湖南/永州/江华", "Jianghua", 25.180000, 111.580000},
-    {"WKYHZ4GWCU8B", "湖南省/怀化市", "湖南/怀化/怀化", "Huaihua", 27.570000, 110.000000},
-    {"WKYHZVJMT0CG", "湖南省/怀化市/鹤城区", "湖南/怀化/鹤城", "Hecheng", 27.582125, 110.035503},
-    {"WKY5VS08DDJN", "湖南省/怀化市/中方县", "湖南/怀化/中方", "Zhongfang", 27.400000, 109.930000},
-    {"WMN3ZYB3B2TM", "湖南省/怀化市/沅陵县", "湖南/怀化/沅陵", "Yuanling", 28.470000, 110.380000},
-    {"WKYR71NXU469", "湖南省/怀化市/辰溪县", "湖南/怀化/辰溪", "Chenxi", 28.000000, 110.180000},
-    {"WKYWU69VUC0P", "湖南省/怀化市/溆浦县", "湖南/怀化/溆浦", "Xupu", 27.920000, 110.580000},
-    {"WKY0BEX9J71C", "湖南省/怀化市/会同县", "湖南/怀化/会同", "Huitong", 26.870000, 109.720000},
-    {"WKYND99FT2W1", "湖南省/怀化市/麻阳苗族自治县", "湖南/怀化/麻阳", "Mayang", 27.870000, 109.800000},
-    {"WKVESNX1V3U1", "湖南省/怀化市/新晃侗族自治县", "湖南/怀化/新晃", "Xinhuang", 27.370000, 109.170000},
-    {"WKVUPV4EC4ZS", "湖南省/怀化市/芷江侗族自治县", "湖南/怀化/芷江", "Zhijiang", 27.450000, 109.680000},
-    {"WKTZPYDX9PPS", "湖南省/怀化市/靖州苗族侗族自治县", "湖南/怀化/靖州", "Jingzhou", 26.580000, 109.680000},
-    {"WKWHFH5773SF", "湖南省/怀化市/通道侗族自治县", "湖南/怀化/通道", "Tongdao", 26.170000, 109.780000},
-    {"WKY4EP87RRX0", "湖南省/怀化市/洪江市", "湖南/怀化/洪江", "Hongjiang", 27.200000, 109.820000},
-    {"WKZTU85FVNSV", "湖南省/娄底市", "湖南/娄底/娄底", "Loudi", 27.730000, 112.000000},
-    {"WKZTU89M9NDC", "湖南省/娄底市/娄星区", "湖南/娄底/娄星", "Louxing", 27.733218, 111.996392},
-    {"WKZU1JJEC6ZU", "湖南省/娄底市/双峰县", "湖南/娄底/双峰", "Shuangfeng", 27.450000, 112.200000},
-    {"WKZJUEWPMYZJ", "湖南省/娄底市/新化县", "湖南/娄底/新化", "Xinhua", 27.750000, 111.300000},
-    {"WKZJRWUZEJYP", "湖南省/娄底市/冷水江市", "湖南/娄底/冷水江", "Lengshuijiang", 27.680000, 111.430000},
-    {"WKZMT4ES5W70", "湖南省/娄底市/涟源市", "湖南/娄底/涟源", "Lianyuan", 27.700000, 111.670000},
-    {"WMN114DHVC2T", "湖南省/湘西土家族苗族自治州", "湖南/湖南/湘西", "Xiangxi", 28.315337, 109.734439},
-    {"WMN10GQZYQDK", "湖南省/湘西土家族苗族自治州/吉首市", "湖南/湘西/吉首", "Jishou", 28.320000, 109.730000},
-    {"WMN2S17C2JKC", "湖南省/湘西土家族苗族自治州/泸溪县", "湖南/湘西/泸溪", "Luxi", 28.220000, 110.220000},
-    {"WKVZN00K91EK", "湖南省/湘西土家族苗族自治州/凤凰县", "湖南/湘西/凤凰", "Fenghuang", 27.950000, 109.600000},
-    {"WMJFE6BFSFHU", "湖南省/湘西土家族苗族自治州/花垣县", "湖南/湘西/花垣", "Huayuan", 28.580000, 109.480000},
-    {"WMJGRHKDNHJC", "湖南省/湘西土家族苗族自治州/保靖县", "湖南/湘西/保靖", "Baojing", 28.720000, 109.650000},
-    {"WMN4VFP5SDWN", "湖南省/湘西土家族苗族自治州/古丈县", "湖南/湘西/古丈", "Guzhang", 28.620000, 109.950000},
-    {"WMNHGXQ34XBF", "湖南省/湘西土家族苗族自治州/永顺县", "湖南/湘西/永顺", "Yongshun", 29.000000, 109.850000},
-    {"WMJZDHU7PY4J", "湖南省/湘西土家族苗族自治州/龙山县", "湖南/湘西/龙山", "Longshan", 29.470000, 109.430000},
-    {"WS0E9D8WN298", "广东省/广州市", "广东/广州/广州", "Guangzhou", 23.130000, 113.270000},
-    {"WS0E8F6N4RPM", "广东省/广州市/荔湾区", "广东/广州/荔湾", "Liwan", 23.128662, 113.238937},
-    {"WS0E96FT02NG", "广东省/广州市/越秀区", "广东/广州/越秀", "Yuexiu", 23.131199, 113.261510},
-    {"WS0E66Z20TDM", "广东省/广州市/海珠区", "广东/广州/海珠", "Haizhu", 23.086426, 113.311983},
-    {"WS0EE6PJG2NP", "广东省/广州市/天河区", "广东/广州/天河", "Tianhe", 23.127209, 113.355708},
-    {"WS0EC2PHQX3N", "广东省/广州市/白云区", "广东/广州/白云", "Baiyun", 23.159949, 113.267950},
-    {"WS0EMWYGT1DG", "广东省/广州市/黄埔区", "广东/广州/黄埔", "Huangpu", 23.108977, 113.454312},
-    {"WS0DE3FVQQJF", "广东省/广州市/番禺区", "广东/广州/番禺", "Panyu", 22.950000, 113.350000},
-    {"WS0T07U6CHNV", "广东省/广州市/花都区", "广东/广州/花都", "Huadu", 23.400000, 113.220000},
-    {"WS09XPQTZJDF", "广东省/广州市/南沙区", "广东/广州/南沙", "Nansha", 22.804514, 113.519973},
-    {"WS0VBX4KTY4M", "广东省/广州市/从化区", "广东/广州/从化", "Conghua", 23.550000, 113.580000},
-    {"WS0UW38KR4ZC", "广东省/广州市/增城区", "广东/广州/增城", "Zengcheng", 23.300000, 113.830000},
-    {"WS2V1N2FZZ77", "广东省/韶关市", "广东/韶关/韶关", "Shaoguan", 24.820000, 113.600000},
-    {"WS2V06ENKZ1F", "广东省/韶关市/武江区", "广东/韶关/武江", "Wujiang", 24.800000, 113.570000},
-    {"WS2V148YRZ56", "广东省/韶关市/浈江区", "广东/韶关/浈江", "Zhenjiang", 24.800000, 113.600000},
-    {"WS2U3HBGRV7Q", "广东省/韶关市/曲江区", "广东/韶关/曲江", "Qujiang", 24.680000, 113.600000},
-    {"WS3JGWP0R9HG", "广东省/韶关市/始兴县", "广东/韶关/始兴", "Shixing", 24.950000, 114.070000},
-    {"WS2YSMWJX4GE", "广东省/韶关市/仁化县", "广东/韶关/仁化", "Renhua", 25.080000, 113.750000},
-    {"WS34T0FCJBBP", "广东省/韶关市/翁源县", "广东/韶关/翁源", "Wengyuan", 24.350000, 114.130000},
-    {"WS2SCX09YQC9", "广东省/韶关市/乳源瑶族自治县", "广东/韶关/乳源", "Ruyuan", 24.780000, 113.270000},
-    {"WS30YTVCUV5Y", "广东省/韶关市/新丰县", "广东/韶关/新丰", "Xinfeng", 24.070000, 114.200000},
-    {"WS2WGQFBY7TC", "广东省/韶关市/乐昌市", "广东/韶关/乐昌", "Lechang", 25.130000, 113.350000},
-    {"WS3QBUYWX53K", "广东省/韶关市/南雄市", "广东/韶关/南雄", "Nanxiong", 25.120000, 114.300000},
-    {"WS10730EM8EV", "广东省/深圳市", "广东/深圳/深圳", "Shenzhen", 22.550000, 114.050000},
-    {"WS10M1282EDZ", "广东省/深圳市/罗湖区", "广东/深圳/罗湖", "Luohu", 22.550875, 114.126689},
-    {"WS105K2T7CJQ", "广东省/深圳市/福田区", "广东/深圳/福田", "Futian", 22.524254, 114.049927},
-    {"WS100QW1GPVQ", "广东省/深圳市/南山区", "广东/深圳/南山", "Nanshan", 22.536049, 113.925612},
-    {"WS0CQNGUGPVU", "广东省/深圳市/宝安区", "广东/深圳/宝安", "Baoan", 22.757663, 113.823646},
-    {"WS11R8SX9P8H", "广东省/深圳市/龙岗区", "广东/深圳/龙岗", "Longgang", 22.723802, 114.242063},
-    {"WS10R6V1Z3W3", "广东省/深圳市/盐田区", "广东/深圳/盐田", "Yantian", 22.559360, 114.232040},
-    {"WS115H2FNT23", "广东省/深圳市/龙华区", "广东/深圳/龙华", "Longhua", 22.699499, 114.039395},
-    {"WS134N2PPHDH", "广东省/深圳市/坪山区", "广东/深圳/坪山", "Pingshan", 22.711340, 114.346006},
-    {"WS112TF588VD", "广东省/深圳市/光明区", "广东/深圳/光明", "Guangming", 22.751918, 113.930998},
-    {"WEBY8Q5HHUCU", "广东省/珠海市", "广东/珠海/珠海", "Zhuhai", 22.270000, 113.570000},
-    {"WEBWXTUKFZVF", "广东省/珠海市/香洲区", "广东/珠海/香洲", "Xiangzhou", 22.268771, 113.538677},
-    {"WEBW3TPBZK4N", "广东省/珠海市/斗门区", "广东/珠海/斗门", "Doumen", 22.220000, 113.280000},
-    {"WEBTS3XR5D0W", "广东省/珠海市/金湾区", "广东/珠海/金湾", "Jinwan", 22.070000, 113.400000},
-    {"WS4UZ4EZ953Z", "广东省/汕头市", "广东/汕头/汕头", "Shantou", 23.350000, 116.680000},
-    {"WS4UZZ55FE62", "广东省/汕头市/龙湖区", "广东/汕头/龙湖", "Longhu", 23.374074, 116.711994},
-    {"WS4UZW19C9YK", "广东省/汕头市/金平区", "广东/汕头/金平", "Jinping", 23.368231, 116.698910},
-    {"WS5H2PDDMW50", "广东省/汕头市/濠江区", "广东/汕头/濠江", "Haojiang", 23.288688, 116.722423},
-    {"WS4UMK1T8FMS", "广东省/汕头市/潮阳区", "广东/汕头/潮阳", "Chaoyang", 23.270000, 116.600000},
-    {"WS4U33H9BCEJ", "广东省/汕头市/潮南区", "广东/汕头/潮南", "Chaonan", 23.252873, 116.428335},
-    {"WS5J94MKFJNZ", "广东省/汕头市/澄海区", "广东/汕头/澄海", "Chenghai", 23.480000, 116.770000},
-    {"WS5JNZ7R7SKM", "广东省/汕头市/南澳县", "广东/汕头/南澳", "Nanao", 23.420000, 117.020000},
-    {"WS06YNEMPP18", "广东省/佛山市", "广东/佛山/佛山", "Foshan", 23.020000, 113.120000},
-    {"WS06YJ1QBPTV", "广东省/佛山市/禅城区", "广东/佛山/禅城", "Chancheng", 23.012064, 113.116959},
-    {"WS07NB3R6P5J", "广东省/佛山市/南海区", "广东/佛山/南海", "Nanhai", 23.030000, 113.150000},
-    {"WS09DNWE9K51", "广东省/佛山市/顺德区", "广东/佛山/顺德", "Shunde", 22.800000, 113.300000},
-    {"WS07B3VRJ95C", "广东省/佛山市/三水区", "广东/佛山/三水", "Sanshui", 23.170000, 112.870000},
-    {"WS0628UDNTKS", "广东省/佛山市/高明区", "广东/佛山/高明", "Gaoming", 22.900000, 112.880000},
-    {"WS02MNW64CP6", "广东省/江门市", "广东/江门/江门", "Jiangmen", 22.580000, 113.080000},
-    {"WS03H2M8FGM9", "广东省/江门市/蓬江区", "广东/江门/蓬江", "Pengjiang", 22.677301, 113.046009},
-    {"WS02NRFNW3V1", "广东省/江门市/江海区", "广东/江门/江海", "Jianghai", 22.543698, 113.129242},
-    {"WEBRU49CJZSE", "广东省/江门市/新会区", "广东/江门/新会", "Xinhui", 22.470000, 113.030000},
-    {"WEBNW67ZSKX5", "广东省/江门市/台山市", "广东/江门/台山", "Taishan", 22.250000, 112.780000},
-    {"WEBP7F5UCQ3H", "广东省/江门市/开平市", "广东/江门/开平", "Kaiping", 22.380000, 112.670000},
-    {"WS03D9NHZG9K", "广东省/江门市/鹤山市", "广东/江门/鹤山", "Heshan", 22.770000, 112.970000},
-    {"W7ZY5MWRGETJ", "广东省/江门市/恩平市", "广东/江门/恩平", "Enping", 22.180000, 112.300000},
-    {"W7Y3P046TR7U", "广东省/湛江市", "广东/湛江/湛江", "Zhanjiang", 21.270000, 110.350000},
-    {"W7Y3P80FXRKU", "广东省/湛江市/赤坎区", "广东/湛江/赤坎", "Chikan", 21.270000, 110.370000},
-    {"W7Y885QFFQQT", "广东省/湛江市/霞山区", "广东/湛江/霞山", "Xiashan", 21.200000, 110.400000},
-    {"W7Y8CBCC9WF6", "广东省/湛江市/坡头区", "广东/湛江/坡头", "Potou", 21.230000, 110.470000},
-    {"W7Y3N2HDDR6H", "广东省/湛江市/麻章区", "广东/湛江/麻章", "Mazhang", 21.270000, 110.320000},
-    {"W7Y3SU1EE0Y7", "广东省/湛江市/遂溪县", "广东/湛江/遂溪", "Suixi", 21.380000, 110.250000},
-    {"W7W7DUZQG4DJ", "广东省/湛江市/徐闻县", "广东/湛江/徐闻", "Xuwen", 20.330000, 110.170000},
-    {"W7Y6VRB1THP7", "广东省/湛江市/廉江市", "广东/湛江/廉江", "Lianjiang", 21.620000, 110.270000},
-    {"W7WR0BMGCFTH", "广东省/湛江市/雷州市", "广东/湛江/雷州", "Leizhou", 20.920000, 110.080000},
-    {"W7YCBTHQB1D9", "广东省/湛江市/吴川市", "广东/湛江/吴川", "Wuchuan", 21.430000, 110.770000},
-    {"W7YGK0CKZKF9", "广东省/茂名市", "广东/茂名/茂名", "Maoming", 21.670000, 110.920000},
-    {"W7YG5UHY0DC5", "广东省/茂名市/茂南区", "广东/茂名/茂南", "Maonan", 21.644112, 110.913528},
-    {"W7YFMCGWX6QZ", "广东省/茂名市/电白区", "广东/茂名/电白", "Dianbai", 21.500000, 111.000000},
-    {"W7YUDQQT20NV", "广东省/茂名市/高州市", "广东/茂名/高州", "Gaozhou", 21.920000, 110.850000},
-    {"W7YEM2YKCUFC", "广东省/茂名市/化州市", "广东/茂名/化州", "Huazhou", 21.670000, 110.630000},
-    {"W7YZHSXQ4MUP", "广东省/茂名市/信宜市", "广东/茂名/信宜", "Xinyi", 22.350000, 110.950000},
-    {"WKPGPK45UZQM", "广东省/肇庆市", "广东/肇庆/肇庆", "Zhaoqing", 23.050000, 112.470000},
-    {"WKPGPSCPVC6T", "广东省/肇庆市/端州区", "广东/肇庆/端州", "Duanzhou", 23.054774, 112.479651},
-    {"WS05C2MS6B9J", "广东省/肇庆市/鼎湖区", "广东/肇庆/鼎湖", "Dinghu", 23.161286, 112.562604},
-    {"WKPGNB7X6ZJM", "广东省/肇庆市/高要区", "广东/肇庆/高要", "Gaoyao", 23.030000, 112.450000},
-    {"WKPYQMTN8ZK0", "广东省/肇庆市/广宁县", "广东/肇庆/广宁", "Guangning", 23.630000, 112.430000},
-    {"WKRB0DWBP7NT", "广东省/肇庆市/怀集县", "广东/肇庆/怀集", "Huaiji", 23.920000, 112.180000},
-    {"WKPM31RCDK9F", "广东省/肇庆市/封开县", "广东/肇庆/封开", "Fengkai", 23.430000, 111.500000},
-    {"WKP7XQK6TBB9", "广东省/肇庆市/德庆县", "广东/肇庆/德庆", "Deqing", 23.150000, 111.770000},
-    {"WS0HSP55471W", "广东省/肇庆市/四会市", "广东/肇庆/四会", "Sihui", 23.330000, 112.680000},
-    {"WS17E8Y5G0RU", "广东省/惠州市", "广东/惠州/惠州", "Huizhou", 23.120000, 114.420000},
-    {"WS176DZ1QKTP", "广东省/惠州市/惠城区", "广东/惠州/惠城", "Huicheng", 23.086635, 114.377564},
-    {"WS13SYDE8K43", "广东省/惠州市/惠阳区", "广东/惠州/惠阳", "Huiyang", 22.800000, 114.470000},
-    {"WS17BEB1M10N", "广东省/惠州市/博罗县", "广东/惠州/博罗", "Boluo", 23.180000, 114.280000},
-    {"WS1DDX2S1WRZ", "广东省/惠州市/惠东县", "广东/惠州/惠东", "Huidong", 22.980000, 114.720000},
-    {"WS1NZZFM3BWE", "广东省/惠州市/龙门县", "广东/惠州/龙门", "Longmen", 23.730000, 114.250000},
-    {"WS6D4KH12059", "广东省/梅州市", "广东/梅州/梅州", "Meizhou", 24.280000, 116.120000},
-    {"WS6D64N18D5J", "广东省/梅州市/梅江区", "广东/梅州/梅江", "Meijiang", 24.313013, 116.111781},
-    {"WS6D0U112BPC", "广东省/梅州市/梅县区", "广东/梅州/梅县", "Meixian", 24.280000, 116.050000},
-    {"WS6FX8F350FZ", "广东省/梅州市/大埔县", "广东/梅州/大埔", "Dabu", 24.350000, 116.700000},
-    {"WS4X5XPWQ1NV", "广东省/梅州市/丰顺县", "广东/梅州/丰顺", "Fengshun", 23.770000, 116.180000},
-    {"WS624KM4KE2D", "广东省/梅州市/五华县", "广东/梅州/五华", "Wuhua", 23.930000, 115.770000},
-    {"WS67UBV4XEYW", "广东省/梅州市/平远县", "广东/梅州/平远", "Pingyuan", 24.570000, 115.880000},
-    {"WS6S7E03JJQ6", "广东省/梅州市/蕉岭县", "广东/梅州/蕉岭", "Jiaoling", 24.670000, 116.170000},
-    {"WS633S25BQQ9", "广东省/梅州市/兴宁市", "广东/梅州/兴宁", "Xingning", 24.150000, 115.730000},
-    {"WS4196CZ5GG1", "广东省/汕尾市", "广东/汕尾", "Shanwei", 22.780000, 115.370000},
-    {"WS448MS9ZY2G", "广东省/汕尾市/海丰县", "广东/汕尾/海丰", "Haifeng", 22.970000, 115.330000},
-    {"WS4HX9TU26F1", "广东省/汕尾市/陆河县", "广东/汕尾/陆河", "Luhe", 23.300000, 115.650000},
-    {"WS44X9VV2Q44", "广东省/汕尾市/陆丰市", "广东/汕尾/陆丰", "Lufeng", 22.950000, 115.650000},
-    {"WS1WFPCVR8WG", "广东省/河源市", "广东/河源/河源", "Heyuan", 23.730000, 114.700000},
-    {"WS1X4107UC2Y", "广东省/河源市/源城区", "广东/河源/源城", "Yuancheng", 23.736613, 114.697814},
-    {"WS1YKVXW8X2B", "广东省/河源市/紫金县", "广东/河源/紫金", "Zijin", 23.630000, 115.180000},
-    {"WS3CNE62XTSE", "广东省/河源市/龙川县", "广东/河源/龙川", "Longchuan", 24.100000, 115.250000},
-    {"WS36TH3V9370", "广东省/河源市/连平县", "广东/河源/连平", "Lianping", 24.370000, 114.480000},
-    {"WS3EP6CRX477", "广东省/河源市/和平县", "广东/河源/和平", "Heping", 24.450000, 114.930000},
-    {"WS1XE8KCWCFD", "广东省/河源市/东源县", "广东/河源/东源", "Dongyuan", 23.820000, 114.770000},
-    {"W7ZSKJM3GP7Z", "广东省/阳江市", "广东/阳江/阳江", "Yangjiang", 21.870000, 111.980000},
-    {"W7ZS7KRD3R55", "广东省/阳江市/江城区", "广东/阳江/江城", "Jiangcheng", 21.864591, 111.950055},
-    {"W7ZSMP4KPPW5", "广东省/阳江市/阳东区", "广东/阳江/阳东", "Yangdong", 21.880000, 112.020000},
-    {"W7Z7EZRNYTB7", "广东省/阳江市/阳西县", "广东/阳江/阳西", "Yangxi", 21.750000, 111.620000},
-    {"W7ZQPTEXYG9J", "广东省/阳江市/阳春市", "广东/阳江/阳春", "Yangchun", 22.180000, 111.780000},
-    {"WS0QU43YTBHW", "广东省/清远市", "广东/清远/清远", "Qingyuan", 23.700000, 113.030000},
-    {"WS0QUDT8X9DW", "广东省/清远市/清城区", "广东/清远/清城", "Qingcheng", 23.700351, 113.057195},
-    {"WS0QFZVT2B9G", "广东省/清远市/清新区", "广东/清远/清新", "Qingxin", 23.730000, 112.980000},
-    {"WS0XZ7NP0DXS", "广东省/清远市/佛冈县", "广东/清远/佛冈", "Fogang", 23.880000, 113.530000},
-    {"WS256BQWM4Z0", "广东省/清远市/阳山县", "广东/清远/阳山", "Yangshan", 24.480000, 112.630000},
-    {"WKREY2Y4T7CQ", "广东省/清远市/连山壮族瑶族自治县", "广东/清远/连山", "Lianshan", 24.570000, 112.080000},
-    {"WKRUDUPU3TUP", "广东省/清远市/连南瑶族自治县", "广东/清远/连南", "Liannan", 24.720000, 112.280000},
-    {"WS29S3Z6EW8W", "广东省/清远市/英德市", "广东/清远/英德", "Yingde", 24.180000, 113.400000},
-    {"WKRUVR09GYC9", "广东省/清远市/连州市", "广东/清远/连州", "Lianzhou", 24.780000, 112.380000},
-    {"WS0GHKN5ZP7T", "广东省/东莞市", "广东/东莞/东莞", "Dongguan", 23.050000, 113.750000},
-    {"WS08H58U92R8", "广东省/中山市", "广东/中山/中山", "Zhongshan", 22.520000, 113.380000},
-    {"WEEJ79ZFGR3H", "广东省/东沙群岛", "广东/东沙/东沙", "Dongsha", 20.620476, 116.883342},
-    {"WS4YTUBPDZY9", "广东省/潮州市", "广东/潮州/潮州", "Chaozhou", 23.670000, 116.620000},
-    {"WS4YTY74NHT5", "广东省/潮州市/湘桥区", "广东/潮州/湘桥", "Xiangqiao", 23.677278, 116.624257},
-    {"WS4VRHGY1HCF", "广东省/潮州市/潮安区", "广东/潮州/潮安", "Chaoan", 23.450000, 116.680000},
-    {"WS5NWKUZ9XG1", "广东省/潮州市/饶平县", "广东/潮州/饶平", "Raoping", 23.670000, 117.000000},
-    {"WS4VBP4H9W1J", "广东省/揭阳市", "广东/揭阳/揭阳", "Jieyang", 23.550000, 116.370000},
-    {"WS4TZGH3YWW9", "广东省/揭阳市/榕城区", "广东/揭阳/榕城", "Rongcheng", 23.527557, 116.362325},
-    {"WS4Y14Y3NW7Y", "广东省/揭阳市/揭东区", "广东/揭阳/揭东", "Jiedong", 23.570000, 116.420000},
-    {"WS4M7C2CDSEF", "广东省/揭阳市/揭西县", "广东/揭阳/揭西", "Jiexi", 23.430000, 115.830000},
-    {"WS4EN02X2RHM", "广东省/揭阳市/惠来县", "广东/揭阳/惠来", "Huilai", 23.030000, 116.280000},
-    {"WS4SE9XSQ4YC", "广东省/揭阳市/普宁市", "广东/揭阳/普宁", "Puning", 23.300000, 116.180000},
-    {"WKPDMK3Y8JWT", "广东省/云浮市", "广东/云浮/云浮", "Yunfu", 22.920000, 112.030000},
-    {"WKPDMQRVRJH7", "广东省/云浮市/云城区", "广东/云浮/云城", "Yuncheng", 22.930769, 112.038537},
-    {"WKPEK9EFTPUF", "广东省/云浮市/云安区", "广东/云浮/云安", "Yunan", 23.080000, 112.000000},
-    {"WKPC1U7MHD9Q", "广东省/云浮市/新兴县", "广东/云浮/新兴", "Xinxing", 22.700000, 112.230000},
-    {"WKPK1UVST3GE", "广东省/云浮市/郁南县", "广东/云浮/郁南", "Yunan", 23.230000, 111.530000},
-    {"WKP3DC4UC7TS", "广东省/云浮市/罗定市", "广东/云浮/罗定", "Luoding", 22.770000, 111.570000},
-    {"WKJ1F428HH2F", "广西壮族自治区/南宁市", "广西/南宁/南宁", "Nanning", 22.820000, 108.370000},
-    {"WKJ41BUVFEZJ", "广西壮族自治区/南宁市/兴宁区", "广西/南宁/兴宁", "Xingning", 22.856690, 108.364794},
-    {"WKJ1C6HK1RFJ", "广西壮族自治区/南宁市/青秀区", "广西/南宁/青秀", "Qingxiu", 22.819333, 108.342075},
-    {"WKHCXEZ30PHK", "广西壮族自治区/南宁市/江南区", "广西/南宁/江南", "Jiangnan", 22.784481, 108.269239},
-    {"WKJ1BMPFBBPH", "广西壮族自治区/南宁市/西乡塘区", "广西/南宁/西乡塘", "Xixiangtang", 22.835556, 108.302921},
-    {"WKJ12ZDVDBWV", "广西壮族自治区/南宁市/良庆区", "广西/南宁/良庆", "Liangqing", 22.761873, 108.318113},
-    {"WKJ1KT88R5QS", "广西壮族自治区/南宁市/邕宁区", "广西/南宁/邕宁", "Yongning", 22.750000, 108.480000},
-    {"WKHGZ9ZZ1C53", "广西壮族自治区/南宁市/武鸣区", "广西/南宁/武鸣", "Wuming", 23.170000, 108.270000},
-    {"WKHEF7F1MC5W", "广西壮族自治区/南宁市/隆安县", "广西/南宁/隆安", "Longan", 23.180000, 107.680000},
-    {"WKHYVQNGP8MZ", "广西壮族自治区/南宁市/马山县", "广西/南宁/马山", "Mashan", 23.720000, 108.170000},
-    {"WKJJR321EKT4", "广西壮族自治区/南宁市/上林县", "广西/南宁/上林", "Shanglin", 23.430000, 108.600000},
-    {"WKJK5G1DRC8P", "广西壮族自治区/南宁市/宾阳县", "广西/南宁/宾阳", "Binyang", 23.220000, 108.800000},
-    {"WKJ9N2ZBXD3M", "广西壮族自治区/南宁市/横县", "广西/南宁/横县", "Hengxian", 22.680000, 109.270000},
-    {"WKMF3VJHWB9X", "广西壮族自治区/柳州市", "广西/柳州/柳州", "Liuzhou", 24.330000, 109.420000},
-    {"WKMF3E507941", "广西壮族自治区/柳州市/城中区", "广西/柳州/城中", "Chengzhong", 24.318286, 109.406128},
-    {"WKMF6E9986TH", "广西壮族自治区/柳州市/鱼峰区", "广西/柳州/鱼峰", "Yufeng", 24.321256, 109.447878},
-    {"WKMF3NBB820V", "广西壮族自治区/柳州市/柳南区", "广西/柳州/柳南", "Liunan", 24.338923, 109.380925},
-    {"WKMF97SF9JK7", "广西壮族自治区/柳州市/柳北区", "广西/柳州/柳北", "Liubei", 24.365387, 109.397441},
-    {"WKMDPF5WVXUT", "广西壮族自治区/柳州市/柳江区", "广西/柳州/柳江", "Liujiang", 24.270000, 109.330000},
-    {"WKMSJX6UEMP3", "广西壮族自治区/柳州市/柳城县", "广西/柳州/柳城", "Liucheng", 24.650000, 109.230000},
-    {"WKQ52BQYQ6F2", "广西壮族自治区/柳州市/鹿寨县", "广西/柳州/鹿寨", "Luzhai", 24.480000, 109.730000},
-    {"WKMZ92YXKUBK", "广西壮族自治区/柳州市/融安县", "广西/柳州/融安", "Rongan", 25.230000, 109.400000},
-    {"WKMWW5C7MD8R", "广西壮族自治区/柳州市/融水苗族自治县", "广西/柳州/融水", "Rongshui", 25.070000, 109.250000},
-    {"WKTFWJ073H76", "广西壮族自治区/柳州市/三江侗族自治县", "广西/柳州/三江", "Sanjiang", 25.780000, 109.600000},
-    {"WKQRV6P6WM81", "广西壮族自治区/桂林市", "广西/桂林/桂林", "Guilin", 25.280000, 110.280000},
-    {"WKQRV12W5W7N", "广西壮族自治区/桂林市/秀峰区", "广西/桂林/秀峰", "Xiufeng", 25.276486, 110.259630},
-    {"WKW2JBGCJJ91", "广西壮族自治区/桂林市/叠彩区", "广西/桂林/叠彩", "Diecai", 25.316821, 110.297114},
-    {"WKQRTRKBSFQF", "广西壮族自治区/桂林市/象山区", "广西/桂林/象山", "Xiangshan", 25.264533, 110.276512},
-    {"WKQRWJXEGS3R", "广西壮族自治区/桂林市/七星区", "广西/桂林/七星", "Qixing", 25.255489, 110.313186},
-    {"WKQQVD0VZWM9", "广西壮族自治区/桂林市/雁山区", "广西/桂林/雁山", "Yanshan", 25.104781, 110.282121},
-    {"WKQRE8VPQHGS", "广西壮族自治区/桂林市/临桂区", "广西/桂林/临桂", "Lingui", 25.230000, 110.200000},
-    {"WKQSFP11FWFC", "广西壮族自治区/桂林市/阳朔县", "广西/桂林/阳朔", "Yangshuo", 24.780000, 110.480000},
-    {"WKW2W7SD4R6N", "广西壮族自治区/桂林市/灵川县", "广西/桂林/灵川", "Lingchuan", 25.420000, 110.320000},
-    {"WKWGX2QTNW6D", "广西壮族自治区/桂林市/全州县", "广西/桂林/全州", "Quanzhou", 25.930000, 111.070000},
-    {"WKW9WRGRMFJH", "广西壮族自治区/桂林市/兴安县", "广西/桂林/兴安", "Xingan", 25.620000, 110.670000},
-    {"WKQNNEKZP9XB", "广西壮族自治区/桂林市/永福县", "广西/桂林/永福", "Yongfu", 24.980000, 109.980000},
-    {"WKX0CQ2ZY8R0", "广西壮族自治区/桂林市/灌阳县", "广西/桂林/灌阳", "Guanyang", 25.480000, 111.150000},
-    {"WKW4Z0EXCU8F", "广西壮族自治区/桂林市/龙胜各族自治县", "广西/桂林/龙胜", "Longsheng", 25.800000, 110.000000},
-    {"WKWSJ6W79ZDY", "广西壮族自治区/桂林市/资源县", "广西/桂林/资源", "Ziyuan", 26.030000, 110.630000},
-    {"WKQSJ7Y21UFB", "广西壮族自治区/桂林市/平乐县", "广西/桂林/平乐", "Pingle", 24.630000, 110.630000},
-    {"WKQV3BPVNPMX", "广西壮族自治区/桂林市/恭城瑶族自治县", "广西/桂林/恭城", "Gongcheng", 24.830000, 110.830000},
-    {"WKQ7RVBM07JM", "广西壮族自治区/桂林市/荔浦市", "广西/桂林/荔浦", "Lipu", 24.510000, 110.380000},
-    {"WKPJS42KFVJX", "广西壮族自治区/梧州市", "广西/梧州/梧州", "Wuzhou", 23.480000, 111.270000},
-    {"WKPJT196EK7E", "广西壮族自治区/梧州市/万秀区", "广西/梧州/万秀", "Wanxiu", 23.475489, 111.315337},
-    {"WKPJS5BJ5QEV", "广西壮族自治区/梧州市/长洲区", "广西/梧州/长洲", "Changzhou", 23.488290, 111.269676},
-    {"WKPJ5M5RV8GD", "广西壮族自治区/梧州市/龙圩区", "广西/梧州/龙圩", "Longwei", 23.407707, 111.241276},
-    {"WKPJ5P7PQU7M", "广西壮族自治区/梧州市/苍梧县", "广西/梧州/苍梧", "Cangwu", 23.420000, 111.230000},
-    {"WKNVH01QR7FS", "广西壮族自治区/梧州市/藤县", "广西/梧州/藤县", "Tengxian", 23.380000, 110.920000},
-    {"WKQ9DVQPNWUZ", "广西壮族自治区/梧州市/蒙山县", "广西/梧州/蒙山", "Mengshan", 24.200000, 110.520000},
-    {"WKNFMKMNTMTV", "广西壮族自治区/梧州市/岑溪市", "广西/梧州/岑溪", "Cenxi", 22.920000, 110.980000},
-    {"W7VD5N6F061Q", "广西壮族自治区/北海市", "广西/北海/北海", "Beihai", 21.480000, 109.120000},
-    {"W7VD4VVDG5RQ", "广西壮族自治区/北海市/海城区", "广西/北海/海城", "Haicheng", 21.477389, 109.112916},
-    {"W7VD53NHY2TV", "广西壮族自治区/北海市/银海区", "广西/北海/银海", "Yinhai", 21.451625, 109.135713},
-    {"W7VF3ZENHN9Z", "广西壮族自治区/北海市/铁山港区", "广西/北海/铁山港", "Tieshangang", 21.531523, 109.417136},
-    {"W7VEKBVHBKV9", "广西壮族自治区/北海市/合浦县", "广西/北海/合浦", "Hepu", 21.670000, 109.200000},
-    {"W7V53W659VPW", "广西壮族自治区/防城港市", "广西/防城港/防城港", "Fangchenggang", 21.700000, 108.350000},
-    {"W7V54HT0496N", "广西壮族自治区/防城港市/港口区", "广西/防城港/港口", "Gangkou", 21.645821, 108.376117},
-    {"W7V5CE453YPS", "广西壮族自治区/防城港市/防城区", "广西/防城港/防城", "Fangcheng", 21.770000, 108.350000},
-    {"W7UY10K9H778", "广西壮族自治区/防城港市/上思县", "广西/防城港/上思", "Shangsi", 22.150000, 107.980000},
-    {"W7UF2ZMM76GH", "广西壮族自治区/防城港市/东兴市", "广西/防城港/东兴", "Dongxing", 21.530000, 107.970000},
-    {"W7VHZEYSJ2W6", "广西壮族自治区/钦州市", "广西/钦州/钦州", "Qinzhou", 21.950000, 108.620000},
-    {"W7VKB6R5BC54", "广西壮族自治区/钦州市/钦南区", "广西/钦州/钦南", "Qinnan", 21.941720, 108.653448},
-    {"W7VJGTXK3GR7", "广西壮族自治区/钦州市/钦北区", "广西/钦州/钦北", "Qinbei", 22.135452, 108.445100},
-    {"W7VXX5MB4X51", "广西壮族自治区/钦州市/灵山县", "广西/钦州/灵山", "Lingshan", 22.430000, 109.300000},
-    {"W7VYSY5UHHBS", "广西壮族自治区/钦州市/浦北县", "广西/钦州/浦北", "Pubei", 22.270000, 109.550000},
-    {"WKJGQJ0R3057", "广西壮族自治区/贵港市", "广西/贵港/贵港", "Guigang", 23.100000, 109.600000},
-    {"WKJGMRC50RFB", "广西壮族自治区/贵港市/港北区", "广西/贵港/港北", "Gangbei", 23.114418, 109.568038},
-    {"WKJGMCKCVNJM", "广西壮族自治区/贵港市/港南区", "广西/贵港/港南", "Gangnan", 23.078489, 109.595368},
-    {"WKJGDD9SRNM3", "广西壮族自治区/贵港市/覃塘区", "广西/贵港/覃塘", "Tantang", 23.129731, 109.448168},
-    {"WKNMZZ0K8QJM", "广西壮族自治区/贵港市/平南县", "广西/贵港/平南", "Pingnan", 23.550000, 110.380000},
-    {"WKNM0GVFCUJJ", "广西壮族自治区/贵港市/桂平市", "广西/贵港/桂平", "Guiping", 23.400000, 110.080000},
-    {"WKN2DZXM71F0", "广西壮族自治区/玉林市", "广西/玉林/玉林", "Yulin", 22.630000, 110.170000},
-    {"WKN2DRY662FY", "广西壮族自治区/玉林市/玉州区", "广西/玉林/玉州", "Yuzhou", 22.630854, 110.146623},
-    {"WKN28259H5DJ", "广西壮族自治区/玉林市/福绵区", "广西/玉林/福绵", "Fumian", 22.588082, 110.055030},
-    {"WKND5EK53SYX", "广西壮族自治区/玉林市/容县", "广西/玉林/容县", "Rongxian", 22.870000, 110.550000},
-    {"W7YRJ301TJXQ", "广西壮族自治区/玉林市/陆川县", "广西/玉林/陆川", "Luchuan", 22.330000, 110.270000},
-    {"W7YNWRVWQTP2", "广西壮族自治区/玉林市/博白县", "广西/玉林/博白", "Bobai", 22.280000, 109.970000},
-    {"WKN1KJSBKE3U", "广西壮族自治区/玉林市/兴业县", "广西/玉林/兴业", "Xingye", 22.750000, 109.870000},
-    {"WKN3R043T6GZ", "广西壮族自治区/玉林市/北流市", "广西/玉林/北流", "Beiliu", 22.720000, 110.350000},
-    {"WK5ZFNY7D4FJ", "广西壮族自治区/百色市", "广西/百色/百色", "Baise", 23.900000, 106.620000},
-    {"WK5ZFPDUE1BJ", "广西壮族自治区/百色市/右江区", "广西/百色/右江", "Youjiang", 23.904286, 106.615234},
-    {"WKHNCPBV28D7", "广西壮族自治区/百色市/田阳县", "广西/百色/田阳", "Tianyang", 23.730000, 106.920000},
-    {"WKHNM84RUYV5", "广西壮族自治区/百色市/田东县", "广西/百色/田东", "Tiandong", 23.600000, 107.120000},
-    {"WKHS8J32GEN4", "广西壮族自治区/百色市/平果县", "广西/百色/平果", "Pingguo", 23.320000, 107.580000},
-    {"WK5UDPN7454N", "广西壮族自治区/百色市/德保县", "广西/百色/德保", "Debao", 23.330000, 106.620000},
-    {"WK5M0PRP3SRT", "广西壮族自治区/百色市/那坡县", "广西/百色/那坡", "Napo", 23.420000, 105.830000},
-    {"WK7F90CCHBZX", "广西壮族自治区/百色市/凌云县", "广西/百色/凌云", "Lingyun", 24.350000, 106.570000},
-    {"WK7UBX53FYY3", "广西壮族自治区/百色市/乐业县", "广西/百色/乐业", "Leye", 24.780000, 106.550000},
-    {"WK7D1RDMF2M4", "广西壮族自治区/百色市/田林县", "广西/百色/田林", "Tianlin", 24.300000, 106.230000},
-    {"WK6ERS56ZE00", "广西壮族自治区/百色市/西林县", "广西/百色/西林", "Xilin", 24.500000, 105.100000},
-    {"WK6UUV4ZWYST", "广西壮族自治区/百色市/隆林各族自治县", "广西/百色/隆林", "Longlin", 24.770000, 105.330000},
-    {"WK5ETDSWJ8X2", "广西壮族自治区/百色市/靖西市", "广西/百色/靖西", "Jingxi", 23.130000, 106.420000},
-    {"WKR6FMS0Z3UW", "广西壮族自治区/贺州市", "广西/贺州/贺州", "Hezhou", 24.420000, 111.550000},
-    {"WKR6FKD48S16", "广西壮族自治区/贺州市/八步区", "广西/贺州/八步", "Babu", 24.414819, 111.546959},
-    {"WKR70SJ1M63M", "广西壮族自治区/贺州市/平桂区", "广西/贺州/平桂", "Pinggui", 24.455794, 111.474379},
-    {"WKQC92407NS4", "广西壮族自治区/贺州市/昭平县", "广西/贺州/昭平", "Zhaoping", 24.170000, 110.800000},
-    {"WKR5S9W1TGRJ", "广西壮族自治区/贺州市/钟山县", "广西/贺州/钟山", "Zhongshan", 24.530000, 111.300000},
-    {"WKRJK00M4ZMX", "广西壮族自治区/贺州市/富川瑶族自治县", "广西/贺州/富川", "Fuchuan", 24.830000, 111.270000},
-    {"WKKUE0QPVT8X", "广西壮族自治区/河池市", "广西/河池/河池", "Hechi", 24.700000, 108.070000},
-    {"WKKU6R5K3T89", "广西壮族自治区/河池市/金城江区", "广西/河池/金城江", "Jinchengjiang", 24.692532, 108.033093},
-    {"WKM72U54FE10", "广西壮族自治区/河池市/宜州区", "广西/河池/宜州", "Yizhou", 24.500000, 108.670000},
-    {"WKKQNGKZN9E2", "广西壮族自治区/河池市/南丹县", "广西/河池/南丹", "Nandan", 24.980000, 107.530000},
-    {"WKKNNXNG9CZB", "广西壮族自治区/河池市/天峨县", "广西/河池/天峨", "Tiane", 25.000000, 107.170000},
-    {"WKK5EVPQJG9Q", "广西壮族自治区/河池市/凤山县", "广西/河池/凤山", "Fengshan", 24.550000, 107.050000},
-    {"WKK77R8RQ76C", "广西壮族自治区/河池市/东兰县", "广西/河池/东兰", "Donglan", 24.520000, 107.370000},
-    {"WKMKYP49CYV3", "广西壮族自治区/河池市/罗城仫佬族自治县", "广西/河池/罗城", "Luocheng", 24.780000, 108.900000},
-    {"WKKVR21JPZ6R", "广西壮族自治区/河池市/环江毛南族自治县", "广西/河池/环江", "Huanjiang", 24.830000, 108.250000},
-    {"WKK32S35FNK3", "广西壮族自治区/河池市/巴马瑶族自治县", "广西/河池/巴马", "Bama", 24.150000, 107.250000},
-    {"WKKB5UK42E64", "广西壮族自治区/河池市/都安瑶族自治县", "广西/河池/都安", "Duan", 23.930000, 108.100000},
-    {"WKHYCPUTK2EE", "广西壮族自治区/河池市/大化瑶族自治县", "广西/河池/大化", "Dahua", 23.730000, 107.980000},
-    {"WKJWVXFV72X7", "广西壮族自治区/来宾市", "广西/来宾/来宾", "Laibin", 23.730000, 109.230000},
-    {"WKJXJ8BJEYWS", "广西壮族自治区/来宾市/兴宾区", "广西/来宾/兴宾", "Xingbin", 23.735568, 109.226244},
-    {"WKM2BVG1FT1N", "广西壮族自治区/来宾市/忻城县", "广西/来宾/忻城", "Xincheng", 24.070000, 108.670000},
-    {"WKMBRGDE35ZE", "广西壮族自治区/来宾市/象州县", "广西/来宾/象州", "Xiangzhou", 23.970000, 109.680000},
-    {"WKJYR85RBNZ5", "广西壮族自治区/来宾市/武宣县", "广西/来宾/武宣", "Wuxuan", 23.600000, 109.670000},
-    {"WKQ370WXKN48", "广西壮族自治区/来宾市/金秀瑶族自治县", "广西/来宾/金秀", "Jinxiu", 24.130000, 110.180000},
-    {"WKJRT2K9WCGF", "广西壮族自治区/来宾市/合山市", "广西/来宾/合山", "Heshan", 23.820000, 108.870000},
-    {"W7UR7MB3QQDU", "广西壮族自治区/崇左市", "广西/崇左/崇左", "Chongzuo", 22.400000, 107.370000},
-    {"W7UR6Z32S5CC", "广西壮族自治区/崇左市/江州区", "广西/崇左/江州", "Jiangzhou", 22.408096, 107.349303},
-    {"WKH8XRDMK1Z2", "广西壮族自治区/崇左市/扶绥县", "广西/崇左/扶绥", "Fusui", 22.630000, 107.900000},
-    {"W7UJUKTUXG48", "广西壮族自治区/崇左市/宁明县", "广西/崇左/宁明", "Ningming", 22.130000, 107.070000},
-    {"W7GZPKTY1MYX", "广西壮族自治区/崇左市/龙州县", "广西/崇左/龙州", "Longzhou", 22.350000, 106.850000},
-    {"WKH1ZKHDMH3W", "广西壮族自治区/崇左市/大新县", "广西/崇左/大新", "Daxin", 22.830000, 107.200000},
-    {"WKH5MC9DTZVF", "广西壮族自治区/崇左市/天等县", "广西/崇左/天等", "Tiandeng", 23.080000, 107.130000},
-    {"W7GVV4UFR6C5", "广西壮族自治区/崇左市/凭祥市", "广西/崇左/凭祥", "Pingxiang", 22.120000, 106.750000},
-    {"W7W3YQKE4QDH", "海南省/海口市", "海南/海口/海口", "Haikou", 20.030000, 110.320000},
-    {"W7W3VDWPN4P9", "海南省/海口市/秀英区", "海南/海口/秀英", "Xiuying", 20.010063, 110.289269},
-    {"W7W3YQZT42Z8", "海南省/海口市/龙华区", "海南/海口/龙华", "Longhua", 20.033058, 110.324127},
-    {"W7W3Z1F46YX5", "海南省/海口市/琼山区", "海南/海口/琼山", "Qiongshan", 20.005152, 110.349554},
-    {"W7W3ZQE17J8N", "海南省/海口市/美兰区", "海南/海口/美兰", "Meilan", 20.031068, 110.361915},
-    {"W7JZGDR3YYTF", "海南省/三亚市", "海南/三亚/三亚", "Sanya", 18.250000, 109.500000},
-    {"W7Q09504MN9X", "海南省/三亚市/海棠区", "海南/三亚/海棠", "Haitang", 18.386043, 109.731662},
-    {"W7MBJ2MWU8XX", "海南省/三亚市/吉阳区", "海南/三亚/吉阳", "Jiyang", 18.283786, 109.574407},
-    {"W7MB4E3DV1CS", "海南省/三亚市/天涯区", "海南/三亚/天涯", "Tianya", 18.299585, 109.448078},
-    {"W7M8KNJT9XDF", "海南省/三亚市/崖州区", "海南/三亚/崖州", "Yazhou", 18.359139, 109.167778},
-    {"W6ZZU0E5REV5", "海南省/三沙市", "海南/三沙/三沙", "Sansha", 16.834380, 112.328667},
-    {"W6ZZU0QTK2SN", "海南省/三沙市/西沙群岛", "海南/三沙/西沙", "Xisha", 16.833333, 112.333333},
-    {"W982Y5WFG81G", "海南省/三沙市/南沙群岛", "海南/三沙/南沙", "Nansha", 8.589035, 113.124657},
-    {"WDC336NBG99F", "海南省/三沙市/中沙群岛的岛礁及其海域", "海南/三沙/中沙", "Wuzhishan", 15.699600, 114.322167},
-    {"W7MZJ3D2NP9X", "海南省/儋州市", "海南/儋州/儋州", "Danzhou", 19.520000, 109.570000},
-    {"W7MFU4Y12VWZ", "海南省/五指山市", "海南/五指山/五指山", "Wuzhishan", 18.780000, 109.520000},
-    {"W7QT9B3G3S46", "海南省/琼海市", "海南/琼海/琼海", "Qionghai", 19.250000, 110.470000},
-    {"W7QZ1QFP50HH", "海南省/文昌市", "海南/文昌/文昌", "Wenchang", 19.550000, 110.800000},
-    {"W7QDBNQVFQN8", "海南省/万宁市", "海南/万宁/万宁", "Wanning", 18.800000, 110.400000},
-    {"W7MHXVJCW6NC", "海南省/东方市", "海南/东方/东方", "Dongfang", 19.100000, 108.630000},
-    {"W7W2N6K8F64J", "海南省/定安县", "海南/定安/定安", "Dingan", 19.700000, 110.320000},
-    {"W7QQ1QHQ7VWQ", "海南省/屯昌县", "海南/屯昌/屯昌", "Tunchang", 19.370000, 110.100000},
-    {"W7W0PPEX9F8F", "海南省/澄迈县", "海南/澄迈/澄迈", "Chengmai", 19.730000, 110.000000},
-    {"W7TCRF6D3JPS", "海南省/临高县", "海南/临高/临高", "Lingao", 19.920000, 109.680000},
-    {"W7MV6SENCGG4", "海南省/白沙黎族自治县", "海南/白沙/白沙", "Baisha", 19.230000, 109.450000},
-    {"W7MT92RG3HJD", "海南省/昌江黎族自治县", "海南/昌江/昌江", "Changjiang", 19.250000, 109.050000},
-    {"W7MDSJR4TMK4", "海南省/乐东黎族自治县", "海南/乐东/乐东", "Ledong", 18.750000, 109.170000},
-    {"W7Q1PZC6KCFW", "海南省/陵水黎族自治县", "海南/陵水/陵水", "Lingshui", 18.500000, 110.030000},
-    {"W7Q1BR3PE78W", "海南省/保亭黎族苗族自治县", "海南/保亭/保亭", "Baoting", 18.630000, 109.700000},
-    {"W7QH70RCB3PE", "海南省/琼中黎族苗族自治县", "海南/琼中/琼中", "Qiongzhong", 19.030000, 109.830000},
-    {"WMMP6DW7X06M", "重庆市/万州区", "重庆/万州", "Wanzhou", 30.820000, 108.400000},
-    {"WMK35FQ793S3", "重庆市/涪陵区", "重庆/涪陵", "Fuling", 29.720000, 107.400000},
-    {"WM7B0UQQJ0GH", "重庆市/渝中区", "重庆/渝中", "Yuzhong", 29.555631, 106.565198},
-    {"WM5XWZZPRXZ1", "重庆市/大渡口区", "重庆/大渡口", "Dadukou", 29.487218, 106.478450},
-    {"WM7B3N6262QC", "重庆市/江北区", "重庆/江北", "Jiangbei", 29.609572, 106.570579},
-    {"WM78N6K8U9KE", "重庆市/沙坪坝区", "重庆/沙坪坝", "Shapingba", 29.543746, 106.452912},
-    {"WM5XZE5ZMCBN", "重庆市/九龙坡区", "重庆/九龙坡", "Jiulongpo", 29.505039, 106.506862},
-    {"WM5ZFDVK7WMM", "重庆市/南岸区", "重庆/南岸", "Nanan", 29.503175, 106.640668},
-    {"WM79T0YJEDWK", "重庆市/北碚区", "重庆/北碚", "Beibei", 29.800000, 106.400000},
-    {"WM5V4UU0J05Z", "重庆市/綦江区", "重庆/綦江", "Qijiang", 29.030000, 106.650000},
-    {"WM70VWWZN938", "重庆市/大足区", "重庆/大足", "Dazu", 29.700000, 105.720000},
-    {"WM7C46MEE1DC", "重庆市/渝北区", "重庆/渝北", "Yubei", 29.720000, 106.630000},
-    {"WM5XPUMQZUUY", "重庆市/巴南区", "重庆/巴南", "Banan", 29.380000, 106.520000},
-    {"WMJRGPGBSWYR", "重庆市/黔江区", "重庆/黔江", "Qianjiang", 29.530000, 108.770000},
-    {"WMK1UTTM2GE4", "重庆市/长寿区", "重庆/长寿", "Changshou", 29.870000, 107.080000},
-    {"WM5SCJ07NZ5W", "重庆市/江津区", "重庆/江津", "Jiangjin", 28.987980, 106.216458},
-    {"WM5W6QWEZ7RF", "重庆市/合川区", "重庆/合川", "Hechuan", 29.972084, 106.276130},
-    {"WM71JRZDM9CN", "重庆市/永川区", "重庆/永川", "Yongchuan", 29.750000, 105.710000},
-    {"WMHJVF9EJCVG", "重庆市/南川区", "重庆/南川", "Nanchuan", 29.150000, 107.130000},
-    {"WM783HE03RUT", "重庆市/璧山区", "重庆/璧山", "Bishan", 29.600000, 106.220000},
-    {"WM73V4P2B573", "重庆市/铜梁区", "重庆/铜梁", "Tongliang", 29.850000, 106.050000},
-    {"WM778NP51XZ8", "重庆市/潼南区", "重庆/潼南", "Tongnan", 30.180000, 105.830000},
-    {"WM5P68152M4P", "重庆市/荣昌区", "重庆/荣昌", "Rongchang", 29.400000, 105.580000},
-    {"WMT17HJH9J72", "重庆市/开州区", "重庆/开州", "Kaixian", 31.180000, 108.420000},
-    {"WMKWT11EFN9B", "重庆市/梁平区", "重庆/梁平", "Liangping", 30.680000, 107.800000},
-    {"WMHWGGM5SUR2", "重庆市/武隆区", "重庆/武隆", "Wulong", 29.330000, 107.750000},
-    {"WM7B0X53DZW2", "重庆市", "重庆/重庆", "Chongqing", 29.570000, 106.550000},
-    {"WMTMBB744X9J", "重庆市/城口县", "重庆/城口", "Chengkou", 31.950000, 108.670000},
-    {"WMK9GMWT6GW4", "重庆市/丰都县", "重庆/丰都", "Fengdu", 29.870000, 107.730000},
-    {"WMKKDC3VH3C9", "重庆市/垫江县", "重庆/垫江", "Dianjiang", 30.330000, 107.350000},
-    {"WMKU65CY23MU", "重庆市/忠县", "重庆/忠县", "Zhongxian", 30.300000, 108.020000},
-    {"WMT20F70FD1J", "重庆市/云阳县", "重庆/云阳", "Yunyang", 30.950000, 108.670000},
-    {"WMTB7P18EGH5", "重庆市/奉节县", "重庆/奉节", "Fengjie", 31.020000, 109.470000},
-    {"WMW0U3UNJEFM", "重庆市/巫山县", "重庆/巫山", "Wushan", 31.080000, 109.880000},
-    {"WMTFWSNNK0HZ", "重庆市/巫溪县", "重庆/巫溪", "Wuxi", 31.400000, 109.630000},
-    {"WMKFSM6DDT76", "重庆市/石柱土家族自治县", "重庆/石柱", "Shizhu", 30.000000, 108.120000},
-    {"WMJ3ZGHV603U", "重庆市/秀山土家族苗族自治县", "重庆/秀山", "Xiushan", 28.450000, 108.980000},
-    {"WMJK55GZKTY3", "重庆市/酉阳土家族苗族自治县", "重庆/酉阳", "Youyang", 28.850000, 108.770000},
-    {"WMHYTMYUZEVU", "重庆市/彭水苗族土家族自治县", "重庆/彭水", "Pengshui", 29.300000, 108.170000},
-    {"WM6N2PM3WY2K", "四川省/成都市", "四川/成都/成都", "Chengdu", 30.670000, 104.070000},
-    {"WM6N2M7XGZEW", "四川省/成都市/锦江区", "四川/成都/锦江", "Jinjiang", 30.660094, 104.078459},
-    {"WM3YXBW1MWTV", "四川省/成都市/青羊区", "四川/成都/青羊", "Qingyang", 30.676825, 104.059997},
-    {"WM3YXEWSR0CV", "四川省/成都市/金牛区", "四川/成都/金牛", "Jinniu", 30.693789, 104.049757},
-    {"WM3YRD8KCECP", "四川省/成都市/武侯区", "四川/成都/武侯", "Wuhou", 30.644452, 104.040937},
-    {"WM6N2VFQ5GF5", "四川省/成都市/成华区", "四川/成都/成华", "Chenghua", 30.662519, 104.098713},
-    {"WM6JUTP55J51", "四川省/成都市/龙泉驿区", "四川/成都/龙泉驿", "Longquanyi", 30.570000, 104.270000},
-    {"WM6PEV9CP11P", "四川省/成都市/青白江区", "四川/成都/青白江区", "Qibaijiang", 30.880000, 104.230000},
-    {"WM6P3URTYBS9", "四川省/成都市/新都区", "四川/成都/新都", "Xindu", 30.830000, 104.150000},
-    {"WM3YDSY8QQG3", "四川省/成都市/温江区", "四川/成都/温江", "Wenjiang", 30.700000, 103.830000},
-    {"WM3VUYBJRT0M", "四川省/成都市/双流区", "四川/成都/双流", "Shuangliu", 30.580000, 103.920000},
-    {"WM3Z7FE5E2QJ", "四川省/成都市/郫都区", "四川/成都/郫都", "Pixian", 30.820000, 103.880000},
-    {"WM6R825D72GF", "四川省/成都市/金堂县", "四川/成都/金堂", "Jintang", 30.850000, 104.430000},
-    {"WM3TGWUVQV4T", "四川省/成都市/大邑县", "四川/成都/大邑", "Dayi", 30.580000, 103.520000},
-    {"WM3EG1WRUB19", "四川省/成都市/蒲江县", "四川/成都/蒲江", "Pujiang", 30.200000, 103.500000},
-    {"WM3V43Z3M74B", "四川省/成都市/新津县", "四川/成都/新津", "Xinjin", 30.420000, 103.820000},
-    {"WM98MGMU14B5", "四川省/成都市/都江堰市", "四川/成都/都江堰", "Dujiangyan", 31.000000, 103.620000},
-    {"WM9BHZXX8D8F", "四川省/成都市/彭州市", "四川/成都/彭州", "Pengzhou", 30.980000, 103.930000},
-    {"WM3T49B93EPB", "四川省/成都市/邛崃市", "四川/成都/邛崃", "Qionglai", 30.420000, 103.470000},
-    {"WM3WR040WJFG", "四川省/成都市/崇州市", "四川/成都/崇州", "Chongzhou", 30.630000, 103.670000},
-    {"WM6KGN4UZDDR", "四川省/成都市/简阳市", "四川/成都/简阳", "Jianyang", 30.400000, 104.550000},
-    {"WM4WBR42NUWC", "四川省/自贡市", "四川/自贡/自贡", "Zigong", 29.350000, 104.780000},
-    {"WM4WBJNRWDMF", "四川省/自贡市/自流井区", "四川/自贡/自流井", "Ziliujing", 29.340289, 104.774495},
-    {"WM4QYY9QFH03", "四川省/自贡市/贡井区", "四川/自贡/贡井", "Gongjing", 29.348409, 104.712496},
-    {"WM4X04H05E9E", "四川省/自贡市/大安区", "四川/自贡/大安", "Daan", 29.366474, 104.771271},
-    {"WM4WD3MNCY4X", "四川省/自贡市/沿滩区", "四川/自贡/沿滩", "Yantan", 29.275637, 104.871447},
-    {"WM4R8HU74Q5M", "四川省/自贡市/荣县", "四川/自贡/荣县", "Rongxian", 29.470000, 104.420000},
-    {"WM4WHBH1G638", "四川省/自贡市/富顺县", "四川/自贡/富顺", "Fushun", 29.180000, 104.980000},
-    {"WK8R4WWPXZ1K", "四川省/攀枝花市", "四川/攀枝花/攀枝花", "Panzhihua", 26.580000, 101.720000},
-    {"WK8R43389RMT", "四川省/攀枝花市/东区", "四川/攀枝花/东区", "Dongqu", 26.549961, 101.702561},
-    {"WK8R2DS5SJ8J", "四川省/攀枝花市/西区", "四川/攀枝花/西区", "Xiqu", 26.601278, 101.629200},
-    {"WK8QFBJT8Y1C", "四川省/攀枝花市/仁和区", "四川/攀枝花/仁和", "Renhe", 26.500000, 101.730000},
-    {"WKB8GV3E27PJ", "四川省/攀枝花市/米易县", "四川/攀枝花/米易", "Miyi", 26.880000, 102.120000},
-    {"WK8RVSSFV08R", "四川省/攀枝花市/盐边县", "四川/攀枝花/盐边", "Yanbian", 26.700000, 101.850000},
-    {"WM4UPPEGCN1F", "四川省/泸州市", "四川/泸州/泸州", "Luzhou", 28.870000, 105.430000},
-    {"WM4UR1UBCUVP", "四川省/泸州市/江阳区", "四川/泸州/江阳", "Jiangyang", 28.881839, 105.431410},
-    {"WM4GTV2J6UWW", "四川省/泸州市/纳溪区", "四川/泸州/纳溪", "Naxi", 28.770000, 105.370000},
-    {"WM4UX0NC4NH8", "四川省/泸州市/龙马潭区", "四川/泸州/龙马潭", "Longmatan", 28.916219, 105.434166},
-    {"WM4VVFX75CZ5", "四川省/泸州市/泸县", "四川/泸州/泸县", "Luxian", 29.150000, 105.380000},
-    {"WM57BNX09TRS", "四川省/泸州市/合江县", "四川/泸州/合江", "Hejiang", 28.820000, 105.830000},
-    {"WM4BR05Y1H9G", "四川省/泸州市/叙永县", "四川/泸州/叙永", "Xuyong", 28.170000, 105.430000},
-    {"WKGPXFRG0DYZ", "四川省/泸州市/古蔺县", "四川/泸州/古蔺", "Gulin", 28.050000, 105.820000},
-    {"WMD1P5P1QK95", "四川省/德阳市", "四川/德阳/德阳", "Deyang", 31.130000, 104.380000},
-    {"WMD30J8NSKYC", "四川省/德阳市/旌阳区", "四川/德阳/旌阳", "Jingyang", 31.144635, 104.414254},
-    {"WMD61VWS4RPT", "四川省/德阳市/罗江区", "四川/德阳/罗江", "Luojiang", 31.320000, 104.500000},
-    {"WMD2W0CDUG1R", "四川省/德阳市/中江县", "四川/德阳/中江", "Zhongjiang", 31.030000, 104.680000},
-    {"WMD0HZWRS4EF", "四川省/德阳市/广汉市", "四川/德阳/广汉", "Guanghan", 30.980000, 104.280000},
-    {"WMD147N32UTG", "四川省/德阳市/什邡市", "四川/德阳/什邡", "Shifang", 31.130000, 104.170000},
-    {"WMD475H4GZX6", "四川省/德阳市/绵竹市", "四川/德阳/绵竹", "Mianzhu", 31.350000, 104.200000},
-    {"WMD7P0YN1CHN", "四川省/绵阳市", "四川/绵阳/绵阳", "Mianyang", 31.470000, 104.730000},
-    {"WMD6ZWXSH9T8", "四川省/绵阳市/涪城区", "四川/绵阳/涪城", "Fucheng", 31.457299, 104.754153},
-    {"WMD7PFN8BEQQ", "四川省/绵阳市/游仙区", "四川/绵阳/游仙", "Youxian", 31.475977, 104.763595},
-    {"WMD77ECE9D52", "四川省/绵阳市/安州区", "四川/绵阳/安州", "Anxian", 31.530000, 104.570000},
-    {"WMD8ZJSFTKNY", "四川省/绵阳市/三台县", "四川/绵阳/三台", "Santai", 31.100000, 105.080000},
-    {"WMDCTGRMEVZ4", "四川省/绵阳市/盐亭县", "四川/绵阳/盐亭", "Yanting", 31.220000, 105.380000},
-    {"WMDGCNN6NE7G", "四川省/绵阳市/梓潼县", "四川/绵阳/梓潼", "Zitong", 31.630000, 105.170000},
-    {"WMDM0BDHVMUV", "四川省/绵阳市/北川羌族自治县", "四川/绵阳/北川", "Beichuan", 31.820000, 104.450000},
-    {"WMF26TUKJW12", "四川省/绵阳市/平武县", "四川/绵阳/平武", "Pingwu", 32.420000, 104.530000},
-    {"WMDKZ9KEGVMH", "四川省/绵阳市/江油市", "四川/绵阳/江油", "Jiangyou", 31.780000, 104.750000},
-    {"WMG22PXN3WPT", "四川省/广元市", "四川/广元/广元", "Guangyuan", 32.430000, 105.830000},
-    {"WMG282Z7NHF2", "四川省/广元市/利州区", "四川/广元/利州", "Lizhou", 32.436301, 105.841516},
-    {"WMERGHTGZ80X", "四川省/广元市/昭化区", "四川/广元/昭化", "Zhaohua", 32.325169, 105.960368},
-    {"WMG39X06UZU5", "四川省/广元市/朝天区", "四川/广元/朝天", "Chaotian", 32.646388, 105.886783},
-    {"WMEX67Q9R7RY", "四川省/广元市/旺苍县", "四川/广元/旺苍", "Wangcang", 32.230000, 106.280000},
-    {"WMFC6E40K8PN", "四川省/广元市/青川县", "四川/广元/青川", "Qingchuan", 32.580000, 105.230000},
-    {"WMEP9HMKDHNU", "四川省/广元市/剑阁县", "四川/广元/剑阁", "Jiange", 32.280000, 105.520000},
-    {"WMEKD2RBEUSY", "四川省/广元市/苍溪县", "四川/广元/苍溪", "Cangxi", 31.730000, 105.930000},
-    {"WM7JD7CXZK37", "四川省/遂宁市", "四川/遂宁/遂宁", "Suining", 30.520000, 105.570000},
-    {"WM7JDJQPBNBD", "四川省/遂宁市/船山区", "四川/遂宁/船山", "Chuanshan", 30.528253, 105.564881},
-    {"WM6UXWKR9SYU", "四川省/遂宁市/安居区", "四川/遂宁/安居", "Anju", 30.357912, 105.452687},
-    {"WM7PJEQFQXCE", "四川省/遂宁市/蓬溪县", "四川/遂宁/蓬溪", "Pengxi", 30.780000, 105.720000},
-    {"WM6ZTGXQGCP4", "四川省/遂宁市/射洪县", "四川/遂宁/射洪", "Shehong", 30.870000, 105.380000},
-    {"WM6Y4DHB00XN", "四川省/遂宁市/大英县", "四川/遂宁/大英", "Daying", 30.596928, 105.233583},
-    {"WM68Q2Z5FRTM", "四川省/内江市", "四川/内江/内江", "Neijiang", 29.580000, 105.050000},
-    {"WM68QF9EBXED", "四川省/内江市/市中区", "四川/内江/市中", "Shizhong", 29.589613, 105.064342},
-    {"WM68QUT8KRYM", "四川省/内江市/东兴区", "四川/内江/东兴", "Dongxing", 29.600000, 105.070000},
-    {"WM4RVZF2EYBZ", "四川省/内江市/威远县", "四川/内江/威远", "Weiyuan", 29.530000, 104.670000},
-    {"WM693VM3N46E", "四川省/内江市/资中县", "四川/内江/资中", "Zizhong", 29.780000, 104.850000},
-    {"WM6BE5B9WB2P", "四川省/内江市/隆昌市", "四川/内江/隆昌", "Longchang", 29.640000, 105.250000},
-    {"WM3B1R518R80", "四川省/乐山市", "四川/乐山/乐山", "Leshan", 29.570000, 103.770000},
-    {"WM3B1HGHDDRJ", "四川省/乐山市/市中区", "四川/乐山/市中", "Shizhong", 29.558128, 103.759120},
-    {"WM1XK712G7EV", "四川省/乐山市/沙湾区", "四川/乐山/沙湾", "Shawan", 29.416042, 103.548004},
-    {"WM1Z63UKTHX2", "四川省/乐山市/五通桥区", "四川/乐山/五通桥", "Wutongqiao", 29.409824, 103.815876},
-    {"WM1Q3S60DMF0", "四川省/乐山市/金口河区", "四川/乐山/金口河", "Jinkouhe", 29.247096, 103.076576},
-    {"WM1YJRQ4FDCC", "四川省/乐山市/犍为县", "四川/乐山/犍为", "Qianwei", 29.220000, 103.950000},
-    {"WM608JT7YB87", "四川省/乐山市/井研县", "四川/乐山/井研", "Jingyan", 29.650000, 104.070000},
-    {"WM39HU1MGCTM", "四川省/乐山市/夹江县", "四川/乐山/夹江", "Jiajiang", 29.730000, 103.570000},
-    {"WM1UU3CDMRRJ", "四川省/乐山市/沐川县", "四川/乐山/沐川", "Muchuan", 28.970000, 103.900000},
-    {"WM1QMCNVJ6VJ", "四川省/乐山市/峨边彝族自治县", "四川/乐山/峨边", "Ebian", 29.230000, 103.270000},
-    {"WM1SH26FCVS2", "四川省/乐山市/马边彝族自治县", "四川/乐山/马边", "Mabian", 28.830000, 103.550000},
-    {"WM386SXB6ZBT", "四川省/乐山市/峨眉山市", "四川/乐山/峨眉山", "Emeishan", 29.600000, 103.480000},
-    {"WM7RJGM47PV5", "四川省/南充市", "四川/南充/南充", "Nanchong", 30.780000, 106.080000},
-    {"WM7RNNEPYQR8", "四川省/南充市/顺庆区", "四川/南充/顺庆", "Shunqing", 30.798788, 106.088383},
-    {"WM7RNSN3MYXC", "四川省/南充市/高坪区", "四川/南充/高坪", "Gaoping", 30.783941, 106.114797},
-    {"WM7QVXUHQCGG", "四川省/南充市/嘉陵区", "四川/南充/嘉陵", "Jialing", 30.761085, 106.067800},
-    {"WME6MEJFFPS6", "四川省/南充市/南部县", "四川/南充/南部", "Nanbu", 31.350000, 106.070000},
-    {"WMEBC1CYHGZT", "四川省/南充市/营山县", "四川/南充/营山", "Yingshan", 31.080000, 106.570000},
-    {"WME8T8UDVEPR", "四川省/南充市/蓬安县", "四川/南充/蓬安", "Pengan", 31.030000, 106.420000},
-    {"WME9FKW8ZQRZ", "四川省/南充市/仪陇县", "四川/南充/仪陇", "Yilong", 31.270000, 106.280000},
-    {"WME2377KNFF5", "四川省/南充市/西充县", "四川/南充/西充", "Xichong", 31.000000, 105.880000},
-    {"WME7KPDB5428", "四川省/南充市/阆中市", "四川/南充/阆中", "Langzhong", 31.550000, 106.000000},
-    {"WM3FFWQTYQ52", "四川省/眉山市", "四川/眉山/眉山", "Meishan", 30.050000, 103.830000},
-    {"WM3FFTW3T7RB", "四川省/眉山市/东坡区", "四川/眉山/东坡", "Dongpo", 30.045136, 103.829620},
-    {"WM3GG9EZF2J9", "四川省/眉山市/彭山区", "四川/眉山/彭山", "Pengshan", 30.200000, 103.870000},
-    {"WM649VRDWVKD", "四川省/眉山市/仁寿县", "四川/眉山/仁寿", "Renshou", 30.000000, 104.150000},
-    {"WM3D0NZ8XS68", "四川省/眉山市/洪雅县", "四川/眉山/洪雅", "Hongya", 29.920000, 103.370000},
-    {"WM3DG8UZNVDE", "四川省/眉山市/丹棱县", "四川/眉山/丹棱", "Danleng", 30.020000, 103.520000},
-    {"WM3CENMK27H9", "四川省/眉山市/青神县", "四川/眉山/青神", "Qingshen", 29.830000, 103.850000},
-    {"WM47STMVQSWN", "四川省/宜宾市", "四川/宜宾/宜宾", "Yibin", 28.770000, 104.620000},
-    {"WM47STK22SHH", "四川省/宜宾市/翠屏区", "四川/宜宾/翠屏", "Cuiping", 28.769139, 104.617680},
-    {"WM4SHGUP7MC9", "四川省/宜宾市/南溪区", "四川/宜宾/南溪", "Nanxi", 28.850000, 104.980000},
-    {"WM4770DVXEF2", "四川省/宜宾市/叙州区", "四川/宜宾/叙州", "Yibinxian", 28.700000, 104.550000},
-    {"WM4EQYJSKKNM", "四川省/宜宾市/江安县", "四川/宜宾/江安", "Jiangan", 28.730000, 105.070000},
-    {"WM4DEDB6T4NK", "四川省/宜宾市/长宁县", "四川/宜宾/长宁", "Changning", 28.580000, 104.920000},
-    {"WM43DRT0U80E", "四川省/宜宾市/高县", "四川/宜宾/高县", "Gaoxian", 28.430000, 104.520000},
-    {"WM43YGNV2B7S", "四川省/宜宾市/珙县", "四川/宜宾/珙县", "Gongxian", 28.450000, 104.720000},
-    {"WM4262JNHS8E", "四川省/宜宾市/筠连县", "四川/宜宾/筠连", "Junlian", 28.170000, 104.520000},
-    {"WM4BFXF5KWR5", "四川省/宜宾市/兴文县", "四川/宜宾/兴文", "Xingwen", 28.300000, 105.230000},
-    {"WM4HN06FCJW2", "四川省/宜宾市/屏山县", "四川/宜宾/屏山", "Pingshan", 28.830000, 104.330000},
-    {"WM7V66VSE5DV", "四川省/广安市", "四川/广安", "Guangan", 30.470000, 106.630000},
-    {"WM7V66VSE5DV", "四川省/广安市/广安区", "四川/广安/广安", "Guangan", 30.470000, 106.630000},
-    {"WMKJ824QJCE1", "四川省/广安市/前锋区", "四川/广安/前锋", "Qianfeng", 30.499085, 106.889327},
-    {"WM7TVC7YWSZB", "四川省/广安市/岳池县", "四川/广安/岳池", "Yuechi", 30.550000, 106.430000},
-    {"WM7SDMN9X6PC", "四川省/广安市/武胜县", "四川/广安/武胜", "Wusheng", 30.350000, 106.280000},
-    {"WMKH932J19FC", "四川省/广安市/邻水县", "四川/广安/邻水", "Linshui", 30.330000, 106.930000},
-    {"WM7UVDE8366Q", "四川省/广安市/华蓥市", "四川/广安/华蓥", "Huaying", 30.380000, 106.770000},
-    {"WMS3W5RJETCF", "四川省/达州市", "四川/达州/达州", "Dazhou", 31.220000, 107.500000},
-    {"WMS3TG2T9TBD", "四川省/达州市/通川区", "四川/达州/通川", "Tongchuan", 31.220000, 107.480000},
-    {"WMS3QPZ15T9C", "四川省/达州市/达川区", "四川/达州/达川", "Daxian", 31.200000, 107.500000},
-    {"WMSD75P6CZTD", "四川省/达州市/宣汉县", "四川/达州/宣汉", "Xuanhan", 31.350000, 107.720000},
-    {"WMS8Y9UW15VV", "四川省/达州市/开江县", "四川/达州/开江", "Kaijiang", 31.080000, 107.870000},
-    {"WMKNZ6HXJP1W", "四川省/达州市/大竹县", "四川/达州/大竹", "Dazhu", 30.730000, 107.200000},
-    {"WMKP6HMJV8T1", "四川省/达州市/渠县", "四川/达州/渠县", "Quxian", 30.830000, 106.970000},
-    {"WMSY6Q1J33Q3", "四川省/达州市/万源市", "四川/达州/万源", "Wanyuan", 32.070000, 108.030000},
-    {"WM34XCDQ1VND", "四川省/雅安市", "四川/雅安/雅安", "Yaan", 29.980000, 103.000000},
-    {"WM368WBCX6RB", "四川省/雅安市/雨城区", "四川/雅安/雨城", "Yucheng", 30.008052, 103.031137},
-    {"WM374ECSWNMJ", "四川省/雅安市/名山区", "四川/雅安/名山", "Mingshan", 30.080000, 103.120000},
-    {"WM31S2VJDDWK", "四川省/雅安市/荥经县", "四川/雅安/荥经", "Yingjing", 29.800000, 102.850000},
-    {"WM0YZZ52NKE9", "四川省/雅安市/汉源县", "四川/雅安/汉源", "Hanyuan", 29.350000, 102.650000},
-    {"WM0Y33PT1FUT", "四川省/雅安市/石棉县", "四川/雅安/石棉", "Shimian", 29.230000, 102.370000},
-    {"WM3544H62W30", "四川省/雅安市/天全县", "四川/雅安/天全", "Tianquan", 30.070000, 102.750000},
-    {"WM35W08H3Z67", "四川省/雅安市/芦山县", "四川/雅安/芦山", "Lushan", 30.150000, 102.920000},
-    {"WM3HG8XNPDKF", "四川省/雅安市/宝兴县", "四川/雅安/宝兴", "Baoxing", 30.370000, 102.820000},
-    {"WMEVJW5E9Q66", "四川省/巴中市", "四川/巴中/巴中", "Bazhong", 31.850000, 106.770000},
-    {"WMEVJQZ9N3N2", "四川省/巴中市/巴州区", "四川/巴中/巴州", "Bazhou", 31.853662, 106.764727},
-    {"WMETP06HJ8Y4", "四川省/巴中市/恩阳区", "四川/巴中/恩阳", "Enyang", 31.818471, 106.482483},
-    {"WMSM84FE2P70", "四川省/巴中市/通江县", "四川/巴中/通江", "Tongjiang", 31.920000, 107.230000},
-    {"WMGBNCPHRMJD", "四川省/巴中市/南江县", "四川/巴中/南江", "Nanjiang", 32.350000, 106.830000},
-    {"WMS5T55UDFS1", "四川省/巴中市/平昌县", "四川/巴中/平昌", "Pingchang", 31.570000, 107.100000},
-    {"WM67M75V9WZY", "四川省/资阳市", "四川/资阳/资阳", "Ziyang", 30.120000, 104.650000},
-    {"WM67MCT9JU3E", "四川省/资阳市/雁江区", "四川/资阳/雁江", "Yanjiang", 30.110974, 104.674550},
-    {"WM6GHZDCNYST", "四川省/资阳市/安岳县", "四川/资阳/安岳", "Anyue", 30.100000, 105.330000},
-    {"WM6SMB31Z35E", "四川省/资阳市/乐至县", "四川/资阳/乐至", "Lezhi", 30.280000, 105.020000},
-    {"WMB74JR8MU82", "四川省/阿坝藏族羌族自治州", "四川/阿坝", "Aba", 32.900000, 101.700000},
-    {"WM8TQP4QFXH2", "四川省/阿坝藏族羌族自治州/马尔康市", "四川/阿坝/马尔康", "Maerkang", 31.900000, 102.220000},
-    {"WM9EJ4B8KCMF", "四川省/阿坝藏族羌族自治州/汶川县", "四川/阿坝/汶川", "Wenchuan", 31.480000, 103.580000},
-    {"WM96G9WJ50XU", "四川省/阿坝藏族羌族自治州/理县", "四川/阿坝/理县", "Lixian", 31.430000, 103.170000},
-    {"WM9U5PJM2KH9", "四川省/阿坝藏族羌族自治州/茂县", "四川/阿坝/茂县", "Maoxian", 31.680000, 103.850000},
-    {"WMC9TKP5WBZ5", "四川省/阿坝藏族羌族自治州/松潘县", "四川/阿坝/松潘", "Songfan", 32.630000, 103.600000},
-    {"WMFJ7B9GZ190", "四川省/阿坝藏族羌族自治州/九寨沟县", "四川/阿坝/九寨沟", "Jiuzhaigou", 33.270000, 104.230000},
-    {"WM8E4DV073K6", "四川省/阿坝藏族羌族自治州/金川县", "四川/阿坝/金川", "Jinchuan", 31.480000, 102.070000},
-    {"WM8B37RS1FUE", "四川省/阿坝藏族羌族自治州/小金县", "四川/阿坝/小金", "Xiaojin", 31.000000, 102.370000},
-    {"WM9NRQ5TRCM3", "四川省/阿坝藏族羌族自治州/黑水县", "四川/阿坝/黑水", "Heishui", 32.070000, 102.980000},
-    {"WJXZ9FE6KS12", "四川省/阿坝藏族羌族自治州/壤塘县", "四川/阿坝/壤塘", "Rangtang", 32.270000, 100.980000},
-    {"WMB74JR8MU82", "四川省/阿坝藏族羌族自治州/阿坝县", "四川/阿坝/阿坝", "Aba", 32.900000, 101.700000},
-    {"WMCPN9JCSVEY", "四川省/阿坝藏族羌族自治州/若尔盖县", "四川/阿坝/若尔盖", "Nuoergai", 33.580000, 102.950000},
-    {"WMBFTE49U5NM", "四川省/阿坝藏族羌族自治州/红原县", "四川/阿坝/红原", "Hongyuan", 32.800000, 102.550000},
-    {"WJX5GH5PYG5R", "四川省/甘孜藏族自治州", "四川/甘孜", "Ganzi", 31.620000, 99.980000},
-    {"WM2DBQKMCNNB", "四川省/甘孜藏族自治州/康定市", "四川/甘孜/康定", "Kangding", 30.050000, 101.970000},
-    {"WM2DNQC8ESKB", "四川省/甘孜藏族自治州/泸定县", "四川/甘孜/泸定", "Luding", 29.920000, 102.230000},
-    {"WM2RWMDC014P", "四川省/甘孜藏族自治州/丹巴县", "四川/甘孜/丹巴", "Danba", 30.880000, 101.880000},
-    {"WM0HVXQ11RVD", "四川省/甘孜藏族自治州/九龙县", "四川/甘孜/九龙", "Jiulong", 29.000000, 101.500000},
-    {"WJRFFFB92TEX", "四川省/甘孜藏族自治州/雅江县", "四川/甘孜/雅江", "Yajiang", 30.030000, 101.020000},
-    {"WJXBJP9RDF8F", "四川省/甘孜藏族自治州/道孚县", "四川/甘孜/道孚", "Daofu", 30.980000, 101.120000},
-    {"WJXDEH0YQ01P", "四川省/甘孜藏族自治州/炉霍县", "四川/甘孜/炉霍", "Luhuo", 31.400000, 100.680000},
-    {"WJX5GH5PYG5R", "四川省/甘孜藏族自治州/甘孜县", "四川/甘孜/甘孜", "Ganzi", 31.620000, 99.980000},
-    {"WJX24F6BC6JT", "四川省/甘孜藏族自治州/新龙县", "四川/甘孜/新龙", "Xinlong", 30.950000, 100.320000},
-    {"WJWJ50XUBMZT", "四川省/甘孜藏族自治州/德格县", "四川/甘孜/德格", "Dege", 31.820000, 98.580000},
-    {"WJW38GMV9VV4", "四川省/甘孜藏族自治州/白玉县", "四川/甘孜/白玉", "Baiyu", 31.220000, 98.830000},
-    {"WJVG87F4RTTG", "四川省/甘孜藏族自治州/石渠县", "四川/甘孜/石渠", "Shiqu", 32.980000, 98.100000},
-    {"WJXRE4D46KN2", "四川省/甘孜藏族自治州/色达县", "四川/甘孜/色达", "Seda", 32.270000, 100.330000},
-    {"WJR69TQ6SM74", "四川省/甘孜藏族自治州/理塘县", "四川/甘孜/理塘", "Litang", 30.000000, 100.270000},
-    {"WJQ6XJ66TM7F", "四川省/甘孜藏族自治州/巴塘县", "四川/甘孜/巴塘", "Batang", 30.000000, 99.100000},
-    {"WJNUX481KWCS", "四川省/甘孜藏族自治州/乡城县", "四川/甘孜/乡城", "Xiangcheng", 28.930000, 99.800000},
-    {"WJPM4KU0P2HX", "四川省/甘孜藏族自治州/稻城县", "四川/甘孜/稻城", "Daocheng", 29.030000, 100.300000},
-    {"WJNE7HM6PSJ9", "四川省/甘孜藏族自治州/得荣县", "四川/甘孜/得荣", "Derong", 28.720000, 99.280000},
-    {"WKBWQZEYXGPF", "四川省/凉山彝族自治州", "四川/凉山/凉山", "Liangshan", 27.859714, 102.255249},
-    {"WKBWXPN9R8ZN", "四川省/凉山彝族自治州/西昌市", "四川/凉山/西昌", "Xichang", 27.900000, 102.270000},
-    {"WKBNBSTB513E", "四川省/凉山彝族自治州/木里藏族自治县", "四川/凉山/木里", "Muli", 27.930000, 101.280000},
-    {"WKBHJ9QP36TE", "四川省/凉山彝族自治州/盐源县", "四川/凉山/盐源", "Yanyuan", 27.430000, 101.500000},
-    {"WKBEVHJ0WD4Q", "四川省/凉山彝族自治州/德昌县", "四川/凉山/德昌", "Dechang", 27.400000, 102.180000},
-    {"WK8XWZ0HJ8Q4", "四川省/凉山彝族自治州/会理县", "四川/凉山/会理", "Huili", 26.670000, 102.250000},
-    {"WK8ZQRB6ZPZC", "四川省/凉山彝族自治州/会东县", "四川/凉山/会东", "Huidong", 26.630000, 102.580000},
-    {"WKC1FXFY4TDP", "四川省/凉山彝族自治州/宁南县", "四川/凉山/宁南", "Ningnan", 27.070000, 102.770000},
-    {"WKBGV0KH41VJ", "四川省/凉山彝族自治州/普格县", "四川/凉山/普格", "Puge", 27.380000, 102.530000},
-    {"WKCJEWR0XWSB", "四川省/凉山彝族自治州/布拖县", "四川/凉山/布拖", "Butuo", 27.720000, 102.820000},
-    {"WKCMTD8K5QK0", "四川省/凉山彝族自治州/金阳县", "四川/凉山/金阳", "Jinyang", 27.700000, 103.250000},
-    {"WKCPKKVH6DW6", "四川省/凉山彝族自治州/昭觉县", "四川/凉山/昭觉", "Zhaojue", 28.020000, 102.850000},
-    {"WM0C4E7ZYYXH", "四川省/凉山彝族自治州/喜德县", "四川/凉山/喜德", "Xide", 28.320000, 102.420000},
-    {"WM0DKVMGV99X", "四川省/凉山彝族自治州/冕宁县", "四川/凉山/冕宁", "Mianning", 28.550000, 102.170000},
-    {"WM0FUZSF35HD", "四川省/凉山彝族自治州/越西县", "四川/凉山/越西", "Yuexi", 28.650000, 102.520000},
-    {"WM1HF9FF6X6J", "四川省/凉山彝族自治州/甘洛县", "四川/凉山/甘洛", "Ganluo", 28.970000, 102.770000},
-    {"WM134V2FPNV8", "四川省/凉山彝族自治州/美姑县", "四川/凉山/美姑", "Meigu", 28.330000, 103.130000},
-    {"WM18UF3KEVVQ", "四川省/凉山彝族自治州/雷波县", "四川/凉山/雷波", "Leibo", 28.270000, 103.570000},
-    {"WKEZD7MXE04F", "贵州省/贵阳市", "贵州/贵阳/贵阳", "Guiyang", 26.650000, 106.630000},
-    {"WKEZHKZJKNZX", "贵州省/贵阳市/南明区", "贵州/贵阳/南明", "Nanming", 26.570000, 106.720000},
-    {"WKEZKQP0SPXT", "贵州省/贵阳市/云岩区", "贵州/贵阳/云岩", "Yunyan", 26.620000, 106.720000},
-    {"WKEY53GB7KZZ", "贵州省/贵阳市/花溪区", "贵州/贵阳/花溪", "Huaxi", 26.376870, 106.671560},
-    {"WKEZMPUFZRC1", "贵州省/贵阳市/乌当区", "贵州/贵阳/乌当", "Wudang", 26.630000, 106.750000},
-    {"WKEZFBUNM07Z", "贵州省/贵阳市/白云区", "贵州/贵阳/白云", "Baiyun", 26.680000, 106.650000},
-    {"WKEZ65M9FNBQ", "贵州省/贵阳市/观山湖区", "贵州/贵阳/观山湖", "Guanshanhu", 26.605105, 106.618968},
-    {"WKU1FPVNJTTP", "贵州省/贵阳市/开阳县", "贵州/贵阳/开阳", "Kaiyang", 27.070000, 106.970000},
-    {"WKGFHTQKVQ0H", "贵州省/贵阳市/息烽县", "贵州/贵阳/息烽", "Xifeng", 27.100000, 106.730000},
-    {"WKGB9K30N480", "贵州省/贵阳市/修文县", "贵州/贵阳/修文", "Xiuwen", 26.830000, 106.580000},
-    {"WKEXNC30FYDP", "贵州省/贵阳市/清镇市", "贵州/贵阳/清镇", "Qingzhen", 26.550000, 106.470000},
-    {"WKDX33TQ96BZ", "贵州省/六盘水市", "贵州/贵州/六盘水", "Liupanshui", 26.596286, 104.827821},
-    {"WKDX1WQZTN43", "贵州省/六盘水市/钟山区", "贵州/六盘水/钟山", "Zhongshan", 26.578621, 104.841031},
-    {"WKEJ052UM4HH", "贵州省/六盘水市/六枝特区", "贵州/六盘水/六枝", "Liuzhi", 26.210000, 105.470000},
-    {"WKDXH1Q2BNXZ", "贵州省/六盘水市/水城县", "贵州/六盘水/水城", "Shuicheng", 26.550000, 104.950000},
-    {"WKD6360TZ7W0", "贵州省/六盘水市/盘州市", "贵州省/六盘水/盘州", "Panxian", 25.720000, 104.470000},
-    {"WKUJ8GKSN3ZC", "贵州省/遵义市", "贵州/遵义/遵义", "Zunyi", 27.704096, 106.914418},
-    {"WKUJ318BBTD6", "贵州省/遵义市/红花岗区", "贵州/遵义/红花岗", "Honghuagang", 27.650000, 106.920000},
-    {"WKUJC00FBWDM", "贵州省/遵义市/汇川区", "贵州/遵义/汇川", "Huichuan", 27.730000, 106.920000},
-    {"WKGUWV7Y7JQW", "贵州省/遵义市/播州区", "贵州/遵义/播州", "Bozhou", 27.539707, 106.825356},
-    {"WM5BN8ZVNKJ4", "贵州省/遵义市/桐梓县", "贵州/遵义/桐梓", "Tongzi", 28.130000, 106.820000},
-    {"WKUPNBNHE18K", "贵州省/遵义市/绥阳县", "贵州/遵义/绥阳", "Suiyang", 27.950000, 107.180000},
-    {"WMH6KTK5U3TZ", "贵州省/遵义市/正安县", "贵州/遵义/正安", "Zhengan", 28.550000, 107.430000},
-    {"WMHS23RYJWPN", "贵州省/遵义市/道真仡佬族苗族自治县", "贵州/遵义/道真", "Daozhen", 28.880000, 107.600000},
-    {"WMHDQCEZ61QR", "贵州省/遵义市/务川仡佬族苗族自治县", "贵州/遵义/务川", "Wuchuan", 28.530000, 107.880000},
-    {"WKUX55Z31CVS", "贵州省/遵义市/凤冈县", "贵州/遵义/凤冈", "Fenggang", 27.970000, 107.720000},
-    {"WKUMVZ2ECX0W", "贵州省/遵义市/湄潭县", "贵州/遵义/湄潭", "Meitan", 27.770000, 107.480000},
-    {"WKUDYG5ZFPY2", "贵州省/遵义市/余庆县", "贵州/遵义/余庆", "Yuqing", 27.220000, 107.880000},
-    {"WM59157PCQSS", "贵州省/遵义市/习水县", "贵州/遵义/习水", "Xishui", 28.320000, 106.220000},
-    {"WM54T6B6SD0K", "贵州省/遵义市/赤水市", "贵州/遵义/赤水", "Chishui", 28.580000, 105.700000},
-    {"WKGWM8KXJXZK", "贵州省/遵义市/仁怀市", "贵州/遵义/仁怀", "Renhuai", 27.820000, 106.420000},
-    {"WKEM6FWMMFWJ", "贵州省/安顺市", "贵州/安顺/安顺", "Anshun", 26.250000, 105.950000},
-    {"WKEM74RR02GU", "贵州省/安顺市/西秀区", "贵州/安顺/西秀", "Xixiu", 26.248918, 105.962121},
-    {"WKEW3C8GSKYN", "贵州省/安顺市/平坝区", "贵州/安顺/平坝", "Pingba", 26.420000, 106.250000},
-    {"WKEJWRKV1EE5", "贵州省/安顺市/普定县", "贵州/安顺/普定", "Puding", 26.320000, 105.750000},
-    {"WKEHQCGKG8HR", "贵州省/安顺市/镇宁布依族苗族自治县", "贵州/安顺/镇宁", "Zhenning", 26.070000, 105.770000},
-    {"WKE5EKN1SQS5", "贵州省/安顺市/关岭布依族苗族自治县", "贵州/安顺/关岭", "Guanling", 25.950000, 105.620000},
-    {"WKE6MZTHE5VJ", "贵州省/安顺市/紫云苗族布依族自治县", "贵州/安顺/紫云", "Ziyun", 25.750000, 106.080000},
-    {"WKFG79YD1BCG", "贵州省/毕节市", "贵州/毕节/毕节", "Bijie", 27.300000, 105.280000},
-    {"WKFGK4NKXR2P", "贵州省/毕节市/七星关区", "贵州/毕节/七星关", "Qixingguan", 27.301838, 105.301863},
-    {"WKG46YX84QG4", "贵州省/毕节市/大方县", "贵州/毕节/大方", "Dafang", 27.150000, 105.600000},
-    {"WKG3UB8TNJ4Q", "贵州省/毕节市/黔西县", "贵州/毕节/黔西", "Qianxi", 27.030000, 106.030000},
-    {"WKGS30G037HS", "贵州省/毕节市/金沙县", "贵州/毕节/金沙", "Jinsha", 27.470000, 106.220000},
-    {"WKEPWZ5K58K6", "贵州省/毕节市/织金县", "贵州/毕节/织金", "Zhijin", 26.670000, 105.770000},
-    {"WKFBMGPKGCZ4", "贵州省/毕节市/纳雍县", "贵州/毕节/纳雍", "Nayong", 26.780000, 105.380000},
-    {"WKF0UGW3H55C", "贵州省/毕节市/威宁彝族回族苗族自治县", "贵州/毕节/威宁", "Weining", 26.870000, 104.280000},
-    {"WKF6QFYG8YE9", "贵州省/毕节市/赫章县", "贵州/毕节/赫章", "Hezhang", 27.130000, 104.720000},
-    {"WKVTSQQ2WQS8", "贵州省/铜仁市", "贵州/铜仁/铜仁", "Tongren", 27.720000, 109.180000},
-    {"WKVTS3EBTW5E", "贵州省/铜仁市/碧江区", "贵州/铜仁/碧江", "Bijiang", 27.693905, 109.176533},
-    {"WKVSSCV587VD", "贵州省/铜仁市/万山区", "贵州/铜仁/万山", "Wanshan", 27.520000, 109.200000},
-    {"WKVMSFWHHY68", "贵州省/铜仁市/江口县", "贵州/铜仁/江口", "Jiangkou", 27.700000, 108.850000},
-    {"WKV6YT145ZYT", "贵州省/铜仁市/玉屏侗族自治县", "贵州/铜仁/玉屏", "Yuping", 27.230000, 108.920000},
-    {"WKUUWCFETGC4", "贵州省/铜仁市/石阡县", "贵州/铜仁/石阡", "Shiqian", 27.520000, 108.230000},
-    {"WKUYZK90PC67", "贵州省/铜仁市/思南县", "贵州/铜仁/思南", "Sinan", 27.930000, 108.250000},
-    {"WKVP69NRZ463", "贵州省/铜仁市/印江土家族苗族自治县", "贵州/铜仁/印江", "Yinjiang", 28.000000, 108.400000},
-    {"WMHBU66SDTGQ", "贵州省/铜仁市/德江县", "贵州/铜仁/德江", "Dejiang", 28.270000, 108.120000},
-    {"WMJ4SCP234PB", "贵州省/铜仁市/沿河土家族自治县", "贵州/铜仁/沿河", "Yanhe", 28.570000, 108.500000},
-    {"WMJ8KBJN0KTE", "贵州省/铜仁市/松桃苗族自治县", "贵州/铜仁/松桃", "Songtao", 28.170000, 109.200000},
-    {"WK6WEPSTQ9P5", "贵州省/黔西南布依族苗族自治州", "贵州/贵州/黔西南", "Qianxinan", 25.090934, 104.903929},
-    {"WK6WEJ9VE4V7", "贵州省/黔西南布依族苗族自治州/兴义市", "贵州/黔西南/兴义", "Xingyi", 25.080000, 104.900000},
-    {"WKDB9MMSRXS6", "贵州省/黔西南布依族苗族自治州/兴仁市", "贵州/黔西南/兴仁", "Xingren", 25.430000, 105.180000},
-    {"WKDDSJN72HRF", "贵州省/黔西南布依族苗族自治州/普安县", "贵州/黔西南/普安", "Puan", 25.780000, 104.950000},
-    {"WKDFFQ4YESYX", "贵州省/黔西南布依族苗族自治州/晴隆县", "贵州/黔西南/晴隆", "Qinglong", 25.830000, 105.220000},
-    {"WKE0KH7CPQVV", "贵州省/黔西南布依族苗族自治州/贞丰县", "贵州/黔西南/贞丰", "Zhenfeng", 25.380000, 105.650000},
-    {"WK7RNQ59VHN4", "贵州省/黔西南布依族苗族自治州/望谟县", "贵州/黔西南/望谟", "Wangmo", 25.170000, 106.100000},
-    {"WK7NPGRZ09WB", "贵州省/黔西南布依族苗族自治州/册亨县", "贵州/黔西南/册亨", "Ceheng", 24.980000, 105.820000},
-    {"WK7NBHBYT5KH", "贵州省/黔西南布依族苗族自治州/安龙县", "贵州/黔西南/安龙", "Anlong", 25.120000, 105.470000},
-    {"WKSZ3058QEG5", "贵州省/黔东南苗族侗族自治州", "贵州/贵州/黔东南", "Qiandongnan", 26.586978, 107.978722},
-    {"WKSZ0YTRER5H", "贵州省/黔东南苗族侗族自治州/凯里市", "贵州/黔东南/凯里", "Kaili", 26.580000, 107.970000},
-    {"WKU9P2FRU5RQ", "贵州省/黔东南苗族侗族自治州/黄平县", "贵州/黔东南/黄平", "Huangping", 26.900000, 107.900000},
-    {"WKUCU2DT4T5Q", "贵州省/黔东南苗族侗族自治州/施秉县", "贵州/黔东南/施秉", "Shibing", 27.030000, 108.120000},
-    {"WKV33JDRES3S", "贵州省/黔东南苗族侗族自治州/三穗县", "贵州/黔东南/三穗", "Sansui", 26.970000, 108.680000},
-    {"WKV1GHM19J7R", "贵州省/黔东南苗族侗族自治州/镇远县", "贵州/黔东南/镇远", "Zhenyuan", 27.050000, 108.420000},
-    {"WKV6S7BQCZ1P", "贵州省/黔东南苗族侗族自治州/岑巩县", "贵州/黔东南/岑巩", "Cengong", 27.180000, 108.820000},
-    {"WKV9HUTH27TX", "贵州省/黔东南苗族侗族自治州/天柱县", "贵州/黔东南/天柱", "Tianzhu", 26.920000, 109.200000},
-    {"WKTXUBVN22MX", "贵州省/黔东南苗族侗族自治州/锦屏县", "贵州/黔东南/锦屏", "Jinping", 26.680000, 109.200000},
-    {"WKV05F4CS1JH", "贵州省/黔东南苗族侗族自治州/剑河县", "贵州/黔东南/剑河", "Jianhe", 26.730000, 108.450000},
-    {"WKTP8ZHHNBQ4", "贵州省/黔东南苗族侗族自治州/台江县", "贵州/黔东南/台江", "Taijiang", 26.670000, 108.320000},
-    {"WKTT5R40C63U", "贵州省/黔东南苗族侗族自治州/黎平县", "贵州/黔东南/黎平", "Liping", 26.230000, 109.130000},
-    {"WKT5T2MV5Q2F", "贵州省/黔东南苗族侗族自治州/榕江县", "贵州/黔东南/榕江", "Rongjiang", 25.930000, 108.520000},
-    {"WKT6QPDS9GVM", "贵州省/黔东南苗族侗族自治州/从江县", "贵州/黔东南/从江", "Congjiang", 25.750000, 108.900000},
-    {"WKSY54Q4TS2T", "贵州省/黔东南苗族侗族自治州/雷山县", "贵州/黔东南/雷山", "Leishan", 26.380000, 108.070000},
-    {"WKSWB01MEWN1", "贵州省/黔东南苗族侗族自治州/麻江县", "贵州/黔东南/麻江", "Majiang", 26.500000, 107.580000},
-    {"WKSTJ19D41CZ", "贵州省/黔东南苗族侗族自治州/丹寨县", "贵州/黔东南/丹寨", "Danzhai", 26.200000, 107.800000},
-    {"WKSMQSH1JQT7", "贵州省/黔南布依族苗族自治州", "贵州/贵州/黔南", "Qiannan", 26.257531, 107.517933},
-    {"WKSMQWM9VDFV", "贵州省/黔南布依族苗族自治州/都匀市", "贵州/黔南/都匀", "Duyun", 26.270000, 107.520000},
-    {"WKSRYHX4G89Z", "贵州省/黔南布依族苗族自治州/福泉市", "贵州/黔南/福泉", "Fuquan", 26.700000, 107.500000},
-    {"WKS8WGEF4PQQ", "贵州省/黔南布依族苗族自治州/荔波县", "贵州/黔南/荔波", "Libo", 25.420000, 107.880000},
-    {"WKSR0NDX8P5H", "贵州省/黔南布依族苗族自治州/贵定县", "贵州/黔南/贵定", "Guiding", 26.580000, 107.230000},
-    {"WKU3VXCQ0T8P", "贵州省/黔南布依族苗族自治州/瓮安县", "贵州/黔南/瓮安", "Wengan", 27.070000, 107.470000},
-    {"WKS6YYHYWSGR", "贵州省/黔南布依族苗族自治州/独山县", "贵州/黔南/独山", "Dushan", 25.830000, 107.530000},
-    {"WKS6FNHN9KBP", "贵州省/黔南布依族苗族自治州/平塘县", "贵州/黔南/平塘", "Pingtang", 25.830000, 107.320000},
-    {"WKEBTJKURR94", "贵州省/黔南布依族苗族自治州/罗甸县", "贵州/黔南/罗甸", "Luodian", 25.430000, 106.750000},
-    {"WKESN6DE8Z9N", "贵州省/黔南布依族苗族自治州/长顺县", "贵州/黔南/长顺", "Changshun", 26.030000, 106.450000},
-    {"WKSN6PJ4MTM5", "贵州省/黔南布依族苗族自治州/龙里县", "贵州/黔南/龙里", "Longli", 26.450000, 106.970000},
-    {"WKEUDUU4M15C", "贵州省/黔南布依族苗族自治州/惠水县", "贵州/黔南/惠水", "Huishui", 26.130000, 106.650000},
-    {"WKSEY9S83PJB", "贵州省/黔南布依族苗族自治州/三都水族自治县", "贵州/黔南/三都", "Sandu", 25.980000, 107.870000},
-    {"WK3N92NQV6RQ", "云南省/昆明市", "云南/昆明/昆明", "Kunming", 25.050000, 102.720000},
-    {"WK3N3P64940F", "云南省/昆明市/五华区", "云南/昆明/五华", "Wuhua", 25.045149, 102.702986},
-    {"WK3N9S7VVVX0", "云南省/昆明市/盘龙区", "云南/昆明/盘龙", "Panlong", 25.073191, 102.727574},
-    {"WK3N37XB7ECR", "云南省/昆明市/官渡区", "云南/昆明/官渡", "Guandu", 25.024173, 102.721977},
-    {"WK3N3H54GDZX", "云南省/昆明市/西山区", "云南/昆明/西山", "Xishan", 25.027343, 102.704476},
-    {"WK9K7GTRH227", "云南省/昆明市/东川区", "云南/昆明/东川", "Dongchuan", 26.080000, 103.180000},
-    {"WK3JE328T85V", "云南省/昆明市/呈贡区", "云南/昆明/呈贡", "Chenggong", 24.880000, 102.800000},
-    {"WK2UQEP11M2F", "云南省/昆明市/晋宁区", "云南/昆明/晋宁", "Jinning", 24.670000, 102.600000},
-    {"WK2ZKRNJPHG8", "云南省/昆明市/富民县", "云南/昆明/富民", "Fumin", 25.220000, 102.500000},
-    {"WK3MG0X990WW", "云南省/昆明市/宜良县", "云南/昆明/宜良", "Yiliang", 24.920000, 103.150000},
-    {"WK3KVVNZTQTJ", "云南省/昆明市/石林彝族自治县", "云南/昆明/石林", "Shilin", 24.770000, 103.270000},
-    {"WK920WB4MN80", "云南省/昆明市/嵩明县", "云南/昆明/嵩明", "Songming", 25.350000, 103.030000},
-    {"WK8C7G0RS11Y", "云南省/昆明市/禄劝彝族苗族自治县", "云南/昆明/禄劝", "Luquan", 25.550000, 102.470000},
-    {"WK93MWBK53KP", "云南省/昆明市/寻甸回族彝族自治县", "云南/昆明/寻甸", "Xundian", 25.570000, 103.250000},
-    {"WK2VGBX9T0DQ", "云南省/昆明市/安宁市", "云南/昆明/安宁", "Anning", 24.920000, 102.480000},
-    {"WK9C440U729C", "云南省/曲靖市", "云南/曲靖/曲靖", "Qujing", 25.500000, 103.800000},
-    {"WK9C41G417BE", "云南省/曲靖市/麒麟区", "云南/曲靖/麒麟", "Qilin", 25.498258, 103.803003},
-    {"WK9CDRZRM64U", "云南省/曲靖市/沾益区", "云南/曲靖/沾益", "Zhanyi", 25.620000, 103.820000},
-    {"WK98TJ2SKZTF", "云南省/曲靖市/马龙区", "云南/曲靖/马龙", "Malong", 25.430000, 103.580000},
-    {"WK3WRHD4Q44V", "云南省/曲靖市/陆良县", "云南/曲靖/陆良", "Luliang", 25.030000, 103.670000},
-    {"WK3VQ05VJX7X", "云南省/曲靖市/师宗县", "云南/曲靖/师宗", "Shizong", 24.830000, 103.980000},
-    {"WK6JT3KBW0HV", "云南省/曲靖市/罗平县", "云南/曲靖/罗平", "Luoping", 24.880000, 104.300000},
-    {"WKD4H30D94F4", "云南省/曲靖市/富源县", "云南/曲靖/富源", "Fuyuan", 25.670000, 104.250000},
-    {"WK9QQ9SG8KYY", "云南省/曲靖市/会泽县", "云南/曲靖/会泽", "Huize", 26.420000, 103.300000},
-    {"WKDJ0V5Q9F60", "云南省/曲靖市/宣威市", "云南/曲靖/宣威", "Xuanwei", 26.220000, 104.100000},
-    {"WK2FT8F9H0YR", "云南省/玉溪市", "云南/玉溪/玉溪", "Yuxi", 24.350000, 102.550000},
-    {"WK2FMRDWCVD0", "云南省/玉溪市/红塔区", "云南/玉溪/红塔", "Hongta", 24.344145, 102.538912},
-    {"WK344HH32811", "云南省/玉溪市/江川区", "云南/玉溪/江川", "Jiangchuan", 24.280000, 102.750000},
-    {"WK3HQ5011V66", "云南省/玉溪市/澄江县", "云南/玉溪/澄江", "Chengjiang", 24.670000, 102.920000},
-    {"WK314NUM0TCH", "云南省/玉溪市/通海县", "云南/玉溪/通海", "Tonghai", 24.120000, 102.750000},
-    {"WK31WJRR4YFZ", "云南省/玉溪市/华宁县", "云南/玉溪/华宁", "Huaning", 24.200000, 102.930000},
-    {"WK2SKGJCJT3D", "云南省/玉溪市/易门县", "云南/玉溪/易门", "Yimen", 24.670000, 102.170000},
-    {"WK2CD1V6SYWN", "云南省/玉溪市/峨山彝族自治县", "云南/玉溪/峨山", "Eshan", 24.180000, 102.400000},
-    {"WK28BTG9FJPQ", "云南省/玉溪市/新平彝族傣族自治县", "云南/玉溪/新平", "Xinping", 24.070000, 101.980000},
-    {"WK0W1N6JSQ8X", "云南省/玉溪市/元江哈尼族彝族傣族自治县", "云南/玉溪/元江", "Yuanjiang", 23.590000, 102.000000},
-    {"WHQWBSVQS7RS", "云南省/保山市", "云南/保山/保山", "Baoshan", 25.120000, 99.170000},
-    {"WHQWBT9W0B66", "云南省/保山市/隆阳区", "云南/保山/隆阳", "Longyang", 25.124018, 99.164693},
-    {"WHQS8VUWTW0H", "云南省/保山市/施甸县", "云南/保山/施甸", "Shidian", 24.730000, 99.180000},
-    {"WHQ5VD8SFSJ5", "云南省/保山市/龙陵县", "云南/保山/龙陵", "Longling", 24.580000, 98.680000},
-    {"WHQV62NT0PQZ", "云南省/保山市/昌宁县", "云南/保山/昌宁", "Changning", 24.830000, 99.600000},
-    {"WHQN3KTD265M", "云南省/保山市/腾冲市", "云南/保山/腾冲", "Tengchong", 25.030000, 98.500000},
-    {"WKCG2PQ8G1M2", "云南省/昭通市", "云南/昭通/昭通", "Zhaotong", 27.330000, 103.720000},
-    {"WKCERY5710Y4", "云南省/昭通市/昭阳区", "云南/昭通/昭阳", "Zhaoyang", 27.323517, 103.704465},
-    {"WKCDSRDG3ZS2", "云南省/昭通市/鲁甸县", "云南/昭通/鲁甸", "Ludian", 27.200000, 103.550000},
-    {"WKC1NH8H3GDR", "云南省/昭通市/巧家县", "云南/昭通/巧家", "Qiaojia", 26.920000, 102.920000},
-    {"WKFPGZ1FZ5CJ", "云南省/昭通市/盐津县", "云南/昭通/盐津", "Yanjin", 28.120000, 104.230000},
-    {"WKCVGGEP7QYJ", "云南省/昭通市/大关县", "云南/昭通/大关", "Daguan", 27.750000, 103.880000},
-    {"WM18W5J5DJ2T", "云南省/昭通市/永善县", "云南/昭通/永善", "Yongshan", 28.230000, 103.630000},
-    {"WM1FTQQP4D3V", "云南省/昭通市/绥江县", "云南/昭通/绥江", "Suijiang", 28.600000, 103.950000},
-    {"WKFS4MH5B4GS", "云南省/昭通市/镇雄县", "云南/昭通/镇雄", "Zhenxiong", 27.450000, 104.870000},
-    {"WKCVPTYUKTR3", "云南省/昭通市/彝良县", "云南/昭通/彝良", "Yiliang", 27.630000, 104.050000},
-    {"WKFWQMZN42M3", "云南省/昭通市/威信县", "云南/昭通/威信", "Weixin", 27.850000, 105.050000},
-    {"WM44ZEVVB6F4", "云南省/昭通市/水富市", "云南/昭通/水富", "Shuifu", 28.630000, 104.400000},
-    {"WHZ2BV37270V", "云南省/丽江市", "云南/丽江/丽江", "Lijiang", 26.880000, 100.230000},
-    {"WHZ2BTMRE5QP", "云南省/丽江市/古城区", "云南/丽江/古城", "Gucheng", 26.880731, 100.224632},
-    {"WHZ28GME01UD", "云南省/丽江市/玉龙纳西族自治县", "云南/丽江/玉龙", "Yulong", 26.825018, 100.235831},
-    {"WHXXU8GYM0KZ", "云南省/丽江市/永胜县", "云南/丽江/永胜", "Yongsheng", 26.680000, 100.750000},
-    {"WK8P2RYDFPC1", "云南省/丽江市/华坪县", "云南/丽江/华坪", "Huaping", 26.630000, 101.270000},
-    {"WHZENYHTX2D6", "云南省/丽江市/宁蒗彝族自治县", "云南/丽江/宁蒗", "Ninglang", 27.280000, 100.850000},
-    {"WHPG4ZZB3XSN", "云南省/普洱市", "云南/普洱/普洱", "Puer", 23.070000, 101.030000},
-    {"WHPC9UB2WNWU", "云南省/普洱市/思茅区", "云南/普洱/思茅", "Simao", 22.789886, 100.975952},
-    {"WHPGWHBBGJNT", "云南省/普洱市/宁洱哈尼族彝族自治县", "云南/普洱/宁洱", "Ninger", 23.141483, 101.163277},
-    {"WK0M3C31ESX4", "云南省/普洱市/墨江哈尼族自治县", "云南/普洱/墨江", "Mojiang", 23.430000, 101.680000},
-    {"WHREN6YPT637", "云南省/普洱市/景东彝族自治县", "云南/普洱/景东", "Jingdong", 24.450000, 100.830000},
-    {"WHPTEQP92JD2", "云南省/普洱市/景谷傣族彝族自治县", "云南/普洱/景谷", "Jinggu", 23.500000, 100.700000},
-    {"WHPXZWFED6UJ", "云南省/普洱市/镇沅彝族哈尼族拉祜族自治县", "云南/普洱/镇沅", "Zhenyuan", 23.900000, 100.880000},
-    {"WK02MWSFJ106", "云南省/普洱市/江城哈尼族彝族自治县", "云南/普洱/江城", "Jiangcheng", 22.580000, 101.850000},
-    {"W5YYCR4P7JS4", "云南省/普洱市/孟连傣族拉祜族佤族自治县", "云南/普洱/孟连", "Menglian", 22.320000, 99.550000},
-    {"WHP03CNG3B8T", "云南省/普洱市/澜沧拉祜族自治县", "云南/普洱/澜沧", "Lancang", 22.550000, 99.930000},
-    {"WHNBDZTJ61ZB", "云南省/普洱市/西盟佤族自治县", "云南/普洱/西盟", "Ximeng", 22.630000, 99.620000},
-    {"WHPPV7HP148U", "云南省/临沧市", "云南/临沧/临沧", "Lincang", 23.880000, 100.080000},
-    {"WHPPVQKYQSPH", "云南省/临沧市/临翔区", "云南/临沧/临翔", "Linxiang", 23.897732, 100.081275},
-    {"WHR5CWR92U25", "云南省/临沧市/凤庆县", "云南/临沧/凤庆", "Fengqing", 24.600000, 99.920000},
-    {"WHR5NDBRW477", "云南省/临沧市/云县", "云南/临沧/云县", "Yunxian", 24.450000, 100.130000},
-    {"WHQ8DQX8USEV", "云南省/临沧市/永德县", "云南/临沧/永德", "Yongde", 24.030000, 99.250000},
-    {"WHNR2CJB9CM1", "云南省/临沧市/镇康县", "云南/临沧/镇康", "Zhenkang", 23.780000, 98.830000},
-    {"WHPJ2HUW1SU6", "云南省/临沧市/双江拉祜族佤族布朗族傣族自治县", "云南/临沧/双江", "Shuangjiang", 23.450000, 99.850000},
-    {"WHNTVZHUEYHJ", "云南省/临沧市/耿马傣族佤族自治县", "云南/临沧/耿马", "Gengma", 23.550000, 99.400000},
-    {"WHNEDQRDS8GC", "云南省/临沧市/沧源佤族自治县", "云南/临沧/沧源", "Cangyuan", 23.150000, 99.250000},
-    {"WK2NQUD6QD0J", "云南省/楚雄彝族自治州", "云南/楚雄", "Chuxiong", 25.030000, 101.550000},
-    {"WK2NQUD6QD0J", "云南省/楚雄彝族自治州/楚雄市", "云南/楚雄/楚雄", "Chuxiong", 25.030000, 101.550000},
-    {"WK2K88KXYTSX", "云南省/楚雄彝族自治州/双柏县", "云南/楚雄/双柏", "Shuangbai", 24.700000, 101.630000},
-    {"WK80N37GSQP5", "云南省/楚雄彝族自治州/牟定县", "云南/楚雄/牟定", "Mouding", 25.320000, 101.530000},
-    {"WK2P27W8DH3P", "云南省/楚雄彝族自治州/南华县", "云南/楚雄/南华", "Nanhua", 25.200000, 101.270000},
-    {"WHXCPD1KMBWC", "云南省/楚雄彝族自治州/姚安县", "云南/楚雄/姚安", "Yaoan", 25.500000, 101.230000},
-    {"WK843S4BP5EU", "云南省/楚雄彝族自治州/大姚县", "云南/楚雄/大姚", "Dayao", 25.730000, 101.320000},
-    {"WK8K39CUF8NX", "云南省/楚雄彝族自治州/永仁县", "云南/楚雄/永仁", "Yongren", 26.070000, 101.670000},
-    {"WK86NQDC254P", "云南省/楚雄彝族自治州/元谋县", "云南/楚雄/元谋", "Yuanmou", 25.700000, 101.880000},
-    {"WK8C4PT7HBYN", "云南省/楚雄彝族自治州/武定县", "云南/楚雄/武定", "Wuding", 25.530000, 102.400000},
-    {"WK2X4FKMK7UC", "云南省/楚雄彝族自治州/禄丰县", "云南/楚雄/禄丰", "Lufeng", 25.150000, 102.080000},
-    {"WK1KZS3MC5U1", "云南省/红河哈尼族彝族自治州", "云南/红河", "Honghe", 23.369161, 102.420600},
-    {"WK1KGNRS15Y8", "云南省/红河哈尼族彝族自治州/个旧市", "云南/红河/个旧", "Gejiu", 23.370000, 103.150000},
-    {"WK1QVYNGJ2MP", "云南省/红河哈尼族彝族自治州/开远市", "云南/红河/开远", "Kaiyuan", 23.720000, 103.270000},
-    {"WK1SBYMS4EU0", "云南省/红河哈尼族彝族自治州/蒙自市", "云南/红河/蒙自", "Mengzi", 23.370000, 103.400000},
-    {"WK3DC9GKM9TV", "云南省/红河哈尼族彝族自治州/弥勒市", "云南/红河/弥勒", "Mile", 24.400000, 103.430000},
-    {"WK1DXR3KPN7R", "云南省/红河哈尼族彝族自治州/屏边苗族自治县", "云南/红河/屏边", "Pingbian", 22.980000, 103.680000},
-    {"WK1N7GYS2XJK", "云南省/红河哈尼族彝族自治州/建水县", "云南/红河/建水", "Jianshui", 23.620000, 102.830000},
-    {"WK0YUQN5P07X", "云南省/红河哈尼族彝族自治州/石屏县", "云南/红河/石屏", "Shiping", 23.720000, 102.500000},
-    {"WK3G93E1872J", "云南省/红河哈尼族彝族自治州/泸西县", "云南/红河/泸西", "Luxi", 24.530000, 103.770000},
-    {"WK1H5UYS89V7", "云南省/红河哈尼族彝族自治州/元阳县", "云南/红河/元阳", "Yuanyang", 23.230000, 102.830000},
-    {"WK1KZS3MC5U1", "云南省/红河哈尼族彝族自治州/红河县", "云南/红河/红河", "Honghe", 23.369161, 102.420600},
-    {"WS4UZW6K55FB", "云南省/红河哈尼族彝族自治州/金平苗族瑶族傣族自治县", "云南/红河/金平", "Jinping", 22.779543, 103.226448},
-    {"WK0FF5J2SYY0", "云南省/红河哈尼族彝族自治州/绿春县", "云南/红河/绿春", "Lvchun", 23.000000, 102.400000},
-    {"WK1BJGSSS870", "云南省/红河哈尼族彝族自治州/河口瑶族自治县", "云南/红河/河口", "Hekou", 22.520000, 103.970000},
-    {"WK4HUQ2S15F0", "云南省/文山壮族苗族自治州", "云南/文山", "Wenshan", 23.370000, 104.250000},
-    {"WK4HUQ2S15F0", "云南省/文山壮族苗族自治州/文山市", "云南/文山/文山", "Wenshan", 23.370000, 104.250000},
-    {"WK4NQ5FU3PNK", "云南省/文山壮族苗族自治州/砚山县", "云南/文山/砚山", "Yanshan", 23.620000, 104.330000},
-    {"WK4MMUFQ5UBF", "云南省/文山壮族苗族自治州/西畴县", "云南/文山/西畴", "Xichou", 23.450000, 104.670000},
-    {"WK47W8B5YB6K", "云南省/文山壮族苗族自治州/麻栗坡县", "云南/文山/麻栗坡", "Malipo", 23.120000, 104.700000},
-    {"WK44ZWTV0R40", "云南省/文山壮族苗族自治州/马关县", "云南/文山/马关", "Maguan", 23.020000, 104.400000},
-    {"WK60FDJT3UYQ", "云南省/文山壮族苗族自治州/丘北县", "云南/文山/丘北", "Qiubei", 24.050000, 104.180000},
-    {"WK68YFJTKKYQ", "云南省/文山壮族苗族自治州/广南县", "云南/文山/广南", "Guangnan", 24.050000, 105.070000},
-    {"WK5N7MWNSRK0", "云南省/文山壮族苗族自治州/富宁县", "云南/文山/富宁", "Funing", 23.630000, 105.620000},
-    {"W5ZTJWVFU2BB", "云南省/西双版纳傣族自治州", "云南/云南/西双版纳", "Xishuangbanna", 22.010211, 100.796654},
-    {"W5ZTMB87F1X8", "云南省/西双版纳傣族自治州/景洪市", "云南/西双版纳/景洪", "Jinghong", 22.020000, 100.800000},
-    {"W5ZKVZ92W8UF", "云南省/西双版纳傣族自治州/勐海县", "云南/西双版纳/勐海", "Menghai", 21.970000, 100.450000},
-    {"W7B4PQ340D1Q", "云南省/西双版纳傣族自治州/勐腊县", "云南/西双版纳/勐腊", "Mengla", 21.480000, 101.570000},
-    {"WHX38U36B3BU", "云南省/大理白族自治州", "云南/大理", "Dali", 25.600000, 100.230000},
-    {"WHX38U36B3BU", "云南省/大理白族自治州/大理市", "云南/大理/大理", "Dali", 25.600000, 100.230000},
-    {"WHX443J6EFCD", "云南省/大理白族自治州/漾濞彝族自治县", "云南/大理/漾濞", "Yangbi", 25.670000, 99.950000},
-    {"WHX8BN6RBB60", "云南省/大理白族自治州/祥云县", "云南/大理/祥云", "Xiangyun", 25.480000, 100.550000},
-    {"WHXDBY0NEUGZ", "云南省/大理白族自治州/宾川县", "云南/大理/宾川", "Binchuan", 25.830000, 100.580000},
-    {"WHX2NQZ63WW2", "云南省/大理白族自治州/弥渡县", "云南/大理/弥渡", "Midu", 25.350000, 100.480000},
-    {"WHRQX2HQVF2W", "云南省/大理白族自治州/南涧彝族自治县", "云南/大理/南涧", "Nanjian", 25.050000, 100.520000},
-    {"WHRRD2UPRKUS", "云南省/大理白族自治州/巍山彝族回族自治县", "云南/大理/巍山", "Weishan", 25.230000, 100.300000},
-    {"WHWBBUET905H", "云南省/大理白族自治州/永平县", "云南/大理/永平", "Yongping", 25.470000, 99.530000},
-    {"WHWEJPR1BVDM", "云南省/大理白族自治州/云龙县", "云南/大理/云龙", "Yunlong", 25.880000, 99.370000},
-    {"WHXHD7J25BCT", "云南省/大理白族自治州/洱源县", "云南/大理/洱源", "Eryuan", 26.120000, 99.950000},
-    {"WHXNCM8UQWRN", "云南省/大理白族自治州/剑川县", "云南/大理/剑川", "Jianchuan", 26.530000, 99.900000},
-    {"WHXPPSUV7NYP", "云南省/大理白族自治州/鹤庆县", "云南/大理/鹤庆", "Heqing", 26.570000, 100.180000},
-    {"WHQ5514S00XF", "云南省/德宏傣族景颇族自治州", "云南/德宏/德宏", "Dehong", 24.439777, 98.572780},
-    {"WHM8DSSNWK81", "云南省/德宏傣族景颇族自治州/瑞丽市", "云南/德宏/瑞丽", "Ruili", 24.020000, 97.850000},
-    {"WHQ4GPRG06PD", "云南省/德宏傣族景颇族自治州/芒市", "云南/德宏/芒市", "Mangshi", 24.430000, 98.580000},
-    {"WHMVHY7FUP2E", "云南省/德宏傣族景颇族自治州/梁河县", "云南/德宏/梁河", "Lianghe", 24.820000, 98.300000},
-    {"WHMSSKNKQMUX", "云南省/德宏傣族景颇族自治州/盈江县", "云南/德宏/盈江", "Yingjiang", 24.720000, 97.930000},
-    {"WHM99MRZ1NVX", "云南省/德宏傣族景颇族自治州/陇川县", "云南/德宏/陇川", "Longchuan", 24.200000, 97.800000},
-    {"WHW713U75VQ2", "云南省/怒江傈僳族自治州", "云南/怒江/怒江", "Nujiang", 25.850000, 98.850000},
-    {"WHW78XWW0YUS", "云南省/怒江傈僳族自治州/泸水市", "云南/怒江/泸水", "Lushui", 25.970000, 98.820000},
-    {"WHY31BFZVGRQ", "云南省/怒江傈僳族自治州/福贡县", "云南/怒江/福贡", "Fugong", 26.900000, 98.870000},
-    {"WHYJV216CWST", "云南省/怒江傈僳族自治州/贡山独龙族怒族自治县", "云南/怒江/贡山", "Gongshan", 27.730000, 98.670000},
-    {"WHWWQR56MVM5", "云南省/怒江傈僳族自治州/兰坪白族普米族自治县", "云南/怒江/兰坪", "Lanping", 26.450000, 99.420000},
-    {"WHYYKBBJHGP4", "云南省/迪庆藏族自治州", "云南/云南/迪庆", "Diqing", 27.822377, 99.701141},
-    {"WHYYKDR3D2H0", "云南省/迪庆藏族自治州/香格里拉市", "云南/迪庆/香格里拉", "Xianggelila", 27.830000, 99.700000},
-    {"WJN64BXK50F1", "云南省/迪庆藏族自治州/德钦县", "云南/迪庆/德钦", "Deqin", 28.480000, 98.920000},
-    {"WHYDE5VQZXJX", "云南省/迪庆藏族自治州/维西傈僳族自治县", "云南/迪庆/维西", "Weixi", 27.180000, 99.280000},
-    {"WJ2B9TWGFBT5", "西藏自治区/拉萨市", "西藏/拉萨/拉萨", "Lasa", 29.650000, 91.130000},
-    {"WJ2B9VM9U1Z6", "西藏自治区/拉萨市/城关区", "西藏/拉萨/城关", "Chengguan", 29.648290, 91.139327},
-    {"WJ28WV85V8W5", "西藏自治区/拉萨市/堆龙德庆区", "西藏/拉萨/堆龙德庆", "Duilongdeqing", 29.650000, 91.000000},
-    {"WJ2BYEP4930B", "西藏自治区/拉萨市/达孜区", "西藏/拉萨/达孜", "Dazi", 29.680000, 91.350000},
-    {"WJ2FH7NHP5GX", "西藏自治区/拉萨市/林周县", "西藏/拉萨/林周", "Linzhou", 29.900000, 91.250000},
-    {"WJ2V3H8YZGG6", "西藏自治区/拉萨市/当雄县", "西藏/拉萨/当雄", "Dangxiong", 30.480000, 91.100000},
-    {"WJ0PE3JNXMBH", "西藏自治区/拉萨市/尼木县", "西藏/拉萨/尼木", "Nimu", 29.450000, 90.150000},
-    {"WJ0X0DESDHZ6", "西藏自治区/拉萨市/曲水县", "西藏/拉萨/曲水", "Qushui", 29.370000, 90.730000},
-    {"WJ31XQ7SRGJ3", "西藏自治区/拉萨市/墨竹工卡县", "西藏/拉萨/墨竹工卡", "Mozhugongka", 29.830000, 91.730000},
-    {"TVPNW82QN57R", "西藏自治区/日喀则市", "西藏/日喀则/日喀则", "Rikaze", 29.270000, 88.880000},
-    {"TVPNQVH2QWTV", "西藏自治区/日喀则市/桑珠孜区", "西藏/日喀则/桑珠孜", "Sangzhuzi", 29.251177, 88.896504},
-    {"TVR2GE0DS3P2", "西藏自治区/日喀则市/南木林县", "西藏/日喀则/南木林", "Nanmulin", 29.680000, 89.100000},
-    {"TVPSWBSXPQDR", "西藏自治区/日喀则市/江孜县", "西藏/日喀则/江孜", "Jiangzi", 28.920000, 89.600000},
-    {"TVJGN7NYG5K7", "西藏自治区/日喀则市/定日县", "西藏/日喀则/定日", "Dingri", 28.670000, 87.120000},
-    {"TVNS6VN4WWKZ", "西藏自治区/日喀则市/萨迦县", "西藏/日喀则/萨迦", "Sajia", 28.900000, 88.020000},
-    {"TVNM6JF5QBZU", "西藏自治区/日喀则市/拉孜县", "西藏/日喀则/拉孜", "Lazi", 29.080000, 87.630000},
-    {"TVNN8VYUY7FK", "西藏自治区/日喀则市/昂仁县", "西藏/日喀则/昂仁", "Angren", 29.300000, 87.230000},
-    {"TVNZ2TS60JDS", "西藏自治区/日喀则市/谢通门县", "西藏/日喀则/谢通门", "Xietongmen", 29.430000, 88.270000},
-    {"TVPMXMHKMC2W", "西藏自治区/日喀则市/白朗县", "西藏/日喀则/白朗", "Bailang", 29.120000, 89.270000},
-    {"TVPYK1HJNDYV", "西藏自治区/日喀则市/仁布县", "西藏/日喀则/仁布", "Renbu", 29.230000, 89.830000},
-    {"TVPF89NBR6N8", "西藏自治区/日喀则市/康马县", "西藏/日喀则/康马", "Kangma", 28.570000, 89.680000},
-    {"TVN3MK85JPR3", "西藏自治区/日喀则市/定结县", "西藏/日喀则/定结", "Dingjie", 28.370000, 87.770000},
-    {"TV7C25KYBFJR", "西藏自治区/日喀则市/仲巴县", "西藏/日喀则/仲巴", "Zhongba", 29.770000, 84.030000},
-    {"TUZHQFX485K9", "西藏自治区/日喀则市/亚东县", "西藏/日喀则/亚东", "Yadong", 27.480000, 88.900000},
-    {"TVHSJ5CX6JCC", "西藏自治区/日喀则市/吉隆县", "西藏/日喀则/吉隆", "Jilong", 28.850000, 85.300000},
-    {"TVJ0K80WPHWE", "西藏自治区/日喀则市/聂拉木县", "西藏/日喀则/聂拉木", "Nielamu", 28.170000, 85.980000},
-    {"TVHWG7QEDUQ0", "西藏自治区/日喀则市/萨嘎县", "西藏/日喀则/萨嘎", "Saga", 29.330000, 85.230000},
-    {"TVNBYK4QCW05", "西藏自治区/日喀则市/岗巴县", "西藏/日喀则/岗巴", "Gangba", 28.280000, 88.520000},
-    {"WJT157H36HS5", "西藏自治区/昌都市", "西藏/昌都/昌都", "Changdu", 31.130000, 97.180000},
-    {"WJT158PWGVZG", "西藏自治区/昌都市/卡若区", "西藏/昌都/卡若", "Karuo", 31.114471, 97.195530},
-    {"WJTG5N3SGCS5", "西藏自治区/昌都市/江达县", "西藏/昌都/江达", "Jiangda", 31.500000, 98.220000},
-    {"WJMZS5WNBCNF", "西藏自治区/昌都市/贡觉县", "西藏/昌都/贡觉", "Gongjue", 30.870000, 98.270000},
-    {"WJS9W5MVXJUD", "西藏自治区/昌都市/类乌齐县", "西藏/昌都/类乌齐", "Leiwuqi", 31.220000, 96.600000},
-    {"WJEFXRVFC2W8", "西藏自治区/昌都市/丁青县", "西藏/昌都/丁青", "Dingqing", 31.420000, 95.600000},
-    {"WJMQK78M1Y15", "西藏自治区/昌都市/察雅县", "西藏/昌都/察雅", "Chaya", 30.650000, 97.570000},
-    {"WJKFVQQVZWJB", "西藏自治区/昌都市/八宿县", "西藏/昌都/八宿", "Basu", 30.050000, 96.920000},
-    {"WJM8F9K0Q2B5", "西藏自治区/昌都市/左贡县", "西藏/昌都/左贡", "Zuogong", 29.670000, 97.850000},
-    {"WJQ0GEN6D90B", "西藏自治区/昌都市/芒康县", "西藏/昌都/芒康", "Mangkang", 29.680000, 98.600000},
-    {"WJKNUTV78Z7N", "西藏自治区/昌都市/洛隆县", "西藏/昌都/洛隆", "Luolong", 30.750000, 95.830000},
-    {"WJ7RFYWKMCYH", "西藏自治区/昌都市/边坝县", "西藏/昌都/边坝", "Bianba", 30.930000, 94.700000},
-    {"WJ70G7N4S3H0", "西藏自治区/林芝市", "西藏/林芝/林芝", "Linzhi", 29.680000, 94.370000},
-    {"WJ70E5WYGTPN", "西藏自治区/林芝市/巴宜区", "西藏/林芝/巴宜", "Bayi", 29.639553, 94.360015},
-    {"WJ63CZQXD7XW", "西藏自治区/林芝市/工布江达县", "西藏/林芝/工布江达", "Gongbujiangda", 29.880000, 93.250000},
-    {"WJ5N0P2FV4U1", "西藏自治区/林芝市/米林县", "西藏/林芝/米林", "Milin", 29.220000, 94.220000},
-    {"WJ5YC735WH20", "西藏自治区/林芝市/墨脱县", "西藏/林芝/墨脱", "Motuo", 29.330000, 95.330000},
-    {"WJK1GM9T6EXF", "西藏自治区/林芝市/波密县", "西藏/林芝/波密", "Bomi", 29.870000, 95.770000},
-    {"WJJ71GPQZE7E", "西藏自治区/林芝市/察隅县", "西藏/林芝/察隅", "Chayu", 28.670000, 97.470000},
-    {"WJ4JMB7S80MZ", "西藏自治区/林芝市/朗县", "西藏/林芝/朗县", "Langxian", 29.050000, 93.070000},
-    {"WJ1Q3KPFD1QS", "西藏自治区/山南市", "西藏/山南/山南", "Shannan", 29.246042, 91.823482},
-    {"WJ1Q230V5FZT", "西藏自治区/山南市/乃东区", "西藏/山南/乃东", "Naidong", 29.230000, 91.770000},
-    {"WJ0YRYDKXB3J", "西藏自治区/山南市/扎囊县", "西藏/山南/札囊", "Zhanang", 29.260113, 91.398688},
-    {"WJ0WWMCSGEUU", "西藏自治区/山南市/贡嘎县", "西藏/山南/贡嘎", "Gongga", 29.300000, 90.980000},
-    {"WJ1QTBQYJ7MP", "西藏自治区/山南市/桑日县", "西藏/山南/桑日", "Sangri", 29.270000, 92.020000},
-    {"WJ1JNHZ24B4Z", "西藏自治区/山南市/琼结县", "西藏/山南/琼结", "Qiongjie", 29.030000, 91.680000},
-    {"WJ1T6H1CP8YB", "西藏自治区/山南市/曲松县", "西藏/山南/曲松", "Qusong", 29.070000, 92.200000},
-    {"WJ118X92C2J7", "西藏自治区/山南市/措美县", "西藏/山南/措美", "Cuomei", 28.430000, 91.430000},
-    {"WJ097Y3T2RRN", "西藏自治区/山南市/洛扎县", "西藏/山南/洛扎", "Luozha", 28.380000, 90.870000},
-    {"WJ1VFDWEN3G7", "西藏自治区/山南市/加查县", "西藏/山南/加查", "Jiacha", 29.150000, 92.580000},
-    {"WJ1C8JWW7PVR", "西藏自治区/山南市/隆子县", "西藏/山南/隆子", "Longzi", 28.420000, 92.470000},
-    {"WHCRK35ZY633", "西藏自治区/山南市/错那县", "西藏/山南/错那", "Cuona", 28.000000, 91.950000},
-    {"WJ0KC1G62XMT", "西藏自治区/山南市/浪卡子县", "西藏/山南/浪卡子", "Langkazi", 28.970000, 90.400000},
-    {"WJ97P4G263RF", "西藏自治区/那曲市", "西藏/那曲/那曲", "Naqu", 31.480000, 92.070000},
-    {"WJ97N9Q6PJUR", "西藏自治区/那曲市/色尼区", "西藏/那曲/色尼", "Seni", 31.472086, 92.052347},
-    {"WJ6Q3GWT4QPE", "西藏自治区/那曲市/嘉黎县", "西藏/那曲/嘉黎", "Jiali", 30.650000, 93.250000},
-    {"WJDE5DZ8Q1QF", "西藏自治区/那曲市/比如县", "西藏/那曲/比如", "Biru", 31.480000, 93.680000},
-    {"WJ9WSR6B9CUR", "西藏自治区/那曲市/聂荣县", "西藏/那曲/聂荣", "Nierong", 32.120000, 92.300000},
-    {"WJ9PW4X66U4B", "西藏自治区/那曲市/安多县", "西藏/那曲/安多", "Anduo", 32.270000, 91.680000},
-    {"TVRPFX4Y6Q8F", "西藏自治区/那曲市/申扎县", "西藏/那曲/申扎", "Shenzha", 30.933115, 88.707488},
-    {"WJDTQ58D2QSR", "西藏自治区/那曲市/索县", "西藏/那曲/索县", "Suoxian", 31.880000, 93.780000},
-    {"WJ842QWX6PC4", "西藏自治区/那曲市/班戈县", "西藏/那曲/班戈", "Bange", 31.370000, 90.020000},
-    {"WJDVESWT9Z3V", "西藏自治区/那曲市/巴青县", "西藏/那曲/巴青", "Baqing", 31.930000, 94.030000},
-    {"TVWHBCQGYM6K", "西藏自治区/那曲市/尼玛县", "西藏/那曲/尼玛", "Nima", 31.780000, 87.230000},
-    {"TYN9ZT6T4ZPF", "西藏自治区/那曲市/双湖县", "西藏/那曲/双湖", "Shuanghu", 33.188500, 88.837641},
-    {"TV9JG0M1S9QU", "西藏自治区/阿里地区", "西藏/阿里/阿里", "Ali", 31.949880, 80.295155},
-    {"TV3SR5FNQ16U", "西藏自治区/阿里地区/普兰县", "西藏/阿里/普兰", "Pulan", 30.300000, 81.170000},
-    {"TV8EPFU86C2D", "西藏自治区/阿里地区/札达县", "西藏/阿里/札达", "Zhada", 31.480000, 79.800000},
-    {"TVBBYSRN1R0G", "西藏自治区/阿里地区/噶尔县", "西藏/阿里/噶尔", "Gaer", 32.500000, 80.100000},
-    {"TVBTYHDKDEH2", "西藏自治区/阿里地区/日土县", "西藏/阿里/日土", "Ritu", 33.380000, 79.720000},
-    {"TVC8MFJZ9JB0", "西藏自治区/阿里地区/革吉县", "西藏/阿里/革吉", "Geji", 32.400000, 81.120000},
-    {"TVEZC01CHURT", "西藏自治区/阿里地区/改则县", "西藏/阿里/改则", "Gaize", 32.300000, 84.070000},
-    {"TVS86P4BSG4G", "西藏自治区/阿里地区/措勤县", "西藏/阿里/措勤", "Cuoqin", 31.020000, 85.170000},
-    {"WQJ6YY8MHZP0", "陕西省/西安市", "陕西/西安/西安", "Xian", 34.270000, 108.930000},
-    {"WQJ6ZQ76D36J", "陕西省/西安市/新城区", "陕西/西安/新城", "Xincheng", 34.268167, 108.955979},
-    {"WQJ6YUKZ3YZQ", "陕西省/西安市/碑林区", "陕西/西安/碑林", "Beilin", 34.258026, 108.936052},
-    {"WQJ6YVZPX158", "陕西省/西安市/莲湖区", "陕西/西安/莲湖", "Lianhu", 34.266277, 108.939362},
-    {"WQJDCY2TU0U9", "陕西省/西安市/灞桥区", "陕西/西安/灞桥", "Baqiao", 34.268722, 109.062144},
-    {"WQJ7P51HQNTN", "陕西省/西安市/未央区", "陕西/西安/未央", "Weiyang", 34.294589, 108.942067},
-    {"WQJ6WSDSFJ3E", "陕西省/西安市/雁塔区", "陕西/西安/雁塔", "Yanta", 34.215017, 108.921978},
-    {"WQJTJQM8RHQG", "陕西省/西安市/阎良区", "陕西/西安/阎良", "Yanliang", 34.663305, 109.222950},
-    {"WQJET2GEF2QS", "陕西省/西安市/临潼区", "陕西/西安/临潼", "Lintong", 34.370000, 109.220000},
-    {"WQJ6QU2QSVXJ", "陕西省/西安市/长安区", "陕西/西安/长安", "Changan", 34.170000, 108.930000},
-    {"WQJS6JVXU4X1", "陕西省/西安市/高陵区", "陕西/西安/高陵", "Gaoling", 34.530000, 109.080000},
-    {"WQJ1ZR8NGKTP", "陕西省/西安市/鄠邑区", "陕西/西安/鄠邑", "Huxian", 34.100000, 108.600000},
-    {"WQJDR8U6HTKH", "陕西省/西安市/蓝田县", "陕西/西安/蓝田", "Lantian", 34.150000, 109.320000},
-    {"WQHFQHKYDTXT", "陕西省/西安市/周至县", "陕西/西安/周至", "Zhouzhi", 34.170000, 108.200000},
-    {"WQJQWC27HZX1", "陕西省/铜川市", "陕西/铜川/铜川", "Tongchuan", 34.900000, 108.930000},
-    {"WQJX9BNWGGSM", "陕西省/铜川市/王益区", "陕西/铜川/王益", "Wangyi", 35.069538, 109.070372},
-    {"WQJXF82REX68", "陕西省/铜川市/印台区", "陕西/铜川/印台", "Yintai", 35.115004, 109.094735},
-    {"WQJQXUUZDPCC", "陕西省/铜川市/耀州区", "陕西/铜川/耀州", "Yaozhou", 34.920000, 108.980000},
-    {"WQM97H6GBQ33", "陕西省/铜川市/宜君县", "陕西/铜川/宜君", "Yijun", 35.400000, 109.120000},
-    {"WQH5TBCEVBMU", "陕西省/宝鸡市", "陕西/宝鸡/宝鸡", "Baoji", 34.370000, 107.130000},
-    {"WQH5W1KDPKXE", "陕西省/宝鸡市/渭滨区", "陕西/宝鸡/渭滨", "Weibin", 34.372469, 107.145173},
-    {"WQH5W44QT9Y2", "陕西省/宝鸡市/金台区", "陕西/宝鸡/金台", "Jintai", 34.377346, 107.142006},
-    {"WQH7E2B7Y26U", "陕西省/宝鸡市/陈仓区", "陕西/宝鸡/陈仓", "Chencang", 34.370000, 107.370000},
-    {"WQHK7KPTX67K", "陕西省/宝鸡市/凤翔县", "陕西/宝鸡/凤翔", "Fengxiang", 34.520000, 107.380000},
-    {"WQHEBZQMZC2Q", "陕西省/宝鸡市/岐山县", "陕西/宝鸡/岐山", "Qishan", 34.450000, 107.620000},
-    {"WQHEW8UEC0MU", "陕西省/宝鸡市/扶风县", "陕西/宝鸡/扶风", "Fufeng", 34.370000, 107.870000},
-    {"WQHE5BMPKZPM", "陕西省/宝鸡市/眉县", "陕西/宝鸡/眉县", "Meixian", 34.280000, 107.750000},
-    {"WQ5YX3MG1RW9", "陕西省/宝鸡市/陇县", "陕西/宝鸡/陇县", "Longxian", 34.900000, 106.850000},
-    {"WQHJJGCDVUJV", "陕西省/宝鸡市/千阳县", "陕西/宝鸡/千阳", "Qianyang", 34.650000, 107.130000},
-    {"WQHTK9718H8F", "陕西省/宝鸡市/麟游县", "陕西/宝鸡/麟游", "Linyou", 34.680000, 107.780000},
-    {"WQ58ZYVQRFKC", "陕西省/宝鸡市/凤县", "陕西/宝鸡/凤县", "Fengxian", 33.920000, 106.520000},
-    {"WQH3F4K01K24", "陕西省/宝鸡市/太白县", "陕西/宝鸡/太白", "Taibai", 34.070000, 107.320000},
-    {"WQJ7398FTXFD", "陕西省/咸阳市", "陕西/咸阳/咸阳", "Xianyang", 34.330000, 108.700000},
-    {"WQJ739F0DUXQ", "陕西省/咸阳市/秦都区", "陕西/咸阳/秦都", "Qindou", 34.331013, 108.701605},
-    {"WQHFGRM2FMCW", "陕西省/咸阳市/杨陵区", "陕西/咸阳/杨陵", "Yangling", 34.273385, 108.079818},
-    {"WQJ76R8T4XW1", "陕西省/咸阳市/渭城区", "陕西/咸阳/渭城", "Weicheng", 34.363387, 108.732492},
-    {"WQJKYY2KHGZ0", "陕西省/咸阳市/三原县", "陕西/咸阳/三原", "Sanyuan", 34.620000, 108.930000},
-    {"WQJKKMZXFF99", "陕西省/咸阳市/泾阳县", "陕西/咸阳/泾阳", "Jingyang", 34.530000, 108.830000},
-    {"WQHUQVFXVF91", "陕西省/咸阳市/乾县", "陕西/咸阳/乾县", "Qianxian", 34.530000, 108.230000},
-    {"WQJH5HVH91G7", "陕西省/咸阳市/礼泉县", "陕西/咸阳/礼泉", "Liquan", 34.480000, 108.420000},
-    {"WQHVKSCY5SGF", "陕西省/咸阳市/永寿县", "陕西/咸阳/永寿", "Yongshou", 34.700000, 108.130000},
-    {"WQK8HXGNB58F", "陕西省/咸阳市/长武县", "陕西/咸阳/长武", "Changwu", 35.200000, 107.780000},
-    {"WQJPC17KZFW8", "陕西省/咸阳市/旬邑县", "陕西/咸阳/旬邑", "Xunyi", 35.120000, 108.330000},
-    {"WQJJYG981MUJ", "陕西省/咸阳市/淳化县", "陕西/咸阳/淳化", "Chunhua", 34.780000, 108.580000},
-    {"WQHFYNSV4XP8", "陕西省/咸阳市/武功县", "陕西/咸阳/武功", "Wugong", 34.270000, 108.200000},
-    {"WQJ5HS0EZPQT", "陕西省/咸阳市/兴平市", "陕西/咸阳/兴平", "Xingping", 34.300000, 108.480000},
-    {"WQHZ73J2W931", "陕西省/咸阳市/彬州市", "陕西/咸阳/彬州", "Binxian", 35.030000, 108.080000},
-    {"WQJU78X3NFJU", "陕西省/渭南市", "陕西/渭南/渭南", "Weinan", 34.500000, 109.500000},
-    {"WQJU72QMUR28", "陕西省/渭南市/临渭区", "陕西/渭南/临渭", "Linwei", 34.499470, 109.487526},
-    {"WQNH3UHJD6KK", "陕西省/渭南市/华州区", "陕西/渭南/华州", "Huaxian", 34.520000, 109.770000},
-    {"WQNKS3EH34V3", "陕西省/渭南市/潼关县", "陕西/渭南/潼关", "Tongguan", 34.550000, 110.230000},
-    {"WQNJVX0SDWJJ", "陕西省/渭南市/大荔县", "陕西/渭南/大荔", "Dali", 34.800000, 109.930000},
-    {"WQQ26T2V95BZ", "陕西省/渭南市/合阳县", "陕西/渭南/合阳", "Heyang", 35.230000, 110.150000},
-    {"WQQ0JS2D6EM4", "陕西省/渭南市/澄城县", "陕西/渭南/澄城", "Chengcheng", 35.180000, 109.930000},
-    {"WQJYVD3WX04N", "陕西省/渭南市/蒲城县", "陕西/渭南/蒲城", "Pucheng", 34.950000, 109.580000},
-    {"WQMBJS3DR564", "陕西省/渭南市/白水县", "陕西/渭南/白水", "Baishui", 35.180000, 109.580000},
-    {"WQJTSQN3QMS8", "陕西省/渭南市/富平县", "陕西/渭南/富平", "Fuping", 34.750000, 109.180000},
-    {"WQQ9BFUTVX25", "陕西省/渭南市/韩城市", "陕西/渭南/韩城", "Hancheng", 35.480000, 110.430000},
-    {"WQNK8VMBCGJ4", "陕西省/渭南市/华阴市", "陕西/渭南/华阴", "Huayin", 34.570000, 110.080000},
-    {"WQTB5QBFKYSB", "陕西省/延安市", "陕西/延安/延安", "Yanan", 36.600000, 109.480000},
-    {"WQTB5MNX09S1", "陕西省/延安市/宝塔区", "陕西/延安/宝塔", "Baota", 36.591176, 109.487713},
-    {"WQT9XXURKDHH", "陕西省/延安市/安塞区", "陕西/延安/安塞", "Ansai", 36.870000, 109.320000},
-    {"WQW0P55TCY0Z", "陕西省/延安市/延长县", "陕西/延安/延长", "Yanchang", 36.580000, 110.000000},
-    {"WQW3G1Y9S469", "陕西省/延安市/延川县", "陕西/延安/延川", "Yanchuan", 36.880000, 110.180000},
-    {"WQTGPX73BJXJ", "陕西省/延安市/子长县", "陕西/延安/子长", "Zichang", 37.130000, 109.670000},
-    {"WQT37NGUH9QR", "陕西省/延安市/志丹县", "陕西/延安/志丹", "Zhidan", 36.820000, 108.770000},
-    {"WQSFKHBQGXQK", "陕西省/延安市/吴起县", "陕西/延安/吴起", "Wuqi", 36.985299, 108.105971},
-    {"WQMY2KD4RDJV", "陕西省/延安市/甘泉县", "陕西/延安/甘泉", "Ganquan", 36.280000, 109.350000},
-    {"WQMU8VBY9WNU", "陕西省/延安市/富县", "陕西/延安/富县", "Fuxian", 35.980000, 109.370000},
-    {"WQMG6PSRRG61", "陕西省/延安市/洛川县", "陕西/延安/洛川", "Luochuan", 35.770000, 109.430000},
-    {"WQQM4FXQ7P44", "陕西省/延安市/宜川县", "陕西/延安/宜川", "Yichuan", 36.050000, 110.170000},
-    {"WQQ47JPU82XX", "陕西省/延安市/黄龙县", "陕西/延安/黄龙", "Huanglong", 35.580000, 109.830000},
-    {"WQMDQJ1KT88R", "陕西省/延安市/黄陵县", "陕西/延安/黄陵", "Huangling", 35.580000, 109.250000},
-    {"WMUH5K1WDWZC", "陕西省/汉中市", "陕西/汉中/汉中", "Hanzhong", 33.070000, 107.020000},
-    {"WMUH5KNUSFE5", "陕西省/汉中市/汉台区", "陕西/汉中/汉台", "Hantai", 33.069634, 107.027300},
-    {"WMU59R2NCTFG", "陕西省/汉中市/南郑区", "陕西/汉中/南郑", "Nanzheng", 33.000000, 106.930000},
-    {"WMUKD6G2DRBS", "陕西省/汉中市/城固县", "陕西/汉中/城固", "Chenggu", 33.150000, 107.330000},
-    {"WMUKZRE888U6", "陕西省/汉中市/洋县", "陕西/汉中/洋县", "Yangxian", 33.220000, 107.550000},
-    {"WMUES7GDRJ87", "陕西省/汉中市/西乡县", "陕西/汉中/西乡", "Xixiang", 32.980000, 107.770000},
-    {"WMGUE6F8XPUU", "陕西省/汉中市/勉县", "陕西/汉中/勉县", "Mianxian", 33.150000, 106.670000},
-    {"WMGDCB8BS7W4", "陕西省/汉中市/宁强县", "陕西/汉中/宁强", "Ningqiang", 32.830000, 106.250000},
-    {"WMGMXE81662F", "陕西省/汉中市/略阳县", "陕西/汉中/略阳", "Lueyang", 33.330000, 106.150000},
-    {"WMU9P3FKUPX2", "陕西省/汉中市/镇巴县", "陕西/汉中/镇巴", "Zhenba", 32.530000, 107.900000},
-    {"WMUP302F8W4R", "陕西省/汉中市/留坝县", "陕西/汉中/留坝", "Liuba", 33.620000, 106.920000},
-    {"WMUY9PUWKM58", "陕西省/汉中市/佛坪县", "陕西/汉中/佛坪", "Fuoping", 33.530000, 107.980000},
-    {"WQY1BBWVNM4Q", "陕西省/榆林市", "陕西/榆林/榆林", "Yulin", 38.280000, 109.730000},
-    {"WQY1C2TT0M5Q", "陕西省/榆林市/榆阳区", "陕西/榆林/榆阳", "Yuyang", 38.280000, 109.750000},
-    {"WQTXYSX6B89Z", "陕西省/榆林市/横山区", "陕西/榆林/横山", "Hengshan", 37.950000, 109.280000},
-    {"WQYYP3NWNX6D", "陕西省/榆林市/府谷县", "陕西/榆林/府谷", "Fugu", 39.030000, 111.070000},
-    {"WQTMGUCEZU00", "陕西省/榆林市/靖边县", "陕西/榆林/靖边", "Jingbian", 37.600000, 108.800000},
-    {"WQSTB3PZMEXP", "陕西省/榆林市/定边县", "陕西/榆林/定边", "Dingbian", 37.580000, 107.600000},
-    {"WQWMKF9T74WM", "陕西省/榆林市/绥德县", "陕西/榆林/绥德", "Suide", 37.500000, 110.250000},
-    {"WQWQG0NTSN49", "陕西省/榆林市/米脂县", "陕西/榆林/米脂", "Mizhi", 37.750000, 110.180000},
-    {"WQY86134D9DY", "陕西省/榆林市/佳县", "陕西/榆林/佳县", "Jiaxian", 38.020000, 110.480000},
-    {"WQWTP9X4H1BR", "陕西省/榆林市/吴堡县", "陕西/榆林/吴堡", "Wubu", 37.450000, 110.730000},
-    {"WQW6CY4YTUZR", "陕西省/榆林市/清涧县", "陕西/榆林/清涧", "Qingjian", 37.080000, 110.120000},
-    {"WQWNPB92KU69", "陕西省/榆林市/子洲县", "陕西/榆林/子洲", "Zizhou", 37.620000, 110.030000},
-    {"WQYSFKZ9HSEU", "陕西省/榆林市/神木市", "陕西/榆林/神木", "Shenmu", 38.830000, 110.500000},
-    {"WMV9BV1YY1EC", "陕西省/安康市", "陕西/安康/安康", "Ankang", 32.680000, 109.020000},
-    {"WMVD0B77K0R2", "陕西省/安康市/汉滨区", "陕西/安康/汉滨", "Hanbin", 32.697245, 109.021979},
-    {"WMV5HVR23HXB", "陕西省/安康市/汉阴县", "陕西/安康/汉阴", "Hanyin", 32.900000, 108.500000},
-    {"WMUUP294PYD3", "陕西省/安康市/石泉县", "陕西/安康/石泉", "Shiquan", 33.050000, 108.250000},
-    {"WMVJ8CSPNFNN", "陕西省/安康市/宁陕县", "陕西/安康/宁陕", "Ningshan", 33.320000, 108.320000},
-    {"WMV1J8J4SR3K", "陕西省/安康市/紫阳县", "陕西/安康/紫阳", "Ziyang", 32.520000, 108.530000},
-    {"WMTRY5DT9UTM", "陕西省/安康市/岚皋县", "陕西/安康/岚皋", "Langao", 32.320000, 108.900000},
-    {"WMVB264PXTVB", "陕西省/安康市/平利县", "陕西/安康/平利", "Pingli", 32.400000, 109.350000},
-    {"WMTVK5W42YWZ", "陕西省/安康市/镇坪县", "陕西/安康/镇坪", "Zhenping", 31.880000, 109.520000},
-    {"WMVFC080DEX6", "陕西省/安康市/旬阳县", "陕西/安康/旬阳", "Xunyang", 32.830000, 109.380000},
-    {"WMY69QSQ7GQM", "陕西省/安康市/白河县", "陕西/安康/白河", "Baihe", 32.820000, 110.100000},
-    {"WQN0TV21C6RY", "陕西省/商洛市", "陕西/商洛/商洛", "Shangluo", 33.867043, 109.940250},
-    {"WQN0TTBE49T5", "陕西省/商洛市/商州区", "陕西/商洛/商州", "Shangzhou", 33.870000, 109.930000},
-    {"WQN3FH44QURY", "陕西省/商洛市/洛南县", "陕西/商洛/洛南", "Luonan", 34.080000, 110.130000},
-    {"WMYRWWGUER6D", "陕西省/商洛市/丹凤县", "陕西/商洛/丹凤", "Danfeng", 33.700000, 110.330000},
-    {"WMYYEPUQ7M02", "陕西省/商洛市/商南县", "陕西/商洛/商南", "Shangnan", 33.530000, 110.880000},
-    {"WMYNSRUNMT42", "陕西省/商洛市/山阳县", "陕西/商洛/山阳", "Shanyang", 33.530000, 109.880000},
-    {"WMVW5V8XG7DV", "陕西省/商洛市/镇安县", "陕西/商洛/镇安", "Zhenan", 33.430000, 109.150000},
-    {"WMVXDEK0NR01", "陕西省/商洛市/柞水县", "陕西/商洛/柞水", "Zhashui", 33.680000, 109.100000},
-    {"WQ3V4QR6VR6G", "甘肃省/兰州市", "甘肃/兰州/兰州", "Lanzhou", 36.070000, 103.820000},
-    {"WQ3V4S13X6PJ", "甘肃省/兰州市/城关区", "甘肃/兰州/城关", "Chengguan", 36.057398, 103.822838},
-    {"WQ3V1TSRUYEZ", "甘肃省/兰州市/七里河区", "甘肃/兰州/七里河", "Qilihe", 36.066735, 103.782901},
-    {"WQ3TMGVY4T5S", "甘肃省/兰州市/西固区", "甘肃/兰州/西固", "Xigu", 36.100759, 103.620069},
-    {"WQ3V2HRWPPME", "甘肃省/兰州市/安宁区", "甘肃/兰州/安宁", "Anning", 36.103517, 103.721545},
-    {"WQ3NU8K6H92P", "甘肃省/兰州市/红古区", "甘肃/兰州/红古", "Honggu", 36.344498, 102.860034},
-    {"WQ92VYQZV2M0", "甘肃省/兰州市/永登县", "甘肃/兰州/永登", "Yongdeng", 36.730000, 103.270000},
-    {"WQ3YTMWJDDCG", "甘肃省/兰州市/皋兰县", "甘肃/兰州/皋兰", "Gaolan", 36.330000, 103.950000},
-    {"WQ65CQ3C7U75", "甘肃省/兰州市/榆中县", "甘肃/兰州/榆中", "Yuzhong", 35.850000, 104.120000},
-    {"WPJFKJQ5BCWZ", "甘肃省/嘉峪关市", "甘肃/嘉峪关/嘉峪关", "Jiayuguan", 39.800000, 98.270000},
-    {"WQBEJ0TNY84M", "甘肃省/金昌市", "甘肃/金昌/金昌", "Jinchang", 38.500000, 102.180000},
-    {"WQBEJKQP0G5C", "甘肃省/金昌市/金川区", "甘肃/金昌/金川", "Jinchuan", 38.520658, 102.192115},
-    {"WQB987HQ3HYC", "甘肃省/金昌市/永昌县", "甘肃/金昌/永昌", "Yongchang", 38.250000, 101.970000},
-    {"WQ6PFTTX1VY6", "甘肃省/白银市", "甘肃/白银", "Baiyin", 36.550000, 104.180000},
-    {"WQ6PFTTX1VY6", "甘肃省/白银市/白银区", "甘肃/白银/白银", "Baiyin", 36.550000, 104.180000},
-    {"WQD8CQQZU032", "甘肃省/白银市/平川区", "甘肃/白银/平川", "Pingchuan", 36.730000, 104.830000},
-    {"WQD2N13ESY17", "甘肃省/白银市/靖远县", "甘肃/白银/靖远", "Jingyuan", 36.570000, 104.680000},
-    {"WQ6EN6ZPD6M7", "甘肃省/白银市/会宁县", "甘肃/白银/会宁", "Huining", 35.700000, 105.050000},
-    {"WQD524VQQVBQ", "甘肃省/白银市/景泰县", "甘肃/白银/景泰", "Jingtai", 37.150000, 104.070000},
-    {"WQ5HTXNGNE1W", "甘肃省/天水市", "甘肃/天水/天水", "Tianshui", 34.580000, 105.720000},
-    {"WQ5HTXRPUXMC", "甘肃省/天水市/秦州区", "甘肃/天水/秦州", "Qinzhou", 34.582211, 105.720263},
-    {"WQ5KJ8PFPH4X", "甘肃省/天水市/麦积区", "甘肃/天水/麦积", "Maiji", 34.453491, 106.072958},
-    {"WQ5MXN192JX8", "甘肃省/天水市/清水县", "甘肃/天水/清水", "Qingshui", 34.750000, 106.130000},
-    {"WQ5NKEFS3RNU", "甘肃省/天水市/秦安县", "甘肃/天水/秦安", "Qinan", 34.870000, 105.670000},
-    {"WQ4VSF6UYVHX", "甘肃省/天水市/甘谷县", "甘肃/天水/甘谷", "Gangu", 34.730000, 105.330000},
-    {"WQ4TD8E69JH5", "甘肃省/天水市/武山县", "甘肃/天水/武山", "Wushan", 34.720000, 104.880000},
-    {"WQ5X15E1C2US", "甘肃省/天水市/张家川回族自治县", "甘肃/天水/张家川", "Zhangjiachuan", 35.000000, 106.220000},
-    {"WQ8ZZ2UYK26X", "甘肃省/武威市", "甘肃/武威/武威", "Wuwei", 37.930000, 102.630000},
-    {"WQ8ZZ8SD0P07", "甘肃省/武威市/凉州区", "甘肃/武威/凉州", "Liangzhou", 37.927933, 102.640457},
-    {"WQC79WS9F1FC", "甘肃省/武威市/民勤县", "甘肃/武威/民勤", "Minqin", 38.620000, 103.080000},
-    {"WQ9JJJ4YTF20", "甘肃省/武威市/古浪县", "甘肃/武威/古浪", "Gulang", 37.470000, 102.880000},
-    {"WQ966U0BP5TS", "甘肃省/武威市/天祝藏族自治县", "甘肃/武威/天祝", "Tianzhu", 36.980000, 103.130000},
-    {"WNZMMYCRWTUZ", "甘肃省/张掖市", "甘肃/张掖/张掖", "Zhangye", 38.930000, 100.450000},
-    {"WNZMQQUDYXMD", "甘肃省/张掖市/甘州区", "甘肃/张掖/甘州", "Ganzhou", 38.929192, 100.476437},
-    {"WNYUFUV14HXU", "甘肃省/张掖市/肃南裕固族自治县", "甘肃/张掖/肃南", "Sunan", 38.830000, 99.620000},
-    {"WNZDW5YYUR0Z", "甘肃省/张掖市/民乐县", "甘肃/张掖/民乐", "Minle", 38.430000, 100.820000},
-    {"WNZNX7MSF0TW", "甘肃省/张掖市/临泽县", "甘肃/张掖/临泽", "Linze", 39.130000, 100.170000},
-    {"WPNBP2YTNS4D", "甘肃省/张掖市/高台县", "甘肃/张掖/高台", "Gaotai", 39.380000, 99.820000},
-    {"WNZUS5SJYEYY", "甘肃省/张掖市/山丹县", "甘肃/张掖/山丹", "Shandan", 38.780000, 101.080000},
-    {"WQ7F5V8HRBZU", "甘肃省/平凉市", "甘肃/平凉/平凉", "Pingliang", 35.538759, 106.688576},
-    {"WQ7F5RDTZ0KF", "甘肃省/平凉市/崆峒区", "甘肃/平凉/崆峒", "Kongtong", 35.550000, 106.670000},
-    {"WQK2GR8KNM6G", "甘肃省/平凉市/泾川县", "甘肃/平凉/泾川", "Jingchuan", 35.330000, 107.370000},
-    {"WQHX8BQ3XCB6", "甘肃省/平凉市/灵台县", "甘肃/平凉/灵台", "Lingtai", 35.070000, 107.620000},
-    {"WQK0GD0V7UBQ", "甘肃省/平凉市/崇信县", "甘肃/平凉/崇信", "Chongxin", 35.300000, 107.030000},
-    {"WQ72JPZQB5E6", "甘肃省/平凉市/庄浪县", "甘肃/平凉/庄浪", "Zhuanglang", 35.200000, 106.050000},
-    {"WQ74JDNYYXCT", "甘肃省/平凉市/静宁县", "甘肃/平凉/静宁", "Jingning", 35.520000, 105.720000},
-    {"WQ7B6GS5M5GG", "甘肃省/平凉市/华亭市", "甘肃/平凉/华亭", "Huating", 35.220000, 106.650000},
-    {"WPN41UK0D3H6", "甘肃省/酒泉市", "甘肃/酒泉/酒泉", "Jiuquan", 39.750000, 98.520000},
-    {"WPN41E4Z384M", "甘肃省/酒泉市/肃州区", "甘肃/酒泉/肃州", "Suzhou", 39.744287, 98.507262},
-    {"WPN76W0U3H0V", "甘肃省/酒泉市/金塔县", "甘肃/酒泉/金塔", "Jinta", 39.980000, 98.900000},
-    {"WPK0M8YWC8WC", "甘肃省/酒泉市/瓜州县", "甘肃/酒泉/瓜州", "Guazhou", 40.830477, 95.875699},
-    {"WP52Z43S8JZW", "甘肃省/酒泉市/肃北蒙古族自治县", "甘肃/酒泉/肃北", "Subei", 39.520000, 94.880000},
-    {"WP516W3J2R6N", "甘肃省/酒泉市/阿克塞哈萨克族自治县", "甘肃/酒泉/阿克塞", "Akesai", 39.630000, 94.330000},
-    {"WPJJ0KV8HBJP", "甘肃省/酒泉市/玉门市", "甘肃/酒泉/玉门", "Yumen", 40.280000, 97.050000},
-    {"WP5K632W4YHQ", "甘肃省/酒泉市/敦煌市", "甘肃/酒泉/敦煌", "Dunhuang", 40.130000, 94.670000},
-    {"WQKE38EK0NBP", "甘肃省/庆阳市", "甘肃/庆阳/庆阳", "Qingyang", 35.731010, 107.648506},
-    {"WQKE30MY2FBB", "甘肃省/庆阳市/西峰区", "甘肃/庆阳/西峰", "Xifeng", 35.730000, 107.630000},
-    {"WQKSYCEG4NQK", "甘肃省/庆阳市/庆城县", "甘肃/庆阳/庆城", "Qingcheng", 36.000000, 107.880000},
-    {"WQS21EJMZNNZ", "甘肃省/庆阳市/环县", "甘肃/庆阳/环县", "Huanxian", 36.580000, 107.300000},
-    {"WQKZ3PHTHKG8", "甘肃省/庆阳市/华池县", "甘肃/庆阳/华池", "Huachi", 36.470000, 107.980000},
-    {"WQKGF0CF87VY", "甘肃省/庆阳市/合水县", "甘肃/庆阳/合水", "Heshui", 35.820000, 108.020000},
-    {"WQM1FN8DKP8U", "甘肃省/庆阳市/正宁县", "甘肃/庆阳/正宁", "Zhengning", 35.500000, 108.370000},
-    {"WQK9ZY8FQR8K", "甘肃省/庆阳市/宁县", "甘肃/庆阳/宁县", "Ningxian", 35.500000, 107.920000},
-    {"WQK4ZRKEJ41D", "甘肃省/庆阳市/镇原县", "甘肃/庆阳/镇原", "Zhenyuan", 35.680000, 107.200000},
-    {"WQ66KU06BHB1", "甘肃省/定西市", "甘肃/定西/定西", "Dingxi", 35.574228, 104.623146},
-    {"WQ66KTJUW8WP", "甘肃省/定西市/安定区", "甘肃/定西/安定", "Anding", 35.580000, 104.620000},
-    {"WQ6B5PBWYG84", "甘肃省/定西市/通渭县", "甘肃/定西/通渭", "Tongwei", 35.200000, 105.250000},
-    {"WQ4RHGT1Z8YS", "甘肃省/定西市/陇西县", "甘肃/定西/陇西", "Longxi", 35.000000, 104.630000},
-    {"WQ4PGE4XN48S", "甘肃省/定西市/渭源县", "甘肃/定西/渭源", "Weiyuan", 35.130000, 104.220000},
-    {"WQ3C78EZ6QJ8", "甘肃省/定西市/临洮县", "甘肃/定西/临洮", "Lintao", 35.380000, 103.870000},
-    {"WQ4Q320XZQY5", "甘肃省/定西市/漳县", "甘肃/定西/漳县", "Zhangxian", 34.850000, 104.470000},
-    {"WQ1GZ7B369NN", "甘肃省/定西市/岷县", "甘肃/定西/岷县", "Minxian", 34.430000, 104.030000},
-    {"WMFTU75WU2CG", "甘肃省/陇南市", "甘肃/甘肃/陇南", "Longnan", 33.372135, 104.957384},
-    {"WMFW5823J5Q2", "甘肃省/陇南市/武都区", "甘肃/陇南/武都", "Wudu", 33.400000, 104.920000},
-    {"WMGPVSQGQX9X", "甘肃省/陇南市/成县", "甘肃/陇南/成县", "Chengxian", 33.730000, 105.720000},
-    {"WMF7QN3ESV1Q", "甘肃省/陇南市/文县", "甘肃/陇南/文县", "Wenxian", 32.950000, 104.680000},
-    {"WQ41XNX5WK11", "甘肃省/陇南市/宕昌县", "甘肃/陇南/宕昌", "Dangchang", 34.050000, 104.380000},
-    {"WMGJDGX96674", "甘肃省/陇南市/康县", "甘肃/陇南/康县", "Kangxian", 33.330000, 105.600000},
-    {"WQ4CS1JHGGDU", "甘肃省/陇南市/西和县", "甘肃/陇南/西和", "Xihe", 34.020000, 105.300000},
-    {"WQ4F3NQ2YTGC", "甘肃省/陇南市/礼县", "甘肃/陇南/礼县", "Lixian", 34.180000, 105.170000},
-    {"WQ52JGTHE0M0", "甘肃省/陇南市/徽县", "甘肃/陇南/徽县", "Huixian", 33.770000, 106.080000},
-    {"WQ58FYVQ3D2C", "甘肃省/陇南市/两当县", "甘肃/陇南/两当", "Liangdang", 33.920000, 106.300000},
-    {"WQ36SBF902FR", "甘肃省/临夏回族自治州", "甘肃/临夏", "Linxia", 35.600000, 103.220000},
-    {"WQ36SBF902FR", "甘肃省/临夏回族自治州/临夏县", "甘肃/临夏/临夏", "Linxia", 35.600000, 103.220000},
-    {"WQ3C0NYT5JVK", "甘肃省/临夏回族自治州/康乐县", "甘肃/临夏/康乐", "Kangle", 35.370000, 103.720000},
-    {"WQ3KRHG76MRY", "甘肃省/临夏回族自治州/永靖县", "甘肃/临夏/永靖", "Yongjing", 35.930000, 103.320000},
-    {"WQ39V4BTUZMG", "甘肃省/临夏回族自治州/广河县", "甘肃/临夏/广河", "Guanghe", 35.480000, 103.580000},
-    {"WQ33XCC4TW9Q", "甘肃省/临夏回族自治州/和政县", "甘肃/临夏/和政", "Hezheng", 35.430000, 103.350000},
-    {"WQ3DBVT8F9UN", "甘肃省/临夏回族自治州/东乡族自治县", "甘肃/临夏/东乡", "Dongxiang", 35.670000, 103.400000},
-    {"WQ35K6M0DDYK", "甘肃省/临夏回族自治州/积石山保安族东乡族撒拉族自治县", "甘肃/临夏/积石山", "Jishishan", 35.740000, 102.850000},
-    {"WQ1PJB8R8EFB", "甘肃省/甘南藏族自治州", "甘肃/甘肃/甘南", "Gannan", 34.984523, 102.909304},
-    {"WQ1NYPBJ3BD7", "甘肃省/甘南藏族自治州/合作市", "甘肃/甘南/合作", "Hezuo", 34.980000, 102.920000},
-    {"WQ1MRUCNJSC6", "甘肃省/甘南藏族自治州/临潭县", "甘肃/甘南/临潭", "Lintan", 34.700000, 103.350000},
-    {"WQ1SEPN7HG1W", "甘肃省/甘南藏族自治州/卓尼县", "甘肃/甘南/卓尼", "Zhuoni", 34.580000, 103.500000},
-    {"WQ40NVRYV22S", "甘肃省/甘南藏族自治州/舟曲县", "甘肃/甘南/舟曲", "Zhouqu", 33.780000, 104.370000},
-    {"WQ13SYDE8K43", "甘肃省/甘南藏族自治州/迭部县", "甘肃/甘南/迭部", "Diebu", 34.050000, 103.220000},
-    {"WQ096TT077KK", "甘肃省/甘南藏族自治州/玛曲县", "甘肃/甘南/玛曲", "Maqu", 34.000000, 102.070000},
-    {"WQ0UEZPEJ54Q", "甘肃省/甘南藏族自治州/碌曲县", "甘肃/甘南/碌曲", "Luqu", 34.580000, 102.480000},
-    {"WQ2BHZUYC5SD", "甘肃省/甘南藏族自治州/夏河县", "甘肃/甘南/夏河", "Xiahe", 35.200000, 102.520000},
-    {"WQ82K43YVYU8", "青海省/西宁市", "青海/西宁/西宁", "Xining", 36.620000, 101.780000},
-    {"WQ82HWCF35QF", "青海省/西宁市/城东区", "青海/西宁/城东", "Chengdong", 36.599983, 101.801772},
-    {"WQ2RFKFNPJ35", "青海省/西宁市/城中区", "青海/西宁/城中", "Chengzhong", 36.545706, 101.703488},
-    {"WQ827EYPSNYH", "青海省/西宁市/城西区", "青海/西宁/城西", "Chengxi", 36.628369, 101.763791},
-    {"WQ827XYMV34P", "青海省/西宁市/城北区", "青海/西宁/城北", "Chengbei", 36.650011, 101.764183},
-    {"WQ861FCHGDZN", "青海省/西宁市/大通回族土族自治县", "青海/西宁/大通", "Datong", 36.930000, 101.680000},
-    {"WQ2PXK95BT1K", "青海省/西宁市/湟中县", "青海/西宁/湟中", "Huangzhong", 36.500000, 101.570000},
-    {"WQ808MQS6P94", "青海省/西宁市/湟源县", "青海/西宁/湟源", "Huangyuan", 36.680000, 101.270000},
-    {"WQ2Y3RYEE7DY", "青海省/海东市", "青海/海东/海东", "Haidong", 36.298076, 102.368689},
-    {"WQ2ZD0VRKUYH", "青海省/海东市/乐都区", "青海/海东/乐都", "Ledu", 36.480000, 102.400000},
-    {"WQ2XEU9EBMPH", "青海省/海东市/平安区", "青海/海东/平安", "Pingan", 36.500000, 102.120000},
-    {"WQ3NEM8TTDGG", "青海省/海东市/民和回族土族自治县", "青海/海东/民和", "Minhe", 36.330000, 102.800000},
-    {"WQ83XBTWR1TG", "青海省/海东市/互助土族自治县", "青海/海东/互助", "Huzhu", 36.830000, 101.950000},
-    {"WQ2TR5Y9XXZ0", "青海省/海东市/化隆回族自治县", "青海/海东/化隆", "Hualong", 36.100000, 102.270000},
-    {"WQ2GGYR9MH67", "青海省/海东市/循化撒拉族自治县", "青海/海东/循化", "Xunhua", 35.850000, 102.480000},
-    {"WNXF241JU7T0", "青海省/海北藏族自治州", "青海/海北/海北", "Haibei", 36.970000, 100.900000},
-    {"WQ8K8KV6M95C", "青海省/海北藏族自治州/门源回族自治县", "青海/海北/门源", "Menyuan", 37.380000, 101.620000},
-    {"WNZ31NRYD7CG", "青海省/海北藏族自治州/祁连县", "青海/海北/祁连", "Qilian", 38.180000, 100.250000},
-    {"WNXCCV7QHD93", "青海省/海北藏族自治州/海晏县", "青海/海北/海晏", "Haiyan", 36.900000, 100.980000},
-    {"WNXHQE8RN077", "青海省/海北藏族自治州/刚察县", "青海/海北/刚察", "Gangcha", 37.330000, 100.130000},
-    {"WQ2D1TXVBJ01", "青海省/黄南藏族自治州", "青海/黄南/黄南", "Huangnan", 35.539039, 102.029686},
-    {"WQ2D1D0WYRCT", "青海省/黄南藏族自治州/同仁县", "青海/黄南/同仁", "Tongren", 35.520000, 102.020000},
-    {"WQ2S3SZGRM6N", "青海省/黄南藏族自治州/尖扎县", "青海/黄南/尖扎", "Jianzha", 35.930000, 102.030000},
-    {"WQ0PM100W37C", "青海省/黄南藏族自治州/泽库县", "青海/黄南/泽库", "Zeku", 35.030000, 101.470000},
-    {"WQ0JXFQUGT4Z", "青海省/黄南藏族自治州/河南蒙古族自治县", "青海/黄南/河南", "Henan", 34.730000, 101.600000},
-    {"WNRW6560ZURV", "青海省/海南藏族自治州", "青海/海南/海南", "Hainan", 36.272888, 100.637856},
-    {"WNRW3ST4RFJV", "青海省/海南藏族自治州/共和县", "青海/海南/共和", "Gonghe", 36.280000, 100.620000},
-    {"WNR8890F4U70", "青海省/海南藏族自治州/同德县", "青海/海南/同德", "Tongde", 35.250000, 100.570000},
-    {"WQ2JH4EN6R1D", "青海省/海南藏族自治州/贵德县", "青海/海南/贵德", "Guide", 36.050000, 101.430000},
-    {"WNR47J5HWBER", "青海省/海南藏族自治州/兴海县", "青海/海南/兴海", "Xinghai", 35.580000, 99.980000},
-    {"WNRDKT5UT0SZ", "青海省/海南藏族自治州/贵南县", "青海/海南/贵南", "Guinan", 35.580000, 100.750000},
-    {"WNPK15RJ0H84", "青海省/果洛藏族自治州", "青海/果洛/果洛", "Guoluo", 34.471861, 100.248871},
-    {"WNPK0UCK83BG", "青海省/果洛藏族自治州/玛沁县", "青海/果洛/玛沁", "Maqin", 34.480000, 100.230000},
-    {"WJZEK4TR5HGV", "青海省/果洛藏族自治州/班玛县", "青海/果洛/班玛", "Banma", 32.930000, 100.730000},
-    {"WNP1320CWDZP", "青海省/果洛藏族自治州/甘德县", "青海/果洛/甘德", "Gande", 33.970000, 99.900000},
-    {"WNNB584BJ218", "青海省/果洛藏族自治州/达日县", "青海/果洛/达日", "Dari", 33.750000, 99.650000},
-    {"WMBNJJXRZ7SM", "青海省/果洛藏族自治州/久治县", "青海/果洛/久治", "Jiuzhi", 33.430000, 101.480000},
-    {"WNJYDHURXZF1", "青海省/果洛藏族自治州/玛多县", "青海/果洛/玛多", "Madu", 34.920000, 98.180000},
-    {"WJUGXXRYCVG7", "青海省/玉树藏族自治州", "青海/玉树", "Yushu", 33.000000, 97.020000},
-    {"WJUGXXRYCVG7", "青海省/玉树藏族自治州/玉树市", "青海/玉树/玉树", "Yushu", 33.000000, 97.020000},
-    {"WJGG0T726UW2", "青海省/玉树藏族自治州/杂多县", "青海/玉树/杂多", "Zaduo", 32.900000, 95.300000},
-    {"WJVJCDF43FZE", "青海省/玉树藏族自治州/称多县", "青海/玉树/称多", "Chenduo", 33.370000, 97.100000},
-    {"WN5BXFHQE3RE", "青海省/玉树藏族自治州/治多县", "青海/玉树/治多", "Zhiduo", 33.850000, 95.620000},
-    {"WJSX5MYDDGN1", "青海省/玉树藏族自治州/囊谦县", "青海/玉树/囊谦", "Nangqian", 32.200000, 96.480000},
-    {"WNH45VPMTV1K", "青海省/玉树藏族自治州/曲麻莱县", "青海/玉树/曲麻莱", "Qumacai", 34.130000, 95.800000},
-    {"WNTHRYRP0P8J", "青海省/海西蒙古族藏族自治州", "青海/海西/海西", "Haixi", 37.345145, 97.381439},
-    {"WN7RPW01FK0F", "青海省/海西蒙古族藏族自治州/格尔木市", "青海/海西/格尔木", "Geermu", 36.420000, 94.900000},
-    {"WNTHXEN8J2YM", "青海省/海西蒙古族藏族自治州/德令哈市", "青海/海西/德令哈", "Delingha", 37.370000, 97.370000},
-    {"WN9RXN2FUH78", "青海省/海西蒙古族藏族自治州/茫崖市", "青海/海西/茫崖", "Mangai", 37.915687, 92.066636},
-    {"WNW40FYUY6FQ", "青海省/海西蒙古族藏族自治州/乌兰县", "青海/海西/乌兰", "Wulan", 36.930000, 98.480000},
-    {"WNMWXB5WVDKW", "青海省/海西蒙古族藏族自治州/都兰县", "青海省/海西/都兰", "Dulan", 36.300000, 98.080000},
-    {"WNWKJQ20JPZQ", "青海省/海西蒙古族藏族自治州/天峻县", "青海/海西/天峻", "Tianjun", 37.300000, 99.020000},
-    {"WQGDF7NXZRZB", "宁夏回族自治区/银川市", "宁夏/银川/银川", "Yinchuan", 38.470000, 106.280000},
-    {"WQGDFECDFF07", "宁夏回族自治区/银川市/兴庆区", "宁夏/银川/兴庆", "Xingqing", 38.473231, 106.283917},
-    {"WQG7P9J0MMRM", "宁夏回族自治区/银川市/西夏区", "宁夏/银川/西夏", "Xixia", 38.501659, 106.157004},
-    {"WQGDC7YKHVCU", "宁夏回族自治区/银川市/金凤区", "宁夏/银川/金凤", "Jinfeng", 38.473466, 106.235596},
-    {"WQG9CB8VHMNN", "宁夏回族自治区/银川市/永宁县", "宁夏/银川/永宁", "Yongning", 38.280000, 106.250000},
-    {"WQGEK1CDN8GE", "宁夏回族自治区/银川市/贺兰县", "宁夏/银川/贺兰", "Helan", 38.550000, 106.350000},
-    {"WQG8EXGHSDF8", "宁夏回族自治区/银川市/灵武市", "宁夏/银川/灵武", "Lingwu", 38.100000, 106.330000},
-    {"WQGTUXRECXJN", "宁夏回族自治区/石嘴山市", "宁夏/石嘴山/石嘴山", "Shizuishan", 39.020000, 106.380000},
-    {"WQGTUR539D4N", "宁夏回族自治区/石嘴山市/大武口区", "宁夏/石嘴山/大武口", "Dawukou", 39.018214, 106.363173},
-    {"WQGZMC4ZF66C", "宁夏回族自治区/石嘴山市/惠农区", "宁夏/石嘴山/惠农", "Huinong", 39.250000, 106.780000},
-    {"WQGV21SBBVT6", "宁夏回族自治区/石嘴山市/平罗县", "宁夏/石嘴山/平罗", "Pingluo", 38.900000, 106.530000},
-    {"WQG80DH3X35S", "宁夏回族自治区/吴忠市", "宁夏/吴忠/吴忠", "Wuzhong", 37.980000, 106.200000},
-    {"WQG80FD6W5XP", "宁夏回族自治区/吴忠市/利通区", "宁夏/吴忠/利通", "Litong", 37.982932, 106.208191},
-    {"WQEKVMHBDMR4", "宁夏回族自治区/吴忠市/红寺堡区", "宁夏/吴忠/红寺堡", "Hongsibao", 37.425041, 106.057655},
-    {"WQSQGVWK3QKQ", "宁夏回族自治区/吴忠市/盐池县", "宁夏/吴忠/盐池", "Yanchi", 37.780000, 107.400000},
-    {"WQE66K084GSK", "宁夏回族自治区/吴忠市/同心县", "宁夏/吴忠/同心", "Tongxin", 36.980000, 105.920000},
-    {"WQG2M9MFD1SQ", "宁夏回族自治区/吴忠市/青铜峡市", "宁夏/吴忠/青铜峡", "Qingtongxia", 38.020000, 106.070000},
-    {"WQ7SF3WEPQRU", "宁夏回族自治区/固原市", "宁夏/固原/固原", "Guyuan", 36.000000, 106.280000},
-    {"WQ7SFD33FJDT", "宁夏回族自治区/固原市/原州区", "宁夏/固原/原州", "Yuanzhou", 36.003901, 106.283544},
-    {"WQ7HTUNHRTFP", "宁夏回族自治区/固原市/西吉县", "宁夏/固原/西吉", "Xiji", 35.970000, 105.730000},
-    {"WQ76WU6JX1R0", "宁夏回族自治区/固原市/隆德县", "宁夏/固原/隆德", "Longde", 35.620000, 106.120000},
-    {"WQ79GDGJUX6E", "宁夏回族自治区/固原市/泾源县", "宁夏/固原/泾源", "Jingyuan", 35.480000, 106.330000},
-    {"WQ7GFQM97H6G", "宁夏回族自治区/固原市/彭阳县", "宁夏/固原/彭阳", "Pengyang", 35.850000, 106.630000},
-    {"WQDV3QM9ZDUM", "宁夏回族自治区/中卫市", "宁夏/中卫/中卫", "Zhongwei", 37.520000, 105.180000},
-    {"WQDV3T4WV5WP", "宁夏回族自治区/中卫市/沙坡头区", "宁夏/中卫/沙坡头", "Shapotou", 37.513996, 105.186762},
-    {"WQEJHX48C6QU", "宁夏回族自治区/中卫市/中宁县", "宁夏/中卫/中宁", "Zhongning", 37.480000, 105.670000},
-    {"WQE0H17GXQJG", "宁夏回族自治区/中卫市/海原县", "宁夏/中卫/海原", "Haiyuan", 36.570000, 105.650000},
-    {"TZY33C4YJBP3", "新疆维吾尔自治区/乌鲁木齐市", "新疆/乌鲁木齐/乌鲁木齐", "Wulumuqi", 43.820000, 87.620000},
-    {"TZY9UBXJKW3F", "新疆维吾尔自治区/乌鲁木齐市/天池", "新疆/乌鲁木齐/天池", "Tianchi", 43.905049, 88.109174},
-    {"TZY31M8B0VK0", "新疆维吾尔自治区/乌鲁木齐市/沙依巴克区", "新疆/乌鲁木齐/沙依巴克", "Shayibake", 43.799772, 87.595062},
-    {"TZY39NJQF8E4", "新疆维吾尔自治区/乌鲁木齐市/新市区", "新疆/乌鲁木齐/新市", "Xinshi", 43.891543, 87.590329},
-    {"TZY3672F74BZ", "新疆维吾尔自治区/乌鲁木齐市/水磨沟区", "新疆/乌鲁木齐/水磨沟", "Shuimogou", 43.831732, 87.639099},
-    {"TZY1T755SJTZ", "新疆维吾尔自治区/乌鲁木齐市/头屯河区", "新疆/乌鲁木齐/头屯河", "Toutunhe", 43.874533, 87.422512},
-    {"TZWY97DH51SN", "新疆维吾尔自治区/乌鲁木齐市/达坂城区", "新疆/乌鲁木齐/达坂城", "Dabancheng", 43.350000, 88.300000},
-    {"TZY656TH0C43", "新疆维吾尔自治区/乌鲁木齐市/米东区", "新疆/乌鲁木齐/米东", "Midong", 43.959738, 87.688786},
-    {"TZWRVZM42Y62", "新疆维吾尔自治区/乌鲁木齐市/乌鲁木齐县", "新疆/乌鲁木齐市/乌鲁木齐县", "Wulumuqi", 43.590050, 87.798650},
-    {"VBH77M0RQ24G", "新疆维吾尔自治区/克拉玛依市", "新疆/克拉玛依", "Dushanzi", 45.600000, 84.870000},
-    {"TZUK5TE15104", "新疆维吾尔自治区/克拉玛依市/独山子区", "新疆/克拉玛依/独山子", "Dushanzi", 44.327265, 84.884620},
-    {"VBH77M0RQ24G", "新疆维吾尔自治区/克拉玛依市/克拉玛依区", "新疆/克拉玛依/克拉玛依", "Dushanzi", 45.600000, 84.870000},
-    {"VBHECPMVBC2Y", "新疆维吾尔自治区/克拉玛依市/白碱滩区", "新疆/克拉玛依/白碱滩", "Baijiantan", 45.700000, 85.130000},
-    {"VBHYJSW72WWD", "新疆维吾尔自治区/克拉玛依市/乌尔禾区", "新疆/克拉玛依/乌尔禾", "Wuerhe", 46.080000, 85.680000},
-    {"TZXKM4G9GS71", "新疆维吾尔自治区/吐鲁番市", "新疆/吐鲁番/吐鲁番", "Tulufan", 42.950000, 89.170000},
-    {"TZXKM3JHFK87", "新疆维吾尔自治区/吐鲁番市/高昌区", "新疆/吐鲁番/高昌", "Gaochang", 42.940904, 89.182989},
-    {"WP85VH0PY75Z", "新疆维吾尔自治区/吐鲁番市/鄯善县", "新疆/吐鲁番/鄯善", "Shanshan", 42.870000, 90.220000},
-    {"TZX537BGWDP0", "新疆维吾尔自治区/吐鲁番市/托克逊县", "新疆/吐鲁番/托克逊", "Tuokexun", 42.780000, 88.650000},
-    {"WPDE8HGNVFWJ", "新疆维吾尔自治区/哈密市", "新疆/哈密/哈密", "Hami", 42.830000, 93.520000},
-    {"WPD7XUNHKNBN", "新疆维吾尔自治区/哈密市/伊州区", "新疆/哈密/伊州", "Yizhou", 42.825474, 93.513050},
-    {"WPF0H30S3J44", "新疆维吾尔自治区/哈密市/巴里坤哈萨克自治县", "新疆/哈密/巴里坤", "Balikun", 43.600000, 93.000000},
-    {"WPEQ4CQMTBQ5", "新疆维吾尔自治区/哈密市/伊吾县", "新疆/哈密/伊吾", "Yiwu", 43.250000, 94.700000},
-    {"TZY46T9GJ6Y0", "新疆维吾尔自治区/昌吉回族自治州", "新疆/昌吉", "Changji", 44.020000, 87.300000},
-    {"TZY46T9GJ6Y0", "新疆维吾尔自治区/昌吉回族自治州/昌吉市", "新疆/昌吉/昌吉", "Changji", 44.020000, 87.300000},
-    {"TZYE4J306SDB", "新疆维吾尔自治区/昌吉回族自治州/阜康市", "新疆/昌吉/阜康", "Fukang", 44.150000, 87.980000},
-    {"TZVG36WXHUBM", "新疆维吾尔自治区/昌吉回族自治州/呼图壁县", "新疆/昌吉/呼图壁", "Hutubi", 44.180000, 86.900000},
-    {"TZVK1BX6PWE9", "新疆维吾尔自治区/昌吉回族自治州/玛纳斯县", "新疆/昌吉/玛纳斯", "Manasi", 44.300000, 86.220000},
-    {"TZZDQMW5J6C2", "新疆维吾尔自治区/昌吉回族自治州/奇台县", "新疆/昌吉/奇台", "Qitai", 44.020000, 89.580000},
-    {"TZZ6M3FYSD7X", "新疆维吾尔自治区/昌吉回族自治州/吉木萨尔县", "新疆/昌吉/吉木萨尔", "Jimusaer", 44.000000, 89.180000},
-    {"WPB1Q75BK2PN", "新疆维吾尔自治区/昌吉回族自治州/木垒哈萨克自治县", "新疆/昌吉/木垒", "Mulei", 43.830000, 90.280000},
-    {"TZFR7QSK5DH2", "新疆维吾尔自治区/博尔塔拉蒙古自治州", "新疆/新疆/博尔塔拉", "Boertala", 44.904567, 82.062877},
-    {"TZFR7TC93WEK", "新疆维吾尔自治区/博尔塔拉蒙古自治州/博乐市", "新疆/博尔塔拉/博乐", "Bole", 44.900000, 82.070000},
-    {"VB48ZP18XJHZ", "新疆维吾尔自治区/博尔塔拉蒙古自治州/阿拉山口市", "新疆/博尔塔拉/阿拉山口", "Alashankou", 45.170402, 82.575609},
-    {"TZFVTZPMGFX5", "新疆维吾尔自治区/博尔塔拉蒙古自治州/精河县", "新疆/博尔塔拉/精河", "Jinghe", 44.600000, 82.880000},
-    {"TZCXGFS1PZE5", "新疆维吾尔自治区/博尔塔拉蒙古自治州/温泉县", "新疆/博尔塔拉/温泉", "Wenquan", 44.970000, 81.030000},
-    {"TZMM84XHV4GU", "新疆维吾尔自治区/巴音郭楞蒙古自治州", "新疆/新疆/巴音郭楞", "Bayinguoleng", 41.762611, 86.142645},
-    {"TZMM87UXBKRG", "新疆维吾尔自治区/巴音郭楞蒙古自治州/库尔勒市", "新疆/巴音郭楞/库尔勒", "Kuerle", 41.770000, 86.150000},
-    {"TZ7VTTGD1K6R", "新疆维吾尔自治区/巴音郭楞蒙古自治州/轮台县", "新疆/巴音郭楞/轮台", "Luntai", 41.780000, 84.270000},
-    {"TZM74EVKDWMM", "新疆维吾尔自治区/巴音郭楞蒙古自治州/尉犁县", "新疆/巴音郭楞/尉犁", "Weili", 41.330000, 86.250000},
-    {"TYYTYR77VZJN", "新疆维吾尔自治区/巴音郭楞蒙古自治州/若羌县", "新疆/巴音郭楞/若羌", "Ruoqiang", 39.020000, 88.170000},
-    {"TYUBFM3537NM", "新疆维吾尔自治区/巴音郭楞蒙古自治州/且末县", "新疆/巴音郭楞/且末", "Qiemo", 38.130000, 85.530000},
-    {"TZMX3FW7E0QT", "新疆维吾尔自治区/巴音郭楞蒙古自治州/焉耆回族自治县", "新疆/巴音郭楞/焉耆", "Yanqi", 42.070000, 86.570000},
-    {"TZT2Y04ECGV3", "新疆维吾尔自治区/巴音郭楞蒙古自治州/和静县", "新疆/巴音郭楞/和静", "Hejing", 42.320000, 86.400000},
-    {"TZTB2Z0B9ENG", "新疆维吾尔自治区/巴音郭楞蒙古自治州/和硕县", "新疆/巴音郭楞/和硕", "Heshuo", 42.270000, 86.870000},
-    {"TZMWG64P1R1Y", "新疆维吾尔自治区/巴音郭楞蒙古自治州/博湖县", "新疆/巴音郭楞/博湖", "Bohu", 41.980000, 86.630000},
-    {"TZ344WFBDS60", "新疆维吾尔自治区/阿克苏地区", "新疆/阿克苏", "Akesu", 41.170000, 80.270000},
-    {"TZ344WFBDS60", "新疆维吾尔自治区/阿克苏地区/阿克苏市", "新疆/阿克苏/阿克苏", "Akesu", 41.170000, 80.270000},
-    {"TZ34CDV9QMXZ", "新疆维吾尔自治区/阿克苏地区/温宿县", "新疆/阿克苏/温宿", "Wensu", 41.280000, 80.230000},
-    {"TZ7J24BUT5SJ", "新疆维吾尔自治区/阿克苏地区/库车县", "新疆/阿克苏/库车", "Kuche", 41.720000, 82.970000},
-    {"TZ6F7XYECUCV", "新疆维吾尔自治区/阿克苏地区/沙雅县", "新疆/阿克苏/沙雅", "Shaya", 41.220000, 82.780000},
-    {"TZ6SREGQR92H", "新疆维吾尔自治区/阿克苏地区/新和县", "新疆/阿克苏/新和", "Xinhe", 41.550000, 82.600000},
-    {"TZ6JYCRYTKB8", "新疆维吾尔自治区/阿克苏地区/拜城县", "新疆/阿克苏/拜城", "Baicheng", 41.800000, 81.870000},
-    {"TZ266ZVEBUCV", "新疆维吾尔自治区/阿克苏地区/乌什县", "新疆/阿克苏/乌什", "Wushi", 41.220000, 79.230000},
-    {"TZ1PJH6YVUBN", "新疆维吾尔自治区/阿克苏地区/阿瓦提县", "新疆/阿克苏/阿瓦提", "Awati", 40.630000, 80.380000},
-    {"TZ0NQUF3WE0N", "新疆维吾尔自治区/阿克苏地区/柯坪县", "新疆/阿克苏/柯坪", "Keping", 40.500000, 79.050000},
-    {"TXN1VJTX2P0K", "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州", "新疆/新疆/克州", "Kezhou", 39.714112, 76.164780},
-    {"TXN1VQC3C8ST", "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/阿图什市", "新疆/克州/阿图什", "Atushi", 39.720000, 76.170000},
-    {"TWYN8R1172BW", "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/阿克陶县", "新疆/克州/阿克陶", "Aketao", 39.150000, 75.950000},
-    {"TXRBC5JD93PB", "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/阿合奇县", "新疆/克州/阿合奇", "Aheqi", 40.930000, 78.450000},
-    {"TXJ9BQG3U0DV", "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/乌恰县", "新疆/克州/乌恰", "Wuqia", 39.720000, 75.250000},
-    {"TXN08CQCQM63", "新疆维吾尔自治区/喀什地区", "新疆/喀什", "Kashi", 39.470000, 75.980000},
-    {"TXN08CQCQM63", "新疆维吾尔自治区/喀什地区/喀什市", "新疆/喀什/喀什", "Kashi", 39.470000, 75.980000},
-    {"TXJBN0BM1H56", "新疆维吾尔自治区/喀什地区/疏附县", "新疆/喀什/疏附", "Shufu", 39.380000, 75.850000},
-    {"TXN04S9CTKQ4", "新疆维吾尔自治区/喀什地区/疏勒县", "新疆/喀什/疏勒", "Shujin", 39.400000, 76.050000},
-    {"TWYJMQCR9TUX", "新疆维吾尔自治区/喀什地区/英吉沙县", "新疆/喀什/英吉沙", "Yingjisha", 38.930000, 76.170000},
-    {"TWYCNQ6Q9EB5", "新疆维吾尔自治区/喀什地区/泽普县", "新疆/喀什/泽普", "Zepu", 38.180000, 77.270000},
-    {"TWYFT6JHTRJG", "新疆维吾尔自治区/喀什地区/莎车县", "新疆/喀什/莎车", "Shache", 38.420000, 77.230000},
-    {"TWXP3XZDBZB1", "新疆维吾尔自治区/喀什地区/叶城县", "新疆/喀什/叶城", "Yecheng", 37.880000, 77.420000},
-    {"TWZJQCX0BJSD", "新疆维吾尔自治区/喀什地区/麦盖提县", "新疆/喀什/麦盖提", "Maitigai", 38.900000, 77.650000},
-    {"TWYX4VW5QDHC", "新疆维吾尔自治区/喀什地区/岳普湖县", "新疆/喀什/岳普湖", "Yuepuhu", 39.230000, 76.770000},
-    {"TXN8DNC04TDY", "新疆维吾尔自治区/喀什地区/伽师县", "新疆/喀什/伽师", "Jiashi", 39.500000, 76.730000},
-    {"TXPF73WR79MP", "新疆维吾尔自治区/喀什地区/巴楚县", "新疆/喀什/巴楚", "Bachu", 39.780000, 78.550000},
-    {"TWTQZ9VXCN1J", "新疆维吾尔自治区/喀什地区/塔什库尔干塔吉克自治县", "新疆/喀什/塔什库尔干", "Tashikuergan", 37.760000, 75.220000},
-    {"TY8G4T7ZWVX1", "新疆维吾尔自治区/和田地区", "新疆/和田", "Hetian", 37.120000, 79.920000},
-    {"TY8G4T7ZWVX1", "新疆维吾尔自治区/和田地区/和田县", "新疆/和田/和田", "Hetian", 37.120000, 79.920000},
-    {"TY8SN2C97XSC", "新疆维吾尔自治区/和田地区/墨玉县", "新疆/和田/墨玉", "Moyu", 37.270000, 79.730000},
-    {"TWXWJ29B2HQ9", "新疆维吾尔自治区/和田地区/皮山县", "新疆/和田/皮山", "Pishan", 37.620000, 78.280000},
-    {"TY94BS3K3KV7", "新疆维吾尔自治区/和田地区/洛浦县", "新疆/和田/洛浦", "Luopu", 37.070000, 80.180000},
-    {"TY96QXSU87YV", "新疆维吾尔自治区/和田地区/策勒县", "新疆/和田/策勒", "Cele", 37.000000, 80.800000},
-    {"TYD1DKQ6BCVU", "新疆维吾尔自治区/和田地区/于田县", "新疆/和田/于田", "Yutian", 36.850000, 81.670000},
-    {"TYDFCKMSRSU7", "新疆维吾尔自治区/和田地区/民丰县", "新疆/和田/民丰", "Minfeng", 37.070000, 82.680000},
-    {"TZCCFD84WXV4", "新疆维吾尔自治区/伊犁哈萨克自治州", "新疆/新疆/伊犁", "Yili", 43.915571, 81.321087},
-    {"TZCCF7RKT36V", "新疆维吾尔自治区/伊犁哈萨克自治州/伊宁市", "新疆/伊犁/伊宁", "Yining", 43.920000, 81.320000},
-    {"TZUKEYQM32HM", "新疆维吾尔自治区/伊犁哈萨克自治州/奎屯市", "新疆/伊犁/奎屯", "Kuitun", 44.420000, 84.900000},
-    {"TZC5MZQTRD5Y", "新疆维吾尔自治区/伊犁哈萨克自治州/霍尔果斯市", "新疆/伊犁/霍尔果斯", "Huoerguosi", 44.205778, 80.418189},
-    {"TZCFPN341DJW", "新疆维吾尔自治区/伊犁哈萨克自治州/伊宁县", "新疆/伊犁/伊宁县", "Yining", 43.980000, 81.520000},
-    {"TZC9QE58K01W", "新疆维吾尔自治区/伊犁哈萨克自治州/察布查尔锡伯自治县", "新疆/伊犁/察布查尔", "Chabuchaer", 43.830000, 81.150000},
-    {"TZCD87P1BE5J", "新疆维吾尔自治区/伊犁哈萨克自治州/霍城县", "新疆/伊犁/霍城", "Huocheng", 44.050000, 80.880000},
-    {"TZDRR5Q13GKN", "新疆维吾尔自治区/伊犁哈萨克自治州/巩留县", "新疆/伊犁/巩留", "Gongliu", 43.480000, 82.230000},
-    {"TZEPN6HY1DG1", "新疆维吾尔自治区/伊犁哈萨克自治州/新源县", "新疆/伊犁/新源", "Xinyuan", 43.430000, 83.250000},
-    {"TZ9TQPJNFP08", "新疆维吾尔自治区/伊犁哈萨克自治州/昭苏县", "新疆/伊犁/昭苏", "Zhaosu", 43.150000, 81.130000},
-    {"TZDJY5FY9PYQ", "新疆维吾尔自治区/伊犁哈萨克自治州/特克斯县", "新疆/伊犁/特克斯", "Tekesi", 43.220000, 81.830000},
-    {"TZF9J3FSVRD8", "新疆维吾尔自治区/伊犁哈萨克自治州/尼勒克县", "新疆/伊犁/尼勒克", "Nileke", 43.780000, 82.500000},
-    {"VB71BQ84QPSS", "新疆维吾尔自治区/塔城地区", "新疆/塔城", "Tacheng", 46.750000, 82.980000},
-    {"VB71BQ84QPSS", "新疆维吾尔自治区/塔城地区/塔城市", "新疆/塔城/塔城", "Tacheng", 46.750000, 82.980000},
-    {"TZUHYBNPE023", "新疆维吾尔自治区/塔城地区/乌苏市", "新疆/塔城/乌苏", "Wusu", 44.430000, 84.680000},
-    {"VB72XN98BHXT", "新疆维吾尔自治区/塔城地区/额敏县", "新疆/塔城/额敏", "Emin", 46.530000, 83.630000},
-    {"TZUUHQ48FWGQ", "新疆维吾尔自治区/塔城地区/沙湾县", "新疆/塔城/沙湾", "Shawan", 44.330000, 85.620000},
-    {"VB5MQ379THW4", "新疆维吾尔自治区/塔城地区/托里县", "新疆/塔城/托里", "Tuoli", 45.930000, 83.600000},
-    {"VB5NB62NW0HW", "新疆维吾尔自治区/塔城地区/裕民县", "新疆/塔城/裕民", "Yumin", 46.200000, 82.980000},
-    {"VBKFNXEMUB2D", "新疆维吾尔自治区/塔城地区/和布克赛尔蒙古自治县", "新疆/塔城/和布克赛尔", "Bukesaier", 46.800000, 85.720000},
-    {"VBW8JQY63YDB", "新疆维吾尔自治区/阿勒泰地区", "新疆/阿勒泰", "Aletai", 47.850000, 88.130000},
-    {"VBW8JQY63YDB", "新疆维吾尔自治区/阿勒泰地区/阿勒泰市", "新疆/阿勒泰/阿勒泰", "Aletai", 47.850000, 88.130000},
-    {"VBMZ27D0XSMZ", "新疆维吾尔自治区/阿勒泰地区/布尔津县", "新疆/阿勒泰/布尔津", "Buerjin", 47.700000, 86.850000},
-    {"VBREMH46Z5N0", "新疆维吾尔自治区/阿勒泰地区/富蕴县", "新疆/阿勒泰/富蕴", "Fuyun", 47.000000, 89.520000},
-    {"VBQHP1GTCU8U", "新疆维吾尔自治区/阿勒泰地区/福海县", "新疆/阿勒泰/福海", "Fuhai", 47.120000, 87.500000},
-    {"VBT3QWCH5CQX", "新疆维吾尔自治区/阿勒泰地区/哈巴河县", "新疆/阿勒泰/哈巴河", "Habahe", 48.070000, 86.420000},
-    {"Y02388H8QWSD", "新疆维吾尔自治区/阿勒泰地区/青河县", "新疆/阿勒泰/青河", "Qinghe", 46.670000, 90.380000},
-    {"VBMJF4RGV0C6", "新疆维吾尔自治区/阿勒泰地区/吉木乃县", "新疆/阿勒泰/吉木乃", "Jimunai", 47.430000, 85.880000},
-    {"TZVHJ8T4HQ93", "新疆维吾尔自治区/石河子市", "新疆/石河子/石河子", "Shihezi", 44.300000, 86.030000},
-    {"TZ1Y9TFKC7BS", "新疆维吾尔自治区/阿拉尔市", "新疆/阿拉尔/阿拉尔", "Alaer", 40.550000, 81.280000},
-    {"TZ04Z1NF3P4V", "新疆维吾尔自治区/图木舒克市", "新疆/新疆/图木舒克", "Tumushuke", 39.864316, 79.066934},
-    {"TZY7200FWT0M", "新疆维吾尔自治区/五家渠市", "新疆/五家渠/五家渠", "Wujiaqu", 44.165496, 87.540372},
-    {"VBQMNXK3YFKV", "新疆维吾尔自治区/北屯市", "新疆/新疆/北屯", "Beitun", 47.325295, 87.830840},
-    {"TZKYJKV2ZPNW", "新疆维吾尔自治区/铁门关市", "新疆/新疆/铁门关", "Tiemenguan", 41.862197, 85.667920},
-    {"TZFX1GQY86PS", "新疆维吾尔自治区/双河市", "新疆/新疆/双河", "Shuanghe", 44.843199, 82.351820},
-    {"TZC9UPSYFNPD", "新疆维吾尔自治区/可克达拉市", "新疆/新疆/可克达拉", "Kekedala", 43.943757, 81.041775},
-    {"TY87SMB6KKFW", "新疆维吾尔自治区/昆玉市", "新疆/新疆/昆玉", "Kunyu", 37.209733, 79.288859},
-    {"WEVV5TEP8D3H", "台湾/高雄", "台湾/高雄/恒春", "Hengchun", 22.004169, 120.743889},
-    {"WSJ6Z5NBXNB0", "台湾/高雄", "台湾/高雄/台南", "Tainan", 23.000000, 120.200000},
-    {"WSJ89JC5P1S7", "台湾/高雄", "台湾/高雄", "Gaoxiong", 22.620000, 120.280000},
-    {"WSJ8VWFY76R3", "台湾/高雄", "台湾/高雄/屏东", "Pingdong", 22.670000, 120.480000},
-    {"WSJN13BN6HU0", "台湾/高雄", "台湾/高雄/马公", "Ma-kung", 23.565399, 119.586273},
-    {"WSJTS6QKYMHX", "台湾/高雄", "台湾/高雄/嘉义", "Jiayi", 23.480000, 120.430000},
-    {"WSN1KVD8RE7K", "台湾/高雄", "台湾/高雄/云林", "Yunlin", 22.750000, 121.150000},
-    {"WSJWYWP7083Z", "台湾/台中", "台湾/台中/鹿谷乡", "Lugu", 23.720000, 120.530000},
-    {"WSJZ5FCK9PXR", "台湾/台中", "台湾/台中/彰化", "Zhanghua", 23.746389, 120.752502},
-    {"WSM8YXXK0T3G", "台湾/台中", "台湾/台中/南投", "Nantou", 24.080000, 120.530000},
-    {"WSMB1FT0NG1T", "台湾/台中", "台湾/台中", "Taizhong", 23.920000, 120.670000},
-    {"WSMC3UM5YY39", "台湾/台中", "台湾/台中/苗栗", "Miaoli", 24.150000, 120.670000},
-    {"WSMGSCECS52T", "台湾/台中", "台湾/台中/台东", "Taidong", 24.530000, 120.800000},
-    {"WSQ02DZQ65HE", "台湾/台中", "台湾/台中/埔里", "Puli", 23.966391, 120.969521},
-    {"WSQ2RJ6MT7GZ", "台湾/台中", "台湾/台中/花莲", "Hualian", 23.980000, 121.600000},
-    {"WSQJ0Q34GR2E", "台湾/台北", "台湾/台北/新竹", "Xinzhu", 24.820000, 120.950000},
-    {"WSQM81BYPZ6P", "台湾/台北", "台湾/台北/大溪", "Daxi", 24.883730, 121.290428},
-    {"WSQQ01XUYC7E", "台湾/台北", "台湾/台北/桃园", "Taoyuan", 24.970000, 121.300000},
-    {"WSQQMXBCC2VS", "台湾/台北", "台湾/台北", "Taipei", 25.047760, 121.531853},
-    {"WSQSFMPXSWEV", "台湾/台北", "台湾/台北/宜兰", "Yilan", 24.770000, 121.750000},
-    {"WSQWFQ3WXV69", "台湾/台北", "台湾/台北/基隆", "Keelung", 25.128250, 121.741898},
-    {"WECNV8ZNE40W", "香港", "香港", "Hong Kong", 22.285521, 114.157692},
-    {"WECNYQ9U02EE", "香港", "九龙", "Kowloon", 22.316669, 114.183327},
-    {"WECPHRTP69SV", "香港", "荃湾", "Tsuen Wan", 22.366671, 114.099998},
-    {"WECPJQ06ZPUE", "香港", "新界", "New Territories", 22.357692, 114.137613},
-    {"WEBTFUSKS7HB", "澳门", "澳门", "Macao", 22.130000, 113.330000},
-    {"WEBVB7GZ9P8N", "澳门", "路环岛", "Coloane", 22.126420, 113.570867},
-    {"WEBY02613HF6", "澳门", "氹仔岛", "Taipa Island", 22.150051, 113.568466},
-
-};
-
 static const size_t city_count = 3218;
 
-// 城市查找函数声明
+// 按下标读取城市数据，index 需小于 city_count
+CityData GetCity(size_t index);
+
+// 城市查找函数声明，名称按路径匹配，例如 "广东/深圳/南山"。区名末尾的"区"可有可无，
+// 只给到地级市（"广东/深圳"）时返回地级市本身，找不到时去掉最后一级再查
 bool FindCityByName(const char* city_name, double& lat, double& lon);
 bool FindCityByAdmin(const char* admin_name, double& lat, double& lon);
+// 拼音不区分大小写，重名时返回第一个
+bool FindCityByPinyin(const char* pinyin, double& lat, double& lon);
+// 按经纬度查找最近的城市
+bool FindNearestCity(double lat, double lon, CityData& city);
@@ -1,30 +1,16704 @@
 /*
  * @Date: 2025-01-27
- * @Description: 城市经纬度查找函数实现
+ * @Description: 城市经纬度数据和查找函数实现，从CSV文件自动生成
+ * @Generated: 自动生成，请勿手动编辑
  */
 #include "city_data.h"
+#include <cstdint>
 #include <cstring>
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <strings.h>
 
-bool FindCityByName(const char* city_name, double& lat, double& lon) {
-    for (size_t i = 0; i < city_count; i++) {
-        if (strstr(city_coordinates[i].city, city_name) != nullptr ||
-            strstr(city_name, city_coordinates[i].city) != nullptr) {
-            lat = city_coordinates[i].lat;
-            lon = city_coordinates[i].lon;
-            return true;
+namespace {
+
+// 字符串在 kCityStringPool 中的偏移，经纬度为 1e-6 度的定点数
+struct CityRecord {
+    uint32_t admin;
+    uint32_t city;
+    uint32_t pinyin;
+    int32_t lat;
+    int32_t lon;
+};
+
+constexpr char kCityStringPool[] =
+    "北京市\0"
+    "北京/北京\0"
+    "Beijing\0"
+    "北京市/东城区\0"
+    "北京/东城\0"
+    "Dongcheng\0"
+    "北京市/西城区\0"
+    "北京/西城\0"
+    "Xicheng\0"
+    "北京市/朝阳区\0"
+    "北京/朝阳\0"
+    "Chaoyang\0"
+    "北京市/丰台区\0"
+    "北京/丰台\0"
+    "Fengtai\0"
+    "北京市/石景山区\0"
+    "北京/石景山\0"
+    "Shijingshan\0"
+    "北京市/海淀区\0"
+    "北京/海淀\0"
+    "Haidian\0"
+    "北京市/门头沟区\0"
+    "北京/门头沟\0"
+    "Mentougou\0"
+    "北京市/房山区\0"
+    "北京/房山\0"
+    "Fangshan\0"
+    "北京市/通州区\0"
+    "北京/通州\0"
+    "Tongzhou\0"
+    "北京市/顺义区\0"
+    "北京/顺义\0"
+    "Shunyi\0"
+    "北京市/昌平区\0"
+    "北京/昌平\0"
+    "Changping\0"
+    "北京市/大兴区\0"
+    "北京/大兴\0"
+    "Daxing\0"
+    "北京市/怀柔区\0"
+    "北京/怀柔\0"
+    "Huairou\0"
+    "北京市/平谷区\0"
+    "北京/平谷\0"
+    "Pinggu\0"
+    "北京市/密云区\0"
+    "北京/密云\0"
+    "Miyun\0"
+    "北京市/延庆区\0"
+    "北京/延庆\0"
+    "Yanqing\0"
+    "天津市\0"
+    "天津/天津\0"
+    "Tianjin\0"
+    "天津市/和平区\0"
+    "天津/和平\0"
+    "Heping\0"
+    "天津市/河东区\0"
+    "天津/河东\0"
+    "Hedong\0"
+    "天津市/河西区\0"
+    "天津/河西\0"
+    "Hexi\0"
+    "天津市/南开区\0"
+    "天津/南开\0"
+    "Nankai\0"
+    "天津市/河北区\0"
+    "天津/河北\0"
+    "Hebei\0"
+    "天津市/红桥区\0"
+    "天津/红桥\0"
+    "Hongqiao\0"
+    "天津市/东丽区\0"
+    "天津/东丽\0"
+    "Dongli\0"
+    "天津市/西青区\0"
+    "天津/西青\0"
+    "Xiqing\0"
+    "天津市/津南区\0"
+    "天津/津南\0"
+    "Jinnan\0"
+    "天津市/北辰区\0"
+    "天津/北辰\0"
+    "Beichen\0"
+    "天津市/武清区\0"
+    "天津/武清\0"
+    "Wuqing\0"
+    "天津市/宝坻区\0"
+    "天津/宝坻\0"
+    "Baodi\0"
+    "天津市/滨海新区\0"
+    "天津/滨海新区\0"
+    "Binhaixinqu\0"
+    "天津市/宁河区\0"
+    "天津/宁河\0"
+    "Ninghe\0"
+    "天津市/静海区\0"
+    "天津/静海\0"
+    "Jinghai\0"
+    "天津市/蓟州区\0"
+    "天津/蓟州\0"
+    "Jixian\0"
+    "河北省/石家庄市\0"
+    "河北/石家庄/石家庄\0"
+    "Shijiazhuang\0"
+    "河北省/石家庄市/长安区\0"
+    "河北/石家庄/长安\0"
+    "Changan\0"
+    "河北省/石家庄市/桥西区\0"
+    "河北/石家庄/桥西\0"
+    "Qiaoxi\0"
+    "河北省/石家庄市/新华区\0"
+    "河北/石家庄/新华\0"
+    "Xinhua\0"
+    "河北省/石家庄市/井陉矿区\0"
+    "河北/石家庄/井陉\0"
+    "Jingxing\0"
+    "河北省/石家庄市/裕华区\0"
+    "河北/石家庄/裕华\0"
+    "Yuhua\0"
+    "河北省/石家庄市/藁城区\0"
+    "河北/石家庄/藁城\0"
+    "Gaocheng\0"
+    "河北省/石家庄市/鹿泉区\0"
+    "河北/石家庄/鹿泉\0"
+    "Luquan\0"
+    "河北省/石家庄市/栾城区\0"
+    "河北/石家庄/栾城\0"
+    "Luancheng\0"
+    "河北省/石家庄市/井陉县\0"
+    "河北省/石家庄市/正定县\0"
+    "河北/石家庄/正定\0"
+    "Zhengding\0"
+    "河北省/石家庄市/行唐县\0"
+    "河北/石家庄/行唐\0"
+    "Xingtang\0"
+    "河北省/石家庄市/灵寿县\0"
+    "河北/石家庄/灵寿\0"
+    "Lingshou\0"
+    "河北省/石家庄市/高邑县\0"
+    "河北/石家庄/高邑\0"
+    "Gaoyi\0"
+    "河北省/石家庄市/深泽县\0"
+    "河北/石家庄/深泽\0"
+    "Shenze\0"
+    "河北省/石家庄市/赞皇县\0"
+    "河北/石家庄/赞皇\0"
+    "Zanhuang\0"
+    "河北省/石家庄市/无极县\0"
+    "河北/石家庄/无极\0"
+    "Wuji\0"
+    "河北省/石家庄市/平山县\0"
+    "河北/石家庄/平山\0"
+    "Pingshan\0"
+    "河北省/石家庄市/元氏县\0"
+    "河北/石家庄/元氏\0"
+    "Yuanshi\0"
+    "河北省/石家庄市/赵县\0"
+    "河北/石家庄/赵县\0"
+    "Zhaoxian\0"
+    "河北省/石家庄市/辛集市\0"
+    "河北/石家庄/辛集\0"
+    "Xinji\0"
+    "河北省/石家庄市/晋州市\0"
+    "河北/石家庄/晋州\0"
+    "Jinzhou\0"
+    "河北省/石家庄市/新乐市\0"
+    "河北/石家庄/新乐\0"
+    "Xinle\0"
+    "河北省/唐山市\0"
+    "河北/唐山/唐山\0"
+    "Tangshan\0"
+    "河北省/唐山市/路南区\0"
+    "河北/唐山/路南\0"
+    "Lunan\0"
+    "河北省/唐山市/路北区\0"
+    "河北/唐山/路北\0"
+    "Lubei\0"
+    "河北省/唐山市/古冶区\0"
+    "河北/唐山/古冶\0"
+    "Guye\0"
+    "河北省/唐山市/开平区\0"
+    "河北/唐山/开平\0"
+    "Kaiping\0"
+    "河北省/唐山市/丰南区\0"
+    "河北/唐山/丰南\0"
+    "Fengnan\0"
+    "河北省/唐山市/丰润区\0"
+    "河北/唐山/丰润\0"
+    "Fengrun\0"
+    "河北省/唐山市/曹妃甸区\0"
+    "河北/唐山/曹妃甸\0"
+    "Caofeidian\0"
+    "河北省/唐山市/滦南县\0"
+    "河北/唐山/滦南\0"
+    "Luannan\0"
+    "河北省/唐山市/乐亭县\0"
+    "河北/唐山/乐亭\0"
+    "Leting\0"
+    "河北省/唐山市/迁西县\0"
+    "河北/唐山/迁西\0"
+    "Qianxi\0"
+    "河北省/唐山市/玉田县\0"
+    "河北/唐山/玉田\0"
+    "Yutian\0"
+    "河北省/唐山市/遵化市\0"
+    "河北/唐山/遵化\0"
+    "Zunhua\0"
+    "河北省/唐山市/迁安市\0"
+    "河北/唐山/迁安\0"
+    "Qianan\0"
+    "河北省/唐山市/滦州市\0"
+    "河北/唐山/滦州\0"
+    "Luanxian\0"
+    "河北省/秦皇岛市\0"
+    "河北/秦皇岛/秦皇岛\0"
+    "Qinhuangdao\0"
+    "河北省/秦皇岛市/海港区\0"
+    "河北/秦皇岛/海港\0"
+    "Haigang\0"
+    "河北省/秦皇岛市/山海关区\0"
+    "河北/秦皇岛/山海关\0"
+    "Shanhaiguan\0"
+    "河北省/秦皇岛市/北戴河区\0"
+    "河北/秦皇岛/北戴河\0"
+    "Beidaihe\0"
+    "河北省/秦皇岛市/抚宁区\0"
+    "河北/秦皇岛/抚宁\0"
+    "Funing\0"
+    "河北省/秦皇岛市/青龙满族自治县\0"
+    "河北/秦皇岛/青龙\0"
+    "Qinglong\0"
+    "河北省/秦皇岛市/昌黎县\0"
+    "河北/秦皇岛/昌黎\0"
+    "Changli\0"
+    "河北省/秦皇岛市/卢龙县\0"
+    "河北/秦皇岛/卢龙\0"
+    "Lulong\0"
+    "河北省/邯郸市\0"
+    "河北/邯郸/邯郸\0"
+    "Handan\0"
+    "河北省/邯郸市/邯山区\0"
+    "河北/邯郸/邯山\0"
+    "Hanshan\0"
+    "河北省/邯郸市/丛台区\0"
+    "河北/邯郸/丛台\0"
+    "Congtai\0"
+    "河北省/邯郸市/复兴区\0"
+    "河北/邯郸/复兴\0"
+    "Fuxing\0"
+    "河北省/邯郸市/峰峰矿区\0"
+    "河北/邯郸/峰峰\0"
+    "Fengfeng\0"
+    "河北省/邯郸市/肥乡区\0"
+    "河北/邯郸/肥乡\0"
+    "Feixiang\0"
+    "河北省/邯郸市/永年区\0"
+    "河北/邯郸/永年\0"
+    "Yongnian\0"
+    "河北省/邯郸市/临漳县\0"
+    "河北/邯郸/临漳\0"
+    "Linzhang\0"
+    "河北省/邯郸市/成安县\0"
+    "河北/邯郸/成安\0"
+    "Chengan\0"
+    "河北省/邯郸市/大名县\0"
+    "河北/邯郸/大名\0"
+    "Daming\0"
+    "河北省/邯郸市/涉县\0"
+    "河北/邯郸/涉县\0"
+    "Shexian\0"
+    "河北省/邯郸市/磁县\0"
+    "河北/邯郸/磁县\0"
+    "Cixian\0"
+    "河北省/邯郸市/邱县\0"
+    "河北/邯郸/邱县\0"
+    "Qiuxian\0"
+    "河北省/邯郸市/鸡泽县\0"
+    "河北/邯郸/鸡泽\0"
+    "Jize\0"
+    "河北省/邯郸市/广平县\0"
+    "河北/邯郸/广平\0"
+    "Guangping\0"
+    "河北省/邯郸市/馆陶县\0"
+    "河北/邯郸/馆陶\0"
+    "Guantao\0"
+    "河北省/邯郸市/魏县\0"
+    "河北/邯郸/魏县\0"
+    "Weixian\0"
+    "河北省/邯郸市/曲周县\0"
+    "河北/邯郸/曲周\0"
+    "Quzhou\0"
+    "河北省/邯郸市/武安市\0"
+    "河北/邯郸/武安\0"
+    "Wuan\0"
+    "河北省/邢台市\0"
+    "河北/邢台\0"
+    "Xingtai\0"
+    "河北省/邢台市/桥东区\0"
+    "河北/邢台/桥东\0"
+    "Qiaodong\0"
+    "河北省/邢台市/桥西区\0"
+    "河北/邢台/桥西\0"
+    "河北省/邢台市/邢台县\0"
+    "河北/邢台/邢台\0"
+    "河北省/邢台市/临城县\0"
+    "河北/邢台/临城\0"
+    "Lincheng\0"
+    "河北省/邢台市/内丘县\0"
+    "河北/邢台/内丘\0"
+    "Neiqiu\0"
+    "河北省/邢台市/柏乡县\0"
+    "河北/邢台/柏乡\0"
+    "Baixiang\0"
+    "河北省/邢台市/隆尧县\0"
+    "河北/邢台/隆尧\0"
+    "Longyao\0"
+    "河北省/邢台市/任县\0"
+    "河北/邢台/任县\0"
+    "Renxian\0"
+    "河北省/邢台市/南和县\0"
+    "河北/邢台/南和\0"
+    "Nanhe\0"
+    "河北省/邢台市/宁晋县\0"
+    "河北/邢台/宁晋\0"
+    "Ningjin\0"
+    "河北省/邢台市/巨鹿县\0"
+    "河北/邢台/巨鹿\0"
+    "Julu\0"
+    "河北省/邢台市/新河县\0"
+    "河北/邢台/新河\0"
+    "Xinhe\0"
+    "河北省/邢台市/广宗县\0"
+    "河北/邢台/广宗\0"
+    "Guangzong\0"
+    "河北省/邢台市/平乡县\0"
+    "河北/邢台/平乡\0"
+    "Pingxiang\0"
+    "河北省/邢台市/威县\0"
+    "河北/邢台/威县\0"
+    "河北省/邢台市/清河县\0"
+    "河北/邢台/清河\0"
+    "Qinghe\0"
+    "河北省/邢台市/临西县\0"
+    "河北/邢台/临西\0"
+    "Linxi\0"
+    "河北省/邢台市/南宫市\0"
+    "河北/邢台/南宫\0"
+    "Nangong\0"
+    "河北省/邢台市/沙河市\0"
+    "河北/邢台/沙河\0"
+    "Shahe\0"
+    "河北省/保定市\0"
+    "河北/保定/保定\0"
+    "Baoding\0"
+    "河北省/保定市/竞秀区\0"
+    "河北/保定/竞秀\0"
+    "Jingxiu\0"
+    "河北省/保定市/莲池区\0"
+    "河北/保定/莲池\0"
+    "Lianchi\0"
+    "河北省/保定市/满城区\0"
+    "河北/保定/满城\0"
+    "Mancheng\0"
+    "河北省/保定市/清苑区\0"
+    "河北/保定/清苑\0"
+    "Qingyuan\0"
+    "河北省/保定市/徐水区\0"
+    "河北/保定/徐水\0"
+    "Xushui\0"
+    "河北省/保定市/涞水县\0"
+    "河北/保定/涞水\0"
+    "Laishui\0"
+    "河北省/保定市/阜平县\0"
+    "河北/保定/阜平\0"
+    "Fuping\0"
+    "河北省/保定市/定兴县\0"
+    "河北/保定/定兴\0"
+    "Dingxing\0"
+    "河北省/保定市/唐县\0"
+    "河北/保定/唐县\0"
+    "Tangxian\0"
+    "河北省/保定市/高阳县\0"
+    "河北/保定/高阳\0"
+    "Gaoyang\0"
+    "河北省/保定市/容城县\0"
+    "河北/保定/容城\0"
+    "Rongcheng\0"
+    "河北省/保定市/涞源县\0"
+    "河北/保定/涞源\0"
+    "Laiyuan\0"
+    "河北省/保定市/望都县\0"
+    "河北/保定/望都\0"
+    "Wangdu\0"
+    "河北省/保定市/安新县\0"
+    "河北/保定/安新\0"
+    "Anxin\0"
+    "河北省/保定市/易县\0"
+    "河北/保定/易县\0"
+    "Yixian\0"
+    "河北省/保定市/曲阳县\0"
+    "河北/保定/曲阳\0"
+    "Quyang\0"
+    "河北省/保定市/蠡县\0"
+    "河北/保定/蠡县\0"
+    "Lixian\0"
+    "河北省/保定市/顺平县\0"
+    "河北/保定/顺平\0"
+    "Shunping\0"
+    "河北省/保定市/博野县\0"
+    "河北/保定/博野\0"
+    "Boye\0"
+    "河北省/保定市/雄县\0"
+    "河北/保定/雄县\0"
+    "Xiongxian\0"
+    "河北省/保定市/涿州市\0"
+    "河北/保定/涿州\0"
+    "Zhuozhou\0"
+    "河北省/保定市/定州市\0"
+    "河北/保定/定州\0"
+    "Dingzhou\0"
+    "河北省/保定市/安国市\0"
+    "河北/保定/安国\0"
+    "Anguo\0"
+    "河北省/保定市/高碑店市\0"
+    "河北/保定/高碑店\0"
+    "Gaobeidian\0"
+    "河北省/张家口市\0"
+    "河北/张家口/张家口\0"
+    "Zhangjiakou\0"
+    "河北省/张家口市/桥东区\0"
+    "河北/张家口/桥东\0"
+    "河北省/张家口市/桥西区\0"
+    "河北/张家口/桥西\0"
+    "河北省/张家口市/宣化区\0"
+    "河北/张家口/宣化\0"
+    "Xuanhua\0"
+    "河北省/张家口市/下花园区\0"
+    "河北/张家口/下花园\0"
+    "Xiahuayuan\0"
+    "河北省/张家口市/万全区\0"
+    "河北/张家口/万全\0"
+    "Wanquan\0"
+    "河北省/张家口市/崇礼区\0"
+    "河北/张家口/崇礼\0"
+    "Chongli\0"
+    "河北省/张家口市/张北县\0"
+    "河北/张家口/张北\0"
+    "Zhangbei\0"
+    "河北省/张家口市/康保县\0"
+    "河北/张家口/康保\0"
+    "Kangbao\0"
+    "河北省/张家口市/沽源县\0"
+    "河北/张家口/沽源\0"
+    "Guyuan\0"
+    "河北省/张家口市/尚义县\0"
+    "河北/张家口/尚义\0"
+    "Shangyi\0"
+    "河北省/张家口市/蔚县\0"
+    "河北/张家口/蔚县\0"
+    "Yuxian\0"
+    "河北省/张家口市/阳原县\0"
+    "河北/张家口/阳原\0"
+    "Yangyuan\0"
+    "河北省/张家口市/怀安县\0"
+    "河北/张家口/怀安\0"
+    "Huaian\0"
+    "河北省/张家口市/怀来县\0"
+    "河北/张家口/怀来\0"
+    "Huailai\0"
+    "河北省/张家口市/涿鹿县\0"
+    "河北/张家口/涿鹿\0"
+    "Zhuolu\0"
+    "河北省/张家口市/赤城县\0"
+    "河北/张家口/赤城\0"
+    "Chicheng\0"
+    "河北省/承德市\0"
+    "河北/承德/承德\0"
+    "Chengde\0"
+    "河北省/承德市/双桥区\0"
+    "河北/承德/双桥\0"
+    "Shuangqiao\0"
+    "河北省/承德市/双滦区\0"
+    "河北/承德/双滦\0"
+    "Shuangluan\0"
+    "河北省/承德市/鹰手营子矿区\0"
+    "河北/承德/鹰手营\0"
+    "Yingshouying\0"
+    "河北省/承德市/承德县\0"
+    "河北/承德/承德县\0"
+    "Chengdexian\0"
+    "河北省/承德市/兴隆县\0"
+    "河北/承德/兴隆\0"
+    "Xinglong\0"
+    "河北省/承德市/滦平县\0"
+    "河北/承德/滦平\0"
+    "Luanping\0"
+    "河北省/承德市/隆化县\0"
+    "河北/承德/隆化\0"
+    "Longhua\0"
+    "河北省/承德市/丰宁满族自治县\0"
+    "河北/承德/丰宁\0"
+    "Fengning\0"
+    "河北省/承德市/宽城满族自治县\0"
+    "河北/承德/宽城\0"
+    "Kuancheng\0"
+    "河北省/承德市/围场满族蒙古族自治县\0"
+    "河北/承德/围场\0"
+    "Weichang\0"
+    "河北省/承德市/平泉市\0"
+    "河北/承德/平泉\0"
+    "Pingquan\0"
+    "河北省/沧州市\0"
+    "河北/沧州/沧州\0"
+    "Cangzhou\0"
+    "河北省/沧州市/新华区\0"
+    "河北/沧州/新华\0"
+    "河北省/沧州市/运河区\0"
+    "河北/沧州/运河\0"
+    "Yunhe\0"
+    "河北省/沧州市/沧县\0"
+    "河北/沧州/沧县\0"
+    "Cangxian\0"
+    "河北省/沧州市/青县\0"
+    "河北/沧州/青县\0"
+    "Qingxian\0"
+    "河北省/沧州市/东光县\0"
+    "河北/沧州/东光\0"
+    "Dongguang\0"
+    "河北省/沧州市/海兴县\0"
+    "河北/沧州/海兴\0"
+    "Haixing\0"
+    "河北省/沧州市/盐山县\0"
+    "河北/沧州/盐山\0"
+    "Yanshan\0"
+    "河北省/沧州市/肃宁县\0"
+    "河北/沧州/肃宁\0"
+    "Suning\0"
+    "河北省/沧州市/南皮县\0"
+    "河北/沧州/南皮\0"
+    "Nanpi\0"
+    "河北省/沧州市/吴桥县\0"
+    "河北/沧州/吴桥\0"
+    "Wuqiao\0"
+    "河北省/沧州市/献县\0"
+    "河北/沧州/献县\0"
+    "Xianxian\0"
+    "河北省/沧州市/孟村回族自治县\0"
+    "河北/沧州/孟村\0"
+    "Mengcun\0"
+    "河北省/沧州市/泊头市\0"
+    "河北/沧州/泊头\0"
+    "Botou\0"
+    "河北省/沧州市/任丘市\0"
+    "河北/沧州/任丘\0"
+    "Renqiu\0"
+    "河北省/沧州市/黄骅市\0"
+    "河北/沧州/黄骅\0"
+    "Huanghua\0"
+    "河北省/沧州市/河间市\0"
+    "河北/沧州/河间\0"
+    "Hejian\0"
+    "河北省/廊坊市\0"
+    "河北/廊坊/廊坊\0"
+    "Langfang\0"
+    "河北省/廊坊市/安次区\0"
+    "河北/廊坊/安次\0"
+    "Anci\0"
+    "河北省/廊坊市/广阳区\0"
+    "河北/廊坊/广阳\0"
+    "Guangyang\0"
+    "河北省/廊坊市/固安县\0"
+    "河北/廊坊/固安\0"
+    "Guan\0"
+    "河北省/廊坊市/永清县\0"
+    "河北/廊坊/永清\0"
+    "Yongqing\0"
+    "河北省/廊坊市/香河县\0"
+    "河北/廊坊/香河\0"
+    "Xianghe\0"
+    "河北省/廊坊市/大城县\0"
+    "河北/廊坊/大城\0"
+    "Dacheng\0"
+    "河北省/廊坊市/文安县\0"
+    "河北/廊坊/文安\0"
+    "Wenan\0"
+    "河北省/廊坊市/大厂回族自治县\0"
+    "河北/廊坊/大厂\0"
+    "Dachang\0"
+    "河北省/廊坊市/霸州市\0"
+    "河北/廊坊/霸州\0"
+    "Bazhou\0"
+    "河北省/廊坊市/三河市\0"
+    "河北/廊坊/三河\0"
+    "Sanhe\0"
+    "河北省/衡水市\0"
+    "河北/衡水/衡水\0"
+    "Hengshui\0"
+    "河北省/衡水市/桃城区\0"
+    "河北/衡水/桃城\0"
+    "Taocheng\0"
+    "河北省/衡水市/冀州区\0"
+    "河北/衡水/冀州\0"
+    "Jizhou\0"
+    "河北省/衡水市/枣强县\0"
+    "河北/衡水/枣强\0"
+    "Zaoqiang\0"
+    "河北省/衡水市/武邑县\0"
+    "河北/衡水/武邑\0"
+    "Wuyi\0"
+    "河北省/衡水市/武强县\0"
+    "河北/衡水/武强\0"
+    "Wuqiang\0"
+    "河北省/衡水市/饶阳县\0"
+    "河北/衡水/饶阳\0"
+    "Raoyang\0"
+    "河北省/衡水市/安平县\0"
+    "河北/衡水/安平\0"
+    "Anping\0"
+    "河北省/衡水市/故城县\0"
+    "河北/衡水/故城\0"
+    "Gucheng\0"
+    "河北省/衡水市/景县\0"
+    "河北/衡水/景县\0"
+    "Jingxian\0"
+    "河北省/衡水市/阜城县\0"
+    "河北/衡水/阜城\0"
+    "Fucheng\0"
+    "河北省/衡水市/深州市\0"
+    "河北/衡水/深州\0"
+    "Shenzhou\0"
+    "山西省/太原市\0"
+    "山西/太原/太原\0"
+    "Taiyuan\0"
+    "山西省/太原市/小店区\0"
+    "山西/太原/小店区\0"
+    "Xiaodianqu\0"
+    "山西省/太原市/迎泽区\0"
+    "山西/太原/迎泽\0"
+    "Yingze\0"
+    "山西省/太原市/杏花岭区\0"
+    "山西/太原/杏花岭\0"
+    "Xinghualing\0"
+    "山西省/太原市/尖草坪区\0"
+    "山西/太原/尖草坪区\0"
+    "Jiancaopingqu\0"
+    "山西省/太原市/万柏林区\0"
+    "山西/太原/万柏林\0"
+    "Wanbailin\0"
+    "山西省/太原市/晋源区\0"
+    "山西/太原/晋源\0"
+    "Jinyuan\0"
+    "山西省/太原市/清徐县\0"
+    "山西/太原/清徐\0"
+    "Qingxu\0"
+    "山西省/太原市/阳曲县\0"
+    "山西/太原/阳曲\0"
+    "Yangqu\0"
+    "山西省/太原市/娄烦县\0"
+    "山西/太原/娄烦\0"
+    "Loufan\0"
+    "山西省/太原市/古交市\0"
+    "山西/太原/古交\0"
+    "Gujiao\0"
+    "山西省/大同市\0"
+    "山西/大同/大同\0"
+    "Datong\0"
+    "山西省/大同市/新荣区\0"
+    "山西/大同/新荣\0"
+    "Xinrong\0"
+    "山西省/大同市/平城区\0"
+    "山西/大同/平城\0"
+    "Pingcheng\0"
+    "山西省/大同市/云冈区\0"
+    "山西/大同/云冈\0"
+    "Yungang\0"
+    "山西省/大同市/云州区\0"
+    "山西/大同/云州\0"
+    "Datongxian\0"
+    "山西省/大同市/阳高县\0"
+    "山西/大同/阳高\0"
+    "Yanggao\0"
+    "山西省/大同市/天镇县\0"
+    "山西/大同/天镇\0"
+    "Tianzhen\0"
+    "山西省/大同市/广灵县\0"
+    "山西/大同/广灵\0"
+    "Guangling\0"
+    "山西省/大同市/灵丘县\0"
+    "山西/大同/灵丘\0"
+    "Lingqiu\0"
+    "山西省/大同市/浑源县\0"
+    "山西/大同/浑源\0"
+    "Hunyuan\0"
+    "山西省/大同市/左云县\0"
+    "山西/大同/左云\0"
+    "Zuoyun\0"
+    "山西省/阳泉市\0"
+    "山西/阳泉\0"
+    "Yangquan\0"
+    "山西省/阳泉市/城区\0"
+    "山西/阳泉/阳泉\0"
+    "山西省/阳泉市/矿区\0"
+    "山西/阳泉/矿区\0"
+    "Kuangqu\0"
+    "山西省/阳泉市/郊区\0"
+    "山西/阳泉/郊区\0"
+    "Jiaoqu\0"
+    "山西省/阳泉市/平定县\0"
+    "山西/阳泉/平定\0"
+    "Pingding\0"
+    "山西省/阳泉市/盂县\0"
+    "山西/阳泉/盂县\0"
+    "山西省/长治市\0"
+    "山西/长治/长治\0"
+    "Changzhi\0"
+    "山西省/长治市/潞州区\0"
+    "山西/长治/潞州\0"
+    "Luzhou\0"
+    "山西省/长治市/上党区\0"
+    "山西/长治/上党\0"
+    "Shangdang\0"
+    "山西省/长治市/屯留区\0"
+    "山西/长治/屯留\0"
+    "Tunliu\0"
+    "山西省/长治市/潞城区\0"
+    "山西/长治/潞城\0"
+    "Lucheng\0"
+    "山西省/长治市/襄垣县\0"
+    "山西/长治/襄垣\0"
+    "Xiangyuan\0"
+    "山西省/长治市/平顺县\0"
+    "山西/长治/平顺\0"
+    "Pingshun\0"
+    "山西省/长治市/黎城县\0"
+    "山西/长治/黎城\0"
+    "Licheng\0"
+    "山西省/长治市/壶关县\0"
+    "山西/长治/壶关\0"
+    "Huguan\0"
+    "山西省/长治市/长子县\0"
+    "山西/长治/长子\0"
+    "Zhangzi\0"
+    "山西省/长治市/武乡县\0"
+    "山西/长治/武乡\0"
+    "Wuxiang\0"
+    "山西省/长治市/沁县\0"
+    "山西/长治/沁县\0"
+    "Qinxian\0"
+    "山西省/长治市/沁源县\0"
+    "山西/长治/沁源\0"
+    "Qinyuan\0"
+    "山西省/晋城市\0"
+    "山西/晋城\0"
+    "Jincheng\0"
+    "山西省/晋城市/城区\0"
+    "山西/晋城/晋城\0"
+    "山西省/晋城市/沁水县\0"
+    "山西/晋城/沁水\0"
+    "Qinshui\0"
+    "山西省/晋城市/阳城县\0"
+    "山西/晋城/阳城\0"
+    "Yangcheng\0"
+    "山西省/晋城市/陵川县\0"
+    "山西/晋城/陵川\0"
+    "Lingchuan\0"
+    "山西省/晋城市/泽州县\0"
+    "山西/晋城/泽州\0"
+    "Zezhou\0"
+    "山西省/晋城市/高平市\0"
+    "山西/晋城/高平\0"
+    "Gaoping\0"
+    "山西省/朔州市\0"
+    "山西/朔州/朔州\0"
+    "Shuozhou\0"
+    "山西省/朔州市/朔城区\0"
+    "山西/朔州/朔城\0"
+    "Shuocheng\0"
+    "山西省/朔州市/平鲁区\0"
+    "山西/朔州/平鲁\0"
+    "Pinglu\0"
+    "山西省/朔州市/山阴县\0"
+    "山西/朔州/山阴\0"
+    "Shanyin\0"
+    "山西省/朔州市/应县\0"
+    "山西/朔州/应县\0"
+    "Yingxian\0"
+    "山西省/朔州市/右玉县\0"
+    "山西/朔州/右玉\0"
+    "Youyu\0"
+    "山西省/朔州市/怀仁市\0"
+    "山西/朔州/怀仁\0"
+    "Huairen\0"
+    "山西省/晋中市\0"
+    "山西/晋中/晋中\0"
+    "Jinzhong\0"
+    "山西省/晋中市/榆次区\0"
+    "山西/晋中/榆次\0"
+    "Yuci\0"
+    "山西省/晋中市/榆社县\0"
+    "山西/晋中/榆社\0"
+    "Yushe\0"
+    "山西省/晋中市/左权县\0"
+    "山西/晋中/左权\0"
+    "Zuoquan\0"
+    "山西省/晋中市/和顺县\0"
+    "山西/晋中/和顺\0"
+    "Heshun\0"
+    "山西省/晋中市/昔阳县\0"
+    "山西/晋中/昔阳\0"
+    "Xiyang\0"
+    "山西省/晋中市/寿阳县\0"
+    "山西/晋中/寿阳\0"
+    "Shouyang\0"
+    "山西省/晋中市/太谷县\0"
+    "山西/晋中/太谷\0"
+    "Taigu\0"
+    "山西省/晋中市/祁县\0"
+    "山西/晋中/祁县\0"
+    "Qixian\0"
+    "山西省/晋中市/平遥县\0"
+    "山西/晋中/平遥\0"
+    "Pingyao\0"
+    "山西省/晋中市/灵石县\0"
+    "山西/晋中/灵石\0"
+    "Lingshi\0"
+    "山西省/晋中市/介休市\0"
+    "山西/晋中/介休\0"
+    "Jiexiu\0"
+    "山西省/运城市\0"
+    "山西/运城/运城\0"
+    "Yuncheng\0"
+    "山西省/运城市/盐湖区\0"
+    "山西/运城/盐湖\0"
+    "Yanhu\0"
+    "山西省/运城市/临猗县\0"
+    "山西/运城/临猗\0"
+    "Linyi\0"
+    "山西省/运城市/万荣县\0"
+    "山西/运城/万荣\0"
+    "Wanrong\0"
+    "山西省/运城市/闻喜县\0"
+    "山西/运城/闻喜\0"
+    "Wenxi\0"
+    "山西省/运城市/稷山县\0"
+    "山西/运城/稷山\0"
+    "Jishan\0"
+    "山西省/运城市/新绛县\0"
+    "山西/运城/新绛\0"
+    "Xinjiang\0"
+    "山西省/运城市/绛县\0"
+    "山西/运城/绛县\0"
+    "Jiangxian\0"
+    "山西省/运城市/垣曲县\0"
+    "山西/运城/垣曲\0"
+    "Yuanqu\0"
+    "山西省/运城市/夏县\0"
+    "山西/运城/夏县\0"
+    "Xiaxian\0"
+    "山西省/运城市/平陆县\0"
+    "山西/运城/平陆\0"
+    "山西省/运城市/芮城县\0"
+    "山西/运城/芮城\0"
+    "Ruicheng\0"
+    "山西省/运城市/永济市\0"
+    "山西/运城/永济\0"
+    "Yongji\0"
+    "山西省/运城市/河津市\0"
+    "山西/运城/河津\0"
+    "Hejin\0"
+    "山西省/忻州市\0"
+    "山西/忻州/忻州\0"
+    "Xinzhou\0"
+    "山西省/忻州市/忻府区\0"
+    "山西/忻州/忻府\0"
+    "Xinfu\0"
+    "山西省/忻州市/定襄县\0"
+    "山西/忻州/定襄\0"
+    "Dingxiang\0"
+    "山西省/忻州市/五台县\0"
+    "山西/忻州/五台县\0"
+    "Wutaixian\0"
+    "山西省/忻州市/代县\0"
+    "山西/忻州/代县\0"
+    "Daixian\0"
+    "山西省/忻州市/繁峙县\0"
+    "山西/忻州/繁峙\0"
+    "Fanshi\0"
+    "山西省/忻州市/宁武县\0"
+    "山西/忻州/宁武\0"
+    "Ningwu\0"
+    "山西省/忻州市/静乐县\0"
+    "山西/忻州/静乐\0"
+    "Jingle\0"
+    "山西省/忻州市/神池县\0"
+    "山西/忻州/神池\0"
+    "Shenchi\0"
+    "山西省/忻州市/五寨县\0"
+    "山西/忻州/五寨\0"
+    "Wuzhai\0"
+    "山西省/忻州市/岢岚县\0"
+    "山西/忻州/岢岚\0"
+    "Kelan\0"
+    "山西省/忻州市/河曲县\0"
+    "山西/忻州/河曲\0"
+    "Hequ\0"
+    "山西省/忻州市/保德县\0"
+    "山西/忻州/保德\0"
+    "Baode\0"
+    "山西省/忻州市/偏关县\0"
+    "山西/忻州/偏关\0"
+    "Pianguan\0"
+    "山西省/忻州市/原平市\0"
+    "山西/忻州/原平\0"
+    "Yuanping\0"
+    "山西省/临汾市\0"
+    "山西/临汾/临汾\0"
+    "Linfen\0"
+    "山西省/临汾市/尧都区\0"
+    "山西/临汾/尧都\0"
+    "Yaodou\0"
+    "山西省/临汾市/曲沃县\0"
+    "山西/临汾/曲沃\0"
+    "Quwo\0"
+    "山西省/临汾市/翼城县\0"
+    "山西/临汾/翼城\0"
+    "Yicheng\0"
+    "山西省/临汾市/襄汾县\0"
+    "山西/临汾/襄汾\0"
+    "Xiangfen\0"
+    "山西省/临汾市/洪洞县\0"
+    "山西/临汾/洪洞\0"
+    "Hongtong\0"
+    "山西省/临汾市/古县\0"
+    "山西/临汾/古县\0"
+    "Guxian\0"
+    "山西省/临汾市/安泽县\0"
+    "山西/临汾/安泽\0"
+    "Anze\0"
+    "山西省/临汾市/浮山县\0"
+    "山西/临汾/浮山\0"
+    "Fushan\0"
+    "山西省/临汾市/吉县\0"
+    "山西/临汾/吉县\0"
+    "山西省/临汾市/乡宁县\0"
+    "山西/临汾/乡宁\0"
+    "Xiangning\0"
+    "山西省/临汾市/大宁县\0"
+    "山西/临汾/大宁\0"
+    "Daning\0"
+    "山西省/临汾市/隰县\0"
+    "山西/临汾/隰县\0"
+    "Xixian\0"
+    "山西省/临汾市/永和县\0"
+    "山西/临汾/永和\0"
+    "Yonghe\0"
+    "山西省/临汾市/蒲县\0"
+    "山西/临汾/蒲县\0"
+    "Puxian\0"
+    "山西省/临汾市/汾西县\0"
+    "山西/临汾/汾西\0"
+    "Fenxi\0"
+    "山西省/临汾市/侯马市\0"
+    "山西/临汾/侯马\0"
+    "Houma\0"
+    "山西省/临汾市/霍州市\0"
+    "山西/临汾/霍州\0"
+    "Huozhou\0"
+    "山西省/吕梁市\0"
+    "山西/吕梁/吕梁\0"
+    "Lvliang\0"
+    "山西省/吕梁市/离石区\0"
+    "山西/吕梁/离石\0"
+    "Lishi\0"
+    "山西省/吕梁市/文水县\0"
+    "山西/吕梁/文水\0"
+    "Wenshui\0"
+    "山西省/吕梁市/交城县\0"
+    "山西/吕梁/交城\0"
+    "Jiaocheng\0"
+    "山西省/吕梁市/兴县\0"
+    "山西/吕梁/兴县\0"
+    "Xingxian\0"
+    "山西省/吕梁市/临县\0"
+    "山西/吕梁/临县\0"
+    "Linxian\0"
+    "山西省/吕梁市/柳林县\0"
+    "山西/吕梁/柳林\0"
+    "Liulin\0"
+    "山西省/吕梁市/石楼县\0"
+    "山西/吕梁/石楼\0"
+    "Shilou\0"
+    "山西省/吕梁市/岚县\0"
+    "山西/吕梁/岚县\0"
+    "Lanxian\0"
+    "山西省/吕梁市/方山县\0"
+    "山西/吕梁/方山\0"
+    "山西省/吕梁市/中阳县\0"
+    "山西/吕梁/中阳\0"
+    "Zhongyang\0"
+    "山西省/吕梁市/交口县\0"
+    "山西/吕梁/交口\0"
+    "Jiaokou\0"
+    "山西省/吕梁市/孝义市\0"
+    "山西/吕梁/孝义\0"
+    "Xiaoyi\0"
+    "山西省/吕梁市/汾阳市\0"
+    "山西/吕梁/汾阳\0"
+    "Fenyang\0"
+    "内蒙古自治区/呼和浩特市\0"
+    "内蒙古/呼和浩特/呼和浩特\0"
+    "Huhehaote\0"
+    "内蒙古自治区/呼和浩特市/新城区\0"
+    "内蒙古/呼和浩特/新城\0"
+    "Xincheng\0"
+    "内蒙古自治区/呼和浩特市/回民区\0"
+    "内蒙古/呼和浩特/回民\0"
+    "Huimin\0"
+    "内蒙古自治区/呼和浩特市/玉泉区\0"
+    "内蒙古/呼和浩特/玉泉\0"
+    "Yuquan\0"
+    "内蒙古自治区/呼和浩特市/赛罕区\0"
+    "内蒙古/呼和浩特/赛罕\0"
+    "Saihan\0"
+    "内蒙古自治区/呼和浩特市/土默特左旗\0"
+    "内蒙古/呼和浩特/土左旗\0"
+    "Tuzuoqi\0"
+    "内蒙古自治区/呼和浩特市/托克托县\0"
+    "内蒙古/呼和浩特/托县\0"
+    "Tuoxian\0"
+    "内蒙古自治区/呼和浩特市/和林格尔县\0"
+    "内蒙古/呼和浩特/和林\0"
+    "Helin\0"
+    "内蒙古自治区/呼和浩特市/清水河县\0"
+    "内蒙古/呼和浩特/清水河\0"
+    "Qingshuihe\0"
+    "内蒙古自治区/呼和浩特市/武川县\0"
+    "内蒙古/呼和浩特/武川\0"
+    "Wuchuan\0"
+    "内蒙古自治区/包头市\0"
+    "内蒙古/包头/包头\0"
+    "Baotou\0"
+    "内蒙古自治区/包头市/东河区\0"
+    "内蒙古/包头/东河\0"
+    "Donghe\0"
+    "内蒙古自治区/包头市/昆都仑区\0"
+    "内蒙古/包头/昆都仑\0"
+    "Kundoulun\0"
+    "内蒙古自治区/包头市/青山区\0"
+    "内蒙古/包头/青山\0"
+    "Qingshan\0"
+    "内蒙古自治区/包头市/石拐区\0"
+    "内蒙古/包头/石拐\0"
+    "Shiguai\0"
+    "内蒙古自治区/包头市/白云鄂博矿区\0"
+    "内蒙古/包头/白云鄂博\0"
+    "Baiyunebo\0"
+    "内蒙古自治区/包头市/九原区\0"
+    "内蒙古/包头/九原\0"
+    "Jiuyuan\0"
+    "内蒙古自治区/包头市/土默特右旗\0"
+    "内蒙古/包头/土右旗\0"
+    "Tuyouqi\0"
+    "内蒙古自治区/包头市/固阳县\0"
+    "内蒙古/包头/固阳\0"
+    "Guyang\0"
+    "内蒙古自治区/包头市/达尔罕茂明安联合旗\0"
+    "内蒙古/包头/达茂旗\0"
+    "Damaoqi\0"
+    "内蒙古自治区/乌海市\0"
+    "内蒙古/乌海/乌海\0"
+    "Wuhai\0"
+    "内蒙古自治区/乌海市/海勃湾区\0"
+    "内蒙古/乌海/海勃湾\0"
+    "Haibowan\0"
+    "内蒙古自治区/乌海市/海南区\0"
+    "内蒙古/乌海/海南\0"
+    "Hainan\0"
+    "内蒙古自治区/乌海市/乌达区\0"
+    "内蒙古/乌海/乌达\0"
+    "Wuda\0"
+    "内蒙古自治区/赤峰市\0"
+    "内蒙古/赤峰/赤峰\0"
+    "Chifeng\0"
+    "内蒙古自治区/赤峰市/红山区\0"
+    "内蒙古/赤峰/红山\0"
+    "Hongshan\0"
+    "内蒙古自治区/赤峰市/元宝山区\0"
+    "内蒙古/赤峰/元宝山\0"
+    "Yuanbaoshan\0"
+    "内蒙古自治区/赤峰市/松山区\0"
+    "内蒙古/赤峰/松山\0"
+    "Songshan\0"
+    "内蒙古自治区/赤峰市/阿鲁科尔沁旗\0"
+    "内蒙古/赤峰/阿鲁旗\0"
+    "Aluqi\0"
+    "内蒙古自治区/赤峰市/巴林左旗\0"
+    "内蒙古/赤峰/巴林左旗\0"
+    "Balinzuoqi\0"
+    "内蒙古自治区/赤峰市/巴林右旗\0"
+    "内蒙古/赤峰/巴林右旗\0"
+    "Balinyouqi\0"
+    "内蒙古自治区/赤峰市/林西县\0"
+    "内蒙古/赤峰/林西\0"
+    "内蒙古自治区/赤峰市/克什克腾旗\0"
+    "内蒙古/赤峰/克什克腾\0"
+    "Keshiketeng\0"
+    "内蒙古自治区/赤峰市/翁牛特旗\0"
+    "内蒙古/赤峰/翁牛特\0"
+    "Wengniute\0"
+    "内蒙古自治区/赤峰市/喀喇沁旗\0"
+    "内蒙古/赤峰/喀喇沁\0"
+    "Kalaqin\0"
+    "内蒙古自治区/赤峰市/宁城县\0"
+    "内蒙古/赤峰/宁城\0"
+    "Ningcheng\0"
+    "内蒙古自治区/赤峰市/敖汉旗\0"
+    "内蒙古/赤峰/敖汉\0"
+    "Aohan\0"
+    "内蒙古自治区/通辽市\0"
+    "内蒙古/通辽/通辽\0"
+    "Tongliao\0"
+    "内蒙古自治区/通辽市/科尔沁区\0"
+    "内蒙古/通辽/科尔沁\0"
+    "Keerqin\0"
+    "内蒙古自治区/通辽市/科尔沁左翼中旗\0"
+    "内蒙古/通辽/科左中旗\0"
+    "Kezuozhongqi\0"
+    "内蒙古自治区/通辽市/科尔沁左翼后旗\0"
+    "内蒙古/通辽/科左后旗\0"
+    "Kezuohouqi\0"
+    "内蒙古自治区/通辽市/开鲁县\0"
+    "内蒙古/通辽/开鲁\0"
+    "Kailu\0"
+    "内蒙古自治区/通辽市/库伦旗\0"
+    "内蒙古/通辽/库伦\0"
+    "Kulun\0"
+    "内蒙古自治区/通辽市/奈曼旗\0"
+    "内蒙古/通辽/奈曼\0"
+    "Naiman\0"
+    "内蒙古自治区/通辽市/扎鲁特旗\0"
+    "内蒙古/通辽/扎鲁特\0"
+    "Zhalute\0"
+    "内蒙古自治区/通辽市/霍林郭勒市\0"
+    "内蒙古/通辽/霍林郭勒\0"
+    "Huolinguole\0"
+    "内蒙古自治区/鄂尔多斯市\0"
+    "内蒙古/鄂尔多斯/鄂尔多斯\0"
+    "Eerduosi\0"
+    "内蒙古自治区/鄂尔多斯市/东胜区\0"
+    "内蒙古/鄂尔多斯/东胜\0"
+    "Dongsheng\0"
+    "内蒙古自治区/鄂尔多斯市/康巴什区\0"
+    "内蒙古/鄂尔多斯/康巴什\0"
+    "Kangbashi\0"
+    "内蒙古自治区/鄂尔多斯市/达拉特旗\0"
+    "内蒙古/鄂尔多斯/达拉特\0"
+    "Dalate\0"
+    "内蒙古自治区/鄂尔多斯市/准格尔旗\0"
+    "内蒙古/鄂尔多斯/准格尔\0"
+    "Zhungeer\0"
+    "内蒙古自治区/鄂尔多斯市/鄂托克前旗\0"
+    "内蒙古/鄂尔多斯/鄂前旗\0"
+    "Eqianqi\0"
+    "内蒙古自治区/鄂尔多斯市/鄂托克旗\0"
+    "内蒙古/鄂尔多斯/鄂托克\0"
+    "Etuoke\0"
+    "内蒙古自治区/鄂尔多斯市/杭锦旗\0"
+    "内蒙古/鄂尔多斯/杭锦旗\0"
+    "Hangjinqi\0"
+    "内蒙古自治区/鄂尔多斯市/乌审旗\0"
+    "内蒙古/鄂尔多斯/乌审旗\0"
+    "Wushenqi\0"
+    "内蒙古自治区/鄂尔多斯市/伊金霍洛旗\0"
+    "内蒙古/鄂尔多斯/伊金霍洛\0"
+    "Yijinhuoluo\0"
+    "内蒙古自治区/呼伦贝尔市\0"
+    "内蒙古/内蒙古/呼伦贝尔\0"
+    "Hulunbeier\0"
+    "内蒙古自治区/呼伦贝尔市/海拉尔区\0"
+    "内蒙古/呼伦贝尔/海拉尔\0"
+    "Hailaer\0"
+    "内蒙古自治区/呼伦贝尔市/扎赉诺尔区\0"
+    "内蒙古/呼伦贝尔/扎赉诺尔\0"
+    "Zhalainuoer\0"
+    "内蒙古自治区/呼伦贝尔市/阿荣旗\0"
+    "内蒙古/呼伦贝尔/阿荣旗\0"
+    "Arongqi\0"
+    "内蒙古自治区/呼伦贝尔市/莫力达瓦达斡尔族自治旗\0"
+    "内蒙古/呼伦贝尔/莫力达瓦\0"
+    "Molidawa\0"
+    "内蒙古自治区/呼伦贝尔市/鄂伦春自治旗\0"
+    "内蒙古/呼伦贝尔/鄂伦春旗\0"
+    "Elunchunqi\0"
+    "内蒙古自治区/呼伦贝尔市/鄂温克族自治旗\0"
+    "内蒙古/呼伦贝尔/鄂温克旗\0"
+    "Ewenkeqi\0"
+    "内蒙古自治区/呼伦贝尔市/陈巴尔虎旗\0"
+    "内蒙古/呼伦贝尔/陈旗\0"
+    "Chenqi\0"
+    "内蒙古自治区/呼伦贝尔市/新巴尔虎左旗\0"
+    "内蒙古/呼伦贝尔/新左旗\0"
+    "Xinzuoqi\0"
+    "内蒙古自治区/呼伦贝尔市/新巴尔虎右旗\0"
+    "内蒙古/呼伦贝尔/新右旗\0"
+    "Xinyouqi\0"
+    "内蒙古自治区/呼伦贝尔市/满洲里市\0"
+    "内蒙古/呼伦贝尔/满洲里\0"
+    "Manzhouli\0"
+    "内蒙古自治区/呼伦贝尔市/牙克石市\0"
+    "内蒙古/呼伦贝尔/牙克石\0"
+    "Yakeshi\0"
+    "内蒙古自治区/呼伦贝尔市/扎兰屯市\0"
+    "内蒙古/呼伦贝尔/扎兰屯\0"
+    "Zhalantun\0"
+    "内蒙古自治区/呼伦贝尔市/额尔古纳市\0"
+    "内蒙古/呼伦贝尔/额尔古纳\0"
+    "Eerguna\0"
+    "内蒙古自治区/呼伦贝尔市/根河市\0"
+    "内蒙古/呼伦贝尔/根河\0"
+    "Genhe\0"
+    "内蒙古自治区/巴彦淖尔市\0"
+    "内蒙古/内蒙古/巴彦淖尔\0"
+    "Bayanzhuor\0"
+    "内蒙古自治区/巴彦淖尔市/临河区\0"
+    "内蒙古/巴彦淖尔/临河\0"
+    "Linhe\0"
+    "内蒙古自治区/巴彦淖尔市/五原县\0"
+    "内蒙古/巴彦淖尔/五原\0"
+    "Wuyuan\0"
+    "内蒙古自治区/巴彦淖尔市/磴口县\0"
+    "内蒙古/巴彦淖尔/磴口\0"
+    "Dengkou\0"
+    "内蒙古自治区/巴彦淖尔市/乌拉特前旗\0"
+    "内蒙古/巴彦淖尔/乌前旗\0"
+    "Wuqianqi\0"
+    "内蒙古自治区/巴彦淖尔市/乌拉特中旗\0"
+    "内蒙古/巴彦淖尔/乌中旗\0"
+    "Wuzhongqi\0"
+    "内蒙古自治区/巴彦淖尔市/乌拉特后旗\0"
+    "内蒙古/巴彦淖尔/乌后旗\0"
+    "Wuhouqi\0"
+    "内蒙古自治区/巴彦淖尔市/杭锦后旗\0"
+    "内蒙古/巴彦淖尔/杭锦后旗\0"
+    "Hangjinhouqi\0"
+    "内蒙古自治区/乌兰察布市\0"
+    "内蒙古/内蒙古/乌兰察布\0"
+    "Wulanchabu\0"
+    "内蒙古自治区/乌兰察布市/集宁区\0"
+    "内蒙古/乌兰察布/集宁\0"
+    "Jining\0"
+    "内蒙古自治区/乌兰察布市/卓资县\0"
+    "内蒙古/乌兰察布/卓资\0"
+    "Zhuozi\0"
+    "内蒙古自治区/乌兰察布市/化德县\0"
+    "内蒙古/乌兰察布/化德\0"
+    "Huade\0"
+    "内蒙古自治区/乌兰察布市/商都县\0"
+    "内蒙古/乌兰察布/商都\0"
+    "Shangdu\0"
+    "内蒙古自治区/乌兰察布市/兴和县\0"
+    "内蒙古/乌兰察布/兴和\0"
+    "Xinghe\0"
+    "内蒙古自治区/乌兰察布市/凉城县\0"
+    "内蒙古/乌兰察布/凉城\0"
+    "Liangcheng\0"
+    "内蒙古自治区/乌兰察布市/察哈尔右翼前旗\0"
+    "内蒙古/乌兰察布/察右前旗\0"
+    "Chayouqianqi\0"
+    "内蒙古自治区/乌兰察布市/察哈尔右翼中旗\0"
+    "内蒙古/乌兰察布/察右中旗\0"
+    "Chayouzhongqi\0"
+    "内蒙古自治区/乌兰察布市/察哈尔右翼后旗\0"
+    "内蒙古/乌兰察布/察右后旗\0"
+    "Chayouhouqi\0"
+    "内蒙古自治区/乌兰察布市/四子王旗\0"
+    "内蒙古/乌兰察布/四子王旗\0"
+    "Siziwangqi\0"
+    "内蒙古自治区/乌兰察布市/丰镇市\0"
+    "内蒙古/乌兰察布/丰镇\0"
+    "Fengzhen\0"
+    "内蒙古自治区/兴安盟\0"
+    "内蒙古/兴安盟/兴安\0"
+    "Xingan\0"
+    "内蒙古自治区/兴安盟/乌兰浩特市\0"
+    "内蒙古/兴安盟/乌兰浩特\0"
+    "Wulanhaote\0"
+    "内蒙古自治区/兴安盟/阿尔山市\0"
+    "内蒙古/兴安盟/阿尔山\0"
+    "Aershan\0"
+    "内蒙古自治区/兴安盟/科尔沁右翼前旗\0"
+    "内蒙古/兴安盟/科右前旗\0"
+    "Keyouqianqi\0"
+    "内蒙古自治区/兴安盟/科尔沁右翼中旗\0"
+    "内蒙古/兴安盟/科右中旗\0"
+    "Keyouzhongqi\0"
+    "内蒙古自治区/兴安盟/扎赉特旗\0"
+    "内蒙古/兴安盟/扎赉特\0"
+    "Zhalaite\0"
+    "内蒙古自治区/兴安盟/突泉县\0"
+    "内蒙古/兴安盟/突泉\0"
+    "Tuquan\0"
+    "内蒙古自治区/锡林郭勒盟\0"
+    "内蒙古/内蒙古/锡林郭勒\0"
+    "Xilinguole\0"
+    "内蒙古自治区/锡林郭勒盟/二连浩特市\0"
+    "内蒙古/锡林郭勒/二连浩特\0"
+    "Erlianhaote\0"
+    "内蒙古自治区/锡林郭勒盟/锡林浩特市\0"
+    "内蒙古/锡林郭勒/锡林浩特\0"
+    "Xilinhaote\0"
+    "内蒙古自治区/锡林郭勒盟/阿巴嘎旗\0"
+    "内蒙古/锡林郭勒/阿巴嘎\0"
+    "Abaga\0"
+    "内蒙古自治区/锡林郭勒盟/苏尼特左旗\0"
+    "内蒙古/锡林郭勒/苏左旗\0"
+    "Suzuoqi\0"
+    "内蒙古自治区/锡林郭勒盟/苏尼特右旗\0"
+    "内蒙古/锡林郭勒/苏右旗\0"
+    "Suyouqi\0"
+    "内蒙古自治区/锡林郭勒盟/东乌珠穆沁旗\0"
+    "内蒙古/锡林郭勒/东乌旗\0"
+    "Dongwuqi\0"
+    "内蒙古自治区/锡林郭勒盟/西乌珠穆沁旗\0"
+    "内蒙古/锡林郭勒/西乌旗\0"
+    "Xiwuqi\0"
+    "内蒙古自治区/锡林郭勒盟/太仆寺旗\0"
+    "内蒙古/锡林郭勒/太仆寺\0"
+    "Taibusiqi\0"
+    "内蒙古自治区/锡林郭勒盟/镶黄旗\0"
+    "内蒙古/锡林郭勒/镶黄旗\0"
+    "Xianghuang\0"
+    "内蒙古自治区/锡林郭勒盟/正镶白旗\0"
+    "内蒙古/锡林郭勒/正镶白旗\0"
+    "Zhengxiangbaiqi\0"
+    "内蒙古自治区/锡林郭勒盟/正蓝旗\0"
+    "内蒙古/锡林郭勒/正蓝旗\0"
+    "Zhenglanqi\0"
+    "内蒙古自治区/锡林郭勒盟/多伦县\0"
+    "内蒙古/锡林郭勒/多伦\0"
+    "Duolun\0"
+    "内蒙古自治区/阿拉善盟\0"
+    "内蒙古/阿拉善盟/阿拉善\0"
+    "Alashanmeng\0"
+    "内蒙古自治区/阿拉善盟/阿拉善左旗\0"
+    "内蒙古/阿拉善盟/阿左旗\0"
+    "Azuoqi\0"
+    "内蒙古自治区/阿拉善盟/阿拉善右旗\0"
+    "内蒙古/阿拉善盟/阿右旗\0"
+    "Ayouqi\0"
+    "内蒙古自治区/阿拉善盟/额济纳旗\0"
+    "内蒙古/阿拉善盟/额济纳\0"
+    "Ejina\0"
+    "辽宁省/沈阳市\0"
+    "辽宁/沈阳/沈阳\0"
+    "Shenyang\0"
+    "辽宁省/沈阳市/和平区\0"
+    "辽宁/沈阳/和平\0"
+    "辽宁省/沈阳市/沈河区\0"
+    "辽宁/沈阳/沈河\0"
+    "Shenhe\0"
+    "辽宁省/沈阳市/大东区\0"
+    "辽宁/沈阳/大东\0"
+    "Dadong\0"
+    "辽宁省/沈阳市/皇姑区\0"
+    "辽宁/沈阳/皇姑\0"
+    "Huanggu\0"
+    "辽宁省/沈阳市/铁西区\0"
+    "辽宁/沈阳/铁西\0"
+    "Tiexi\0"
+    "辽宁省/沈阳市/苏家屯区\0"
+    "辽宁/沈阳/苏家屯\0"
+    "Sujiatun\0"
+    "辽宁省/沈阳市/浑南区\0"
+    "辽宁/沈阳/浑南\0"
+    "Hunnan\0"
+    "辽宁省/沈阳市/沈北新区\0"
+    "辽宁/沈阳/沈北新区\0"
+    "Shenbeixinqu\0"
+    "辽宁省/沈阳市/于洪区\0"
+    "辽宁/沈阳/于洪\0"
+    "Yuhong\0"
+    "辽宁省/沈阳市/辽中区\0"
+    "辽宁/沈阳/辽中\0"
+    "Liaozhong\0"
+    "辽宁省/沈阳市/康平县\0"
+    "辽宁/沈阳/康平\0"
+    "Kangping\0"
+    "辽宁省/沈阳市/法库县\0"
+    "辽宁/沈阳/法库\0"
+    "Faku\0"
+    "辽宁省/沈阳市/新民市\0"
+    "辽宁/沈阳/新民\0"
+    "Xinmin\0"
+    "辽宁省/大连市\0"
+    "辽宁/大连/大连\0"
+    "Dalian\0"
+    "辽宁省/大连市/中山区\0"
+    "辽宁/大连/中山\0"
+    "Zhongshan\0"
+    "辽宁省/大连市/西岗区\0"
+    "辽宁/大连/西岗\0"
+    "Xigang\0"
+    "辽宁省/大连市/沙河口区\0"
+    "辽宁/大连/沙河口\0"
+    "Shahekou\0"
+    "辽宁省/大连市/甘井子区\0"
+    "辽宁/大连/甘井子\0"
+    "Ganjingzi\0"
+    "辽宁省/大连市/旅顺口区\0"
+    "辽宁/大连/旅顺\0"
+    "Lvshun\0"
+    "辽宁省/大连市/金州区\0"
+    "辽宁/大连/金州\0"
+    "辽宁省/大连市/普兰店区\0"
+    "辽宁/大连/普兰店\0"
+    "Pulandian\0"
+    "辽宁省/大连市/长海县\0"
+    "辽宁/大连/长海\0"
+    "Changhai\0"
+    "辽宁省/大连市/瓦房店市\0"
+    "辽宁/大连/瓦房店\0"
+    "Wafangdian\0"
+    "辽宁省/大连市/庄河市\0"
+    "辽宁/大连/庄河\0"
+    "Zhuanghe\0"
+    "辽宁省/鞍山市\0"
+    "辽宁/鞍山/鞍山\0"
+    "Anshan\0"
+    "辽宁省/鞍山市/铁东区\0"
+    "辽宁/鞍山/铁东\0"
+    "Tiedong\0"
+    "辽宁省/鞍山市/铁西区\0"
+    "辽宁/鞍山/铁西\0"
+    "辽宁省/鞍山市/立山区\0"
+    "辽宁/鞍山/立山\0"
+    "Lishan\0"
+    "辽宁省/鞍山市/千山区\0"
+    "辽宁/鞍山/千山\0"
+    "Qianshan\0"
+    "辽宁省/鞍山市/台安县\0"
+    "辽宁/鞍山/台安\0"
+    "Taian\0"
+    "辽宁省/鞍山市/岫岩满族自治县\0"
+    "辽宁/鞍山/岫岩\0"
+    "Xiuyan\0"
+    "辽宁省/鞍山市/海城市\0"
+    "辽宁/鞍山/海城\0"
+    "Haicheng\0"
+    "辽宁省/抚顺市\0"
+    "辽宁/抚顺\0"
+    "Fushun\0"
+    "辽宁省/抚顺市/新抚区\0"
+    "辽宁/抚顺/新抚\0"
+    "辽宁省/抚顺市/东洲区\0"
+    "辽宁/抚顺/东洲\0"
+    "Dongzhou\0"
+    "辽宁省/抚顺市/望花区\0"
+    "辽宁/抚顺/望花\0"
+    "Wanghua\0"
+    "辽宁省/抚顺市/顺城区\0"
+    "辽宁/抚顺/顺城\0"
+    "Shuncheng\0"
+    "辽宁省/抚顺市/抚顺县\0"
+    "辽宁/抚顺/抚顺\0"
+    "辽宁省/抚顺市/新宾满族自治县\0"
+    "辽宁/抚顺/新宾\0"
+    "Xinbin\0"
+    "辽宁省/抚顺市/清原满族自治县\0"
+    "辽宁/抚顺/清原\0"
+    "辽宁省/本溪市\0"
+    "辽宁/本溪/本溪\0"
+    "Benxi\0"
+    "辽宁省/本溪市/平山区\0"
+    "辽宁/本溪/平山\0"
+    "辽宁省/本溪市/溪湖区\0"
+    "辽宁/本溪/溪湖\0"
+    "Xihu\0"
+    "辽宁省/本溪市/明山区\0"
+    "辽宁/本溪/明山\0"
+    "Mingshan\0"
+    "辽宁省/本溪市/南芬区\0"
+    "辽宁/本溪/南芬\0"
+    "Nanfen\0"
+    "辽宁省/本溪市/本溪满族自治县\0"
+    "辽宁/本溪/本溪县\0"
+    "Benxixian\0"
+    "辽宁省/本溪市/桓仁满族自治县\0"
+    "辽宁/本溪/桓仁\0"
+    "Huanren\0"
+    "辽宁省/丹东市\0"
+    "辽宁/丹东/丹东\0"
+    "Dandong\0"
+    "辽宁省/丹东市/元宝区\0"
+    "辽宁/丹东/元宝\0"
+    "Yuanbao\0"
+    "辽宁省/丹东市/振兴区\0"
+    "辽宁/丹东/振兴\0"
+    "Zhenxing\0"
+    "辽宁省/丹东市/振安区\0"
+    "辽宁/丹东/振安\0"
+    "Zhenan\0"
+    "辽宁省/丹东市/宽甸满族自治县\0"
+    "辽宁/丹东/宽甸\0"
+    "Kuandian\0"
+    "辽宁省/丹东市/东港市\0"
+    "辽宁/丹东/东港\0"
+    "Donggang\0"
+    "辽宁省/丹东市/凤城市\0"
+    "辽宁/丹东/凤城\0"
+    "Fengcheng\0"
+    "辽宁省/锦州市\0"
+    "辽宁/锦州/锦州\0"
+    "辽宁省/锦州市/古塔区\0"
+    "辽宁/锦州/古塔\0"
+    "Guta\0"
+    "辽宁省/锦州市/凌河区\0"
+    "辽宁/锦州/凌河\0"
+    "Linghe\0"
+    "辽宁省/锦州市/太和区\0"
+    "辽宁/锦州/太和\0"
+    "Taihe\0"
+    "辽宁省/锦州市/黑山县\0"
+    "辽宁/锦州/黑山\0"
+    "Heishan\0"
+    "辽宁省/锦州市/义县\0"
+    "辽宁/锦州/义县\0"
+    "辽宁省/锦州市/凌海市\0"
+    "辽宁/锦州/凌海\0"
+    "Linghai\0"
+    "辽宁省/锦州市/北镇市\0"
+    "辽宁/锦州/北镇\0"
+    "Beizhen\0"
+    "辽宁省/营口市\0"
+    "辽宁/营口/营口\0"
+    "Yingkou\0"
+    "辽宁省/营口市/站前区\0"
+    "辽宁/营口/站前\0"
+    "Zhanqian\0"
+    "辽宁省/营口市/西市区\0"
+    "辽宁/营口/西市\0"
+    "Xishi\0"
+    "辽宁省/营口市/鲅鱼圈区\0"
+    "辽宁/营口/鲅鱼圈\0"
+    "Bayuquan\0"
+    "辽宁省/营口市/老边区\0"
+    "辽宁/营口/老边\0"
+    "Laobian\0"
+    "辽宁省/营口市/盖州市\0"
+    "辽宁/营口/盖州\0"
+    "Gaizhou\0"
+    "辽宁省/营口市/大石桥市\0"
+    "辽宁/营口/大石桥\0"
+    "Dashiqiao\0"
+    "辽宁省/阜新市\0"
+    "辽宁/阜新\0"
+    "Fuxin\0"
+    "辽宁省/阜新市/海州区\0"
+    "辽宁/阜新/海州\0"
+    "Haizhou\0"
+    "辽宁省/阜新市/新邱区\0"
+    "辽宁/阜新/新邱\0"
+    "Xinqiu\0"
+    "辽宁省/阜新市/太平区\0"
+    "辽宁/阜新/太平\0"
+    "Taiping\0"
+    "辽宁省/阜新市/清河门区\0"
+    "辽宁/阜新/清河门\0"
+    "Qinghemen\0"
+    "辽宁省/阜新市/细河区\0"
+    "辽宁/阜新/细河\0"
+    "Xihe\0"
+    "辽宁省/阜新市/阜新蒙古族自治县\0"
+    "辽宁/阜新/阜新\0"
+    "辽宁省/阜新市/彰武县\0"
+    "辽宁/阜新/彰武\0"
+    "Zhangwu\0"
+    "辽宁省/辽阳市\0"
+    "辽宁/辽阳/辽阳\0"
+    "Liaoyang\0"
+    "辽宁省/辽阳市/白塔区\0"
+    "辽宁/辽阳/白塔\0"
+    "Baita\0"
+    "辽宁省/辽阳市/文圣区\0"
+    "辽宁/辽阳/文圣\0"
+    "Wensheng\0"
+    "辽宁省/辽阳市/宏伟区\0"
+    "辽宁/辽阳/宏伟\0"
+    "Hongwei\0"
+    "辽宁省/辽阳市/弓长岭区\0"
+    "辽宁/辽阳/弓长岭\0"
+    "Gongchangling\0"
+    "辽宁省/辽阳市/太子河区\0"
+    "辽宁/辽阳/太子河\0"
+    "Taizihe\0"
+    "辽宁省/辽阳市/辽阳县\0"
+    "辽宁/辽阳/辽阳县\0"
+    "Liaoyangxian\0"
+    "辽宁省/辽阳市/灯塔市\0"
+    "辽宁/辽阳/灯塔\0"
+    "Dengta\0"
+    "辽宁省/盘锦市\0"
+    "辽宁/盘锦/盘锦\0"
+    "Panjin\0"
+    "辽宁省/盘锦市/双台子区\0"
+    "辽宁/盘锦/双台子\0"
+    "Shuangtaizi\0"
+    "辽宁省/盘锦市/兴隆台区\0"
+    "辽宁/盘锦/兴隆台\0"
+    "Xinglongtai\0"
+    "辽宁省/盘锦市/大洼区\0"
+    "辽宁/盘锦/大洼\0"
+    "Dawa\0"
+    "辽宁省/盘锦市/盘山县\0"
+    "辽宁/盘锦/盘山\0"
+    "Panshan\0"
+    "辽宁省/铁岭市\0"
+    "辽宁/铁岭\0"
+    "Tieling\0"
+    "辽宁省/铁岭市/银州区\0"
+    "辽宁/铁岭/银州\0"
+    "Yinzhou\0"
+    "辽宁省/铁岭市/清河区\0"
+    "辽宁/铁岭/清河\0"
+    "辽宁省/铁岭市/铁岭县\0"
+    "辽宁/铁岭/铁岭\0"
+    "辽宁省/铁岭市/西丰县\0"
+    "辽宁/铁岭/西丰\0"
+    "Xifeng\0"
+    "辽宁省/铁岭市/昌图县\0"
+    "辽宁/铁岭/昌图\0"
+    "Changtu\0"
+    "辽宁省/铁岭市/调兵山市\0"
+    "辽宁/铁岭/调兵山\0"
+    "Diaobingshan\0"
+    "辽宁省/铁岭市/开原市\0"
+    "辽宁/铁岭/开原\0"
+    "Kaiyuan\0"
+    "辽宁省/朝阳市\0"
+    "辽宁/朝阳\0"
+    "辽宁省/朝阳市/双塔区\0"
+    "辽宁/朝阳/双塔\0"
+    "Shuangta\0"
+    "辽宁省/朝阳市/龙城区\0"
+    "辽宁/朝阳/龙城\0"
+    "Longcheng\0"
+    "辽宁省/朝阳市/朝阳县\0"
+    "辽宁/朝阳/朝阳\0"
+    "辽宁省/朝阳市/建平县\0"
+    "辽宁/朝阳/建平县\0"
+    "Jianpingxian\0"
+    "辽宁省/朝阳市/喀喇沁左翼蒙古族自治县\0"
+    "辽宁/朝阳/喀左\0"
+    "Kazuo\0"
+    "辽宁省/朝阳市/北票市\0"
+    "辽宁/朝阳/北票\0"
+    "Beipiao\0"
+    "辽宁省/朝阳市/凌源市\0"
+    "辽宁/朝阳/凌源\0"
+    "Lingyuan\0"
+    "辽宁省/葫芦岛市\0"
+    "辽宁/葫芦岛/葫芦岛\0"
+    "Huludao\0"
+    "辽宁省/葫芦岛市/连山区\0"
+    "辽宁/葫芦岛/连山\0"
+    "Lianshan\0"
+    "辽宁省/葫芦岛市/龙港区\0"
+    "辽宁/葫芦岛/龙港\0"
+    "Longgang\0"
+    "辽宁省/葫芦岛市/南票区\0"
+    "辽宁/葫芦岛/南票\0"
+    "Nanpiao\0"
+    "辽宁省/葫芦岛市/绥中县\0"
+    "辽宁/葫芦岛/绥中\0"
+    "Suizhong\0"
+    "辽宁省/葫芦岛市/建昌县\0"
+    "辽宁/葫芦岛/建昌\0"
+    "Jianchang\0"
+    "辽宁省/葫芦岛市/兴城市\0"
+    "辽宁/葫芦岛/兴城\0"
+    "Xingcheng\0"
+    "吉林省/长春市\0"
+    "吉林/长春/长春\0"
+    "Changchun\0"
+    "吉林省/长春市/南关区\0"
+    "吉林/长春/南关\0"
+    "Nanguan\0"
+    "吉林省/长春市/宽城区\0"
+    "吉林/长春/宽城\0"
+    "吉林省/长春市/朝阳区\0"
+    "吉林/长春/朝阳\0"
+    "吉林省/长春市/二道区\0"
+    "吉林/长春/二道\0"
+    "Erdao\0"
+    "吉林省/长春市/绿园区\0"
+    "吉林/长春/绿园\0"
+    "Lvyuan\0"
+    "吉林省/长春市/双阳区\0"
+    "吉林/长春/双阳\0"
+    "Shuangyang\0"
+    "吉林省/长春市/九台区\0"
+    "吉林/长春/九台\0"
+    "Jiutai\0"
+    "吉林省/长春市/农安县\0"
+    "吉林/长春/农安\0"
+    "Nongan\0"
+    "吉林省/长春市/榆树市\0"
+    "吉林/长春/榆树\0"
+    "Yushu\0"
+    "吉林省/长春市/德惠市\0"
+    "吉林/长春/德惠\0"
+    "Dehui\0"
+    "吉林省/吉林市\0"
+    "吉林/吉林/吉林\0"
+    "Jilin\0"
+    "吉林省/吉林市/昌邑区\0"
+    "吉林/吉林/昌邑\0"
+    "Changyi\0"
+    "吉林省/吉林市/龙潭区\0"
+    "吉林/吉林/龙潭\0"
+    "Longtan\0"
+    "吉林省/吉林市/船营区\0"
+    "吉林/吉林/船营\0"
+    "Chuanying\0"
+    "吉林省/吉林市/丰满区\0"
+    "吉林/吉林/丰满\0"
+    "Fengman\0"
+    "吉林省/吉林市/永吉县\0"
+    "吉林/吉林/永吉\0"
+    "吉林省/吉林市/蛟河市\0"
+    "吉林/吉林/蛟河\0"
+    "Jiaohe\0"
+    "吉林省/吉林市/桦甸市\0"
+    "吉林/吉林/桦甸\0"
+    "Huadian\0"
+    "吉林省/吉林市/舒兰市\0"
+    "吉林/吉林/舒兰\0"
+    "Shulan\0"
+    "吉林省/吉林市/磐石市\0"
+    "吉林/吉林/磐石\0"
+    "Panshi\0"
+    "吉林省/四平市\0"
+    "吉林/四平/四平\0"
+    "Siping\0"
+    "吉林省/四平市/铁西区\0"
+    "吉林/四平/铁西\0"
+    "吉林省/四平市/铁东区\0"
+    "吉林/四平/铁东\0"
+    "吉林省/四平市/梨树县\0"
+    "吉林/四平/梨树\0"
+    "Lishu\0"
+    "吉林省/四平市/伊通满族自治县\0"
+    "吉林/四平/伊通\0"
+    "Yitong\0"
+    "吉林省/四平市/公主岭市\0"
+    "吉林/四平/公主岭\0"
+    "Gongzhuling\0"
+    "吉林省/四平市/双辽市\0"
+    "吉林/四平/双辽\0"
+    "Shuangliao\0"
+    "吉林省/辽源市\0"
+    "吉林/辽源/辽源\0"
+    "Liaoyuan\0"
+    "吉林省/辽源市/龙山区\0"
+    "吉林/辽源/龙山\0"
+    "Longshan\0"
+    "吉林省/辽源市/西安区\0"
+    "吉林/辽源/西安\0"
+    "Xian\0"
+    "吉林省/辽源市/东丰县\0"
+    "吉林/辽源/东丰\0"
+    "Dongfeng\0"
+    "吉林省/辽源市/东辽县\0"
+    "吉林/辽源/东辽\0"
+    "Dongliao\0"
+    "吉林省/通化市\0"
+    "吉林/通化/通化\0"
+    "Tonghua\0"
+    "吉林省/通化市/东昌区\0"
+    "吉林/通化/东昌\0"
+    "Dongchang\0"
+    "吉林省/通化市/二道江区\0"
+    "吉林/通化/二道江\0"
+    "Erdaojiang\0"
+    "吉林省/通化市/通化县\0"
+    "吉林/通化/通化县\0"
+    "Tonghuaxian\0"
+    "吉林省/通化市/辉南县\0"
+    "吉林/通化/辉南\0"
+    "Huinan\0"
+    "吉林省/通化市/柳河县\0"
+    "吉林/通化/柳河\0"
+    "Liuhe\0"
+    "吉林省/通化市/梅河口市\0"
+    "吉林/通化/梅河口\0"
+    "Meihekou\0"
+    "吉林省/通化市/集安市\0"
+    "吉林/通化/集安\0"
+    "Jian\0"
+    "吉林省/白山市\0"
+    "吉林/白山/白山\0"
+    "Baishan\0"
+    "吉林省/白山市/浑江区\0"
+    "吉林/白山/浑江\0"
+    "Hunjiang\0"
+    "吉林省/白山市/江源区\0"
+    "吉林/白山/江源\0"
+    "Jiangyuan\0"
+    "吉林省/白山市/抚松县\0"
+    "吉林/白山/抚松\0"
+    "Fusong\0"
+    "吉林省/白山市/靖宇县\0"
+    "吉林/白山/靖宇\0"
+    "Jingyu\0"
+    "吉林省/白山市/长白朝鲜族自治县\0"
+    "吉林/白山/长白\0"
+    "Changbai\0"
+    "吉林省/白山市/临江市\0"
+    "吉林/白山/临江\0"
+    "Linjiang\0"
+    "吉林省/松原市\0"
+    "吉林/松原/松原\0"
+    "Songyuan\0"
+    "吉林省/松原市/宁江区\0"
+    "吉林/松原/宁江\0"
+    "Ningjiang\0"
+    "吉林省/松原市/前郭尔罗斯蒙古族自治县\0"
+    "吉林/松原/前郭\0"
+    "Qianguo\0"
+    "吉林省/松原市/长岭县\0"
+    "吉林/松原/长岭\0"
+    "Changling\0"
+    "吉林省/松原市/乾安县\0"
+    "吉林/松原/乾安\0"
+    "吉林省/松原市/扶余市\0"
+    "吉林/松原/扶余\0"
+    "Fuyu\0"
+    "吉林省/白城市\0"
+    "吉林/白城/白城\0"
+    "Baicheng\0"
+    "吉林省/白城市/洮北区\0"
+    "吉林/白城/洮北\0"
+    "Taobei\0"
+    "吉林省/白城市/镇赉县\0"
+    "吉林/白城/镇赉\0"
+    "Zhenlai\0"
+    "吉林省/白城市/通榆县\0"
+    "吉林/白城/通榆\0"
+    "Tongyu\0"
+    "吉林省/白城市/洮南市\0"
+    "吉林/白城/洮南\0"
+    "Taonan\0"
+    "吉林省/白城市/大安市\0"
+    "吉林/白城/大安\0"
+    "Daan\0"
+    "吉林省/延边朝鲜族自治州\0"
+    "吉林/吉林/延边\0"
+    "Yanbian\0"
+    "吉林省/延边朝鲜族自治州/延吉市\0"
+    "吉林/延边/延吉\0"
+    "Yanji\0"
+    "吉林省/延边朝鲜族自治州/图们市\0"
+    "吉林/延边/图们\0"
+    "Tumen\0"
+    "吉林省/延边朝鲜族自治州/敦化市\0"
+    "吉林/延边/敦化\0"
+    "Dunhua\0"
+    "吉林省/延边朝鲜族自治州/珲春市\0"
+    "吉林/延边/珲春\0"
+    "Hunchun\0"
+    "吉林省/延边朝鲜族自治州/龙井市\0"
+    "吉林/延边/龙井\0"
+    "Longjing\0"
+    "吉林省/延边朝鲜族自治州/和龙市\0"
+    "吉林/延边/和龙\0"
+    "Helong\0"
+    "吉林省/延边朝鲜族自治州/汪清县\0"
+    "吉林/延边/汪清\0"
+    "Wangqing\0"
+    "吉林省/延边朝鲜族自治州/安图县\0"
+    "吉林/延边/安图\0"
+    "Antu\0"
+    "黑龙江省/哈尔滨市\0"
+    "黑龙江/哈尔滨/哈尔滨\0"
+    "Haerbin\0"
+    "黑龙江省/哈尔滨市/道里区\0"
+    "黑龙江/哈尔滨/道里\0"
+    "Daoli\0"
+    "黑龙江省/哈尔滨市/南岗区\0"
+    "黑龙江/哈尔滨/南岗\0"
+    "Nangang\0"
+    "黑龙江省/哈尔滨市/道外区\0"
+    "黑龙江/哈尔滨/道外\0"
+    "Daowai\0"
+    "黑龙江省/哈尔滨市/平房区\0"
+    "黑龙江/哈尔滨/平房\0"
+    "Pingfang\0"
+    "黑龙江省/哈尔滨市/松北区\0"
+    "黑龙江/哈尔滨/松北\0"
+    "Songbei\0"
+    "黑龙江省/哈尔滨市/香坊区\0"
+    "黑龙江/哈尔滨/香坊\0"
+    "Xiangfang\0"
+    "黑龙江省/哈尔滨市/呼兰区\0"
+    "黑龙江/哈尔滨/呼兰\0"
+    "Hulan\0"
+    "黑龙江省/哈尔滨市/阿城区\0"
+    "黑龙江/哈尔滨/阿城\0"
+    "Acheng\0"
+    "黑龙江省/哈尔滨市/双城区\0"
+    "黑龙江/哈尔滨/双城\0"
+    "Shuangcheng\0"
+    "黑龙江省/哈尔滨市/依兰县\0"
+    "黑龙江/哈尔滨/依兰\0"
+    "Yilan\0"
+    "黑龙江省/哈尔滨市/方正县\0"
+    "黑龙江/哈尔滨/方正\0"
+    "Fangzheng\0"
+    "黑龙江省/哈尔滨市/宾县\0"
+    "黑龙江/哈尔滨/宾县\0"
+    "Binxian\0"
+    "黑龙江省/哈尔滨市/巴彦县\0"
+    "黑龙江/哈尔滨/巴彦\0"
+    "Bayan\0"
+    "黑龙江省/哈尔滨市/木兰县\0"
+    "黑龙江/哈尔滨/木兰\0"
+    "Mulan\0"
+    "黑龙江省/哈尔滨市/通河县\0"
+    "黑龙江/哈尔滨/通河\0"
+    "Tonghe\0"
+    "黑龙江省/哈尔滨市/延寿县\0"
+    "黑龙江/哈尔滨/延寿\0"
+    "Yanshou\0"
+    "黑龙江省/哈尔滨市/尚志市\0"
+    "黑龙江/哈尔滨/尚志\0"
+    "Shangzhi\0"
+    "黑龙江省/哈尔滨市/五常市\0"
+    "黑龙江/哈尔滨/五常\0"
+    "Wuchang\0"
+    "黑龙江省/齐齐哈尔市\0"
+    "黑龙江/齐齐哈尔/齐齐哈尔\0"
+    "Qiqihaer\0"
+    "黑龙江省/齐齐哈尔市/龙沙区\0"
+    "黑龙江/齐齐哈尔/龙沙\0"
+    "Longsha\0"
+    "黑龙江省/齐齐哈尔市/建华区\0"
+    "黑龙江/齐齐哈尔/建华\0"
+    "Jianhua\0"
+    "黑龙江省/齐齐哈尔市/铁锋区\0"
+    "黑龙江/齐齐哈尔/铁锋\0"
+    "Tiefeng\0"
+    "黑龙江省/齐齐哈尔市/昂昂溪区\0"
+    "黑龙江/齐齐哈尔/昂昂溪\0"
+    "Angangxi\0"
+    "黑龙江省/齐齐哈尔市/富拉尔基区\0"
+    "黑龙江/齐齐哈尔/富拉尔基\0"
+    "Fulaerji\0"
+    "黑龙江省/齐齐哈尔市/碾子山区\0"
+    "黑龙江/齐齐哈尔/碾子山\0"
+    "Nianzishan\0"
+    "黑龙江省/齐齐哈尔市/梅里斯达斡尔族区\0"
+    "黑龙江/齐齐哈尔/梅里斯\0"
+    "Meilisi\0"
+    "黑龙江省/齐齐哈尔市/龙江县\0"
+    "黑龙江/齐齐哈尔/龙江\0"
+    "Longjiang\0"
+    "黑龙江省/齐齐哈尔市/依安县\0"
+    "黑龙江/齐齐哈尔/依安\0"
+    "Yian\0"
+    "黑龙江省/齐齐哈尔市/泰来县\0"
+    "黑龙江/齐齐哈尔/泰来\0"
+    "Tailai\0"
+    "黑龙江省/齐齐哈尔市/甘南县\0"
+    "黑龙江/齐齐哈尔/甘南\0"
+    "Gannan\0"
+    "黑龙江省/齐齐哈尔市/富裕县\0"
+    "黑龙江/齐齐哈尔/富裕\0"
+    "黑龙江省/齐齐哈尔市/克山县\0"
+    "黑龙江/齐齐哈尔/克山\0"
+    "Keshan\0"
+    "黑龙江省/齐齐哈尔市/克东县\0"
+    "黑龙江/齐齐哈尔/克东\0"
+    "Kedong\0"
+    "黑龙江省/齐齐哈尔市/拜泉县\0"
+    "黑龙江/齐齐哈尔/拜泉\0"
+    "Baiquan\0"
+    "黑龙江省/齐齐哈尔市/讷河市\0"
+    "黑龙江/齐齐哈尔/讷河\0"
+    "Nehe\0"
+    "黑龙江省/鸡西市\0"
+    "黑龙江/鸡西/鸡西\0"
+    "Jixi\0"
+    "黑龙江省/鸡西市/鸡冠区\0"
+    "黑龙江/鸡西/鸡冠\0"
+    "Jiguan\0"
+    "黑龙江省/鸡西市/恒山区\0"
+    "黑龙江/鸡西/恒山\0"
+    "Hengshan\0"
+    "黑龙江省/鸡西市/滴道区\0"
+    "黑龙江/鸡西/滴道\0"
+    "Didao\0"
+    "黑龙江省/鸡西市/梨树区\0"
+    "黑龙江/鸡西/梨树\0"
+    "黑龙江省/鸡西市/城子河区\0"
+    "黑龙江/鸡西/城子河\0"
+    "Chengzihe\0"
+    "黑龙江省/鸡西市/麻山区\0"
+    "黑龙江/鸡西/麻山\0"
+    "Mashan\0"
+    "黑龙江省/鸡西市/鸡东县\0"
+    "黑龙江/鸡西/鸡东\0"
+    "Jidong\0"
+    "黑龙江省/鸡西市/虎林市\0"
+    "黑龙江/鸡西/虎林\0"
+    "Hulin\0"
+    "黑龙江省/鸡西市/密山市\0"
+    "黑龙江/鸡西/密山\0"
+    "Mishan\0"
+    "黑龙江省/鹤岗市\0"
+    "黑龙江/鹤岗/鹤岗\0"
+    "Hegang\0"
+    "黑龙江省/鹤岗市/向阳区\0"
+    "黑龙江/鹤岗/向阳\0"
+    "Xiangyang\0"
+    "黑龙江省/鹤岗市/工农区\0"
+    "黑龙江/鹤岗/工农\0"
+    "Gongnong\0"
+    "黑龙江省/鹤岗市/南山区\0"
+    "黑龙江/鹤岗/南山\0"
+    "Nanshan\0"
+    "黑龙江省/鹤岗市/兴安区\0"
+    "黑龙江/鹤岗/兴安\0"
+    "黑龙江省/鹤岗市/东山区\0"
+    "黑龙江/鹤岗/东山\0"
+    "Dongshan\0"
+    "黑龙江省/鹤岗市/兴山区\0"
+    "黑龙江/鹤岗/兴山\0"
+    "Xingshan\0"
+    "黑龙江省/鹤岗市/萝北县\0"
+    "黑龙江/鹤岗/萝北\0"
+    "Luobei\0"
+    "黑龙江省/鹤岗市/绥滨县\0"
+    "黑龙江/鹤岗/绥滨\0"
+    "Suibin\0"
+    "黑龙江省/双鸭山市\0"
+    "黑龙江/双鸭山/双鸭山\0"
+    "Shuangyashan\0"
+    "黑龙江省/双鸭山市/尖山区\0"
+    "黑龙江/双鸭山/尖山\0"
+    "Jianshan\0"
+    "黑龙江省/双鸭山市/岭东区\0"
+    "黑龙江/双鸭山/岭东\0"
+    "Lingdong\0"
+    "黑龙江省/双鸭山市/四方台区\0"
+    "黑龙江/双鸭山/四方台\0"
+    "Sifangtai\0"
+    "黑龙江省/双鸭山市/宝山区\0"
+    "黑龙江/双鸭山/宝山\0"
+    "Baoshan\0"
+    "黑龙江省/双鸭山市/集贤县\0"
+    "黑龙江/双鸭山/集贤\0"
+    "黑龙江省/双鸭山市/友谊县\0"
+    "黑龙江/双鸭山/友谊\0"
+    "Youyi\0"
+    "黑龙江省/双鸭山市/宝清县\0"
+    "黑龙江/双鸭山/宝清\0"
+    "Baoqing\0"
+    "黑龙江省/双鸭山市/饶河县\0"
+    "黑龙江/双鸭山/饶河\0"
+    "Raohe\0"
+    "黑龙江省/大庆市\0"
+    "黑龙江/大庆/大庆\0"
+    "Daqing\0"
+    "黑龙江省/大庆市/萨尔图区\0"
+    "黑龙江/大庆/萨尔图\0"
+    "Saertu\0"
+    "黑龙江省/大庆市/龙凤区\0"
+    "黑龙江/大庆/龙凤\0"
+    "Longfeng\0"
+    "黑龙江省/大庆市/让胡路区\0"
+    "黑龙江/大庆/让胡路\0"
+    "Ranghulu\0"
+    "黑龙江省/大庆市/红岗区\0"
+    "黑龙江/大庆/红岗\0"
+    "Honggang\0"
+    "黑龙江省/大庆市/大同区\0"
+    "黑龙江/大庆/大同\0"
+    "黑龙江省/大庆市/肇州县\0"
+    "黑龙江/大庆/肇州\0"
+    "Zhaozhou\0"
+    "黑龙江省/大庆市/肇源县\0"
+    "黑龙江/大庆/肇源\0"
+    "Zhaoyuan\0"
+    "黑龙江省/大庆市/林甸县\0"
+    "黑龙江/大庆/林甸\0"
+    "Lindian\0"
+    "黑龙江省/大庆市/杜尔伯特蒙古族自治县\0"
+    "黑龙江/大庆/杜尔伯特\0"
+    "Duerbote\0"
+    "黑龙江省/伊春市\0"
+    "黑龙江/伊春\0"
+    "Yichun\0"
+    "黑龙江省/伊春市/伊春区\0"
+    "黑龙江/伊春/伊春\0"
+    "黑龙江省/伊春市/南岔区\0"
+    "黑龙江/伊春/南岔\0"
+    "Nancha\0"
+    "黑龙江省/伊春市/友好区\0"
+    "黑龙江/伊春/友好\0"
+    "Youhao\0"
+    "黑龙江省/伊春市/西林区\0"
+    "黑龙江/伊春/西林\0"
+    "Xilin\0"
+    "黑龙江省/伊春市/翠峦区\0"
+    "黑龙江/伊春/翠峦\0"
+    "Cuiluan\0"
+    "黑龙江省/伊春市/新青区\0"
+    "黑龙江/伊春/新青\0"
+    "Xinqing\0"
+    "黑龙江省/伊春市/美溪区\0"
+    "黑龙江/伊春/美溪\0"
+    "Meixi\0"
+    "黑龙江省/伊春市/金山屯区\0"
+    "黑龙江/伊春/金山屯\0"
+    "Jinshantun\0"
+    "黑龙江省/伊春市/五营区\0"
+    "黑龙江/伊春/五营\0"
+    "Wuying\0"
+    "黑龙江省/伊春市/乌马河区\0"
+    "黑龙江/伊春/乌马河\0"
+    "Wumahe\0"
+    "黑龙江省/伊春市/汤旺河区\0"
+    "黑龙江/伊春/汤旺河\0"
+    "Tangwanghe\0"
+    "黑龙江省/伊春市/带岭区\0"
+    "黑龙江/伊春/带岭\0"
+    "Dailing\0"
+    "黑龙江省/伊春市/乌伊岭区\0"
+    "黑龙江/伊春/乌伊岭\0"
+    "Wuyiling\0"
+    "黑龙江省/伊春市/红星区\0"
+    "黑龙江/伊春/红星\0"
+    "Hongxing\0"
+    "黑龙江省/伊春市/上甘岭区\0"
+    "黑龙江/伊春/上甘岭\0"
+    "Shangganling\0"
+    "黑龙江省/伊春市/嘉荫县\0"
+    "黑龙江/伊春/嘉荫\0"
+    "Jiayin\0"
+    "黑龙江省/伊春市/铁力市\0"
+    "黑龙江/伊春/铁力\0"
+    "Tieli\0"
+    "黑龙江省/佳木斯市\0"
+    "黑龙江/佳木斯/佳木斯\0"
+    "Jiamusi\0"
+    "黑龙江省/佳木斯市/向阳区\0"
+    "黑龙江/佳木斯/向阳\0"
+    "黑龙江省/佳木斯市/前进区\0"
+    "黑龙江/佳木斯/前进\0"
+    "Qianjin\0"
+    "黑龙江省/佳木斯市/东风区\0"
+    "黑龙江/佳木斯/东风\0"
+    "黑龙江省/佳木斯市/郊区\0"
+    "黑龙江/佳木斯/郊区\0"
+    "黑龙江省/佳木斯市/桦南县\0"
+    "黑龙江/佳木斯/桦南\0"
+    "Huanan\0"
+    "黑龙江省/佳木斯市/桦川县\0"
+    "黑龙江/佳木斯/桦川\0"
+    "Huachuan\0"
+    "黑龙江省/佳木斯市/汤原县\0"
+    "黑龙江/佳木斯/汤原\0"
+    "Tangyuan\0"
+    "黑龙江省/佳木斯市/同江市\0"
+    "黑龙江/佳木斯/同江\0"
+    "Tongjiang\0"
+    "黑龙江省/佳木斯市/富锦市\0"
+    "黑龙江/佳木斯/富锦\0"
+    "Fujin\0"
+    "黑龙江省/佳木斯市/抚远市\0"
+    "黑龙江/佳木斯/抚远\0"
+    "Fuyuan\0"
+    "黑龙江省/七台河市\0"
+    "黑龙江/七台河/七台河\0"
+    "Qitaihe\0"
+    "黑龙江省/七台河市/新兴区\0"
+    "黑龙江/七台河/新兴\0"
+    "Xinxing\0"
+    "黑龙江省/七台河市/桃山区\0"
+    "黑龙江/七台河/桃山\0"
+    "Taoshan\0"
+    "黑龙江省/七台河市/茄子河区\0"
+    "黑龙江/七台河/茄子河\0"
+    "Qiezihe\0"
+    "黑龙江省/七台河市/勃利县\0"
+    "黑龙江/七台河/勃利\0"
+    "Boli\0"
+    "黑龙江省/牡丹江市\0"
+    "黑龙江/牡丹江/牡丹江\0"
+    "Mudanjiang\0"
+    "黑龙江省/牡丹江市/东安区\0"
+    "黑龙江/牡丹江/东安\0"
+    "Dongan\0"
+    "黑龙江省/牡丹江市/阳明区\0"
+    "黑龙江/牡丹江/阳明\0"
+    "Yangming\0"
+    "黑龙江省/牡丹江市/爱民区\0"
+    "黑龙江/牡丹江/爱民\0"
+    "Aimin\0"
+    "黑龙江省/牡丹江市/西安区\0"
+    "黑龙江/牡丹江/西安\0"
+    "黑龙江省/牡丹江市/林口县\0"
+    "黑龙江/牡丹江/林口\0"
+    "Linkou\0"
+    "黑龙江省/牡丹江市/绥芬河市\0"
+    "黑龙江/牡丹江/绥芬河\0"
+    "Suifenhe\0"
+    "黑龙江省/牡丹江市/海林市\0"
+    "黑龙江/牡丹江/海林\0"
+    "Hailin\0"
+    "黑龙江省/牡丹江市/宁安市\0"
+    "黑龙江/牡丹江/宁安\0"
+    "Ningan\0"
+    "黑龙江省/牡丹江市/穆棱市\0"
+    "黑龙江/牡丹江/穆棱\0"
+    "Muling\0"
+    "黑龙江省/牡丹江市/东宁市\0"
+    "黑龙江/牡丹江/东宁\0"
+    "Dongning\0"
+    "黑龙江省/黑河市\0"
+    "黑龙江/黑河/黑河\0"
+    "Heihe\0"
+    "黑龙江省/黑河市/爱辉区\0"
+    "黑龙江/黑河/爱辉\0"
+    "Aihui\0"
+    "黑龙江省/黑河市/嫩江县\0"
+    "黑龙江/黑河/嫩江\0"
+    "Nenjiang\0"
+    "黑龙江省/黑河市/逊克县\0"
+    "黑龙江/黑河/逊克\0"
+    "Xunke\0"
+    "黑龙江省/黑河市/孙吴县\0"
+    "黑龙江/黑河/孙吴\0"
+    "Sunwu\0"
+    "黑龙江省/黑河市/北安市\0"
+    "黑龙江/黑河/北安\0"
+    "Beian\0"
+    "黑龙江省/黑河市/五大连池市\0"
+    "黑龙江/黑河/五大连池\0"
+    "Wudalianchi\0"
+    "黑龙江省/绥化市\0"
+    "黑龙江/绥化/绥化\0"
+    "Suihua\0"
+    "黑龙江省/绥化市/北林区\0"
+    "黑龙江/绥化/北林\0"
+    "Beilin\0"
+    "黑龙江省/绥化市/望奎县\0"
+    "黑龙江/绥化/望奎\0"
+    "Wangkui\0"
+    "黑龙江省/绥化市/兰西县\0"
+    "黑龙江/绥化/兰西\0"
+    "Lanxi\0"
+    "黑龙江省/绥化市/青冈县\0"
+    "黑龙江/绥化/青冈\0"
+    "Qinggang\0"
+    "黑龙江省/绥化市/庆安县\0"
+    "黑龙江/绥化/庆安\0"
+    "Qingan\0"
+    "黑龙江省/绥化市/明水县\0"
+    "黑龙江/绥化/明水\0"
+    "Mingshui\0"
+    "黑龙江省/绥化市/绥棱县\0"
+    "黑龙江/绥化/绥棱\0"
+    "Suiling\0"
+    "黑龙江省/绥化市/安达市\0"
+    "黑龙江/绥化/安达\0"
+    "Anda\0"
+    "黑龙江省/绥化市/肇东市\0"
+    "黑龙江/绥化/肇东\0"
+    "Zhaodong\0"
+    "黑龙江省/绥化市/海伦市\0"
+    "黑龙江/绥化/海伦\0"
+    "Hailun\0"
+    "黑龙江省/大兴安岭地区\0"
+    "黑龙江/大兴安岭/大兴安岭\0"
+    "Daxinganling\0"
+    "黑龙江省/大兴安岭地区/漠河市\0"
+    "黑龙江/大兴安岭/漠河\0"
+    "Mohe\0"
+    "黑龙江省/大兴安岭地区/加格达奇区\0"
+    "黑龙江/大兴安岭/加格达奇\0"
+    "Jiagedaqi\0"
+    "黑龙江省/大兴安岭地区/呼玛县\0"
+    "黑龙江/大兴安岭/呼玛\0"
+    "Huma\0"
+    "黑龙江省/大兴安岭地区/塔河县\0"
+    "黑龙江/大兴安岭/塔河\0"
+    "Tahe\0"
+    "上海市\0"
+    "上海/上海\0"
+    "Shanghai\0"
+    "上海市/黄浦区\0"
+    "上海/黄浦\0"
+    "Huangpu\0"
+    "上海市/徐汇区\0"
+    "上海/徐汇区\0"
+    "Xujiahui\0"
+    "上海市/长宁区\0"
+    "上海/长宁\0"
+    "Changning\0"
+    "上海市/静安区\0"
+    "上海/静安\0"
+    "Jingan\0"
+    "上海市/普陀区\0"
+    "上海/普陀\0"
+    "Putuo\0"
+    "上海市/虹口区\0"
+    "上海/虹口\0"
+    "Hongkou\0"
+    "上海市/杨浦区\0"
+    "上海/杨浦\0"
+    "Yangpu\0"
+    "上海市/闵行区\0"
+    "上海/闵行\0"
+    "Minhang\0"
+    "上海市/宝山区\0"
+    "上海/宝山\0"
+    "上海市/嘉定区\0"
+    "上海/嘉定\0"
+    "Jiading\0"
+    "上海市/浦东新区\0"
+    "上海/浦东新区\0"
+    "Pudong\0"
+    "上海市/金山区\0"
+    "上海/金山\0"
+    "Jinshan\0"
+    "上海市/松江区\0"
+    "上海/松江\0"
+    "Songjiang\0"
+    "上海市/青浦区\0"
+    "上海/青浦\0"
+    "Qingpu\0"
+    "上海市/奉贤区\0"
+    "上海/奉贤\0"
+    "Fengxian\0"
+    "上海市/崇明区\0"
+    "上海/崇明\0"
+    "Chongming\0"
+    "江苏省/南京市\0"
+    "江苏/南京/南京\0"
+    "Nanjing\0"
+    "江苏省/南京市/玄武区\0"
+    "江苏/南京/玄武\0"
+    "Xuanwu\0"
+    "江苏省/南京市/秦淮区\0"
+    "江苏/南京/秦淮\0"
+    "Qinhuai\0"
+    "江苏省/南京市/建邺区\0"
+    "江苏/南京/建邺\0"
+    "Jianye\0"
+    "江苏省/南京市/鼓楼区\0"
+    "江苏/南京/鼓楼\0"
+    "Gulou\0"
+    "江苏省/南京市/浦口区\0"
+    "江苏/南京/浦口\0"
+    "Pukou\0"
+    "江苏省/南京市/栖霞区\0"
+    "江苏/南京/栖霞\0"
+    "Qixia\0"
+    "江苏省/南京市/雨花台区\0"
+    "江苏/南京/雨花台\0"
+    "Yuhuatai\0"
+    "江苏省/南京市/江宁区\0"
+    "江苏/南京/江宁\0"
+    "Jiangning\0"
+    "江苏省/南京市/六合区\0"
+    "江苏/南京/六合\0"
+    "Luhe\0"
+    "江苏省/南京市/溧水区\0"
+    "江苏/南京/溧水\0"
+    "Lishui\0"
+    "江苏省/南京市/高淳区\0"
+    "江苏/南京/高淳\0"
+    "Gaochun\0"
+    "江苏省/无锡市\0"
+    "江苏/无锡/无锡\0"
+    "Wuxi\0"
+    "江苏省/无锡市/锡山区\0"
+    "江苏/无锡/锡山\0"
+    "Xishan\0"
+    "江苏省/无锡市/惠山区\0"
+    "江苏/无锡/惠山\0"
+    "Huishan\0"
+    "江苏省/无锡市/滨湖区\0"
+    "江苏/无锡/滨湖\0"
+    "Binhu\0"
+    "江苏省/无锡市/梁溪区\0"
+    "江苏/无锡/梁溪\0"
+    "Liangxi\0"
+    "江苏省/无锡市/新吴区\0"
+    "江苏/无锡/新吴\0"
+    "Xinwu\0"
+    "江苏省/无锡市/江阴市\0"
+    "江苏/无锡/江阴\0"
+    "Jiangyin\0"
+    "江苏省/无锡市/宜兴市\0"
+    "江苏/无锡/宜兴\0"
+    "Yixing\0"
+    "江苏省/徐州市\0"
+    "江苏/徐州/徐州\0"
+    "Xuzhou\0"
+    "江苏省/徐州市/鼓楼区\0"
+    "江苏/徐州/鼓楼\0"
+    "江苏省/徐州市/云龙区\0"
+    "江苏/徐州/云龙\0"
+    "Yunlong\0"
+    "江苏省/徐州市/贾汪区\0"
+    "江苏/徐州/贾汪\0"
+    "Jiawang\0"
+    "江苏省/徐州市/泉山区\0"
+    "江苏/徐州/泉山\0"
+    "Quanshan\0"
+    "江苏省/徐州市/铜山区\0"
+    "江苏/徐州/铜山\0"
+    "Tongshan\0"
+    "江苏省/徐州市/丰县\0"
+    "江苏/徐州/丰县\0"
+    "江苏省/徐州市/沛县\0"
+    "江苏/徐州/沛县\0"
+    "Peixian\0"
+    "江苏省/徐州市/睢宁县\0"
+    "江苏/徐州/睢宁\0"
+    "Suining\0"
+    "江苏省/徐州市/新沂市\0"
+    "江苏/徐州/新沂\0"
+    "Xinyi\0"
+    "江苏省/徐州市/邳州市\0"
+    "江苏/徐州/邳州\0"
+    "Pizhou\0"
+    "江苏省/常州市\0"
+    "江苏/常州/常州\0"
+    "Changzhou\0"
+    "江苏省/常州市/天宁区\0"
+    "江苏/常州/天宁\0"
+    "Tianning\0"
+    "江苏省/常州市/钟楼区\0"
+    "江苏/常州/钟楼\0"
+    "Zhonglou\0"
+    "江苏省/常州市/新北区\0"
+    "江苏/常州/新北\0"
+    "Xinbei\0"
+    "江苏省/常州市/武进区\0"
+    "江苏/常州/武进\0"
+    "Wujin\0"
+    "江苏省/常州市/金坛区\0"
+    "江苏/常州/金坛\0"
+    "Jintan\0"
+    "江苏省/常州市/溧阳市\0"
+    "江苏/常州/溧阳\0"
+    "Liyang\0"
+    "江苏省/苏州市\0"
+    "江苏/苏州/苏州\0"
+    "Suzhou\0"
+    "江苏省/苏州市/虎丘区\0"
+    "江苏/苏州/虎丘\0"
+    "Huqiu\0"
+    "江苏省/苏州市/吴中区\0"
+    "江苏/苏州/吴中\0"
+    "Wuzhong\0"
+    "江苏省/苏州市/相城区\0"
+    "江苏/苏州/相城\0"
+    "Xiangcheng\0"
+    "江苏省/苏州市/姑苏区\0"
+    "江苏/苏州/姑苏\0"
+    "Gusu\0"
+    "江苏省/苏州市/吴江区\0"
+    "江苏/苏州/吴江\0"
+    "Wujiang\0"
+    "江苏省/苏州市/常熟市\0"
+    "江苏/苏州/常熟\0"
+    "Changshu\0"
+    "江苏省/苏州市/张家港市\0"
+    "江苏/苏州/张家港\0"
+    "Zhangjiagang\0"
+    "江苏省/苏州市/昆山市\0"
+    "江苏/苏州/昆山\0"
+    "Kunshan\0"
+    "江苏省/苏州市/太仓市\0"
+    "江苏/苏州/太仓\0"
+    "Taicang\0"
+    "江苏省/南通市\0"
+    "江苏/南通/南通\0"
+    "Nantong\0"
+    "江苏省/南通市/崇川区\0"
+    "江苏/南通/崇川\0"
+    "Chongchuan\0"
+    "江苏省/南通市/港闸区\0"
+    "江苏/南通/港闸\0"
+    "Gangzha\0"
+    "江苏省/南通市/通州区\0"
+    "江苏/南通/通州\0"
+    "江苏省/南通市/如东县\0"
+    "江苏/南通/如东\0"
+    "Rudong\0"
+    "江苏省/南通市/启东市\0"
+    "江苏/南通/启东\0"
+    "Qidong\0"
+    "江苏省/南通市/如皋市\0"
+    "江苏/南通/如皋\0"
+    "Rugao\0"
+    "江苏省/南通市/海门市\0"
+    "江苏/南通/海门\0"
+    "Haimen\0"
+    "江苏省/南通市/海安市\0"
+    "江苏/南通/海安\0"
+    "Haian\0"
+    "江苏省/连云港市\0"
+    "江苏/连云港/连云港\0"
+    "Lianyungang\0"
+    "江苏省/连云港市/连云区\0"
+    "江苏/连云港/连云\0"
+    "Lianyun\0"
+    "江苏省/连云港市/海州区\0"
+    "江苏/连云港/海州\0"
+    "江苏省/连云港市/赣榆区\0"
+    "江苏/连云港/赣榆\0"
+    "Ganyu\0"
+    "江苏省/连云港市/东海县\0"
+    "江苏/连云港/东海\0"
+    "Donghai\0"
+    "江苏省/连云港市/灌云县\0"
+    "江苏/连云港/灌云\0"
+    "Guanyun\0"
+    "江苏省/连云港市/灌南县\0"
+    "江苏/连云港/灌南\0"
+    "Guannan\0"
+    "江苏省/淮安市\0"
+    "江苏/淮安/淮安\0"
+    "江苏省/淮安市/淮安区\0"
+    "江苏/淮安/淮安区\0"
+    "Huaianqu\0"
+    "江苏省/淮安市/淮阴区\0"
+    "江苏/淮安/淮阴区\0"
+    "Huaiyinqu\0"
+    "江苏省/淮安市/清江浦区\0"
+    "江苏/淮安/清江浦\0"
+    "Qingjiangpu\0"
+    "江苏省/淮安市/洪泽区\0"
+    "江苏/淮安/洪泽\0"
+    "Hongze\0"
+    "江苏省/淮安市/涟水县\0"
+    "江苏/淮安/涟水\0"
+    "Lianshui\0"
+    "江苏省/淮安市/盱眙县\0"
+    "江苏/淮安/盱眙\0"
+    "Xuyi\0"
+    "江苏省/淮安市/金湖县\0"
+    "江苏/淮安/金湖\0"
+    "Jinhu\0"
+    "江苏省/盐城市\0"
+    "江苏/盐城/盐城\0"
+    "Yancheng\0"
+    "江苏省/盐城市/亭湖区\0"
+    "江苏/盐城/亭湖\0"
+    "Tinghu\0"
+    "江苏省/盐城市/盐都区\0"
+    "江苏/盐城/盐都\0"
+    "Yandu\0"
+    "江苏省/盐城市/大丰区\0"
+    "江苏/盐城/大丰\0"
+    "Dafeng\0"
+    "江苏省/盐城市/响水县\0"
+    "江苏/盐城/响水\0"
+    "Xiangshui\0"
+    "江苏省/盐城市/滨海县\0"
+    "江苏/盐城/滨海\0"
+    "Binhai\0"
+    "江苏省/盐城市/阜宁县\0"
+    "江苏/盐城/阜宁\0"
+    "江苏省/盐城市/射阳县\0"
+    "江苏/盐城/射阳\0"
+    "Sheyang\0"
+    "江苏省/盐城市/建湖县\0"
+    "江苏/盐城/建湖\0"
+    "Jianhu\0"
+    "江苏省/盐城市/东台市\0"
+    "江苏/盐城/东台\0"
+    "Dongtai\0"
+    "江苏省/扬州市\0"
+    "江苏/扬州/扬州\0"
+    "Yangzhou\0"
+    "江苏省/扬州市/广陵区\0"
+    "江苏/扬州/广陵\0"
+    "江苏省/扬州市/邗江区\0"
+    "江苏/扬州/邗江\0"
+    "Hanjiang\0"
+    "江苏省/扬州市/江都区\0"
+    "江苏/扬州/江都\0"
+    "Jiangdu\0"
+    "江苏省/扬州市/宝应县\0"
+    "江苏/扬州/宝应\0"
+    "Baoying\0"
+    "江苏省/扬州市/仪征市\0"
+    "江苏/扬州/仪征\0"
+    "Yizheng\0"
+    "江苏省/扬州市/高邮市\0"
+    "江苏/扬州/高邮\0"
+    "Gaoyou\0"
+    "江苏省/镇江市\0"
+    "江苏/镇江/镇江\0"
+    "Zhenjiang\0"
+    "江苏省/镇江市/京口区\0"
+    "江苏/镇江/京口\0"
+    "Jingkou\0"
+    "江苏省/镇江市/润州区\0"
+    "江苏/镇江/润州\0"
+    "Runzhou\0"
+    "江苏省/镇江市/丹徒区\0"
+    "江苏/镇江/丹徒\0"
+    "Dantu\0"
+    "江苏省/镇江市/丹阳市\0"
+    "江苏/镇江/丹阳\0"
+    "Danyang\0"
+    "江苏省/镇江市/扬中市\0"
+    "江苏/镇江/扬中\0"
+    "Yangzhong\0"
+    "江苏省/镇江市/句容市\0"
+    "江苏/镇江/句容\0"
+    "Jurong\0"
+    "江苏省/泰州市\0"
+    "江苏/泰州/泰州\0"
+    "Taizhou\0"
+    "江苏省/泰州市/海陵区\0"
+    "江苏/泰州/海陵\0"
+    "Hailing\0"
+    "江苏省/泰州市/高港区\0"
+    "江苏/泰州/高港\0"
+    "Gaogang\0"
+    "江苏省/泰州市/姜堰区\0"
+    "江苏/泰州/姜堰\0"
+    "Jiangyan\0"
+    "江苏省/泰州市/兴化市\0"
+    "江苏/泰州/兴化\0"
+    "Xinghua\0"
+    "江苏省/泰州市/靖江市\0"
+    "江苏/泰州/靖江\0"
+    "Jingjiang\0"
+    "江苏省/泰州市/泰兴市\0"
+    "江苏/泰州/泰兴\0"
+    "Taixing\0"
+    "江苏省/宿迁市\0"
+    "江苏/宿迁/宿迁\0"
+    "Suqian\0"
+    "江苏省/宿迁市/宿城区\0"
+    "江苏/宿迁/宿城\0"
+    "Sucheng\0"
+    "江苏省/宿迁市/宿豫区\0"
+    "江苏/宿迁/宿豫\0"
+    "Suyu\0"
+    "江苏省/宿迁市/沭阳县\0"
+    "江苏/宿迁/沭阳\0"
+    "Shuyang\0"
+    "江苏省/宿迁市/泗阳县\0"
+    "江苏/宿迁/泗阳\0"
+    "Siyang\0"
+    "江苏省/宿迁市/泗洪县\0"
+    "江苏/宿迁/泗洪\0"
+    "Sihong\0"
+    "浙江省/杭州市\0"
+    "浙江/杭州/杭州\0"
+    "Hangzhou\0"
+    "浙江省/杭州市/上城区\0"
+    "浙江/杭州/上城\0"
+    "Shangcheng\0"
+    "浙江省/杭州市/下城区\0"
+    "浙江/杭州/下城\0"
+    "Xiacheng\0"
+    "浙江省/杭州市/江干区\0"
+    "浙江/杭州/江干\0"
+    "Jianggan\0"
+    "浙江省/杭州市/拱墅区\0"
+    "浙江/杭州/拱墅\0"
+    "Gongshu\0"
+    "浙江省/杭州市/西湖区\0"
+    "浙江/杭州/西湖\0"
+    "浙江省/杭州市/滨江区\0"
+    "浙江/杭州/滨江\0"
+    "Binjiang\0"
+    "浙江省/杭州市/萧山区\0"
+    "浙江/杭州/萧山\0"
+    "Xiaoshan\0"
+    "浙江省/杭州市/余杭区\0"
+    "浙江/杭州/余杭\0"
+    "Yuhang\0"
+    "浙江省/杭州市/富阳区\0"
+    "浙江/杭州/富阳\0"
+    "Fuyang\0"
+    "浙江省/杭州市/临安区\0"
+    "浙江/杭州/临安\0"
+    "Linan\0"
+    "浙江省/杭州市/桐庐县\0"
+    "浙江/杭州/桐庐\0"
+    "Tonglu\0"
+    "浙江省/杭州市/淳安县\0"
+    "浙江/杭州/淳安\0"
+    "Chunan\0"
+    "浙江省/杭州市/建德市\0"
+    "浙江/杭州/建德\0"
+    "Jiande\0"
+    "浙江省/宁波市\0"
+    "浙江/宁波/宁波\0"
+    "Ningbo\0"
+    "浙江省/宁波市/海曙区\0"
+    "浙江/宁波/海曙\0"
+    "Haishu\0"
+    "浙江省/宁波市/江北区\0"
+    "浙江/宁波/江北\0"
+    "Jiangbei\0"
+    "浙江省/宁波市/北仑区\0"
+    "浙江/宁波/北仑\0"
+    "Beilun\0"
+    "浙江省/宁波市/镇海区\0"
+    "浙江/宁波/镇海\0"
+    "Zhenhai\0"
+    "浙江省/宁波市/鄞州区\0"
+    "浙江/宁波/鄞州\0"
+    "浙江省/宁波市/奉化区\0"
+    "浙江/宁波/奉化\0"
+    "Fenghua\0"
+    "浙江省/宁波市/象山县\0"
+    "浙江/宁波/象山\0"
+    "Xiangshan\0"
+    "浙江省/宁波市/宁海县\0"
+    "浙江/宁波/宁海\0"
+    "Ninghai\0"
+    "浙江省/宁波市/余姚市\0"
+    "浙江/宁波/余姚\0"
+    "Yuyao\0"
+    "浙江省/宁波市/慈溪市\0"
+    "浙江/宁波/慈溪\0"
+    "Cixi\0"
+    "浙江省/温州市\0"
+    "浙江/温州/温州\0"
+    "Wenzhou\0"
+    "浙江省/温州市/鹿城区\0"
+    "浙江/温州/鹿城\0"
+    "浙江省/温州市/龙湾区\0"
+    "浙江/温州/龙湾\0"
+    "Longwan\0"
+    "浙江省/温州市/瓯海区\0"
+    "浙江/温州/瓯海\0"
+    "Ouhai\0"
+    "浙江省/温州市/洞头区\0"
+    "浙江/温州/洞头\0"
+    "Dongtou\0"
+    "浙江省/温州市/永嘉县\0"
+    "浙江/温州/永嘉\0"
+    "Yongjia\0"
+    "浙江省/温州市/平阳县\0"
+    "浙江/温州/平阳\0"
+    "Pingyang\0"
+    "浙江省/温州市/苍南县\0"
+    "浙江/温州/苍南\0"
+    "Cangnan\0"
+    "浙江省/温州市/文成县\0"
+    "浙江/温州/文成\0"
+    "Wencheng\0"
+    "浙江省/温州市/泰顺县\0"
+    "浙江/温州/泰顺\0"
+    "Taishun\0"
+    "浙江省/温州市/瑞安市\0"
+    "浙江/温州/瑞安\0"
+    "Ruian\0"
+    "浙江省/温州市/乐清市\0"
+    "浙江/温州/乐清\0"
+    "Yueqing\0"
+    "浙江省/嘉兴市\0"
+    "浙江/嘉兴/嘉兴\0"
+    "Jiaxing\0"
+    "浙江省/嘉兴市/南湖区\0"
+    "浙江/嘉兴/南湖\0"
+    "Nanhu\0"
+    "浙江省/嘉兴市/秀洲区\0"
+    "浙江/嘉兴/秀洲\0"
+    "Xiuzhou\0"
+    "浙江省/嘉兴市/嘉善县\0"
+    "浙江/嘉兴/嘉善\0"
+    "Jiashan\0"
+    "浙江省/嘉兴市/海盐县\0"
+    "浙江/嘉兴/海盐\0"
+    "Haiyan\0"
+    "浙江省/嘉兴市/海宁市\0"
+    "浙江/嘉兴/海宁\0"
+    "Haining\0"
+    "浙江省/嘉兴市/平湖市\0"
+    "浙江/嘉兴/平湖\0"
+    "Pinghu\0"
+    "浙江省/嘉兴市/桐乡市\0"
+    "浙江/嘉兴/桐乡\0"
+    "Tongxiang\0"
+    "浙江省/湖州市\0"
+    "浙江/湖州/湖州\0"
+    "Huzhou\0"
+    "浙江省/湖州市/吴兴区\0"
+    "浙江/湖州/吴兴\0"
+    "Wuxing\0"
+    "浙江省/湖州市/南浔区\0"
+    "浙江/湖州/南浔\0"
+    "Nanxun\0"
+    "浙江省/湖州市/德清县\0"
+    "浙江/湖州/德清\0"
+    "Deqing\0"
+    "浙江省/湖州市/长兴县\0"
+    "浙江/湖州/长兴\0"
+    "Changxing\0"
+    "浙江省/湖州市/安吉县\0"
+    "浙江/湖州/安吉\0"
+    "Anji\0"
+    "浙江省/绍兴市\0"
+    "浙江/绍兴/绍兴\0"
+    "Shaoxing\0"
+    "浙江省/绍兴市/越城区\0"
+    "浙江/绍兴/越城\0"
+    "Yuecheng\0"
+    "浙江省/绍兴市/柯桥区\0"
+    "浙江/绍兴/柯桥\0"
+    "Keqiao\0"
+    "浙江省/绍兴市/上虞区\0"
+    "浙江/绍兴/上虞\0"
+    "Shangyu\0"
+    "浙江省/绍兴市/新昌县\0"
+    "浙江/绍兴/新昌\0"
+    "Xinchang\0"
+    "浙江省/绍兴市/诸暨市\0"
+    "浙江/绍兴/诸暨\0"
+    "Zhuji\0"
+    "浙江省/绍兴市/嵊州市\0"
+    "浙江/绍兴/嵊州\0"
+    "Shengzhou\0"
+    "浙江省/金华市\0"
+    "浙江/金华/金华\0"
+    "Jinhua\0"
+    "浙江省/金华市/婺城区\0"
+    "浙江/金华/婺城\0"
+    "Wucheng\0"
+    "浙江省/金华市/金东区\0"
+    "浙江/金华/金东\0"
+    "Jindong\0"
+    "浙江省/金华市/武义县\0"
+    "浙江/金华/武义\0"
+    "浙江省/金华市/浦江县\0"
+    "浙江/金华/浦江\0"
+    "Pujiang\0"
+    "浙江省/金华市/磐安县\0"
+    "浙江/金华/磐安\0"
+    "Panan\0"
+    "浙江省/金华市/兰溪市\0"
+    "浙江/金华/兰溪\0"
+    "浙江省/金华市/义乌市\0"
+    "浙江/金华/义乌\0"
+    "Yiwu\0"
+    "浙江省/金华市/东阳市\0"
+    "浙江/金华/东阳\0"
+    "Dongyang\0"
+    "浙江省/金华市/永康市\0"
+    "浙江/金华/永康\0"
+    "Yongkang\0"
+    "浙江省/衢州市\0"
+    "浙江/衢州/衢州\0"
+    "浙江省/衢州市/柯城区\0"
+    "浙江/衢州/柯城\0"
+    "Kecheng\0"
+    "浙江省/衢州市/衢江区\0"
+    "浙江/衢州/衢江\0"
+    "Qujiang\0"
+    "浙江省/衢州市/常山县\0"
+    "浙江/衢州/常山\0"
+    "Changshan\0"
+    "浙江省/衢州市/开化县\0"
+    "浙江/衢州/开化\0"
+    "Kaihua\0"
+    "浙江省/衢州市/龙游县\0"
+    "浙江/衢州/龙游\0"
+    "Longyou\0"
+    "浙江省/衢州市/江山市\0"
+    "浙江/衢州/江山\0"
+    "Jiangshan\0"
+    "浙江省/舟山市\0"
+    "浙江/舟山/舟山\0"
+    "Zhoushan\0"
+    "浙江省/舟山市/定海区\0"
+    "浙江/舟山/定海\0"
+    "Dinghai\0"
+    "浙江省/舟山市/普陀区\0"
+    "浙江/舟山/普陀\0"
+    "浙江省/舟山市/岱山县\0"
+    "浙江/舟山/岱山\0"
+    "Daishan\0"
+    "浙江省/舟山市/嵊泗县\0"
+    "浙江/舟山/嵊泗\0"
+    "Shengsi\0"
+    "浙江省/台州市\0"
+    "浙江/台州/台州\0"
+    "浙江省/台州市/椒江区\0"
+    "浙江/台州/椒江\0"
+    "Jiaojiang\0"
+    "浙江省/台州市/黄岩区\0"
+    "浙江/台州/黄岩\0"
+    "Huangyan\0"
+    "浙江省/台州市/路桥区\0"
+    "浙江/台州/路桥\0"
+    "Luqiao\0"
+    "浙江省/台州市/三门县\0"
+    "浙江/台州/三门\0"
+    "Sanmen\0"
+    "浙江省/台州市/天台县\0"
+    "浙江/台州/天台\0"
+    "Tiantai\0"
+    "浙江省/台州市/仙居县\0"
+    "浙江/台州/仙居\0"
+    "Xianju\0"
+    "浙江省/台州市/温岭市\0"
+    "浙江/台州/温岭\0"
+    "Wenling\0"
+    "浙江省/台州市/临海市\0"
+    "浙江/台州/临海\0"
+    "Linhai\0"
+    "浙江省/台州市/玉环市\0"
+    "浙江/台州/玉环\0"
+    "Yuhuan\0"
+    "浙江省/丽水市\0"
+    "浙江/丽水/丽水\0"
+    "浙江省/丽水市/莲都区\0"
+    "浙江/丽水/莲都\0"
+    "Liandou\0"
+    "浙江省/丽水市/青田县\0"
+    "浙江/丽水/青田\0"
+    "Qingtian\0"
+    "浙江省/丽水市/缙云县\0"
+    "浙江/丽水/缙云\0"
+    "Jinyun\0"
+    "浙江省/丽水市/遂昌县\0"
+    "浙江/丽水/遂昌\0"
+    "Suichang\0"
+    "浙江省/丽水市/松阳县\0"
+    "浙江/丽水/松阳\0"
+    "Songyang\0"
+    "浙江省/丽水市/云和县\0"
+    "浙江/丽水/云和\0"
+    "浙江省/丽水市/庆元县\0"
+    "浙江/丽水/庆元\0"
+    "浙江省/丽水市/景宁畲族自治县\0"
+    "浙江/丽水/景宁\0"
+    "Jingning\0"
+    "浙江省/丽水市/龙泉市\0"
+    "浙江/丽水/龙泉\0"
+    "Longquan\0"
+    "安徽省/合肥市\0"
+    "安徽/合肥/合肥\0"
+    "Hefei\0"
+    "安徽省/合肥市/瑶海区\0"
+    "安徽/合肥/瑶海\0"
+    "Yaohai\0"
+    "安徽省/合肥市/庐阳区\0"
+    "安徽/合肥/庐阳\0"
+    "Luyang\0"
+    "安徽省/合肥市/蜀山区\0"
+    "安徽/合肥/蜀山\0"
+    "Shushan\0"
+    "安徽省/合肥市/包河区\0"
+    "安徽/合肥/包河\0"
+    "Baohe\0"
+    "安徽省/合肥市/长丰县\0"
+    "安徽/合肥/长丰\0"
+    "Changfeng\0"
+    "安徽省/合肥市/肥东县\0"
+    "安徽/合肥/肥东\0"
+    "Feidong\0"
+    "安徽省/合肥市/肥西县\0"
+    "安徽/合肥/肥西\0"
+    "Feixi\0"
+    "安徽省/合肥市/庐江县\0"
+    "安徽/合肥/庐江\0"
+    "Lujiang\0"
+    "安徽省/合肥市/巢湖市\0"
+    "安徽/合肥/巢湖\0"
+    "Chaohu\0"
+    "安徽省/芜湖市\0"
+    "安徽/芜湖/芜湖\0"
+    "Wuhu\0"
+    "安徽省/芜湖市/镜湖区\0"
+    "安徽/芜湖/镜湖\0"
+    "Jinghu\0"
+    "安徽省/芜湖市/弋江区\0"
+    "安徽/芜湖/弋江\0"
+    "Yijiang\0"
+    "安徽省/芜湖市/鸠江区\0"
+    "安徽/芜湖/鸠江\0"
+    "Jiujiang\0"
+    "安徽省/芜湖市/三山区\0"
+    "安徽/芜湖/三山\0"
+    "Sanshan\0"
+    "安徽省/芜湖市/芜湖县\0"
+    "安徽/芜湖/芜湖县\0"
+    "Wuhuxian\0"
+    "安徽省/芜湖市/繁昌县\0"
+    "安徽/芜湖/繁昌\0"
+    "Fanchang\0"
+    "安徽省/芜湖市/南陵县\0"
+    "安徽/芜湖/南陵\0"
+    "Nanling\0"
+    "安徽省/芜湖市/无为县\0"
+    "安徽/芜湖/无为\0"
+    "Wuwei\0"
+    "安徽省/蚌埠市\0"
+    "安徽/蚌埠/蚌埠\0"
+    "Bengbu\0"
+    "安徽省/蚌埠市/龙子湖区\0"
+    "安徽/蚌埠/龙子湖\0"
+    "Longzihu\0"
+    "安徽省/蚌埠市/蚌山区\0"
+    "安徽/蚌埠/蚌山\0"
+    "Bangshan\0"
+    "安徽省/蚌埠市/禹会区\0"
+    "安徽/蚌埠/禹会\0"
+    "Yuhui\0"
+    "安徽省/蚌埠市/淮上区\0"
+    "安徽/蚌埠/淮上\0"
+    "Huaishang\0"
+    "安徽省/蚌埠市/怀远县\0"
+    "安徽/蚌埠/怀远\0"
+    "Huaiyuan\0"
+    "安徽省/蚌埠市/五河县\0"
+    "安徽/蚌埠/五河\0"
+    "Wuhe\0"
+    "安徽省/蚌埠市/固镇县\0"
+    "安徽/蚌埠/固镇\0"
+    "Guzhen\0"
+    "安徽省/淮南市\0"
+    "安徽/淮南/淮南\0"
+    "Huainan\0"
+    "安徽省/淮南市/大通区\0"
+    "安徽/淮南/大通\0"
+    "安徽省/淮南市/田家庵区\0"
+    "安徽/淮南/田家庵\0"
+    "Tianjiaan\0"
+    "安徽省/淮南市/谢家集区\0"
+    "安徽/淮南/谢家集\0"
+    "Xiejiaji\0"
+    "安徽省/淮南市/八公山区\0"
+    "安徽/淮南/八公山\0"
+    "Bagongshan\0"
+    "安徽省/淮南市/潘集区\0"
+    "安徽/淮南/潘集\0"
+    "Panji\0"
+    "安徽省/淮南市/凤台县\0"
+    "安徽/淮南/凤台\0"
+    "安徽省/淮南市/寿县\0"
+    "安徽/淮南/寿县\0"
+    "Shouxian\0"
+    "安徽省/马鞍山市\0"
+    "安徽/马鞍山/马鞍山\0"
+    "Maanshan\0"
+    "安徽省/马鞍山市/花山区\0"
+    "安徽/马鞍山/花山\0"
+    "Huashan\0"
+    "安徽省/马鞍山市/雨山区\0"
+    "安徽/马鞍山/雨山\0"
+    "Yushan\0"
+    "安徽省/马鞍山市/博望区\0"
+    "安徽/马鞍山/博望\0"
+    "Bowang\0"
+    "安徽省/马鞍山市/当涂县\0"
+    "安徽/马鞍山/当涂\0"
+    "Dangtu\0"
+    "安徽省/马鞍山市/含山县\0"
+    "安徽/马鞍山/含山\0"
+    "安徽省/马鞍山市/和县\0"
+    "安徽/马鞍山/和县\0"
+    "Hexian\0"
+    "安徽省/淮北市\0"
+    "安徽/淮北/淮北\0"
+    "Huaibei\0"
+    "安徽省/淮北市/杜集区\0"
+    "安徽/淮北/杜集\0"
+    "Duji\0"
+    "安徽省/淮北市/相山区\0"
+    "安徽/淮北/相山\0"
+    "安徽省/淮北市/烈山区\0"
+    "安徽/淮北/烈山\0"
+    "Lieshan\0"
+    "安徽省/淮北市/濉溪县\0"
+    "安徽/淮北/濉溪\0"
+    "Suixi\0"
+    "安徽省/铜陵市\0"
+    "安徽/铜陵/铜陵\0"
+    "Tongling\0"
+    "安徽省/铜陵市/铜官区\0"
+    "安徽/铜陵/铜官\0"
+    "Tongguan\0"
+    "安徽省/铜陵市/义安区\0"
+    "安徽/铜陵/义安\0"
+    "安徽省/铜陵市/郊区\0"
+    "安徽/铜陵/郊区\0"
+    "安徽省/铜陵市/枞阳县\0"
+    "安徽/铜陵/枞阳\0"
+    "Zongyang\0"
+    "安徽省/安庆市\0"
+    "安徽/安庆/安庆\0"
+    "Anqing\0"
+    "安徽省/安庆市/迎江区\0"
+    "安徽/安庆/迎江\0"
+    "Yingjiang\0"
+    "安徽省/安庆市/大观区\0"
+    "安徽/安庆/大观\0"
+    "Daguan\0"
+    "安徽省/安庆市/宜秀区\0"
+    "安徽/安庆/宜秀\0"
+    "Yixiu\0"
+    "安徽省/安庆市/怀宁县\0"
+    "安徽/安庆/怀宁\0"
+    "Huaining\0"
+    "安徽省/安庆市/潜山市\0"
+    "安徽/安庆/潜山\0"
+    "安徽省/安庆市/太湖县\0"
+    "安徽/安庆/太湖\0"
+    "Taihu\0"
+    "安徽省/安庆市/宿松县\0"
+    "安徽/安庆/宿松\0"
+    "Susong\0"
+    "安徽省/安庆市/望江县\0"
+    "安徽/安庆/望江\0"
+    "Wangjiang\0"
+    "安徽省/安庆市/岳西县\0"
+    "安徽/安庆/岳西\0"
+    "Yuexi\0"
+    "安徽省/安庆市/桐城市\0"
+    "安徽/安庆/桐城\0"
+    "Tongcheng\0"
+    "安徽省/黄山市\0"
+    "安徽/黄山/黄山\0"
+    "Huangshan\0"
+    "安徽省/黄山市/屯溪区\0"
+    "安徽/黄山/屯溪\0"
+    "Tunxi\0"
+    "安徽省/黄山市/黄山区\0"
+    "安徽/黄山/黄山区\0"
+    "Huangshanqu\0"
+    "安徽省/黄山市/徽州区\0"
+    "安徽/黄山/徽州\0"
+    "Huizhou\0"
+    "安徽省/黄山市/歙县\0"
+    "安徽/黄山/歙县\0"
+    "安徽省/黄山市/休宁县\0"
+    "安徽/黄山/休宁\0"
+    "Xiuning\0"
+    "安徽省/黄山市/黟县\0"
+    "安徽/黄山/黟县\0"
+    "安徽省/黄山市/祁门县\0"
+    "安徽/黄山/祁门\0"
+    "Qimen\0"
+    "安徽省/滁州市\0"
+    "安徽/滁州/滁州\0"
+    "Chuzhou\0"
+    "安徽省/滁州市/琅琊区\0"
+    "安徽/滁州/琅琊\0"
+    "Langya\0"
+    "安徽省/滁州市/南谯区\0"
+    "安徽/滁州/南谯\0"
+    "Nanqiao\0"
+    "安徽省/滁州市/来安县\0"
+    "安徽/滁州/来安\0"
+    "Laian\0"
+    "安徽省/滁州市/全椒县\0"
+    "安徽/滁州/全椒\0"
+    "Quanjiao\0"
+    "安徽省/滁州市/定远县\0"
+    "安徽/滁州/定远\0"
+    "Dingyuan\0"
+    "安徽省/滁州市/凤阳县\0"
+    "安徽/滁州/凤阳\0"
+    "Fengyang\0"
+    "安徽省/滁州市/天长市\0"
+    "安徽/滁州/天长\0"
+    "Tianchang\0"
+    "安徽省/滁州市/明光市\0"
+    "安徽/滁州/明光\0"
+    "Mingguang\0"
+    "安徽省/阜阳市\0"
+    "安徽/阜阳/阜阳\0"
+    "安徽省/阜阳市/颍州区\0"
+    "安徽/阜阳/颍州\0"
+    "Yingzhou\0"
+    "安徽省/阜阳市/颍东区\0"
+    "安徽/阜阳/颍东\0"
+    "Yingdong\0"
+    "安徽省/阜阳市/颍泉区\0"
+    "安徽/阜阳/颍泉\0"
+    "Yingquan\0"
+    "安徽省/阜阳市/临泉县\0"
+    "安徽/阜阳/临泉\0"
+    "Linquan\0"
+    "安徽省/阜阳市/太和县\0"
+    "安徽/阜阳/太和\0"
+    "安徽省/阜阳市/阜南县\0"
+    "安徽/阜阳/阜南\0"
+    "Funan\0"
+    "安徽省/阜阳市/颍上县\0"
+    "安徽/阜阳/颍上\0"
+    "Yingshang\0"
+    "安徽省/阜阳市/界首市\0"
+    "安徽/阜阳/界首\0"
+    "Jieshou\0"
+    "安徽省/宿州市\0"
+    "安徽/宿州/宿州\0"
+    "安徽省/宿州市/埇桥区\0"
+    "安徽/宿州/埇桥\0"
+    "Yongqiao\0"
+    "安徽省/宿州市/砀山县\0"
+    "安徽/宿州/砀山\0"
+    "Dangshan\0"
+    "安徽省/宿州市/萧县\0"
+    "安徽/宿州/萧县\0"
+    "Xiaoxian\0"
+    "安徽省/宿州市/灵璧县\0"
+    "安徽/宿州/灵璧\0"
+    "Lingbi\0"
+    "安徽省/宿州市/泗县\0"
+    "安徽/宿州/泗县\0"
+    "Sixian\0"
+    "安徽省/六安市\0"
+    "安徽/六安/六安\0"
+    "Luan\0"
+    "安徽省/六安市/金安区\0"
+    "安徽/六安/金安\0"
+    "Jinan\0"
+    "安徽省/六安市/裕安区\0"
+    "安徽/六安/裕安\0"
+    "Yuan\0"
+    "安徽省/六安市/叶集区\0"
+    "安徽/六安/叶集\0"
+    "Yeji\0"
+    "安徽省/六安市/霍邱县\0"
+    "安徽/六安/霍邱\0"
+    "Huoqiu\0"
+    "安徽省/六安市/舒城县\0"
+    "安徽/六安/舒城\0"
+    "Shucheng\0"
+    "安徽省/六安市/金寨县\0"
+    "安徽/六安/金寨\0"
+    "Jinzhai\0"
+    "安徽省/六安市/霍山县\0"
+    "安徽/六安/霍山\0"
+    "Huoshan\0"
+    "安徽省/亳州市\0"
+    "安徽/亳州/亳州\0"
+    "Bozhou\0"
+    "安徽省/亳州市/谯城区\0"
+    "安徽/亳州/谯城\0"
+    "Qiaocheng\0"
+    "安徽省/亳州市/涡阳县\0"
+    "安徽/亳州/涡阳\0"
+    "Guoyang\0"
+    "安徽省/亳州市/蒙城县\0"
+    "安徽/亳州/蒙城\0"
+    "Mengcheng\0"
+    "安徽省/亳州市/利辛县\0"
+    "安徽/亳州/利辛\0"
+    "Lixin\0"
+    "安徽省/池州市\0"
+    "安徽/池州/池州\0"
+    "Chizhou\0"
+    "安徽省/池州市/贵池区\0"
+    "安徽/池州/贵池\0"
+    "Guichi\0"
+    "安徽省/池州市/东至县\0"
+    "安徽/池州/东至\0"
+    "Dongzhi\0"
+    "安徽省/池州市/石台县\0"
+    "安徽/池州/石台\0"
+    "Shitai\0"
+    "安徽省/池州市/青阳县\0"
+    "安徽/池州/青阳\0"
+    "Qingyang\0"
+    "安徽省/宣城市\0"
+    "安徽/宣城/宣城\0"
+    "Xuancheng\0"
+    "安徽省/宣城市/宣州区\0"
+    "安徽/宣城/宣州\0"
+    "Xuanzhou\0"
+    "安徽省/宣城市/郎溪县\0"
+    "安徽/宣城/郎溪\0"
+    "Langxi\0"
+    "安徽省/宣城市/广德县\0"
+    "安徽/宣城/广德\0"
+    "Guangde\0"
+    "安徽省/宣城市/泾县\0"
+    "安徽/宣城/泾县\0"
+    "安徽省/宣城市/绩溪县\0"
+    "安徽/宣城/绩溪\0"
+    "安徽省/宣城市/旌德县\0"
+    "安徽/宣城/旌德\0"
+    "Jingde\0"
+    "安徽省/宣城市/宁国市\0"
+    "安徽/宣城/宁国\0"
+    "Ningguo\0"
+    "福建省/福州市\0"
+    "福建/福州/福州\0"
+    "Fuzhou\0"
+    "福建省/福州市/鼓楼区\0"
+    "福建/福州/鼓楼\0"
+    "福建省/福州市/台江区\0"
+    "福建/福州/台江\0"
+    "Taijiang\0"
+    "福建省/福州市/仓山区\0"
+    "福建/福州/仓山\0"
+    "Cangshan\0"
+    "福建省/福州市/马尾区\0"
+    "福建/福州/马尾\0"
+    "Mawei\0"
+    "福建省/福州市/晋安区\0"
+    "福建/福州/晋安\0"
+    "福建省/福州市/长乐区\0"
+    "福建/福州/长乐\0"
+    "Changle\0"
+    "福建省/福州市/闽侯县\0"
+    "福建/福州/闽侯\0"
+    "Minhou\0"
+    "福建省/福州市/连江县\0"
+    "福建/福州/连江\0"
+    "Lianjiang\0"
+    "福建省/福州市/罗源县\0"
+    "福建/福州/罗源\0"
+    "Luoyuan\0"
+    "福建省/福州市/闽清县\0"
+    "福建/福州/闽清\0"
+    "Minqing\0"
+    "福建省/福州市/永泰县\0"
+    "福建/福州/永泰\0"
+    "Yongtai\0"
+    "福建省/福州市/平潭县\0"
+    "福建/福州/平潭\0"
+    "Pingtan\0"
+    "福建省/福州市/福清市\0"
+    "福建/福州/福清\0"
+    "Fuqing\0"
+    "福建省/厦门市\0"
+    "福建/厦门/厦门\0"
+    "Xiamen\0"
+    "福建省/厦门市/思明区\0"
+    "福建/厦门/思明\0"
+    "Siming\0"
+    "福建省/厦门市/海沧区\0"
+    "福建/厦门/海沧\0"
+    "Haicang\0"
+    "福建省/厦门市/湖里区\0"
+    "福建/厦门/湖里\0"
+    "Huli\0"
+    "福建省/厦门市/集美区\0"
+    "福建/厦门/集美\0"
+    "Jimei\0"
+    "福建省/厦门市/同安区\0"
+    "福建/厦门/同安\0"
+    "Tongan\0"
+    "福建省/厦门市/翔安区\0"
+    "福建/厦门/翔安\0"
+    "Xiangan\0"
+    "福建省/莆田市\0"
+    "福建/莆田/莆田\0"
+    "Putian\0"
+    "福建省/莆田市/城厢区\0"
+    "福建/莆田/城厢\0"
+    "Chengxiang\0"
+    "福建省/莆田市/涵江区\0"
+    "福建/莆田/涵江\0"
+    "福建省/莆田市/荔城区\0"
+    "福建/莆田/荔城\0"
+    "福建省/莆田市/秀屿区\0"
+    "福建/莆田/秀屿\0"
+    "Xiuyu\0"
+    "福建省/莆田市/仙游县\0"
+    "福建/莆田/仙游\0"
+    "Xianyou\0"
+    "福建省/三明市\0"
+    "福建/三明/三明\0"
+    "Sanming\0"
+    "福建省/三明市/梅列区\0"
+    "福建/三明/梅列\0"
+    "Meilie\0"
+    "福建省/三明市/三元区\0"
+    "福建/三明/三元\0"
+    "Sanyuan\0"
+    "福建省/三明市/明溪县\0"
+    "福建/三明/明溪\0"
+    "Mingxi\0"
+    "福建省/三明市/清流县\0"
+    "福建/三明/清流\0"
+    "Qingliu\0"
+    "福建省/三明市/宁化县\0"
+    "福建/三明/宁化\0"
+    "Ninghua\0"
+    "福建省/三明市/大田县\0"
+    "福建/三明/大田\0"
+    "Datian\0"
+    "福建省/三明市/尤溪县\0"
+    "福建/三明/尤溪\0"
+    "Youxi\0"
+    "福建省/三明市/沙县\0"
+    "福建/三明/沙县\0"
+    "Shaxian\0"
+    "福建省/三明市/将乐县\0"
+    "福建/三明/将乐\0"
+    "Jiangle\0"
+    "福建省/三明市/泰宁县\0"
+    "福建/三明/泰宁\0"
+    "Taining\0"
+    "福建省/三明市/建宁县\0"
+    "福建/三明/建宁\0"
+    "Jianning\0"
+    "福建省/三明市/永安市\0"
+    "福建/三明/永安\0"
+    "Yongan\0"
+    "福建省/泉州市\0"
+    "福建/泉州/泉州\0"
+    "Quanzhou\0"
+    "福建省/泉州市/鲤城区\0"
+    "福建/泉州/鲤城\0"
+    "福建省/泉州市/丰泽区\0"
+    "福建/泉州/丰泽\0"
+    "Fengze\0"
+    "福建省/泉州市/洛江区\0"
+    "福建/泉州/洛江\0"
+    "Luojiang\0"
+    "福建省/泉州市/泉港区\0"
+    "福建/泉州/泉港\0"
+    "Quangang\0"
+    "福建省/泉州市/惠安县\0"
+    "福建/泉州/惠安\0"
+    "Huian\0"
+    "福建省/泉州市/安溪县\0"
+    "福建/泉州/安溪\0"
+    "Anxi\0"
+    "福建省/泉州市/永春县\0"
+    "福建/泉州/永春\0"
+    "Yongchun\0"
+    "福建省/泉州市/德化县\0"
+    "福建/泉州/德化\0"
+    "Dehua\0"
+    "福建省/泉州市/金门县\0"
+    "福建/泉州/金门\0"
+    "Jinmen\0"
+    "福建省/泉州市/石狮市\0"
+    "福建/泉州/石狮\0"
+    "Shishi\0"
+    "福建省/泉州市/晋江市\0"
+    "福建/泉州/晋江\0"
+    "Jinjiang\0"
+    "福建省/泉州市/南安市\0"
+    "福建/泉州/南安\0"
+    "Nanan\0"
+    "福建省/漳州市\0"
+    "福建/漳州/漳州\0"
+    "Zhangzhou\0"
+    "福建省/漳州市/芗城区\0"
+    "福建/漳州/芗城\0"
+    "福建省/漳州市/龙文区\0"
+    "福建/漳州/龙文\0"
+    "Longwen\0"
+    "福建省/漳州市/云霄县\0"
+    "福建/漳州/云霄\0"
+    "Yunxiao\0"
+    "福建省/漳州市/漳浦县\0"
+    "福建/漳州/漳浦\0"
+    "Zhangpu\0"
+    "福建省/漳州市/诏安县\0"
+    "福建/漳州/诏安\0"
+    "Zhaoan\0"
+    "福建省/漳州市/长泰县\0"
+    "福建/漳州/长泰\0"
+    "Changtai\0"
+    "福建省/漳州市/东山县\0"
+    "福建/漳州/东山\0"
+    "福建省/漳州市/南靖县\0"
+    "福建/漳州/南靖\0"
+    "福建省/漳州市/平和县\0"
+    "福建/漳州/平和\0"
+    "Pinghe\0"
+    "福建省/漳州市/华安县\0"
+    "福建/漳州/华安\0"
+    "Huaan\0"
+    "福建省/漳州市/龙海市\0"
+    "福建/漳州/龙海\0"
+    "Longhai\0"
+    "福建省/南平市\0"
+    "福建/南平/南平\0"
+    "Nanping\0"
+    "福建省/南平市/延平区\0"
+    "福建/南平/延平\0"
+    "Yanping\0"
+    "福建省/南平市/建阳区\0"
+    "福建/南平/建阳\0"
+    "Jianyang\0"
+    "福建省/南平市/顺昌县\0"
+    "福建/南平/顺昌\0"
+    "Shunchang\0"
+    "福建省/南平市/浦城县\0"
+    "福建/南平/浦城\0"
+    "Pucheng\0"
+    "福建省/南平市/光泽县\0"
+    "福建/南平/光泽\0"
+    "Guangze\0"
+    "福建省/南平市/松溪县\0"
+    "福建/南平/松溪\0"
+    "Songxi\0"
+    "福建省/南平市/政和县\0"
+    "福建/南平/政和\0"
+    "Zhenghe\0"
+    "福建省/南平市/邵武市\0"
+    "福建/南平/邵武\0"
+    "Shaowu\0"
+    "福建省/南平市/武夷山市\0"
+    "福建/南平/武夷山\0"
+    "Wuyishan\0"
+    "福建省/南平市/建瓯市\0"
+    "福建/南平/建瓯\0"
+    "Jianou\0"
+    "福建省/龙岩市\0"
+    "福建/龙岩/龙岩\0"
+    "Longyan\0"
+    "福建省/龙岩市/新罗区\0"
+    "福建/龙岩/新罗\0"
+    "Xinluo\0"
+    "福建省/龙岩市/永定区\0"
+    "福建/龙岩/永定\0"
+    "Yongding\0"
+    "福建省/龙岩市/长汀县\0"
+    "福建/龙岩/长汀\0"
+    "Changting\0"
+    "福建省/龙岩市/上杭县\0"
+    "福建/龙岩/上杭\0"
+    "Shanghang\0"
+    "福建省/龙岩市/武平县\0"
+    "福建/龙岩/武平\0"
+    "Wuping\0"
+    "福建省/龙岩市/连城县\0"
+    "福建/龙岩/连城\0"
+    "Liancheng\0"
+    "福建省/龙岩市/漳平市\0"
+    "福建/龙岩/漳平\0"
+    "Zhangping\0"
+    "福建省/宁德市\0"
+    "福建/宁德/宁德\0"
+    "Ningde\0"
+    "福建省/宁德市/蕉城区\0"
+    "福建/宁德/蕉城\0"
+    "福建省/宁德市/霞浦县\0"
+    "福建/宁德/霞浦\0"
+    "Xiapu\0"
+    "福建省/宁德市/古田县\0"
+    "福建/宁德/古田\0"
+    "Gutian\0"
+    "福建省/宁德市/屏南县\0"
+    "福建/宁德/屏南\0"
+    "Pingnan\0"
+    "福建省/宁德市/寿宁县\0"
+    "福建/宁德/寿宁\0"
+    "Shouning\0"
+    "福建省/宁德市/周宁县\0"
+    "福建/宁德/周宁\0"
+    "Zhouning\0"
+    "福建省/宁德市/柘荣县\0"
+    "福建/宁德/柘荣\0"
+    "Zherong\0"
+    "福建省/宁德市/福安市\0"
+    "福建/宁德/福安\0"
+    "Fuan\0"
+    "福建省/宁德市/福鼎市\0"
+    "福建/宁德/福鼎\0"
+    "Fuding\0"
+    "江西省/南昌市\0"
+    "江西/南昌/南昌\0"
+    "Nanchang\0"
+    "江西省/南昌市/东湖区\0"
+    "江西/南昌/东湖\0"
+    "Donghu\0"
+    "江西省/南昌市/西湖区\0"
+    "江西/南昌/西湖\0"
+    "江西省/南昌市/青云谱区\0"
+    "江西/南昌/青云谱\0"
+    "Qingyunpu\0"
+    "江西省/南昌市/湾里区\0"
+    "江西/南昌/湾里\0"
+    "Wanli\0"
+    "江西省/南昌市/青山湖区\0"
+    "江西/南昌/青山湖\0"
+    "Qingshanhu\0"
+    "江西省/南昌市/新建区\0"
+    "江西/南昌/新建\0"
+    "Xinjian\0"
+    "江西省/南昌市/南昌县\0"
+    "江西/南昌/南昌县\0"
+    "Nanchangxian\0"
+    "江西省/南昌市/安义县\0"
+    "江西/南昌/安义\0"
+    "Anyi\0"
+    "江西省/南昌市/进贤县\0"
+    "江西/南昌/进贤\0"
+    "Jinxian\0"
+    "江西省/景德镇市\0"
+    "江西/景德镇/景德镇\0"
+    "Jingdezhen\0"
+    "江西省/景德镇市/昌江区\0"
+    "江西/景德镇/昌江\0"
+    "Changjiang\0"
+    "江西省/景德镇市/珠山区\0"
+    "江西/景德镇/珠山\0"
+    "Zhushan\0"
+    "江西省/景德镇市/浮梁县\0"
+    "江西/景德镇/浮梁\0"
+    "Fuliang\0"
+    "江西省/景德镇市/乐平市\0"
+    "江西/景德镇/乐平\0"
+    "Leping\0"
+    "江西省/萍乡市\0"
+    "江西/萍乡/萍乡\0"
+    "江西省/萍乡市/安源区\0"
+    "江西/萍乡/安源\0"
+    "Anyuan\0"
+    "江西省/萍乡市/湘东区\0"
+    "江西/萍乡/湘东\0"
+    "Xiangdong\0"
+    "江西省/萍乡市/莲花县\0"
+    "江西/萍乡/莲花\0"
+    "Lianhua\0"
+    "江西省/萍乡市/上栗县\0"
+    "江西/萍乡/上栗\0"
+    "Shangli\0"
+    "江西省/萍乡市/芦溪县\0"
+    "江西/萍乡/芦溪\0"
+    "Luxi\0"
+    "江西省/九江市\0"
+    "江西/九江/九江\0"
+    "江西省/九江市/濂溪区\0"
+    "江西/九江/濂溪\0"
+    "Lianxi\0"
+    "江西省/九江市/浔阳区\0"
+    "江西/九江/浔阳\0"
+    "Xunyang\0"
+    "江西省/九江市/柴桑区\0"
+    "江西/九江/柴桑\0"
+    "Chaisang\0"
+    "江西省/九江市/武宁县\0"
+    "江西/九江/武宁\0"
+    "Wuning\0"
+    "江西省/九江市/修水县\0"
+    "江西/九江/修水\0"
+    "Xiushui\0"
+    "江西省/九江市/永修县\0"
+    "江西/九江/永修\0"
+    "Yongxiu\0"
+    "江西省/九江市/德安县\0"
+    "江西/九江/德安\0"
+    "Dean\0"
+    "江西省/九江市/都昌县\0"
+    "江西/九江/都昌\0"
+    "Duchang\0"
+    "江西省/九江市/湖口县\0"
+    "江西/九江/湖口\0"
+    "Hukou\0"
+    "江西省/九江市/彭泽县\0"
+    "江西/九江/彭泽\0"
+    "Pengze\0"
+    "江西省/九江市/瑞昌市\0"
+    "江西/九江/瑞昌\0"
+    "Ruichang\0"
+    "江西省/九江市/共青城市\0"
+    "江西/九江/共青城\0"
+    "Gongqingcheng\0"
+    "江西省/九江市/庐山市\0"
+    "江西/九江/庐山\0"
+    "Lushan\0"
+    "江西省/新余市\0"
+    "江西/新余/新余\0"
+    "Xinyu\0"
+    "江西省/新余市/渝水区\0"
+    "江西/新余/渝水\0"
+    "Yushui\0"
+    "江西省/新余市/分宜县\0"
+    "江西/新余/分宜\0"
+    "Fenyi\0"
+    "江西省/鹰潭市\0"
+    "江西/鹰潭/鹰潭\0"
+    "Yingtan\0"
+    "江西省/鹰潭市/月湖区\0"
+    "江西/鹰潭/月湖\0"
+    "Yuehu\0"
+    "江西省/鹰潭市/余江区\0"
+    "江西/鹰潭/余江\0"
+    "Yujiang\0"
+    "江西省/鹰潭市/贵溪市\0"
+    "江西/鹰潭/贵溪\0"
+    "Guixi\0"
+    "江西省/赣州市\0"
+    "江西/赣州/赣州\0"
+    "Ganzhou\0"
+    "江西省/赣州市/章贡区\0"
+    "江西/赣州/章贡\0"
+    "Zhanggong\0"
+    "江西省/赣州市/南康区\0"
+    "江西/赣州/南康\0"
+    "Nankang\0"
+    "江西省/赣州市/赣县区\0"
+    "江西/赣州/赣县\0"
+    "Ganxian\0"
+    "江西省/赣州市/信丰县\0"
+    "江西/赣州/信丰\0"
+    "Xinfeng\0"
+    "江西省/赣州市/大余县\0"
+    "江西/赣州/大余\0"
+    "Dayu\0"
+    "江西省/赣州市/上犹县\0"
+    "江西/赣州/上犹\0"
+    "Shangyou\0"
+    "江西省/赣州市/崇义县\0"
+    "江西/赣州/崇义\0"
+    "Chongyi\0"
+    "江西省/赣州市/安远县\0"
+    "江西/赣州/安远\0"
+    "江西省/赣州市/龙南县\0"
+    "江西/赣州/龙南\0"
+    "Longnan\0"
+    "江西省/赣州市/定南县\0"
+    "江西/赣州/定南\0"
+    "Dingnan\0"
+    "江西省/赣州市/全南县\0"
+    "江西/赣州/全南\0"
+    "Quannan\0"
+    "江西省/赣州市/宁都县\0"
+    "江西/赣州/宁都\0"
+    "Ningdu\0"
+    "江西省/赣州市/于都县\0"
+    "江西/赣州/于都\0"
+    "Yudu\0"
+    "江西省/赣州市/兴国县\0"
+    "江西/赣州/兴国\0"
+    "Xingguo\0"
+    "江西省/赣州市/会昌县\0"
+    "江西/赣州/会昌\0"
+    "Huichang\0"
+    "江西省/赣州市/寻乌县\0"
+    "江西/赣州/寻乌\0"
+    "Xunwu\0"
+    "江西省/赣州市/石城县\0"
+    "江西/赣州/石城\0"
+    "Shicheng\0"
+    "江西省/赣州市/瑞金市\0"
+    "江西/赣州/瑞金\0"
+    "Ruijin\0"
+    "江西省/吉安市\0"
+    "江西/吉安/吉安\0"
+    "江西省/吉安市/吉州区\0"
+    "江西/吉安/吉州\0"
+    "江西省/吉安市/青原区\0"
+    "江西/吉安/青原\0"
+    "江西省/吉安市/吉安县\0"
+    "江西/吉安/吉安县\0"
+    "Jianxian\0"
+    "江西省/吉安市/吉水县\0"
+    "江西/吉安/吉水\0"
+    "Jishui\0"
+    "江西省/吉安市/峡江县\0"
+    "江西/吉安/峡江\0"
+    "Xiajiang\0"
+    "江西省/吉安市/新干县\0"
+    "江西/吉安/新干\0"
+    "江西省/吉安市/永丰县\0"
+    "江西/吉安/永丰\0"
+    "Yongfeng\0"
+    "江西省/吉安市/泰和县\0"
+    "江西/吉安/泰和\0"
+    "江西省/吉安市/遂川县\0"
+    "江西/吉安/遂川\0"
+    "Suichuan\0"
+    "江西省/吉安市/万安县\0"
+    "江西/吉安/万安\0"
+    "Wanan\0"
+    "江西省/吉安市/安福县\0"
+    "江西/吉安/安福\0"
+    "Anfu\0"
+    "江西省/吉安市/永新县\0"
+    "江西/吉安/永新\0"
+    "Yongxin\0"
+    "江西省/吉安市/井冈山市\0"
+    "江西/吉安/井冈山\0"
+    "Jinggangshan\0"
+    "江西省/宜春市\0"
+    "江西/宜春/宜春\0"
+    "江西省/宜春市/袁州区\0"
+    "江西/宜春/袁州\0"
+    "Yuanzhou\0"
+    "江西省/宜春市/奉新县\0"
+    "江西/宜春/奉新\0"
+    "Fengxin\0"
+    "江西省/宜春市/万载县\0"
+    "江西/宜春/万载\0"
+    "Wanzai\0"
+    "江西省/宜春市/上高县\0"
+    "江西/宜春/上高\0"
+    "Shanggao\0"
+    "江西省/宜春市/宜丰县\0"
+    "江西/宜春/宜丰\0"
+    "Yifeng\0"
+    "江西省/宜春市/靖安县\0"
+    "江西/宜春/靖安\0"
+    "江西省/宜春市/铜鼓县\0"
+    "江西/宜春/铜鼓\0"
+    "Tonggu\0"
+    "江西省/宜春市/丰城市\0"
+    "江西/宜春/丰城\0"
+    "江西省/宜春市/樟树市\0"
+    "江西/宜春/樟树\0"
+    "Zhangshu\0"
+    "江西省/宜春市/高安市\0"
+    "江西/宜春/高安\0"
+    "Gaoan\0"
+    "江西省/抚州市\0"
+    "江西/抚州/抚州\0"
+    "江西省/抚州市/临川区\0"
+    "江西/抚州/临川\0"
+    "Linchuan\0"
+    "江西省/抚州市/东乡区\0"
+    "江西/抚州/东乡\0"
+    "Dongxiang\0"
+    "江西省/抚州市/南城县\0"
+    "江西/抚州/南城\0"
+    "Nancheng\0"
+    "江西省/抚州市/黎川县\0"
+    "江西/抚州/黎川\0"
+    "Lichuan\0"
+    "江西省/抚州市/南丰县\0"
+    "江西/抚州/南丰\0"
+    "Nanfeng\0"
+    "江西省/抚州市/崇仁县\0"
+    "江西/抚州/崇仁\0"
+    "Chongren\0"
+    "江西省/抚州市/乐安县\0"
+    "江西/抚州/乐安\0"
+    "Anle\0"
+    "江西省/抚州市/宜黄县\0"
+    "江西/抚州/宜黄\0"
+    "Yihuang\0"
+    "江西省/抚州市/金溪县\0"
+    "江西/抚州/金溪\0"
+    "Jinxi\0"
+    "江西省/抚州市/资溪县\0"
+    "江西/抚州/资溪\0"
+    "Zixi\0"
+    "江西省/抚州市/广昌县\0"
+    "江西/抚州/广昌\0"
+    "Guangchang\0"
+    "江西省/上饶市\0"
+    "江西/上饶/上饶\0"
+    "Shangrao\0"
+    "江西省/上饶市/信州区\0"
+    "江西/上饶/信州\0"
+    "江西省/上饶市/广丰区\0"
+    "江西/上饶/广丰\0"
+    "Guangfeng\0"
+    "江西省/上饶市/上饶县\0"
+    "江西/上饶/上饶县\0"
+    "Shangraoxian\0"
+    "江西省/上饶市/玉山县\0"
+    "江西/上饶/玉山\0"
+    "江西省/上饶市/铅山县\0"
+    "江西/上饶/铅山\0"
+    "江西省/上饶市/横峰县\0"
+    "江西/上饶/横峰\0"
+    "Hengfeng\0"
+    "江西省/上饶市/弋阳县\0"
+    "江西/上饶/弋阳\0"
+    "Yiyang\0"
+    "江西省/上饶市/余干县\0"
+    "江西/上饶/余干\0"
+    "Yugan\0"
+    "江西省/上饶市/鄱阳县\0"
+    "江西/上饶/鄱阳\0"
+    "Poyang\0"
+    "江西省/上饶市/万年县\0"
+    "江西/上饶/万年\0"
+    "Wannian\0"
+    "江西省/上饶市/婺源县\0"
+    "江西/上饶/婺源\0"
+    "江西省/上饶市/德兴市\0"
+    "江西/上饶/德兴\0"
+    "Dexing\0"
+    "山东省/济南市\0"
+    "山东/济南/济南\0"
+    "山东省/济南市/历下区\0"
+    "山东/济南/历下\0"
+    "Lixia\0"
+    "山东省/济南市/市中区\0"
+    "山东/济南/市中\0"
+    "Shizhong\0"
+    "山东省/济南市/槐荫区\0"
+    "山东/济南/槐荫\0"
+    "Huaiyin\0"
+    "山东省/济南市/天桥区\0"
+    "山东/济南/天桥\0"
+    "Tianqiao\0"
+    "山东省/济南市/历城区\0"
+    "山东/济南/历城\0"
+    "山东省/济南市/长清区\0"
+    "山东/济南/长清\0"
+    "Changqing\0"
+    "山东省/济南市/章丘区\0"
+    "山东/济南/章丘\0"
+    "Zhangqiu\0"
+    "山东省/济南市/济阳区\0"
+    "山东/济南/济阳\0"
+    "Jiyang\0"
+    "山东省/济南市/莱芜区\0"
+    "山东/济南/莱芜\0"
+    "Laiwu\0"
+    "山东省/济南市/钢城区\0"
+    "山东/济南/钢城\0"
+    "Gangcheng\0"
+    "山东省/济南市/平阴县\0"
+    "山东/济南/平阴\0"
+    "Pingyin\0"
+    "山东省/济南市/商河县\0"
+    "山东/济南/商河\0"
+    "Shanghe\0"
+    "山东省/青岛市\0"
+    "山东/青岛/青岛\0"
+    "Qingdao\0"
+    "山东省/青岛市/市南区\0"
+    "山东/青岛/市南\0"
+    "Shinan\0"
+    "山东省/青岛市/市北区\0"
+    "山东/青岛/市北\0"
+    "Shibei\0"
+    "山东省/青岛市/黄岛区\0"
+    "山东/青岛/黄岛\0"
+    "Huangdao\0"
+    "山东省/青岛市/崂山区\0"
+    "山东/青岛/崂山\0"
+    "Laoshan\0"
+    "山东省/青岛市/李沧区\0"
+    "山东/青岛/李沧\0"
+    "Licang\0"
+    "山东省/青岛市/城阳区\0"
+    "山东/青岛/城阳\0"
+    "Chengyang\0"
+    "山东省/青岛市/即墨区\0"
+    "山东/青岛/即墨\0"
+    "Jimo\0"
+    "山东省/青岛市/胶州市\0"
+    "山东/青岛/胶州\0"
+    "Jiaozhou\0"
+    "山东省/青岛市/平度市\0"
+    "山东/青岛/平度\0"
+    "Pingdu\0"
+    "山东省/青岛市/莱西市\0"
+    "山东/青岛/莱西\0"
+    "Laixi\0"
+    "山东省/淄博市\0"
+    "山东/淄博/淄博\0"
+    "Zibo\0"
+    "山东省/淄博市/淄川区\0"
+    "山东/淄博/淄川\0"
+    "Zichuan\0"
+    "山东省/淄博市/张店区\0"
+    "山东/淄博/张店\0"
+    "Zhangdian\0"
+    "山东省/淄博市/博山区\0"
+    "山东/淄博/博山\0"
+    "Boshan\0"
+    "山东省/淄博市/临淄区\0"
+    "山东/淄博/临淄\0"
+    "Linzi\0"
+    "山东省/淄博市/周村区\0"
+    "山东/淄博/周村\0"
+    "Zhoucun\0"
+    "山东省/淄博市/桓台县\0"
+    "山东/淄博/桓台\0"
+    "Huantai\0"
+    "山东省/淄博市/高青县\0"
+    "山东/淄博/高青\0"
+    "Gaoqing\0"
+    "山东省/淄博市/沂源县\0"
+    "山东/淄博/沂源\0"
+    "Yiyuan\0"
+    "山东省/枣庄市\0"
+    "山东/枣庄/枣庄\0"
+    "Zaozhuang\0"
+    "山东省/枣庄市/市中区\0"
+    "山东/枣庄/市中\0"
+    "山东省/枣庄市/薛城区\0"
+    "山东/枣庄/薛城\0"
+    "Xuecheng\0"
+    "山东省/枣庄市/峄城区\0"
+    "山东/枣庄/峄城\0"
+    "山东省/枣庄市/台儿庄区\0"
+    "山东/枣庄/台儿庄\0"
+    "Taierzhuang\0"
+    "山东省/枣庄市/山亭区\0"
+    "山东/枣庄/山亭\0"
+    "Shanting\0"
+    "山东省/枣庄市/滕州市\0"
+    "山东/枣庄/滕州\0"
+    "Tengzhou\0"
+    "山东省/东营市\0"
+    "山东/东营\0"
+    "Dongying\0"
+    "山东省/东营市/东营区\0"
+    "山东/东营/东营\0"
+    "山东省/东营市/河口区\0"
+    "山东/东营/河口\0"
+    "Hekou\0"
+    "山东省/东营市/垦利区\0"
+    "山东/东营/垦利\0"
+    "Kenli\0"
+    "山东省/东营市/利津县\0"
+    "山东/东营/利津\0"
+    "Lijin\0"
+    "山东省/东营市/广饶县\0"
+    "山东/东营/广饶\0"
+    "Guangrao\0"
+    "山东省/烟台市\0"
+    "山东/烟台/烟台\0"
+    "Yantai\0"
+    "山东省/烟台市/芝罘区\0"
+    "山东/烟台/芝罘\0"
+    "Zhifu\0"
+    "山东省/烟台市/福山区\0"
+    "山东/烟台/福山\0"
+    "山东省/烟台市/牟平区\0"
+    "山东/烟台/牟平\0"
+    "Mouping\0"
+    "山东省/烟台市/莱山区\0"
+    "山东/烟台/莱山\0"
+    "Laishan\0"
+    "山东省/烟台市/长岛县\0"
+    "山东/烟台/长岛\0"
+    "Changdao\0"
+    "山东省/烟台市/龙口市\0"
+    "山东/烟台/龙口\0"
+    "Longkou\0"
+    "山东省/烟台市/莱阳市\0"
+    "山东/烟台/莱阳\0"
+    "Laiyang\0"
+    "山东省/烟台市/莱州市\0"
+    "山东/烟台/莱州\0"
+    "Laizhou\0"
+    "山东省/烟台市/蓬莱市\0"
+    "山东/烟台/蓬莱\0"
+    "Penglai\0"
+    "山东省/烟台市/招远市\0"
+    "山东/烟台/招远\0"
+    "山东省/烟台市/栖霞市\0"
+    "山东/烟台/栖霞\0"
+    "山东省/烟台市/海阳市\0"
+    "山东/烟台/海阳\0"
+    "Haiyang\0"
+    "山东省/潍坊市\0"
+    "山东/潍坊/潍坊\0"
+    "Weifang\0"
+    "山东省/潍坊市/潍城区\0"
+    "山东/潍坊/潍城\0"
+    "Weicheng\0"
+    "山东省/潍坊市/寒亭区\0"
+    "山东/潍坊/寒亭\0"
+    "Hanting\0"
+    "山东省/潍坊市/坊子区\0"
+    "山东/潍坊/坊子\0"
+    "Fangzi\0"
+    "山东省/潍坊市/奎文区\0"
+    "山东/潍坊/奎文\0"
+    "Kuiwen\0"
+    "山东省/潍坊市/临朐县\0"
+    "山东/潍坊/临朐\0"
+    "Linqu\0"
+    "山东省/潍坊市/昌乐县\0"
+    "山东/潍坊/昌乐\0"
+    "山东省/潍坊市/青州市\0"
+    "山东/潍坊/青州\0"
+    "Qingzhou\0"
+    "山东省/潍坊市/诸城市\0"
+    "山东/潍坊/诸城\0"
+    "Zhucheng\0"
+    "山东省/潍坊市/寿光市\0"
+    "山东/潍坊/寿光\0"
+    "Shouguang\0"
+    "山东省/潍坊市/安丘市\0"
+    "山东/潍坊/安丘\0"
+    "Anqiu\0"
+    "山东省/潍坊市/高密市\0"
+    "山东/潍坊/高密\0"
+    "Gaomi\0"
+    "山东省/潍坊市/昌邑市\0"
+    "山东/潍坊/昌邑\0"
+    "山东省/济宁市\0"
+    "山东/济宁/济宁\0"
+    "山东省/济宁市/任城区\0"
+    "山东/济宁/任城\0"
+    "Rencheng\0"
+    "山东省/济宁市/兖州区\0"
+    "山东/济宁/兖州\0"
+    "Yanzhou\0"
+    "山东省/济宁市/微山县\0"
+    "山东/济宁/微山\0"
+    "Weishan\0"
+    "山东省/济宁市/鱼台县\0"
+    "山东/济宁/鱼台\0"
+    "Yutai\0"
+    "山东省/济宁市/金乡县\0"
+    "山东/济宁/金乡\0"
+    "Jinxiang\0"
+    "山东省/济宁市/嘉祥县\0"
+    "山东/济宁/嘉祥\0"
+    "Jiaxiang\0"
+    "山东省/济宁市/汶上县\0"
+    "山东/济宁/汶上\0"
+    "Wenshang\0"
+    "山东省/济宁市/泗水县\0"
+    "山东/济宁/泗水\0"
+    "Sishui\0"
+    "山东省/济宁市/梁山县\0"
+    "山东/济宁/梁山\0"
+    "Liangshan\0"
+    "山东省/济宁市/曲阜市\0"
+    "山东/济宁/曲阜\0"
+    "Qufu\0"
+    "山东省/济宁市/邹城市\0"
+    "山东/济宁/邹城\0"
+    "Zoucheng\0"
+    "山东省/泰安市\0"
+    "山东/泰安/泰安\0"
+    "山东省/泰安市/泰山区\0"
+    "山东/泰安/泰山\0"
+    "Taishan\0"
+    "山东省/泰安市/岱岳区\0"
+    "山东/泰安/岱岳\0"
+    "Daiyue\0"
+    "山东省/泰安市/宁阳县\0"
+    "山东/泰安/宁阳\0"
+    "Ningyang\0"
+    "山东省/泰安市/东平县\0"
+    "山东/泰安/东平\0"
+    "Dongping\0"
+    "山东省/泰安市/新泰市\0"
+    "山东/泰安/新泰\0"
+    "Xintai\0"
+    "山东省/泰安市/肥城市\0"
+    "山东/泰安/肥城\0"
+    "Feicheng\0"
+    "山东省/威海市\0"
+    "山东/威海/威海\0"
+    "Weihai\0"
+    "山东省/威海市/环翠区\0"
+    "山东/威海/环翠\0"
+    "Huancui\0"
+    "山东省/威海市/文登区\0"
+    "山东/威海/文登\0"
+    "Wendeng\0"
+    "山东省/威海市/荣成市\0"
+    "山东/威海/荣成\0"
+    "山东省/威海市/乳山市\0"
+    "山东/威海/乳山\0"
+    "Rushan\0"
+    "山东省/日照市\0"
+    "山东/日照/日照\0"
+    "Rizhao\0"
+    "山东省/日照市/东港区\0"
+    "山东/日照/东港\0"
+    "山东省/日照市/岚山区\0"
+    "山东/日照/岚山\0"
+    "Lanshan\0"
+    "山东省/日照市/五莲县\0"
+    "山东/日照/五莲\0"
+    "Wulian\0"
+    "山东省/日照市/莒县\0"
+    "山东/日照/莒县\0"
+    "Juxian\0"
+    "山东省/临沂市\0"
+    "山东/临沂/临沂\0"
+    "山东省/临沂市/兰山区\0"
+    "山东/临沂/兰山\0"
+    "山东省/临沂市/罗庄区\0"
+    "山东/临沂/罗庄\0"
+    "Luozhuang\0"
+    "山东省/临沂市/河东区\0"
+    "山东/临沂/河东\0"
+    "山东省/临沂市/沂南县\0"
+    "山东/临沂/沂南\0"
+    "Yinan\0"
+    "山东省/临沂市/郯城县\0"
+    "山东/临沂/郯城\0"
+    "Tancheng\0"
+    "山东省/临沂市/沂水县\0"
+    "山东/临沂/沂水\0"
+    "Yishui\0"
+    "山东省/临沂市/兰陵县\0"
+    "山东/临沂/兰陵\0"
+    "Lanling\0"
+    "山东省/临沂市/费县\0"
+    "山东/临沂/费县\0"
+    "Feixian\0"
+    "山东省/临沂市/平邑县\0"
+    "山东/临沂/平邑\0"
+    "Pingyi\0"
+    "山东省/临沂市/莒南县\0"
+    "山东/临沂/莒南\0"
+    "Junan\0"
+    "山东省/临沂市/蒙阴县\0"
+    "山东/临沂/蒙阴\0"
+    "Mengyin\0"
+    "山东省/临沂市/临沭县\0"
+    "山东/临沂/临沭\0"
+    "Linshu\0"
+    "山东省/德州市\0"
+    "山东/德州/德州\0"
+    "Dezhou\0"
+    "山东省/德州市/德城区\0"
+    "山东/德州/德城\0"
+    "Decheng\0"
+    "山东省/德州市/陵城区\0"
+    "山东/德州/陵城\0"
+    "Lingxian\0"
+    "山东省/德州市/宁津县\0"
+    "山东/德州/宁津\0"
+    "山东省/德州市/庆云县\0"
+    "山东/德州/庆云\0"
+    "Qingyun\0"
+    "山东省/德州市/临邑县\0"
+    "山东/德州/临邑\0"
+    "山东省/德州市/齐河县\0"
+    "山东/德州/齐河\0"
+    "Qihe\0"
+    "山东省/德州市/平原县\0"
+    "山东/德州/平原\0"
+    "Pingyuan\0"
+    "山东省/德州市/夏津县\0"
+    "山东/德州/夏津\0"
+    "Xiajin\0"
+    "山东省/德州市/武城县\0"
+    "山东/德州/武城\0"
+    "山东省/德州市/乐陵市\0"
+    "山东/德州/乐陵\0"
+    "Leling\0"
+    "山东省/德州市/禹城市\0"
+    "山东/德州/禹城\0"
+    "Yucheng\0"
+    "山东省/聊城市\0"
+    "山东/聊城/聊城\0"
+    "Liaocheng\0"
+    "山东省/聊城市/东昌府区\0"
+    "山东/聊城/东昌府\0"
+    "Dongchangfu\0"
+    "山东省/聊城市/阳谷县\0"
+    "山东/聊城/阳谷\0"
+    "Yanggu\0"
+    "山东省/聊城市/莘县\0"
+    "山东/聊城/莘县\0"
+    "Shenxian\0"
+    "山东省/聊城市/茌平县\0"
+    "山东/聊城/茌平\0"
+    "Chiping\0"
+    "山东省/聊城市/东阿县\0"
+    "山东/聊城/东阿\0"
+    "Donge\0"
+    "山东省/聊城市/冠县\0"
+    "山东/聊城/冠县\0"
+    "Guanxian\0"
+    "山东省/聊城市/高唐县\0"
+    "山东/聊城/高唐\0"
+    "Gaotang\0"
+    "山东省/聊城市/临清市\0"
+    "山东/聊城/临清\0"
+    "Linqing\0"
+    "山东省/滨州市\0"
+    "山东/滨州/滨州\0"
+    "Binzhou\0"
+    "山东省/滨州市/滨城区\0"
+    "山东/滨州/滨城\0"
+    "Bincheng\0"
+    "山东省/滨州市/沾化区\0"
+    "山东/滨州/沾化\0"
+    "Zhanhua\0"
+    "山东省/滨州市/惠民县\0"
+    "山东/滨州/惠民\0"
+    "山东省/滨州市/阳信县\0"
+    "山东/滨州/阳信\0"
+    "Yangxin\0"
+    "山东省/滨州市/无棣县\0"
+    "山东/滨州/无棣\0"
+    "Wudi\0"
+    "山东省/滨州市/博兴县\0"
+    "山东/滨州/博兴\0"
+    "Boxing\0"
+    "山东省/滨州市/邹平市\0"
+    "山东/滨州/邹平\0"
+    "Zouping\0"
+    "山东省/菏泽市\0"
+    "山东/菏泽/菏泽\0"
+    "Heze\0"
+    "山东省/菏泽市/牡丹区\0"
+    "山东/菏泽/牡丹\0"
+    "Mudan\0"
+    "山东省/菏泽市/定陶区\0"
+    "山东/菏泽/定陶\0"
+    "Dingtao\0"
+    "山东省/菏泽市/曹县\0"
+    "山东/菏泽/曹县\0"
+    "Caoxian\0"
+    "山东省/菏泽市/单县\0"
+    "山东/菏泽/单县\0"
+    "Shanxian\0"
+    "山东省/菏泽市/成武县\0"
+    "山东/菏泽/成武\0"
+    "Chengwu\0"
+    "山东省/菏泽市/巨野县\0"
+    "山东/菏泽/巨野\0"
+    "Juye\0"
+    "山东省/菏泽市/郓城县\0"
+    "山东/菏泽/郓城\0"
+    "山东省/菏泽市/鄄城县\0"
+    "山东/菏泽/鄄城\0"
+    "Juancheng\0"
+    "山东省/菏泽市/东明县\0"
+    "山东/菏泽/东明\0"
+    "Dongming\0"
+    "河南省/郑州市\0"
+    "河南/郑州/郑州\0"
+    "Zhengzhou\0"
+    "河南省/郑州市/中原区\0"
+    "河南/郑州/中原\0"
+    "Zhongyuan\0"
+    "河南省/郑州市/二七区\0"
+    "河南/郑州/二七\0"
+    "Erqi\0"
+    "河南省/郑州市/管城回族区\0"
+    "河南/郑州/管城\0"
+    "Guancheng\0"
+    "河南省/郑州市/金水区\0"
+    "河南/郑州/金水\0"
+    "Jinshui\0"
+    "河南省/郑州市/上街区\0"
+    "河南/郑州/上街\0"
+    "Shangjie\0"
+    "河南省/郑州市/惠济区\0"
+    "河南/郑州/惠济\0"
+    "Huiji\0"
+    "河南省/郑州市/中牟县\0"
+    "河南/郑州/中牟\0"
+    "Zhongmou\0"
+    "河南省/郑州市/巩义市\0"
+    "河南/郑州/巩义\0"
+    "Gongyi\0"
+    "河南省/郑州市/荥阳市\0"
+    "河南/郑州/荥阳\0"
+    "Xingyang\0"
+    "河南省/郑州市/新密市\0"
+    "河南/郑州/新密\0"
+    "Xinmi\0"
+    "河南省/郑州市/新郑市\0"
+    "河南/郑州/新郑\0"
+    "Xinzheng\0"
+    "河南省/郑州市/登封市\0"
+    "河南/郑州/登封\0"
+    "Dengfeng\0"
+    "河南省/开封市\0"
+    "河南/开封/开封\0"
+    "Kaifeng\0"
+    "河南省/开封市/龙亭区\0"
+    "河南/开封/龙亭\0"
+    "Longting\0"
+    "河南省/开封市/顺河回族区\0"
+    "河南/开封/顺河\0"
+    "Shunhe\0"
+    "河南省/开封市/鼓楼区\0"
+    "河南/开封/鼓楼\0"
+    "河南省/开封市/禹王台区\0"
+    "河南/开封/禹王台\0"
+    "Yuwangtai\0"
+    "河南省/开封市/祥符区\0"
+    "河南/开封/祥符\0"
+    "Xiangfu\0"
+    "河南省/开封市/杞县\0"
+    "河南/开封/杞县\0"
+    "河南省/开封市/通许县\0"
+    "河南/开封/通许\0"
+    "Tongxu\0"
+    "河南省/开封市/尉氏县\0"
+    "河南/开封/尉氏\0"
+    "Weishi\0"
+    "河南省/开封市/兰考县\0"
+    "河南/开封/兰考\0"
+    "Lankao\0"
+    "河南省/洛阳市\0"
+    "河南/洛阳/洛阳\0"
+    "Luoyang\0"
+    "河南省/洛阳市/老城区\0"
+    "河南/洛阳/老城\0"
+    "Laocheng\0"
+    "河南省/洛阳市/西工区\0"
+    "河南/洛阳/西工\0"
+    "Xigong\0"
+    "河南省/洛阳市/瀍河回族区\0"
+    "河南/洛阳/瀍河\0"
+    "Chanhe\0"
+    "河南省/洛阳市/涧西区\0"
+    "河南/洛阳/涧西\0"
+    "Jianxi\0"
+    "河南省/洛阳市/吉利区\0"
+    "河南/洛阳/吉利\0"
+    "Jili\0"
+    "河南省/洛阳市/洛龙区\0"
+    "河南/洛阳/洛龙\0"
+    "Luolong\0"
+    "河南省/洛阳市/孟津县\0"
+    "河南/洛阳/孟津\0"
+    "Mengjin\0"
+    "河南省/洛阳市/新安县\0"
+    "河南/洛阳/新安\0"
+    "Xinan\0"
+    "河南省/洛阳市/栾川县\0"
+    "河南/洛阳/栾川\0"
+    "Luanchuan\0"
+    "河南省/洛阳市/嵩县\0"
+    "河南/洛阳/嵩县\0"
+    "Songxian\0"
+    "河南省/洛阳市/汝阳县\0"
+    "河南/洛阳/汝阳\0"
+    "Ruyang\0"
+    "河南省/洛阳市/宜阳县\0"
+    "河南/洛阳/宜阳\0"
+    "河南省/洛阳市/洛宁县\0"
+    "河南/洛阳/洛宁\0"
+    "Luoning\0"
+    "河南省/洛阳市/伊川县\0"
+    "河南/洛阳/伊川\0"
+    "Yichuan\0"
+    "河南省/洛阳市/偃师市\0"
+    "河南/洛阳/偃师\0"
+    "Yanshi\0"
+    "河南省/平顶山市\0"
+    "河南/平顶山/平顶山\0"
+    "Pingdingshan\0"
+    "河南省/平顶山市/新华区\0"
+    "河南/平顶山/新华\0"
+    "河南省/平顶山市/卫东区\0"
+    "河南/平顶山/卫东\0"
+    "Weidong\0"
+    "河南省/平顶山市/石龙区\0"
+    "河南/平顶山/石龙\0"
+    "Shilong\0"
+    "河南省/平顶山市/湛河区\0"
+    "河南/平顶山/湛河\0"
+    "Zhanhe\0"
+    "河南省/平顶山市/宝丰县\0"
+    "河南/平顶山/宝丰\0"
+    "Baofeng\0"
+    "河南省/平顶山市/叶县\0"
+    "河南/平顶山/叶县\0"
+    "Yexian\0"
+    "河南省/平顶山市/鲁山县\0"
+    "河南/平顶山/鲁山\0"
+    "河南省/平顶山市/郏县\0"
+    "河南/平顶山/郏县\0"
+    "Jiaxian\0"
+    "河南省/平顶山市/舞钢市\0"
+    "河南/平顶山/舞钢\0"
+    "Wugang\0"
+    "河南省/平顶山市/汝州市\0"
+    "河南/平顶山/汝州\0"
+    "Ruzhou\0"
+    "河南省/安阳市/文峰区\0"
+    "河南/安阳/文峰\0"
+    "Wenfeng\0"
+    "河南省/安阳市\0"
+    "河南/安阳\0"
+    "Anyang\0"
+    "河南省/安阳市/北关区\0"
+    "河南/安阳/北关\0"
+    "Beiguan\0"
+    "河南省/安阳市/殷都区\0"
+    "河南/安阳/殷都\0"
+    "Yindou\0"
+    "河南省/安阳市/龙安区\0"
+    "河南/安阳/龙安\0"
+    "Longan\0"
+    "河南省/安阳市/安阳县\0"
+    "河南/安阳/安阳\0"
+    "河南省/安阳市/汤阴县\0"
+    "河南/安阳/汤阴\0"
+    "Tangyin\0"
+    "河南省/安阳市/滑县\0"
+    "河南/安阳/滑县\0"
+    "Huaxian\0"
+    "河南省/安阳市/内黄县\0"
+    "河南/安阳/内黄\0"
+    "Neihuang\0"
+    "河南省/安阳市/林州市\0"
+    "河南/安阳/林州\0"
+    "Linzhou\0"
+    "河南省/鹤壁市\0"
+    "河南/鹤壁/鹤壁\0"
+    "Hebi\0"
+    "河南省/鹤壁市/鹤山区\0"
+    "河南/鹤壁/鹤山\0"
+    "Heshan\0"
+    "河南省/鹤壁市/山城区\0"
+    "河南/鹤壁/山城\0"
+    "Shancheng\0"
+    "河南省/鹤壁市/淇滨区\0"
+    "河南/鹤壁/淇滨\0"
+    "Qibin\0"
+    "河南省/鹤壁市/浚县\0"
+    "河南/鹤壁/浚县\0"
+    "Xunxian\0"
+    "河南省/鹤壁市/淇县\0"
+    "河南/鹤壁/淇县\0"
+    "河南省/新乡市\0"
+    "河南/新乡\0"
+    "Xinxiang\0"
+    "河南省/新乡市/红旗区\0"
+    "河南/新乡/红旗\0"
+    "Hongqi\0"
+    "河南省/新乡市/卫滨区\0"
+    "河南/新乡/卫滨\0"
+    "Weibin\0"
+    "河南省/新乡市/凤泉区\0"
+    "河南/新乡/凤泉\0"
+    "Fengquan\0"
+    "河南省/新乡市/牧野区\0"
+    "河南/新乡/牧野\0"
+    "Muye\0"
+    "河南省/新乡市/新乡县\0"
+    "河南/新乡/新乡\0"
+    "河南省/新乡市/获嘉县\0"
+    "河南/新乡/获嘉\0"
+    "Huojia\0"
+    "河南省/新乡市/原阳县\0"
+    "河南/新乡/原阳\0"
+    "Yuanyang\0"
+    "河南省/新乡市/延津县\0"
+    "河南/新乡/延津\0"
+    "Yanjin\0"
+    "河南省/新乡市/封丘县\0"
+    "河南/新乡/封丘\0"
+    "Fengqiu\0"
+    "河南省/新乡市/长垣县\0"
+    "河南/新乡/长垣\0"
+    "Changyuan\0"
+    "河南省/新乡市/卫辉市\0"
+    "河南/新乡/卫辉\0"
+    "Weihui\0"
+    "河南省/新乡市/辉县市\0"
+    "河南/新乡/辉县\0"
+    "Huixian\0"
+    "河南省/焦作市\0"
+    "河南/焦作/焦作\0"
+    "Jiaozuo\0"
+    "河南省/焦作市/解放区\0"
+    "河南/焦作/解放\0"
+    "Jiefang\0"
+    "河南省/焦作市/中站区\0"
+    "河南/焦作/中站\0"
+    "Zhongzhan\0"
+    "河南省/焦作市/马村区\0"
+    "河南/焦作/马村\0"
+    "Macun\0"
+    "河南省/焦作市/山阳区\0"
+    "河南/焦作/山阳\0"
+    "Shanyang\0"
+    "河南省/焦作市/修武县\0"
+    "河南/焦作/修武\0"
+    "Xiuwu\0"
+    "河南省/焦作市/博爱县\0"
+    "河南/焦作/博爱\0"
+    "Boai\0"
+    "河南省/焦作市/武陟县\0"
+    "河南/焦作/武陟\0"
+    "Wuzhi\0"
+    "河南省/焦作市/温县\0"
+    "河南/焦作/温县\0"
+    "Wenxian\0"
+    "河南省/焦作市/沁阳市\0"
+    "河南/焦作/沁阳\0"
+    "Qinyang\0"
+    "河南省/焦作市/孟州市\0"
+    "河南/焦作/孟州\0"
+    "Mengzhou\0"
+    "河南省/濮阳市\0"
+    "河南/濮阳\0"
+    "Puyang\0"
+    "河南省/濮阳市/华龙区\0"
+    "河南/濮阳/华龙\0"
+    "Hualong\0"
+    "河南省/濮阳市/清丰县\0"
+    "河南/濮阳/清丰\0"
+    "Qingfeng\0"
+    "河南省/濮阳市/南乐县\0"
+    "河南/濮阳/南乐\0"
+    "Nanle\0"
+    "河南省/濮阳市/范县\0"
+    "河南/濮阳/范县\0"
+    "Fanxian\0"
+    "河南省/濮阳市/台前县\0"
+    "河南/濮阳/台前\0"
+    "Taiqian\0"
+    "河南省/濮阳市/濮阳县\0"
+    "河南/濮阳/濮阳\0"
+    "河南省/许昌市\0"
+    "河南/许昌/许昌\0"
+    "Xuchang\0"
+    "河南省/许昌市/魏都区\0"
+    "河南/许昌/魏都\0"
+    "Weidou\0"
+    "河南省/许昌市/建安区\0"
+    "河南/许昌/建安\0"
+    "Jianan\0"
+    "河南省/许昌市/鄢陵县\0"
+    "河南/许昌/鄢陵\0"
+    "Yanling\0"
+    "河南省/许昌市/襄城县\0"
+    "河南/许昌/襄城\0"
+    "河南省/许昌市/禹州市\0"
+    "河南/许昌/禹州\0"
+    "Yuzhou\0"
+    "河南省/许昌市/长葛市\0"
+    "河南/许昌/长葛\0"
+    "Changge\0"
+    "河南省/漯河市\0"
+    "河南/漯河/漯河\0"
+    "Luohe\0"
+    "河南省/漯河市/源汇区\0"
+    "河南/漯河/源汇\0"
+    "Yuanhui\0"
+    "河南省/漯河市/郾城区\0"
+    "河南/漯河/郾城\0"
+    "河南省/漯河市/召陵区\0"
+    "河南/漯河/召陵\0"
+    "Zhaoling\0"
+    "河南省/漯河市/舞阳县\0"
+    "河南/漯河/舞阳\0"
+    "Wuyang\0"
+    "河南省/漯河市/临颍县\0"
+    "河南/漯河/临颍\0"
+    "Linying\0"
+    "河南省/三门峡市\0"
+    "河南/三门峡/三门峡\0"
+    "Sanmenxia\0"
+    "河南省/三门峡市/湖滨区\0"
+    "河南/三门峡/湖滨\0"
+    "Hubin\0"
+    "河南省/三门峡市/陕州区\0"
+    "河南/三门峡/陕州\0"
+    "河南省/三门峡市/渑池县\0"
+    "河南/三门峡/渑池\0"
+    "Mianchi\0"
+    "河南省/三门峡市/卢氏县\0"
+    "河南/三门峡/卢氏\0"
+    "Lushi\0"
+    "河南省/三门峡市/义马市\0"
+    "河南/三门峡/义马\0"
+    "Yima\0"
+    "河南省/三门峡市/灵宝市\0"
+    "河南/三门峡/灵宝\0"
+    "Lingbao\0"
+    "河南省/南阳市\0"
+    "河南/南阳/南阳\0"
+    "Nanyang\0"
+    "河南省/南阳市/宛城区\0"
+    "河南/南阳/宛城\0"
+    "Wancheng\0"
+    "河南省/南阳市/卧龙区\0"
+    "河南/南阳/卧龙\0"
+    "Wolong\0"
+    "河南省/南阳市/南召县\0"
+    "河南/南阳/南召\0"
+    "Nanzhao\0"
+    "河南省/南阳市/方城县\0"
+    "河南/南阳/方城\0"
+    "Fangcheng\0"
+    "河南省/南阳市/西峡县\0"
+    "河南/南阳/西峡\0"
+    "Xixia\0"
+    "河南省/南阳市/镇平县\0"
+    "河南/南阳/镇平\0"
+    "Zhenping\0"
+    "河南省/南阳市/内乡县\0"
+    "河南/南阳/内乡\0"
+    "Neixiang\0"
+    "河南省/南阳市/淅川县\0"
+    "河南/南阳/淅川\0"
+    "Xichuan\0"
+    "河南省/南阳市/社旗县\0"
+    "河南/南阳/社旗\0"
+    "Sheqi\0"
+    "河南省/南阳市/唐河县\0"
+    "河南/南阳/唐河\0"
+    "Tanghe\0"
+    "河南省/南阳市/新野县\0"
+    "河南/南阳/新野\0"
+    "Xinye\0"
+    "河南省/南阳市/桐柏县\0"
+    "河南/南阳/桐柏\0"
+    "Tongbai\0"
+    "河南省/南阳市/邓州市\0"
+    "河南/南阳/邓州\0"
+    "Dengzhou\0"
+    "河南省/商丘市\0"
+    "河南/商丘/商丘\0"
+    "Shangqiu\0"
+    "河南省/商丘市/梁园区\0"
+    "河南/商丘/梁园\0"
+    "Liangyuan\0"
+    "河南省/商丘市/睢阳区\0"
+    "河南/商丘/睢阳\0"
+    "Suiyang\0"
+    "河南省/商丘市/民权县\0"
+    "河南/商丘/民权\0"
+    "Minquan\0"
+    "河南省/商丘市/睢县\0"
+    "河南/商丘/睢县\0"
+    "Suixian\0"
+    "河南省/商丘市/宁陵县\0"
+    "河南/商丘/宁陵\0"
+    "Ningling\0"
+    "河南省/商丘市/柘城县\0"
+    "河南/商丘/柘城\0"
+    "Zhecheng\0"
+    "河南省/商丘市/虞城县\0"
+    "河南/商丘/虞城\0"
+    "河南省/商丘市/夏邑县\0"
+    "河南/商丘/夏邑\0"
+    "Xiayi\0"
+    "河南省/商丘市/永城市\0"
+    "河南/商丘/永城\0"
+    "Yongcheng\0"
+    "河南省/信阳市\0"
+    "河南/信阳/信阳\0"
+    "Xinyang\0"
+    "河南省/信阳市/浉河区\0"
+    "河南/信阳/浉河\0"
+    "Shihe\0"
+    "河南省/信阳市/平桥区\0"
+    "河南/信阳/平桥\0"
+    "Pingqiao\0"
+    "河南省/信阳市/罗山县\0"
+    "河南/信阳/罗山\0"
+    "Luoshan\0"
+    "河南省/信阳市/光山县\0"
+    "河南/信阳/光山\0"
+    "Guangshan\0"
+    "河南省/信阳市/新县\0"
+    "河南/信阳/新县\0"
+    "Xinxian\0"
+    "河南省/信阳市/商城县\0"
+    "河南/信阳/商城\0"
+    "河南省/信阳市/固始县\0"
+    "河南/信阳/固始\0"
+    "Gushi\0"
+    "河南省/信阳市/潢川县\0"
+    "河南/信阳/潢川\0"
+    "Huangchuan\0"
+    "河南省/信阳市/淮滨县\0"
+    "河南/信阳/淮滨\0"
+    "Huaibin\0"
+    "河南省/信阳市/息县\0"
+    "河南/信阳/息县\0"
+    "河南省/周口市\0"
+    "河南/周口/周口\0"
+    "Zhoukou\0"
+    "河南省/周口市/川汇区\0"
+    "河南/周口/川汇\0"
+    "Chuanhui\0"
+    "河南省/周口市/扶沟县\0"
+    "河南/周口/扶沟\0"
+    "Fugou\0"
+    "河南省/周口市/西华县\0"
+    "河南/周口/西华\0"
+    "Xihua\0"
+    "河南省/周口市/商水县\0"
+    "河南/周口/商水\0"
+    "Shangshui\0"
+    "河南省/周口市/沈丘县\0"
+    "河南/周口/沈丘\0"
+    "Shenqiu\0"
+    "河南省/周口市/郸城县\0"
+    "河南/周口/郸城\0"
+    "Dancheng\0"
+    "河南省/周口市/淮阳县\0"
+    "河南/周口/淮阳\0"
+    "Huaiyang\0"
+    "河南省/周口市/太康县\0"
+    "河南/周口/太康\0"
+    "Taikang\0"
+    "河南省/周口市/鹿邑县\0"
+    "河南/周口/鹿邑\0"
+    "Luyi\0"
+    "河南省/周口市/项城市\0"
+    "河南/周口/项城\0"
+    "河南省/驻马店市\0"
+    "河南/驻马店/驻马店\0"
+    "Zhumadian\0"
+    "河南省/驻马店市/驿城区\0"
+    "河南/驻马店/驿城\0"
+    "河南省/驻马店市/西平县\0"
+    "河南/驻马店/西平\0"
+    "Xiping\0"
+    "河南省/驻马店市/上蔡县\0"
+    "河南/驻马店/上蔡\0"
+    "Shangcai\0"
+    "河南省/驻马店市/平舆县\0"
+    "河南/驻马店/平舆\0"
+    "Pingyu\0"
+    "河南省/驻马店市/正阳县\0"
+    "河南/驻马店/正阳\0"
+    "Zhengyang\0"
+    "河南省/驻马店市/确山县\0"
+    "河南/驻马店/确山\0"
+    "Queshan\0"
+    "河南省/驻马店市/泌阳县\0"
+    "河南/驻马店/泌阳\0"
+    "Biyang\0"
+    "河南省/驻马店市/汝南县\0"
+    "河南/驻马店/汝南\0"
+    "Runan\0"
+    "河南省/驻马店市/遂平县\0"
+    "河南/驻马店/遂平\0"
+    "Suiping\0"
+    "河南省/驻马店市/新蔡县\0"
+    "河南/驻马店/新蔡\0"
+    "Xincai\0"
+    "河南省/济源市\0"
+    "河南/济源/济源\0"
+    "Jiyuan\0"
+    "湖北省/武汉市\0"
+    "湖北/武汉/武汉\0"
+    "Wuhan\0"
+    "湖北省/武汉市/江岸区\0"
+    "湖北/武汉/江岸\0"
+    "Jiangan\0"
+    "湖北省/武汉市/江汉区\0"
+    "湖北/武汉/江汉\0"
+    "Jianghan\0"
+    "湖北省/武汉市/硚口区\0"
+    "湖北/武汉/硚口\0"
+    "Qiaokou\0"
+    "湖北省/武汉市/汉阳区\0"
+    "湖北/武汉/汉阳\0"
+    "Hanyang\0"
+    "湖北省/武汉市/武昌区\0"
+    "湖北/武汉/武昌\0"
+    "湖北省/武汉市/青山区\0"
+    "湖北/武汉/青山\0"
+    "湖北省/武汉市/洪山区\0"
+    "湖北/武汉/洪山\0"
+    "湖北省/武汉市/东西湖区\0"
+    "湖北/武汉/东西湖\0"
+    "Dongxihu\0"
+    "湖北省/武汉市/汉南区\0"
+    "湖北/武汉/汉南\0"
+    "Hannan\0"
+    "湖北省/武汉市/蔡甸区\0"
+    "湖北/武汉/蔡甸\0"
+    "Caidian\0"
+    "湖北省/武汉市/江夏区\0"
+    "湖北/武汉/江夏\0"
+    "Jiangxia\0"
+    "湖北省/武汉市/黄陂区\0"
+    "湖北/武汉/黄陂\0"
+    "Huangpi\0"
+    "湖北省/武汉市/新洲区\0"
+    "湖北/武汉/新洲\0"
+    "湖北省/黄石市\0"
+    "湖北/黄石/黄石\0"
+    "Huangshi\0"
+    "湖北省/黄石市/黄石港区\0"
+    "湖北/黄石/黄石港\0"
+    "Huangshigang\0"
+    "湖北省/黄石市/西塞山区\0"
+    "湖北/黄石/西塞山\0"
+    "Xisaishan\0"
+    "湖北省/黄石市/下陆区\0"
+    "湖北/黄石/下陆\0"
+    "Xialu\0"
+    "湖北省/黄石市/铁山区\0"
+    "湖北/黄石/铁山\0"
+    "Tieshan\0"
+    "湖北省/黄石市/阳新县\0"
+    "湖北/黄石/阳新\0"
+    "湖北省/黄石市/大冶市\0"
+    "湖北/黄石/大冶\0"
+    "Daye\0"
+    "湖北省/十堰市\0"
+    "湖北/十堰/十堰\0"
+    "Shiyan\0"
+    "湖北省/十堰市/茅箭区\0"
+    "湖北/十堰/茅箭\0"
+    "Maojian\0"
+    "湖北省/十堰市/张湾区\0"
+    "湖北/十堰/张湾\0"
+    "Zhangwan\0"
+    "湖北省/十堰市/郧阳区\0"
+    "湖北/十堰/郧阳\0"
+    "Yunxian\0"
+    "湖北省/十堰市/郧西县\0"
+    "湖北/十堰/郧西\0"
+    "Yunxi\0"
+    "湖北省/十堰市/竹山县\0"
+    "湖北/十堰/竹山\0"
+    "湖北省/十堰市/竹溪县\0"
+    "湖北/十堰/竹溪\0"
+    "Zhuxi\0"
+    "湖北省/十堰市/房县\0"
+    "湖北/十堰/房县\0"
+    "Fangxian\0"
+    "湖北省/十堰市/丹江口市\0"
+    "湖北/十堰/丹江口\0"
+    "Danjiangkou\0"
+    "湖北省/宜昌市\0"
+    "湖北/宜昌/宜昌\0"
+    "Yichang\0"
+    "湖北省/宜昌市/西陵区\0"
+    "湖北/宜昌/西陵\0"
+    "Xiling\0"
+    "湖北省/宜昌市/伍家岗区\0"
+    "湖北/宜昌/伍家岗\0"
+    "Wujiagang\0"
+    "湖北省/宜昌市/点军区\0"
+    "湖北/宜昌/点军\0"
+    "Dianjun\0"
+    "湖北省/宜昌市/猇亭区\0"
+    "湖北/宜昌/猇亭\0"
+    "Xiaoting\0"
+    "湖北省/宜昌市/夷陵区\0"
+    "湖北/宜昌/夷陵\0"
+    "Yiling\0"
+    "湖北省/宜昌市/远安县\0"
+    "湖北/宜昌/远安\0"
+    "Yuanan\0"
+    "湖北省/宜昌市/兴山县\0"
+    "湖北/宜昌/兴山\0"
+    "湖北省/宜昌市/秭归县\0"
+    "湖北/宜昌/秭归\0"
+    "Zigui\0"
+    "湖北省/宜昌市/长阳土家族自治县\0"
+    "湖北/宜昌/长阳\0"
+    "Changyang\0"
+    "湖北省/宜昌市/五峰土家族自治县\0"
+    "湖北/宜昌/五峰\0"
+    "Wufeng\0"
+    "湖北省/宜昌市/宜都市\0"
+    "湖北/宜昌/宜都\0"
+    "Yidu\0"
+    "湖北省/宜昌市/当阳市\0"
+    "湖北/宜昌/当阳\0"
+    "Dangyang\0"
+    "湖北省/宜昌市/枝江市\0"
+    "湖北/宜昌/枝江\0"
+    "Zhijiang\0"
+    "湖北省/襄阳市\0"
+    "湖北/襄阳/襄阳\0"
+    "湖北省/襄阳市/襄城区\0"
+    "湖北/襄阳/襄城\0"
+    "湖北省/襄阳市/樊城区\0"
+    "湖北/襄阳/樊城\0"
+    "Fancheng\0"
+    "湖北省/襄阳市/襄州区\0"
+    "湖北/襄阳/襄州\0"
+    "Xiangzhou\0"
+    "湖北省/襄阳市/南漳县\0"
+    "湖北/襄阳/南漳\0"
+    "Nanzhang\0"
+    "湖北省/襄阳市/谷城县\0"
+    "湖北/襄阳/谷城\0"
+    "湖北省/襄阳市/保康县\0"
+    "湖北/襄阳/保康\0"
+    "Baokang\0"
+    "湖北省/襄阳市/老河口市\0"
+    "湖北/襄阳/老河口\0"
+    "Laohekou\0"
+    "湖北省/襄阳市/枣阳市\0"
+    "湖北/襄阳/枣阳\0"
+    "Zaoyang\0"
+    "湖北省/襄阳市/宜城市\0"
+    "湖北/襄阳/宜城\0"
+    "湖北省/鄂州市\0"
+    "湖北/鄂州/鄂州\0"
+    "Ezhou\0"
+    "湖北省/鄂州市/梁子湖区\0"
+    "湖北/鄂州/梁子湖\0"
+    "Liangzihu\0"
+    "湖北省/鄂州市/华容区\0"
+    "湖北/鄂州/华容\0"
+    "Huarong\0"
+    "湖北省/鄂州市/鄂城区\0"
+    "湖北/鄂州/鄂城\0"
+    "Echeng\0"
+    "湖北省/荆门市\0"
+    "湖北/荆门/荆门\0"
+    "Jingmen\0"
+    "湖北省/荆门市/东宝区\0"
+    "湖北/荆门/东宝\0"
+    "Dongbao\0"
+    "湖北省/荆门市/掇刀区\0"
+    "湖北/荆门/掇刀\0"
+    "Duodao\0"
+    "湖北省/荆门市/沙洋县\0"
+    "湖北/荆门/沙洋\0"
+    "Shayang\0"
+    "湖北省/荆门市/钟祥市\0"
+    "湖北/荆门/钟祥\0"
+    "Zhongxiang\0"
+    "湖北省/荆门市/京山市\0"
+    "湖北/荆门/京山\0"
+    "Jingshan\0"
+    "湖北省/孝感市\0"
+    "湖北/孝感/孝感\0"
+    "Xiaogan\0"
+    "湖北省/孝感市/孝南区\0"
+    "湖北/孝感/孝南\0"
+    "Xiaonan\0"
+    "湖北省/孝感市/孝昌县\0"
+    "湖北/孝感/孝昌\0"
+    "Xiaochang\0"
+    "湖北省/孝感市/大悟县\0"
+    "湖北/孝感/大悟\0"
+    "Dawu\0"
+    "湖北省/孝感市/云梦县\0"
+    "湖北/孝感/云梦\0"
+    "Yunmeng\0"
+    "湖北省/孝感市/应城市\0"
+    "湖北/孝感/应城\0"
+    "Yingcheng\0"
+    "湖北省/孝感市/安陆市\0"
+    "湖北/孝感/安陆\0"
+    "Anlu\0"
+    "湖北省/孝感市/汉川市\0"
+    "湖北/孝感/汉川\0"
+    "Hanchuan\0"
+    "湖北省/荆州市\0"
+    "湖北/荆州\0"
+    "Jingzhou\0"
+    "湖北省/荆州市/沙市区\0"
+    "湖北/荆州/沙市\0"
+    "Shashi\0"
+    "湖北省/荆州市/荆州区\0"
+    "湖北/荆州/荆州\0"
+    "湖北省/荆州市/公安县\0"
+    "湖北/荆州/公安\0"
+    "Gongan\0"
+    "湖北省/荆州市/监利县\0"
+    "湖北/荆州/监利\0"
+    "Jianli\0"
+    "湖北省/荆州市/江陵县\0"
+    "湖北/荆州/江陵\0"
+    "Jiangling\0"
+    "湖北省/荆州市/石首市\0"
+    "湖北/荆州/石首\0"
+    "Shishou\0"
+    "湖北省/荆州市/洪湖市\0"
+    "湖北/荆州/洪湖\0"
+    "Honghu\0"
+    "湖北省/荆州市/松滋市\0"
+    "湖北/荆州/松滋\0"
+    "Songzi\0"
+    "湖北省/黄冈市\0"
+    "湖北/黄冈/黄冈\0"
+    "Huanggang\0"
+    "湖北省/黄冈市/黄州区\0"
+    "湖北/黄冈/黄州\0"
+    "Huangzhou\0"
+    "湖北省/黄冈市/团风县\0"
+    "湖北/黄冈/团风\0"
+    "Tuanfeng\0"
+    "湖北省/黄冈市/红安县\0"
+    "湖北/黄冈/红安\0"
+    "Hongan\0"
+    "湖北省/黄冈市/罗田县\0"
+    "湖北/黄冈/罗田\0"
+    "Luotian\0"
+    "湖北省/黄冈市/英山县\0"
+    "湖北/黄冈/英山\0"
+    "Yingshan\0"
+    "湖北省/黄冈市/浠水县\0"
+    "湖北/黄冈/浠水\0"
+    "Xishui\0"
+    "湖北省/黄冈市/蕲春县\0"
+    "湖北/黄冈/蕲春\0"
+    "Qichun\0"
+    "湖北省/黄冈市/黄梅县\0"
+    "湖北/黄冈/黄梅\0"
+    "Huangmei\0"
+    "湖北省/黄冈市/麻城市\0"
+    "湖北/黄冈/麻城\0"
+    "Macheng\0"
+    "湖北省/黄冈市/武穴市\0"
+    "湖北/黄冈/武穴\0"
+    "Wuxue\0"
+    "湖北省/咸宁市\0"
+    "湖北/咸宁/咸宁\0"
+    "Xianning\0"
+    "湖北省/咸宁市/咸安区\0"
+    "湖北/咸宁/咸安\0"
+    "Xianan\0"
+    "湖北省/咸宁市/嘉鱼县\0"
+    "湖北/咸宁/嘉鱼\0"
+    "Jiayu\0"
+    "湖北省/咸宁市/通城县\0"
+    "湖北/咸宁/通城\0"
+    "湖北省/咸宁市/崇阳县\0"
+    "湖北/咸宁/崇阳\0"
+    "Chongyang\0"
+    "湖北省/咸宁市/通山县\0"
+    "湖北/咸宁/通山\0"
+    "湖北省/咸宁市/赤壁市\0"
+    "湖北/咸宁/赤壁\0"
+    "Chibi\0"
+    "湖北省/随州市\0"
+    "湖北/随州/随州\0"
+    "Suizhou\0"
+    "湖北省/随州市/曾都区\0"
+    "湖北/随州/曾都\0"
+    "Zengdou\0"
+    "湖北省/随州市/随县\0"
+    "湖北/随州/随县\0"
+    "湖北省/随州市/广水市\0"
+    "湖北/随州/广水\0"
+    "Guangshui\0"
+    "湖北省/恩施土家族苗族自治州\0"
+    "湖北/恩施\0"
+    "Enshi\0"
+    "湖北省/恩施土家族苗族自治州/恩施市\0"
+    "湖北/恩施/恩施\0"
+    "湖北省/恩施土家族苗族自治州/利川市\0"
+    "湖北/恩施/利川\0"
+    "湖北省/恩施土家族苗族自治州/建始县\0"
+    "湖北/恩施/建始\0"
+    "Jianshi\0"
+    "湖北省/恩施土家族苗族自治州/巴东县\0"
+    "湖北/恩施/巴东\0"
+    "Badong\0"
+    "湖北省/恩施土家族苗族自治州/宣恩县\0"
+    "湖北/恩施/宣恩\0"
+    "Xuanen\0"
+    "湖北省/恩施土家族苗族自治州/咸丰县\0"
+    "湖北/恩施/咸丰\0"
+    "Xianfeng\0"
+    "湖北省/恩施土家族苗族自治州/来凤县\0"
+    "湖北/恩施/来凤\0"
+    "Laifeng\0"
+    "湖北省/恩施土家族苗族自治州/鹤峰县\0"
+    "湖北/恩施/鹤峰\0"
+    "Hefeng\0"
+    "湖北省/仙桃市\0"
+    "湖北/仙桃/仙桃\0"
+    "Xiantao\0"
+    "湖北省/潜江市\0"
+    "湖北/潜江/潜江\0"
+    "Qianjiang\0"
+    "湖北省/天门市\0"
+    "湖北/天门/天门\0"
+    "Tianmen\0"
+    "湖北省/神农架林区\0"
+    "湖北/神农架/神农架\0"
+    "Shennongjia\0"
+    "湖南省/长沙市\0"
+    "湖南/长沙/长沙\0"
+    "Changsha\0"
+    "湖南省/长沙市/芙蓉区\0"
+    "湖南/长沙/芙蓉\0"
+    "Furong\0"
+    "湖南省/长沙市/天心区\0"
+    "湖南/长沙/天心\0"
+    "Tianxin\0"
+    "湖南省/长沙市/岳麓区\0"
+    "湖南/长沙/岳麓\0"
+    "Yuelu\0"
+    "湖南省/长沙市/开福区\0"
+    "湖南/长沙/开福\0"
+    "Kaifu\0"
+    "湖南省/长沙市/雨花区\0"
+    "湖南/长沙/雨花\0"
+    "湖南省/长沙市/望城区\0"
+    "湖南/长沙/望城\0"
+    "Wangcheng\0"
+    "湖南省/长沙市/长沙县\0"
+    "湖南/长沙/长沙县\0"
+    "Changshaxian\0"
+    "湖南省/长沙市/浏阳市\0"
+    "湖南/长沙/浏阳\0"
+    "Liuyang\0"
+    "湖南省/长沙市/宁乡市\0"
+    "湖南/长沙/宁乡\0"
+    "Ningxiang\0"
+    "湖南省/株洲市\0"
+    "湖南/株洲/株洲\0"
+    "Zhuzhou\0"
+    "湖南省/株洲市/荷塘区\0"
+    "湖南/株洲/荷塘\0"
+    "Hetang\0"
+    "湖南省/株洲市/芦淞区\0"
+    "湖南/株洲/芦淞\0"
+    "Lusong\0"
+    "湖南省/株洲市/石峰区\0"
+    "湖南/株洲/石峰\0"
+    "Shifeng\0"
+    "湖南省/株洲市/天元区\0"
+    "湖南/株洲/天元\0"
+    "Tianyuan\0"
+    "湖南省/株洲市/渌口区\0"
+    "湖南/株洲/渌口\0"
+    "Lukou\0"
+    "湖南省/株洲市/攸县\0"
+    "湖南/株洲/攸县\0"
+    "Youxian\0"
+    "湖南省/株洲市/茶陵县\0"
+    "湖南/株洲/茶陵\0"
+    "Chaling\0"
+    "湖南省/株洲市/炎陵县\0"
+    "湖南/株洲/炎陵\0"
+    "湖南省/株洲市/醴陵市\0"
+    "湖南/株洲/醴陵\0"
+    "Liling\0"
+    "湖南省/湘潭市\0"
+    "湖南/湘潭\0"
+    "Xiangtan\0"
+    "湖南省/湘潭市/雨湖区\0"
+    "湖南/湘潭/雨湖\0"
+    "Yuhu\0"
+    "湖南省/湘潭市/岳塘区\0"
+    "湖南/湘潭/岳塘\0"
+    "Yuetang\0"
+    "湖南省/湘潭市/湘潭县\0"
+    "湖南/湘潭/湘潭\0"
+    "湖南省/湘潭市/湘乡市\0"
+    "湖南/湘潭/湘乡\0"
+    "Xiangxiang\0"
+    "湖南省/湘潭市/韶山市\0"
+    "湖南/湘潭/韶山\0"
+    "Shaoshan\0"
+    "湖南省/衡阳市\0"
+    "湖南/衡阳/衡阳\0"
+    "Hengyang\0"
+    "湖南省/衡阳市/珠晖区\0"
+    "湖南/衡阳/珠晖\0"
+    "Zhuhui\0"
+    "湖南省/衡阳市/雁峰区\0"
+    "湖南/衡阳/雁峰\0"
+    "Yanfeng\0"
+    "湖南省/衡阳市/石鼓区\0"
+    "湖南/衡阳/石鼓\0"
+    "Shigu\0"
+    "湖南省/衡阳市/蒸湘区\0"
+    "湖南/衡阳/蒸湘\0"
+    "Zhengxiang\0"
+    "湖南省/衡阳市/南岳区\0"
+    "湖南/衡阳/南岳\0"
+    "Nanyue\0"
+    "湖南省/衡阳市/衡阳县\0"
+    "湖南/衡阳/衡阳县\0"
+    "Hengyangxian\0"
+    "湖南省/衡阳市/衡南县\0"
+    "湖南/衡阳/衡南\0"
+    "Hengnan\0"
+    "湖南省/衡阳市/衡山县\0"
+    "湖南/衡阳/衡山\0"
+    "湖南省/衡阳市/衡东县\0"
+    "湖南/衡阳/衡东\0"
+    "Hengdong\0"
+    "湖南省/衡阳市/祁东县\0"
+    "湖南/衡阳/祁东\0"
+    "湖南省/衡阳市/耒阳市\0"
+    "湖南/衡阳/耒阳\0"
+    "Leiyang\0"
+    "湖南省/衡阳市/常宁市\0"
+    "湖南/衡阳/常宁\0"
+    "湖南省/邵阳市\0"
+    "湖南/邵阳/邵阳\0"
+    "Shaoyang\0"
+    "湖南省/邵阳市/双清区\0"
+    "湖南/邵阳/双清\0"
+    "Shuangqing\0"
+    "湖南省/邵阳市/大祥区\0"
+    "湖南/邵阳/大祥\0"
+    "Daxiang\0"
+    "湖南省/邵阳市/北塔区\0"
+    "湖南/邵阳/北塔\0"
+    "Beita\0"
+    "湖南省/邵阳市/邵东县\0"
+    "湖南/邵阳/邵东\0"
+    "Shaodong\0"
+    "湖南省/邵阳市/新邵县\0"
+    "湖南/邵阳/新邵\0"
+    "Xinshao\0"
+    "湖南省/邵阳市/邵阳县\0"
+    "湖南/邵阳/邵阳县\0"
+    "Shaoyangxian\0"
+    "湖南省/邵阳市/隆回县\0"
+    "湖南/邵阳/隆回\0"
+    "Longhui\0"
+    "湖南省/邵阳市/洞口县\0"
+    "湖南/邵阳/洞口\0"
+    "Dongkou\0"
+    "湖南省/邵阳市/绥宁县\0"
+    "湖南/邵阳/绥宁\0"
+    "湖南省/邵阳市/新宁县\0"
+    "湖南/邵阳/新宁\0"
+    "Xinning\0"
+    "湖南省/邵阳市/城步苗族自治县\0"
+    "湖南/邵阳/城步\0"
+    "Chengbu\0"
+    "湖南省/邵阳市/武冈市\0"
+    "湖南/邵阳/武冈\0"
+    "湖南省/岳阳市\0"
+    "湖南/岳阳\0"
+    "Yueyang\0"
+    "湖南省/岳阳市/岳阳楼区\0"
+    "湖南/岳阳/岳阳楼\0"
+    "Yueyanglou\0"
+    "湖南省/岳阳市/云溪区\0"
+    "湖南/岳阳/云溪\0"
+    "湖南省/岳阳市/君山区\0"
+    "湖南/岳阳/君山\0"
+    "Junshan\0"
+    "湖南省/岳阳市/岳阳县\0"
+    "湖南/岳阳/岳阳\0"
+    "湖南省/岳阳市/华容县\0"
+    "湖南/岳阳/华容\0"
+    "湖南省/岳阳市/湘阴县\0"
+    "湖南/岳阳/湘阴\0"
+    "Xiangyin\0"
+    "湖南省/岳阳市/平江县\0"
+    "湖南/岳阳/平江\0"
+    "Pingjiang\0"
+    "湖南省/岳阳市/汨罗市\0"
+    "湖南/岳阳/汨罗\0"
+    "Miluo\0"
+    "湖南省/岳阳市/临湘市\0"
+    "湖南/岳阳/临湘\0"
+    "Linxiang\0"
+    "湖南省/常德市\0"
+    "湖南/常德/常德\0"
+    "Changde\0"
+    "湖南省/常德市/武陵区\0"
+    "湖南/常德/武陵\0"
+    "Wuling\0"
+    "湖南省/常德市/鼎城区\0"
+    "湖南/常德/鼎城\0"
+    "Dingcheng\0"
+    "湖南省/常德市/安乡县\0"
+    "湖南/常德/安乡\0"
+    "Anxiang\0"
+    "湖南省/常德市/汉寿县\0"
+    "湖南/常德/汉寿\0"
+    "Hanshou\0"
+    "湖南省/常德市/澧县\0"
+    "湖南/常德/澧县\0"
+    "湖南省/常德市/临澧县\0"
+    "湖南/常德/临澧\0"
+    "Linli\0"
+    "湖南省/常德市/桃源县\0"
+    "湖南/常德/桃源\0"
+    "Taoyuan\0"
+    "湖南省/常德市/石门县\0"
+    "湖南/常德/石门\0"
+    "Shimen\0"
+    "湖南省/常德市/津市市\0"
+    "湖南/常德/津市\0"
+    "Jinshi\0"
+    "湖南省/张家界市\0"
+    "湖南/张家界/张家界\0"
+    "Zhangjiajie\0"
+    "湖南省/张家界市/永定区\0"
+    "湖南/张家界/永定\0"
+    "湖南省/张家界市/武陵源区\0"
+    "湖南/张家界/武陵源\0"
+    "Wulingyuan\0"
+    "湖南省/张家界市/慈利县\0"
+    "湖南/张家界/慈利\0"
+    "Cili\0"
+    "湖南省/张家界市/桑植县\0"
+    "湖南/张家界/桑植\0"
+    "Sangzhi\0"
+    "湖南省/益阳市\0"
+    "湖南/益阳/益阳\0"
+    "湖南省/益阳市/资阳区\0"
+    "湖南/益阳/资阳\0"
+    "Ziyang\0"
+    "湖南省/益阳市/赫山区\0"
+    "湖南/益阳/赫山区\0"
+    "Heshanqu\0"
+    "湖南省/益阳市/南县\0"
+    "湖南/益阳/南县\0"
+    "Nanxian\0"
+    "湖南省/益阳市/桃江县\0"
+    "湖南/益阳/桃江\0"
+    "Taojiang\0"
+    "湖南省/益阳市/安化县\0"
+    "湖南/益阳/安化\0"
+    "Anhua\0"
+    "湖南省/益阳市/沅江市\0"
+    "湖南/益阳/沅江\0"
+    "Yuanjiang\0"
+    "湖南省/郴州市\0"
+    "湖南/郴州/郴州\0"
+    "Chenzhou\0"
+    "湖南省/郴州市/北湖区\0"
+    "湖南/郴州/北湖\0"
+    "Beihu\0"
+    "湖南省/郴州市/苏仙区\0"
+    "湖南/郴州/苏仙\0"
+    "Suxian\0"
+    "湖南省/郴州市/桂阳县\0"
+    "湖南/郴州/桂阳\0"
+    "Guiyang\0"
+    "湖南省/郴州市/宜章县\0"
+    "湖南/郴州/宜章\0"
+    "Yizhang\0"
+    "湖南省/郴州市/永兴县\0"
+    "湖南/郴州/永兴\0"
+    "Yongxing\0"
+    "湖南省/郴州市/嘉禾县\0"
+    "湖南/郴州/嘉禾\0"
+    "Jiahe\0"
+    "湖南省/郴州市/临武县\0"
+    "湖南/郴州/临武\0"
+    "Linwu\0"
+    "湖南省/郴州市/汝城县\0"
+    "湖南/郴州/汝城\0"
+    "Rucheng\0"
+    "湖南省/郴州市/桂东县\0"
+    "湖南/郴州/桂东\0"
+    "Guidong\0"
+    "湖南省/郴州市/安仁县\0"
+    "湖南/郴州/安仁\0"
+    "Anren\0"
+    "湖南省/郴州市/资兴市\0"
+    "湖南/郴州/资兴\0"
+    "Zixing\0"
+    "湖南省/永州市\0"
+    "湖南/永州/永州\0"
+    "Yongzhou\0"
+    "湖南省/永州市/零陵区\0"
+    "湖南/永州/零陵\0"
+    "Lingling\0"
+    "湖南省/永州市/冷水滩区\0"
+    "湖南/永州/冷水滩\0"
+    "Lengshuitan\0"
+    "湖南省/永州市/祁阳县\0"
+    "湖南/永州/祁阳\0"
+    "Qiyang\0"
+    "湖南省/永州市/东安县\0"
+    "湖南/永州/东安\0"
+    "湖南省/永州市/双牌县\0"
+    "湖南/永州/双牌\0"
+    "Shuangpai\0"
+    "湖南省/永州市/道县\0"
+    "湖南/永州/道县\0"
+    "Daoxian\0"
+    "湖南省/永州市/江永县\0"
+    "湖南/永州/江永\0"
+    "Jiangyong\0"
+    "湖南省/永州市/宁远县\0"
+    "湖南/永州/宁远\0"
+    "Ningyuan\0"
+    "湖南省/永州市/蓝山县\0"
+    "湖南/永州/蓝山\0"
+    "湖南省/永州市/新田县\0"
+    "湖南/永州/新田\0"
+    "Xintian\0"
+    "湖南省/永州市/江华瑶族自治县\0"
+    "湖南/永州/江华\0"
+    "Jianghua\0"
+    "湖南省/怀化市\0"
+    "湖南/怀化/怀化\0"
+    "Huaihua\0"
+    "湖南省/怀化市/鹤城区\0"
+    "湖南/怀化/鹤城\0"
+    "Hecheng\0"
+    "湖南省/怀化市/中方县\0"
+    "湖南/怀化/中方\0"
+    "Zhongfang\0"
+    "湖南省/怀化市/沅陵县\0"
+    "湖南/怀化/沅陵\0"
+    "Yuanling\0"
+    "湖南省/怀化市/辰溪县\0"
+    "湖南/怀化/辰溪\0"
+    "Chenxi\0"
+    "湖南省/怀化市/溆浦县\0"
+    "湖南/怀化/溆浦\0"
+    "Xupu\0"
+    "湖南省/怀化市/会同县\0"
+    "湖南/怀化/会同\0"
+    "Huitong\0"
+    "湖南省/怀化市/麻阳苗族自治县\0"
+    "湖南/怀化/麻阳\0"
+    "Mayang\0"
+    "湖南省/怀化市/新晃侗族自治县\0"
+    "湖南/怀化/新晃\0"
+    "Xinhuang\0"
+    "湖南省/怀化市/芷江侗族自治县\0"
+    "湖南/怀化/芷江\0"
+    "湖南省/怀化市/靖州苗族侗族自治县\0"
+    "湖南/怀化/靖州\0"
+    "湖南省/怀化市/通道侗族自治县\0"
+    "湖南/怀化/通道\0"
+    "Tongdao\0"
+    "湖南省/怀化市/洪江市\0"
+    "湖南/怀化/洪江\0"
+    "Hongjiang\0"
+    "湖南省/娄底市\0"
+    "湖南/娄底/娄底\0"
+    "Loudi\0"
+    "湖南省/娄底市/娄星区\0"
+    "湖南/娄底/娄星\0"
+    "Louxing\0"
+    "湖南省/娄底市/双峰县\0"
+    "湖南/娄底/双峰\0"
+    "Shuangfeng\0"
+    "湖南省/娄底市/新化县\0"
+    "湖南/娄底/新化\0"
+    "湖南省/娄底市/冷水江市\0"
+    "湖南/娄底/冷水江\0"
+    "Lengshuijiang\0"
+    "湖南省/娄底市/涟源市\0"
+    "湖南/娄底/涟源\0"
+    "Lianyuan\0"
+    "湖南省/湘西土家族苗族自治州\0"
+    "湖南/湖南/湘西\0"
+    "Xiangxi\0"
+    "湖南省/湘西土家族苗族自治州/吉首市\0"
+    "湖南/湘西/吉首\0"
+    "Jishou\0"
+    "湖南省/湘西土家族苗族自治州/泸溪县\0"
+    "湖南/湘西/泸溪\0"
+    "湖南省/湘西土家族苗族自治州/凤凰县\0"
+    "湖南/湘西/凤凰\0"
+    "Fenghuang\0"
+    "湖南省/湘西土家族苗族自治州/花垣县\0"
+    "湖南/湘西/花垣\0"
+    "Huayuan\0"
+    "湖南省/湘西土家族苗族自治州/保靖县\0"
+    "湖南/湘西/保靖\0"
+    "Baojing\0"
+    "湖南省/湘西土家族苗族自治州/古丈县\0"
+    "湖南/湘西/古丈\0"
+    "Guzhang\0"
+    "湖南省/湘西土家族苗族自治州/永顺县\0"
+    "湖南/湘西/永顺\0"
+    "Yongshun\0"
+    "湖南省/湘西土家族苗族自治州/龙山县\0"
+    "湖南/湘西/龙山\0"
+    "广东省/广州市\0"
+    "广东/广州/广州\0"
+    "Guangzhou\0"
+    "广东省/广州市/荔湾区\0"
+    "广东/广州/荔湾\0"
+    "Liwan\0"
+    "广东省/广州市/越秀区\0"
+    "广东/广州/越秀\0"
+    "Yuexiu\0"
+    "广东省/广州市/海珠区\0"
+    "广东/广州/海珠\0"
+    "Haizhu\0"
+    "广东省/广州市/天河区\0"
+    "广东/广州/天河\0"
+    "Tianhe\0"
+    "广东省/广州市/白云区\0"
+    "广东/广州/白云\0"
+    "Baiyun\0"
+    "广东省/广州市/黄埔区\0"
+    "广东/广州/黄埔\0"
+    "广东省/广州市/番禺区\0"
+    "广东/广州/番禺\0"
+    "Panyu\0"
+    "广东省/广州市/花都区\0"
+    "广东/广州/花都\0"
+    "Huadu\0"
+    "广东省/广州市/南沙区\0"
+    "广东/广州/南沙\0"
+    "Nansha\0"
+    "广东省/广州市/从化区\0"
+    "广东/广州/从化\0"
+    "Conghua\0"
+    "广东省/广州市/增城区\0"
+    "广东/广州/增城\0"
+    "Zengcheng\0"
+    "广东省/韶关市\0"
+    "广东/韶关/韶关\0"
+    "Shaoguan\0"
+    "广东省/韶关市/武江区\0"
+    "广东/韶关/武江\0"
+    "广东省/韶关市/浈江区\0"
+    "广东/韶关/浈江\0"
+    "广东省/韶关市/曲江区\0"
+    "广东/韶关/曲江\0"
+    "广东省/韶关市/始兴县\0"
+    "广东/韶关/始兴\0"
+    "Shixing\0"
+    "广东省/韶关市/仁化县\0"
+    "广东/韶关/仁化\0"
+    "Renhua\0"
+    "广东省/韶关市/翁源县\0"
+    "广东/韶关/翁源\0"
+    "Wengyuan\0"
+    "广东省/韶关市/乳源瑶族自治县\0"
+    "广东/韶关/乳源\0"
+    "Ruyuan\0"
+    "广东省/韶关市/新丰县\0"
+    "广东/韶关/新丰\0"
+    "广东省/韶关市/乐昌市\0"
+    "广东/韶关/乐昌\0"
+    "Lechang\0"
+    "广东省/韶关市/南雄市\0"
+    "广东/韶关/南雄\0"
+    "Nanxiong\0"
+    "广东省/深圳市\0"
+    "广东/深圳/深圳\0"
+    "Shenzhen\0"
+    "广东省/深圳市/罗湖区\0"
+    "广东/深圳/罗湖\0"
+    "Luohu\0"
+    "广东省/深圳市/福田区\0"
+    "广东/深圳/福田\0"
+    "Futian\0"
+    "广东省/深圳市/南山区\0"
+    "广东/深圳/南山\0"
+    "广东省/深圳市/宝安区\0"
+    "广东/深圳/宝安\0"
+    "Baoan\0"
+    "广东省/深圳市/龙岗区\0"
+    "广东/深圳/龙岗\0"
+    "广东省/深圳市/盐田区\0"
+    "广东/深圳/盐田\0"
+    "Yantian\0"
+    "广东省/深圳市/龙华区\0"
+    "广东/深圳/龙华\0"
+    "广东省/深圳市/坪山区\0"
+    "广东/深圳/坪山\0"
+    "广东省/深圳市/光明区\0"
+    "广东/深圳/光明\0"
+    "Guangming\0"
+    "广东省/珠海市\0"
+    "广东/珠海/珠海\0"
+    "Zhuhai\0"
+    "广东省/珠海市/香洲区\0"
+    "广东/珠海/香洲\0"
+    "广东省/珠海市/斗门区\0"
+    "广东/珠海/斗门\0"
+    "Doumen\0"
+    "广东省/珠海市/金湾区\0"
+    "广东/珠海/金湾\0"
+    "Jinwan\0"
+    "广东省/汕头市\0"
+    "广东/汕头/汕头\0"
+    "Shantou\0"
+    "广东省/汕头市/龙湖区\0"
+    "广东/汕头/龙湖\0"
+    "Longhu\0"
+    "广东省/汕头市/金平区\0"
+    "广东/汕头/金平\0"
+    "Jinping\0"
+    "广东省/汕头市/濠江区\0"
+    "广东/汕头/濠江\0"
+    "Haojiang\0"
+    "广东省/汕头市/潮阳区\0"
+    "广东/汕头/潮阳\0"
+    "广东省/汕头市/潮南区\0"
+    "广东/汕头/潮南\0"
+    "Chaonan\0"
+    "广东省/汕头市/澄海区\0"
+    "广东/汕头/澄海\0"
+    "Chenghai\0"
+    "广东省/汕头市/南澳县\0"
+    "广东/汕头/南澳\0"
+    "Nanao\0"
+    "广东省/佛山市\0"
+    "广东/佛山/佛山\0"
+    "Foshan\0"
+    "广东省/佛山市/禅城区\0"
+    "广东/佛山/禅城\0"
+    "Chancheng\0"
+    "广东省/佛山市/南海区\0"
+    "广东/佛山/南海\0"
+    "Nanhai\0"
+    "广东省/佛山市/顺德区\0"
+    "广东/佛山/顺德\0"
+    "Shunde\0"
+    "广东省/佛山市/三水区\0"
+    "广东/佛山/三水\0"
+    "Sanshui\0"
+    "广东省/佛山市/高明区\0"
+    "广东/佛山/高明\0"
+    "Gaoming\0"
+    "广东省/江门市\0"
+    "广东/江门/江门\0"
+    "Jiangmen\0"
+    "广东省/江门市/蓬江区\0"
+    "广东/江门/蓬江\0"
+    "Pengjiang\0"
+    "广东省/江门市/江海区\0"
+    "广东/江门/江海\0"
+    "Jianghai\0"
+    "广东省/江门市/新会区\0"
+    "广东/江门/新会\0"
+    "Xinhui\0"
+    "广东省/江门市/台山市\0"
+    "广东/江门/台山\0"
+    "广东省/江门市/开平市\0"
+    "广东/江门/开平\0"
+    "广东省/江门市/鹤山市\0"
+    "广东/江门/鹤山\0"
+    "广东省/江门市/恩平市\0"
+    "广东/江门/恩平\0"
+    "Enping\0"
+    "广东省/湛江市\0"
+    "广东/湛江/湛江\0"
+    "Zhanjiang\0"
+    "广东省/湛江市/赤坎区\0"
+    "广东/湛江/赤坎\0"
+    "Chikan\0"
+    "广东省/湛江市/霞山区\0"
+    "广东/湛江/霞山\0"
+    "Xiashan\0"
+    "广东省/湛江市/坡头区\0"
+    "广东/湛江/坡头\0"
+    "Potou\0"
+    "广东省/湛江市/麻章区\0"
+    "广东/湛江/麻章\0"
+    "Mazhang\0"
+    "广东省/湛江市/遂溪县\0"
+    "广东/湛江/遂溪\0"
+    "广东省/湛江市/徐闻县\0"
+    "广东/湛江/徐闻\0"
+    "Xuwen\0"
+    "广东省/湛江市/廉江市\0"
+    "广东/湛江/廉江\0"
+    "广东省/湛江市/雷州市\0"
+    "广东/湛江/雷州\0"
+    "Leizhou\0"
+    "广东省/湛江市/吴川市\0"
+    "广东/湛江/吴川\0"
+    "广东省/茂名市\0"
+    "广东/茂名/茂名\0"
+    "Maoming\0"
+    "广东省/茂名市/茂南区\0"
+    "广东/茂名/茂南\0"
+    "Maonan\0"
+    "广东省/茂名市/电白区\0"
+    "广东/茂名/电白\0"
+    "Dianbai\0"
+    "广东省/茂名市/高州市\0"
+    "广东/茂名/高州\0"
+    "Gaozhou\0"
+    "广东省/茂名市/化州市\0"
+    "广东/茂名/化州\0"
+    "Huazhou\0"
+    "广东省/茂名市/信宜市\0"
+    "广东/茂名/信宜\0"
+    "广东省/肇庆市\0"
+    "广东/肇庆/肇庆\0"
+    "Zhaoqing\0"
+    "广东省/肇庆市/端州区\0"
+    "广东/肇庆/端州\0"
+    "Duanzhou\0"
+    "广东省/肇庆市/鼎湖区\0"
+    "广东/肇庆/鼎湖\0"
+    "Dinghu\0"
+    "广东省/肇庆市/高要区\0"
+    "广东/肇庆/高要\0"
+    "Gaoyao\0"
+    "广东省/肇庆市/广宁县\0"
+    "广东/肇庆/广宁\0"
+    "Guangning\0"
+    "广东省/肇庆市/怀集县\0"
+    "广东/肇庆/怀集\0"
+    "Huaiji\0"
+    "广东省/肇庆市/封开县\0"
+    "广东/肇庆/封开\0"
+    "Fengkai\0"
+    "广东省/肇庆市/德庆县\0"
+    "广东/肇庆/德庆\0"
+    "广东省/肇庆市/四会市\0"
+    "广东/肇庆/四会\0"
+    "Sihui\0"
+    "广东省/惠州市\0"
+    "广东/惠州/惠州\0"
+    "广东省/惠州市/惠城区\0"
+    "广东/惠州/惠城\0"
+    "Huicheng\0"
+    "广东省/惠州市/惠阳区\0"
+    "广东/惠州/惠阳\0"
+    "Huiyang\0"
+    "广东省/惠州市/博罗县\0"
+    "广东/惠州/博罗\0"
+    "Boluo\0"
+    "广东省/惠州市/惠东县\0"
+    "广东/惠州/惠东\0"
+    "Huidong\0"
+    "广东省/惠州市/龙门县\0"
+    "广东/惠州/龙门\0"
+    "Longmen\0"
+    "广东省/梅州市\0"
+    "广东/梅州/梅州\0"
+    "Meizhou\0"
+    "广东省/梅州市/梅江区\0"
+    "广东/梅州/梅江\0"
+    "Meijiang\0"
+    "广东省/梅州市/梅县区\0"
+    "广东/梅州/梅县\0"
+    "Meixian\0"
+    "广东省/梅州市/大埔县\0"
+    "广东/梅州/大埔\0"
+    "Dabu\0"
+    "广东省/梅州市/丰顺县\0"
+    "广东/梅州/丰顺\0"
+    "Fengshun\0"
+    "广东省/梅州市/五华县\0"
+    "广东/梅州/五华\0"
+    "Wuhua\0"
+    "广东省/梅州市/平远县\0"
+    "广东/梅州/平远\0"
+    "广东省/梅州市/蕉岭县\0"
+    "广东/梅州/蕉岭\0"
+    "Jiaoling\0"
+    "广东省/梅州市/兴宁市\0"
+    "广东/梅州/兴宁\0"
+    "Xingning\0"
+    "广东省/汕尾市\0"
+    "广东/汕尾\0"
+    "Shanwei\0"
+    "广东省/汕尾市/海丰县\0"
+    "广东/汕尾/海丰\0"
+    "Haifeng\0"
+    "广东省/汕尾市/陆河县\0"
+    "广东/汕尾/陆河\0"
+    "广东省/汕尾市/陆丰市\0"
+    "广东/汕尾/陆丰\0"
+    "Lufeng\0"
+    "广东省/河源市\0"
+    "广东/河源/河源\0"
+    "Heyuan\0"
+    "广东省/河源市/源城区\0"
+    "广东/河源/源城\0"
+    "Yuancheng\0"
+    "广东省/河源市/紫金县\0"
+    "广东/河源/紫金\0"
+    "Zijin\0"
+    "广东省/河源市/龙川县\0"
+    "广东/河源/龙川\0"
+    "Longchuan\0"
+    "广东省/河源市/连平县\0"
+    "广东/河源/连平\0"
+    "Lianping\0"
+    "广东省/河源市/和平县\0"
+    "广东/河源/和平\0"
+    "广东省/河源市/东源县\0"
+    "广东/河源/东源\0"
+    "Dongyuan\0"
+    "广东省/阳江市\0"
+    "广东/阳江/阳江\0"
+    "Yangjiang\0"
+    "广东省/阳江市/江城区\0"
+    "广东/阳江/江城\0"
+    "Jiangcheng\0"
+    "广东省/阳江市/阳东区\0"
+    "广东/阳江/阳东\0"
+    "Yangdong\0"
+    "广东省/阳江市/阳西县\0"
+    "广东/阳江/阳西\0"
+    "Yangxi\0"
+    "广东省/阳江市/阳春市\0"
+    "广东/阳江/阳春\0"
+    "Yangchun\0"
+    "广东省/清远市\0"
+    "广东/清远/清远\0"
+    "广东省/清远市/清城区\0"
+    "广东/清远/清城\0"
+    "Qingcheng\0"
+    "广东省/清远市/清新区\0"
+    "广东/清远/清新\0"
+    "Qingxin\0"
+    "广东省/清远市/佛冈县\0"
+    "广东/清远/佛冈\0"
+    "Fogang\0"
+    "广东省/清远市/阳山县\0"
+    "广东/清远/阳山\0"
+    "Yangshan\0"
+    "广东省/清远市/连山壮族瑶族自治县\0"
+    "广东/清远/连山\0"
+    "广东省/清远市/连南瑶族自治县\0"
+    "广东/清远/连南\0"
+    "Liannan\0"
+    "广东省/清远市/英德市\0"
+    "广东/清远/英德\0"
+    "Yingde\0"
+    "广东省/清远市/连州市\0"
+    "广东/清远/连州\0"
+    "Lianzhou\0"
+    "广东省/东莞市\0"
+    "广东/东莞/东莞\0"
+    "Dongguan\0"
+    "广东省/中山市\0"
+    "广东/中山/中山\0"
+    "广东省/东沙群岛\0"
+    "广东/东沙/东沙\0"
+    "Dongsha\0"
+    "广东省/潮州市\0"
+    "广东/潮州/潮州\0"
+    "Chaozhou\0"
+    "广东省/潮州市/湘桥区\0"
+    "广东/潮州/湘桥\0"
+    "Xiangqiao\0"
+    "广东省/潮州市/潮安区\0"
+    "广东/潮州/潮安\0"
+    "Chaoan\0"
+    "广东省/潮州市/饶平县\0"
+    "广东/潮州/饶平\0"
+    "Raoping\0"
+    "广东省/揭阳市\0"
+    "广东/揭阳/揭阳\0"
+    "Jieyang\0"
+    "广东省/揭阳市/榕城区\0"
+    "广东/揭阳/榕城\0"
+    "广东省/揭阳市/揭东区\0"
+    "广东/揭阳/揭东\0"
+    "Jiedong\0"
+    "广东省/揭阳市/揭西县\0"
+    "广东/揭阳/揭西\0"
+    "Jiexi\0"
+    "广东省/揭阳市/惠来县\0"
+    "广东/揭阳/惠来\0"
+    "Huilai\0"
+    "广东省/揭阳市/普宁市\0"
+    "广东/揭阳/普宁\0"
+    "Puning\0"
+    "广东省/云浮市\0"
+    "广东/云浮/云浮\0"
+    "Yunfu\0"
+    "广东省/云浮市/云城区\0"
+    "广东/云浮/云城\0"
+    "广东省/云浮市/云安区\0"
+    "广东/云浮/云安\0"
+    "Yunan\0"
+    "广东省/云浮市/新兴县\0"
+    "广东/云浮/新兴\0"
+    "广东省/云浮市/郁南县\0"
+    "广东/云浮/郁南\0"
+    "广东省/云浮市/罗定市\0"
+    "广东/云浮/罗定\0"
+    "Luoding\0"
+    "广西壮族自治区/南宁市\0"
+    "广西/南宁/南宁\0"
+    "Nanning\0"
+    "广西壮族自治区/南宁市/兴宁区\0"
+    "广西/南宁/兴宁\0"
+    "广西壮族自治区/南宁市/青秀区\0"
+    "广西/南宁/青秀\0"
+    "Qingxiu\0"
+    "广西壮族自治区/南宁市/江南区\0"
+    "广西/南宁/江南\0"
+    "Jiangnan\0"
+    "广西壮族自治区/南宁市/西乡塘区\0"
+    "广西/南宁/西乡塘\0"
+    "Xixiangtang\0"
+    "广西壮族自治区/南宁市/良庆区\0"
+    "广西/南宁/良庆\0"
+    "Liangqing\0"
+    "广西壮族自治区/南宁市/邕宁区\0"
+    "广西/南宁/邕宁\0"
+    "Yongning\0"
+    "广西壮族自治区/南宁市/武鸣区\0"
+    "广西/南宁/武鸣\0"
+    "Wuming\0"
+    "广西壮族自治区/南宁市/隆安县\0"
+    "广西/南宁/隆安\0"
+    "广西壮族自治区/南宁市/马山县\0"
+    "广西/南宁/马山\0"
+    "广西壮族自治区/南宁市/上林县\0"
+    "广西/南宁/上林\0"
+    "Shanglin\0"
+    "广西壮族自治区/南宁市/宾阳县\0"
+    "广西/南宁/宾阳\0"
+    "Binyang\0"
+    "广西壮族自治区/南宁市/横县\0"
+    "广西/南宁/横县\0"
+    "Hengxian\0"
+    "广西壮族自治区/柳州市\0"
+    "广西/柳州/柳州\0"
+    "Liuzhou\0"
+    "广西壮族自治区/柳州市/城中区\0"
+    "广西/柳州/城中\0"
+    "Chengzhong\0"
+    "广西壮族自治区/柳州市/鱼峰区\0"
+    "广西/柳州/鱼峰\0"
+    "Yufeng\0"
+    "广西壮族自治区/柳州市/柳南区\0"
+    "广西/柳州/柳南\0"
+    "Liunan\0"
+    "广西壮族自治区/柳州市/柳北区\0"
+    "广西/柳州/柳北\0"
+    "Liubei\0"
+    "广西壮族自治区/柳州市/柳江区\0"
+    "广西/柳州/柳江\0"
+    "Liujiang\0"
+    "广西壮族自治区/柳州市/柳城县\0"
+    "广西/柳州/柳城\0"
+    "Liucheng\0"
+    "广西壮族自治区/柳州市/鹿寨县\0"
+    "广西/柳州/鹿寨\0"
+    "Luzhai\0"
+    "广西壮族自治区/柳州市/融安县\0"
+    "广西/柳州/融安\0"
+    "Rongan\0"
+    "广西壮族自治区/柳州市/融水苗族自治县\0"
+    "广西/柳州/融水\0"
+    "Rongshui\0"
+    "广西壮族自治区/柳州市/三江侗族自治县\0"
+    "广西/柳州/三江\0"
+    "Sanjiang\0"
+    "广西壮族自治区/桂林市\0"
+    "广西/桂林/桂林\0"
+    "Guilin\0"
+    "广西壮族自治区/桂林市/秀峰区\0"
+    "广西/桂林/秀峰\0"
+    "Xiufeng\0"
+    "广西壮族自治区/桂林市/叠彩区\0"
+    "广西/桂林/叠彩\0"
+    "Diecai\0"
+    "广西壮族自治区/桂林市/象山区\0"
+    "广西/桂林/象山\0"
+    "广西壮族自治区/桂林市/七星区\0"
+    "广西/桂林/七星\0"
+    "Qixing\0"
+    "广西壮族自治区/桂林市/雁山区\0"
+    "广西/桂林/雁山\0"
+    "广西壮族自治区/桂林市/临桂区\0"
+    "广西/桂林/临桂\0"
+    "Lingui\0"
+    "广西壮族自治区/桂林市/阳朔县\0"
+    "广西/桂林/阳朔\0"
+    "Yangshuo\0"
+    "广西壮族自治区/桂林市/灵川县\0"
+    "广西/桂林/灵川\0"
+    "广西壮族自治区/桂林市/全州县\0"
+    "广西/桂林/全州\0"
+    "广西壮族自治区/桂林市/兴安县\0"
+    "广西/桂林/兴安\0"
+    "广西壮族自治区/桂林市/永福县\0"
+    "广西/桂林/永福\0"
+    "Yongfu\0"
+    "广西壮族自治区/桂林市/灌阳县\0"
+    "广西/桂林/灌阳\0"
+    "Guanyang\0"
+    "广西壮族自治区/桂林市/龙胜各族自治县\0"
+    "广西/桂林/龙胜\0"
+    "Longsheng\0"
+    "广西壮族自治区/桂林市/资源县\0"
+    "广西/桂林/资源\0"
+    "Ziyuan\0"
+    "广西壮族自治区/桂林市/平乐县\0"
+    "广西/桂林/平乐\0"
+    "Pingle\0"
+    "广西壮族自治区/桂林市/恭城瑶族自治县\0"
+    "广西/桂林/恭城\0"
+    "Gongcheng\0"
+    "广西壮族自治区/桂林市/荔浦市\0"
+    "广西/桂林/荔浦\0"
+    "Lipu\0"
+    "广西壮族自治区/梧州市\0"
+    "广西/梧州/梧州\0"
+    "Wuzhou\0"
+    "广西壮族自治区/梧州市/万秀区\0"
+    "广西/梧州/万秀\0"
+    "Wanxiu\0"
+    "广西壮族自治区/梧州市/长洲区\0"
+    "广西/梧州/长洲\0"
+    "广西壮族自治区/梧州市/龙圩区\0"
+    "广西/梧州/龙圩\0"
+    "Longwei\0"
+    "广西壮族自治区/梧州市/苍梧县\0"
+    "广西/梧州/苍梧\0"
+    "Cangwu\0"
+    "广西壮族自治区/梧州市/藤县\0"
+    "广西/梧州/藤县\0"
+    "Tengxian\0"
+    "广西壮族自治区/梧州市/蒙山县\0"
+    "广西/梧州/蒙山\0"
+    "Mengshan\0"
+    "广西壮族自治区/梧州市/岑溪市\0"
+    "广西/梧州/岑溪\0"
+    "Cenxi\0"
+    "广西壮族自治区/北海市\0"
+    "广西/北海/北海\0"
+    "Beihai\0"
+    "广西壮族自治区/北海市/海城区\0"
+    "广西/北海/海城\0"
+    "广西壮族自治区/北海市/银海区\0"
+    "广西/北海/银海\0"
+    "Yinhai\0"
+    "广西壮族自治区/北海市/铁山港区\0"
+    "广西/北海/铁山港\0"
+    "Tieshangang\0"
+    "广西壮族自治区/北海市/合浦县\0"
+    "广西/北海/合浦\0"
+    "Hepu\0"
+    "广西壮族自治区/防城港市\0"
+    "广西/防城港/防城港\0"
+    "Fangchenggang\0"
+    "广西壮族自治区/防城港市/港口区\0"
+    "广西/防城港/港口\0"
+    "Gangkou\0"
+    "广西壮族自治区/防城港市/防城区\0"
+    "广西/防城港/防城\0"
+    "广西壮族自治区/防城港市/上思县\0"
+    "广西/防城港/上思\0"
+    "Shangsi\0"
+    "广西壮族自治区/防城港市/东兴市\0"
+    "广西/防城港/东兴\0"
+    "Dongxing\0"
+    "广西壮族自治区/钦州市\0"
+    "广西/钦州/钦州\0"
+    "Qinzhou\0"
+    "广西壮族自治区/钦州市/钦南区\0"
+    "广西/钦州/钦南\0"
+    "Qinnan\0"
+    "广西壮族自治区/钦州市/钦北区\0"
+    "广西/钦州/钦北\0"
+    "Qinbei\0"
+    "广西壮族自治区/钦州市/灵山县\0"
+    "广西/钦州/灵山\0"
+    "Lingshan\0"
+    "广西壮族自治区/钦州市/浦北县\0"
+    "广西/钦州/浦北\0"
+    "Pubei\0"
+    "广西壮族自治区/贵港市\0"
+    "广西/贵港/贵港\0"
+    "Guigang\0"
+    "广西壮族自治区/贵港市/港北区\0"
+    "广西/贵港/港北\0"
+    "Gangbei\0"
+    "广西壮族自治区/贵港市/港南区\0"
+    "广西/贵港/港南\0"
+    "Gangnan\0"
+    "广西壮族自治区/贵港市/覃塘区\0"
+    "广西/贵港/覃塘\0"
+    "Tantang\0"
+    "广西壮族自治区/贵港市/平南县\0"
+    "广西/贵港/平南\0"
+    "广西壮族自治区/贵港市/桂平市\0"
+    "广西/贵港/桂平\0"
+    "Guiping\0"
+    "广西壮族自治区/玉林市\0"
+    "广西/玉林/玉林\0"
+    "Yulin\0"
+    "广西壮族自治区/玉林市/玉州区\0"
+    "广西/玉林/玉州\0"
+    "广西壮族自治区/玉林市/福绵区\0"
+    "广西/玉林/福绵\0"
+    "Fumian\0"
+    "广西壮族自治区/玉林市/容县\0"
+    "广西/玉林/容县\0"
+    "Rongxian\0"
+    "广西壮族自治区/玉林市/陆川县\0"
+    "广西/玉林/陆川\0"
+    "Luchuan\0"
+    "广西壮族自治区/玉林市/博白县\0"
+    "广西/玉林/博白\0"
+    "Bobai\0"
+    "广西壮族自治区/玉林市/兴业县\0"
+    "广西/玉林/兴业\0"
+    "Xingye\0"
+    "广西壮族自治区/玉林市/北流市\0"
+    "广西/玉林/北流\0"
+    "Beiliu\0"
+    "广西壮族自治区/百色市\0"
+    "广西/百色/百色\0"
+    "Baise\0"
+    "广西壮族自治区/百色市/右江区\0"
+    "广西/百色/右江\0"
+    "Youjiang\0"
+    "广西壮族自治区/百色市/田阳县\0"
+    "广西/百色/田阳\0"
+    "Tianyang\0"
+    "广西壮族自治区/百色市/田东县\0"
+    "广西/百色/田东\0"
+    "Tiandong\0"
+    "广西壮族自治区/百色市/平果县\0"
+    "广西/百色/平果\0"
+    "Pingguo\0"
+    "广西壮族自治区/百色市/德保县\0"
+    "广西/百色/德保\0"
+    "Debao\0"
+    "广西壮族自治区/百色市/那坡县\0"
+    "广西/百色/那坡\0"
+    "Napo\0"
+    "广西壮族自治区/百色市/凌云县\0"
+    "广西/百色/凌云\0"
+    "Lingyun\0"
+    "广西壮族自治区/百色市/乐业县\0"
+    "广西/百色/乐业\0"
+    "Leye\0"
+    "广西壮族自治区/百色市/田林县\0"
+    "广西/百色/田林\0"
+    "Tianlin\0"
+    "广西壮族自治区/百色市/西林县\0"
+    "广西/百色/西林\0"
+    "广西壮族自治区/百色市/隆林各族自治县\0"
+    "广西/百色/隆林\0"
+    "Longlin\0"
+    "广西壮族自治区/百色市/靖西市\0"
+    "广西/百色/靖西\0"
+    "Jingxi\0"
+    "广西壮族自治区/贺州市\0"
+    "广西/贺州/贺州\0"
+    "Hezhou\0"
+    "广西壮族自治区/贺州市/八步区\0"
+    "广西/贺州/八步\0"
+    "Babu\0"
+    "广西壮族自治区/贺州市/平桂区\0"
+    "广西/贺州/平桂\0"
+    "Pinggui\0"
+    "广西壮族自治区/贺州市/昭平县\0"
+    "广西/贺州/昭平\0"
+    "Zhaoping\0"
+    "广西壮族自治区/贺州市/钟山县\0"
+    "广西/贺州/钟山\0"
+    "广西壮族自治区/贺州市/富川瑶族自治县\0"
+    "广西/贺州/富川\0"
+    "Fuchuan\0"
+    "广西壮族自治区/河池市\0"
+    "广西/河池/河池\0"
+    "Hechi\0"
+    "广西壮族自治区/河池市/金城江区\0"
+    "广西/河池/金城江\0"
+    "Jinchengjiang\0"
+    "广西壮族自治区/河池市/宜州区\0"
+    "广西/河池/宜州\0"
+    "Yizhou\0"
+    "广西壮族自治区/河池市/南丹县\0"
+    "广西/河池/南丹\0"
+    "Nandan\0"
+    "广西壮族自治区/河池市/天峨县\0"
+    "广西/河池/天峨\0"
+    "Tiane\0"
+    "广西壮族自治区/河池市/凤山县\0"
+    "广西/河池/凤山\0"
+    "Fengshan\0"
+    "广西壮族自治区/河池市/东兰县\0"
+    "广西/河池/东兰\0"
+    "Donglan\0"
+    "广西壮族自治区/河池市/罗城仫佬族自治县\0"
+    "广西/河池/罗城\0"
+    "Luocheng\0"
+    "广西壮族自治区/河池市/环江毛南族自治县\0"
+    "广西/河池/环江\0"
+    "Huanjiang\0"
+    "广西壮族自治区/河池市/巴马瑶族自治县\0"
+    "广西/河池/巴马\0"
+    "Bama\0"
+    "广西壮族自治区/河池市/都安瑶族自治县\0"
+    "广西/河池/都安\0"
+    "Duan\0"
+    "广西壮族自治区/河池市/大化瑶族自治县\0"
+    "广西/河池/大化\0"
+    "Dahua\0"
+    "广西壮族自治区/来宾市\0"
+    "广西/来宾/来宾\0"
+    "Laibin\0"
+    "广西壮族自治区/来宾市/兴宾区\0"
+    "广西/来宾/兴宾\0"
+    "Xingbin\0"
+    "广西壮族自治区/来宾市/忻城县\0"
+    "广西/来宾/忻城\0"
+    "广西壮族自治区/来宾市/象州县\0"
+    "广西/来宾/象州\0"
+    "广西壮族自治区/来宾市/武宣县\0"
+    "广西/来宾/武宣\0"
+    "Wuxuan\0"
+    "广西壮族自治区/来宾市/金秀瑶族自治县\0"
+    "广西/来宾/金秀\0"
+    "Jinxiu\0"
+    "广西壮族自治区/来宾市/合山市\0"
+    "广西/来宾/合山\0"
+    "广西壮族自治区/崇左市\0"
+    "广西/崇左/崇左\0"
+    "Chongzuo\0"
+    "广西壮族自治区/崇左市/江州区\0"
+    "广西/崇左/江州\0"
+    "Jiangzhou\0"
+    "广西壮族自治区/崇左市/扶绥县\0"
+    "广西/崇左/扶绥\0"
+    "Fusui\0"
+    "广西壮族自治区/崇左市/宁明县\0"
+    "广西/崇左/宁明\0"
+    "Ningming\0"
+    "广西壮族自治区/崇左市/龙州县\0"
+    "广西/崇左/龙州\0"
+    "Longzhou\0"
+    "广西壮族自治区/崇左市/大新县\0"
+    "广西/崇左/大新\0"
+    "Daxin\0"
+    "广西壮族自治区/崇左市/天等县\0"
+    "广西/崇左/天等\0"
+    "Tiandeng\0"
+    "广西壮族自治区/崇左市/凭祥市\0"
+    "广西/崇左/凭祥\0"
+    "海南省/海口市\0"
+    "海南/海口/海口\0"
+    "Haikou\0"
+    "海南省/海口市/秀英区\0"
+    "海南/海口/秀英\0"
+    "Xiuying\0"
+    "海南省/海口市/龙华区\0"
+    "海南/海口/龙华\0"
+    "海南省/海口市/琼山区\0"
+    "海南/海口/琼山\0"
+    "Qiongshan\0"
+    "海南省/海口市/美兰区\0"
+    "海南/海口/美兰\0"
+    "Meilan\0"
+    "海南省/三亚市\0"
+    "海南/三亚/三亚\0"
+    "Sanya\0"
+    "海南省/三亚市/海棠区\0"
+    "海南/三亚/海棠\0"
+    "Haitang\0"
+    "海南省/三亚市/吉阳区\0"
+    "海南/三亚/吉阳\0"
+    "海南省/三亚市/天涯区\0"
+    "海南/三亚/天涯\0"
+    "Tianya\0"
+    "海南省/三亚市/崖州区\0"
+    "海南/三亚/崖州\0"
+    "Yazhou\0"
+    "海南省/三沙市\0"
+    "海南/三沙/三沙\0"
+    "Sansha\0"
+    "海南省/三沙市/西沙群岛\0"
+    "海南/三沙/西沙\0"
+    "Xisha\0"
+    "海南省/三沙市/南沙群岛\0"
+    "海南/三沙/南沙\0"
+    "海南省/三沙市/中沙群岛的岛礁及其海域\0"
+    "海南/三沙/中沙\0"
+    "Wuzhishan\0"
+    "海南省/儋州市\0"
+    "海南/儋州/儋州\0"
+    "Danzhou\0"
+    "海南省/五指山市\0"
+    "海南/五指山/五指山\0"
+    "海南省/琼海市\0"
+    "海南/琼海/琼海\0"
+    "Qionghai\0"
+    "海南省/文昌市\0"
+    "海南/文昌/文昌\0"
+    "Wenchang\0"
+    "海南省/万宁市\0"
+    "海南/万宁/万宁\0"
+    "Wanning\0"
+    "海南省/东方市\0"
+    "海南/东方/东方\0"
+    "Dongfang\0"
+    "海南省/定安县\0"
+    "海南/定安/定安\0"
+    "Dingan\0"
+    "海南省/屯昌县\0"
+    "海南/屯昌/屯昌\0"
+    "Tunchang\0"
+    "海南省/澄迈县\0"
+    "海南/澄迈/澄迈\0"
+    "Chengmai\0"
+    "海南省/临高县\0"
+    "海南/临高/临高\0"
+    "Lingao\0"
+    "海南省/白沙黎族自治县\0"
+    "海南/白沙/白沙\0"
+    "Baisha\0"
+    "海南省/昌江黎族自治县\0"
+    "海南/昌江/昌江\0"
+    "海南省/乐东黎族自治县\0"
+    "海南/乐东/乐东\0"
+    "Ledong\0"
+    "海南省/陵水黎族自治县\0"
+    "海南/陵水/陵水\0"
+    "Lingshui\0"
+    "海南省/保亭黎族苗族自治县\0"
+    "海南/保亭/保亭\0"
+    "Baoting\0"
+    "海南省/琼中黎族苗族自治县\0"
+    "海南/琼中/琼中\0"
+    "Qiongzhong\0"
+    "重庆市/万州区\0"
+    "重庆/万州\0"
+    "Wanzhou\0"
+    "重庆市/涪陵区\0"
+    "重庆/涪陵\0"
+    "Fuling\0"
+    "重庆市/渝中区\0"
+    "重庆/渝中\0"
+    "Yuzhong\0"
+    "重庆市/大渡口区\0"
+    "重庆/大渡口\0"
+    "Dadukou\0"
+    "重庆市/江北区\0"
+    "重庆/江北\0"
+    "重庆市/沙坪坝区\0"
+    "重庆/沙坪坝\0"
+    "Shapingba\0"
+    "重庆市/九龙坡区\0"
+    "重庆/九龙坡\0"
+    "Jiulongpo\0"
+    "重庆市/南岸区\0"
+    "重庆/南岸\0"
+    "重庆市/北碚区\0"
+    "重庆/北碚\0"
+    "Beibei\0"
+    "重庆市/綦江区\0"
+    "重庆/綦江\0"
+    "Qijiang\0"
+    "重庆市/大足区\0"
+    "重庆/大足\0"
+    "Dazu\0"
+    "重庆市/渝北区\0"
+    "重庆/渝北\0"
+    "Yubei\0"
+    "重庆市/巴南区\0"
+    "重庆/巴南\0"
+    "Banan\0"
+    "重庆市/黔江区\0"
+    "重庆/黔江\0"
+    "重庆市/长寿区\0"
+    "重庆/长寿\0"
+    "Changshou\0"
+    "重庆市/江津区\0"
+    "重庆/江津\0"
+    "Jiangjin\0"
+    "重庆市/合川区\0"
+    "重庆/合川\0"
+    "Hechuan\0"
+    "重庆市/永川区\0"
+    "重庆/永川\0"
+    "Yongchuan\0"
+    "重庆市/南川区\0"
+    "重庆/南川\0"
+    "Nanchuan\0"
+    "重庆市/璧山区\0"
+    "重庆/璧山\0"
+    "Bishan\0"
+    "重庆市/铜梁区\0"
+    "重庆/铜梁\0"
+    "Tongliang\0"
+    "重庆市/潼南区\0"
+    "重庆/潼南\0"
+    "Tongnan\0"
+    "重庆市/荣昌区\0"
+    "重庆/荣昌\0"
+    "Rongchang\0"
+    "重庆市/开州区\0"
+    "重庆/开州\0"
+    "Kaixian\0"
+    "重庆市/梁平区\0"
+    "重庆/梁平\0"
+    "Liangping\0"
+    "重庆市/武隆区\0"
+    "重庆/武隆\0"
+    "Wulong\0"
+    "重庆市\0"
+    "重庆/重庆\0"
+    "Chongqing\0"
+    "重庆市/城口县\0"
+    "重庆/城口\0"
+    "Chengkou\0"
+    "重庆市/丰都县\0"
+    "重庆/丰都\0"
+    "Fengdu\0"
+    "重庆市/垫江县\0"
+    "重庆/垫江\0"
+    "Dianjiang\0"
+    "重庆市/忠县\0"
+    "重庆/忠县\0"
+    "Zhongxian\0"
+    "重庆市/云阳县\0"
+    "重庆/云阳\0"
+    "Yunyang\0"
+    "重庆市/奉节县\0"
+    "重庆/奉节\0"
+    "Fengjie\0"
+    "重庆市/巫山县\0"
+    "重庆/巫山\0"
+    "Wushan\0"
+    "重庆市/巫溪县\0"
+    "重庆/巫溪\0"
+    "重庆市/石柱土家族自治县\0"
+    "重庆/石柱\0"
+    "Shizhu\0"
+    "重庆市/秀山土家族苗族自治县\0"
+    "重庆/秀山\0"
+    "Xiushan\0"
+    "重庆市/酉阳土家族苗族自治县\0"
+    "重庆/酉阳\0"
+    "Youyang\0"
+    "重庆市/彭水苗族土家族自治县\0"
+    "重庆/彭水\0"
+    "Pengshui\0"
+    "四川省/成都市\0"
+    "四川/成都/成都\0"
+    "Chengdu\0"
+    "四川省/成都市/锦江区\0"
+    "四川/成都/锦江\0"
+    "四川省/成都市/青羊区\0"
+    "四川/成都/青羊\0"
+    "四川省/成都市/金牛区\0"
+    "四川/成都/金牛\0"
+    "Jinniu\0"
+    "四川省/成都市/武侯区\0"
+    "四川/成都/武侯\0"
+    "Wuhou\0"
+    "四川省/成都市/成华区\0"
+    "四川/成都/成华\0"
+    "Chenghua\0"
+    "四川省/成都市/龙泉驿区\0"
+    "四川/成都/龙泉驿\0"
+    "Longquanyi\0"
+    "四川省/成都市/青白江区\0"
+    "四川/成都/青白江区\0"
+    "Qibaijiang\0"
+    "四川省/成都市/新都区\0"
+    "四川/成都/新都\0"
+    "Xindu\0"
+    "四川省/成都市/温江区\0"
+    "四川/成都/温江\0"
+    "Wenjiang\0"
+    "四川省/成都市/双流区\0"
+    "四川/成都/双流\0"
+    "Shuangliu\0"
+    "四川省/成都市/郫都区\0"
+    "四川/成都/郫都\0"
+    "Pixian\0"
+    "四川省/成都市/金堂县\0"
+    "四川/成都/金堂\0"
+    "Jintang\0"
+    "四川省/成都市/大邑县\0"
+    "四川/成都/大邑\0"
+    "Dayi\0"
+    "四川省/成都市/蒲江县\0"
+    "四川/成都/蒲江\0"
+    "四川省/成都市/新津县\0"
+    "四川/成都/新津\0"
+    "Xinjin\0"
+    "四川省/成都市/都江堰市\0"
+    "四川/成都/都江堰\0"
+    "Dujiangyan\0"
+    "四川省/成都市/彭州市\0"
+    "四川/成都/彭州\0"
+    "Pengzhou\0"
+    "四川省/成都市/邛崃市\0"
+    "四川/成都/邛崃\0"
+    "Qionglai\0"
+    "四川省/成都市/崇州市\0"
+    "四川/成都/崇州\0"
+    "Chongzhou\0"
+    "四川省/成都市/简阳市\0"
+    "四川/成都/简阳\0"
+    "四川省/自贡市\0"
+    "四川/自贡/自贡\0"
+    "Zigong\0"
+    "四川省/自贡市/自流井区\0"
+    "四川/自贡/自流井\0"
+    "Ziliujing\0"
+    "四川省/自贡市/贡井区\0"
+    "四川/自贡/贡井\0"
+    "Gongjing\0"
+    "四川省/自贡市/大安区\0"
+    "四川/自贡/大安\0"
+    "四川省/自贡市/沿滩区\0"
+    "四川/自贡/沿滩\0"
+    "Yantan\0"
+    "四川省/自贡市/荣县\0"
+    "四川/自贡/荣县\0"
+    "四川省/自贡市/富顺县\0"
+    "四川/自贡/富顺\0"
+    "四川省/攀枝花市\0"
+    "四川/攀枝花/攀枝花\0"
+    "Panzhihua\0"
+    "四川省/攀枝花市/东区\0"
+    "四川/攀枝花/东区\0"
+    "Dongqu\0"
+    "四川省/攀枝花市/西区\0"
+    "四川/攀枝花/西区\0"
+    "Xiqu\0"
+    "四川省/攀枝花市/仁和区\0"
+    "四川/攀枝花/仁和\0"
+    "Renhe\0"
+    "四川省/攀枝花市/米易县\0"
+    "四川/攀枝花/米易\0"
+    "Miyi\0"
+    "四川省/攀枝花市/盐边县\0"
+    "四川/攀枝花/盐边\0"
+    "四川省/泸州市\0"
+    "四川/泸州/泸州\0"
+    "四川省/泸州市/江阳区\0"
+    "四川/泸州/江阳\0"
+    "Jiangyang\0"
+    "四川省/泸州市/纳溪区\0"
+    "四川/泸州/纳溪\0"
+    "Naxi\0"
+    "四川省/泸州市/龙马潭区\0"
+    "四川/泸州/龙马潭\0"
+    "Longmatan\0"
+    "四川省/泸州市/泸县\0"
+    "四川/泸州/泸县\0"
+    "Luxian\0"
+    "四川省/泸州市/合江县\0"
+    "四川/泸州/合江\0"
+    "Hejiang\0"
+    "四川省/泸州市/叙永县\0"
+    "四川/泸州/叙永\0"
+    "Xuyong\0"
+    "四川省/泸州市/古蔺县\0"
+    "四川/泸州/古蔺\0"
+    "Gulin\0"
+    "四川省/德阳市\0"
+    "四川/德阳/德阳\0"
+    "Deyang\0"
+    "四川省/德阳市/旌阳区\0"
+    "四川/德阳/旌阳\0"
+    "Jingyang\0"
+    "四川省/德阳市/罗江区\0"
+    "四川/德阳/罗江\0"
+    "四川省/德阳市/中江县\0"
+    "四川/德阳/中江\0"
+    "Zhongjiang\0"
+    "四川省/德阳市/广汉市\0"
+    "四川/德阳/广汉\0"
+    "Guanghan\0"
+    "四川省/德阳市/什邡市\0"
+    "四川/德阳/什邡\0"
+    "Shifang\0"
+    "四川省/德阳市/绵竹市\0"
+    "四川/德阳/绵竹\0"
+    "Mianzhu\0"
+    "四川省/绵阳市\0"
+    "四川/绵阳/绵阳\0"
+    "Mianyang\0"
+    "四川省/绵阳市/涪城区\0"
+    "四川/绵阳/涪城\0"
+    "四川省/绵阳市/游仙区\0"
+    "四川/绵阳/游仙\0"
+    "四川省/绵阳市/安州区\0"
+    "四川/绵阳/安州\0"
+    "Anxian\0"
+    "四川省/绵阳市/三台县\0"
+    "四川/绵阳/三台\0"
+    "Santai\0"
+    "四川省/绵阳市/盐亭县\0"
+    "四川/绵阳/盐亭\0"
+    "Yanting\0"
+    "四川省/绵阳市/梓潼县\0"
+    "四川/绵阳/梓潼\0"
+    "Zitong\0"
+    "四川省/绵阳市/北川羌族自治县\0"
+    "四川/绵阳/北川\0"
+    "Beichuan\0"
+    "四川省/绵阳市/平武县\0"
+    "四川/绵阳/平武\0"
+    "Pingwu\0"
+    "四川省/绵阳市/江油市\0"
+    "四川/绵阳/江油\0"
+    "Jiangyou\0"
+    "四川省/广元市\0"
+    "四川/广元/广元\0"
+    "Guangyuan\0"
+    "四川省/广元市/利州区\0"
+    "四川/广元/利州\0"
+    "Lizhou\0"
+    "四川省/广元市/昭化区\0"
+    "四川/广元/昭化\0"
+    "Zhaohua\0"
+    "四川省/广元市/朝天区\0"
+    "四川/广元/朝天\0"
+    "Chaotian\0"
+    "四川省/广元市/旺苍县\0"
+    "四川/广元/旺苍\0"
+    "Wangcang\0"
+    "四川省/广元市/青川县\0"
+    "四川/广元/青川\0"
+    "Qingchuan\0"
+    "四川省/广元市/剑阁县\0"
+    "四川/广元/剑阁\0"
+    "Jiange\0"
+    "四川省/广元市/苍溪县\0"
+    "四川/广元/苍溪\0"
+    "Cangxi\0"
+    "四川省/遂宁市\0"
+    "四川/遂宁/遂宁\0"
+    "四川省/遂宁市/船山区\0"
+    "四川/遂宁/船山\0"
+    "Chuanshan\0"
+    "四川省/遂宁市/安居区\0"
+    "四川/遂宁/安居\0"
+    "Anju\0"
+    "四川省/遂宁市/蓬溪县\0"
+    "四川/遂宁/蓬溪\0"
+    "Pengxi\0"
+    "四川省/遂宁市/射洪县\0"
+    "四川/遂宁/射洪\0"
+    "Shehong\0"
+    "四川省/遂宁市/大英县\0"
+    "四川/遂宁/大英\0"
+    "Daying\0"
+    "四川省/内江市\0"
+    "四川/内江/内江\0"
+    "Neijiang\0"
+    "四川省/内江市/市中区\0"
+    "四川/内江/市中\0"
+    "四川省/内江市/东兴区\0"
+    "四川/内江/东兴\0"
+    "四川省/内江市/威远县\0"
+    "四川/内江/威远\0"
+    "Weiyuan\0"
+    "四川省/内江市/资中县\0"
+    "四川/内江/资中\0"
+    "Zizhong\0"
+    "四川省/内江市/隆昌市\0"
+    "四川/内江/隆昌\0"
+    "Longchang\0"
+    "四川省/乐山市\0"
+    "四川/乐山/乐山\0"
+    "Leshan\0"
+    "四川省/乐山市/市中区\0"
+    "四川/乐山/市中\0"
+    "四川省/乐山市/沙湾区\0"
+    "四川/乐山/沙湾\0"
+    "Shawan\0"
+    "四川省/乐山市/五通桥区\0"
+    "四川/乐山/五通桥\0"
+    "Wutongqiao\0"
+    "四川省/乐山市/金口河区\0"
+    "四川/乐山/金口河\0"
+    "Jinkouhe\0"
+    "四川省/乐山市/犍为县\0"
+    "四川/乐山/犍为\0"
+    "Qianwei\0"
+    "四川省/乐山市/井研县\0"
+    "四川/乐山/井研\0"
+    "Jingyan\0"
+    "四川省/乐山市/夹江县\0"
+    "四川/乐山/夹江\0"
+    "Jiajiang\0"
+    "四川省/乐山市/沐川县\0"
+    "四川/乐山/沐川\0"
+    "Muchuan\0"
+    "四川省/乐山市/峨边彝族自治县\0"
+    "四川/乐山/峨边\0"
+    "Ebian\0"
+    "四川省/乐山市/马边彝族自治县\0"
+    "四川/乐山/马边\0"
+    "Mabian\0"
+    "四川省/乐山市/峨眉山市\0"
+    "四川/乐山/峨眉山\0"
+    "Emeishan\0"
+    "四川省/南充市\0"
+    "四川/南充/南充\0"
+    "Nanchong\0"
+    "四川省/南充市/顺庆区\0"
+    "四川/南充/顺庆\0"
+    "Shunqing\0"
+    "四川省/南充市/高坪区\0"
+    "四川/南充/高坪\0"
+    "四川省/南充市/嘉陵区\0"
+    "四川/南充/嘉陵\0"
+    "Jialing\0"
+    "四川省/南充市/南部县\0"
+    "四川/南充/南部\0"
+    "Nanbu\0"
+    "四川省/南充市/营山县\0"
+    "四川/南充/营山\0"
+    "四川省/南充市/蓬安县\0"
+    "四川/南充/蓬安\0"
+    "Pengan\0"
+    "四川省/南充市/仪陇县\0"
+    "四川/南充/仪陇\0"
+    "Yilong\0"
+    "四川省/南充市/西充县\0"
+    "四川/南充/西充\0"
+    "Xichong\0"
+    "四川省/南充市/阆中市\0"
+    "四川/南充/阆中\0"
+    "Langzhong\0"
+    "四川省/眉山市\0"
+    "四川/眉山/眉山\0"
+    "Meishan\0"
+    "四川省/眉山市/东坡区\0"
+    "四川/眉山/东坡\0"
+    "Dongpo\0"
+    "四川省/眉山市/彭山区\0"
+    "四川/眉山/彭山\0"
+    "Pengshan\0"
+    "四川省/眉山市/仁寿县\0"
+    "四川/眉山/仁寿\0"
+    "Renshou\0"
+    "四川省/眉山市/洪雅县\0"
+    "四川/眉山/洪雅\0"
+    "Hongya\0"
+    "四川省/眉山市/丹棱县\0"
+    "四川/眉山/丹棱\0"
+    "Danleng\0"
+    "四川省/眉山市/青神县\0"
+    "四川/眉山/青神\0"
+    "Qingshen\0"
+    "四川省/宜宾市\0"
+    "四川/宜宾/宜宾\0"
+    "Yibin\0"
+    "四川省/宜宾市/翠屏区\0"
+    "四川/宜宾/翠屏\0"
+    "Cuiping\0"
+    "四川省/宜宾市/南溪区\0"
+    "四川/宜宾/南溪\0"
+    "Nanxi\0"
+    "四川省/宜宾市/叙州区\0"
+    "四川/宜宾/叙州\0"
+    "Yibinxian\0"
+    "四川省/宜宾市/江安县\0"
+    "四川/宜宾/江安\0"
+    "四川省/宜宾市/长宁县\0"
+    "四川/宜宾/长宁\0"
+    "四川省/宜宾市/高县\0"
+    "四川/宜宾/高县\0"
+    "Gaoxian\0"
+    "四川省/宜宾市/珙县\0"
+    "四川/宜宾/珙县\0"
+    "Gongxian\0"
+    "四川省/宜宾市/筠连县\0"
+    "四川/宜宾/筠连\0"
+    "Junlian\0"
+    "四川省/宜宾市/兴文县\0"
+    "四川/宜宾/兴文\0"
+    "Xingwen\0"
+    "四川省/宜宾市/屏山县\0"
+    "四川/宜宾/屏山\0"
+    "四川省/广安市\0"
+    "四川/广安\0"
+    "Guangan\0"
+    "四川省/广安市/广安区\0"
+    "四川/广安/广安\0"
+    "四川省/广安市/前锋区\0"
+    "四川/广安/前锋\0"
+    "Qianfeng\0"
+    "四川省/广安市/岳池县\0"
+    "四川/广安/岳池\0"
+    "Yuechi\0"
+    "四川省/广安市/武胜县\0"
+    "四川/广安/武胜\0"
+    "Wusheng\0"
+    "四川省/广安市/邻水县\0"
+    "四川/广安/邻水\0"
+    "Linshui\0"
+    "四川省/广安市/华蓥市\0"
+    "四川/广安/华蓥\0"
+    "Huaying\0"
+    "四川省/达州市\0"
+    "四川/达州/达州\0"
+    "Dazhou\0"
+    "四川省/达州市/通川区\0"
+    "四川/达州/通川\0"
+    "Tongchuan\0"
+    "四川省/达州市/达川区\0"
+    "四川/达州/达川\0"
+    "Daxian\0"
+    "四川省/达州市/宣汉县\0"
+    "四川/达州/宣汉\0"
+    "Xuanhan\0"
+    "四川省/达州市/开江县\0"
+    "四川/达州/开江\0"
+    "Kaijiang\0"
+    "四川省/达州市/大竹县\0"
+    "四川/达州/大竹\0"
+    "Dazhu\0"
+    "四川省/达州市/渠县\0"
+    "四川/达州/渠县\0"
+    "Quxian\0"
+    "四川省/达州市/万源市\0"
+    "四川/达州/万源\0"
+    "Wanyuan\0"
+    "四川省/雅安市\0"
+    "四川/雅安/雅安\0"
+    "Yaan\0"
+    "四川省/雅安市/雨城区\0"
+    "四川/雅安/雨城\0"
+    "四川省/雅安市/名山区\0"
+    "四川/雅安/名山\0"
+    "四川省/雅安市/荥经县\0"
+    "四川/雅安/荥经\0"
+    "Yingjing\0"
+    "四川省/雅安市/汉源县\0"
+    "四川/雅安/汉源\0"
+    "Hanyuan\0"
+    "四川省/雅安市/石棉县\0"
+    "四川/雅安/石棉\0"
+    "Shimian\0"
+    "四川省/雅安市/天全县\0"
+    "四川/雅安/天全\0"
+    "Tianquan\0"
+    "四川省/雅安市/芦山县\0"
+    "四川/雅安/芦山\0"
+    "四川省/雅安市/宝兴县\0"
+    "四川/雅安/宝兴\0"
+    "Baoxing\0"
+    "四川省/巴中市\0"
+    "四川/巴中/巴中\0"
+    "Bazhong\0"
+    "四川省/巴中市/巴州区\0"
+    "四川/巴中/巴州\0"
+    "四川省/巴中市/恩阳区\0"
+    "四川/巴中/恩阳\0"
+    "Enyang\0"
+    "四川省/巴中市/通江县\0"
+    "四川/巴中/通江\0"
+    "四川省/巴中市/南江县\0"
+    "四川/巴中/南江\0"
+    "Nanjiang\0"
+    "四川省/巴中市/平昌县\0"
+    "四川/巴中/平昌\0"
+    "Pingchang\0"
+    "四川省/资阳市\0"
+    "四川/资阳/资阳\0"
+    "四川省/资阳市/雁江区\0"
+    "四川/资阳/雁江\0"
+    "Yanjiang\0"
+    "四川省/资阳市/安岳县\0"
+    "四川/资阳/安岳\0"
+    "Anyue\0"
+    "四川省/资阳市/乐至县\0"
+    "四川/资阳/乐至\0"
+    "Lezhi\0"
+    "四川省/阿坝藏族羌族自治州\0"
+    "四川/阿坝\0"
+    "Aba\0"
+    "四川省/阿坝藏族羌族自治州/马尔康市\0"
+    "四川/阿坝/马尔康\0"
+    "Maerkang\0"
+    "四川省/阿坝藏族羌族自治州/汶川县\0"
+    "四川/阿坝/汶川\0"
+    "Wenchuan\0"
+    "四川省/阿坝藏族羌族自治州/理县\0"
+    "四川/阿坝/理县\0"
+    "四川省/阿坝藏族羌族自治州/茂县\0"
+    "四川/阿坝/茂县\0"
+    "Maoxian\0"
+    "四川省/阿坝藏族羌族自治州/松潘县\0"
+    "四川/阿坝/松潘\0"
+    "Songfan\0"
+    "四川省/阿坝藏族羌族自治州/九寨沟县\0"
+    "四川/阿坝/九寨沟\0"
+    "Jiuzhaigou\0"
+    "四川省/阿坝藏族羌族自治州/金川县\0"
+    "四川/阿坝/金川\0"
+    "Jinchuan\0"
+    "四川省/阿坝藏族羌族自治州/小金县\0"
+    "四川/阿坝/小金\0"
+    "Xiaojin\0"
+    "四川省/阿坝藏族羌族自治州/黑水县\0"
+    "四川/阿坝/黑水\0"
+    "Heishui\0"
+    "四川省/阿坝藏族羌族自治州/壤塘县\0"
+    "四川/阿坝/壤塘\0"
+    "Rangtang\0"
+    "四川省/阿坝藏族羌族自治州/阿坝县\0"
+    "四川/阿坝/阿坝\0"
+    "四川省/阿坝藏族羌族自治州/若尔盖县\0"
+    "四川/阿坝/若尔盖\0"
+    "Nuoergai\0"
+    "四川省/阿坝藏族羌族自治州/红原县\0"
+    "四川/阿坝/红原\0"
+    "Hongyuan\0"
+    "四川省/甘孜藏族自治州\0"
+    "四川/甘孜\0"
+    "Ganzi\0"
+    "四川省/甘孜藏族自治州/康定市\0"
+    "四川/甘孜/康定\0"
+    "Kangding\0"
+    "四川省/甘孜藏族自治州/泸定县\0"
+    "四川/甘孜/泸定\0"
+    "Luding\0"
+    "四川省/甘孜藏族自治州/丹巴县\0"
+    "四川/甘孜/丹巴\0"
+    "Danba\0"
+    "四川省/甘孜藏族自治州/九龙县\0"
+    "四川/甘孜/九龙\0"
+    "Jiulong\0"
+    "四川省/甘孜藏族自治州/雅江县\0"
+    "四川/甘孜/雅江\0"
+    "Yajiang\0"
+    "四川省/甘孜藏族自治州/道孚县\0"
+    "四川/甘孜/道孚\0"
+    "Daofu\0"
+    "四川省/甘孜藏族自治州/炉霍县\0"
+    "四川/甘孜/炉霍\0"
+    "Luhuo\0"
+    "四川省/甘孜藏族自治州/甘孜县\0"
+    "四川/甘孜/甘孜\0"
+    "四川省/甘孜藏族自治州/新龙县\0"
+    "四川/甘孜/新龙\0"
+    "Xinlong\0"
+    "四川省/甘孜藏族自治州/德格县\0"
+    "四川/甘孜/德格\0"
+    "Dege\0"
+    "四川省/甘孜藏族自治州/白玉县\0"
+    "四川/甘孜/白玉\0"
+    "Baiyu\0"
+    "四川省/甘孜藏族自治州/石渠县\0"
+    "四川/甘孜/石渠\0"
+    "Shiqu\0"
+    "四川省/甘孜藏族自治州/色达县\0"
+    "四川/甘孜/色达\0"
+    "Seda\0"
+    "四川省/甘孜藏族自治州/理塘县\0"
+    "四川/甘孜/理塘\0"
+    "Litang\0"
+    "四川省/甘孜藏族自治州/巴塘县\0"
+    "四川/甘孜/巴塘\0"
+    "Batang\0"
+    "四川省/甘孜藏族自治州/乡城县\0"
+    "四川/甘孜/乡城\0"
+    "四川省/甘孜藏族自治州/稻城县\0"
+    "四川/甘孜/稻城\0"
+    "Daocheng\0"
+    "四川省/甘孜藏族自治州/得荣县\0"
+    "四川/甘孜/得荣\0"
+    "Derong\0"
+    "四川省/凉山彝族自治州\0"
+    "四川/凉山/凉山\0"
+    "四川省/凉山彝族自治州/西昌市\0"
+    "四川/凉山/西昌\0"
+    "Xichang\0"
+    "四川省/凉山彝族自治州/木里藏族自治县\0"
+    "四川/凉山/木里\0"
+    "Muli\0"
+    "四川省/凉山彝族自治州/盐源县\0"
+    "四川/凉山/盐源\0"
+    "Yanyuan\0"
+    "四川省/凉山彝族自治州/德昌县\0"
+    "四川/凉山/德昌\0"
+    "Dechang\0"
+    "四川省/凉山彝族自治州/会理县\0"
+    "四川/凉山/会理\0"
+    "Huili\0"
+    "四川省/凉山彝族自治州/会东县\0"
+    "四川/凉山/会东\0"
+    "四川省/凉山彝族自治州/宁南县\0"
+    "四川/凉山/宁南\0"
+    "Ningnan\0"
+    "四川省/凉山彝族自治州/普格县\0"
+    "四川/凉山/普格\0"
+    "Puge\0"
+    "四川省/凉山彝族自治州/布拖县\0"
+    "四川/凉山/布拖\0"
+    "Butuo\0"
+    "四川省/凉山彝族自治州/金阳县\0"
+    "四川/凉山/金阳\0"
+    "Jinyang\0"
+    "四川省/凉山彝族自治州/昭觉县\0"
+    "四川/凉山/昭觉\0"
+    "Zhaojue\0"
+    "四川省/凉山彝族自治州/喜德县\0"
+    "四川/凉山/喜德\0"
+    "Xide\0"
+    "四川省/凉山彝族自治州/冕宁县\0"
+    "四川/凉山/冕宁\0"
+    "Mianning\0"
+    "四川省/凉山彝族自治州/越西县\0"
+    "四川/凉山/越西\0"
+    "四川省/凉山彝族自治州/甘洛县\0"
+    "四川/凉山/甘洛\0"
+    "Ganluo\0"
+    "四川省/凉山彝族自治州/美姑县\0"
+    "四川/凉山/美姑\0"
+    "Meigu\0"
+    "四川省/凉山彝族自治州/雷波县\0"
+    "四川/凉山/雷波\0"
+    "Leibo\0"
+    "贵州省/贵阳市\0"
+    "贵州/贵阳/贵阳\0"
+    "贵州省/贵阳市/南明区\0"
+    "贵州/贵阳/南明\0"
+    "Nanming\0"
+    "贵州省/贵阳市/云岩区\0"
+    "贵州/贵阳/云岩\0"
+    "Yunyan\0"
+    "贵州省/贵阳市/花溪区\0"
+    "贵州/贵阳/花溪\0"
+    "Huaxi\0"
+    "贵州省/贵阳市/乌当区\0"
+    "贵州/贵阳/乌当\0"
+    "Wudang\0"
+    "贵州省/贵阳市/白云区\0"
+    "贵州/贵阳/白云\0"
+    "贵州省/贵阳市/观山湖区\0"
+    "贵州/贵阳/观山湖\0"
+    "Guanshanhu\0"
+    "贵州省/贵阳市/开阳县\0"
+    "贵州/贵阳/开阳\0"
+    "Kaiyang\0"
+    "贵州省/贵阳市/息烽县\0"
+    "贵州/贵阳/息烽\0"
+    "贵州省/贵阳市/修文县\0"
+    "贵州/贵阳/修文\0"
+    "Xiuwen\0"
+    "贵州省/贵阳市/清镇市\0"
+    "贵州/贵阳/清镇\0"
+    "Qingzhen\0"
+    "贵州省/六盘水市\0"
+    "贵州/贵州/六盘水\0"
+    "Liupanshui\0"
+    "贵州省/六盘水市/钟山区\0"
+    "贵州/六盘水/钟山\0"
+    "贵州省/六盘水市/六枝特区\0"
+    "贵州/六盘水/六枝\0"
+    "Liuzhi\0"
+    "贵州省/六盘水市/水城县\0"
+    "贵州/六盘水/水城\0"
+    "Shuicheng\0"
+    "贵州省/六盘水市/盘州市\0"
+    "贵州省/六盘水/盘州\0"
+    "Panxian\0"
+    "贵州省/遵义市\0"
+    "贵州/遵义/遵义\0"
+    "Zunyi\0"
+    "贵州省/遵义市/红花岗区\0"
+    "贵州/遵义/红花岗\0"
+    "Honghuagang\0"
+    "贵州省/遵义市/汇川区\0"
+    "贵州/遵义/汇川\0"
+    "Huichuan\0"
+    "贵州省/遵义市/播州区\0"
+    "贵州/遵义/播州\0"
+    "贵州省/遵义市/桐梓县\0"
+    "贵州/遵义/桐梓\0"
+    "Tongzi\0"
+    "贵州省/遵义市/绥阳县\0"
+    "贵州/遵义/绥阳\0"
+    "贵州省/遵义市/正安县\0"
+    "贵州/遵义/正安\0"
+    "Zhengan\0"
+    "贵州省/遵义市/道真仡佬族苗族自治县\0"
+    "贵州/遵义/道真\0"
+    "Daozhen\0"
+    "贵州省/遵义市/务川仡佬族苗族自治县\0"
+    "贵州/遵义/务川\0"
+    "贵州省/遵义市/凤冈县\0"
+    "贵州/遵义/凤冈\0"
+    "Fenggang\0"
+    "贵州省/遵义市/湄潭县\0"
+    "贵州/遵义/湄潭\0"
+    "Meitan\0"
+    "贵州省/遵义市/余庆县\0"
+    "贵州/遵义/余庆\0"
+    "Yuqing\0"
+    "贵州省/遵义市/习水县\0"
+    "贵州/遵义/习水\0"
+    "贵州省/遵义市/赤水市\0"
+    "贵州/遵义/赤水\0"
+    "Chishui\0"
+    "贵州省/遵义市/仁怀市\0"
+    "贵州/遵义/仁怀\0"
+    "Renhuai\0"
+    "贵州省/安顺市\0"
+    "贵州/安顺/安顺\0"
+    "Anshun\0"
+    "贵州省/安顺市/西秀区\0"
+    "贵州/安顺/西秀\0"
+    "Xixiu\0"
+    "贵州省/安顺市/平坝区\0"
+    "贵州/安顺/平坝\0"
+    "Pingba\0"
+    "贵州省/安顺市/普定县\0"
+    "贵州/安顺/普定\0"
+    "Puding\0"
+    "贵州省/安顺市/镇宁布依族苗族自治县\0"
+    "贵州/安顺/镇宁\0"
+    "Zhenning\0"
+    "贵州省/安顺市/关岭布依族苗族自治县\0"
+    "贵州/安顺/关岭\0"
+    "Guanling\0"
+    "贵州省/安顺市/紫云苗族布依族自治县\0"
+    "贵州/安顺/紫云\0"
+    "Ziyun\0"
+    "贵州省/毕节市\0"
+    "贵州/毕节/毕节\0"
+    "Bijie\0"
+    "贵州省/毕节市/七星关区\0"
+    "贵州/毕节/七星关\0"
+    "Qixingguan\0"
+    "贵州省/毕节市/大方县\0"
+    "贵州/毕节/大方\0"
+    "Dafang\0"
+    "贵州省/毕节市/黔西县\0"
+    "贵州/毕节/黔西\0"
+    "贵州省/毕节市/金沙县\0"
+    "贵州/毕节/金沙\0"
+    "Jinsha\0"
+    "贵州省/毕节市/织金县\0"
+    "贵州/毕节/织金\0"
+    "Zhijin\0"
+    "贵州省/毕节市/纳雍县\0"
+    "贵州/毕节/纳雍\0"
+    "Nayong\0"
+    "贵州省/毕节市/威宁彝族回族苗族自治县\0"
+    "贵州/毕节/威宁\0"
+    "Weining\0"
+    "贵州省/毕节市/赫章县\0"
+    "贵州/毕节/赫章\0"
+    "Hezhang\0"
+    "贵州省/铜仁市\0"
+    "贵州/铜仁/铜仁\0"
+    "Tongren\0"
+    "贵州省/铜仁市/碧江区\0"
+    "贵州/铜仁/碧江\0"
+    "Bijiang\0"
+    "贵州省/铜仁市/万山区\0"
+    "贵州/铜仁/万山\0"
+    "Wanshan\0"
+    "贵州省/铜仁市/江口县\0"
+    "贵州/铜仁/江口\0"
+    "Jiangkou\0"
+    "贵州省/铜仁市/玉屏侗族自治县\0"
+    "贵州/铜仁/玉屏\0"
+    "Yuping\0"
+    "贵州省/铜仁市/石阡县\0"
+    "贵州/铜仁/石阡\0"
+    "Shiqian\0"
+    "贵州省/铜仁市/思南县\0"
+    "贵州/铜仁/思南\0"
+    "Sinan\0"
+    "贵州省/铜仁市/印江土家族苗族自治县\0"
+    "贵州/铜仁/印江\0"
+    "Yinjiang\0"
+    "贵州省/铜仁市/德江县\0"
+    "贵州/铜仁/德江\0"
+    "Dejiang\0"
+    "贵州省/铜仁市/沿河土家族自治县\0"
+    "贵州/铜仁/沿河\0"
+    "Yanhe\0"
+    "贵州省/铜仁市/松桃苗族自治县\0"
+    "贵州/铜仁/松桃\0"
+    "Songtao\0"
+    "贵州省/黔西南布依族苗族自治州\0"
+    "贵州/贵州/黔西南\0"
+    "Qianxinan\0"
+    "贵州省/黔西南布依族苗族自治州/兴义市\0"
+    "贵州/黔西南/兴义\0"
+    "Xingyi\0"
+    "贵州省/黔西南布依族苗族自治州/兴仁市\0"
+    "贵州/黔西南/兴仁\0"
+    "Xingren\0"
+    "贵州省/黔西南布依族苗族自治州/普安县\0"
+    "贵州/黔西南/普安\0"
+    "Puan\0"
+    "贵州省/黔西南布依族苗族自治州/晴隆县\0"
+    "贵州/黔西南/晴隆\0"
+    "贵州省/黔西南布依族苗族自治州/贞丰县\0"
+    "贵州/黔西南/贞丰\0"
+    "Zhenfeng\0"
+    "贵州省/黔西南布依族苗族自治州/望谟县\0"
+    "贵州/黔西南/望谟\0"
+    "Wangmo\0"
+    "贵州省/黔西南布依族苗族自治州/册亨县\0"
+    "贵州/黔西南/册亨\0"
+    "Ceheng\0"
+    "贵州省/黔西南布依族苗族自治州/安龙县\0"
+    "贵州/黔西南/安龙\0"
+    "Anlong\0"
+    "贵州省/黔东南苗族侗族自治州\0"
+    "贵州/贵州/黔东南\0"
+    "Qiandongnan\0"
+    "贵州省/黔东南苗族侗族自治州/凯里市\0"
+    "贵州/黔东南/凯里\0"
+    "Kaili\0"
+    "贵州省/黔东南苗族侗族自治州/黄平县\0"
+    "贵州/黔东南/黄平\0"
+    "Huangping\0"
+    "贵州省/黔东南苗族侗族自治州/施秉县\0"
+    "贵州/黔东南/施秉\0"
+    "Shibing\0"
+    "贵州省/黔东南苗族侗族自治州/三穗县\0"
+    "贵州/黔东南/三穗\0"
+    "Sansui\0"
+    "贵州省/黔东南苗族侗族自治州/镇远县\0"
+    "贵州/黔东南/镇远\0"
+    "Zhenyuan\0"
+    "贵州省/黔东南苗族侗族自治州/岑巩县\0"
+    "贵州/黔东南/岑巩\0"
+    "Cengong\0"
+    "贵州省/黔东南苗族侗族自治州/天柱县\0"
+    "贵州/黔东南/天柱\0"
+    "Tianzhu\0"
+    "贵州省/黔东南苗族侗族自治州/锦屏县\0"
+    "贵州/黔东南/锦屏\0"
+    "贵州省/黔东南苗族侗族自治州/剑河县\0"
+    "贵州/黔东南/剑河\0"
+    "Jianhe\0"
+    "贵州省/黔东南苗族侗族自治州/台江县\0"
+    "贵州/黔东南/台江\0"
+    "贵州省/黔东南苗族侗族自治州/黎平县\0"
+    "贵州/黔东南/黎平\0"
+    "Liping\0"
+    "贵州省/黔东南苗族侗族自治州/榕江县\0"
+    "贵州/黔东南/榕江\0"
+    "Rongjiang\0"
+    "贵州省/黔东南苗族侗族自治州/从江县\0"
+    "贵州/黔东南/从江\0"
+    "Congjiang\0"
+    "贵州省/黔东南苗族侗族自治州/雷山县\0"
+    "贵州/黔东南/雷山\0"
+    "Leishan\0"
+    "贵州省/黔东南苗族侗族自治州/麻江县\0"
+    "贵州/黔东南/麻江\0"
+    "Majiang\0"
+    "贵州省/黔东南苗族侗族自治州/丹寨县\0"
+    "贵州/黔东南/丹寨\0"
+    "Danzhai\0"
+    "贵州省/黔南布依族苗族自治州\0"
+    "贵州/贵州/黔南\0"
+    "Qiannan\0"
+    "贵州省/黔南布依族苗族自治州/都匀市\0"
+    "贵州/黔南/都匀\0"
+    "Duyun\0"
+    "贵州省/黔南布依族苗族自治州/福泉市\0"
+    "贵州/黔南/福泉\0"
+    "Fuquan\0"
+    "贵州省/黔南布依族苗族自治州/荔波县\0"
+    "贵州/黔南/荔波\0"
+    "Libo\0"
+    "贵州省/黔南布依族苗族自治州/贵定县\0"
+    "贵州/黔南/贵定\0"
+    "Guiding\0"
+    "贵州省/黔南布依族苗族自治州/瓮安县\0"
+    "贵州/黔南/瓮安\0"
+    "Wengan\0"
+    "贵州省/黔南布依族苗族自治州/独山县\0"
+    "贵州/黔南/独山\0"
+    "Dushan\0"
+    "贵州省/黔南布依族苗族自治州/平塘县\0"
+    "贵州/黔南/平塘\0"
+    "Pingtang\0"
+    "贵州省/黔南布依族苗族自治州/罗甸县\0"
+    "贵州/黔南/罗甸\0"
+    "Luodian\0"
+    "贵州省/黔南布依族苗族自治州/长顺县\0"
+    "贵州/黔南/长顺\0"
+    "Changshun\0"
+    "贵州省/黔南布依族苗族自治州/龙里县\0"
+    "贵州/黔南/龙里\0"
+    "Longli\0"
+    "贵州省/黔南布依族苗族自治州/惠水县\0"
+    "贵州/黔南/惠水\0"
+    "Huishui\0"
+    "贵州省/黔南布依族苗族自治州/三都水族自治县\0"
+    "贵州/黔南/三都\0"
+    "Sandu\0"
+    "云南省/昆明市\0"
+    "云南/昆明/昆明\0"
+    "Kunming\0"
+    "云南省/昆明市/五华区\0"
+    "云南/昆明/五华\0"
+    "云南省/昆明市/盘龙区\0"
+    "云南/昆明/盘龙\0"
+    "Panlong\0"
+    "云南省/昆明市/官渡区\0"
+    "云南/昆明/官渡\0"
+    "Guandu\0"
+    "云南省/昆明市/西山区\0"
+    "云南/昆明/西山\0"
+    "云南省/昆明市/东川区\0"
+    "云南/昆明/东川\0"
+    "Dongchuan\0"
+    "云南省/昆明市/呈贡区\0"
+    "云南/昆明/呈贡\0"
+    "Chenggong\0"
+    "云南省/昆明市/晋宁区\0"
+    "云南/昆明/晋宁\0"
+    "Jinning\0"
+    "云南省/昆明市/富民县\0"
+    "云南/昆明/富民\0"
+    "Fumin\0"
+    "云南省/昆明市/宜良县\0"
+    "云南/昆明/宜良\0"
+    "Yiliang\0"
+    "云南省/昆明市/石林彝族自治县\0"
+    "云南/昆明/石林\0"
+    "Shilin\0"
+    "云南省/昆明市/嵩明县\0"
+    "云南/昆明/嵩明\0"
+    "Songming\0"
+    "云南省/昆明市/禄劝彝族苗族自治县\0"
+    "云南/昆明/禄劝\0"
+    "云南省/昆明市/寻甸回族彝族自治县\0"
+    "云南/昆明/寻甸\0"
+    "Xundian\0"
+    "云南省/昆明市/安宁市\0"
+    "云南/昆明/安宁\0"
+    "Anning\0"
+    "云南省/曲靖市\0"
+    "云南/曲靖/曲靖\0"
+    "Qujing\0"
+    "云南省/曲靖市/麒麟区\0"
+    "云南/曲靖/麒麟\0"
+    "Qilin\0"
+    "云南省/曲靖市/沾益区\0"
+    "云南/曲靖/沾益\0"
+    "Zhanyi\0"
+    "云南省/曲靖市/马龙区\0"
+    "云南/曲靖/马龙\0"
+    "Malong\0"
+    "云南省/曲靖市/陆良县\0"
+    "云南/曲靖/陆良\0"
+    "Luliang\0"
+    "云南省/曲靖市/师宗县\0"
+    "云南/曲靖/师宗\0"
+    "Shizong\0"
+    "云南省/曲靖市/罗平县\0"
+    "云南/曲靖/罗平\0"
+    "Luoping\0"
+    "云南省/曲靖市/富源县\0"
+    "云南/曲靖/富源\0"
+    "云南省/曲靖市/会泽县\0"
+    "云南/曲靖/会泽\0"
+    "Huize\0"
+    "云南省/曲靖市/宣威市\0"
+    "云南/曲靖/宣威\0"
+    "Xuanwei\0"
+    "云南省/玉溪市\0"
+    "云南/玉溪/玉溪\0"
+    "Yuxi\0"
+    "云南省/玉溪市/红塔区\0"
+    "云南/玉溪/红塔\0"
+    "Hongta\0"
+    "云南省/玉溪市/江川区\0"
+    "云南/玉溪/江川\0"
+    "Jiangchuan\0"
+    "云南省/玉溪市/澄江县\0"
+    "云南/玉溪/澄江\0"
+    "Chengjiang\0"
+    "云南省/玉溪市/通海县\0"
+    "云南/玉溪/通海\0"
+    "Tonghai\0"
+    "云南省/玉溪市/华宁县\0"
+    "云南/玉溪/华宁\0"
+    "Huaning\0"
+    "云南省/玉溪市/易门县\0"
+    "云南/玉溪/易门\0"
+    "Yimen\0"
+    "云南省/玉溪市/峨山彝族自治县\0"
+    "云南/玉溪/峨山\0"
+    "Eshan\0"
+    "云南省/玉溪市/新平彝族傣族自治县\0"
+    "云南/玉溪/新平\0"
+    "Xinping\0"
+    "云南省/玉溪市/元江哈尼族彝族傣族自治县\0"
+    "云南/玉溪/元江\0"
+    "云南省/保山市\0"
+    "云南/保山/保山\0"
+    "云南省/保山市/隆阳区\0"
+    "云南/保山/隆阳\0"
+    "Longyang\0"
+    "云南省/保山市/施甸县\0"
+    "云南/保山/施甸\0"
+    "Shidian\0"
+    "云南省/保山市/龙陵县\0"
+    "云南/保山/龙陵\0"
+    "Longling\0"
+    "云南省/保山市/昌宁县\0"
+    "云南/保山/昌宁\0"
+    "云南省/保山市/腾冲市\0"
+    "云南/保山/腾冲\0"
+    "Tengchong\0"
+    "云南省/昭通市\0"
+    "云南/昭通/昭通\0"
+    "Zhaotong\0"
+    "云南省/昭通市/昭阳区\0"
+    "云南/昭通/昭阳\0"
+    "Zhaoyang\0"
+    "云南省/昭通市/鲁甸县\0"
+    "云南/昭通/鲁甸\0"
+    "Ludian\0"
+    "云南省/昭通市/巧家县\0"
+    "云南/昭通/巧家\0"
+    "Qiaojia\0"
+    "云南省/昭通市/盐津县\0"
+    "云南/昭通/盐津\0"
+    "云南省/昭通市/大关县\0"
+    "云南/昭通/大关\0"
+    "云南省/昭通市/永善县\0"
+    "云南/昭通/永善\0"
+    "Yongshan\0"
+    "云南省/昭通市/绥江县\0"
+    "云南/昭通/绥江\0"
+    "Suijiang\0"
+    "云南省/昭通市/镇雄县\0"
+    "云南/昭通/镇雄\0"
+    "Zhenxiong\0"
+    "云南省/昭通市/彝良县\0"
+    "云南/昭通/彝良\0"
+    "云南省/昭通市/威信县\0"
+    "云南/昭通/威信\0"
+    "Weixin\0"
+    "云南省/昭通市/水富市\0"
+    "云南/昭通/水富\0"
+    "Shuifu\0"
+    "云南省/丽江市\0"
+    "云南/丽江/丽江\0"
+    "Lijiang\0"
+    "云南省/丽江市/古城区\0"
+    "云南/丽江/古城\0"
+    "云南省/丽江市/玉龙纳西族自治县\0"
+    "云南/丽江/玉龙\0"
+    "Yulong\0"
+    "云南省/丽江市/永胜县\0"
+    "云南/丽江/永胜\0"
+    "Yongsheng\0"
+    "云南省/丽江市/华坪县\0"
+    "云南/丽江/华坪\0"
+    "Huaping\0"
+    "云南省/丽江市/宁蒗彝族自治县\0"
+    "云南/丽江/宁蒗\0"
+    "Ninglang\0"
+    "云南省/普洱市\0"
+    "云南/普洱/普洱\0"
+    "Puer\0"
+    "云南省/普洱市/思茅区\0"
+    "云南/普洱/思茅\0"
+    "Simao\0"
+    "云南省/普洱市/宁洱哈尼族彝族自治县\0"
+    "云南/普洱/宁洱\0"
+    "Ninger\0"
+    "云南省/普洱市/墨江哈尼族自治县\0"
+    "云南/普洱/墨江\0"
+    "Mojiang\0"
+    "云南省/普洱市/景东彝族自治县\0"
+    "云南/普洱/景东\0"
+    "Jingdong\0"
+    "云南省/普洱市/景谷傣族彝族自治县\0"
+    "云南/普洱/景谷\0"
+    "Jinggu\0"
+    "云南省/普洱市/镇沅彝族哈尼族拉祜族自治县\0"
+    "云南/普洱/镇沅\0"
+    "云南省/普洱市/江城哈尼族彝族自治县\0"
+    "云南/普洱/江城\0"
+    "云南省/普洱市/孟连傣族拉祜族佤族自治县\0"
+    "云南/普洱/孟连\0"
+    "Menglian\0"
+    "云南省/普洱市/澜沧拉祜族自治县\0"
+    "云南/普洱/澜沧\0"
+    "Lancang\0"
+    "云南省/普洱市/西盟佤族自治县\0"
+    "云南/普洱/西盟\0"
+    "Ximeng\0"
+    "云南省/临沧市\0"
+    "云南/临沧/临沧\0"
+    "Lincang\0"
+    "云南省/临沧市/临翔区\0"
+    "云南/临沧/临翔\0"
+    "云南省/临沧市/凤庆县\0"
+    "云南/临沧/凤庆\0"
+    "Fengqing\0"
+    "云南省/临沧市/云县\0"
+    "云南/临沧/云县\0"
+    "云南省/临沧市/永德县\0"
+    "云南/临沧/永德\0"
+    "Yongde\0"
+    "云南省/临沧市/镇康县\0"
+    "云南/临沧/镇康\0"
+    "Zhenkang\0"
+    "云南省/临沧市/双江拉祜族佤族布朗族傣族自治县\0"
+    "云南/临沧/双江\0"
+    "Shuangjiang\0"
+    "云南省/临沧市/耿马傣族佤族自治县\0"
+    "云南/临沧/耿马\0"
+    "Gengma\0"
+    "云南省/临沧市/沧源佤族自治县\0"
+    "云南/临沧/沧源\0"
+    "Cangyuan\0"
+    "云南省/楚雄彝族自治州\0"
+    "云南/楚雄\0"
+    "Chuxiong\0"
+    "云南省/楚雄彝族自治州/楚雄市\0"
+    "云南/楚雄/楚雄\0"
+    "云南省/楚雄彝族自治州/双柏县\0"
+    "云南/楚雄/双柏\0"
+    "Shuangbai\0"
+    "云南省/楚雄彝族自治州/牟定县\0"
+    "云南/楚雄/牟定\0"
+    "Mouding\0"
+    "云南省/楚雄彝族自治州/南华县\0"
+    "云南/楚雄/南华\0"
+    "Nanhua\0"
+    "云南省/楚雄彝族自治州/姚安县\0"
+    "云南/楚雄/姚安\0"
+    "Yaoan\0"
+    "云南省/楚雄彝族自治州/大姚县\0"
+    "云南/楚雄/大姚\0"
+    "Dayao\0"
+    "云南省/楚雄彝族自治州/永仁县\0"
+    "云南/楚雄/永仁\0"
+    "Yongren\0"
+    "云南省/楚雄彝族自治州/元谋县\0"
+    "云南/楚雄/元谋\0"
+    "Yuanmou\0"
+    "云南省/楚雄彝族自治州/武定县\0"
+    "云南/楚雄/武定\0"
+    "Wuding\0"
+    "云南省/楚雄彝族自治州/禄丰县\0"
+    "云南/楚雄/禄丰\0"
+    "云南省/红河哈尼族彝族自治州\0"
+    "云南/红河\0"
+    "Honghe\0"
+    "云南省/红河哈尼族彝族自治州/个旧市\0"
+    "云南/红河/个旧\0"
+    "Gejiu\0"
+    "云南省/红河哈尼族彝族自治州/开远市\0"
+    "云南/红河/开远\0"
+    "云南省/红河哈尼族彝族自治州/蒙自市\0"
+    "云南/红河/蒙自\0"
+    "Mengzi\0"
+    "云南省/红河哈尼族彝族自治州/弥勒市\0"
+    "云南/红河/弥勒\0"
+    "Mile\0"
+    "云南省/红河哈尼族彝族自治州/屏边苗族自治县\0"
+    "云南/红河/屏边\0"
+    "Pingbian\0"
+    "云南省/红河哈尼族彝族自治州/建水县\0"
+    "云南/红河/建水\0"
+    "Jianshui\0"
+    "云南省/红河哈尼族彝族自治州/石屏县\0"
+    "云南/红河/石屏\0"
+    "Shiping\0"
+    "云南省/红河哈尼族彝族自治州/泸西县\0"
+    "云南/红河/泸西\0"
+    "云南省/红河哈尼族彝族自治州/元阳县\0"
+    "云南/红河/元阳\0"
+    "云南省/红河哈尼族彝族自治州/红河县\0"
+    "云南/红河/红河\0"
+    "云南省/红河哈尼族彝族自治州/金平苗族瑶族傣族自治县\0"
+    "云南/红河/金平\0"
+    "云南省/红河哈尼族彝族自治州/绿春县\0"
+    "云南/红河/绿春\0"
+    "Lvchun\0"
+    "云南省/红河哈尼族彝族自治州/河口瑶族自治县\0"
+    "云南/红河/河口\0"
+    "云南省/文山壮族苗族自治州\0"
+    "云南/文山\0"
+    "Wenshan\0"
+    "云南省/文山壮族苗族自治州/文山市\0"
+    "云南/文山/文山\0"
+    "云南省/文山壮族苗族自治州/砚山县\0"
+    "云南/文山/砚山\0"
+    "云南省/文山壮族苗族自治州/西畴县\0"
+    "云南/文山/西畴\0"
+    "Xichou\0"
+    "云南省/文山壮族苗族自治州/麻栗坡县\0"
+    "云南/文山/麻栗坡\0"
+    "Malipo\0"
+    "云南省/文山壮族苗族自治州/马关县\0"
+    "云南/文山/马关\0"
+    "Maguan\0"
+    "云南省/文山壮族苗族自治州/丘北县\0"
+    "云南/文山/丘北\0"
+    "Qiubei\0"
+    "云南省/文山壮族苗族自治州/广南县\0"
+    "云南/文山/广南\0"
+    "Guangnan\0"
+    "云南省/文山壮族苗族自治州/富宁县\0"
+    "云南/文山/富宁\0"
+    "云南省/西双版纳傣族自治州\0"
+    "云南/云南/西双版纳\0"
+    "Xishuangbanna\0"
+    "云南省/西双版纳傣族自治州/景洪市\0"
+    "云南/西双版纳/景洪\0"
+    "Jinghong\0"
+    "云南省/西双版纳傣族自治州/勐海县\0"
+    "云南/西双版纳/勐海\0"
+    "Menghai\0"
+    "云南省/西双版纳傣族自治州/勐腊县\0"
+    "云南/西双版纳/勐腊\0"
+    "Mengla\0"
+    "云南省/大理白族自治州\0"
+    "云南/大理\0"
+    "Dali\0"
+    "云南省/大理白族自治州/大理市\0"
+    "云南/大理/大理\0"
+    "云南省/大理白族自治州/漾濞彝族自治县\0"
+    "云南/大理/漾濞\0"
+    "Yangbi\0"
+    "云南省/大理白族自治州/祥云县\0"
+    "云南/大理/祥云\0"
+    "Xiangyun\0"
+    "云南省/大理白族自治州/宾川县\0"
+    "云南/大理/宾川\0"
+    "Binchuan\0"
+    "云南省/大理白族自治州/弥渡县\0"
+    "云南/大理/弥渡\0"
+    "Midu\0"
+    "云南省/大理白族自治州/南涧彝族自治县\0"
+    "云南/大理/南涧\0"
+    "Nanjian\0"
+    "云南省/大理白族自治州/巍山彝族回族自治县\0"
+    "云南/大理/巍山\0"
+    "云南省/大理白族自治州/永平县\0"
+    "云南/大理/永平\0"
+    "Yongping\0"
+    "云南省/大理白族自治州/云龙县\0"
+    "云南/大理/云龙\0"
+    "云南省/大理白族自治州/洱源县\0"
+    "云南/大理/洱源\0"
+    "Eryuan\0"
+    "云南省/大理白族自治州/剑川县\0"
+    "云南/大理/剑川\0"
+    "Jianchuan\0"
+    "云南省/大理白族自治州/鹤庆县\0"
+    "云南/大理/鹤庆\0"
+    "Heqing\0"
+    "云南省/德宏傣族景颇族自治州\0"
+    "云南/德宏/德宏\0"
+    "Dehong\0"
+    "云南省/德宏傣族景颇族自治州/瑞丽市\0"
+    "云南/德宏/瑞丽\0"
+    "Ruili\0"
+    "云南省/德宏傣族景颇族自治州/芒市\0"
+    "云南/德宏/芒市\0"
+    "Mangshi\0"
+    "云南省/德宏傣族景颇族自治州/梁河县\0"
+    "云南/德宏/梁河\0"
+    "Lianghe\0"
+    "云南省/德宏傣族景颇族自治州/盈江县\0"
+    "云南/德宏/盈江\0"
+    "云南省/德宏傣族景颇族自治州/陇川县\0"
+    "云南/德宏/陇川\0"
+    "云南省/怒江傈僳族自治州\0"
+    "云南/怒江/怒江\0"
+    "Nujiang\0"
+    "云南省/怒江傈僳族自治州/泸水市\0"
+    "云南/怒江/泸水\0"
+    "Lushui\0"
+    "云南省/怒江傈僳族自治州/福贡县\0"
+    "云南/怒江/福贡\0"
+    "Fugong\0"
+    "云南省/怒江傈僳族自治州/贡山独龙族怒族自治县\0"
+    "云南/怒江/贡山\0"
+    "Gongshan\0"
+    "云南省/怒江傈僳族自治州/兰坪白族普米族自治县\0"
+    "云南/怒江/兰坪\0"
+    "Lanping\0"
+    "云南省/迪庆藏族自治州\0"
+    "云南/云南/迪庆\0"
+    "Diqing\0"
+    "云南省/迪庆藏族自治州/香格里拉市\0"
+    "云南/迪庆/香格里拉\0"
+    "Xianggelila\0"
+    "云南省/迪庆藏族自治州/德钦县\0"
+    "云南/迪庆/德钦\0"
+    "Deqin\0"
+    "云南省/迪庆藏族自治州/维西傈僳族自治县\0"
+    "云南/迪庆/维西\0"
+    "Weixi\0"
+    "西藏自治区/拉萨市\0"
+    "西藏/拉萨/拉萨\0"
+    "Lasa\0"
+    "西藏自治区/拉萨市/城关区\0"
+    "西藏/拉萨/城关\0"
+    "Chengguan\0"
+    "西藏自治区/拉萨市/堆龙德庆区\0"
+    "西藏/拉萨/堆龙德庆\0"
+    "Duilongdeqing\0"
+    "西藏自治区/拉萨市/达孜区\0"
+    "西藏/拉萨/达孜\0"
+    "Dazi\0"
+    "西藏自治区/拉萨市/林周县\0"
+    "西藏/拉萨/林周\0"
+    "西藏自治区/拉萨市/当雄县\0"
+    "西藏/拉萨/当雄\0"
+    "Dangxiong\0"
+    "西藏自治区/拉萨市/尼木县\0"
+    "西藏/拉萨/尼木\0"
+    "Nimu\0"
+    "西藏自治区/拉萨市/曲水县\0"
+    "西藏/拉萨/曲水\0"
+    "Qushui\0"
+    "西藏自治区/拉萨市/墨竹工卡县\0"
+    "西藏/拉萨/墨竹工卡\0"
+    "Mozhugongka\0"
+    "西藏自治区/日喀则市\0"
+    "西藏/日喀则/日喀则\0"
+    "Rikaze\0"
+    "西藏自治区/日喀则市/桑珠孜区\0"
+    "西藏/日喀则/桑珠孜\0"
+    "Sangzhuzi\0"
+    "西藏自治区/日喀则市/南木林县\0"
+    "西藏/日喀则/南木林\0"
+    "Nanmulin\0"
+    "西藏自治区/日喀则市/江孜县\0"
+    "西藏/日喀则/江孜\0"
+    "Jiangzi\0"
+    "西藏自治区/日喀则市/定日县\0"
+    "西藏/日喀则/定日\0"
+    "Dingri\0"
+    "西藏自治区/日喀则市/萨迦县\0"
+    "西藏/日喀则/萨迦\0"
+    "Sajia\0"
+    "西藏自治区/日喀则市/拉孜县\0"
+    "西藏/日喀则/拉孜\0"
+    "Lazi\0"
+    "西藏自治区/日喀则市/昂仁县\0"
+    "西藏/日喀则/昂仁\0"
+    "Angren\0"
+    "西藏自治区/日喀则市/谢通门县\0"
+    "西藏/日喀则/谢通门\0"
+    "Xietongmen\0"
+    "西藏自治区/日喀则市/白朗县\0"
+    "西藏/日喀则/白朗\0"
+    "Bailang\0"
+    "西藏自治区/日喀则市/仁布县\0"
+    "西藏/日喀则/仁布\0"
+    "Renbu\0"
+    "西藏自治区/日喀则市/康马县\0"
+    "西藏/日喀则/康马\0"
+    "Kangma\0"
+    "西藏自治区/日喀则市/定结县\0"
+    "西藏/日喀则/定结\0"
+    "Dingjie\0"
+    "西藏自治区/日喀则市/仲巴县\0"
+    "西藏/日喀则/仲巴\0"
+    "Zhongba\0"
+    "西藏自治区/日喀则市/亚东县\0"
+    "西藏/日喀则/亚东\0"
+    "Yadong\0"
+    "西藏自治区/日喀则市/吉隆县\0"
+    "西藏/日喀则/吉隆\0"
+    "Jilong\0"
+    "西藏自治区/日喀则市/聂拉木县\0"
+    "西藏/日喀则/聂拉木\0"
+    "Nielamu\0"
+    "西藏自治区/日喀则市/萨嘎县\0"
+    "西藏/日喀则/萨嘎\0"
+    "Saga\0"
+    "西藏自治区/日喀则市/岗巴县\0"
+    "西藏/日喀则/岗巴\0"
+    "Gangba\0"
+    "西藏自治区/昌都市\0"
+    "西藏/昌都/昌都\0"
+    "Changdu\0"
+    "西藏自治区/昌都市/卡若区\0"
+    "西藏/昌都/卡若\0"
+    "Karuo\0"
+    "西藏自治区/昌都市/江达县\0"
+    "西藏/昌都/江达\0"
+    "Jiangda\0"
+    "西藏自治区/昌都市/贡觉县\0"
+    "西藏/昌都/贡觉\0"
+    "Gongjue\0"
+    "西藏自治区/昌都市/类乌齐县\0"
+    "西藏/昌都/类乌齐\0"
+    "Leiwuqi\0"
+    "西藏自治区/昌都市/丁青县\0"
+    "西藏/昌都/丁青\0"
+    "Dingqing\0"
+    "西藏自治区/昌都市/察雅县\0"
+    "西藏/昌都/察雅\0"
+    "Chaya\0"
+    "西藏自治区/昌都市/八宿县\0"
+    "西藏/昌都/八宿\0"
+    "Basu\0"
+    "西藏自治区/昌都市/左贡县\0"
+    "西藏/昌都/左贡\0"
+    "Zuogong\0"
+    "西藏自治区/昌都市/芒康县\0"
+    "西藏/昌都/芒康\0"
+    "Mangkang\0"
+    "西藏自治区/昌都市/洛隆县\0"
+    "西藏/昌都/洛隆\0"
+    "西藏自治区/昌都市/边坝县\0"
+    "西藏/昌都/边坝\0"
+    "Bianba\0"
+    "西藏自治区/林芝市\0"
+    "西藏/林芝/林芝\0"
+    "Linzhi\0"
+    "西藏自治区/林芝市/巴宜区\0"
+    "西藏/林芝/巴宜\0"
+    "Bayi\0"
+    "西藏自治区/林芝市/工布江达县\0"
+    "西藏/林芝/工布江达\0"
+    "Gongbujiangda\0"
+    "西藏自治区/林芝市/米林县\0"
+    "西藏/林芝/米林\0"
+    "Milin\0"
+    "西藏自治区/林芝市/墨脱县\0"
+    "西藏/林芝/墨脱\0"
+    "Motuo\0"
+    "西藏自治区/林芝市/波密县\0"
+    "西藏/林芝/波密\0"
+    "Bomi\0"
+    "西藏自治区/林芝市/察隅县\0"
+    "西藏/林芝/察隅\0"
+    "Chayu\0"
+    "西藏自治区/林芝市/朗县\0"
+    "西藏/林芝/朗县\0"
+    "Langxian\0"
+    "西藏自治区/山南市\0"
+    "西藏/山南/山南\0"
+    "Shannan\0"
+    "西藏自治区/山南市/乃东区\0"
+    "西藏/山南/乃东\0"
+    "Naidong\0"
+    "西藏自治区/山南市/扎囊县\0"
+    "西藏/山南/札囊\0"
+    "Zhanang\0"
+    "西藏自治区/山南市/贡嘎县\0"
+    "西藏/山南/贡嘎\0"
+    "Gongga\0"
+    "西藏自治区/山南市/桑日县\0"
+    "西藏/山南/桑日\0"
+    "Sangri\0"
+    "西藏自治区/山南市/琼结县\0"
+    "西藏/山南/琼结\0"
+    "Qiongjie\0"
+    "西藏自治区/山南市/曲松县\0"
+    "西藏/山南/曲松\0"
+    "Qusong\0"
+    "西藏自治区/山南市/措美县\0"
+    "西藏/山南/措美\0"
+    "Cuomei\0"
+    "西藏自治区/山南市/洛扎县\0"
+    "西藏/山南/洛扎\0"
+    "Luozha\0"
+    "西藏自治区/山南市/加查县\0"
+    "西藏/山南/加查\0"
+    "Jiacha\0"
+    "西藏自治区/山南市/隆子县\0"
+    "西藏/山南/隆子\0"
+    "Longzi\0"
+    "西藏自治区/山南市/错那县\0"
+    "西藏/山南/错那\0"
+    "Cuona\0"
+    "西藏自治区/山南市/浪卡子县\0"
+    "西藏/山南/浪卡子\0"
+    "Langkazi\0"
+    "西藏自治区/那曲市\0"
+    "西藏/那曲/那曲\0"
+    "Naqu\0"
+    "西藏自治区/那曲市/色尼区\0"
+    "西藏/那曲/色尼\0"
+    "Seni\0"
+    "西藏自治区/那曲市/嘉黎县\0"
+    "西藏/那曲/嘉黎\0"
+    "Jiali\0"
+    "西藏自治区/那曲市/比如县\0"
+    "西藏/那曲/比如\0"
+    "Biru\0"
+    "西藏自治区/那曲市/聂荣县\0"
+    "西藏/那曲/聂荣\0"
+    "Nierong\0"
+    "西藏自治区/那曲市/安多县\0"
+    "西藏/那曲/安多\0"
+    "Anduo\0"
+    "西藏自治区/那曲市/申扎县\0"
+    "西藏/那曲/申扎\0"
+    "Shenzha\0"
+    "西藏自治区/那曲市/索县\0"
+    "西藏/那曲/索县\0"
+    "Suoxian\0"
+    "西藏自治区/那曲市/班戈县\0"
+    "西藏/那曲/班戈\0"
+    "Bange\0"
+    "西藏自治区/那曲市/巴青县\0"
+    "西藏/那曲/巴青\0"
+    "Baqing\0"
+    "西藏自治区/那曲市/尼玛县\0"
+    "西藏/那曲/尼玛\0"
+    "Nima\0"
+    "西藏自治区/那曲市/双湖县\0"
+    "西藏/那曲/双湖\0"
+    "Shuanghu\0"
+    "西藏自治区/阿里地区\0"
+    "西藏/阿里/阿里\0"
+    "Ali\0"
+    "西藏自治区/阿里地区/普兰县\0"
+    "西藏/阿里/普兰\0"
+    "Pulan\0"
+    "西藏自治区/阿里地区/札达县\0"
+    "西藏/阿里/札达\0"
+    "Zhada\0"
+    "西藏自治区/阿里地区/噶尔县\0"
+    "西藏/阿里/噶尔\0"
+    "Gaer\0"
+    "西藏自治区/阿里地区/日土县\0"
+    "西藏/阿里/日土\0"
+    "Ritu\0"
+    "西藏自治区/阿里地区/革吉县\0"
+    "西藏/阿里/革吉\0"
+    "Geji\0"
+    "西藏自治区/阿里地区/改则县\0"
+    "西藏/阿里/改则\0"
+    "Gaize\0"
+    "西藏自治区/阿里地区/措勤县\0"
+    "西藏/阿里/措勤\0"
+    "Cuoqin\0"
+    "陕西省/西安市\0"
+    "陕西/西安/西安\0"
+    "陕西省/西安市/新城区\0"
+    "陕西/西安/新城\0"
+    "陕西省/西安市/碑林区\0"
+    "陕西/西安/碑林\0"
+    "陕西省/西安市/莲湖区\0"
+    "陕西/西安/莲湖\0"
+    "Lianhu\0"
+    "陕西省/西安市/灞桥区\0"
+    "陕西/西安/灞桥\0"
+    "Baqiao\0"
+    "陕西省/西安市/未央区\0"
+    "陕西/西安/未央\0"
+    "Weiyang\0"
+    "陕西省/西安市/雁塔区\0"
+    "陕西/西安/雁塔\0"
+    "Yanta\0"
+    "陕西省/西安市/阎良区\0"
+    "陕西/西安/阎良\0"
+    "Yanliang\0"
+    "陕西省/西安市/临潼区\0"
+    "陕西/西安/临潼\0"
+    "Lintong\0"
+    "陕西省/西安市/长安区\0"
+    "陕西/西安/长安\0"
+    "陕西省/西安市/高陵区\0"
+    "陕西/西安/高陵\0"
+    "Gaoling\0"
+    "陕西省/西安市/鄠邑区\0"
+    "陕西/西安/鄠邑\0"
+    "Huxian\0"
+    "陕西省/西安市/蓝田县\0"
+    "陕西/西安/蓝田\0"
+    "Lantian\0"
+    "陕西省/西安市/周至县\0"
+    "陕西/西安/周至\0"
+    "Zhouzhi\0"
+    "陕西省/铜川市\0"
+    "陕西/铜川/铜川\0"
+    "陕西省/铜川市/王益区\0"
+    "陕西/铜川/王益\0"
+    "Wangyi\0"
+    "陕西省/铜川市/印台区\0"
+    "陕西/铜川/印台\0"
+    "Yintai\0"
+    "陕西省/铜川市/耀州区\0"
+    "陕西/铜川/耀州\0"
+    "Yaozhou\0"
+    "陕西省/铜川市/宜君县\0"
+    "陕西/铜川/宜君\0"
+    "Yijun\0"
+    "陕西省/宝鸡市\0"
+    "陕西/宝鸡/宝鸡\0"
+    "Baoji\0"
+    "陕西省/宝鸡市/渭滨区\0"
+    "陕西/宝鸡/渭滨\0"
+    "陕西省/宝鸡市/金台区\0"
+    "陕西/宝鸡/金台\0"
+    "Jintai\0"
+    "陕西省/宝鸡市/陈仓区\0"
+    "陕西/宝鸡/陈仓\0"
+    "Chencang\0"
+    "陕西省/宝鸡市/凤翔县\0"
+    "陕西/宝鸡/凤翔\0"
+    "Fengxiang\0"
+    "陕西省/宝鸡市/岐山县\0"
+    "陕西/宝鸡/岐山\0"
+    "Qishan\0"
+    "陕西省/宝鸡市/扶风县\0"
+    "陕西/宝鸡/扶风\0"
+    "Fufeng\0"
+    "陕西省/宝鸡市/眉县\0"
+    "陕西/宝鸡/眉县\0"
+    "陕西省/宝鸡市/陇县\0"
+    "陕西/宝鸡/陇县\0"
+    "Longxian\0"
+    "陕西省/宝鸡市/千阳县\0"
+    "陕西/宝鸡/千阳\0"
+    "Qianyang\0"
+    "陕西省/宝鸡市/麟游县\0"
+    "陕西/宝鸡/麟游\0"
+    "Linyou\0"
+    "陕西省/宝鸡市/凤县\0"
+    "陕西/宝鸡/凤县\0"
+    "陕西省/宝鸡市/太白县\0"
+    "陕西/宝鸡/太白\0"
+    "Taibai\0"
+    "陕西省/咸阳市\0"
+    "陕西/咸阳/咸阳\0"
+    "Xianyang\0"
+    "陕西省/咸阳市/秦都区\0"
+    "陕西/咸阳/秦都\0"
+    "Qindou\0"
+    "陕西省/咸阳市/杨陵区\0"
+    "陕西/咸阳/杨陵\0"
+    "Yangling\0"
+    "陕西省/咸阳市/渭城区\0"
+    "陕西/咸阳/渭城\0"
+    "陕西省/咸阳市/三原县\0"
+    "陕西/咸阳/三原\0"
+    "陕西省/咸阳市/泾阳县\0"
+    "陕西/咸阳/泾阳\0"
+    "陕西省/咸阳市/乾县\0"
+    "陕西/咸阳/乾县\0"
+    "Qianxian\0"
+    "陕西省/咸阳市/礼泉县\0"
+    "陕西/咸阳/礼泉\0"
+    "Liquan\0"
+    "陕西省/咸阳市/永寿县\0"
+    "陕西/咸阳/永寿\0"
+    "Yongshou\0"
+    "陕西省/咸阳市/长武县\0"
+    "陕西/咸阳/长武\0"
+    "Changwu\0"
+    "陕西省/咸阳市/旬邑县\0"
+    "陕西/咸阳/旬邑\0"
+    "Xunyi\0"
+    "陕西省/咸阳市/淳化县\0"
+    "陕西/咸阳/淳化\0"
+    "Chunhua\0"
+    "陕西省/咸阳市/武功县\0"
+    "陕西/咸阳/武功\0"
+    "Wugong\0"
+    "陕西省/咸阳市/兴平市\0"
+    "陕西/咸阳/兴平\0"
+    "Xingping\0"
+    "陕西省/咸阳市/彬州市\0"
+    "陕西/咸阳/彬州\0"
+    "陕西省/渭南市\0"
+    "陕西/渭南/渭南\0"
+    "Weinan\0"
+    "陕西省/渭南市/临渭区\0"
+    "陕西/渭南/临渭\0"
+    "Linwei\0"
+    "陕西省/渭南市/华州区\0"
+    "陕西/渭南/华州\0"
+    "陕西省/渭南市/潼关县\0"
+    "陕西/渭南/潼关\0"
+    "陕西省/渭南市/大荔县\0"
+    "陕西/渭南/大荔\0"
+    "陕西省/渭南市/合阳县\0"
+    "陕西/渭南/合阳\0"
+    "Heyang\0"
+    "陕西省/渭南市/澄城县\0"
+    "陕西/渭南/澄城\0"
+    "Chengcheng\0"
+    "陕西省/渭南市/蒲城县\0"
+    "陕西/渭南/蒲城\0"
+    "陕西省/渭南市/白水县\0"
+    "陕西/渭南/白水\0"
+    "Baishui\0"
+    "陕西省/渭南市/富平县\0"
+    "陕西/渭南/富平\0"
+    "陕西省/渭南市/韩城市\0"
+    "陕西/渭南/韩城\0"
+    "Hancheng\0"
+    "陕西省/渭南市/华阴市\0"
+    "陕西/渭南/华阴\0"
+    "Huayin\0"
+    "陕西省/延安市\0"
+    "陕西/延安/延安\0"
+    "Yanan\0"
+    "陕西省/延安市/宝塔区\0"
+    "陕西/延安/宝塔\0"
+    "Baota\0"
+    "陕西省/延安市/安塞区\0"
+    "陕西/延安/安塞\0"
+    "Ansai\0"
+    "陕西省/延安市/延长县\0"
+    "陕西/延安/延长\0"
+    "Yanchang\0"
+    "陕西省/延安市/延川县\0"
+    "陕西/延安/延川\0"
+    "Yanchuan\0"
+    "陕西省/延安市/子长县\0"
+    "陕西/延安/子长\0"
+    "Zichang\0"
+    "陕西省/延安市/志丹县\0"
+    "陕西/延安/志丹\0"
+    "Zhidan\0"
+    "陕西省/延安市/吴起县\0"
+    "陕西/延安/吴起\0"
+    "Wuqi\0"
+    "陕西省/延安市/甘泉县\0"
+    "陕西/延安/甘泉\0"
+    "Ganquan\0"
+    "陕西省/延安市/富县\0"
+    "陕西/延安/富县\0"
+    "Fuxian\0"
+    "陕西省/延安市/洛川县\0"
+    "陕西/延安/洛川\0"
+    "Luochuan\0"
+    "陕西省/延安市/宜川县\0"
+    "陕西/延安/宜川\0"
+    "陕西省/延安市/黄龙县\0"
+    "陕西/延安/黄龙\0"
+    "Huanglong\0"
+    "陕西省/延安市/黄陵县\0"
+    "陕西/延安/黄陵\0"
+    "Huangling\0"
+    "陕西省/汉中市\0"
+    "陕西/汉中/汉中\0"
+    "Hanzhong\0"
+    "陕西省/汉中市/汉台区\0"
+    "陕西/汉中/汉台\0"
+    "Hantai\0"
+    "陕西省/汉中市/南郑区\0"
+    "陕西/汉中/南郑\0"
+    "Nanzheng\0"
+    "陕西省/汉中市/城固县\0"
+    "陕西/汉中/城固\0"
+    "Chenggu\0"
+    "陕西省/汉中市/洋县\0"
+    "陕西/汉中/洋县\0"
+    "Yangxian\0"
+    "陕西省/汉中市/西乡县\0"
+    "陕西/汉中/西乡\0"
+    "Xixiang\0"
+    "陕西省/汉中市/勉县\0"
+    "陕西/汉中/勉县\0"
+    "Mianxian\0"
+    "陕西省/汉中市/宁强县\0"
+    "陕西/汉中/宁强\0"
+    "Ningqiang\0"
+    "陕西省/汉中市/略阳县\0"
+    "陕西/汉中/略阳\0"
+    "Lueyang\0"
+    "陕西省/汉中市/镇巴县\0"
+    "陕西/汉中/镇巴\0"
+    "Zhenba\0"
+    "陕西省/汉中市/留坝县\0"
+    "陕西/汉中/留坝\0"
+    "Liuba\0"
+    "陕西省/汉中市/佛坪县\0"
+    "陕西/汉中/佛坪\0"
+    "Fuoping\0"
+    "陕西省/榆林市\0"
+    "陕西/榆林/榆林\0"
+    "陕西省/榆林市/榆阳区\0"
+    "陕西/榆林/榆阳\0"
+    "Yuyang\0"
+    "陕西省/榆林市/横山区\0"
+    "陕西/榆林/横山\0"
+    "陕西省/榆林市/府谷县\0"
+    "陕西/榆林/府谷\0"
+    "Fugu\0"
+    "陕西省/榆林市/靖边县\0"
+    "陕西/榆林/靖边\0"
+    "Jingbian\0"
+    "陕西省/榆林市/定边县\0"
+    "陕西/榆林/定边\0"
+    "Dingbian\0"
+    "陕西省/榆林市/绥德县\0"
+    "陕西/榆林/绥德\0"
+    "Suide\0"
+    "陕西省/榆林市/米脂县\0"
+    "陕西/榆林/米脂\0"
+    "Mizhi\0"
+    "陕西省/榆林市/佳县\0"
+    "陕西/榆林/佳县\0"
+    "陕西省/榆林市/吴堡县\0"
+    "陕西/榆林/吴堡\0"
+    "Wubu\0"
+    "陕西省/榆林市/清涧县\0"
+    "陕西/榆林/清涧\0"
+    "Qingjian\0"
+    "陕西省/榆林市/子洲县\0"
+    "陕西/榆林/子洲\0"
+    "Zizhou\0"
+    "陕西省/榆林市/神木市\0"
+    "陕西/榆林/神木\0"
+    "Shenmu\0"
+    "陕西省/安康市\0"
+    "陕西/安康/安康\0"
+    "Ankang\0"
+    "陕西省/安康市/汉滨区\0"
+    "陕西/安康/汉滨\0"
+    "Hanbin\0"
+    "陕西省/安康市/汉阴县\0"
+    "陕西/安康/汉阴\0"
+    "Hanyin\0"
+    "陕西省/安康市/石泉县\0"
+    "陕西/安康/石泉\0"
+    "Shiquan\0"
+    "陕西省/安康市/宁陕县\0"
+    "陕西/安康/宁陕\0"
+    "Ningshan\0"
+    "陕西省/安康市/紫阳县\0"
+    "陕西/安康/紫阳\0"
+    "陕西省/安康市/岚皋县\0"
+    "陕西/安康/岚皋\0"
+    "Langao\0"
+    "陕西省/安康市/平利县\0"
+    "陕西/安康/平利\0"
+    "Pingli\0"
+    "陕西省/安康市/镇坪县\0"
+    "陕西/安康/镇坪\0"
+    "陕西省/安康市/旬阳县\0"
+    "陕西/安康/旬阳\0"
+    "陕西省/安康市/白河县\0"
+    "陕西/安康/白河\0"
+    "Baihe\0"
+    "陕西省/商洛市\0"
+    "陕西/商洛/商洛\0"
+    "Shangluo\0"
+    "陕西省/商洛市/商州区\0"
+    "陕西/商洛/商州\0"
+    "Shangzhou\0"
+    "陕西省/商洛市/洛南县\0"
+    "陕西/商洛/洛南\0"
+    "Luonan\0"
+    "陕西省/商洛市/丹凤县\0"
+    "陕西/商洛/丹凤\0"
+    "Danfeng\0"
+    "陕西省/商洛市/商南县\0"
+    "陕西/商洛/商南\0"
+    "Shangnan\0"
+    "陕西省/商洛市/山阳县\0"
+    "陕西/商洛/山阳\0"
+    "陕西省/商洛市/镇安县\0"
+    "陕西/商洛/镇安\0"
+    "陕西省/商洛市/柞水县\0"
+    "陕西/商洛/柞水\0"
+    "Zhashui\0"
+    "甘肃省/兰州市\0"
+    "甘肃/兰州/兰州\0"
+    "Lanzhou\0"
+    "甘肃省/兰州市/城关区\0"
+    "甘肃/兰州/城关\0"
+    "甘肃省/兰州市/七里河区\0"
+    "甘肃/兰州/七里河\0"
+    "Qilihe\0"
+    "甘肃省/兰州市/西固区\0"
+    "甘肃/兰州/西固\0"
+    "Xigu\0"
+    "甘肃省/兰州市/安宁区\0"
+    "甘肃/兰州/安宁\0"
+    "甘肃省/兰州市/红古区\0"
+    "甘肃/兰州/红古\0"
+    "Honggu\0"
+    "甘肃省/兰州市/永登县\0"
+    "甘肃/兰州/永登\0"
+    "Yongdeng\0"
+    "甘肃省/兰州市/皋兰县\0"
+    "甘肃/兰州/皋兰\0"
+    "Gaolan\0"
+    "甘肃省/兰州市/榆中县\0"
+    "甘肃/兰州/榆中\0"
+    "甘肃省/嘉峪关市\0"
+    "甘肃/嘉峪关/嘉峪关\0"
+    "Jiayuguan\0"
+    "甘肃省/金昌市\0"
+    "甘肃/金昌/金昌\0"
+    "Jinchang\0"
+    "甘肃省/金昌市/金川区\0"
+    "甘肃/金昌/金川\0"
+    "甘肃省/金昌市/永昌县\0"
+    "甘肃/金昌/永昌\0"
+    "Yongchang\0"
+    "甘肃省/白银市\0"
+    "甘肃/白银\0"
+    "Baiyin\0"
+    "甘肃省/白银市/白银区\0"
+    "甘肃/白银/白银\0"
+    "甘肃省/白银市/平川区\0"
+    "甘肃/白银/平川\0"
+    "Pingchuan\0"
+    "甘肃省/白银市/靖远县\0"
+    "甘肃/白银/靖远\0"
+    "Jingyuan\0"
+    "甘肃省/白银市/会宁县\0"
+    "甘肃/白银/会宁\0"
+    "Huining\0"
+    "甘肃省/白银市/景泰县\0"
+    "甘肃/白银/景泰\0"
+    "Jingtai\0"
+    "甘肃省/天水市\0"
+    "甘肃/天水/天水\0"
+    "Tianshui\0"
+    "甘肃省/天水市/秦州区\0"
+    "甘肃/天水/秦州\0"
+    "甘肃省/天水市/麦积区\0"
+    "甘肃/天水/麦积\0"
+    "Maiji\0"
+    "甘肃省/天水市/清水县\0"
+    "甘肃/天水/清水\0"
+    "Qingshui\0"
+    "甘肃省/天水市/秦安县\0"
+    "甘肃/天水/秦安\0"
+    "Qinan\0"
+    "甘肃省/天水市/甘谷县\0"
+    "甘肃/天水/甘谷\0"
+    "Gangu\0"
+    "甘肃省/天水市/武山县\0"
+    "甘肃/天水/武山\0"
+    "甘肃省/天水市/张家川回族自治县\0"
+    "甘肃/天水/张家川\0"
+    "Zhangjiachuan\0"
+    "甘肃省/武威市\0"
+    "甘肃/武威/武威\0"
+    "甘肃省/武威市/凉州区\0"
+    "甘肃/武威/凉州\0"
+    "Liangzhou\0"
+    "甘肃省/武威市/民勤县\0"
+    "甘肃/武威/民勤\0"
+    "Minqin\0"
+    "甘肃省/武威市/古浪县\0"
+    "甘肃/武威/古浪\0"
+    "Gulang\0"
+    "甘肃省/武威市/天祝藏族自治县\0"
+    "甘肃/武威/天祝\0"
+    "甘肃省/张掖市\0"
+    "甘肃/张掖/张掖\0"
+    "Zhangye\0"
+    "甘肃省/张掖市/甘州区\0"
+    "甘肃/张掖/甘州\0"
+    "甘肃省/张掖市/肃南裕固族自治县\0"
+    "甘肃/张掖/肃南\0"
+    "Sunan\0"
+    "甘肃省/张掖市/民乐县\0"
+    "甘肃/张掖/民乐\0"
+    "Minle\0"
+    "甘肃省/张掖市/临泽县\0"
+    "甘肃/张掖/临泽\0"
+    "Linze\0"
+    "甘肃省/张掖市/高台县\0"
+    "甘肃/张掖/高台\0"
+    "Gaotai\0"
+    "甘肃省/张掖市/山丹县\0"
+    "甘肃/张掖/山丹\0"
+    "Shandan\0"
+    "甘肃省/平凉市\0"
+    "甘肃/平凉/平凉\0"
+    "Pingliang\0"
+    "甘肃省/平凉市/崆峒区\0"
+    "甘肃/平凉/崆峒\0"
+    "Kongtong\0"
+    "甘肃省/平凉市/泾川县\0"
+    "甘肃/平凉/泾川\0"
+    "Jingchuan\0"
+    "甘肃省/平凉市/灵台县\0"
+    "甘肃/平凉/灵台\0"
+    "Lingtai\0"
+    "甘肃省/平凉市/崇信县\0"
+    "甘肃/平凉/崇信\0"
+    "Chongxin\0"
+    "甘肃省/平凉市/庄浪县\0"
+    "甘肃/平凉/庄浪\0"
+    "Zhuanglang\0"
+    "甘肃省/平凉市/静宁县\0"
+    "甘肃/平凉/静宁\0"
+    "甘肃省/平凉市/华亭市\0"
+    "甘肃/平凉/华亭\0"
+    "Huating\0"
+    "甘肃省/酒泉市\0"
+    "甘肃/酒泉/酒泉\0"
+    "Jiuquan\0"
+    "甘肃省/酒泉市/肃州区\0"
+    "甘肃/酒泉/肃州\0"
+    "甘肃省/酒泉市/金塔县\0"
+    "甘肃/酒泉/金塔\0"
+    "Jinta\0"
+    "甘肃省/酒泉市/瓜州县\0"
+    "甘肃/酒泉/瓜州\0"
+    "Guazhou\0"
+    "甘肃省/酒泉市/肃北蒙古族自治县\0"
+    "甘肃/酒泉/肃北\0"
+    "Subei\0"
+    "甘肃省/酒泉市/阿克塞哈萨克族自治县\0"
+    "甘肃/酒泉/阿克塞\0"
+    "Akesai\0"
+    "甘肃省/酒泉市/玉门市\0"
+    "甘肃/酒泉/玉门\0"
+    "Yumen\0"
+    "甘肃省/酒泉市/敦煌市\0"
+    "甘肃/酒泉/敦煌\0"
+    "Dunhuang\0"
+    "甘肃省/庆阳市\0"
+    "甘肃/庆阳/庆阳\0"
+    "甘肃省/庆阳市/西峰区\0"
+    "甘肃/庆阳/西峰\0"
+    "甘肃省/庆阳市/庆城县\0"
+    "甘肃/庆阳/庆城\0"
+    "甘肃省/庆阳市/环县\0"
+    "甘肃/庆阳/环县\0"
+    "Huanxian\0"
+    "甘肃省/庆阳市/华池县\0"
+    "甘肃/庆阳/华池\0"
+    "Huachi\0"
+    "甘肃省/庆阳市/合水县\0"
+    "甘肃/庆阳/合水\0"
+    "Heshui\0"
+    "甘肃省/庆阳市/正宁县\0"
+    "甘肃/庆阳/正宁\0"
+    "Zhengning\0"
+    "甘肃省/庆阳市/宁县\0"
+    "甘肃/庆阳/宁县\0"
+    "Ningxian\0"
+    "甘肃省/庆阳市/镇原县\0"
+    "甘肃/庆阳/镇原\0"
+    "甘肃省/定西市\0"
+    "甘肃/定西/定西\0"
+    "Dingxi\0"
+    "甘肃省/定西市/安定区\0"
+    "甘肃/定西/安定\0"
+    "Anding\0"
+    "甘肃省/定西市/通渭县\0"
+    "甘肃/定西/通渭\0"
+    "Tongwei\0"
+    "甘肃省/定西市/陇西县\0"
+    "甘肃/定西/陇西\0"
+    "Longxi\0"
+    "甘肃省/定西市/渭源县\0"
+    "甘肃/定西/渭源\0"
+    "甘肃省/定西市/临洮县\0"
+    "甘肃/定西/临洮\0"
+    "Lintao\0"
+    "甘肃省/定西市/漳县\0"
+    "甘肃/定西/漳县\0"
+    "Zhangxian\0"
+    "甘肃省/定西市/岷县\0"
+    "甘肃/定西/岷县\0"
+    "Minxian\0"
+    "甘肃省/陇南市\0"
+    "甘肃/甘肃/陇南\0"
+    "甘肃省/陇南市/武都区\0"
+    "甘肃/陇南/武都\0"
+    "Wudu\0"
+    "甘肃省/陇南市/成县\0"
+    "甘肃/陇南/成县\0"
+    "Chengxian\0"
+    "甘肃省/陇南市/文县\0"
+    "甘肃/陇南/文县\0"
+    "甘肃省/陇南市/宕昌县\0"
+    "甘肃/陇南/宕昌\0"
+    "Dangchang\0"
+    "甘肃省/陇南市/康县\0"
+    "甘肃/陇南/康县\0"
+    "Kangxian\0"
+    "甘肃省/陇南市/西和县\0"
+    "甘肃/陇南/西和\0"
+    "甘肃省/陇南市/礼县\0"
+    "甘肃/陇南/礼县\0"
+    "甘肃省/陇南市/徽县\0"
+    "甘肃/陇南/徽县\0"
+    "甘肃省/陇南市/两当县\0"
+    "甘肃/陇南/两当\0"
+    "Liangdang\0"
+    "甘肃省/临夏回族自治州\0"
+    "甘肃/临夏\0"
+    "Linxia\0"
+    "甘肃省/临夏回族自治州/临夏县\0"
+    "甘肃/临夏/临夏\0"
+    "甘肃省/临夏回族自治州/康乐县\0"
+    "甘肃/临夏/康乐\0"
+    "Kangle\0"
+    "甘肃省/临夏回族自治州/永靖县\0"
+    "甘肃/临夏/永靖\0"
+    "Yongjing\0"
+    "甘肃省/临夏回族自治州/广河县\0"
+    "甘肃/临夏/广河\0"
+    "Guanghe\0"
+    "甘肃省/临夏回族自治州/和政县\0"
+    "甘肃/临夏/和政\0"
+    "Hezheng\0"
+    "甘肃省/临夏回族自治州/东乡族自治县\0"
+    "甘肃/临夏/东乡\0"
+    "甘肃省/临夏回族自治州/积石山保安族东乡族撒拉族自治县\0"
+    "甘肃/临夏/积石山\0"
+    "Jishishan\0"
+    "甘肃省/甘南藏族自治州\0"
+    "甘肃/甘肃/甘南\0"
+    "甘肃省/甘南藏族自治州/合作市\0"
+    "甘肃/甘南/合作\0"
+    "Hezuo\0"
+    "甘肃省/甘南藏族自治州/临潭县\0"
+    "甘肃/甘南/临潭\0"
+    "Lintan\0"
+    "甘肃省/甘南藏族自治州/卓尼县\0"
+    "甘肃/甘南/卓尼\0"
+    "Zhuoni\0"
+    "甘肃省/甘南藏族自治州/舟曲县\0"
+    "甘肃/甘南/舟曲\0"
+    "Zhouqu\0"
+    "甘肃省/甘南藏族自治州/迭部县\0"
+    "甘肃/甘南/迭部\0"
+    "Diebu\0"
+    "甘肃省/甘南藏族自治州/玛曲县\0"
+    "甘肃/甘南/玛曲\0"
+    "Maqu\0"
+    "甘肃省/甘南藏族自治州/碌曲县\0"
+    "甘肃/甘南/碌曲\0"
+    "Luqu\0"
+    "甘肃省/甘南藏族自治州/夏河县\0"
+    "甘肃/甘南/夏河\0"
+    "Xiahe\0"
+    "青海省/西宁市\0"
+    "青海/西宁/西宁\0"
+    "Xining\0"
+    "青海省/西宁市/城东区\0"
+    "青海/西宁/城东\0"
+    "Chengdong\0"
+    "青海省/西宁市/城中区\0"
+    "青海/西宁/城中\0"
+    "青海省/西宁市/城西区\0"
+    "青海/西宁/城西\0"
+    "Chengxi\0"
+    "青海省/西宁市/城北区\0"
+    "青海/西宁/城北\0"
+    "Chengbei\0"
+    "青海省/西宁市/大通回族土族自治县\0"
+    "青海/西宁/大通\0"
+    "青海省/西宁市/湟中县\0"
+    "青海/西宁/湟中\0"
+    "Huangzhong\0"
+    "青海省/西宁市/湟源县\0"
+    "青海/西宁/湟源\0"
+    "Huangyuan\0"
+    "青海省/海东市\0"
+    "青海/海东/海东\0"
+    "Haidong\0"
+    "青海省/海东市/乐都区\0"
+    "青海/海东/乐都\0"
+    "Ledu\0"
+    "青海省/海东市/平安区\0"
+    "青海/海东/平安\0"
+    "Pingan\0"
+    "青海省/海东市/民和回族土族自治县\0"
+    "青海/海东/民和\0"
+    "Minhe\0"
+    "青海省/海东市/互助土族自治县\0"
+    "青海/海东/互助\0"
+    "Huzhu\0"
+    "青海省/海东市/化隆回族自治县\0"
+    "青海/海东/化隆\0"
+    "青海省/海东市/循化撒拉族自治县\0"
+    "青海/海东/循化\0"
+    "Xunhua\0"
+    "青海省/海北藏族自治州\0"
+    "青海/海北/海北\0"
+    "Haibei\0"
+    "青海省/海北藏族自治州/门源回族自治县\0"
+    "青海/海北/门源\0"
+    "Menyuan\0"
+    "青海省/海北藏族自治州/祁连县\0"
+    "青海/海北/祁连\0"
+    "Qilian\0"
+    "青海省/海北藏族自治州/海晏县\0"
+    "青海/海北/海晏\0"
+    "青海省/海北藏族自治州/刚察县\0"
+    "青海/海北/刚察\0"
+    "Gangcha\0"
+    "青海省/黄南藏族自治州\0"
+    "青海/黄南/黄南\0"
+    "Huangnan\0"
+    "青海省/黄南藏族自治州/同仁县\0"
+    "青海/黄南/同仁\0"
+    "青海省/黄南藏族自治州/尖扎县\0"
+    "青海/黄南/尖扎\0"
+    "Jianzha\0"
+    "青海省/黄南藏族自治州/泽库县\0"
+    "青海/黄南/泽库\0"
+    "Zeku\0"
+    "青海省/黄南藏族自治州/河南蒙古族自治县\0"
+    "青海/黄南/河南\0"
+    "Henan\0"
+    "青海省/海南藏族自治州\0"
+    "青海/海南/海南\0"
+    "青海省/海南藏族自治州/共和县\0"
+    "青海/海南/共和\0"
+    "Gonghe\0"
+    "青海省/海南藏族自治州/同德县\0"
+    "青海/海南/同德\0"
+    "Tongde\0"
+    "青海省/海南藏族自治州/贵德县\0"
+    "青海/海南/贵德\0"
+    "Guide\0"
+    "青海省/海南藏族自治州/兴海县\0"
+    "青海/海南/兴海\0"
+    "Xinghai\0"
+    "青海省/海南藏族自治州/贵南县\0"
+    "青海/海南/贵南\0"
+    "Guinan\0"
+    "青海省/果洛藏族自治州\0"
+    "青海/果洛/果洛\0"
+    "Guoluo\0"
+    "青海省/果洛藏族自治州/玛沁县\0"
+    "青海/果洛/玛沁\0"
+    "Maqin\0"
+    "青海省/果洛藏族自治州/班玛县\0"
+    "青海/果洛/班玛\0"
+    "Banma\0"
+    "青海省/果洛藏族自治州/甘德县\0"
+    "青海/果洛/甘德\0"
+    "Gande\0"
+    "青海省/果洛藏族自治州/达日县\0"
+    "青海/果洛/达日\0"
+    "Dari\0"
+    "青海省/果洛藏族自治州/久治县\0"
+    "青海/果洛/久治\0"
+    "Jiuzhi\0"
+    "青海省/果洛藏族自治州/玛多县\0"
+    "青海/果洛/玛多\0"
+    "Madu\0"
+    "青海省/玉树藏族自治州\0"
+    "青海/玉树\0"
+    "青海省/玉树藏族自治州/玉树市\0"
+    "青海/玉树/玉树\0"
+    "青海省/玉树藏族自治州/杂多县\0"
+    "青海/玉树/杂多\0"
+    "Zaduo\0"
+    "青海省/玉树藏族自治州/称多县\0"
+    "青海/玉树/称多\0"
+    "Chenduo\0"
+    "青海省/玉树藏族自治州/治多县\0"
+    "青海/玉树/治多\0"
+    "Zhiduo\0"
+    "青海省/玉树藏族自治州/囊谦县\0"
+    "青海/玉树/囊谦\0"
+    "Nangqian\0"
+    "青海省/玉树藏族自治州/曲麻莱县\0"
+    "青海/玉树/曲麻莱\0"
+    "Qumacai\0"
+    "青海省/海西蒙古族藏族自治州\0"
+    "青海/海西/海西\0"
+    "Haixi\0"
+    "青海省/海西蒙古族藏族自治州/格尔木市\0"
+    "青海/海西/格尔木\0"
+    "Geermu\0"
+    "青海省/海西蒙古族藏族自治州/德令哈市\0"
+    "青海/海西/德令哈\0"
+    "Delingha\0"
+    "青海省/海西蒙古族藏族自治州/茫崖市\0"
+    "青海/海西/茫崖\0"
+    "Mangai\0"
+    "青海省/海西蒙古族藏族自治州/乌兰县\0"
+    "青海/海西/乌兰\0"
+    "Wulan\0"
+    "青海省/海西蒙古族藏族自治州/都兰县\0"
+    "青海省/海西/都兰\0"
+    "Dulan\0"
+    "青海省/海西蒙古族藏族自治州/天峻县\0"
+    "青海/海西/天峻\0"
+    "Tianjun\0"
+    "宁夏回族自治区/银川市\0"
+    "宁夏/银川/银川\0"
+    "Yinchuan\0"
+    "宁夏回族自治区/银川市/兴庆区\0"
+    "宁夏/银川/兴庆\0"
+    "Xingqing\0"
+    "宁夏回族自治区/银川市/西夏区\0"
+    "宁夏/银川/西夏\0"
+    "宁夏回族自治区/银川市/金凤区\0"
+    "宁夏/银川/金凤\0"
+    "Jinfeng\0"
+    "宁夏回族自治区/银川市/永宁县\0"
+    "宁夏/银川/永宁\0"
+    "宁夏回族自治区/银川市/贺兰县\0"
+    "宁夏/银川/贺兰\0"
+    "Helan\0"
+    "宁夏回族自治区/银川市/灵武市\0"
+    "宁夏/银川/灵武\0"
+    "Lingwu\0"
+    "宁夏回族自治区/石嘴山市\0"
+    "宁夏/石嘴山/石嘴山\0"
+    "Shizuishan\0"
+    "宁夏回族自治区/石嘴山市/大武口区\0"
+    "宁夏/石嘴山/大武口\0"
+    "Dawukou\0"
+    "宁夏回族自治区/石嘴山市/惠农区\0"
+    "宁夏/石嘴山/惠农\0"
+    "Huinong\0"
+    "宁夏回族自治区/石嘴山市/平罗县\0"
+    "宁夏/石嘴山/平罗\0"
+    "Pingluo\0"
+    "宁夏回族自治区/吴忠市\0"
+    "宁夏/吴忠/吴忠\0"
+    "宁夏回族自治区/吴忠市/利通区\0"
+    "宁夏/吴忠/利通\0"
+    "Litong\0"
+    "宁夏回族自治区/吴忠市/红寺堡区\0"
+    "宁夏/吴忠/红寺堡\0"
+    "Hongsibao\0"
+    "宁夏回族自治区/吴忠市/盐池县\0"
+    "宁夏/吴忠/盐池\0"
+    "Yanchi\0"
+    "宁夏回族自治区/吴忠市/同心县\0"
+    "宁夏/吴忠/同心\0"
+    "Tongxin\0"
+    "宁夏回族自治区/吴忠市/青铜峡市\0"
+    "宁夏/吴忠/青铜峡\0"
+    "Qingtongxia\0"
+    "宁夏回族自治区/固原市\0"
+    "宁夏/固原/固原\0"
+    "宁夏回族自治区/固原市/原州区\0"
+    "宁夏/固原/原州\0"
+    "宁夏回族自治区/固原市/西吉县\0"
+    "宁夏/固原/西吉\0"
+    "Xiji\0"
+    "宁夏回族自治区/固原市/隆德县\0"
+    "宁夏/固原/隆德\0"
+    "Longde\0"
+    "宁夏回族自治区/固原市/泾源县\0"
+    "宁夏/固原/泾源\0"
+    "宁夏回族自治区/固原市/彭阳县\0"
+    "宁夏/固原/彭阳\0"
+    "Pengyang\0"
+    "宁夏回族自治区/中卫市\0"
+    "宁夏/中卫/中卫\0"
+    "Zhongwei\0"
+    "宁夏回族自治区/中卫市/沙坡头区\0"
+    "宁夏/中卫/沙坡头\0"
+    "Shapotou\0"
+    "宁夏回族自治区/中卫市/中宁县\0"
+    "宁夏/中卫/中宁\0"
+    "Zhongning\0"
+    "宁夏回族自治区/中卫市/海原县\0"
+    "宁夏/中卫/海原\0"
+    "Haiyuan\0"
+    "新疆维吾尔自治区/乌鲁木齐市\0"
+    "新疆/乌鲁木齐/乌鲁木齐\0"
+    "Wulumuqi\0"
+    "新疆维吾尔自治区/乌鲁木齐市/天池\0"
+    "新疆/乌鲁木齐/天池\0"
+    "Tianchi\0"
+    "新疆维吾尔自治区/乌鲁木齐市/沙依巴克区\0"
+    "新疆/乌鲁木齐/沙依巴克\0"
+    "Shayibake\0"
+    "新疆维吾尔自治区/乌鲁木齐市/新市区\0"
+    "新疆/乌鲁木齐/新市\0"
+    "Xinshi\0"
+    "新疆维吾尔自治区/乌鲁木齐市/水磨沟区\0"
+    "新疆/乌鲁木齐/水磨沟\0"
+    "Shuimogou\0"
+    "新疆维吾尔自治区/乌鲁木齐市/头屯河区\0"
+    "新疆/乌鲁木齐/头屯河\0"
+    "Toutunhe\0"
+    "新疆维吾尔自治区/乌鲁木齐市/达坂城区\0"
+    "新疆/乌鲁木齐/达坂城\0"
+    "Dabancheng\0"
+    "新疆维吾尔自治区/乌鲁木齐市/米东区\0"
+    "新疆/乌鲁木齐/米东\0"
+    "Midong\0"
+    "新疆维吾尔自治区/乌鲁木齐市/乌鲁木齐县\0"
+    "新疆/乌鲁木齐市/乌鲁木齐县\0"
+    "新疆维吾尔自治区/克拉玛依市\0"
+    "新疆/克拉玛依\0"
+    "Dushanzi\0"
+    "新疆维吾尔自治区/克拉玛依市/独山子区\0"
+    "新疆/克拉玛依/独山子\0"
+    "新疆维吾尔自治区/克拉玛依市/克拉玛依区\0"
+    "新疆/克拉玛依/克拉玛依\0"
+    "新疆维吾尔自治区/克拉玛依市/白碱滩区\0"
+    "新疆/克拉玛依/白碱滩\0"
+    "Baijiantan\0"
+    "新疆维吾尔自治区/克拉玛依市/乌尔禾区\0"
+    "新疆/克拉玛依/乌尔禾\0"
+    "Wuerhe\0"
+    "新疆维吾尔自治区/吐鲁番市\0"
+    "新疆/吐鲁番/吐鲁番\0"
+    "Tulufan\0"
+    "新疆维吾尔自治区/吐鲁番市/高昌区\0"
+    "新疆/吐鲁番/高昌\0"
+    "Gaochang\0"
+    "新疆维吾尔自治区/吐鲁番市/鄯善县\0"
+    "新疆/吐鲁番/鄯善\0"
+    "Shanshan\0"
+    "新疆维吾尔自治区/吐鲁番市/托克逊县\0"
+    "新疆/吐鲁番/托克逊\0"
+    "Tuokexun\0"
+    "新疆维吾尔自治区/哈密市\0"
+    "新疆/哈密/哈密\0"
+    "Hami\0"
+    "新疆维吾尔自治区/哈密市/伊州区\0"
+    "新疆/哈密/伊州\0"
+    "新疆维吾尔自治区/哈密市/巴里坤哈萨克自治县\0"
+    "新疆/哈密/巴里坤\0"
+    "Balikun\0"
+    "新疆维吾尔自治区/哈密市/伊吾县\0"
+    "新疆/哈密/伊吾\0"
+    "新疆维吾尔自治区/昌吉回族自治州\0"
+    "新疆/昌吉\0"
+    "Changji\0"
+    "新疆维吾尔自治区/昌吉回族自治州/昌吉市\0"
+    "新疆/昌吉/昌吉\0"
+    "新疆维吾尔自治区/昌吉回族自治州/阜康市\0"
+    "新疆/昌吉/阜康\0"
+    "Fukang\0"
+    "新疆维吾尔自治区/昌吉回族自治州/呼图壁县\0"
+    "新疆/昌吉/呼图壁\0"
+    "Hutubi\0"
+    "新疆维吾尔自治区/昌吉回族自治州/玛纳斯县\0"
+    "新疆/昌吉/玛纳斯\0"
+    "Manasi\0"
+    "新疆维吾尔自治区/昌吉回族自治州/奇台县\0"
+    "新疆/昌吉/奇台\0"
+    "Qitai\0"
+    "新疆维吾尔自治区/昌吉回族自治州/吉木萨尔县\0"
+    "新疆/昌吉/吉木萨尔\0"
+    "Jimusaer\0"
+    "新疆维吾尔自治区/昌吉回族自治州/木垒哈萨克自治县\0"
+    "新疆/昌吉/木垒\0"
+    "Mulei\0"
+    "新疆维吾尔自治区/博尔塔拉蒙古自治州\0"
+    "新疆/新疆/博尔塔拉\0"
+    "Boertala\0"
+    "新疆维吾尔自治区/博尔塔拉蒙古自治州/博乐市\0"
+    "新疆/博尔塔拉/博乐\0"
+    "Bole\0"
+    "新疆维吾尔自治区/博尔塔拉蒙古自治州/阿拉山口市\0"
+    "新疆/博尔塔拉/阿拉山口\0"
+    "Alashankou\0"
+    "新疆维吾尔自治区/博尔塔拉蒙古自治州/精河县\0"
+    "新疆/博尔塔拉/精河\0"
+    "Jinghe\0"
+    "新疆维吾尔自治区/博尔塔拉蒙古自治州/温泉县\0"
+    "新疆/博尔塔拉/温泉\0"
+    "Wenquan\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州\0"
+    "新疆/新疆/巴音郭楞\0"
+    "Bayinguoleng\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/库尔勒市\0"
+    "新疆/巴音郭楞/库尔勒\0"
+    "Kuerle\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/轮台县\0"
+    "新疆/巴音郭楞/轮台\0"
+    "Luntai\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/尉犁县\0"
+    "新疆/巴音郭楞/尉犁\0"
+    "Weili\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/若羌县\0"
+    "新疆/巴音郭楞/若羌\0"
+    "Ruoqiang\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/且末县\0"
+    "新疆/巴音郭楞/且末\0"
+    "Qiemo\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/焉耆回族自治县\0"
+    "新疆/巴音郭楞/焉耆\0"
+    "Yanqi\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/和静县\0"
+    "新疆/巴音郭楞/和静\0"
+    "Hejing\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/和硕县\0"
+    "新疆/巴音郭楞/和硕\0"
+    "Heshuo\0"
+    "新疆维吾尔自治区/巴音郭楞蒙古自治州/博湖县\0"
+    "新疆/巴音郭楞/博湖\0"
+    "Bohu\0"
+    "新疆维吾尔自治区/阿克苏地区\0"
+    "新疆/阿克苏\0"
+    "Akesu\0"
+    "新疆维吾尔自治区/阿克苏地区/阿克苏市\0"
+    "新疆/阿克苏/阿克苏\0"
+    "新疆维吾尔自治区/阿克苏地区/温宿县\0"
+    "新疆/阿克苏/温宿\0"
+    "Wensu\0"
+    "新疆维吾尔自治区/阿克苏地区/库车县\0"
+    "新疆/阿克苏/库车\0"
+    "Kuche\0"
+    "新疆维吾尔自治区/阿克苏地区/沙雅县\0"
+    "新疆/阿克苏/沙雅\0"
+    "Shaya\0"
+    "新疆维吾尔自治区/阿克苏地区/新和县\0"
+    "新疆/阿克苏/新和\0"
+    "新疆维吾尔自治区/阿克苏地区/拜城县\0"
+    "新疆/阿克苏/拜城\0"
+    "新疆维吾尔自治区/阿克苏地区/乌什县\0"
+    "新疆/阿克苏/乌什\0"
+    "Wushi\0"
+    "新疆维吾尔自治区/阿克苏地区/阿瓦提县\0"
+    "新疆/阿克苏/阿瓦提\0"
+    "Awati\0"
+    "新疆维吾尔自治区/阿克苏地区/柯坪县\0"
+    "新疆/阿克苏/柯坪\0"
+    "Keping\0"
+    "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州\0"
+    "新疆/新疆/克州\0"
+    "Kezhou\0"
+    "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/阿图什市\0"
+    "新疆/克州/阿图什\0"
+    "Atushi\0"
+    "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/阿克陶县\0"
+    "新疆/克州/阿克陶\0"
+    "Aketao\0"
+    "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/阿合奇县\0"
+    "新疆/克州/阿合奇\0"
+    "Aheqi\0"
+    "新疆维吾尔自治区/克孜勒苏柯尔克孜自治州/乌恰县\0"
+    "新疆/克州/乌恰\0"
+    "Wuqia\0"
+    "新疆维吾尔自治区/喀什地区\0"
+    "新疆/喀什\0"
+    "Kashi\0"
+    "新疆维吾尔自治区/喀什地区/喀什市\0"
+    "新疆/喀什/喀什\0"
+    "新疆维吾尔自治区/喀什地区/疏附县\0"
+    "新疆/喀什/疏附\0"
+    "Shufu\0"
+    "新疆维吾尔自治区/喀什地区/疏勒县\0"
+    "新疆/喀什/疏勒\0"
+    "Shujin\0"
+    "新疆维吾尔自治区/喀什地区/英吉沙县\0"
+    "新疆/喀什/英吉沙\0"
+    "Yingjisha\0"
+    "新疆维吾尔自治区/喀什地区/泽普县\0"
+    "新疆/喀什/泽普\0"
+    "Zepu\0"
+    "新疆维吾尔自治区/喀什地区/莎车县\0"
+    "新疆/喀什/莎车\0"
+    "Shache\0"
+    "新疆维吾尔自治区/喀什地区/叶城县\0"
+    "新疆/喀什/叶城\0"
+    "Yecheng\0"
+    "新疆维吾尔自治区/喀什地区/麦盖提县\0"
+    "新疆/喀什/麦盖提\0"
+    "Maitigai\0"
+    "新疆维吾尔自治区/喀什地区/岳普湖县\0"
+    "新疆/喀什/岳普湖\0"
+    "Yuepuhu\0"
+    "新疆维吾尔自治区/喀什地区/伽师县\0"
+    "新疆/喀什/伽师\0"
+    "Jiashi\0"
+    "新疆维吾尔自治区/喀什地区/巴楚县\0"
+    "新疆/喀什/巴楚\0"
+    "Bachu\0"
+    "新疆维吾尔自治区/喀什地区/塔什库尔干塔吉克自治县\0"
+    "新疆/喀什/塔什库尔干\0"
+    "Tashikuergan\0"
+    "新疆维吾尔自治区/和田地区\0"
+    "新疆/和田\0"
+    "Hetian\0"
+    "新疆维吾尔自治区/和田地区/和田县\0"
+    "新疆/和田/和田\0"
+    "新疆维吾尔自治区/和田地区/墨玉县\0"
+    "新疆/和田/墨玉\0"
+    "Moyu\0"
+    "新疆维吾尔自治区/和田地区/皮山县\0"
+    "新疆/和田/皮山\0"
+    "Pishan\0"
+    "新疆维吾尔自治区/和田地区/洛浦县\0"
+    "新疆/和田/洛浦\0"
+    "Luopu\0"
+    "新疆维吾尔自治区/和田地区/策勒县\0"
+    "新疆/和田/策勒\0"
+    "Cele\0"
+    "新疆维吾尔自治区/和田地区/于田县\0"
+    "新疆/和田/于田\0"
+    "新疆维吾尔自治区/和田地区/民丰县\0"
+    "新疆/和田/民丰\0"
+    "Minfeng\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州\0"
+    "新疆/新疆/伊犁\0"
+    "Yili\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/伊宁市\0"
+    "新疆/伊犁/伊宁\0"
+    "Yining\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/奎屯市\0"
+    "新疆/伊犁/奎屯\0"
+    "Kuitun\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/霍尔果斯市\0"
+    "新疆/伊犁/霍尔果斯\0"
+    "Huoerguosi\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/伊宁县\0"
+    "新疆/伊犁/伊宁县\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/察布查尔锡伯自治县\0"
+    "新疆/伊犁/察布查尔\0"
+    "Chabuchaer\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/霍城县\0"
+    "新疆/伊犁/霍城\0"
+    "Huocheng\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/巩留县\0"
+    "新疆/伊犁/巩留\0"
+    "Gongliu\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/新源县\0"
+    "新疆/伊犁/新源\0"
+    "Xinyuan\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/昭苏县\0"
+    "新疆/伊犁/昭苏\0"
+    "Zhaosu\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/特克斯县\0"
+    "新疆/伊犁/特克斯\0"
+    "Tekesi\0"
+    "新疆维吾尔自治区/伊犁哈萨克自治州/尼勒克县\0"
+    "新疆/伊犁/尼勒克\0"
+    "Nileke\0"
+    "新疆维吾尔自治区/塔城地区\0"
+    "新疆/塔城\0"
+    "Tacheng\0"
+    "新疆维吾尔自治区/塔城地区/塔城市\0"
+    "新疆/塔城/塔城\0"
+    "新疆维吾尔自治区/塔城地区/乌苏市\0"
+    "新疆/塔城/乌苏\0"
+    "Wusu\0"
+    "新疆维吾尔自治区/塔城地区/额敏县\0"
+    "新疆/塔城/额敏\0"
+    "Emin\0"
+    "新疆维吾尔自治区/塔城地区/沙湾县\0"
+    "新疆/塔城/沙湾\0"
+    "新疆维吾尔自治区/塔城地区/托里县\0"
+    "新疆/塔城/托里\0"
+    "Tuoli\0"
+    "新疆维吾尔自治区/塔城地区/裕民县\0"
+    "新疆/塔城/裕民\0"
+    "Yumin\0"
+    "新疆维吾尔自治区/塔城地区/和布克赛尔蒙古自治县\0"
+    "新疆/塔城/和布克赛尔\0"
+    "Bukesaier\0"
+    "新疆维吾尔自治区/阿勒泰地区\0"
+    "新疆/阿勒泰\0"
+    "Aletai\0"
+    "新疆维吾尔自治区/阿勒泰地区/阿勒泰市\0"
+    "新疆/阿勒泰/阿勒泰\0"
+    "新疆维吾尔自治区/阿勒泰地区/布尔津县\0"
+    "新疆/阿勒泰/布尔津\0"
+    "Buerjin\0"
+    "新疆维吾尔自治区/阿勒泰地区/富蕴县\0"
+    "新疆/阿勒泰/富蕴\0"
+    "Fuyun\0"
+    "新疆维吾尔自治区/阿勒泰地区/福海县\0"
+    "新疆/阿勒泰/福海\0"
+    "Fuhai\0"
+    "新疆维吾尔自治区/阿勒泰地区/哈巴河县\0"
+    "新疆/阿勒泰/哈巴河\0"
+    "Habahe\0"
+    "新疆维吾尔自治区/阿勒泰地区/青河县\0"
+    "新疆/阿勒泰/青河\0"
+    "新疆维吾尔自治区/阿勒泰地区/吉木乃县\0"
+    "新疆/阿勒泰/吉木乃\0"
+    "Jimunai\0"
+    "新疆维吾尔自治区/石河子市\0"
+    "新疆/石河子/石河子\0"
+    "Shihezi\0"
+    "新疆维吾尔自治区/阿拉尔市\0"
+    "新疆/阿拉尔/阿拉尔\0"
+    "Alaer\0"
+    "新疆维吾尔自治区/图木舒克市\0"
+    "新疆/新疆/图木舒克\0"
+    "Tumushuke\0"
+    "新疆维吾尔自治区/五家渠市\0"
+    "新疆/五家渠/五家渠\0"
+    "Wujiaqu\0"
+    "新疆维吾尔自治区/北屯市\0"
+    "新疆/新疆/北屯\0"
+    "Beitun\0"
+    "新疆维吾尔自治区/铁门关市\0"
+    "新疆/新疆/铁门关\0"
+    "Tiemenguan\0"
+    "新疆维吾尔自治区/双河市\0"
+    "新疆/新疆/双河\0"
+    "Shuanghe\0"
+    "新疆维吾尔自治区/可克达拉市\0"
+    "新疆/新疆/可克达拉\0"
+    "Kekedala\0"
+    "新疆维吾尔自治区/昆玉市\0"
+    "新疆/新疆/昆玉\0"
+    "Kunyu\0"
+    "台湾/高雄\0"
+    "台湾/高雄/恒春\0"
+    "Hengchun\0"
+    "台湾/高雄/台南\0"
+    "Tainan\0"
+    "Gaoxiong\0"
+    "台湾/高雄/屏东\0"
+    "Pingdong\0"
+    "台湾/高雄/马公\0"
+    "Ma-kung\0"
+    "台湾/高雄/嘉义\0"
+    "Jiayi\0"
+    "台湾/高雄/云林\0"
+    "Yunlin\0"
+    "台湾/台中\0"
+    "台湾/台中/鹿谷乡\0"
+    "Lugu\0"
+    "台湾/台中/彰化\0"
+    "Zhanghua\0"
+    "台湾/台中/南投\0"
+    "Nantou\0"
+    "Taizhong\0"
+    "台湾/台中/苗栗\0"
+    "Miaoli\0"
+    "台湾/台中/台东\0"
+    "Taidong\0"
+    "台湾/台中/埔里\0"
+    "Puli\0"
+    "台湾/台中/花莲\0"
+    "Hualian\0"
+    "台湾/台北\0"
+    "台湾/台北/新竹\0"
+    "Xinzhu\0"
+    "台湾/台北/大溪\0"
+    "Daxi\0"
+    "台湾/台北/桃园\0"
+    "Taipei\0"
+    "台湾/台北/宜兰\0"
+    "台湾/台北/基隆\0"
+    "Keelung\0"
+    "香港\0"
+    "Hong Kong\0"
+    "九龙\0"
+    "Kowloon\0"
+    "荃湾\0"
+    "Tsuen Wan\0"
+    "新界\0"
+    "New Territories\0"
+    "澳门\0"
+    "Macao\0"
+    "路环岛\0"
+    "Coloane\0"
+    "氹仔岛\0"
+    "Taipa Island\0";
+
+constexpr char kCityIds[][13] = {
+    "WX4FBXXFKE4F",
+    "WX4G0URR276S",
+    "WX4EPCD9BMPN",
+    "WX4G17JWZEK7",
+    "WX4DWN2X06KM",
+    "WX4DUXSF6714",
+    "WX4EQ2XJD7V2",
+    "WX4E1VJ3N56X",
+    "WX4D4S7291H4",
+    "WX4GN7JYY527",
+    "WX4UQ3MYNN0Q",
+    "WX4SUCU47R3T",
+    "WX4DP0SUJ2YC",
+    "WX4VMUP35BZ0",
+    "WX5K31KNJY1W",
+    "WX5JDT1H236N",
+    "WX4QNGWY2FE8",
+    "WWGQDCW6TBW1",
+    "WWGQE0U6VS5D",
+    "WWGQEFZMJC1W",
+    "WWGQ7R6ZUMF7",
+    "WWGQ9STVVP3Y",
+    "WWGQDWRQSXXW",
+    "WWGQC9YRXSBV",
+    "WWGQM4R38052",
+    "WWGNW7KUC8EN",
+    "WWGMZ01DBNXT",
+    "WWGR17G3NCFH",
+    "WX50P0FTHSHF",
+    "WX53VNZ3B0EM",
+    "WWGTYKJXE1UQ",
+    "WWGZ9PCCUGRS",
+    "WWGJKWFX9MYZ",
+    "WX57ZDBH4M0G",
+    "WWC2MYYCM6J5",
+    "WWC2QK2826WW",
+    "WWC2HQR941EY",
+    "WWC2KWC5J30V",
+    "WWC0M54UVCB4",
+    "WWC2NNFBK813",
+    "WWC8M50SUCVF",
+    "WWC28UQ8P492",
+    "WW9X2ZVDFXU1",
+    "WWC0M73KEJJ4",
+    "WWC3P0GRF7RY",
+    "WWC6WEUYBRNZ",
+    "WWC3FS39WJMP",
+    "WW9MZUC5VS12",
+    "WWCCJQQNDECG",
+    "WW9Q6C8GXHVW",
+    "WWCC0NQWE5V7",
+    "WWC1WEJYKUGC",
+    "WW9QVBNVTQJ1",
+    "WW9WG8HVWY49",
+    "WW9ZTZHSH874",
+    "WWCB3E4KC3BD",
+    "WWCD1T7KVWJU",
+    "WXH13WQT7XKN",
+    "WXH12T28ZCYU",
+    "WXH13T4TDV3W",
+    "WXH4P1N2GBRN",
+    "WXH1DVXJJ7JU",
+    "WX5CP7MZCQWS",
+    "WXH494BF8D4K",
+    "WWUNZ5FRFWND",
+    "WXH2SWU0HMTY",
+    "WXH838HQ4U9G",
+    "WXHHKMJFXY6X",
+    "WX5DZ5BMGFFD",
+    "WX5US4896NYS",
+    "WXH7TJ6TQKXN",
+    "WXH6JH68W3P4",
+    "WXJ51T411GRX",
+    "WXJ528H2CCFH",
+    "WXJ5MMTY1TV3",
+    "WXHFWFFDTF1H",
+    "WXHFC5UTU6GD",
+    "WXHTFF8EPCUE",
+    "WXH9ZG0VQ22K",
+    "WXHDBGYMZFB6",
+    "WW92M43YCQG0",
+    "WW92J5JNFTQ4",
+    "WW92MJQVK1XG",
+    "WW92KTBK4BK7",
+    "WW3PQKGPBU90",
+    "WW3XUMDZ1VU6",
+    "WW93JP9G12GN",
+    "WW3WB1RDPE4S",
+    "WW3X1XGKJSJY",
+    "WW3YKK9DM6PJ",
+    "WW8B497GWYP5",
+    "WW3QF93DN5JH",
+    "WW9CKYBHP92R",
+    "WW9DJCJF94B4",
+    "WW3XX2CRRHGK",
+    "WW3ZZDNFSTX3",
+    "WW3WZKCQX57K",
+    "WW99PZ8510UQ",
+    "WW90Y9JBUZGG",
+    "WW96VH3U3KG5",
+    "WW96VECQ55CT",
+    "WW96UDKYNGT7",
+    "WW96VH3U3KG5",
+    "WW9KVTBME3SP",
+    "WW9KJYQBJRVN",
+    "WW9T3DEMMDTV",
+    "WW9S7XKGWBDS",
+    "WW9E1X73VTTV",
+    "WW9D3XEKTEVV",
+    "WW9WP0D0QH6C",
+    "WW9G9XDQ1QBS",
+    "WW9VW84KPEHD",
+    "WW9FUK3SMKZ5",
+    "WW9FCS6K3KBE",
+    "WW9FQS42PESS",
+    "WWD6BHKK6KG7",
+    "WWD1SK2DC1FH",
+    "WWDH3X35SBES",
+    "WW93TS26G3UH",
+    "WWFJ5S4DNJ0T",
+    "WWFJ5JMBF7CD",
+    "WWFJHN3UNPX7",
+    "WWFJ84TKNY22",
+    "WWFHECCGX5C4",
+    "WWFJZXMGBR4N",
+    "WX421K89XKQ4",
+    "WWCJN0RMDUFV",
+    "WWFR6KVHKD8D",
+    "WWCU2QJZH5W1",
+    "WWFK49KRMD97",
+    "WWFQHSVFWXW5",
+    "WWCXCE7QMETV",
+    "WWCUK2C8M7PH",
+    "WWFMQJ1TKVC7",
+    "WWFPU72W35DJ",
+    "WWCEDN9CZ9YC",
+    "WWF4VV5D0PVV",
+    "WWCUGUG15KWH",
+    "WWF4EXDEQP88",
+    "WWFTCBJ6YNDT",
+    "WX42WGNG8V7T",
+    "WWCG0HQE70MQ",
+    "WWF484JKWZ07",
+    "WWFRSPZ3UEMH",
+    "WX38NPJ1DP88",
+    "WX38N3543Y5E",
+    "WX38JY8ZKHXS",
+    "WX1YFP0B5K9C",
+    "WX1YRM11239W",
+    "WX1XFD29CWXF",
+    "WX3CP43599T9",
+    "WX3D451UPEYZ",
+    "WX3W04X9ZT6W",
+    "WX6M0CF1M7HB",
+    "WX319QQKM7P3",
+    "WX16XN7R46RV",
+    "WX1HNP85CY46",
+    "WX1R7EWPGJRZ",
+    "WX4JUDX551G5",
+    "WX1VTYUWS9E4",
+    "WX62GC2B68GG",
+    "WX7C5D6581T3",
+    "WX7C5DZJSF0K",
+    "WX7C02NE1C46",
+    "WX5WTM1EG05G",
+    "WXHPCJBY2WF7",
+    "WX5W40P3Y6R2",
+    "WX72VGJ4E1J0",
+    "WX7ENF146Y60",
+    "WX6FQKJZQH8M",
+    "WXHQBP480HE1",
+    "WX7WX3NGVYE8",
+    "WXK3HXU4K3VY",
+    "WWG1FS318M6P",
+    "WWG1GNZ4XV45",
+    "WWG1FQN3QJUR",
+    "WWG1GKQ1SMKP",
+    "WWG56R38Z332",
+    "WWDZ7XYDCZCC",
+    "WWG8CM6767JJ",
+    "WWG27QUCRFP5",
+    "WWF6EGBYFX5Z",
+    "WWFBRE4KG1FF",
+    "WWDY02926S39",
+    "WWF94QKN85GE",
+    "WWG28DMTGF2E",
+    "WWFBSD7TVF7G",
+    "WWFS3BV2Q54S",
+    "WWG6Q359MNQJ",
+    "WWFD97YYUP1R",
+    "WX4BZD6KEJFY",
+    "WX4BXR409T9P",
+    "WX4BZDTY2B9D",
+    "WX48Q6P06KTR",
+    "WWFZEJBXWG20",
+    "WX54NRUV1974",
+    "WWFUJVP7GFZH",
+    "WWFV4K4F5TNT",
+    "WX54VGYJZDF4",
+    "WWFY2TZYH86C",
+    "WX55RYPU2SNV",
+    "WWDQ8KE95MGB",
+    "WWDQ8J7UXJP4",
+    "WWDJTZ7T05TG",
+    "WWDM3Q29Z6YJ",
+    "WWDRHUVJRWYX",
+    "WWF2R5NHCCU4",
+    "WWF33X81BKW8",
+    "WWF1KXX1GHE0",
+    "WWDKQZQG8BES",
+    "WWDWMZ14RM7E",
+    "WWDX7N1BEPTM",
+    "WWF0M3KFW1SY",
+    "WW8P3NH2TPDT",
+    "WW8N9SDCPJGB",
+    "WW8P3K9XEM94",
+    "WW8P96QC7QG2",
+    "WQXZZ8CQMBQZ",
+    "WW8P25YZ9Y3R",
+    "WQXYX3ENTGXR",
+    "WQXVUSFGBSPB",
+    "WWB0EF7VC635",
+    "WQZ2XD7TYF35",
+    "WQXZ8RPSN2Q4",
+    "WX0S40QDCME0",
+    "WX0MN2HGDW9C",
+    "WX0ECZRGWVHT",
+    "WX07WD7XW8FZ",
+    "WX0G9P0ZXUG7",
+    "WX0VSMNHR17W",
+    "WX1JGYNX8DJ7",
+    "WX160XBJJ124",
+    "WX10R658RUTR",
+    "WX0CFG5JRBRU",
+    "WX05S9C8UK6Y",
+    "WW8Z267HHZ3U",
+    "WW8Z267HHZ3U",
+    "WW8Z27W1UTPU",
+    "WW8ZBG80FZ2F",
+    "WW8Z13R8CYSX",
+    "WWB8SKR25D88",
+    "WW2MYN52R11E",
+    "WW2MYN8DKWC5",
+    "WW2MH7KCBNT6",
+    "WW2Q8EUEQDSX",
+    "WW2W8MSM94YG",
+    "WW2RUD06XVT9",
+    "WW2TVNJ0Q947",
+    "WW2XSH8GCMPS",
+    "WW2MRZMWR0JB",
+    "WW2M2RMQM85B",
+    "WW81XBWY79DG",
+    "WW81HD1SK2DC",
+    "WQRZSHS5YTNU",
+    "WW23BS9T8PB1",
+    "WW23BS9T8PB1",
+    "WQRFBXQGP6ND",
+    "WQRCY4VTZZ7E",
+    "WW2E9989W73T",
+    "WW21ZW863X9U",
+    "WW279T1Y4EWW",
+    "WQZZWRV1BGKH",
+    "WQZZWM9DTY1H",
+    "WRP8ZK5QCQ57",
+    "WX00Z63H8TCQ",
+    "WX02ZRZ5MNKG",
+    "WRPGRQ4HKUNM",
+    "WX06T4Y6DFPK",
+    "WW8NMEQJCMJE",
+    "WW8NMWF7B000",
+    "WW86FSQHRUC7",
+    "WW8DGU3S2KZ5",
+    "WW8U27EPHB3G",
+    "WW8Y529B6H2C",
+    "WW8RRRZ4VPUC",
+    "WW8HCHH7M1DD",
+    "WQXUKPK5W8WU",
+    "WQXG82RTNQQ4",
+    "WQX3XKK6VCBS",
+    "WQXDDV1EMH2D",
+    "WQNZJRJNM3JV",
+    "WQNZMBKZZMSR",
+    "WQNZBWU784FT",
+    "WQQC9BPBQNTD",
+    "WQR14G7BTVDG",
+    "WQQFT0VCH2VR",
+    "WQR4DU7VTC6B",
+    "WQR3FFFVCRME",
+    "WQR2V45T7SGN",
+    "WQPPFYGGTFFV",
+    "WQPN4UEGMYDF",
+    "WQNTQSFWNUVD",
+    "WQNW2TTQSRR8",
+    "WQQDX0C30BYX",
+    "WWB4T4PKXRH7",
+    "WWB4MRNMS0C8",
+    "WWB6FJPDJZBM",
+    "WWBS34D4S729",
+    "WWBQ60RXJZBK",
+    "WWBWCHD0H32E",
+    "WQZVG7WR7WVJ",
+    "WQZD710CQN3J",
+    "WQZY34M992PB",
+    "WQZT31W8VVSF",
+    "WQZK4V4GC6VS",
+    "WRP00BFMHSJF",
+    "WQYBPZT229EC",
+    "WRP234PB6K9Z",
+    "WWBHKD9DS76C",
+    "WQRM38NMHR7P",
+    "WQRM4ZVRFJJK",
+    "WQR68W1ZZ32K",
+    "WQR7Q22N2DVB",
+    "WQRHPEUB5HY0",
+    "WQRQJP5EE9G0",
+    "WQRW6FC8J409",
+    "WQRVDKCVN86M",
+    "WQRS8U0H7VGZ",
+    "WQQTQEF9WZV8",
+    "WQQU9UPUQJVX",
+    "WQQZ2PJTNHC2",
+    "WQWBU30BBRG5",
+    "WQW9JMY2CBFC",
+    "WQQZPWJCZS56",
+    "WQX26ZFV9RJT",
+    "WQR4TU6TE13B",
+    "WQX2N3258WJG",
+    "WQXJ2UGJEGPU",
+    "WQXJ2Y63UDVV",
+    "WQXSVJFMX1WP",
+    "WQXV85C0S7M4",
+    "WQZ4BE5PGXV2",
+    "WQWZVKT4V2TZ",
+    "WQWUGTFVT39X",
+    "WQWF3ZXUW5VT",
+    "WQZ3V0ET5T5N",
+    "WQXP7PG4YZG3",
+    "WQXH3GWZ1B2E",
+    "WQX466JMGG98",
+    "WQX7R6UQMVBW",
+    "WQXKP8G9QZ91",
+    "WRR2Q2Z7CXWM",
+    "WRR2KVG2VVPD",
+    "WRR25UV015EU",
+    "WRPRV49XB01Z",
+    "WRR2J9TZ4PWB",
+    "WRPP8UF7HWJV",
+    "WRPJ1FYVCB0D",
+    "WRPT8WBYDCE4",
+    "WRP7J74YUE7E",
+    "WRR38N7KM5P3",
+    "WRNP70PG2MPX",
+    "WRNNZFRK4QU1",
+    "WRNP5Q3XD0CZ",
+    "WRNPHWXVC6JX",
+    "WRNRM5VSXDT8",
+    "WRQJVB46BMM3",
+    "WRNNYQBHVKJV",
+    "WRNWFCW1QSHU",
+    "WRQ32JRCNF7E",
+    "WRQQZ7FJ2MU1",
+    "WR5CWTXYQRVP",
+    "WR5CY9QS9051",
+    "WRH027BW6C3P",
+    "WR5BSX8JK31B",
+    "WXS86P4BSG4G",
+    "WXS8DG25QSRP",
+    "WXKZ4KD9EVGY",
+    "WXS8D1XPE0CR",
+    "WXV3SKPEDBCE",
+    "WXUFHW3F5D5Y",
+    "WXSRS6SF7KJ2",
+    "WXGBN31KKM5F",
+    "WXEW1QFK62V0",
+    "WXSU6GNH7E1G",
+    "WXKQMGUUKTYV",
+    "WXKUEMJ3WD11",
+    "WXT0XSQXM7W2",
+    "WXYBNKF2CT25",
+    "Y8N2K43REK6R",
+    "WXZEN1WGUK0Z",
+    "WXXH24U9CSK3",
+    "WXY201PUQV5D",
+    "WXWE4FY0Q9KF",
+    "WXTGC2WEKFBQ",
+    "WXVVQQNFE1UM",
+    "Y8J548QRRP4M",
+    "WRN16S9GJRQ1",
+    "WRN4X1583F0B",
+    "WRN17F23YKG3",
+    "WRNJZW4PEF1G",
+    "WRP18ZD2U8JG",
+    "WQU3QRRWBSHK",
+    "WQUY8CT6E2E1",
+    "WRJ69FZ6XD5S",
+    "WQV7SFYJKCD8",
+    "WQYP3CHPF6K3",
+    "Y8TPTQNF5V3X",
+    "Y8V0J2JZ730B",
+    "Y8G9TKZ0EY3K",
+    "Y8XCC9U1ED2C",
+    "YB8E9PDNHQBS",
+    "YBBJGD9F14VV",
+    "Y8T76RN47M5Q",
+    "Y8V1S4ZDQ3WD",
+    "Y8SS1PUGYH77",
+    "Y8DVQFRGVYH1",
+    "Y8GD09U2RMGS",
+    "Y8VB770UUCUF",
+    "Y8X2CNRZF23B",
+    "Y8VMYB06UYXJ",
+    "Y9N2VK0NVNP7",
+    "WRHRG8C39PEC",
+    "WRHRGFQ3CQS6",
+    "WRKCZDPBCG73",
+    "WRHJ7MCE68ZU",
+    "WRJR8KUE0QPV",
+    "WRMHMRTFG38V",
+    "WRK1U6JBZG69",
+    "WRK0W3BPRBQF",
+    "WX23NNWFJD1D",
+    "WX23MTKCJ427",
+    "WX209TDGZ0EG",
+    "WX3N65SM0W15",
+    "WX2SR7YN29RS",
+    "WX2BX3UZK26D",
+    "WRPYXD32MGWG",
+    "WX0XBRU29NYZ",
+    "WX24FBYXJJX5",
+    "WX27Z3XPV0HC",
+    "WRRKJY3RW8UZ",
+    "WX0QNB13F470",
+    "Y8NY1ECCRVK4",
+    "Y8NY1KD57NS4",
+    "Y8MK3HF77T3W",
+    "Y8NWN6G3JYMN",
+    "Y8N2K15G20SV",
+    "Y8R3UDVJCX65",
+    "Y8N6NMHTDM4H",
+    "WXF9BT6Y0JY4",
+    "WRZ8K4JREJGB",
+    "WXF9CJPWG18C",
+    "WXCF2PQT74VK",
+    "WXBC3WWUFBMN",
+    "WX855QMHZ385",
+    "Y854VWWVNX18",
+    "WXGTS599QD7D",
+    "WX3YREWVHWP7",
+    "WX8BNR8RX4XF",
+    "WX9B8UKRQ5X0",
+    "WXD2REKS5FV5",
+    "WX6ZFQDU79YS",
+    "WQGJJBDMKH1Z",
+    "WQGHUSF91KWU",
+    "WQBR1B1HE9XH",
+    "WPRWREDT4QH5",
+    "WXRVB9QYXKY8",
+    "WXRV8R5T04M6",
+    "WXRVC0PX7PW6",
+    "WXRVC3ZWVKNY",
+    "WXRVBVE1P9RF",
+    "WXRTZ3E3MWSD",
+    "WXRTN8KHBPBG",
+    "WXRV318CHCYF",
+    "WXRZ4WVR9X2Z",
+    "WXRTTZCUTWXC",
+    "WXRK0W3ZX2BR",
+    "WXXENYKSZ3D7",
+    "WXXCB0CHKQJP",
+    "WXRQFVFG9RMW",
+    "WWYMRT0VRMUG",
+    "WWYMRUZ825SR",
+    "WWYMRHPCCQV0",
+    "WWYMQF687P5G",
+    "WWYMT706MWWC",
+    "WWYHZDFNGU9B",
+    "WWYW3MGNP831",
+    "WXN8PH938UQD",
+    "WWZPMKUH348F",
+    "WXNC2HTENP33",
+    "WXP3Y7PM38QK",
+    "WXR3Y6P2CEQ3",
+    "WXR3WXG75MXF",
+    "WXR3YJ7CFEBU",
+    "WXR6P6YFMX3P",
+    "WXR3TSJ16Y0M",
+    "WXR53SZXBZ04",
+    "WXPTJKCB00NX",
+    "WXR281GRM0R6",
+    "WZ2NM0P2XMU7",
+    "WZ2N5S6KN57F",
+    "WZ2NN6TY9GD5",
+    "WZ2N0DUD49TM",
+    "WZ2NK21ZFVU4",
+    "WZ2NM0P2XMU7",
+    "WZ2VMHSNF5V4",
+    "WZ2ZD85FQBZ4",
+    "WZ24BQQTFN10",
+    "WZ24BQ12PBKE",
+    "WZ25072ECFZP",
+    "WZ24CRSSZ4XW",
+    "WXRCZ9ZBN5KC",
+    "WZ263DV24Y4T",
+    "WZ34U2VP4TW7",
+    "WZ0KQ36Y0N4N",
+    "WZ0KQD3FZ5SH",
+    "WZ0KJU8HT4GY",
+    "WZ0KRQ39DEES",
+    "WZ0XXQWJ2WR9",
+    "WZ06C4578DTW",
+    "WZ0NP79N2D92",
+    "WXQ1U6H0VE63",
+    "WXQ1UHYC3BYW",
+    "WXQ1USRK37ND",
+    "WXQ1GEM4133K",
+    "WXQV4ZM045RV",
+    "WXQHQ8KCZ9PG",
+    "WXQ61QU2EUQ2",
+    "WXQSETH19DN9",
+    "WXNZM7TPVMMZ",
+    "WXNZMGYQRGJ3",
+    "WXNZKFB1WQ8W",
+    "WXNUFE2R2G8Q",
+    "WXPP2TQ3Y2NH",
+    "WXPJB4SE19U7",
+    "WXPP781G2VHR",
+    "WXQX09T2HRXX",
+    "WXQWBPZKWZJP",
+    "WXQX7M6TS6QZ",
+    "WXQWBXRTH6U9",
+    "WXQMDVBQ32Q8",
+    "WXQX0F15G7PB",
+    "WXQX09T2HRXX",
+    "WXX1H5P97UW5",
+    "WXRDFBCXJJ8E",
+    "WXRDFB8SDS8U",
+    "WXRDEP0XSWZ9",
+    "WXRD7R0FH78C",
+    "WXRCCPMX97XY",
+    "WXRDDVW12EKS",
+    "WXRD2XBGFUGJ",
+    "WXREWKQ0VR9K",
+    "WXQCCV8TM5T4",
+    "WXQF36JKNZY5",
+    "WXQF1SKD6DJB",
+    "WXQC1U0TV1TJ",
+    "WXQF8TK68J6D",
+    "WZ809BF6B5HR",
+    "WZ809CWFNRS9",
+    "WZ860BQ0C5BJ",
+    "WZ809BF6B5HR",
+    "WZ8EN4F269K6",
+    "WZ85RGYGED4B",
+    "WXXCE7QMETV4",
+    "WZ84N3GZSQZH",
+    "WXMSKZT4B3TT",
+    "WXMSKY7S59FX",
+    "WXMSEBQHS8M0",
+    "WXMSKZT4B3TT",
+    "WXM5D0XUMP37",
+    "WXM4JQFC0DDQ",
+    "WXMVU1QN8UYB",
+    "WXKFTJ26TTKF",
+    "WXJZTSCEPN4J",
+    "WXJZYQD81CPK",
+    "WXJZWZKMQZ1B",
+    "WXMCGDGR793Z",
+    "WXJT6HJ9H0Z0",
+    "WXM0NP59WRD8",
+    "WXJZ549SEUU4",
+    "WZC1EXZ0P9HU",
+    "WZC1S28RV6C8",
+    "WZC1GXR20WUC",
+    "WZC16G5QZFCH",
+    "WZC1SC1BURVN",
+    "WZC1D5U5DSMG",
+    "WZ9REDW47HPB",
+    "WZC7PM687S82",
+    "WZCHB81R92M3",
+    "WZCYZXNZKTX6",
+    "WZCMK67YN39K",
+    "WZCCRENBK8PQ",
+    "WZF18HHC353Z",
+    "WZCCZC7DHYG6",
+    "WZCCR7HPJ434",
+    "WZCCRC5DQCN8",
+    "WZCBQTFKPWH8",
+    "WZF89QYZKN9Q",
+    "WZDH7Y3YRH94",
+    "WZFK8Y6JM2HV",
+    "WZ9SK6FCCUK3",
+    "WZ8MTDUGMP22",
+    "WZ8MMQJ39H3U",
+    "WZ8MWBGVB73M",
+    "WZ8QMNNM6CR3",
+    "WZ9NE78SJ9EY",
+    "WZ8Z2QGJUG9Z",
+    "WXXZD69FQS42",
+    "WZ8GZQHFH76E",
+    "WZ8UP3SBV311",
+    "WZ8UPWNQ8XWM",
+    "WZ96B98JJ08H",
+    "WZ8UHMQ5P5GS",
+    "WZ3T3SEQVEVF",
+    "WZ3T6H1964E1",
+    "WZ3TSH3130W1",
+    "WZ3MJE87E7HH",
+    "WZ9DGCSJPBEH",
+    "WZ92T0CFC75P",
+    "WZ93GYM7HQ8K",
+    "WZ39ZM9MR5E6",
+    "WZ3YSC05ZW82",
+    "WZ3YSE3P5FF2",
+    "WZ6PJDT5559T",
+    "WZD8B3FQNGYV",
+    "WZD1JQSVYHUG",
+    "WZ75TK22UX8K",
+    "WZ6JZ9MY8KF0",
+    "YB0B8REJKCCB",
+    "YB0BBNUMJJ5Z",
+    "WZBX23CR6X91",
+    "WZB5VHZMXQK2",
+    "YB00N5SSE2Q8",
+    "WZCXGSKGQZDX",
+    "Y8P7E0F5F2QK",
+    "Y8P7E2V4U0EB",
+    "Y8PSG6XX856R",
+    "WXZWBZ0P7VEF",
+    "Y8P3CUJDMK7W",
+    "YB06U51BTYU8",
+    "WZS5FZSMRDT6",
+    "WZS5FY540EQG",
+    "WZSK6Q7Q6K8D",
+    "WZENTZQ0X9FP",
+    "WZSEYSHXC5JZ",
+    "WZS5340C29F7",
+    "WZE9ZQQGJYES",
+    "WZSQ2W1J61K3",
+    "WZETM1Y05WW7",
+    "YB1UX38K6DY1",
+    "YB4H315RDCJ7",
+    "YB4H63BZXBM3",
+    "YB4H3ZFGN2W9",
+    "YB453MUK1XKZ",
+    "YB1UW9V2RYRM",
+    "YB4H40KX05JS",
+    "YB4J07UDZU0V",
+    "YB46BYDJJRHB",
+    "YB1F47R7MKFZ",
+    "YBHPEBR3TCC6",
+    "YB5SEX55HE4W",
+    "YB4SKBS1561S",
+    "YB4W5H9G7NT6",
+    "YB5J3KUW5HZ6",
+    "YB5T9B8FSMN5",
+    "YB5681ZJ3WPD",
+    "YB4CR843E4FZ",
+    "WZFRT37VCWZV",
+    "YB2JK81THR6Z",
+    "YB2JHT6R1S07",
+    "YB2JKS0YCQ6G",
+    "YB2JM19MGX06",
+    "YB2H1RZYG2NG",
+    "Y8RUT1EPZEJ9",
+    "Y8RQK1Z9YNGK",
+    "Y8RVPUJ1HQZZ",
+    "Y8RT700VNP3P",
+    "YB907K29JWGV",
+    "Y8PZBQZEW6YJ",
+    "WQ1PJ9PBXYZY",
+    "YB8803K79NNG",
+    "YB990PXEP8FW",
+    "YB9C0ZS7N0ZN",
+    "YB3WV12DHGJU",
+    "YB8GC3X83ZH8",
+    "YBJ1SQ97WHN1",
+    "YBJ1SQGYT1DK",
+    "YBJ14TUZ328F",
+    "YBJ1CR053BCD",
+    "YBHBTBM79KJ9",
+    "YBJ1VHCVWHQH",
+    "YBHC0YJYHJ40",
+    "YBJ1RVTBQ7QU",
+    "YBNS6H1JDD6U",
+    "YBJG0U0GCXQV",
+    "YBKTK25TPP2R",
+    "YBKTK9ZXWXMJ",
+    "YBKTHM9MY5ZV",
+    "YBKTHT42W0KK",
+    "YBKSG3XTUZZY",
+    "YBKTM320X96D",
+    "YBKTKUY2JGPC",
+    "YBMN9JEMXFYE",
+    "YBMUBR41ZWVC",
+    "YBM322SX2QPB",
+    "YBM327K9XWEB",
+    "YBM309937NQC",
+    "YBM3H3UFWQUM",
+    "YBM2VYTWQGYK",
+    "YBM1ZCJGWRNZ",
+    "YBMDPHJC6851",
+    "YBNP8231E3BD",
+    "YBR61XWMU274",
+    "YB2BVPSH4JM5",
+    "YB2CNFHX4NTR",
+    "YB2BZK58SVC8",
+    "YB2C3K7R3S8U",
+    "YB0ZCY60RJRM",
+    "YB0VBHBYKM2C",
+    "YB15FX6VF96N",
+    "YB0FYQ8MPPPB",
+    "YB2U3KZE3VKW",
+    "YB26XUMTX1MB",
+    "YB7XT0YP7SYK",
+    "YB7XT0YP7SYK",
+    "YB7UJSZC9867",
+    "YBE85XJG6JSD",
+    "YB7YN7JHFQPS",
+    "YB7RRZCRPCKP",
+    "YBS4EQTGB7WF",
+    "YB7YFPPRTC7W",
+    "YBKJ9NCD4RU8",
+    "YBECTPUZR61H",
+    "YB7XD8PSR3Q1",
+    "YBS5SK90GZCD",
+    "YB7EXBBDYQEK",
+    "YBSH3P2G88DK",
+    "YBS42JM8VY66",
+    "YBE8ZV54FR97",
+    "YBSWNF7FDHQM",
+    "YB7530MQ64YB",
+    "YBKDQEKD30TF",
+    "YBKDQ2EMSQK6",
+    "YBKDQ9F6QKK4",
+    "YBKDR5R7872K",
+    "YBKDM3PEMWE3",
+    "YBHYGPYJM88E",
+    "YBKGQXERKG29",
+    "YBK3GFYMCRK7",
+    "YBQPPD6J7GCC",
+    "YBMUU3T71YRK",
+    "YBX7PT7XWV91",
+    "YBJH7VFZU4T1",
+    "YBJHEK0MQBYU",
+    "YBJHM6BQSK9F",
+    "YBJHQQE0652T",
+    "YBHU70W1JD0S",
+    "WZUJT5EC6FK4",
+    "WZUJTE6JFGW6",
+    "WZUJTY0EEW1Y",
+    "WZUJSY0ES6N0",
+    "WZUJT6F2NJN7",
+    "YBH9SQEEXH03",
+    "WZVK8QKT22PV",
+    "WZUJ81EXHD0Q",
+    "WZUH61TJMXJN",
+    "WZUZD13VBQVV",
+    "WZV4XWWWM7QM",
+    "YBFTUGSP7QCT",
+    "YBFTV5V9G6CF",
+    "YB9P8ZPU52Q6",
+    "YBG653UBRVZH",
+    "YBF91HXS758Z",
+    "YB9FRH101ETS",
+    "YB9SPBB13PS3",
+    "YB63388P2QN8",
+    "YB6333XQVSWR",
+    "YB3FQJ5UT8EX",
+    "YB1Z1X4Q330T",
+    "YB39T3Z4WYXN",
+    "YB6DTY1PZ37S",
+    "YB3S2UVE6TKN",
+    "YB6KU1X7HWMH",
+    "YB1PGYYE8DVM",
+    "YB1W4DZC4Y2W",
+    "YB6Q138SZ3Q5",
+    "YBBQB6TMV95Z",
+    "Y9RJK4ZSEGWJ",
+    "YBBNZ69JB91R",
+    "YC4N3CPTNFUT",
+    "YC29TSEF0DGK",
+    "WTW3SJ5ZBJUY",
+    "WTW3SMGJ8NHW",
+    "WTW37HNSSJ68",
+    "WTW3DGZ6DG22",
+    "WTW3GB8WWK6S",
+    "WTW3F34NJJ19",
+    "WTW3UGFJ7BJR",
+    "WTW3V712JSV7",
+    "WTW3414PNURY",
+    "WTW6SK5N30JR",
+    "WTW4X8D1EZCZ",
+    "WTW3T7RMWMB4",
+    "WTQQBVVG9ZMN",
+    "WTW0W2VDYEPR",
+    "WTW1HNSVUSCG",
+    "WTQRUHGF01UB",
+    "WTW7FS0ZC50Z",
+    "WTSQQYHVQ973",
+    "WTSQR4WJNP42",
+    "WTSQR0GVT2DZ",
+    "WTSQJDMYP91J",
+    "WTSQQTCEZ5DT",
+    "WTSQ7682Y34B",
+    "WTSQXKQHG41K",
+    "WTSQNB0QZZ03",
+    "WTSTB2RFJXXJ",
+    "WTU8011K7TN4",
+    "WTSSH3EWX58K",
+    "WTSD1PMY2Z2C",
+    "WTTE97PU94T9",
+    "WTTEF8S5Q6BN",
+    "WTTS1REQ6G7M",
+    "WTTE2GZFGHHT",
+    "WTTE96Y2VC2D",
+    "WTTE4V50PN9N",
+    "WTTT2Z1YYP5B",
+    "WTT4QE46BRED",
+    "WW56FQXV5ZHB",
+    "WW5746R8PEEU",
+    "WW56GGZFDN77",
+    "WW5EBUURF35H",
+    "WW56FDJWX2QH",
+    "WW566Q28FVU3",
+    "WW4VMKCW0UVD",
+    "WW5JSF3UFMPR",
+    "WW5BU529F4N8",
+    "WWH5T4EY4BS0",
+    "WW5GHPB86PWW",
+    "WTTKC92GVT6S",
+    "WTTKCCXTT1RS",
+    "WTTKBMF9SWCP",
+    "WTTM1FVWGGDE",
+    "WTTK3N6Q7S9D",
+    "WTTH8GUJNUYP",
+    "WTSFWZFDVB90",
+    "WTTDPCGXTWUS",
+    "WTTDP3RN2FHT",
+    "WTTCCH80FWRR",
+    "WTTF3NYNX9V0",
+    "WTTF295B36E7",
+    "WTTC34246TPK",
+    "WTTU59XQWGTU",
+    "WTTTR1VB4WE5",
+    "WTW48BWCWRFR",
+    "WTW4GTQ3D8BV",
+    "WTTVYTY1H0HF",
+    "WTTYN5DEE05E",
+    "WTTYJPWNWDG6",
+    "WTWN7PBRX3RJ",
+    "WTWPVE8TDSTJ",
+    "WTWT00WUFMYT",
+    "WTV8RDHRSTU0",
+    "WTWJMR1QCXH8",
+    "WTV9HVT12RV9",
+    "WWHUBFTRE77P",
+    "WWHVG800SD6K",
+    "WWHUBHNHSXN8",
+    "WWHWNSSE3NTF",
+    "WWHKQTVXVDDC",
+    "WWHG1S55YRKV",
+    "WWHCGUH42S6N",
+    "WTUXK27DXN0R",
+    "WTUYDYQNZ73S",
+    "WTUXKD5HBN2U",
+    "WTUWUKKSCM9V",
+    "WTUT2N16E9YJ",
+    "WWHB4J3YB2MU",
+    "WTU78P6WBJG5",
+    "WTUEU75ERN0K",
+    "WTVMWP4TCFT7",
+    "WTVMZNCD8D11",
+    "WTVMW5D93FM6",
+    "WTVSV7GS42WD",
+    "WWJ48CUJQYN4",
+    "WWJ1QCCEC7H5",
+    "WWJ0NJ7WY26S",
+    "WWJ80M7QU06U",
+    "WTVNQJ58YK4W",
+    "WTVDCKPV15VD",
+    "WTUBM40RTTUB",
+    "WTUBM9EEUXN3",
+    "WTUBJN87JTKZ",
+    "WTV02RTWKYJJ",
+    "WTUV49RDG2ZX",
+    "WTSZ8484RK10",
+    "WTUFMXQM2DYS",
+    "WTSZNJUFDEP9",
+    "WTSZNMZSH2F7",
+    "WTSZJJM4K9X5",
+    "WTSYY1HFFDPE",
+    "WTTN0CKJWBQ5",
+    "WTTPQE63277W",
+    "WTSTZB2FNR8M",
+    "WTV28G74FW3J",
+    "WTV2BEPNYDNT",
+    "WTTPZGGEZ968",
+    "WTV3N04D9ZMK",
+    "WTV5R2BHGKV1",
+    "WTTW0V1FN0EU",
+    "WTTR507GUDWK",
+    "WWH1780CEFBR",
+    "WWH14X18FKV8",
+    "WWH1HKMVPFDW",
+    "WWH6NTJTTT4U",
+    "WTURUDS1HRTG",
+    "WTUN6JJ0VSJN",
+    "WTMKQ069CCJ7",
+    "WTMKN3V5ZZP4",
+    "WTMKQ9J9W5W9",
+    "WTMKPHX3CWBD",
+    "WTMKMZBFE71F",
+    "WTMKJSBWTWPD",
+    "WTM7Z7SRBC17",
+    "WTME8U3BYPEU",
+    "WTMT13ZC35J8",
+    "WTM6CW2VVW48",
+    "WTM5UR1QW0QN",
+    "WTM1E0VJ94EK",
+    "WTK8KSE02PBV",
+    "WTHZDQ9J3QQ3",
+    "WTQ3VZQP879N",
+    "WTQ3VU7BB6FN",
+    "WTQ6JCNY16W8",
+    "WTQDKB86YU3K",
+    "WTQD3U1Z3SDM",
+    "WTQ3TQRKQ701",
+    "WTQ2DT8GC08G",
+    "WTNXTNXJ2Y63",
+    "WTNQE4Q8K5DE",
+    "WTQ4UFF9RTER",
+    "WTQ5WSKBZXXU",
+    "WSVZ695PCF71",
+    "WSVZ3KXMRYFJ",
+    "WSVYVJ955QS4",
+    "WSVZ0EF4XCF7",
+    "WSYNKF69X852",
+    "WTJB4HS3XU64",
+    "WSVTRTHMKTU5",
+    "WSVS7Y0X57DC",
+    "WSVQH3PW4Z3D",
+    "WSVHU6CQYHW0",
+    "WSVY110N4XR6",
+    "WTN002CJ5K0D",
+    "WTMYGTZ7WZMY",
+    "WTMYUMUKSM74",
+    "WTMZ49N98592",
+    "WTMZX85620Z4",
+    "WTQJ8MC45K2X",
+    "WTMVDJU6PU6P",
+    "WTQN9UU06QU3",
+    "WTMWR8H2STU5",
+    "WTMRU3PTDC3X",
+    "WTMRWCC28EGN",
+    "WTMXS06SWBWE",
+    "WTMM9VZ6PS7X",
+    "WTT22RH887PG",
+    "WTMN72H2DJU5",
+    "WTMDXTK6STK4",
+    "WTMDXGDTS1BB",
+    "WTMEJ7UZ1MF4",
+    "WTMFY6YC7JSR",
+    "WTJZZ4K9YNTF",
+    "WTM3PFKGD19C",
+    "WTMBM2F7YP9T",
+    "WTJJ6TY7R0FK",
+    "WTJJ2Z9CP0HZ",
+    "WTJJE9F5QTST",
+    "WTJHQT468Q7X",
+    "WTJPXCJYWMYU",
+    "WTJTK2QKW2KX",
+    "WTHYNPKFFDZ9",
+    "WTJQSMBKCGCH",
+    "WTJQXFKB659G",
+    "WTJK7M54TWQZ",
+    "WTHS8FW3RYBK",
+    "WTHSBF5GZDBN",
+    "WTHSF7DHTZE9",
+    "WTHK2VPDSNMR",
+    "WTHJWWYY9CXF",
+    "WTHTPUBBN20R",
+    "WTH7E3B2YK6Y",
+    "WTQFSTR6DMK4",
+    "WTQFF2YX0JWG",
+    "WTQFRH0PKS9T",
+    "WTQUHDZ742SN",
+    "WTRNF6JR5Z1W",
+    "WTN74CS48NB0",
+    "WTN75JN9H56X",
+    "WTN4ZXD47G1F",
+    "WTN6D4F4WFPU",
+    "WTNMDJ4HQCRY",
+    "WTNJDNGQE3SF",
+    "WTJU5R8GUYHF",
+    "WTN33UDGJZR3",
+    "WTNHH5UZKTCC",
+    "WTN0N8UVPSPF",
+    "WTJ3BG5J683H",
+    "WTJ3BE42ZV8K",
+    "WTJ81H91XHK6",
+    "WTJ6UR863G14",
+    "WTHFDN3Z06MV",
+    "WTHCYG4TMB3H",
+    "WSVPBZH4YGYJ",
+    "WSUTJH1D4J1V",
+    "WSVP4JXGM413",
+    "WSUXWZGCF5QK",
+    "WTEMH46Z5N09",
+    "WTEMJRCVVPNG",
+    "WTEMK79QR10U",
+    "WTEMHNWW0T6B",
+    "WTEKVK45X268",
+    "WTG2F2B9DYU6",
+    "WTET35E43QSX",
+    "WTEK6Q2W6US6",
+    "WTE3UBBSQN4R",
+    "WTEGF0W764FN",
+    "WTS4JZ3WMZMC",
+    "WTS4MC9MZDPC",
+    "WTS4JS2RHCZP",
+    "WTS4MYYQ3PU2",
+    "WTS1E5SRHQ7U",
+    "WTS34NSJCKB5",
+    "WTS0C9YW5EUJ",
+    "WTKPUSV60CG0",
+    "WTEF53FXXNUU",
+    "WTG7R0CSBHZ9",
+    "WTG7RJRKC1JS",
+    "WTG7QTS5ZCZY",
+    "WTG7Q4CZWYZ0",
+    "WTG7W3QPX264",
+    "WTG7D6PB5VKY",
+    "WTGUD6V8EPFU",
+    "WTGMT9TZ44HQ",
+    "WTG1WKHG98G5",
+    "WTG1XKXRXCUK",
+    "WTG1WXT7P1DE",
+    "WTG17P43HDN1",
+    "WTG1DKZB05SG",
+    "WTG46R3TR6CK",
+    "WTG400BGM1U4",
+    "WTG137H870PQ",
+    "WTSK2DC1FHK3",
+    "WTSK2NZB4F92",
+    "WTSK0RUJXNMJ",
+    "WTSE832M8GRH",
+    "WTS72PD80470",
+    "WTEURQMY3KWD",
+    "WTSHMW6QKUT4",
+    "WW511U7JJ68Q",
+    "WW516K5Z0HHM",
+    "WW511W7NGXEQ",
+    "WW50F48Y0143",
+    "WW50CNVQ64QC",
+    "WT7ZCN9UKCZS",
+    "WTEB1B0QM30H",
+    "WTEB071JWRYP",
+    "WT7ZBEHWGP9G",
+    "WT7QDUY2MYY1",
+    "WT7JXTC4NSMZ",
+    "WT7M86G5V7M9",
+    "WT7JYF8EW2Y7",
+    "WT7JZB7C371F",
+    "WT7NF83HBR41",
+    "WT6YK858TVGG",
+    "WT6TJG95X75S",
+    "WT6ED2SH2P7E",
+    "WT6GRHGZCP1F",
+    "WT6XX856R8B4",
+    "WTE0TK2RKE82",
+    "WTK1H2DTJ1U4",
+    "WTK1HDM78CE1",
+    "WTKH25GWK92K",
+    "WTK1SWQ6KSMG",
+    "WTK1YVWJ7586",
+    "WTK13M211D6G",
+    "WT7F78D4BHMK",
+    "WT79YV9J6GD4",
+    "WTSPU2JCPU6T",
+    "WTSPEZRV0DD3",
+    "WTSPGVC6CSNS",
+    "WTU0WGQ4GN2M",
+    "WTSNE79S49XY",
+    "WTG9J9USVXX2",
+    "WTGDGRGCES45",
+    "WTUD5BV5KCZ6",
+    "WTGFKXQMM6BH",
+    "WTF75T383SE2",
+    "WTF754S5EV8V",
+    "WTF7HRBMJFDV",
+    "WTF774JHUPCK",
+    "WTCUNS4QXWU9",
+    "WTFHWYRVM20T",
+    "WTF1WH4G90Y7",
+    "WTF9TU15X2GE",
+    "WTFJ0EHJ0C17",
+    "WTGPMFNHZW6H",
+    "WTGPMU22MZ76",
+    "WW4EZ9GRP901",
+    "WW54KY3BFMZ3",
+    "WTGWFGT6CT2C",
+    "WTGY6QVE5H6G",
+    "WTDUEP89WV0P",
+    "WTDUEU1VNR0U",
+    "WTDUD6N3923E",
+    "WTDMMBFJSUSW",
+    "WTDXVV3PZKGD",
+    "WTE5HBCY43PQ",
+    "WTDKMY6Q7U8F",
+    "WTDDXHHYM2NZ",
+    "WW42DDHQT937",
+    "WW42DRPXTXVB",
+    "WTFWSWHU4KCH",
+    "WTFVK8EEVCEB",
+    "WTFSS4Y28PZU",
+    "WT7W3R63DQMH",
+    "WT7WE4YHS47Y",
+    "WT75NZE35WSM",
+    "WT7ECM6K62M1",
+    "WT7Y3EXV0N15",
+    "WTS2N4R0GD1V",
+    "WTS2N4PBR954",
+    "WTS9PG0CQK87",
+    "WTKZV3NVX9MZ",
+    "WTKNWKB0RYYC",
+    "WTK74F1FKQ38",
+    "WTKK30QCV1JG",
+    "WTKW72N8DVY5",
+    "WSSU6EXX52RE",
+    "WSSU6SWYKMJ0",
+    "WSSU4ZQ6D7WR",
+    "WSSU4N0Z7VJ9",
+    "WSSGY5V35CQZ",
+    "WSSU7K8V49R4",
+    "WSSGXXXY1YGK",
+    "WSSSYB7YF1Q6",
+    "WSSVPCX44CGZ",
+    "WSTN8KT9HVV0",
+    "WSST0MPYTDR0",
+    "WSSE4M6PTVE9",
+    "WST1JTV0U2C3",
+    "WSSFKD1VGEEB",
+    "WS7GQBRNR6V8",
+    "WS7GNFTT1KYV",
+    "WS7GMCC298MV",
+    "WSK52QUM8ZN2",
+    "WS7GZ62HZ7FN",
+    "WSKH8TFNWW1K",
+    "WSKH4DNJVNBP",
+    "WSS8S6CQZBPG",
+    "WSS8EVMHKZX6",
+    "WSS8Y1JBZPUE",
+    "WSS8SM7SRP86",
+    "WSKZ5N0G42QG",
+    "WSS2KDKNUQVB",
+    "WSETKW23BDUT",
+    "WSETKZPX8XNH",
+    "WSETK0KH29J0",
+    "WSEQ4BW2MUQ1",
+    "WSEHFMCTX39R",
+    "WSDVQQMCY4BM",
+    "WSEF1WXC251P",
+    "WSSHCK0539DF",
+    "WSEY0JUZ0UTQ",
+    "WSG8145193HS",
+    "WSG342BXFGKQ",
+    "WSG0DS3006D0",
+    "WSE7YCD0RPP0",
+    "WSKMS3KBE2JM",
+    "WSKMDQV4EHBK",
+    "WSKME5B5PD5M",
+    "WSKMUKDMV3H2",
+    "WSKWCVKYYD0V",
+    "WSKQRKED2DHM",
+    "WSKN97B53DDZ",
+    "WSS05CR7TY17",
+    "WSS146HKQ8T9",
+    "WSK5H226V4KW",
+    "WSKKEVYQ9QHK",
+    "WSKM4Q76FR2E",
+    "WSKNJC9SVCMG",
+    "WS7EMPWP7EQ3",
+    "WS7EMNTE8EBT",
+    "WS7EQMNJDJ9T",
+    "WS72JZVNG5T4",
+    "WS79K88R2WH8",
+    "WS5QFQPG5BKZ",
+    "WS7SP3YVVUES",
+    "WS5WB4MYT24Q",
+    "WS77QZDPR5R1",
+    "WS76THRM8172",
+    "WS7W66Y8P6PC",
+    "WS7G14CZSFRE",
+    "WSSP952Z8846",
+    "WSSP91VC9V9P",
+    "WSGGRZK2G3R8",
+    "WSGB2WG36FN7",
+    "WSUQC4WVV1JZ",
+    "WSGKTZM47HJP",
+    "WSUKWGSVYEGQ",
+    "WSUE8QXCV9Z1",
+    "WSGE9QD3F3V1",
+    "WSGVVZ6GFR4Y",
+    "WSU1U2TVPV4W",
+    "WS7NZ16DHEHU",
+    "WS7NZ1KRFSM0",
+    "WS7H8K0HQJUX",
+    "WSDDZW5QXSBP",
+    "WS6Y90NQYD7Y",
+    "WS6WCCM6N54S",
+    "WSE42DNVB5T8",
+    "WS7RZVWXHMCF",
+    "WSSZXXPU1B76",
+    "WSSZXY1127B3",
+    "WSV2FTM76EJM",
+    "WSSRNNXPEX1U",
+    "WSU95KWS6GWP",
+    "WSUUR2C0RG4K",
+    "WSUF73J3QW3J",
+    "WSV6BMHD0RZV",
+    "WSV449Y2RJFK",
+    "WSV7RXM8C130",
+    "WT47HJP3HEMP",
+    "WT47JNXDRDZB",
+    "WT47H9XDJYVW",
+    "WT46VFGN0UR8",
+    "WT4737UYM11F",
+    "WT47NWJMXSFE",
+    "WT47789T9EG2",
+    "WT46QJ3EUC9R",
+    "WT4HJ7UZQJUC",
+    "WT49MU95PR79",
+    "WT5QD22W4GKR",
+    "WT5QD3W9X9C9",
+    "WT5QDYKEYQ0Z",
+    "WT5RH4DUEHBD",
+    "WT5KC1U4MZ3T",
+    "WSBVNTZH3M2C",
+    "WSBVR1T8GMD4",
+    "WSBV7CX8VJD6",
+    "WSC42FZGEQW3",
+    "WSBYTE6SU0WQ",
+    "WSCJ4VFH7T69",
+    "WT62ZWSX5CM0",
+    "WT62Z37EEZFR",
+    "WT63PK1YEZYT",
+    "WT62MW8HMU0E",
+    "WT1YE0MQ07KX",
+    "WT1MPHG242PZ",
+    "WT4M5HFBP84R",
+    "WT4QF7M5SS28",
+    "WT4WE8RWN5QZ",
+    "WT69HSHVF39J",
+    "WT6FH5JH5GFZ",
+    "WT62B5H6D352",
+    "WT4Q7JJ8PW6M",
+    "WT62Z5N49CH0",
+    "WSCWR06PNPFU",
+    "WSCWPT88FMNQ",
+    "WSCW32KPHXVK",
+    "WT50ZFRU8TYY",
+    "WT50XJK5D5EG",
+    "WT506M9SZM12",
+    "WT52GKHYZYP5",
+    "WS9DZQ1QXHGR",
+    "WS9DYUXD78Q3",
+    "WS99GJQQHF99",
+    "WS9G0VKRWJX1",
+    "WS98RK33PNGM",
+    "WS926PGJSP5V",
+    "WS96Y0WPYKTD",
+    "WS960YW9R51R",
+    "WS6NCWC0UGE9",
+    "WS3TGBS1XBEN",
+    "WS3UCX43CQB9",
+    "WS3KVCWGJQMH",
+    "WSDW8HE1JVY0",
+    "WSD5DKN38YTG",
+    "WSDJBC5R3GDP",
+    "WSD3DSK6V9CK",
+    "WS6JZWJB2345",
+    "WSDTZ1HZM7WZ",
+    "WSDE0R63YVWV",
+    "WSCF23JCKNQJ",
+    "WSCF2TUZXCE3",
+    "WSCF14EX1KWY",
+    "WSC9YS79SJ3X",
+    "WSCFGG5PGRY0",
+    "WSFJ0KHDPV0V",
+    "WSFJCZREYZHW",
+    "WSF56TMW9CN7",
+    "WSC8QNV1640E",
+    "WS9MVCNZM7TP",
+    "WS9WEFSNZVEH",
+    "WSCEB0RSP9FT",
+    "WSC1R65EPUJ7",
+    "WSC2020Z7CP8",
+    "WSCQ4UBFXPTE",
+    "WSCQ5TJWH7TG",
+    "WT45389JSGG8",
+    "WSCRGZJ6U7BM",
+    "WT18X545WJ6V",
+    "WT197YKJRZ7N",
+    "WT4H0ZE7CY44",
+    "WT16699XQ1MP",
+    "WT426TSKVT12",
+    "WSFPSVYRS57B",
+    "WT419M9Y7ZGP",
+    "WSFXR95RZD21",
+    "WSFWYTUM7M71",
+    "WT4BTG05DVQT",
+    "WSFUTZR67UPP",
+    "WSG5K9FD12YG",
+    "WSFFGENXCZCB",
+    "WSFTBZ35BZPY",
+    "WSFK5C2Z6DEG",
+    "WSFSSXKF6K1P",
+    "WSGNC4TMF1NZ",
+    "WSGJXFXU0WQB",
+    "WSF8WUM8H6W2",
+    "WT5CU7PJK0RS",
+    "WT5CU22FHTT0",
+    "WTH19R80C84G",
+    "WT5CERD8Z0HG",
+    "WTH54V510EQZ",
+    "WT59N76XBY9H",
+    "WT59SJ9WQXGX",
+    "WT5984JCVRDQ",
+    "WT4GR0EV95CB",
+    "WT4UYZK90PC6",
+    "WT55RBXV8EYB",
+    "WT5Y3SZC851N",
+    "WT5SEQ5VGX4H",
+    "WWE0TGW4PX6N",
+    "WWE284B4BBUM",
+    "WWE0W0NUVUJF",
+    "WWE0S00VDXD2",
+    "WWE0TUZRX4XE",
+    "WWE0XTRF5FPF",
+    "WW7PBM8PNJUD",
+    "WWE8FKWTX2PU",
+    "WWE67KHBPGXH",
+    "WW7WJ9SSV9R7",
+    "WW7V0SRQUYT1",
+    "WW6Y3US63DJM",
+    "WWEK3CFHBB5R",
+    "WWMT5Q64CR3G",
+    "WWMT5ZMFHXY8",
+    "WWMT716RYYZN",
+    "WWMKWU0KKVZP",
+    "WWMTM7G9DRY8",
+    "WWMTSKH8YQNC",
+    "WWMWE96JVNUD",
+    "WWMWUYV0B7T9",
+    "WWMQ76G0JDNC",
+    "WWT31X8GJ8FW",
+    "WWT9WPCRMD0K",
+    "WWECQQCKH37Z",
+    "WWEBH2ZZKMW6",
+    "WWECMKMEVJWC",
+    "WW7Z9SXGBJ1H",
+    "WWS17YZKJC3R",
+    "WWEC65NRD14N",
+    "WWEFQFPJZ7T8",
+    "WWEG3N9FUYPW",
+    "WWKJC42GB8F6",
+    "WW5QJDVC4NKQ",
+    "WW5W6FVXU1BH",
+    "WW5MUP4UEN0T",
+    "WW5TG9EJUTF9",
+    "WW5SXJ22GG4D",
+    "WW5X8VB2PY7F",
+    "WW5R9F45BCGR",
+    "WWSKUMUVE3TR",
+    "WWSKUMUVE3TR",
+    "WWSR3PYFVPVC",
+    "WWSMC9JRR5WZ",
+    "WWSJ4Z50BDQU",
+    "WWS4YK2HRUYG",
+    "WWWM51WDH1FX",
+    "WWWMD3UUQFEK",
+    "WWWJR4ET3F8V",
+    "WWWKXHF6M35C",
+    "WWWM7KTCG82S",
+    "WWTZER0UHBKF",
+    "WWTWNMZZPS9Q",
+    "WWTF6S501GEH",
+    "WWT7906M5W3D",
+    "WWTZ5SZMQYVZ",
+    "WWTSEG0852FV",
+    "WWTUJW38PPFN",
+    "WWW1HZDEP8GQ",
+    "WWS8Z342UPZ7",
+    "WWS8UQ5420B5",
+    "WWSC0Y8YQWYN",
+    "WWS8X8DJ79MY",
+    "WWS8YF36CENQ",
+    "WWKRC0QBMJMV",
+    "WWS2ZC40FXVE",
+    "WWS0XV7HRPDD",
+    "WWKUV187JWKU",
+    "WWS3VCB99D29",
+    "WWKZ0RYU1K4N",
+    "WWMNUYZ2C5XC",
+    "WWSCTPBRMDHU",
+    "WW6CSB4BQYSD",
+    "WW6CMJDJ434E",
+    "WW744X9JB264",
+    "WW5Q16G3NY6N",
+    "WW4ZN7TCY0BK",
+    "WW4XW2R1D3V6",
+    "WW69X0HBMQWF",
+    "WW6G686NKDZ0",
+    "WW76UT92V1CY",
+    "WW6E9MNYH59Q",
+    "WW74MVNHX8DP",
+    "WW71MSQGYW39",
+    "WW7MBNP039PE",
+    "WW7MCKDBY7F5",
+    "WW7JZ5Y9R8ZJ",
+    "WW753ZEPM723",
+    "WW6U6KFG7TQW",
+    "WW7SRGJ3PVKF",
+    "WW7JC4M7F0YF",
+    "WWWV6YM1F4ZV",
+    "WWWV6FGFUY36",
+    "WWWG9K41ENS5",
+    "WWX53WXDBY0N",
+    "WWW6J3P6W6B4",
+    "WWKCX8PB3YE6",
+    "WWKCW318GJPW",
+    "WWHZG1C62BEP",
+    "WWKG2KNFC740",
+    "WWKD2J1KE8WP",
+    "WWHPMHEV4CS4",
+    "WWHPKVN1B7SS",
+    "WWHP5E068244",
+    "WWHPW5YPSX1Q",
+    "WWK4PZEJZ06D",
+    "WWHHVN7U4GU0",
+    "WWK7E383W76V",
+    "WW5YM1KZEQDE",
+    "WW7BSKXNSHX9",
+    "WW79UWXD3XTH",
+    "WWK80H367EQ4",
+    "WW7G5WDH04T7",
+    "WWHQEUYR9RU3",
+    "WWDTN3X443VR",
+    "WWDTN3D6R378",
+    "WWDUKEEXJB7G",
+    "WWEN1MUX5HXQ",
+    "WWEQZJ9S2NRW",
+    "WWE5E2QJHQK4",
+    "WWE12ENZ81JW",
+    "WWDG3QTDZWHQ",
+    "WWD6PWS97GJP",
+    "WWDE9PXW5NBU",
+    "WWEQESS30VZ8",
+    "WWDFJFZKGFZN",
+    "WW6RR5W09UKP",
+    "WW6RR28NEJY1",
+    "WW6M6XKQM812",
+    "WW6Q05KR43E2",
+    "WWD8J74TVQ4X",
+    "WW6WTMDTT6FE",
+    "WW6PD8VX3UYK",
+    "WWD9SZUP761S",
+    "WWD38U64V3UU",
+    "WWEUSKZ4K1P9",
+    "WWEUVMYTH3FB",
+    "WWSN2P5DKT27",
+    "WWET1Z0BU6QH",
+    "WWEW5D74SS6T",
+    "WWEWSH99NTG8",
+    "WWS524GWKTBQ",
+    "WWE9Z1B3EF69",
+    "WW607X60CDS4",
+    "WW60D38662MB",
+    "WW4PTB7981VF",
+    "WW4NHUW7KNEF",
+    "WW4TCRNUSN1M",
+    "WW4QUFMNX8NW",
+    "WW693KQGUN33",
+    "WW66W0C9HBCR",
+    "WW64K72D30D4",
+    "WW3BDWW8YKEM",
+    "WW0V9QP93VS8",
+    "WW0V9JVYNWC8",
+    "WW0V9C9B6YEV",
+    "WW0VDXJ1BPHH",
+    "WW0VFR2EUERG",
+    "WW0W1DZCPQ6N",
+    "WW0Y378GUEEZ",
+    "WW1J92W6TMP7",
+    "WW0MFCTTBVCC",
+    "WW0TU7X25TBT",
+    "WW0SKJBZC6X9",
+    "WW0GEYRDT0F3",
+    "WW0KH51FMCSX",
+    "WW1MBZNSXN1M",
+    "WW1Q444M0R4Q",
+    "WW1MFR3EUQW8",
+    "WW1MCVJWFGY2",
+    "WW1MCGJKPY32",
+    "WW1MSP3R5F6Y",
+    "WW1SECSHRFG1",
+    "WW1KHUFS83F7",
+    "WW15Y1ZR4C4C",
+    "WW1WHFC35YMQ",
+    "WQPUYY7S4GV2",
+    "WQPVR4HUTRT6",
+    "WQPVNJZ60FQ0",
+    "WQPVRC7XNMRC",
+    "WQPVJMRRPS1G",
+    "WW0N9C670PS3",
+    "WQPUZN3QU0QH",
+    "WQPYNKT52YS4",
+    "WQPV8094SMJ5",
+    "WQP25VRNY82K",
+    "WQPDQBUDPM6K",
+    "WQPFR2F4HVQK",
+    "WQPU2KPTW6QH",
+    "WQP7SDTN18D0",
+    "WQPGY1VXPC59",
+    "WW0JW67UUMPP",
+    "WW02P7XHT0KB",
+    "WTBXCVVWGV3X",
+    "WTBXFV7X18K5",
+    "WW02BEK9YDH8",
+    "WTBXFEC4SER7",
+    "WW02SZXJ3CYB",
+    "WTBX726FWQJZ",
+    "WTBRCH772XTX",
+    "WW0922H394YZ",
+    "WTBTRNNDX9ZJ",
+    "WW04RS2Q9T9V",
+    "WW3M645C7VU9",
+    "WW3M6GBCXPV8",
+    "WW3M6J4GNWC1",
+    "WW3M2VSG55XX",
+    "WW3M36GRRPTQ",
+    "WW3M6GBCXPV8",
+    "WW3K6551HJ7F",
+    "WW36MVNUT2TP",
+    "WW3SW87XUJ9X",
+    "WW2VNN34YPR7",
+    "WW372S04V500",
+    "WW3HT9QF0RGY",
+    "WW3HNNYPHZ0B",
+    "WW372F92W3ME",
+    "WW36YTSBB3YY",
+    "WW34W8VCHBGZ",
+    "WW2BZF5MQKGW",
+    "WW2BZ4VP4ZYC",
+    "WW2BYFWJJFTX",
+    "WW3121D1WKYR",
+    "WW2BZVJ83JVK",
+    "WW2BZF5MQKGW",
+    "WW2BDHTQSUW1",
+    "WW1P3KWMJ3X6",
+    "WW1PYWVGSFGV",
+    "WW1R7SWJ51XF",
+    "WW381XGQVETF",
+    "WW317SR5ZWKC",
+    "WW2CSZKC3PHE",
+    "WW2835D5K7BE",
+    "WW282RRS2F2Y",
+    "WW22RQSXG9EB",
+    "WW28DD4PFZ4S",
+    "WW28349N3ETT",
+    "WW28MJMJWEFR",
+    "WW22HFX01GNV",
+    "WW0XSJBB36PX",
+    "WW0QTNY3FZZQ",
+    "WW0R9F15G9ZP",
+    "WW0NW37GHRX1",
+    "WW3G3XDR3729",
+    "WW3GD3N1D5CE",
+    "WW3U5X7UDMJ9",
+    "WW3VM2NJ4X3Z",
+    "WW6HH3BTCHDH",
+    "WW6KU1X7HWMH",
+    "WW3G3XDR3729",
+    "WW0CWDZP17BC",
+    "WW0CTFQUC063",
+    "WW0FJUQZWUZD",
+    "WW11YXTYUUEZ",
+    "WW08W61WE9KG",
+    "WW0DQH6QDTSM",
+    "WW0FSVSCCNKE",
+    "WTCP494CDTDN",
+    "WTCNFQTJ89KK",
+    "WTCP44TJ8VH0",
+    "WTCPH4KRB0VV",
+    "WTBY1J8ZZGEM",
+    "WW102S9RC2VQ",
+    "WQPJF7T25VCT",
+    "WQPJF4089RWV",
+    "WQNVRSVYPSG6",
+    "WQPMYCTVGTZ3",
+    "WQNCXN85SS19",
+    "WQPT9WJ1RVTB",
+    "WQNU6UJJD4RU",
+    "WTB58RQWFJC5",
+    "WTB5BB88DRS4",
+    "WTB58TBXWEYG",
+    "WMZYW6MP8US5",
+    "WTBM72S5FCE0",
+    "WMZM2F3Q038U",
+    "WMZGCUGMSW32",
+    "WMZS10WDJYSC",
+    "WMZK2Z1K0R8G",
+    "WTBK1B945WX1",
+    "WTB4P8B739CF",
+    "WMZCH84F8XRU",
+    "WTB8HKZ2GT2E",
+    "WMZ9YMNNV393",
+    "WW45ZXMVB36N",
+    "WW45YWXD3T0C",
+    "WW45XSKNVP4C",
+    "WW1V5GG4GKNJ",
+    "WW1GFRRMV36Y",
+    "WW45BPMMYC2Q",
+    "WW1CZDQBHSR6",
+    "WW47SNR6S8V1",
+    "WW4DDX7K1NKP",
+    "WW4BCQVWRDK3",
+    "WT9NG9P4ZDHG",
+    "WT9NER49RVET",
+    "WT9NSU5T2MR4",
+    "WT9RNJY4W7J9",
+    "WT9WNT5DH09S",
+    "WT9EVYJF1525",
+    "WTDHCVP8QVSS",
+    "WTDR065W56GC",
+    "WT9YC946C60E",
+    "WTF03ZXWQYHT",
+    "WTC849PU6V0D",
+    "WTCX2BMDDWHP",
+    "WTCX2VDHGZTY",
+    "WW13FF2BPHMD",
+    "WW12Q1N5Q2TT",
+    "WTCQXZCNMT12",
+    "WTCY42R3J76B",
+    "WTCZMMY16W9U",
+    "WTCXYHM56P8X",
+    "WW19V6R0NUR4",
+    "WW40EVCGP195",
+    "WTCWQ97SK5CW",
+    "WTC5DEFF6TD5",
+    "WTC59FGT5T22",
+    "WTCJFSDUDE40",
+    "WTCM228GGCX8",
+    "WTCE86P00T7N",
+    "WTC36Y8UZ0MW",
+    "WTC4DE4CFE4J",
+    "WTBD4SMPG6H6",
+    "WTC7DP7NUJGG",
+    "WTCHD4U28XCH",
+    "WTCF23VYS4QP",
+    "WW0P9B6381U6",
+    "WT3Q0FW9ZJ3Q",
+    "WT3Q15127BGF",
+    "WT3Q05M8D0GQ",
+    "WT3JYZUB3PKY",
+    "WT3JYFXEDP1P",
+    "WT3MC4WT3FKT",
+    "WT3Q6F0VYYG8",
+    "WT3M9BFEN0YH",
+    "WT3NJN4YMV8N",
+    "WT3H7VVXDGNX",
+    "WT3JFYFJ7T4T",
+    "WT3K9MJ39443",
+    "WT3RDE9WY1J4",
+    "WT3XS24F3BU6",
+    "WT3GC9DRC209",
+    "WT3GFQ2E83RH",
+    "WT3GG9EZF2J9",
+    "WT3G8NNE5PV2",
+    "WT3EY9EXU019",
+    "WT3CV6N0FE3C",
+    "WT3G0PW95NTM",
+    "WMYC8VK3H18J",
+    "WMYC3Y8SV0MN",
+    "WMYC8ZG8115H",
+    "WMYFCB88T5T4",
+    "WMYE8XMQUMZE",
+    "WMWRK77135MQ",
+    "WMWPBEXTTK9V",
+    "WMWWRWPJK123",
+    "WMZ31TW3KRG1",
+    "WMRNSHZ87YY1",
+    "WMRNSPPT7TUH",
+    "WMRNMGN3GBDB",
+    "WMRNEGFZKJCH",
+    "WMRJXW7VJMW8",
+    "WMRPJ1SB0P8P",
+    "WMX2U0N7ZEBC",
+    "WMWF25JDYP96",
+    "WMQZMKMJV2TC",
+    "WMRJ3FYU9G8T",
+    "WMQEY3ERVBJ1",
+    "WMRKBN5KV4XR",
+    "WMRRRDEEWB3J",
+    "WMRMP7S7TG0S",
+    "WMXY3PVX93RV",
+    "WMXWPE9J39Q2",
+    "WMXWR9FQ1X17",
+    "WMXYBV9K9THS",
+    "WMXSBC25GV7U",
+    "WMXRSDT43S40",
+    "WMXJ7E9F2YSR",
+    "WMZ2JNEE5T7P",
+    "WT8NV9N4C6JE",
+    "WMXU6Q3YQSD6",
+    "WT3SYNJHF48X",
+    "WT3E17UHSWMM",
+    "WT3TDX5CTXP7",
+    "WT3SYQ9ZG5M7",
+    "WMXB90VDC7PZ",
+    "WMXB9J4RH898",
+    "WMXB1PTX96XF",
+    "WT2N9UF22NU3",
+    "WT813F662JHK",
+    "WT82MXHBT507",
+    "WT3PBQDH23US",
+    "WT2ZZUXQMFTK",
+    "WT91C2YKMQPR",
+    "WT95SG5SSDX9",
+    "WT8BKRN0X55E",
+    "WT8B0670UF1V",
+    "WT8CFUE0ZYRZ",
+    "WT2YQ78MPNPG",
+    "WMRU9C7MH9C3",
+    "WMRU6PDDV99V",
+    "WMRU9C7MH9C3",
+    "WMRG1F56KW32",
+    "WT238SSDNDUS",
+    "WMRFY4V9RVEX",
+    "WMRCJSPJVCDT",
+    "WT29T8GV8DEK",
+    "WMR7XQH7JZB8",
+    "WT3TJZMB152J",
+    "WT3TNHBFY1PX",
+    "WT3WMBJB9JB5",
+    "WT99BNREPWDS",
+    "WT6P1GRDQZUE",
+    "WT6QBJU7DR7Q",
+    "WT3VPP301EMT",
+    "WT65FXJW9BQQ",
+    "WT67N5CSSY3M",
+    "WT9C3S4K9M28",
+    "WT61V6HBY5KC",
+    "WT33C6J2C563",
+    "WT33BG1B7CC8",
+    "WT2FXCEQNM5D",
+    "WT0YQHC1W5PQ",
+    "WT304G6J5X68",
+    "WT32MUWBMRVJ",
+    "WT2CP6KGS3D9",
+    "WT8S7Y3W2KX4",
+    "WT8S7WJG9YYR",
+    "WT8T4P1VBGB4",
+    "WT8GYH1PY5PR",
+    "WMMU75CW7CKH",
+    "WMMU75CW7CKH",
+    "WMMKQGBQKCRH",
+    "WMQN0FWCYM6Q",
+    "WMW2WS7Z77D8",
+    "WMMFE38YHVHF",
+    "WMM8GG0DE34B",
+    "WMJZCMYWKYB7",
+    "WMQ4PG1KHGFX",
+    "WT2SV8EY0D76",
+    "WT2M09U9QEH8",
+    "WT2QRPRCSNKH",
+    "WMW7Q9T3W529",
+    "WT029G15ETRJ",
+    "WT027GXDDZVH",
+    "WSBRGN2DUPB7",
+    "WT029SWNTQ9M",
+    "WT02FBTQR9TC",
+    "WT02H4GSFM21",
+    "WT01RK950X33",
+    "WT02TNDSJP30",
+    "WT0B1SWCDUM4",
+    "WT009NU2JJDW",
+    "WSBQQ66C8040",
+    "WSBQRPW5R0E0",
+    "WSBQNDXN4W0R",
+    "WSBQTGJS3ZM1",
+    "WSBQM479QTF1",
+    "WSBMWDBCBUTQ",
+    "WSB9DGHQKKUC",
+    "WSB8RQY12DPE",
+    "WS8YSUSC1JU8",
+    "WSBTQM1T7TUG",
+    "WSBQ3F31E8P0",
+    "WSBQ3PSWU03K",
+    "WSBQDD9F5K58",
+    "WSBQ3F31E8P0",
+    "WSBJB8JFGN9T",
+    "WSBNBKW84135",
+    "WSB118FZZ57Y",
+    "WSB148ETSU8F",
+    "WSB0FX94CB94",
+    "WSB161E8EB7F",
+    "WSB117TP0EC6",
+    "WSB5J0XQZ2HM",
+    "WKZCMJ9RDU2U",
+    "WSB05F5C931H",
+    "WSB6BMJ6JXGV",
+    "WSB641Z8MVBK",
+    "WKZ8R75KC3G6",
+    "WS8NRCWGESFY",
+    "WKXYM38EEUCW",
+    "WKZ7089YZ20M",
+    "WKZ6CN1JMM0C",
+    "WKZ4ZSP7H0ES",
+    "WKZ7008UVZQF",
+    "WKZ7NBTYG8PM",
+    "WKZ72J7QT1P7",
+    "WKZ1S50Q6UV9",
+    "WKYFQ9196W2T",
+    "WKY9UH69ETRX",
+    "WKWR4W8Z9P0U",
+    "WKWY67QTBJNG",
+    "WKWQN2S86K61",
+    "WKY8J6N39C4U",
+    "WT0RN4EKXHCD",
+    "WT0RN5QNW4KR",
+    "WT0X9MY4SEDS",
+    "WT0RE7SWF39G",
+    "WT0RN4EKXHCD",
+    "WT0PCTFYRNGG",
+    "WT070TH9NEKX",
+    "WT0G2S66JU43",
+    "WT07V4YK4VP7",
+    "WT0XWNDM6WK3",
+    "WMPMM26US87X",
+    "WMPMM3CHK06D",
+    "WMPMJ5PRMJ98",
+    "WMPZ27XXYMQP",
+    "WMPS7VN4DN7R",
+    "WMR2WCVZ78R6",
+    "WMPRS9JN9TFH",
+    "WMPK2V168Q2Z",
+    "WMR0Q8B7YPEM",
+    "WMR89EV1XBMZ",
+    "WMNT9YCY99D6",
+    "WMNTEJXJNE5N",
+    "WMNWGPJ2PST9",
+    "WMPP2EEPGTMR",
+    "WMNR680G3J0Z",
+    "WMPFEYKZJDQM",
+    "WMPFEV7VN8Z5",
+    "WMPFTN3R4F2V",
+    "WMPZJSRNVUFW",
+    "WMPDR3ER337R",
+    "WMP16Y7VMZ6Y",
+    "WMPUJ7BX7VC9",
+    "WS86EV4EKUK4",
+    "WS86EW2H7GJD",
+    "WS86U09ZVUSD",
+    "WS84MHP2P7SK",
+    "WS826PZTTZ0M",
+    "WS8KTSUFM103",
+    "WKXCT09Q6C8G",
+    "WS2PC4H6TJD9",
+    "WS8C6G5PXCPY",
+    "WS9H2E9R12M7",
+    "WS8XCS8DY29X",
+    "WS8EB9E86PP2",
+    "WKXQ7GRJYT07",
+    "WKXMHN5QNGN0",
+    "WKXQ7E2TUMP7",
+    "WKXX1NWXTZHU",
+    "WKXNHJZX5UWN",
+    "WKX7SXTN1WFH",
+    "WKX35PD542YQ",
+    "WKRPV6H49J8C",
+    "WKX9EH2FY1CH",
+    "WKXB2DQYZQY8",
+    "WKXG3WS4GW0Y",
+    "WKRR5PFH4KNQ",
+    "WKYHZ4GWCU8B",
+    "WKYHZVJMT0CG",
+    "WKY5VS08DDJN",
+    "WMN3ZYB3B2TM",
+    "WKYR71NXU469",
+    "WKYWU69VUC0P",
+    "WKY0BEX9J71C",
+    "WKYND99FT2W1",
+    "WKVESNX1V3U1",
+    "WKVUPV4EC4ZS",
+    "WKTZPYDX9PPS",
+    "WKWHFH5773SF",
+    "WKY4EP87RRX0",
+    "WKZTU85FVNSV",
+    "WKZTU89M9NDC",
+    "WKZU1JJEC6ZU",
+    "WKZJUEWPMYZJ",
+    "WKZJRWUZEJYP",
+    "WKZMT4ES5W70",
+    "WMN114DHVC2T",
+    "WMN10GQZYQDK",
+    "WMN2S17C2JKC",
+    "WKVZN00K91EK",
+    "WMJFE6BFSFHU",
+    "WMJGRHKDNHJC",
+    "WMN4VFP5SDWN",
+    "WMNHGXQ34XBF",
+    "WMJZDHU7PY4J",
+    "WS0E9D8WN298",
+    "WS0E8F6N4RPM",
+    "WS0E96FT02NG",
+    "WS0E66Z20TDM",
+    "WS0EE6PJG2NP",
+    "WS0EC2PHQX3N",
+    "WS0EMWYGT1DG",
+    "WS0DE3FVQQJF",
+    "WS0T07U6CHNV",
+    "WS09XPQTZJDF",
+    "WS0VBX4KTY4M",
+    "WS0UW38KR4ZC",
+    "WS2V1N2FZZ77",
+    "WS2V06ENKZ1F",
+    "WS2V148YRZ56",
+    "WS2U3HBGRV7Q",
+    "WS3JGWP0R9HG",
+    "WS2YSMWJX4GE",
+    "WS34T0FCJBBP",
+    "WS2SCX09YQC9",
+    "WS30YTVCUV5Y",
+    "WS2WGQFBY7TC",
+    "WS3QBUYWX53K",
+    "WS10730EM8EV",
+    "WS10M1282EDZ",
+    "WS105K2T7CJQ",
+    "WS100QW1GPVQ",
+    "WS0CQNGUGPVU",
+    "WS11R8SX9P8H",
+    "WS10R6V1Z3W3",
+    "WS115H2FNT23",
+    "WS134N2PPHDH",
+    "WS112TF588VD",
+    "WEBY8Q5HHUCU",
+    "WEBWXTUKFZVF",
+    "WEBW3TPBZK4N",
+    "WEBTS3XR5D0W",
+    "WS4UZ4EZ953Z",
+    "WS4UZZ55FE62",
+    "WS4UZW19C9YK",
+    "WS5H2PDDMW50",
+    "WS4UMK1T8FMS",
+    "WS4U33H9BCEJ",
+    "WS5J94MKFJNZ",
+    "WS5JNZ7R7SKM",
+    "WS06YNEMPP18",
+    "WS06YJ1QBPTV",
+    "WS07NB3R6P5J",
+    "WS09DNWE9K51",
+    "WS07B3VRJ95C",
+    "WS0628UDNTKS",
+    "WS02MNW64CP6",
+    "WS03H2M8FGM9",
+    "WS02NRFNW3V1",
+    "WEBRU49CJZSE",
+    "WEBNW67ZSKX5",
+    "WEBP7F5UCQ3H",
+    "WS03D9NHZG9K",
+    "W7ZY5MWRGETJ",
+    "W7Y3P046TR7U",
+    "W7Y3P80FXRKU",
+    "W7Y885QFFQQT",
+    "W7Y8CBCC9WF6",
+    "W7Y3N2HDDR6H",
+    "W7Y3SU1EE0Y7",
+    "W7W7DUZQG4DJ",
+    "W7Y6VRB1THP7",
+    "W7WR0BMGCFTH",
+    "W7YCBTHQB1D9",
+    "W7YGK0CKZKF9",
+    "W7YG5UHY0DC5",
+    "W7YFMCGWX6QZ",
+    "W7YUDQQT20NV",
+    "W7YEM2YKCUFC",
+    "W7YZHSXQ4MUP",
+    "WKPGPK45UZQM",
+    "WKPGPSCPVC6T",
+    "WS05C2MS6B9J",
+    "WKPGNB7X6ZJM",
+    "WKPYQMTN8ZK0",
+    "WKRB0DWBP7NT",
+    "WKPM31RCDK9F",
+    "WKP7XQK6TBB9",
+    "WS0HSP55471W",
+    "WS17E8Y5G0RU",
+    "WS176DZ1QKTP",
+    "WS13SYDE8K43",
+    "WS17BEB1M10N",
+    "WS1DDX2S1WRZ",
+    "WS1NZZFM3BWE",
+    "WS6D4KH12059",
+    "WS6D64N18D5J",
+    "WS6D0U112BPC",
+    "WS6FX8F350FZ",
+    "WS4X5XPWQ1NV",
+    "WS624KM4KE2D",
+    "WS67UBV4XEYW",
+    "WS6S7E03JJQ6",
+    "WS633S25BQQ9",
+    "WS4196CZ5GG1",
+    "WS448MS9ZY2G",
+    "WS4HX9TU26F1",
+    "WS44X9VV2Q44",
+    "WS1WFPCVR8WG",
+    "WS1X4107UC2Y",
+    "WS1YKVXW8X2B",
+    "WS3CNE62XTSE",
+    "WS36TH3V9370",
+    "WS3EP6CRX477",
+    "WS1XE8KCWCFD",
+    "W7ZSKJM3GP7Z",
+    "W7ZS7KRD3R55",
+    "W7ZSMP4KPPW5",
+    "W7Z7EZRNYTB7",
+    "W7ZQPTEXYG9J",
+    "WS0QU43YTBHW",
+    "WS0QUDT8X9DW",
+    "WS0QFZVT2B9G",
+    "WS0XZ7NP0DXS",
+    "WS256BQWM4Z0",
+    "WKREY2Y4T7CQ",
+    "WKRUDUPU3TUP",
+    "WS29S3Z6EW8W",
+    "WKRUVR09GYC9",
+    "WS0GHKN5ZP7T",
+    "WS08H58U92R8",
+    "WEEJ79ZFGR3H",
+    "WS4YTUBPDZY9",
+    "WS4YTY74NHT5",
+    "WS4VRHGY1HCF",
+    "WS5NWKUZ9XG1",
+    "WS4VBP4H9W1J",
+    "WS4TZGH3YWW9",
+    "WS4Y14Y3NW7Y",
+    "WS4M7C2CDSEF",
+    "WS4EN02X2RHM",
+    "WS4SE9XSQ4YC",
+    "WKPDMK3Y8JWT",
+    "WKPDMQRVRJH7",
+    "WKPEK9EFTPUF",
+    "WKPC1U7MHD9Q",
+    "WKPK1UVST3GE",
+    "WKP3DC4UC7TS",
+    "WKJ1F428HH2F",
+    "WKJ41BUVFEZJ",
+    "WKJ1C6HK1RFJ",
+    "WKHCXEZ30PHK",
+    "WKJ1BMPFBBPH",
+    "WKJ12ZDVDBWV",
+    "WKJ1KT88R5QS",
+    "WKHGZ9ZZ1C53",
+    "WKHEF7F1MC5W",
+    "WKHYVQNGP8MZ",
+    "WKJJR321EKT4",
+    "WKJK5G1DRC8P",
+    "WKJ9N2ZBXD3M",
+    "WKMF3VJHWB9X",
+    "WKMF3E507941",
+    "WKMF6E9986TH",
+    "WKMF3NBB820V",
+    "WKMF97SF9JK7",
+    "WKMDPF5WVXUT",
+    "WKMSJX6UEMP3",
+    "WKQ52BQYQ6F2",
+    "WKMZ92YXKUBK",
+    "WKMWW5C7MD8R",
+    "WKTFWJ073H76",
+    "WKQRV6P6WM81",
+    "WKQRV12W5W7N",
+    "WKW2JBGCJJ91",
+    "WKQRTRKBSFQF",
+    "WKQRWJXEGS3R",
+    "WKQQVD0VZWM9",
+    "WKQRE8VPQHGS",
+    "WKQSFP11FWFC",
+    "WKW2W7SD4R6N",
+    "WKWGX2QTNW6D",
+    "WKW9WRGRMFJH",
+    "WKQNNEKZP9XB",
+    "WKX0CQ2ZY8R0",
+    "WKW4Z0EXCU8F",
+    "WKWSJ6W79ZDY",
+    "WKQSJ7Y21UFB",
+    "WKQV3BPVNPMX",
+    "WKQ7RVBM07JM",
+    "WKPJS42KFVJX",
+    "WKPJT196EK7E",
+    "WKPJS5BJ5QEV",
+    "WKPJ5M5RV8GD",
+    "WKPJ5P7PQU7M",
+    "WKNVH01QR7FS",
+    "WKQ9DVQPNWUZ",
+    "WKNFMKMNTMTV",
+    "W7VD5N6F061Q",
+    "W7VD4VVDG5RQ",
+    "W7VD53NHY2TV",
+    "W7VF3ZENHN9Z",
+    "W7VEKBVHBKV9",
+    "W7V53W659VPW",
+    "W7V54HT0496N",
+    "W7V5CE453YPS",
+    "W7UY10K9H778",
+    "W7UF2ZMM76GH",
+    "W7VHZEYSJ2W6",
+    "W7VKB6R5BC54",
+    "W7VJGTXK3GR7",
+    "W7VXX5MB4X51",
+    "W7VYSY5UHHBS",
+    "WKJGQJ0R3057",
+    "WKJGMRC50RFB",
+    "WKJGMCKCVNJM",
+    "WKJGDD9SRNM3",
+    "WKNMZZ0K8QJM",
+    "WKNM0GVFCUJJ",
+    "WKN2DZXM71F0",
+    "WKN2DRY662FY",
+    "WKN28259H5DJ",
+    "WKND5EK53SYX",
+    "W7YRJ301TJXQ",
+    "W7YNWRVWQTP2",
+    "WKN1KJSBKE3U",
+    "WKN3R043T6GZ",
+    "WK5ZFNY7D4FJ",
+    "WK5ZFPDUE1BJ",
+    "WKHNCPBV28D7",
+    "WKHNM84RUYV5",
+    "WKHS8J32GEN4",
+    "WK5UDPN7454N",
+    "WK5M0PRP3SRT",
+    "WK7F90CCHBZX",
+    "WK7UBX53FYY3",
+    "WK7D1RDMF2M4",
+    "WK6ERS56ZE00",
+    "WK6UUV4ZWYST",
+    "WK5ETDSWJ8X2",
+    "WKR6FMS0Z3UW",
+    "WKR6FKD48S16",
+    "WKR70SJ1M63M",
+    "WKQC92407NS4",
+    "WKR5S9W1TGRJ",
+    "WKRJK00M4ZMX",
+    "WKKUE0QPVT8X",
+    "WKKU6R5K3T89",
+    "WKM72U54FE10",
+    "WKKQNGKZN9E2",
+    "WKKNNXNG9CZB",
+    "WKK5EVPQJG9Q",
+    "WKK77R8RQ76C",
+    "WKMKYP49CYV3",
+    "WKKVR21JPZ6R",
+    "WKK32S35FNK3",
+    "WKKB5UK42E64",
+    "WKHYCPUTK2EE",
+    "WKJWVXFV72X7",
+    "WKJXJ8BJEYWS",
+    "WKM2BVG1FT1N",
+    "WKMBRGDE35ZE",
+    "WKJYR85RBNZ5",
+    "WKQ370WXKN48",
+    "WKJRT2K9WCGF",
+    "W7UR7MB3QQDU",
+    "W7UR6Z32S5CC",
+    "WKH8XRDMK1Z2",
+    "W7UJUKTUXG48",
+    "W7GZPKTY1MYX",
+    "WKH1ZKHDMH3W",
+    "WKH5MC9DTZVF",
+    "W7GVV4UFR6C5",
+    "W7W3YQKE4QDH",
+    "W7W3VDWPN4P9",
+    "W7W3YQZT42Z8",
+    "W7W3Z1F46YX5",
+    "W7W3ZQE17J8N",
+    "W7JZGDR3YYTF",
+    "W7Q09504MN9X",
+    "W7MBJ2MWU8XX",
+    "W7MB4E3DV1CS",
+    "W7M8KNJT9XDF",
+    "W6ZZU0E5REV5",
+    "W6ZZU0QTK2SN",
+    "W982Y5WFG81G",
+    "WDC336NBG99F",
+    "W7MZJ3D2NP9X",
+    "W7MFU4Y12VWZ",
+    "W7QT9B3G3S46",
+    "W7QZ1QFP50HH",
+    "W7QDBNQVFQN8",
+    "W7MHXVJCW6NC",
+    "W7W2N6K8F64J",
+    "W7QQ1QHQ7VWQ",
+    "W7W0PPEX9F8F",
+    "W7TCRF6D3JPS",
+    "W7MV6SENCGG4",
+    "W7MT92RG3HJD",
+    "W7MDSJR4TMK4",
+    "W7Q1PZC6KCFW",
+    "W7Q1BR3PE78W",
+    "W7QH70RCB3PE",
+    "WMMP6DW7X06M",
+    "WMK35FQ793S3",
+    "WM7B0UQQJ0GH",
+    "WM5XWZZPRXZ1",
+    "WM7B3N6262QC",
+    "WM78N6K8U9KE",
+    "WM5XZE5ZMCBN",
+    "WM5ZFDVK7WMM",
+    "WM79T0YJEDWK",
+    "WM5V4UU0J05Z",
+    "WM70VWWZN938",
+    "WM7C46MEE1DC",
+    "WM5XPUMQZUUY",
+    "WMJRGPGBSWYR",
+    "WMK1UTTM2GE4",
+    "WM5SCJ07NZ5W",
+    "WM5W6QWEZ7RF",
+    "WM71JRZDM9CN",
+    "WMHJVF9EJCVG",
+    "WM783HE03RUT",
+    "WM73V4P2B573",
+    "WM778NP51XZ8",
+    "WM5P68152M4P",
+    "WMT17HJH9J72",
+    "WMKWT11EFN9B",
+    "WMHWGGM5SUR2",
+    "WM7B0X53DZW2",
+    "WMTMBB744X9J",
+    "WMK9GMWT6GW4",
+    "WMKKDC3VH3C9",
+    "WMKU65CY23MU",
+    "WMT20F70FD1J",
+    "WMTB7P18EGH5",
+    "WMW0U3UNJEFM",
+    "WMTFWSNNK0HZ",
+    "WMKFSM6DDT76",
+    "WMJ3ZGHV603U",
+    "WMJK55GZKTY3",
+    "WMHYTMYUZEVU",
+    "WM6N2PM3WY2K",
+    "WM6N2M7XGZEW",
+    "WM3YXBW1MWTV",
+    "WM3YXEWSR0CV",
+    "WM3YRD8KCECP",
+    "WM6N2VFQ5GF5",
+    "WM6JUTP55J51",
+    "WM6PEV9CP11P",
+    "WM6P3URTYBS9",
+    "WM3YDSY8QQG3",
+    "WM3VUYBJRT0M",
+    "WM3Z7FE5E2QJ",
+    "WM6R825D72GF",
+    "WM3TGWUVQV4T",
+    "WM3EG1WRUB19",
+    "WM3V43Z3M74B",
+    "WM98MGMU14B5",
+    "WM9BHZXX8D8F",
+    "WM3T49B93EPB",
+    "WM3WR040WJFG",
+    "WM6KGN4UZDDR",
+    "WM4WBR42NUWC",
+    "WM4WBJNRWDMF",
+    "WM4QYY9QFH03",
+    "WM4X04H05E9E",
+    "WM4WD3MNCY4X",
+    "WM4R8HU74Q5M",
+    "WM4WHBH1G638",
+    "WK8R4WWPXZ1K",
+    "WK8R43389RMT",
+    "WK8R2DS5SJ8J",
+    "WK8QFBJT8Y1C",
+    "WKB8GV3E27PJ",
+    "WK8RVSSFV08R",
+    "WM4UPPEGCN1F",
+    "WM4UR1UBCUVP",
+    "WM4GTV2J6UWW",
+    "WM4UX0NC4NH8",
+    "WM4VVFX75CZ5",
+    "WM57BNX09TRS",
+    "WM4BR05Y1H9G",
+    "WKGPXFRG0DYZ",
+    "WMD1P5P1QK95",
+    "WMD30J8NSKYC",
+    "WMD61VWS4RPT",
+    "WMD2W0CDUG1R",
+    "WMD0HZWRS4EF",
+    "WMD147N32UTG",
+    "WMD475H4GZX6",
+    "WMD7P0YN1CHN",
+    "WMD6ZWXSH9T8",
+    "WMD7PFN8BEQQ",
+    "WMD77ECE9D52",
+    "WMD8ZJSFTKNY",
+    "WMDCTGRMEVZ4",
+    "WMDGCNN6NE7G",
+    "WMDM0BDHVMUV",
+    "WMF26TUKJW12",
+    "WMDKZ9KEGVMH",
+    "WMG22PXN3WPT",
+    "WMG282Z7NHF2",
+    "WMERGHTGZ80X",
+    "WMG39X06UZU5",
+    "WMEX67Q9R7RY",
+    "WMFC6E40K8PN",
+    "WMEP9HMKDHNU",
+    "WMEKD2RBEUSY",
+    "WM7JD7CXZK37",
+    "WM7JDJQPBNBD",
+    "WM6UXWKR9SYU",
+    "WM7PJEQFQXCE",
+    "WM6ZTGXQGCP4",
+    "WM6Y4DHB00XN",
+    "WM68Q2Z5FRTM",
+    "WM68QF9EBXED",
+    "WM68QUT8KRYM",
+    "WM4RVZF2EYBZ",
+    "WM693VM3N46E",
+    "WM6BE5B9WB2P",
+    "WM3B1R518R80",
+    "WM3B1HGHDDRJ",
+    "WM1XK712G7EV",
+    "WM1Z63UKTHX2",
+    "WM1Q3S60DMF0",
+    "WM1YJRQ4FDCC",
+    "WM608JT7YB87",
+    "WM39HU1MGCTM",
+    "WM1UU3CDMRRJ",
+    "WM1QMCNVJ6VJ",
+    "WM1SH26FCVS2",
+    "WM386SXB6ZBT",
+    "WM7RJGM47PV5",
+    "WM7RNNEPYQR8",
+    "WM7RNSN3MYXC",
+    "WM7QVXUHQCGG",
+    "WME6MEJFFPS6",
+    "WMEBC1CYHGZT",
+    "WME8T8UDVEPR",
+    "WME9FKW8ZQRZ",
+    "WME2377KNFF5",
+    "WME7KPDB5428",
+    "WM3FFWQTYQ52",
+    "WM3FFTW3T7RB",
+    "WM3GG9EZF2J9",
+    "WM649VRDWVKD",
+    "WM3D0NZ8XS68",
+    "WM3DG8UZNVDE",
+    "WM3CENMK27H9",
+    "WM47STMVQSWN",
+    "WM47STK22SHH",
+    "WM4SHGUP7MC9",
+    "WM4770DVXEF2",
+    "WM4EQYJSKKNM",
+    "WM4DEDB6T4NK",
+    "WM43DRT0U80E",
+    "WM43YGNV2B7S",
+    "WM4262JNHS8E",
+    "WM4BFXF5KWR5",
+    "WM4HN06FCJW2",
+    "WM7V66VSE5DV",
+    "WM7V66VSE5DV",
+    "WMKJ824QJCE1",
+    "WM7TVC7YWSZB",
+    "WM7SDMN9X6PC",
+    "WMKH932J19FC",
+    "WM7UVDE8366Q",
+    "WMS3W5RJETCF",
+    "WMS3TG2T9TBD",
+    "WMS3QPZ15T9C",
+    "WMSD75P6CZTD",
+    "WMS8Y9UW15VV",
+    "WMKNZ6HXJP1W",
+    "WMKP6HMJV8T1",
+    "WMSY6Q1J33Q3",
+    "WM34XCDQ1VND",
+    "WM368WBCX6RB",
+    "WM374ECSWNMJ",
+    "WM31S2VJDDWK",
+    "WM0YZZ52NKE9",
+    "WM0Y33PT1FUT",
+    "WM3544H62W30",
+    "WM35W08H3Z67",
+    "WM3HG8XNPDKF",
+    "WMEVJW5E9Q66",
+    "WMEVJQZ9N3N2",
+    "WMETP06HJ8Y4",
+    "WMSM84FE2P70",
+    "WMGBNCPHRMJD",
+    "WMS5T55UDFS1",
+    "WM67M75V9WZY",
+    "WM67MCT9JU3E",
+    "WM6GHZDCNYST",
+    "WM6SMB31Z35E",
+    "WMB74JR8MU82",
+    "WM8TQP4QFXH2",
+    "WM9EJ4B8KCMF",
+    "WM96G9WJ50XU",
+    "WM9U5PJM2KH9",
+    "WMC9TKP5WBZ5",
+    "WMFJ7B9GZ190",
+    "WM8E4DV073K6",
+    "WM8B37RS1FUE",
+    "WM9NRQ5TRCM3",
+    "WJXZ9FE6KS12",
+    "WMB74JR8MU82",
+    "WMCPN9JCSVEY",
+    "WMBFTE49U5NM",
+    "WJX5GH5PYG5R",
+    "WM2DBQKMCNNB",
+    "WM2DNQC8ESKB",
+    "WM2RWMDC014P",
+    "WM0HVXQ11RVD",
+    "WJRFFFB92TEX",
+    "WJXBJP9RDF8F",
+    "WJXDEH0YQ01P",
+    "WJX5GH5PYG5R",
+    "WJX24F6BC6JT",
+    "WJWJ50XUBMZT",
+    "WJW38GMV9VV4",
+    "WJVG87F4RTTG",
+    "WJXRE4D46KN2",
+    "WJR69TQ6SM74",
+    "WJQ6XJ66TM7F",
+    "WJNUX481KWCS",
+    "WJPM4KU0P2HX",
+    "WJNE7HM6PSJ9",
+    "WKBWQZEYXGPF",
+    "WKBWXPN9R8ZN",
+    "WKBNBSTB513E",
+    "WKBHJ9QP36TE",
+    "WKBEVHJ0WD4Q",
+    "WK8XWZ0HJ8Q4",
+    "WK8ZQRB6ZPZC",
+    "WKC1FXFY4TDP",
+    "WKBGV0KH41VJ",
+    "WKCJEWR0XWSB",
+    "WKCMTD8K5QK0",
+    "WKCPKKVH6DW6",
+    "WM0C4E7ZYYXH",
+    "WM0DKVMGV99X",
+    "WM0FUZSF35HD",
+    "WM1HF9FF6X6J",
+    "WM134V2FPNV8",
+    "WM18UF3KEVVQ",
+    "WKEZD7MXE04F",
+    "WKEZHKZJKNZX",
+    "WKEZKQP0SPXT",
+    "WKEY53GB7KZZ",
+    "WKEZMPUFZRC1",
+    "WKEZFBUNM07Z",
+    "WKEZ65M9FNBQ",
+    "WKU1FPVNJTTP",
+    "WKGFHTQKVQ0H",
+    "WKGB9K30N480",
+    "WKEXNC30FYDP",
+    "WKDX33TQ96BZ",
+    "WKDX1WQZTN43",
+    "WKEJ052UM4HH",
+    "WKDXH1Q2BNXZ",
+    "WKD6360TZ7W0",
+    "WKUJ8GKSN3ZC",
+    "WKUJ318BBTD6",
+    "WKUJC00FBWDM",
+    "WKGUWV7Y7JQW",
+    "WM5BN8ZVNKJ4",
+    "WKUPNBNHE18K",
+    "WMH6KTK5U3TZ",
+    "WMHS23RYJWPN",
+    "WMHDQCEZ61QR",
+    "WKUX55Z31CVS",
+    "WKUMVZ2ECX0W",
+    "WKUDYG5ZFPY2",
+    "WM59157PCQSS",
+    "WM54T6B6SD0K",
+    "WKGWM8KXJXZK",
+    "WKEM6FWMMFWJ",
+    "WKEM74RR02GU",
+    "WKEW3C8GSKYN",
+    "WKEJWRKV1EE5",
+    "WKEHQCGKG8HR",
+    "WKE5EKN1SQS5",
+    "WKE6MZTHE5VJ",
+    "WKFG79YD1BCG",
+    "WKFGK4NKXR2P",
+    "WKG46YX84QG4",
+    "WKG3UB8TNJ4Q",
+    "WKGS30G037HS",
+    "WKEPWZ5K58K6",
+    "WKFBMGPKGCZ4",
+    "WKF0UGW3H55C",
+    "WKF6QFYG8YE9",
+    "WKVTSQQ2WQS8",
+    "WKVTS3EBTW5E",
+    "WKVSSCV587VD",
+    "WKVMSFWHHY68",
+    "WKV6YT145ZYT",
+    "WKUUWCFETGC4",
+    "WKUYZK90PC67",
+    "WKVP69NRZ463",
+    "WMHBU66SDTGQ",
+    "WMJ4SCP234PB",
+    "WMJ8KBJN0KTE",
+    "WK6WEPSTQ9P5",
+    "WK6WEJ9VE4V7",
+    "WKDB9MMSRXS6",
+    "WKDDSJN72HRF",
+    "WKDFFQ4YESYX",
+    "WKE0KH7CPQVV",
+    "WK7RNQ59VHN4",
+    "WK7NPGRZ09WB",
+    "WK7NBHBYT5KH",
+    "WKSZ3058QEG5",
+    "WKSZ0YTRER5H",
+    "WKU9P2FRU5RQ",
+    "WKUCU2DT4T5Q",
+    "WKV33JDRES3S",
+    "WKV1GHM19J7R",
+    "WKV6S7BQCZ1P",
+    "WKV9HUTH27TX",
+    "WKTXUBVN22MX",
+    "WKV05F4CS1JH",
+    "WKTP8ZHHNBQ4",
+    "WKTT5R40C63U",
+    "WKT5T2MV5Q2F",
+    "WKT6QPDS9GVM",
+    "WKSY54Q4TS2T",
+    "WKSWB01MEWN1",
+    "WKSTJ19D41CZ",
+    "WKSMQSH1JQT7",
+    "WKSMQWM9VDFV",
+    "WKSRYHX4G89Z",
+    "WKS8WGEF4PQQ",
+    "WKSR0NDX8P5H",
+    "WKU3VXCQ0T8P",
+    "WKS6YYHYWSGR",
+    "WKS6FNHN9KBP",
+    "WKEBTJKURR94",
+    "WKESN6DE8Z9N",
+    "WKSN6PJ4MTM5",
+    "WKEUDUU4M15C",
+    "WKSEY9S83PJB",
+    "WK3N92NQV6RQ",
+    "WK3N3P64940F",
+    "WK3N9S7VVVX0",
+    "WK3N37XB7ECR",
+    "WK3N3H54GDZX",
+    "WK9K7GTRH227",
+    "WK3JE328T85V",
+    "WK2UQEP11M2F",
+    "WK2ZKRNJPHG8",
+    "WK3MG0X990WW",
+    "WK3KVVNZTQTJ",
+    "WK920WB4MN80",
+    "WK8C7G0RS11Y",
+    "WK93MWBK53KP",
+    "WK2VGBX9T0DQ",
+    "WK9C440U729C",
+    "WK9C41G417BE",
+    "WK9CDRZRM64U",
+    "WK98TJ2SKZTF",
+    "WK3WRHD4Q44V",
+    "WK3VQ05VJX7X",
+    "WK6JT3KBW0HV",
+    "WKD4H30D94F4",
+    "WK9QQ9SG8KYY",
+    "WKDJ0V5Q9F60",
+    "WK2FT8F9H0YR",
+    "WK2FMRDWCVD0",
+    "WK344HH32811",
+    "WK3HQ5011V66",
+    "WK314NUM0TCH",
+    "WK31WJRR4YFZ",
+    "WK2SKGJCJT3D",
+    "WK2CD1V6SYWN",
+    "WK28BTG9FJPQ",
+    "WK0W1N6JSQ8X",
+    "WHQWBSVQS7RS",
+    "WHQWBT9W0B66",
+    "WHQS8VUWTW0H",
+    "WHQ5VD8SFSJ5",
+    "WHQV62NT0PQZ",
+    "WHQN3KTD265M",
+    "WKCG2PQ8G1M2",
+    "WKCERY5710Y4",
+    "WKCDSRDG3ZS2",
+    "WKC1NH8H3GDR",
+    "WKFPGZ1FZ5CJ",
+    "WKCVGGEP7QYJ",
+    "WM18W5J5DJ2T",
+    "WM1FTQQP4D3V",
+    "WKFS4MH5B4GS",
+    "WKCVPTYUKTR3",
+    "WKFWQMZN42M3",
+    "WM44ZEVVB6F4",
+    "WHZ2BV37270V",
+    "WHZ2BTMRE5QP",
+    "WHZ28GME01UD",
+    "WHXXU8GYM0KZ",
+    "WK8P2RYDFPC1",
+    "WHZENYHTX2D6",
+    "WHPG4ZZB3XSN",
+    "WHPC9UB2WNWU",
+    "WHPGWHBBGJNT",
+    "WK0M3C31ESX4",
+    "WHREN6YPT637",
+    "WHPTEQP92JD2",
+    "WHPXZWFED6UJ",
+    "WK02MWSFJ106",
+    "W5YYCR4P7JS4",
+    "WHP03CNG3B8T",
+    "WHNBDZTJ61ZB",
+    "WHPPV7HP148U",
+    "WHPPVQKYQSPH",
+    "WHR5CWR92U25",
+    "WHR5NDBRW477",
+    "WHQ8DQX8USEV",
+    "WHNR2CJB9CM1",
+    "WHPJ2HUW1SU6",
+    "WHNTVZHUEYHJ",
+    "WHNEDQRDS8GC",
+    "WK2NQUD6QD0J",
+    "WK2NQUD6QD0J",
+    "WK2K88KXYTSX",
+    "WK80N37GSQP5",
+    "WK2P27W8DH3P",
+    "WHXCPD1KMBWC",
+    "WK843S4BP5EU",
+    "WK8K39CUF8NX",
+    "WK86NQDC254P",
+    "WK8C4PT7HBYN",
+    "WK2X4FKMK7UC",
+    "WK1KZS3MC5U1",
+    "WK1KGNRS15Y8",
+    "WK1QVYNGJ2MP",
+    "WK1SBYMS4EU0",
+    "WK3DC9GKM9TV",
+    "WK1DXR3KPN7R",
+    "WK1N7GYS2XJK",
+    "WK0YUQN5P07X",
+    "WK3G93E1872J",
+    "WK1H5UYS89V7",
+    "WK1KZS3MC5U1",
+    "WS4UZW6K55FB",
+    "WK0FF5J2SYY0",
+    "WK1BJGSSS870",
+    "WK4HUQ2S15F0",
+    "WK4HUQ2S15F0",
+    "WK4NQ5FU3PNK",
+    "WK4MMUFQ5UBF",
+    "WK47W8B5YB6K",
+    "WK44ZWTV0R40",
+    "WK60FDJT3UYQ",
+    "WK68YFJTKKYQ",
+    "WK5N7MWNSRK0",
+    "W5ZTJWVFU2BB",
+    "W5ZTMB87F1X8",
+    "W5ZKVZ92W8UF",
+    "W7B4PQ340D1Q",
+    "WHX38U36B3BU",
+    "WHX38U36B3BU",
+    "WHX443J6EFCD",
+    "WHX8BN6RBB60",
+    "WHXDBY0NEUGZ",
+    "WHX2NQZ63WW2",
+    "WHRQX2HQVF2W",
+    "WHRRD2UPRKUS",
+    "WHWBBUET905H",
+    "WHWEJPR1BVDM",
+    "WHXHD7J25BCT",
+    "WHXNCM8UQWRN",
+    "WHXPPSUV7NYP",
+    "WHQ5514S00XF",
+    "WHM8DSSNWK81",
+    "WHQ4GPRG06PD",
+    "WHMVHY7FUP2E",
+    "WHMSSKNKQMUX",
+    "WHM99MRZ1NVX",
+    "WHW713U75VQ2",
+    "WHW78XWW0YUS",
+    "WHY31BFZVGRQ",
+    "WHYJV216CWST",
+    "WHWWQR56MVM5",
+    "WHYYKBBJHGP4",
+    "WHYYKDR3D2H0",
+    "WJN64BXK50F1",
+    "WHYDE5VQZXJX",
+    "WJ2B9TWGFBT5",
+    "WJ2B9VM9U1Z6",
+    "WJ28WV85V8W5",
+    "WJ2BYEP4930B",
+    "WJ2FH7NHP5GX",
+    "WJ2V3H8YZGG6",
+    "WJ0PE3JNXMBH",
+    "WJ0X0DESDHZ6",
+    "WJ31XQ7SRGJ3",
+    "TVPNW82QN57R",
+    "TVPNQVH2QWTV",
+    "TVR2GE0DS3P2",
+    "TVPSWBSXPQDR",
+    "TVJGN7NYG5K7",
+    "TVNS6VN4WWKZ",
+    "TVNM6JF5QBZU",
+    "TVNN8VYUY7FK",
+    "TVNZ2TS60JDS",
+    "TVPMXMHKMC2W",
+    "TVPYK1HJNDYV",
+    "TVPF89NBR6N8",
+    "TVN3MK85JPR3",
+    "TV7C25KYBFJR",
+    "TUZHQFX485K9",
+    "TVHSJ5CX6JCC",
+    "TVJ0K80WPHWE",
+    "TVHWG7QEDUQ0",
+    "TVNBYK4QCW05",
+    "WJT157H36HS5",
+    "WJT158PWGVZG",
+    "WJTG5N3SGCS5",
+    "WJMZS5WNBCNF",
+    "WJS9W5MVXJUD",
+    "WJEFXRVFC2W8",
+    "WJMQK78M1Y15",
+    "WJKFVQQVZWJB",
+    "WJM8F9K0Q2B5",
+    "WJQ0GEN6D90B",
+    "WJKNUTV78Z7N",
+    "WJ7RFYWKMCYH",
+    "WJ70G7N4S3H0",
+    "WJ70E5WYGTPN",
+    "WJ63CZQXD7XW",
+    "WJ5N0P2FV4U1",
+    "WJ5YC735WH20",
+    "WJK1GM9T6EXF",
+    "WJJ71GPQZE7E",
+    "WJ4JMB7S80MZ",
+    "WJ1Q3KPFD1QS",
+    "WJ1Q230V5FZT",
+    "WJ0YRYDKXB3J",
+    "WJ0WWMCSGEUU",
+    "WJ1QTBQYJ7MP",
+    "WJ1JNHZ24B4Z",
+    "WJ1T6H1CP8YB",
+    "WJ118X92C2J7",
+    "WJ097Y3T2RRN",
+    "WJ1VFDWEN3G7",
+    "WJ1C8JWW7PVR",
+    "WHCRK35ZY633",
+    "WJ0KC1G62XMT",
+    "WJ97P4G263RF",
+    "WJ97N9Q6PJUR",
+    "WJ6Q3GWT4QPE",
+    "WJDE5DZ8Q1QF",
+    "WJ9WSR6B9CUR",
+    "WJ9PW4X66U4B",
+    "TVRPFX4Y6Q8F",
+    "WJDTQ58D2QSR",
+    "WJ842QWX6PC4",
+    "WJDVESWT9Z3V",
+    "TVWHBCQGYM6K",
+    "TYN9ZT6T4ZPF",
+    "TV9JG0M1S9QU",
+    "TV3SR5FNQ16U",
+    "TV8EPFU86C2D",
+    "TVBBYSRN1R0G",
+    "TVBTYHDKDEH2",
+    "TVC8MFJZ9JB0",
+    "TVEZC01CHURT",
+    "TVS86P4BSG4G",
+    "WQJ6YY8MHZP0",
+    "WQJ6ZQ76D36J",
+    "WQJ6YUKZ3YZQ",
+    "WQJ6YVZPX158",
+    "WQJDCY2TU0U9",
+    "WQJ7P51HQNTN",
+    "WQJ6WSDSFJ3E",
+    "WQJTJQM8RHQG",
+    "WQJET2GEF2QS",
+    "WQJ6QU2QSVXJ",
+    "WQJS6JVXU4X1",
+    "WQJ1ZR8NGKTP",
+    "WQJDR8U6HTKH",
+    "WQHFQHKYDTXT",
+    "WQJQWC27HZX1",
+    "WQJX9BNWGGSM",
+    "WQJXF82REX68",
+    "WQJQXUUZDPCC",
+    "WQM97H6GBQ33",
+    "WQH5TBCEVBMU",
+    "WQH5W1KDPKXE",
+    "WQH5W44QT9Y2",
+    "WQH7E2B7Y26U",
+    "WQHK7KPTX67K",
+    "WQHEBZQMZC2Q",
+    "WQHEW8UEC0MU",
+    "WQHE5BMPKZPM",
+    "WQ5YX3MG1RW9",
+    "WQHJJGCDVUJV",
+    "WQHTK9718H8F",
+    "WQ58ZYVQRFKC",
+    "WQH3F4K01K24",
+    "WQJ7398FTXFD",
+    "WQJ739F0DUXQ",
+    "WQHFGRM2FMCW",
+    "WQJ76R8T4XW1",
+    "WQJKYY2KHGZ0",
+    "WQJKKMZXFF99",
+    "WQHUQVFXVF91",
+    "WQJH5HVH91G7",
+    "WQHVKSCY5SGF",
+    "WQK8HXGNB58F",
+    "WQJPC17KZFW8",
+    "WQJJYG981MUJ",
+    "WQHFYNSV4XP8",
+    "WQJ5HS0EZPQT",
+    "WQHZ73J2W931",
+    "WQJU78X3NFJU",
+    "WQJU72QMUR28",
+    "WQNH3UHJD6KK",
+    "WQNKS3EH34V3",
+    "WQNJVX0SDWJJ",
+    "WQQ26T2V95BZ",
+    "WQQ0JS2D6EM4",
+    "WQJYVD3WX04N",
+    "WQMBJS3DR564",
+    "WQJTSQN3QMS8",
+    "WQQ9BFUTVX25",
+    "WQNK8VMBCGJ4",
+    "WQTB5QBFKYSB",
+    "WQTB5MNX09S1",
+    "WQT9XXURKDHH",
+    "WQW0P55TCY0Z",
+    "WQW3G1Y9S469",
+    "WQTGPX73BJXJ",
+    "WQT37NGUH9QR",
+    "WQSFKHBQGXQK",
+    "WQMY2KD4RDJV",
+    "WQMU8VBY9WNU",
+    "WQMG6PSRRG61",
+    "WQQM4FXQ7P44",
+    "WQQ47JPU82XX",
+    "WQMDQJ1KT88R",
+    "WMUH5K1WDWZC",
+    "WMUH5KNUSFE5",
+    "WMU59R2NCTFG",
+    "WMUKD6G2DRBS",
+    "WMUKZRE888U6",
+    "WMUES7GDRJ87",
+    "WMGUE6F8XPUU",
+    "WMGDCB8BS7W4",
+    "WMGMXE81662F",
+    "WMU9P3FKUPX2",
+    "WMUP302F8W4R",
+    "WMUY9PUWKM58",
+    "WQY1BBWVNM4Q",
+    "WQY1C2TT0M5Q",
+    "WQTXYSX6B89Z",
+    "WQYYP3NWNX6D",
+    "WQTMGUCEZU00",
+    "WQSTB3PZMEXP",
+    "WQWMKF9T74WM",
+    "WQWQG0NTSN49",
+    "WQY86134D9DY",
+    "WQWTP9X4H1BR",
+    "WQW6CY4YTUZR",
+    "WQWNPB92KU69",
+    "WQYSFKZ9HSEU",
+    "WMV9BV1YY1EC",
+    "WMVD0B77K0R2",
+    "WMV5HVR23HXB",
+    "WMUUP294PYD3",
+    "WMVJ8CSPNFNN",
+    "WMV1J8J4SR3K",
+    "WMTRY5DT9UTM",
+    "WMVB264PXTVB",
+    "WMTVK5W42YWZ",
+    "WMVFC080DEX6",
+    "WMY69QSQ7GQM",
+    "WQN0TV21C6RY",
+    "WQN0TTBE49T5",
+    "WQN3FH44QURY",
+    "WMYRWWGUER6D",
+    "WMYYEPUQ7M02",
+    "WMYNSRUNMT42",
+    "WMVW5V8XG7DV",
+    "WMVXDEK0NR01",
+    "WQ3V4QR6VR6G",
+    "WQ3V4S13X6PJ",
+    "WQ3V1TSRUYEZ",
+    "WQ3TMGVY4T5S",
+    "WQ3V2HRWPPME",
+    "WQ3NU8K6H92P",
+    "WQ92VYQZV2M0",
+    "WQ3YTMWJDDCG",
+    "WQ65CQ3C7U75",
+    "WPJFKJQ5BCWZ",
+    "WQBEJ0TNY84M",
+    "WQBEJKQP0G5C",
+    "WQB987HQ3HYC",
+    "WQ6PFTTX1VY6",
+    "WQ6PFTTX1VY6",
+    "WQD8CQQZU032",
+    "WQD2N13ESY17",
+    "WQ6EN6ZPD6M7",
+    "WQD524VQQVBQ",
+    "WQ5HTXNGNE1W",
+    "WQ5HTXRPUXMC",
+    "WQ5KJ8PFPH4X",
+    "WQ5MXN192JX8",
+    "WQ5NKEFS3RNU",
+    "WQ4VSF6UYVHX",
+    "WQ4TD8E69JH5",
+    "WQ5X15E1C2US",
+    "WQ8ZZ2UYK26X",
+    "WQ8ZZ8SD0P07",
+    "WQC79WS9F1FC",
+    "WQ9JJJ4YTF20",
+    "WQ966U0BP5TS",
+    "WNZMMYCRWTUZ",
+    "WNZMQQUDYXMD",
+    "WNYUFUV14HXU",
+    "WNZDW5YYUR0Z",
+    "WNZNX7MSF0TW",
+    "WPNBP2YTNS4D",
+    "WNZUS5SJYEYY",
+    "WQ7F5V8HRBZU",
+    "WQ7F5RDTZ0KF",
+    "WQK2GR8KNM6G",
+    "WQHX8BQ3XCB6",
+    "WQK0GD0V7UBQ",
+    "WQ72JPZQB5E6",
+    "WQ74JDNYYXCT",
+    "WQ7B6GS5M5GG",
+    "WPN41UK0D3H6",
+    "WPN41E4Z384M",
+    "WPN76W0U3H0V",
+    "WPK0M8YWC8WC",
+    "WP52Z43S8JZW",
+    "WP516W3J2R6N",
+    "WPJJ0KV8HBJP",
+    "WP5K632W4YHQ",
+    "WQKE38EK0NBP",
+    "WQKE30MY2FBB",
+    "WQKSYCEG4NQK",
+    "WQS21EJMZNNZ",
+    "WQKZ3PHTHKG8",
+    "WQKGF0CF87VY",
+    "WQM1FN8DKP8U",
+    "WQK9ZY8FQR8K",
+    "WQK4ZRKEJ41D",
+    "WQ66KU06BHB1",
+    "WQ66KTJUW8WP",
+    "WQ6B5PBWYG84",
+    "WQ4RHGT1Z8YS",
+    "WQ4PGE4XN48S",
+    "WQ3C78EZ6QJ8",
+    "WQ4Q320XZQY5",
+    "WQ1GZ7B369NN",
+    "WMFTU75WU2CG",
+    "WMFW5823J5Q2",
+    "WMGPVSQGQX9X",
+    "WMF7QN3ESV1Q",
+    "WQ41XNX5WK11",
+    "WMGJDGX96674",
+    "WQ4CS1JHGGDU",
+    "WQ4F3NQ2YTGC",
+    "WQ52JGTHE0M0",
+    "WQ58FYVQ3D2C",
+    "WQ36SBF902FR",
+    "WQ36SBF902FR",
+    "WQ3C0NYT5JVK",
+    "WQ3KRHG76MRY",
+    "WQ39V4BTUZMG",
+    "WQ33XCC4TW9Q",
+    "WQ3DBVT8F9UN",
+    "WQ35K6M0DDYK",
+    "WQ1PJB8R8EFB",
+    "WQ1NYPBJ3BD7",
+    "WQ1MRUCNJSC6",
+    "WQ1SEPN7HG1W",
+    "WQ40NVRYV22S",
+    "WQ13SYDE8K43",
+    "WQ096TT077KK",
+    "WQ0UEZPEJ54Q",
+    "WQ2BHZUYC5SD",
+    "WQ82K43YVYU8",
+    "WQ82HWCF35QF",
+    "WQ2RFKFNPJ35",
+    "WQ827EYPSNYH",
+    "WQ827XYMV34P",
+    "WQ861FCHGDZN",
+    "WQ2PXK95BT1K",
+    "WQ808MQS6P94",
+    "WQ2Y3RYEE7DY",
+    "WQ2ZD0VRKUYH",
+    "WQ2XEU9EBMPH",
+    "WQ3NEM8TTDGG",
+    "WQ83XBTWR1TG",
+    "WQ2TR5Y9XXZ0",
+    "WQ2GGYR9MH67",
+    "WNXF241JU7T0",
+    "WQ8K8KV6M95C",
+    "WNZ31NRYD7CG",
+    "WNXCCV7QHD93",
+    "WNXHQE8RN077",
+    "WQ2D1TXVBJ01",
+    "WQ2D1D0WYRCT",
+    "WQ2S3SZGRM6N",
+    "WQ0PM100W37C",
+    "WQ0JXFQUGT4Z",
+    "WNRW6560ZURV",
+    "WNRW3ST4RFJV",
+    "WNR8890F4U70",
+    "WQ2JH4EN6R1D",
+    "WNR47J5HWBER",
+    "WNRDKT5UT0SZ",
+    "WNPK15RJ0H84",
+    "WNPK0UCK83BG",
+    "WJZEK4TR5HGV",
+    "WNP1320CWDZP",
+    "WNNB584BJ218",
+    "WMBNJJXRZ7SM",
+    "WNJYDHURXZF1",
+    "WJUGXXRYCVG7",
+    "WJUGXXRYCVG7",
+    "WJGG0T726UW2",
+    "WJVJCDF43FZE",
+    "WN5BXFHQE3RE",
+    "WJSX5MYDDGN1",
+    "WNH45VPMTV1K",
+    "WNTHRYRP0P8J",
+    "WN7RPW01FK0F",
+    "WNTHXEN8J2YM",
+    "WN9RXN2FUH78",
+    "WNW40FYUY6FQ",
+    "WNMWXB5WVDKW",
+    "WNWKJQ20JPZQ",
+    "WQGDF7NXZRZB",
+    "WQGDFECDFF07",
+    "WQG7P9J0MMRM",
+    "WQGDC7YKHVCU",
+    "WQG9CB8VHMNN",
+    "WQGEK1CDN8GE",
+    "WQG8EXGHSDF8",
+    "WQGTUXRECXJN",
+    "WQGTUR539D4N",
+    "WQGZMC4ZF66C",
+    "WQGV21SBBVT6",
+    "WQG80DH3X35S",
+    "WQG80FD6W5XP",
+    "WQEKVMHBDMR4",
+    "WQSQGVWK3QKQ",
+    "WQE66K084GSK",
+    "WQG2M9MFD1SQ",
+    "WQ7SF3WEPQRU",
+    "WQ7SFD33FJDT",
+    "WQ7HTUNHRTFP",
+    "WQ76WU6JX1R0",
+    "WQ79GDGJUX6E",
+    "WQ7GFQM97H6G",
+    "WQDV3QM9ZDUM",
+    "WQDV3T4WV5WP",
+    "WQEJHX48C6QU",
+    "WQE0H17GXQJG",
+    "TZY33C4YJBP3",
+    "TZY9UBXJKW3F",
+    "TZY31M8B0VK0",
+    "TZY39NJQF8E4",
+    "TZY3672F74BZ",
+    "TZY1T755SJTZ",
+    "TZWY97DH51SN",
+    "TZY656TH0C43",
+    "TZWRVZM42Y62",
+    "VBH77M0RQ24G",
+    "TZUK5TE15104",
+    "VBH77M0RQ24G",
+    "VBHECPMVBC2Y",
+    "VBHYJSW72WWD",
+    "TZXKM4G9GS71",
+    "TZXKM3JHFK87",
+    "WP85VH0PY75Z",
+    "TZX537BGWDP0",
+    "WPDE8HGNVFWJ",
+    "WPD7XUNHKNBN",
+    "WPF0H30S3J44",
+    "WPEQ4CQMTBQ5",
+    "TZY46T9GJ6Y0",
+    "TZY46T9GJ6Y0",
+    "TZYE4J306SDB",
+    "TZVG36WXHUBM",
+    "TZVK1BX6PWE9",
+    "TZZDQMW5J6C2",
+    "TZZ6M3FYSD7X",
+    "WPB1Q75BK2PN",
+    "TZFR7QSK5DH2",
+    "TZFR7TC93WEK",
+    "VB48ZP18XJHZ",
+    "TZFVTZPMGFX5",
+    "TZCXGFS1PZE5",
+    "TZMM84XHV4GU",
+    "TZMM87UXBKRG",
+    "TZ7VTTGD1K6R",
+    "TZM74EVKDWMM",
+    "TYYTYR77VZJN",
+    "TYUBFM3537NM",
+    "TZMX3FW7E0QT",
+    "TZT2Y04ECGV3",
+    "TZTB2Z0B9ENG",
+    "TZMWG64P1R1Y",
+    "TZ344WFBDS60",
+    "TZ344WFBDS60",
+    "TZ34CDV9QMXZ",
+    "TZ7J24BUT5SJ",
+    "TZ6F7XYECUCV",
+    "TZ6SREGQR92H",
+    "TZ6JYCRYTKB8",
+    "TZ266ZVEBUCV",
+    "TZ1PJH6YVUBN",
+    "TZ0NQUF3WE0N",
+    "TXN1VJTX2P0K",
+    "TXN1VQC3C8ST",
+    "TWYN8R1172BW",
+    "TXRBC5JD93PB",
+    "TXJ9BQG3U0DV",
+    "TXN08CQCQM63",
+    "TXN08CQCQM63",
+    "TXJBN0BM1H56",
+    "TXN04S9CTKQ4",
+    "TWYJMQCR9TUX",
+    "TWYCNQ6Q9EB5",
+    "TWYFT6JHTRJG",
+    "TWXP3XZDBZB1",
+    "TWZJQCX0BJSD",
+    "TWYX4VW5QDHC",
+    "TXN8DNC04TDY",
+    "TXPF73WR79MP",
+    "TWTQZ9VXCN1J",
+    "TY8G4T7ZWVX1",
+    "TY8G4T7ZWVX1",
+    "TY8SN2C97XSC",
+    "TWXWJ29B2HQ9",
+    "TY94BS3K3KV7",
+    "TY96QXSU87YV",
+    "TYD1DKQ6BCVU",
+    "TYDFCKMSRSU7",
+    "TZCCFD84WXV4",
+    "TZCCF7RKT36V",
+    "TZUKEYQM32HM",
+    "TZC5MZQTRD5Y",
+    "TZCFPN341DJW",
+    "TZC9QE58K01W",
+    "TZCD87P1BE5J",
+    "TZDRR5Q13GKN",
+    "TZEPN6HY1DG1",
+    "TZ9TQPJNFP08",
+    "TZDJY5FY9PYQ",
+    "TZF9J3FSVRD8",
+    "VB71BQ84QPSS",
+    "VB71BQ84QPSS",
+    "TZUHYBNPE023",
+    "VB72XN98BHXT",
+    "TZUUHQ48FWGQ",
+    "VB5MQ379THW4",
+    "VB5NB62NW0HW",
+    "VBKFNXEMUB2D",
+    "VBW8JQY63YDB",
+    "VBW8JQY63YDB",
+    "VBMZ27D0XSMZ",
+    "VBREMH46Z5N0",
+    "VBQHP1GTCU8U",
+    "VBT3QWCH5CQX",
+    "Y02388H8QWSD",
+    "VBMJF4RGV0C6",
+    "TZVHJ8T4HQ93",
+    "TZ1Y9TFKC7BS",
+    "TZ04Z1NF3P4V",
+    "TZY7200FWT0M",
+    "VBQMNXK3YFKV",
+    "TZKYJKV2ZPNW",
+    "TZFX1GQY86PS",
+    "TZC9UPSYFNPD",
+    "TY87SMB6KKFW",
+    "WEVV5TEP8D3H",
+    "WSJ6Z5NBXNB0",
+    "WSJ89JC5P1S7",
+    "WSJ8VWFY76R3",
+    "WSJN13BN6HU0",
+    "WSJTS6QKYMHX",
+    "WSN1KVD8RE7K",
+    "WSJWYWP7083Z",
+    "WSJZ5FCK9PXR",
+    "WSM8YXXK0T3G",
+    "WSMB1FT0NG1T",
+    "WSMC3UM5YY39",
+    "WSMGSCECS52T",
+    "WSQ02DZQ65HE",
+    "WSQ2RJ6MT7GZ",
+    "WSQJ0Q34GR2E",
+    "WSQM81BYPZ6P",
+    "WSQQ01XUYC7E",
+    "WSQQMXBCC2VS",
+    "WSQSFMPXSWEV",
+    "WSQWFQ3WXV69",
+    "WECNV8ZNE40W",
+    "WECNYQ9U02EE",
+    "WECPHRTP69SV",
+    "WECPJQ06ZPUE",
+    "WEBTFUSKS7HB",
+    "WEBVB7GZ9P8N",
+    "WEBY02613HF6",
+};
+
+constexpr CityRecord kCityRecords[] = {
+    {0, 10, 24, 39900000, 116400000},
+    {32, 52, 66, 39926952, 116410117},
+    {76, 96, 110, 39910912, 116359655},
+    {118, 138, 152, 39920000, 116430000},
+    {161, 181, 195, 39850000, 116280000},
+    {203, 226, 243, 39900000, 116220000},
+    {255, 275, 289, 39950000, 116300000},
+    {297, 320, 337, 39930000, 116100000},
+    {347, 367, 381, 39750000, 116130000},
+    {390, 410, 424, 39920000, 116650000},
+    {433, 453, 467, 40130000, 116650000},
+    {474, 494, 508, 40220000, 116230000},
+    {518, 538, 552, 39730000, 116330000},
+    {559, 579, 593, 40320000, 116630000},
+    {601, 621, 635, 40130000, 117120000},
+    {642, 662, 676, 40370000, 116830000},
+    {682, 702, 716, 40450000, 115970000},
+    {724, 734, 748, 39120000, 117200000},
+    {756, 776, 790, 39115942, 117208226},
+    {797, 817, 831, 39127299, 117245313},
+    {838, 858, 872, 39108570, 117217097},
+    {877, 897, 911, 39137074, 117144344},
+    {918, 938, 952, 39146818, 117190336},
+    {958, 978, 992, 39166200, 117145137},
+    {1001, 1021, 1035, 39080000, 117300000},
+    {1042, 1062, 1076, 39130000, 117000000},
+    {1083, 1103, 1117, 38980000, 117380000},
+    {1124, 1144, 1158, 39220000, 117130000},
+    {1166, 1186, 1200, 39380000, 117030000},
+    {1207, 1227, 1241, 39720000, 117300000},
+    {1247, 1270, 1290, 39002763, 117704221},
+    {1302, 1322, 1336, 39330000, 117820000},
+    {1343, 1363, 1377, 38930000, 116920000},
+    {1385, 1405, 1419, 40050000, 117400000},
+    {1426, 1449, 1476, 38050000, 114520000},
+    {1489, 1522, 1546, 38036099, 114533177},
+    {1554, 1587, 1611, 38003263, 114454971},
+    {1618, 1651, 1675, 38050295, 114457166},
+    {1682, 1718, 1742, 38030000, 114130000},
+    {1751, 1784, 1808, 38005872, 114525456},
+    {1814, 1847, 1871, 38030000, 114830000},
+    {1880, 1913, 1937, 38080000, 114300000},
+    {1944, 1977, 2001, 37880000, 114650000},
+    {2011, 1718, 1742, 38031348, 114138815},
+    {2044, 2077, 2101, 38150000, 114570000},
+    {2111, 2144, 2168, 38430000, 114550000},
+    {2177, 2210, 2234, 38300000, 114370000},
+    {2243, 2276, 2300, 37600000, 114600000},
+    {2306, 2339, 2363, 38180000, 115200000},
+    {2370, 2403, 2427, 37670000, 114380000},
+    {2436, 2469, 2493, 38180000, 114970000},
+    {2498, 2531, 2555, 38250000, 114200000},
+    {2564, 2597, 2621, 37750000, 114520000},
+    {2629, 2659, 2683, 37750000, 114770000},
+    {2692, 2725, 2749, 37920000, 115220000},
+    {2755, 2788, 2812, 38030000, 115030000},
+    {2820, 2853, 2877, 38350000, 114680000},
+    {2883, 2903, 2924, 39630000, 118200000},
+    {2933, 2963, 2984, 39623705, 118148001},
+    {2990, 3020, 3041, 39623166, 118194471},
+    {3047, 3077, 3098, 39732187, 118441371},
+    {3103, 3133, 3154, 39669759, 118255696},
+    {3162, 3192, 3213, 39570000, 118100000},
+    {3221, 3251, 3272, 39830000, 118170000},
+    {3280, 3313, 3337, 39177236, 118435823},
+    {3348, 3378, 3399, 39500000, 118680000},
+    {3407, 3437, 3458, 39420000, 118900000},
+    {3465, 3495, 3516, 40150000, 118320000},
+    {3523, 3553, 3574, 39880000, 117730000},
+    {3581, 3611, 3632, 40180000, 117950000},
+    {3639, 3669, 3690, 40020000, 118700000},
+    {3697, 3727, 3748, 39750000, 118700000},
+    {3757, 3780, 3807, 39930000, 119600000},
+    {3819, 3852, 3876, 39946428, 119559137},
+    {3884, 3920, 3947, 39977563, 119769931},
+    {3959, 3995, 4022, 39830000, 119480000},
+    {4031, 4064, 4088, 39880000, 119230000},
+    {4095, 4140, 4164, 40400000, 118950000},
+    {4173, 4206, 4230, 39700000, 119170000},
+    {4238, 4271, 4295, 39880000, 118870000},
+    {4302, 4322, 4343, 36620000, 114480000},
+    {4350, 4380, 4401, 36580167, 114484521},
+    {4409, 4439, 4460, 36636194, 114486991},
+    {4468, 4498, 4519, 36638720, 114456034},
+    {4526, 4559, 4580, 36458111, 114185062},
+    {4589, 4619, 4640, 36550000, 114800000},
+    {4649, 4679, 4700, 36780000, 114480000},
+    {4709, 4739, 4760, 36350000, 114620000},
+    {4769, 4799, 4820, 36430000, 114680000},
+    {4828, 4858, 4879, 36280000, 115150000},
+    {4886, 4913, 4934, 36570000, 113670000},
+    {4942, 4969, 4990, 36350000, 114370000},
+    {4997, 5024, 5045, 36820000, 115170000},
+    {5053, 5083, 5104, 36920000, 114870000},
+    {5109, 5139, 5160, 36480000, 114930000},
+    {5170, 5200, 5221, 36530000, 115300000},
+    {5229, 5256, 5277, 36370000, 114930000},
+    {5285, 5315, 5336, 36780000, 114950000},
+    {5343, 5373, 5394, 36700000, 114200000},
+    {5399, 5419, 5433, 37070000, 114480000},
+    {5441, 5471, 5492, 37067549, 114501359},
+    {5501, 5531, 1611, 37059307, 114462386},
+    {5552, 5582, 5433, 37070000, 114480000},
+    {5603, 5633, 5654, 37430000, 114500000},
+    {5663, 5693, 5714, 37300000, 114520000},
+    {5721, 5751, 5772, 37500000, 114680000},
+    {5781, 5811, 5832, 37350000, 114770000},
+    {5840, 5867, 5888, 37130000, 114680000},
+    {5896, 5926, 5947, 37000000, 114680000},
+    {5953, 5983, 6004, 37620000, 114920000},
+    {6012, 6042, 6063, 37220000, 115030000},
+    {6068, 6098, 6119, 37530000, 115250000},
+    {6125, 6155, 6176, 37070000, 115150000},
+    {6186, 6216, 6237, 37070000, 115030000},
+    {6247, 6274, 5277, 36980000, 115250000},
+    {6295, 6325, 6346, 37070000, 115670000},
+    {6353, 6383, 6404, 36850000, 115500000},
+    {6410, 6440, 6461, 37350000, 115380000},
+    {6469, 6499, 6520, 36850000, 114500000},
+    {6526, 6546, 6567, 38870000, 115470000},
+    {6575, 6605, 6626, 38876645, 115452331},
+    {6634, 6664, 6685, 38882716, 115490952},
+    {6693, 6723, 6744, 38950000, 115320000},
+    {6753, 6783, 6804, 38770000, 115480000},
+    {6813, 6843, 6864, 39020000, 115650000},
+    {6871, 6901, 6922, 39400000, 115720000},
+    {6930, 6960, 6981, 38850000, 114180000},
+    {6988, 7018, 7039, 39270000, 115770000},
+    {7048, 7075, 7096, 38750000, 114980000},
+    {7105, 7135, 7156, 38680000, 115780000},
+    {7164, 7194, 7215, 39050000, 115870000},
+    {7225, 7255, 7276, 39350000, 114680000},
+    {7284, 7314, 7335, 38720000, 115150000},
+    {7342, 7372, 7393, 38920000, 115930000},
+    {7399, 7426, 7447, 39350000, 115500000},
+    {7454, 7484, 7505, 38620000, 114700000},
+    {7512, 7539, 7560, 38480000, 115570000},
+    {7567, 7597, 7618, 38830000, 115130000},
+    {7627, 7657, 7678, 38450000, 115470000},
+    {7683, 7710, 7731, 38980000, 116100000},
+    {7741, 7771, 7792, 39480000, 115970000},
+    {7801, 7831, 7852, 38520000, 114970000},
+    {7861, 7891, 7912, 38420000, 115320000},
+    {7918, 7951, 7975, 39330000, 115850000},
+    {7986, 8009, 8036, 40820000, 114880000},
+    {8048, 8081, 5492, 40787162, 114888233},
+    {8105, 8138, 1611, 40818225, 114863272},
+    {8162, 8195, 8219, 40600000, 115050000},
+    {8227, 8263, 8290, 40501322, 115280927},
+    {8301, 8334, 8358, 40750000, 114720000},
+    {8366, 8399, 8423, 40970000, 115270000},
+    {8431, 8464, 8488, 41150000, 114700000},
+    {8497, 8530, 8554, 41850000, 114620000},
+    {8562, 8595, 8619, 41670000, 115700000},
+    {8626, 8659, 8683, 41080000, 113970000},
+    {8691, 8721, 8745, 39850000, 114570000},
+    {8752, 8785, 8809, 40120000, 114170000},
+    {8818, 8851, 8875, 40670000, 114420000},
+    {8882, 8915, 8939, 40400000, 115520000},
+    {8947, 8980, 9004, 40380000, 115220000},
+    {9011, 9044, 9068, 40920000, 115830000},
+    {9077, 9097, 9118, 40970000, 117930000},
+    {9126, 9156, 9177, 40973093, 117937063},
+    {9188, 9218, 9239, 40957552, 117793428},
+    {9250, 9289, 9313, 40545688, 117654782},
+    {9326, 9356, 9380, 40770000, 118170000},
+    {9392, 9422, 9443, 40430000, 117520000},
+    {9452, 9482, 9503, 40930000, 117330000},
+    {9512, 9542, 9563, 41320000, 117720000},
+    {9571, 9613, 9634, 41200000, 116650000},
+    {9643, 9685, 9706, 40600000, 118480000},
+    {9716, 9767, 9788, 41930000, 117750000},
+    {9797, 9827, 9848, 41000000, 118680000},
+    {9857, 9877, 9898, 38300000, 116830000},
+    {9907, 9937, 1675, 38313903, 116860535},
+    {9958, 9988, 10009, 38309573, 116826473},
+    {10015, 10042, 10063, 38300000, 116870000},
+    {10072, 10099, 10120, 38580000, 116820000},
+    {10129, 10159, 10180, 37880000, 116530000},
+    {10190, 10220, 10241, 38130000, 117480000},
+    {10249, 10279, 10300, 38050000, 117220000},
+    {10308, 10338, 10359, 38430000, 115830000},
+    {10366, 10396, 10417, 38030000, 116700000},
+    {10423, 10453, 10474, 37620000, 116380000},
+    {10481, 10508, 10529, 38180000, 116120000},
+    {10538, 10580, 10601, 38070000, 117100000},
+    {10609, 10639, 10660, 38070000, 116570000},
+    {10666, 10696, 10717, 38720000, 116100000},
+    {10724, 10754, 10775, 38370000, 117350000},
+    {10784, 10814, 10835, 38430000, 116080000},
+    {10842, 10862, 10883, 39520000, 116700000},
+    {10892, 10922, 10943, 39501459, 116688603},
+    {10948, 10978, 10999, 39521645, 116704708},
+    {11009, 11039, 11060, 39430000, 116300000},
+    {11065, 11095, 11116, 39320000, 116500000},
+    {11125, 11155, 11176, 39770000, 117000000},
+    {11184, 11214, 11235, 38700000, 116630000},
+    {11243, 11273, 11294, 38870000, 116470000},
+    {11300, 11342, 11363, 39880000, 116980000},
+    {11371, 11401, 11422, 39100000, 116400000},
+    {11429, 11459, 11480, 39980000, 117070000},
+    {11486, 11506, 11527, 37730000, 115680000},
+    {11536, 11566, 11587, 37734717, 115669522},
+    {11596, 11626, 11647, 37570000, 115570000},
+    {11654, 11684, 11705, 37520000, 115720000},
+    {11714, 11744, 11765, 37820000, 115880000},
+    {11770, 11800, 11821, 38030000, 115980000},
+    {11829, 11859, 11880, 38230000, 115730000},
+    {11888, 11918, 11939, 38230000, 115520000},
+    {11946, 11976, 11997, 37350000, 115970000},
+    {12005, 12032, 12053, 37700000, 116270000},
+    {12062, 12092, 12113, 37870000, 116150000},
+    {12121, 12151, 12172, 38020000, 115550000},
+    {12181, 12201, 12222, 37870000, 112550000},
+    {12230, 12260, 12284, 37730000, 112570000},
+    {12295, 12325, 12346, 37862951, 112557133},
+    {12353, 12386, 12410, 37893470, 112564345},
+    {12422, 12455, 12482, 37930000, 112480000},
+    {12496, 12529, 12553, 37858836, 112509347},
+    {12563, 12593, 12614, 37714454, 112471418},
+    {12622, 12652, 12673, 37600000, 112350000},
+    {12680, 12710, 12731, 38070000, 112670000},
+    {12738, 12768, 12789, 38070000, 111780000},
+    {12796, 12826, 12847, 37920000, 112170000},
+    {12854, 12874, 12895, 40080000, 113300000},
+    {12902, 12932, 12953, 40254542, 113132854},
+    {12961, 12991, 13012, 40074634, 113290968},
+    {13022, 13052, 13073, 40003887, 113142296},
+    {13081, 13111, 13132, 40030000, 113600000},
+    {13143, 13173, 13194, 40370000, 113750000},
+    {13202, 13232, 13253, 40420000, 114080000},
+    {13262, 13292, 13313, 39770000, 114280000},
+    {13323, 13353, 13374, 39430000, 114230000},
+    {13382, 13412, 13433, 39700000, 113680000},
+    {13441, 13471, 13492, 40000000, 112700000},
+    {13499, 13519, 13533, 37850000, 113570000},
+    {13542, 13569, 13533, 37850000, 113570000},
+    {13590, 13617, 13638, 37856468, 113574117},
+    {13646, 13673, 13694, 37944199, 113587766},
+    {13701, 13731, 13752, 37800000, 113620000},
+    {13761, 13788, 8745, 38080000, 113400000},
+    {13809, 13829, 13850, 36200000, 113120000},
+    {13859, 13889, 13910, 36203121, 113116116},
+    {13917, 13947, 13968, 36053345, 113044860},
+    {13978, 14008, 14029, 36320000, 112880000},
+    {14036, 14066, 14087, 36330000, 113220000},
+    {14095, 14125, 14146, 36530000, 113050000},
+    {14156, 14186, 14207, 36200000, 113430000},
+    {14216, 14246, 14267, 36500000, 113380000},
+    {14275, 14305, 14326, 36120000, 113200000},
+    {14333, 14363, 14384, 36120000, 112870000},
+    {14392, 14422, 14443, 36830000, 112850000},
+    {14451, 14478, 14499, 36750000, 112700000},
+    {14507, 14537, 14558, 36500000, 112330000},
+    {14566, 14586, 14600, 35489572, 112875595},
+    {14609, 14636, 14600, 35489572, 112875595},
+    {14657, 14687, 14708, 35680000, 112180000},
+    {14716, 14746, 14767, 35480000, 112420000},
+    {14777, 14807, 14828, 35780000, 113270000},
+    {14838, 14868, 14889, 35500000, 112830000},
+    {14896, 14926, 14947, 35800000, 112920000},
+    {14955, 14975, 14996, 39330000, 112430000},
+    {15005, 15035, 15056, 39317784, 112425404},
+    {15066, 15096, 15117, 39530000, 112120000},
+    {15124, 15154, 15175, 39520000, 112820000},
+    {15183, 15210, 15231, 39550000, 113180000},
+    {15240, 15270, 15291, 39980000, 112470000},
+    {15297, 15327, 15348, 39830000, 113080000},
+    {15356, 15376, 15397, 37680000, 112750000},
+    {15406, 15436, 15457, 37698856, 112744789},
+    {15462, 15492, 15513, 37070000, 112970000},
+    {15519, 15549, 15570, 37070000, 113370000},
+    {15578, 15608, 15629, 37330000, 113570000},
+    {15636, 15666, 15687, 37620000, 113700000},
+    {15694, 15724, 15745, 37880000, 113180000},
+    {15754, 15784, 15805, 37420000, 112550000},
+    {15811, 15838, 15859, 37350000, 112330000},
+    {15866, 15896, 15917, 37180000, 112170000},
+    {15925, 15955, 15976, 36850000, 111770000},
+    {15984, 16014, 16035, 37030000, 111920000},
+    {16042, 16062, 16083, 35020000, 110980000},
+    {16092, 16122, 16143, 35027149, 111001713},
+    {16149, 16179, 16200, 35150000, 110770000},
+    {16206, 16236, 16257, 35420000, 110830000},
+    {16265, 16295, 16316, 35350000, 111220000},
+    {16322, 16352, 16373, 35600000, 110970000},
+    {16380, 16410, 16431, 35620000, 111220000},
+    {16440, 16467, 16488, 35480000, 111570000},
+    {16498, 16528, 16549, 35300000, 111670000},
+    {16556, 16583, 16604, 35150000, 111220000},
+    {16612, 16642, 15117, 34830000, 111220000},
+    {16663, 16693, 16714, 34700000, 110680000},
+    {16723, 16753, 16774, 34880000, 110420000},
+    {16781, 16811, 16832, 35600000, 110700000},
+    {16838, 16858, 16879, 38420000, 112730000},
+    {16887, 16917, 16938, 38403658, 112739470},
+    {16944, 16974, 16995, 38480000, 112950000},
+    {17005, 17035, 17059, 38730000, 113250000},
+    {17069, 17096, 17117, 39070000, 112950000},
+    {17125, 17155, 17176, 39180000, 113250000},
+    {17183, 17213, 17234, 39000000, 112300000},
+    {17241, 17271, 17292, 38370000, 111930000},
+    {17299, 17329, 17350, 39080000, 112200000},
+    {17358, 17388, 17409, 38900000, 111850000},
+    {17416, 17446, 17467, 38700000, 111570000},
+    {17473, 17503, 17524, 39380000, 111130000},
+    {17529, 17559, 17580, 39022488, 111086564},
+    {17586, 17616, 17637, 39430000, 111500000},
+    {17646, 17676, 17697, 38730000, 112700000},
+    {17706, 17726, 17747, 36080000, 111520000},
+    {17754, 17784, 17805, 36079086, 111573465},
+    {17812, 17842, 17863, 35630000, 111470000},
+    {17868, 17898, 17919, 35730000, 111720000},
+    {17927, 17957, 17978, 35880000, 111430000},
+    {17987, 18017, 18038, 36250000, 111670000},
+    {18047, 18074, 18095, 36270000, 111920000},
+    {18102, 18132, 18153, 36150000, 112250000},
+    {18158, 18188, 18209, 35970000, 111830000},
+    {18216, 18243, 1419, 36100000, 110680000},
+    {18264, 18294, 18315, 35970000, 110830000},
+    {18325, 18355, 18376, 36470000, 110750000},
+    {18383, 18410, 18431, 36700000, 110930000},
+    {18438, 18468, 18489, 36770000, 110630000},
+    {18496, 18523, 18544, 36420000, 111080000},
+    {18551, 18581, 18602, 36650000, 111570000},
+    {18608, 18638, 18659, 35620000, 111350000},
+    {18665, 18695, 18716, 36570000, 111720000},
+    {18724, 18744, 18765, 37512405, 111131000},
+    {18773, 18803, 18824, 37520000, 111130000},
+    {18830, 18860, 18881, 37430000, 112020000},
+    {18889, 18919, 18940, 37550000, 112150000},
+    {18950, 18977, 18998, 38470000, 111120000},
+    {19007, 19034, 19055, 37950000, 110980000},
+    {19063, 19093, 19114, 37430000, 110900000},
+    {19121, 19151, 19172, 37000000, 110830000},
+    {19179, 19206, 19227, 38280000, 111670000},
+    {19235, 19265, 381, 37880000, 111230000},
+    {19286, 19316, 19337, 37330000, 111180000},
+    {19347, 19377, 19398, 36970000, 111200000},
+    {19406, 19436, 19457, 37150000, 111770000},
+    {19464, 19494, 19515, 37270000, 111780000},
+    {19523, 19558, 19594, 40830000, 111730000},
+    {19604, 19649, 19679, 40856937, 111658773},
+    {19688, 19733, 19763, 40807362, 111617022},
+    {19770, 19815, 19845, 40752369, 111667102},
+    {19852, 19897, 19927, 40790732, 111695003},
+    {19934, 19985, 20018, 40720000, 111130000},
+    {20026, 20074, 20104, 40270000, 111180000},
+    {20112, 20163, 20193, 40380000, 111820000},
+    {20199, 20247, 20280, 39920000, 111680000},
+    {20291, 20336, 20366, 41080000, 111450000},
+    {20374, 20403, 20427, 40650000, 109830000},
+    {20434, 20473, 20497, 40574606, 110038134},
+    {20504, 20546, 20573, 40641094, 109832470},
+    {20583, 20622, 20646, 40642173, 109895958},
+    {20655, 20694, 20718, 40670799, 110266672},
+    {20726, 20774, 20804, 41792493, 109943293},
+    {20814, 20853, 20877, 40599440, 109962391},
+    {20885, 20930, 20957, 40570000, 110520000},
+    {20965, 21004, 21028, 41030000, 110050000},
+    {21035, 21092, 21119, 41989305, 110360429},
+    {21127, 21156, 21180, 39670000, 106820000},
+    {21186, 21228, 21255, 39690256, 106818055},
+    {21264, 21303, 21327, 39440626, 106886792},
+    {21334, 21373, 21397, 39504996, 106721376},
+    {21402, 21431, 21455, 42270000, 118920000},
+    {21463, 21502, 21526, 42293825, 118949263},
+    {21535, 21577, 21604, 42036727, 119282164},
+    {21616, 21655, 21679, 42284923, 118925759},
+    {21688, 21736, 21763, 43880000, 120080000},
+    {21769, 21811, 21841, 43980000, 119380000},
+    {21852, 21894, 21924, 43520000, 118670000},
+    {21935, 21974, 6404, 43600000, 118050000},
+    {21998, 22043, 22073, 43280000, 117480000},
+    {22085, 22127, 22154, 42951796, 119308930},
+    {22164, 22206, 22233, 41901243, 118735974},
+    {22241, 22280, 22304, 41600000, 119330000},
+    {22314, 22353, 22377, 42300000, 119870000},
+    {22383, 22412, 22436, 43620000, 122270000},
+    {22445, 22487, 22514, 45057616, 121466703},
+    {22522, 22573, 22603, 44130000, 123320000},
+    {22616, 22667, 22697, 42950000, 122350000},
+    {22708, 22747, 22771, 43600000, 121300000},
+    {22777, 22816, 22840, 42730000, 121770000},
+    {22846, 22885, 22909, 42850000, 120650000},
+    {22916, 22958, 22985, 44550000, 120870000},
+    {22993, 23038, 23068, 45530000, 119650000},
+    {23080, 23115, 23151, 39620000, 109800000},
+    {23160, 23205, 23235, 39820000, 110000000},
+    {23245, 23293, 23326, 39607412, 109852911},
+    {23336, 23384, 23417, 40420000, 110020000},
+    {23424, 23472, 23505, 39680000, 111130000},
+    {23514, 23565, 23598, 38229483, 107511548},
+    {23606, 23654, 23687, 39120000, 107970000},
+    {23694, 23739, 23772, 39830000, 108720000},
+    {23782, 23827, 23860, 38600000, 108850000},
+    {23869, 23920, 23956, 39250000, 109770000},
+    {23968, 24003, 24036, 49164191, 119771396},
+    {24047, 24095, 24128, 49220000, 119770000},
+    {24136, 24187, 24223, 49508634, 117662364},
+    {24235, 24280, 24313, 48130000, 123470000},
+    {24321, 24390, 24426, 48470000, 124500000},
+    {24435, 24489, 24525, 50243584, 123906262},
+    {24536, 24593, 24629, 48422655, 119990073},
+    {24638, 24689, 24719, 49497923, 119717608},
+    {24726, 24780, 24813, 48558864, 118878855},
+    {24822, 24876, 24909, 48748387, 116674714},
+    {24918, 24966, 24999, 49580000, 117450000},
+    {25009, 25057, 25090, 49280000, 120730000},
+    {25098, 25146, 25179, 47980000, 122750000},
+    {25189, 25240, 25276, 50230000, 120180000},
+    {25284, 25329, 25359, 50780000, 121520000},
+    {25365, 25400, 25433, 40741723, 107382136},
+    {25444, 25489, 25519, 40750000, 107400000},
+    {25525, 25570, 25600, 41100000, 108270000},
+    {25607, 25652, 25682, 40330000, 107020000},
+    {25690, 25741, 25774, 40720000, 108650000},
+    {25783, 25834, 25867, 41570000, 108520000},
+    {25877, 25928, 25961, 41100000, 107070000},
+    {25969, 26017, 26053, 40880000, 107150000},
+    {26066, 26101, 26134, 40993091, 113124742},
+    {26145, 26190, 26220, 41030000, 113100000},
+    {26227, 26272, 26302, 40900000, 112570000},
+    {26309, 26354, 26384, 41900000, 114000000},
+    {26390, 26435, 26465, 41550000, 113530000},
+    {26473, 26518, 26548, 40880000, 113880000},
+    {26555, 26600, 26630, 40530000, 112480000},
+    {26641, 26698, 26734, 40780000, 113220000},
+    {26747, 26804, 26840, 41270000, 112630000},
+    {26854, 26911, 26947, 41450000, 113180000},
+    {26959, 27007, 27043, 41520000, 111700000},
+    {27054, 27099, 27129, 40430000, 113150000},
+    {27138, 27167, 27194, 46075530, 122060847},
+    {27201, 27246, 27279, 46080000, 122050000},
+    {27290, 27332, 27362, 47180000, 119930000},
+    {27370, 27421, 27454, 46070000, 121920000},
+    {27466, 27517, 27550, 45050000, 121470000},
+    {27563, 27605, 27635, 46730000, 122900000},
+    {27644, 27683, 27710, 45380000, 121570000},
+    {27717, 27752, 27785, 43931267, 116041382},
+    {27796, 27847, 27883, 43650000, 111980000},
+    {27895, 27946, 27982, 43930000, 116070000},
+    {27993, 28041, 28074, 44030000, 114970000},
+    {28080, 28131, 28164, 43850000, 113630000},
+    {28172, 28223, 28256, 42750000, 112650000},
+    {28264, 28318, 28351, 45520000, 116970000},
+    {28360, 28414, 28447, 44580000, 117600000},
+    {28454, 28502, 28535, 41900000, 115300000},
+    {28545, 28590, 28623, 42230000, 113830000},
+    {28634, 28682, 28718, 42300000, 115000000},
+    {28734, 28779, 28812, 42250000, 116000000},
+    {28823, 28868, 28898, 42180000, 116470000},
+    {28905, 28937, 28970, 38851327, 105724700},
+    {28982, 29030, 29063, 38830000, 105670000},
+    {29070, 29118, 29151, 39200000, 101680000},
+    {29158, 29203, 29236, 41900000, 100880000},
+    {29242, 29262, 29283, 41800000, 123430000},
+    {29292, 29322, 790, 41787370, 123414237},
+    {29343, 29373, 29394, 41793277, 123452820},
+    {29401, 29431, 29452, 41802787, 123463903},
+    {29459, 29489, 29510, 41822383, 123435849},
+    {29518, 29548, 29569, 41800482, 123370184},
+    {29575, 29608, 29632, 41662387, 123338014},
+    {29641, 29671, 29692, 41712523, 123443626},
+    {29699, 29732, 29759, 42050125, 123515576},
+    {29772, 29802, 29823, 41791427, 123302211},
+    {29830, 29860, 29881, 41520000, 122720000},
+    {29891, 29921, 29942, 42750000, 123350000},
+    {29951, 29981, 30002, 42500000, 123400000},
+    {30007, 30037, 30058, 42000000, 122820000},
+    {30065, 30085, 30106, 38920000, 121620000},
+    {30113, 30143, 30164, 38917757, 121639944},
+    {30174, 30204, 30225, 38913911, 121607383},
+    {30232, 30265, 30289, 38904042, 121589260},
+    {30298, 30331, 30355, 38952448, 121520364},
+    {30365, 30398, 30419, 38820000, 121270000},
+    {30426, 30456, 2812, 39100000, 121700000},
+    {30477, 30510, 30534, 39400000, 121950000},
+    {30544, 30574, 30595, 39270000, 122580000},
+    {30604, 30637, 30661, 39620000, 122000000},
+    {30672, 30702, 30723, 39700000, 122980000},
+    {30732, 30752, 30773, 41100000, 122980000},
+    {30780, 30810, 30831, 41088039, 122985570},
+    {30839, 30869, 29569, 41118027, 122964242},
+    {30890, 30920, 30941, 41148345, 123023423},
+    {30948, 30978, 30999, 41067142, 122943997},
+    {31008, 31038, 31059, 41380000, 122420000},
+    {31065, 31107, 31128, 40280000, 123280000},
+    {31135, 31165, 31186, 40880000, 122700000},
+    {31195, 31215, 31229, 41880000, 123980000},
+    {31236, 31266, 16938, 41859988, 123907161},
+    {31287, 31317, 31338, 41850806, 124032632},
+    {31347, 31377, 31398, 41851396, 123778267},
+    {31406, 31436, 31457, 41881244, 123939295},
+    {31467, 31497, 31229, 41880000, 123980000},
+    {31518, 31560, 31581, 41730000, 125030000},
+    {31588, 31630, 6804, 42100000, 124920000},
+    {31651, 31671, 31692, 41300000, 123770000},
+    {31698, 31728, 2555, 41297609, 123763042},
+    {31749, 31779, 31800, 41327106, 123761758},
+    {31805, 31835, 31856, 41306677, 123811422},
+    {31865, 31895, 31916, 41098498, 123738934},
+    {31923, 31965, 31989, 41191897, 124174812},
+    {31999, 32041, 32062, 41270000, 125350000},
+    {32070, 32090, 32111, 40130000, 124380000},
+    {32119, 32149, 32170, 40134921, 124389916},
+    {32178, 32208, 32229, 40103633, 124354468},
+    {32238, 32268, 32289, 40156680, 124422338},
+    {32296, 32338, 32359, 40730000, 124780000},
+    {32368, 32398, 32419, 39870000, 124150000},
+    {32428, 32458, 32479, 40450000, 124070000},
+    {32489, 32509, 2812, 41100000, 121130000},
+    {32530, 32560, 32581, 41115179, 121122635},
+    {32586, 32616, 32637, 41112959, 121145273},
+    {32644, 32674, 32695, 41107071, 121098231},
+    {32701, 32731, 32752, 41700000, 122120000},
+    {32760, 32787, 7447, 41530000, 121230000},
+    {32808, 32838, 32859, 41170000, 121350000},
+    {32867, 32897, 32918, 41600000, 121800000},
+    {32926, 32946, 32967, 40670000, 122230000},
+    {32975, 33005, 33026, 40671103, 122253796},
+    {33035, 33065, 33086, 40664814, 122201197},
+    {33092, 33125, 33149, 40229078, 122102427},
+    {33158, 33188, 33209, 40678554, 122374582},
+    {33217, 33247, 33268, 40400000, 122350000},
+    {33276, 33309, 33333, 40650000, 122500000},
+    {33343, 33363, 33377, 42020000, 121670000},
+    {33383, 33413, 33434, 42011157, 121650878},
+    {33442, 33472, 33493, 42085461, 121787072},
+    {33500, 33530, 33551, 42008472, 121673086},
+    {33559, 33592, 33616, 41780707, 121410318},
+    {33626, 33656, 33677, 42023365, 121675107},
+    {33682, 33727, 33377, 42020000, 121670000},
+    {33748, 33778, 33799, 42380000, 122530000},
+    {33807, 33827, 33848, 41270000, 123170000},
+    {33857, 33887, 33908, 41268192, 123168520},
+    {33914, 33944, 33965, 41260479, 123179601},
+    {33974, 34004, 34025, 41215572, 123190911},
+    {34033, 34066, 34090, 41130000, 123450000},
+    {34104, 34137, 34161, 41251148, 123175992},
+    {34169, 34199, 34223, 41220000, 123070000},
+    {34236, 34266, 34287, 41420000, 123330000},
+    {34294, 34314, 34335, 41120000, 122070000},
+    {34342, 34375, 34399, 41188473, 122054627},
+    {34411, 34444, 34468, 41156556, 122064401},
+    {34480, 34510, 34531, 40980000, 122070000},
+    {34536, 34566, 34587, 41250000, 122020000},
+    {34595, 34615, 34629, 42280000, 123830000},
+    {34637, 34667, 34688, 42284014, 123836448},
+    {34696, 34726, 6346, 42540586, 124142804},
+    {34747, 34777, 34629, 42280000, 123830000},
+    {34798, 34828, 34849, 42730000, 124720000},
+    {34856, 34886, 34907, 42780000, 124100000},
+    {34915, 34948, 34972, 42470000, 123550000},
+    {34985, 35015, 35036, 42550000, 124030000},
+    {35044, 35064, 152, 41570000, 120450000},
+    {35078, 35108, 35129, 41563350, 120448076},
+    {35138, 35168, 35189, 41574413, 120407610},
+    {35199, 35229, 152, 41570000, 120450000},
+    {35250, 35280, 35304, 41400000, 119630000},
+    {35317, 35371, 35392, 41170078, 119765764},
+    {35398, 35428, 35449, 41800000, 120770000},
+    {35457, 35487, 35508, 41250000, 119400000},
+    {35517, 35540, 35567, 40720000, 120830000},
+    {35575, 35608, 35632, 40773016, 120864114},
+    {35641, 35674, 35698, 40734124, 120888697},
+    {35707, 35740, 35764, 41105226, 120744362},
+    {35772, 35805, 35829, 40320000, 120330000},
+    {35838, 35871, 35895, 40820000, 119800000},
+    {35905, 35938, 35962, 40620000, 120720000},
+    {35972, 35992, 36013, 43900000, 125320000},
+    {36023, 36053, 36074, 43861514, 125343588},
+    {36082, 36112, 9706, 43941229, 125320043},
+    {36133, 36163, 152, 43831130, 125281897},
+    {36184, 36214, 36235, 43863086, 125367583},
+    {36241, 36271, 36292, 43878645, 125249749},
+    {36299, 36329, 36350, 43520000, 125670000},
+    {36361, 36391, 36412, 44150000, 125830000},
+    {36419, 36449, 36470, 44430000, 125180000},
+    {36477, 36507, 36528, 44820000, 126550000},
+    {36534, 36564, 36585, 44530000, 125700000},
+    {36591, 36611, 36632, 43830000, 126550000},
+    {36638, 36668, 36689, 43879628, 126569069},
+    {36697, 36727, 36748, 43908614, 126556529},
+    {36756, 36786, 36807, 43831170, 126535250},
+    {36817, 36847, 36868, 43819361, 126556619},
+    {36876, 36906, 16774, 43670000, 126500000},
+    {36927, 36957, 36978, 43720000, 127330000},
+    {36985, 37015, 37036, 42970000, 126730000},
+    {37044, 37074, 37095, 44420000, 126950000},
+    {37102, 37132, 37153, 42950000, 126050000},
+    {37160, 37180, 37201, 43170000, 124350000},
+    {37208, 37238, 29569, 43143592, 124339531},
+    {37259, 37289, 30831, 43159422, 124403356},
+    {37310, 37340, 37361, 43320000, 124330000},
+    {37367, 37409, 37430, 43350000, 125300000},
+    {37437, 37470, 37494, 43500000, 124820000},
+    {37506, 37536, 37557, 43520000, 123500000},
+    {37568, 37588, 37609, 42880000, 125130000},
+    {37618, 37648, 37669, 42898999, 125130041},
+    {37678, 37708, 37729, 42924741, 125142891},
+    {37734, 37764, 37785, 42680000, 125530000},
+    {37794, 37824, 37845, 42920000, 125000000},
+    {37854, 37874, 37895, 41730000, 125930000},
+    {37903, 37933, 37954, 41726302, 125949416},
+    {37964, 37997, 38021, 41771610, 126036581},
+    {38032, 38062, 38086, 41680000, 125750000},
+    {38098, 38128, 38149, 42680000, 126030000},
+    {38156, 38186, 38207, 42280000, 125730000},
+    {38213, 38246, 38270, 42530000, 125680000},
+    {38279, 38309, 38330, 41120000, 126180000},
+    {38335, 38355, 38376, 41930000, 126420000},
+    {38384, 38414, 38435, 41942897, 126410229},
+    {38444, 38474, 38495, 42025986, 126811197},
+    {38505, 38535, 38556, 42330000, 127280000},
+    {38563, 38593, 38614, 42400000, 126800000},
+    {38621, 38666, 38687, 41420000, 128200000},
+    {38696, 38726, 38747, 41800000, 126900000},
+    {38756, 38776, 38797, 45130000, 124820000},
+    {38806, 38836, 38857, 45169801, 124810744},
+    {38867, 38921, 38942, 44879062, 124465937},
+    {38950, 38980, 39001, 44280000, 123980000},
+    {39011, 39041, 3690, 45020000, 124020000},
+    {39062, 39092, 39113, 44980000, 126020000},
+    {39118, 39138, 39159, 45620000, 122830000},
+    {39168, 39198, 39219, 45619829, 122845178},
+    {39226, 39256, 39277, 45850000, 123200000},
+    {39285, 39315, 39336, 44820000, 123080000},
+    {39343, 39373, 39394, 45330000, 122780000},
+    {39401, 39431, 39452, 45500000, 124280000},
+    {39457, 39492, 39513, 42888793, 129502015},
+    {39521, 39566, 39587, 42880000, 129500000},
+    {39593, 39638, 39659, 42970000, 129830000},
+    {39665, 39710, 39731, 43370000, 128230000},
+    {39738, 39783, 39804, 42870000, 130370000},
+    {39812, 39857, 39878, 42770000, 129420000},
+    {39887, 39932, 39953, 42530000, 129000000},
+    {39960, 40005, 40026, 43320000, 129750000},
+    {40035, 40080, 40101, 43120000, 128900000},
+    {40106, 40132, 40162, 45800000, 126530000},
+    {40170, 40206, 40233, 45753857, 126611034},
+    {40239, 40275, 40302, 45757972, 126662747},
+    {40310, 40346, 40373, 45790160, 126643458},
+    {40380, 40416, 40443, 45603602, 126623339},
+    {40452, 40488, 40515, 45800706, 126504134},
+    {40523, 40559, 40586, 45705717, 126656578},
+    {40596, 40632, 40659, 45900000, 126580000},
+    {40665, 40701, 40728, 45520000, 126950000},
+    {40735, 40771, 40798, 45370000, 126320000},
+    {40810, 40846, 40873, 46320000, 129550000},
+    {40879, 40915, 40942, 45830000, 128830000},
+    {40952, 40985, 41012, 45750000, 127480000},
+    {41020, 41056, 41083, 46080000, 127400000},
+    {41089, 41125, 41152, 45950000, 128030000},
+    {41158, 41194, 41221, 45970000, 128750000},
+    {41228, 41264, 41291, 45450000, 128330000},
+    {41299, 41335, 41362, 45220000, 127950000},
+    {41371, 41407, 41434, 44920000, 127150000},
+    {41442, 41471, 41507, 47330000, 123950000},
+    {41516, 41555, 41585, 47315219, 123950909},
+    {41593, 41632, 41662, 47352267, 123948842},
+    {41670, 41709, 41739, 47338366, 123971594},
+    {41747, 41789, 41822, 47153106, 123815723},
+    {41831, 41876, 41912, 47206852, 123622613},
+    {41921, 41963, 41996, 47514833, 122881655},
+    {42007, 42061, 42094, 47307338, 123746073},
+    {42102, 42141, 42171, 47330000, 123180000},
+    {42181, 42220, 42250, 47880000, 125300000},
+    {42255, 42294, 42324, 46400000, 123420000},
+    {42331, 42370, 42400, 47922406, 123507429},
+    {42407, 42446, 39113, 47820000, 124470000},
+    {42476, 42515, 42545, 48030000, 125870000},
+    {42552, 42591, 42621, 48030000, 126250000},
+    {42628, 42667, 42697, 47600000, 126080000},
+    {42705, 42744, 42774, 48480000, 124870000},
+    {42779, 42802, 42826, 45300000, 130970000},
+    {42831, 42864, 42888, 45301875, 130973385},
+    {42895, 42928, 42952, 45208615, 130897691},
+    {42961, 42994, 43018, 45346632, 130836259},
+    {43024, 43057, 37361, 45089887, 130689644},
+    {43081, 43117, 43144, 45334677, 131003646},
+    {43154, 43187, 43211, 45209797, 130470717},
+    {43218, 43251, 43275, 45250000, 131130000},
+    {43282, 43315, 43339, 45770000, 132980000},
+    {43345, 43378, 43402, 45550000, 131870000},
+    {43409, 43432, 43456, 47330000, 130270000},
+    {43463, 43496, 43520, 47340042, 130286464},
+    {43530, 43563, 43587, 47316377, 130266877},
+    {43596, 43629, 43653, 47312710, 130279232},
+    {43661, 43694, 27194, 47250480, 130231461},
+    {43718, 43751, 43775, 47336061, 130309163},
+    {43784, 43817, 43841, 47355210, 130295705},
+    {43850, 43883, 43907, 47580000, 130830000},
+    {43914, 43947, 43971, 47280000, 131850000},
+    {43978, 44004, 44034, 46630000, 131150000},
+    {44047, 44083, 44110, 46644122, 131150306},
+    {44119, 44155, 44182, 46590519, 131156640},
+    {44191, 44230, 44260, 46592111, 131326377},
+    {44270, 44306, 44333, 46574885, 131393349},
+    {44341, 44377, 1419, 46720000, 131130000},
+    {44404, 44440, 44467, 46780000, 131800000},
+    {44473, 44509, 44536, 46320000, 132200000},
+    {44544, 44580, 44607, 46800000, 134020000},
+    {44613, 44636, 44660, 46580000, 125030000},
+    {44667, 44703, 44730, 46594255, 125107591},
+    {44737, 44770, 44794, 46560175, 125128304},
+    {44803, 44839, 44866, 46650592, 124864148},
+    {44875, 44908, 44932, 46396709, 124884649},
+    {44941, 44974, 12895, 46037936, 124805901},
+    {44998, 45031, 45055, 45700000, 125270000},
+    {45064, 45097, 45121, 45520000, 125080000},
+    {45130, 45163, 45187, 47180000, 124870000},
+    {45195, 45249, 45279, 46870000, 124450000},
+    {45288, 45311, 45328, 47730000, 128900000},
+    {45335, 45368, 45328, 47730000, 128900000},
+    {45392, 45425, 45449, 47135727, 129275847},
+    {45456, 45489, 45513, 47851540, 128833672},
+    {45520, 45553, 45577, 47478265, 129305069},
+    {45583, 45616, 45640, 47724446, 128662943},
+    {45648, 45681, 45705, 48288322, 129525738},
+    {45713, 45746, 45770, 47632521, 129121536},
+    {45776, 45812, 45839, 47410511, 129421108},
+    {45850, 45883, 45907, 48120000, 129250000},
+    {45914, 45950, 45977, 47725346, 128792357},
+    {45984, 46020, 46047, 48452624, 129563304},
+    {46058, 46091, 46115, 47026112, 129013411},
+    {46123, 46159, 46186, 48600000, 129420000},
+    {46195, 46228, 46252, 48237010, 129382803},
+    {46261, 46297, 46324, 47972315, 129016669},
+    {46337, 46370, 46394, 48880000, 130380000},
+    {46401, 46434, 46458, 46980000, 128020000},
+    {46464, 46490, 46520, 46820000, 130370000},
+    {46528, 46564, 43520, 46805482, 130357435},
+    {46591, 46627, 46654, 46811780, 130367133},
+    {46662, 46698, 37785, 46820230, 130395710},
+    {46725, 46758, 13694, 46807844, 130319378},
+    {46785, 46821, 46848, 46230000, 130570000},
+    {46855, 46891, 46918, 47020000, 130720000},
+    {46927, 46963, 46990, 46730000, 129900000},
+    {46999, 47035, 47062, 47650000, 132520000},
+    {47072, 47108, 47135, 47250000, 132030000},
+    {47141, 47177, 47204, 48370000, 134280000},
+    {47211, 47237, 47267, 45780000, 130950000},
+    {47275, 47311, 47338, 45813894, 130924715},
+    {47346, 47382, 47409, 45763317, 131012491},
+    {47417, 47456, 47486, 45782837, 131060115},
+    {47494, 47530, 47557, 45750000, 130570000},
+    {47562, 47588, 47618, 44580000, 129600000},
+    {47629, 47665, 47692, 44579406, 129619573},
+    {47699, 47735, 47762, 44594140, 129628525},
+    {47771, 47807, 47834, 44594117, 129584618},
+    {47840, 47876, 37729, 44575681, 129609069},
+    {47903, 47939, 47966, 45300000, 130270000},
+    {47973, 48012, 48042, 44420000, 131150000},
+    {48051, 48087, 48114, 44570000, 129380000},
+    {48121, 48157, 48184, 44350000, 129470000},
+    {48191, 48227, 48254, 44920000, 130520000},
+    {48261, 48297, 48324, 44070000, 131120000},
+    {48333, 48356, 48380, 50250000, 127480000},
+    {48386, 48419, 48443, 50250407, 127493047},
+    {48449, 48482, 48506, 49170000, 125200000},
+    {48515, 48548, 48572, 49580000, 128470000},
+    {48578, 48611, 48635, 49420000, 127320000},
+    {48641, 48674, 48698, 48230000, 126520000},
+    {48704, 48743, 48773, 48520000, 126200000},
+    {48785, 48808, 48832, 46630000, 126980000},
+    {48839, 48872, 48896, 46635400, 126979195},
+    {48903, 48936, 48960, 46830000, 126480000},
+    {48968, 49001, 49025, 46270000, 126280000},
+    {49031, 49064, 49088, 46680000, 126100000},
+    {49097, 49130, 49154, 46880000, 127520000},
+    {49161, 49194, 49218, 47180000, 125900000},
+    {49227, 49260, 49284, 47250000, 127100000},
+    {49292, 49325, 49349, 46400000, 125330000},
+    {49354, 49387, 49411, 46070000, 125980000},
+    {49420, 49453, 49477, 47470000, 126970000},
+    {49484, 49516, 49552, 50420000, 124120000},
+    {49565, 49607, 49637, 52970000, 122530000},
+    {49642, 49690, 49726, 50420000, 124070000},
+    {49736, 49778, 49808, 51730000, 126650000},
+    {49813, 49855, 49885, 52320000, 124700000},
+    {49890, 49900, 49914, 31230000, 121470000},
+    {49923, 49943, 49957, 31233735, 121479956},
+    {49965, 49985, 50002, 31180000, 121430000},
+    {50011, 50031, 50045, 31222218, 121419987},
+    {50055, 50075, 50089, 31249003, 121454816},
+    {50096, 50116, 50130, 31251667, 121390903},
+    {50136, 50156, 50170, 31266619, 121500717},
+    {50178, 50198, 50212, 31261623, 121521735},
+    {50219, 50239, 50253, 31120000, 121380000},
+    {50261, 50281, 44333, 31400000, 121480000},
+    {50295, 50315, 50329, 31380000, 121270000},
+    {50337, 50360, 50380, 31220000, 121530000},
+    {50387, 50407, 50421, 30750000, 121330000},
+    {50429, 50449, 50463, 31030000, 121220000},
+    {50473, 50493, 50507, 31150000, 121120000},
+    {50514, 50534, 50548, 30920000, 121470000},
+    {50557, 50577, 50591, 31620000, 121400000},
+    {50601, 50621, 50642, 32070000, 118780000},
+    {50650, 50680, 50701, 32050762, 118792680},
+    {50708, 50738, 50759, 32041201, 118789559},
+    {50767, 50797, 50818, 32005583, 118726482},
+    {50825, 50855, 50876, 32068382, 118764571},
+    {50882, 50912, 50933, 32050000, 118620000},
+    {50939, 50969, 50990, 32104251, 118803537},
+    {50996, 51029, 51053, 31993384, 118773870},
+    {51062, 51092, 51113, 31950000, 118850000},
+    {51123, 51153, 51174, 32350000, 118830000},
+    {51179, 51209, 51230, 31650000, 119020000},
+    {51237, 51267, 51288, 31330000, 118880000},
+    {51296, 51316, 51337, 31570000, 120300000},
+    {51342, 51372, 51393, 31600000, 120350000},
+    {51400, 51430, 51451, 31682915, 120293892},
+    {51459, 51489, 51510, 31529883, 120278112},
+    {51516, 51546, 51567, 31567976, 120298137},
+    {51575, 51605, 51626, 31492346, 120359646},
+    {51632, 51662, 51683, 31900000, 120270000},
+    {51692, 51722, 51743, 31350000, 119820000},
+    {51750, 51770, 51791, 34270000, 117180000},
+    {51798, 51828, 50876, 34289723, 117179816},
+    {51849, 51879, 51900, 34254461, 117245841},
+    {51908, 51938, 51959, 34436609, 117460771},
+    {51967, 51997, 52018, 34245503, 117188048},
+    {52027, 52057, 52078, 34180000, 117170000},
+    {52087, 52114, 50548, 34700000, 116600000},
+    {52135, 52162, 52183, 34730000, 116930000},
+    {52191, 52221, 52242, 33900000, 117950000},
+    {52250, 52280, 52301, 34380000, 118350000},
+    {52307, 52337, 52358, 34320000, 117950000},
+    {52365, 52385, 52406, 31780000, 119950000},
+    {52416, 52446, 52467, 31781652, 119970241},
+    {52476, 52506, 52527, 31804342, 119897427},
+    {52536, 52566, 52587, 31832690, 119967434},
+    {52594, 52624, 52645, 31720000, 119930000},
+    {52651, 52681, 52702, 31750000, 119570000},
+    {52709, 52739, 52760, 31420000, 119480000},
+    {52767, 52787, 52808, 31300000, 120580000},
+    {52815, 52845, 52866, 31297014, 120562630},
+    {52872, 52902, 52923, 31270000, 120630000},
+    {52931, 52961, 52982, 31371212, 120638451},
+    {52993, 53023, 53044, 31338558, 120613118},
+    {53049, 53079, 53100, 31170000, 120630000},
+    {53108, 53138, 53159, 31650000, 120750000},
+    {53168, 53201, 53225, 31870000, 120550000},
+    {53238, 53268, 53289, 31380000, 120980000},
+    {53297, 53327, 53348, 31450000, 121100000},
+    {53356, 53376, 53397, 31980000, 120880000},
+    {53405, 53435, 53456, 32012015, 120853176},
+    {53467, 53497, 53518, 32034517, 120814187},
+    {53526, 53556, 424, 32080000, 121070000},
+    {53577, 53607, 53628, 32320000, 121180000},
+    {53635, 53665, 53686, 31820000, 121650000},
+    {53693, 53723, 53744, 32400000, 120570000},
+    {53750, 53780, 53801, 31900000, 121170000},
+    {53808, 53838, 53859, 32550000, 120450000},
+    {53865, 53888, 53915, 34600000, 119220000},
+    {53927, 53960, 53984, 34760841, 119333693},
+    {53992, 54025, 33434, 34607744, 119188129},
+    {54049, 54082, 54106, 34830000, 119120000},
+    {54112, 54145, 54169, 34530000, 118770000},
+    {54177, 54210, 54234, 34300000, 119250000},
+    {54242, 54275, 54299, 34080000, 119350000},
+    {54307, 54327, 8875, 33620000, 119020000},
+    {54348, 54378, 54402, 33521837, 119309090},
+    {54411, 54441, 54465, 33630000, 119030000},
+    {54475, 54508, 54532, 33554465, 119021129},
+    {54544, 54574, 54595, 33300000, 118830000},
+    {54602, 54632, 54653, 33780000, 119270000},
+    {54662, 54692, 54713, 33000000, 118480000},
+    {54718, 54748, 54769, 33020000, 119020000},
+    {54775, 54795, 54816, 33350000, 120150000},
+    {54825, 54855, 54876, 33392011, 120192513},
+    {54883, 54913, 54934, 33330000, 120150000},
+    {54940, 54970, 54991, 33200000, 120470000},
+    {54998, 55028, 55049, 34200000, 119570000},
+    {55059, 55089, 55110, 33980000, 119830000},
+    {55117, 55147, 4088, 33780000, 119800000},
+    {55168, 55198, 55219, 33780000, 120250000},
+    {55227, 55257, 55278, 33470000, 119800000},
+    {55285, 55315, 55336, 32850000, 120300000},
+    {55344, 55364, 55385, 32400000, 119400000},
+    {55394, 55424, 13313, 32396617, 119426395},
+    {55445, 55475, 55496, 32380000, 119400000},
+    {55505, 55535, 55556, 32430000, 119550000},
+    {55564, 55594, 55615, 33230000, 119300000},
+    {55623, 55653, 55674, 32270000, 119180000},
+    {55682, 55712, 55733, 32780000, 119430000},
+    {55740, 55760, 55781, 32200000, 119450000},
+    {55791, 55821, 55842, 32200246, 119464831},
+    {55850, 55880, 55901, 32197203, 119406483},
+    {55909, 55939, 55960, 32130000, 119450000},
+    {55966, 55996, 56017, 32000000, 119570000},
+    {56025, 56055, 56076, 32230000, 119820000},
+    {56086, 56116, 56137, 31950000, 119170000},
+    {56144, 56164, 56185, 32450000, 119920000},
+    {56193, 56223, 56244, 32493236, 119914686},
+    {56252, 56282, 56303, 32321055, 119876958},
+    {56311, 56341, 56362, 32520000, 120150000},
+    {56371, 56401, 56422, 32920000, 119850000},
+    {56430, 56460, 56481, 32020000, 120270000},
+    {56491, 56521, 56542, 32170000, 120020000},
+    {56550, 56570, 56591, 33970000, 118280000},
+    {56598, 56628, 56649, 33964388, 118237027},
+    {56657, 56687, 56708, 33950000, 118320000},
+    {56713, 56743, 56764, 34130000, 118770000},
+    {56772, 56802, 56823, 33720000, 118680000},
+    {56830, 56860, 56881, 33470000, 118220000},
+    {56888, 56908, 56929, 30280000, 120150000},
+    {56938, 56968, 56989, 30244670, 120164679},
+    {57000, 57030, 57051, 30284090, 120176277},
+    {57060, 57090, 57111, 30259431, 120200451},
+    {57120, 57150, 57171, 30321338, 120136670},
+    {57179, 57209, 31800, 30261616, 120125445},
+    {57230, 57260, 57281, 30210992, 120207286},
+    {57290, 57320, 57341, 30170000, 120270000},
+    {57350, 57380, 57401, 30420000, 120300000},
+    {57408, 57438, 57459, 30050000, 119950000},
+    {57466, 57496, 57517, 30230000, 119720000},
+    {57523, 57553, 57574, 29800000, 119670000},
+    {57581, 57611, 57632, 29600000, 119030000},
+    {57639, 57669, 57690, 29480000, 119280000},
+    {57697, 57717, 57738, 29880000, 121550000},
+    {57745, 57775, 57796, 29862358, 121546911},
+    {57803, 57833, 57854, 29889349, 121551080},
+    {57863, 57893, 57914, 29930000, 121850000},
+    {57921, 57951, 57972, 29950000, 121720000},
+    {57980, 58010, 34688, 29830000, 121530000},
+    {58031, 58061, 58082, 29650000, 121400000},
+    {58090, 58120, 58141, 29480000, 121870000},
+    {58151, 58181, 58202, 29280000, 121430000},
+    {58210, 58240, 58261, 30030000, 121150000},
+    {58267, 58297, 58318, 30170000, 121230000},
+    {58323, 58343, 58364, 28000000, 120700000},
+    {58372, 58402, 14087, 28018822, 120651161},
+    {58423, 58453, 58474, 27936036, 120807182},
+    {58482, 58512, 58533, 27970257, 120610992},
+    {58539, 58569, 58590, 27830000, 121150000},
+    {58598, 58628, 58649, 28150000, 120680000},
+    {58657, 58687, 58708, 27670000, 120570000},
+    {58717, 58747, 58768, 27500000, 120400000},
+    {58776, 58806, 58827, 27780000, 120080000},
+    {58836, 58866, 58887, 27570000, 119720000},
+    {58895, 58925, 58946, 27780000, 120630000},
+    {58952, 58982, 59003, 28130000, 120950000},
+    {59011, 59031, 59052, 30750000, 120750000},
+    {59060, 59090, 59111, 30750160, 120778728},
+    {59117, 59147, 59168, 30767488, 120704729},
+    {59176, 59206, 59227, 30850000, 120920000},
+    {59235, 59265, 59286, 30530000, 120950000},
+    {59293, 59323, 59344, 30530000, 120680000},
+    {59352, 59382, 59403, 30700000, 121020000},
+    {59410, 59440, 59461, 30630000, 120570000},
+    {59471, 59491, 59512, 30900000, 120080000},
+    {59519, 59549, 59570, 30859330, 120181185},
+    {59577, 59607, 59628, 30851758, 120413888},
+    {59635, 59665, 59686, 30530000, 119970000},
+    {59693, 59723, 59744, 31020000, 119900000},
+    {59754, 59784, 59805, 30630000, 119680000},
+    {59810, 59830, 59851, 30000000, 120570000},
+    {59860, 59890, 59911, 29990883, 120578557},
+    {59920, 59950, 59971, 30080426, 120471668},
+    {59978, 60008, 60029, 30030000, 120870000},
+    {60037, 60067, 60088, 29500000, 120900000},
+    {60097, 60127, 60148, 29720000, 120230000},
+    {60154, 60184, 60205, 29580000, 120820000},
+    {60215, 60235, 60256, 29080000, 119650000},
+    {60263, 60293, 60314, 29089223, 119566919},
+    {60322, 60352, 60373, 29101998, 119688090},
+    {60381, 60411, 11765, 28900000, 119820000},
+    {60432, 60462, 60483, 29450000, 119880000},
+    {60491, 60521, 60542, 29050000, 120430000},
+    {60548, 60578, 49025, 29220000, 119450000},
+    {60599, 60629, 60650, 29300000, 120070000},
+    {60655, 60685, 60706, 29280000, 120230000},
+    {60715, 60745, 60766, 28900000, 120030000},
+    {60775, 60795, 5336, 28930000, 118870000},
+    {60816, 60846, 60867, 28971607, 118866556},
+    {60875, 60905, 60926, 28980000, 118930000},
+    {60934, 60964, 60985, 28900000, 118520000},
+    {60995, 61025, 61046, 29130000, 118420000},
+    {61053, 61083, 61104, 29030000, 119170000},
+    {61112, 61142, 61163, 28750000, 118620000},
+    {61173, 61193, 61214, 30000000, 122200000},
+    {61223, 61253, 61274, 30020000, 122100000},
+    {61282, 61312, 50130, 29950000, 122300000},
+    {61333, 61363, 61384, 30250000, 122200000},
+    {61392, 61422, 61443, 30730000, 122450000},
+    {61451, 61471, 56185, 28661049, 121415405},
+    {61492, 61522, 61543, 28680000, 121430000},
+    {61553, 61583, 61604, 28650000, 121270000},
+    {61613, 61643, 61664, 28580000, 121380000},
+    {61671, 61701, 61722, 29120000, 121380000},
+    {61729, 61759, 61780, 29130000, 121030000},
+    {61788, 61818, 61839, 28870000, 120730000},
+    {61846, 61876, 61897, 28370000, 121370000},
+    {61905, 61935, 61956, 28850000, 121120000},
+    {61963, 61993, 62014, 28130000, 121230000},
+    {62021, 62041, 51230, 28450000, 119920000},
+    {62062, 62092, 62113, 28449256, 119908208},
+    {62121, 62151, 62172, 28150000, 120280000},
+    {62181, 62211, 62232, 28650000, 120070000},
+    {62239, 62269, 62290, 28600000, 119270000},
+    {62299, 62329, 62350, 28450000, 119480000},
+    {62359, 62389, 10009, 28120000, 119570000},
+    {62410, 62440, 6804, 27620000, 119050000},
+    {62461, 62503, 62524, 27980000, 119630000},
+    {62533, 62563, 62584, 28080000, 119130000},
+    {62593, 62613, 62634, 31830000, 117250000},
+    {62640, 62670, 62691, 31860003, 117303653},
+    {62698, 62728, 62749, 31880657, 117259098},
+    {62756, 62786, 62807, 31853170, 117255046},
+    {62815, 62845, 62866, 31795036, 117304087},
+    {62872, 62902, 62923, 32480000, 117170000},
+    {62933, 62963, 62984, 31880000, 117470000},
+    {62992, 63022, 63043, 31720000, 117170000},
+    {63049, 63079, 63100, 31250000, 117280000},
+    {63108, 63138, 63159, 31600000, 117870000},
+    {63166, 63186, 63207, 31330000, 118380000},
+    {63212, 63242, 63263, 31342246, 118379735},
+    {63270, 63300, 63321, 31313621, 118367256},
+    {63329, 63359, 63380, 31371201, 118386318},
+    {63389, 63419, 63440, 31221634, 118262860},
+    {63448, 63478, 63502, 31150000, 118570000},
+    {63511, 63541, 63562, 31080000, 118200000},
+    {63571, 63601, 63622, 30920000, 118330000},
+    {63630, 63660, 63681, 31300000, 117920000},
+    {63687, 63707, 63728, 32920000, 117380000},
+    {63735, 63768, 63792, 32944700, 117387936},
+    {63801, 63831, 63852, 32945906, 117361794},
+    {63861, 63891, 63912, 32931469, 117336687},
+    {63918, 63948, 63969, 32967140, 117353525},
+    {63979, 64009, 64030, 32970000, 117180000},
+    {64039, 64069, 64090, 33150000, 117880000},
+    {64095, 64125, 64146, 33320000, 117320000},
+    {64153, 64173, 64194, 32630000, 117000000},
+    {64202, 64232, 12895, 32633439, 117047648},
+    {64253, 64286, 64310, 32649144, 117011908},
+    {64320, 64353, 64377, 32602111, 116853877},
+    {64386, 64419, 64443, 32633534, 116828277},
+    {64454, 64484, 64505, 32780000, 116820000},
+    {64511, 64541, 195, 32700000, 116720000},
+    {64562, 64589, 64610, 32580000, 116780000},
+    {64619, 64642, 64669, 31700000, 118500000},
+    {64678, 64711, 64735, 31721663, 118487325},
+    {64743, 64776, 64800, 31684176, 118493349},
+    {64807, 64840, 64864, 31560563, 118839496},
+    {64871, 64904, 64928, 31550000, 118480000},
+    {64935, 64968, 4401, 31720000, 118100000},
+    {64992, 65022, 65046, 31720000, 118370000},
+    {65053, 65073, 65094, 33950000, 116800000},
+    {65102, 65132, 65153, 33992923, 116822783},
+    {65158, 65188, 58141, 33961314, 116788943},
+    {65209, 65239, 65260, 33896604, 116807674},
+    {65268, 65298, 65319, 33920000, 116770000},
+    {65325, 65345, 65366, 30930000, 117820000},
+    {65375, 65405, 65426, 30938579, 117850911},
+    {65435, 65465, 42250, 30954966, 117786073},
+    {65486, 65513, 13694, 30911234, 117801721},
+    {65534, 65564, 65585, 30700000, 117200000},
+    {65594, 65614, 65635, 30530000, 117050000},
+    {65642, 65672, 65693, 30513815, 117085652},
+    {65703, 65733, 65754, 30556331, 117016344},
+    {65761, 65791, 65812, 30543597, 117064532},
+    {65818, 65848, 65869, 30720000, 116830000},
+    {65878, 65908, 30999, 30630000, 116570000},
+    {65929, 65959, 65980, 30430000, 116270000},
+    {65986, 66016, 66037, 30150000, 116120000},
+    {66044, 66074, 66095, 30130000, 116680000},
+    {66105, 66135, 66156, 30850000, 116350000},
+    {66162, 66192, 66213, 31050000, 116950000},
+    {66223, 66243, 66264, 29710646, 118315421},
+    {66274, 66304, 66325, 29720000, 118330000},
+    {66331, 66361, 66385, 30300000, 118130000},
+    {66397, 66427, 66448, 29829664, 118331538},
+    {66456, 66483, 4934, 29870000, 118430000},
+    {66504, 66534, 66555, 29780000, 118180000},
+    {66563, 66590, 7447, 29930000, 117930000},
+    {66611, 66641, 66662, 29870000, 117720000},
+    {66668, 66688, 66709, 32300000, 118320000},
+    {66717, 66747, 66768, 32296557, 118300462},
+    {66775, 66805, 66826, 32331885, 118291585},
+    {66834, 66864, 66885, 32450000, 118430000},
+    {66891, 66921, 66942, 32100000, 118270000},
+    {66951, 66981, 67002, 32530000, 117670000},
+    {67011, 67041, 67062, 32870000, 117570000},
+    {67071, 67101, 67122, 32700000, 119000000},
+    {67132, 67162, 67183, 32780000, 117980000},
+    {67193, 67213, 57459, 32900000, 115820000},
+    {67234, 67264, 67285, 32885458, 115801554},
+    {67294, 67324, 67345, 32914538, 115851424},
+    {67354, 67384, 67405, 32926883, 115802938},
+    {67414, 67444, 67465, 33070000, 115250000},
+    {67473, 67503, 32695, 33170000, 115620000},
+    {67524, 67554, 67575, 32630000, 115580000},
+    {67581, 67611, 67632, 32630000, 116270000},
+    {67642, 67672, 67693, 33240000, 115340000},
+    {67701, 67721, 52808, 33630000, 116980000},
+    {67742, 67772, 67793, 33641592, 116972030},
+    {67802, 67832, 67853, 34420000, 116350000},
+    {67862, 67889, 67910, 34180000, 116930000},
+    {67919, 67949, 67970, 33550000, 117550000},
+    {67977, 68004, 68025, 33480000, 117880000},
+    {68032, 68052, 68073, 31770000, 116500000},
+    {68078, 68108, 68129, 31751385, 116534655},
+    {68135, 68165, 68186, 31739761, 116474703},
+    {68191, 68221, 68242, 31865441, 115919705},
+    {68247, 68277, 68298, 32330000, 116270000},
+    {68305, 68335, 68356, 31470000, 116930000},
+    {68365, 68395, 68416, 31720000, 115920000},
+    {68424, 68454, 68475, 31400000, 116330000},
+    {68483, 68503, 68524, 33850000, 115780000},
+    {68531, 68561, 68582, 33877672, 115773483},
+    {68592, 68622, 68643, 33520000, 116220000},
+    {68651, 68681, 68702, 33270000, 116570000},
+    {68712, 68742, 68763, 33150000, 116200000},
+    {68769, 68789, 68810, 30670000, 117480000},
+    {68818, 68848, 68869, 30689720, 117562128},
+    {68876, 68906, 68927, 30100000, 117020000},
+    {68935, 68965, 68986, 30220000, 117480000},
+    {68993, 69023, 69044, 30650000, 117850000},
+    {69053, 69073, 69094, 30950000, 118750000},
+    {69104, 69134, 69155, 30948535, 118751204},
+    {69164, 69194, 69215, 31130000, 119170000},
+    {69222, 69252, 69273, 30900000, 119420000},
+    {69281, 69308, 12053, 30700000, 118400000},
+    {69329, 69359, 42826, 30070000, 118600000},
+    {69380, 69410, 69431, 30280000, 118530000},
+    {69438, 69468, 69489, 30630000, 118980000},
+    {69497, 69517, 69538, 26080000, 119300000},
+    {69545, 69575, 50876, 26085389, 119299010},
+    {69596, 69626, 69647, 26055900, 119309225},
+    {69656, 69686, 69707, 26049856, 119268777},
+    {69716, 69746, 69767, 25992459, 119450739},
+    {69773, 69803, 68129, 26085155, 119323656},
+    {69824, 69854, 69875, 25970000, 119520000},
+    {69883, 69913, 69934, 26150000, 119130000},
+    {69941, 69971, 69992, 26200000, 119530000},
+    {70002, 70032, 70053, 26480000, 119550000},
+    {70061, 70091, 70112, 26220000, 118850000},
+    {70120, 70150, 70171, 25870000, 118930000},
+    {70179, 70209, 70230, 25520000, 119780000},
+    {70238, 70268, 70289, 25720000, 119380000},
+    {70296, 70316, 70337, 24480000, 118080000},
+    {70344, 70374, 70395, 24448211, 118077684},
+    {70402, 70432, 70453, 24487240, 118027912},
+    {70461, 70491, 70512, 24515600, 118141864},
+    {70517, 70547, 70568, 24578626, 118092355},
+    {70574, 70604, 70625, 24730000, 118150000},
+    {70632, 70662, 70683, 24621386, 118243318},
+    {70691, 70711, 70732, 25416656, 119016953},
+    {70739, 70769, 70790, 25430000, 119000000},
+    {70801, 70831, 55496, 25450000, 119100000},
+    {70852, 70882, 14267, 25430000, 119020000},
+    {70903, 70933, 70954, 25170195, 119312659},
+    {70960, 70990, 71011, 25370000, 118680000},
+    {71019, 71039, 71060, 26270000, 117620000},
+    {71068, 71098, 71119, 26275129, 117640945},
+    {71126, 71156, 71177, 26237460, 117603178},
+    {71185, 71215, 71236, 26370000, 117200000},
+    {71243, 71273, 71294, 26180000, 116820000},
+    {71302, 71332, 71353, 26270000, 116650000},
+    {71361, 71391, 71412, 25700000, 117850000},
+    {71419, 71449, 71470, 26170000, 118180000},
+    {71476, 71503, 71524, 26400000, 117780000},
+    {71532, 71562, 71583, 26730000, 117470000},
+    {71591, 71621, 71642, 26900000, 117170000},
+    {71650, 71680, 71701, 26830000, 116830000},
+    {71710, 71740, 71761, 25980000, 117370000},
+    {71768, 71788, 71809, 24880000, 118670000},
+    {71818, 71848, 14267, 24910581, 118582435},
+    {71869, 71899, 71920, 24894173, 118608725},
+    {71927, 71957, 71978, 24942704, 118666651},
+    {71987, 72017, 72038, 25122783, 118911833},
+    {72047, 72077, 72098, 25030000, 118800000},
+    {72104, 72134, 72155, 25070000, 118180000},
+    {72160, 72190, 72211, 25320000, 118300000},
+    {72220, 72250, 72271, 25500000, 118230000},
+    {72277, 72307, 72328, 24435452, 118312332},
+    {72335, 72365, 72386, 24730000, 118650000},
+    {72393, 72423, 72444, 24820000, 118580000},
+    {72453, 72483, 72504, 24970000, 118380000},
+    {72510, 72530, 72551, 24520000, 117650000},
+    {72561, 72591, 52982, 24513866, 117649177},
+    {72612, 72642, 72663, 24505979, 117704861},
+    {72671, 72701, 72722, 23950000, 117330000},
+    {72730, 72760, 72781, 24130000, 117620000},
+    {72789, 72819, 72840, 23720000, 117180000},
+    {72847, 72877, 72898, 24620000, 117750000},
+    {72907, 72937, 43775, 23700000, 117430000},
+    {72958, 72988, 50642, 24520000, 117370000},
+    {73009, 73039, 73060, 24370000, 117300000},
+    {73067, 73097, 73118, 25020000, 117530000},
+    {73124, 73154, 73175, 24450000, 117820000},
+    {73183, 73203, 73224, 26650000, 118170000},
+    {73232, 73262, 73283, 26640761, 118176918},
+    {73291, 73321, 73342, 27330000, 118120000},
+    {73351, 73381, 73402, 26800000, 117800000},
+    {73412, 73442, 73463, 27920000, 118530000},
+    {73471, 73501, 73522, 27550000, 117330000},
+    {73530, 73560, 73581, 27530000, 118780000},
+    {73588, 73618, 73639, 27370000, 118850000},
+    {73647, 73677, 73698, 27370000, 117480000},
+    {73705, 73738, 73762, 27770000, 118030000},
+    {73771, 73801, 73822, 27030000, 118320000},
+    {73829, 73849, 73870, 25100000, 117030000},
+    {73878, 73908, 73929, 25100993, 117032318},
+    {73936, 73966, 73987, 24720000, 116730000},
+    {73996, 74026, 74047, 25830000, 116350000},
+    {74057, 74087, 74108, 25050000, 116420000},
+    {74118, 74148, 74169, 25100000, 116100000},
+    {74176, 74206, 74227, 25720000, 116750000},
+    {74237, 74267, 74288, 25300000, 117420000},
+    {74298, 74318, 74339, 26670000, 119520000},
+    {74346, 74376, 18940, 26664053, 119521648},
+    {74397, 74427, 74448, 26880000, 120000000},
+    {74454, 74484, 74505, 26580000, 118750000},
+    {74512, 74542, 74563, 26920000, 118980000},
+    {74571, 74601, 74622, 27470000, 119500000},
+    {74631, 74661, 74682, 27120000, 119330000},
+    {74691, 74721, 74742, 27230000, 119900000},
+    {74750, 74780, 74801, 27080000, 119650000},
+    {74806, 74836, 74857, 27330000, 120220000},
+    {74864, 74884, 74905, 28680000, 115850000},
+    {74914, 74944, 74965, 28688450, 115894421},
+    {74972, 75002, 31800, 28660964, 115872370},
+    {75023, 75056, 75080, 28624558, 115920911},
+    {75090, 75120, 75141, 28717967, 115725734},
+    {75147, 75180, 75204, 28686273, 115957242},
+    {75215, 75245, 75266, 28700000, 115820000},
+    {75274, 75304, 75328, 28550000, 115930000},
+    {75341, 75371, 75392, 28850000, 115550000},
+    {75397, 75427, 75448, 28370000, 116270000},
+    {75456, 75479, 75506, 29270000, 117170000},
+    {75517, 75550, 75574, 29276085, 117178440},
+    {75585, 75618, 75642, 29302588, 117197611},
+    {75650, 75683, 75707, 29370000, 117250000},
+    {75715, 75748, 75772, 28970000, 117120000},
+    {75779, 75799, 6237, 27630000, 113850000},
+    {75820, 75850, 75871, 27650000, 113870000},
+    {75878, 75908, 75929, 27650000, 113730000},
+    {75939, 75969, 75990, 27130000, 113950000},
+    {75998, 76028, 76049, 27880000, 113800000},
+    {76057, 76087, 76108, 27630000, 114030000},
+    {76113, 76133, 63380, 29700000, 116000000},
+    {76154, 76184, 76205, 29670596, 115987637},
+    {76212, 76242, 76263, 29730162, 115985239},
+    {76271, 76301, 76322, 29611653, 115906009},
+    {76331, 76361, 76382, 29270000, 115100000},
+    {76389, 76419, 76440, 29030000, 114570000},
+    {76448, 76478, 76499, 29030000, 115800000},
+    {76507, 76537, 76558, 29330000, 115770000},
+    {76563, 76593, 76614, 29270000, 116180000},
+    {76622, 76652, 76673, 29730000, 116220000},
+    {76679, 76709, 76730, 29900000, 116550000},
+    {76737, 76767, 76788, 29680000, 115670000},
+    {76797, 76830, 76854, 29251133, 115803777},
+    {76868, 76898, 76919, 29680000, 115980000},
+    {76926, 76946, 76967, 27820000, 114920000},
+    {76973, 77003, 77024, 27803807, 114939757},
+    {77031, 77061, 77082, 27820000, 114670000},
+    {77088, 77108, 77129, 28270000, 117070000},
+    {77137, 77167, 77188, 28242350, 117031951},
+    {77194, 77224, 77245, 28200000, 116820000},
+    {77253, 77283, 77304, 28280000, 117220000},
+    {77310, 77330, 77351, 25830000, 114930000},
+    {77359, 77389, 77410, 25821006, 114916464},
+    {77420, 77450, 77471, 25650000, 114750000},
+    {77479, 77509, 77530, 25870000, 115000000},
+    {77538, 77568, 77589, 25380000, 114930000},
+    {77597, 77627, 77648, 25400000, 114350000},
+    {77653, 77683, 77704, 25800000, 114530000},
+    {77713, 77743, 77764, 25700000, 114300000},
+    {77772, 77802, 75871, 25130000, 115380000},
+    {77823, 77853, 77874, 24920000, 114780000},
+    {77882, 77912, 77933, 24780000, 115030000},
+    {77941, 77971, 77992, 24750000, 114520000},
+    {78000, 78030, 78051, 26480000, 116020000},
+    {78058, 78088, 78109, 25950000, 115420000},
+    {78114, 78144, 78165, 26330000, 115350000},
+    {78173, 78203, 78224, 25600000, 115780000},
+    {78233, 78263, 78284, 24950000, 115650000},
+    {78290, 78320, 78341, 26330000, 116330000},
+    {78350, 78380, 78401, 25880000, 116030000},
+    {78408, 78428, 38330, 27120000, 114980000},
+    {78449, 78479, 11647, 27147139, 114989770},
+    {78500, 78530, 6804, 27085272, 115009752},
+    {78551, 78581, 78605, 27050000, 114900000},
+    {78614, 78644, 78665, 27220000, 115130000},
+    {78672, 78702, 78723, 27620000, 115330000},
+    {78732, 78762, 27194, 27770000, 115400000},
+    {78783, 78813, 78834, 27320000, 115430000},
+    {78843, 78873, 32695, 26800000, 114880000},
+    {78894, 78924, 78945, 26330000, 114520000},
+    {78954, 78984, 79005, 26470000, 114780000},
+    {79011, 79041, 79062, 27380000, 114620000},
+    {79067, 79097, 79118, 26950000, 114230000},
+    {79126, 79159, 79183, 26720000, 114270000},
+    {79196, 79216, 45328, 27800000, 114380000},
+    {79237, 79267, 79288, 27801953, 114419365},
+    {79297, 79327, 79348, 28700000, 115380000},
+    {79356, 79386, 79407, 28120000, 114430000},
+    {79414, 79444, 79465, 28230000, 114920000},
+    {79474, 79504, 79525, 28380000, 114780000},
+    {79532, 79562, 50089, 28870000, 115350000},
+    {79583, 79613, 79634, 28530000, 114370000},
+    {79641, 79671, 32479, 28200000, 115780000},
+    {79692, 79722, 79743, 28070000, 115530000},
+    {79752, 79782, 79803, 28420000, 115370000},
+    {79809, 79829, 69538, 28000000, 116350000},
+    {79850, 79880, 79901, 27937789, 116307250},
+    {79910, 79940, 79961, 28230000, 116620000},
+    {79971, 80001, 80022, 27550000, 116630000},
+    {80031, 80061, 80082, 27300000, 116920000},
+    {80090, 80120, 80141, 27220000, 116530000},
+    {80149, 80179, 80200, 27770000, 116050000},
+    {80209, 80239, 80260, 27430000, 115830000},
+    {80265, 80295, 80316, 27550000, 116220000},
+    {80324, 80354, 80375, 27920000, 116770000},
+    {80381, 80411, 80432, 27700000, 117070000},
+    {80437, 80467, 80488, 26830000, 116320000},
+    {80499, 80519, 80540, 28450000, 117970000},
+    {80549, 80579, 16879, 28434363, 117961435},
+    {80600, 80630, 80651, 28430000, 118180000},
+    {80661, 80691, 80715, 28430000, 117920000},
+    {80728, 80758, 64800, 28680000, 118250000},
+    {80779, 80809, 10300, 28320000, 117700000},
+    {80830, 80860, 80881, 28420000, 117600000},
+    {80890, 80920, 80941, 28400000, 117430000},
+    {80948, 80978, 80999, 28700000, 116680000},
+    {81005, 81035, 81056, 29000000, 116670000},
+    {81063, 81093, 81114, 28700000, 117070000},
+    {81122, 81152, 25600, 29250000, 117850000},
+    {81173, 81203, 81224, 28950000, 117570000},
+    {81231, 81251, 68129, 36670000, 116980000},
+    {81272, 81302, 81323, 36665974, 117070351},
+    {81329, 81359, 81380, 36651228, 116991946},
+    {81389, 81419, 81440, 36651375, 116895672},
+    {81448, 81478, 81499, 36677785, 116981703},
+    {81508, 81538, 14267, 36679584, 117059154},
+    {81559, 81589, 81610, 36550000, 116730000},
+    {81620, 81650, 81671, 36720000, 117530000},
+    {81680, 81710, 81731, 36980000, 117220000},
+    {81738, 81768, 81789, 36220000, 117670000},
+    {81795, 81825, 81846, 36059696, 117805577},
+    {81856, 81886, 81907, 36280000, 116450000},
+    {81915, 81945, 81966, 37320000, 117150000},
+    {81974, 81994, 82015, 36070000, 120380000},
+    {82023, 82053, 82074, 36075367, 120407268},
+    {82081, 82111, 82132, 36087336, 120369600},
+    {82139, 82169, 82190, 35970000, 120180000},
+    {82199, 82229, 82250, 36100000, 120470000},
+    {82258, 82288, 82309, 36145181, 120427600},
+    {82316, 82346, 82367, 36306718, 120391151},
+    {82377, 82407, 82428, 36380000, 120450000},
+    {82433, 82463, 82484, 36270000, 120030000},
+    {82493, 82523, 82544, 36780000, 119950000},
+    {82551, 82581, 82602, 36870000, 120500000},
+    {82608, 82628, 82649, 36820000, 118050000},
+    {82654, 82684, 82705, 36567894, 117971039},
+    {82713, 82743, 82764, 36806246, 118011927},
+    {82774, 82804, 82825, 36500000, 117850000},
+    {82832, 82862, 82883, 36820000, 118300000},
+    {82889, 82919, 82940, 36800000, 117870000},
+    {82948, 82978, 82999, 36970000, 118080000},
+    {83007, 83037, 83058, 37170000, 117820000},
+    {83066, 83096, 83117, 36180000, 118170000},
+    {83124, 83144, 83165, 34820000, 117320000},
+    {83175, 83205, 81380, 34865079, 117550449},
+    {83226, 83256, 83277, 34800000, 117250000},
+    {83286, 83316, 17919, 34770000, 117580000},
+    {83337, 83370, 83394, 34570000, 117730000},
+    {83406, 83436, 83457, 35099979, 117455515},
+    {83466, 83496, 83517, 35080000, 117150000},
+    {83526, 83546, 83560, 37430000, 118670000},
+    {83569, 83599, 83560, 37430000, 118670000},
+    {83620, 83650, 83671, 37880000, 118530000},
+    {83677, 83707, 83728, 37580000, 118550000},
+    {83734, 83764, 83785, 37480000, 118250000},
+    {83791, 83821, 83842, 37070000, 118400000},
+    {83851, 83871, 83892, 37450000, 121430000},
+    {83899, 83929, 83950, 37539654, 121394757},
+    {83956, 83986, 18209, 37500000, 121250000},
+    {84007, 84037, 84058, 37380000, 121600000},
+    {84066, 84096, 84117, 37510373, 121439932},
+    {84125, 84155, 84176, 37920000, 120730000},
+    {84185, 84215, 84236, 37650000, 120520000},
+    {84244, 84274, 84295, 36980000, 120700000},
+    {84303, 84333, 84354, 37180000, 119930000},
+    {84362, 84392, 84413, 37820000, 120750000},
+    {84421, 84451, 45121, 37370000, 120400000},
+    {84472, 84502, 50990, 37300000, 120830000},
+    {84523, 84553, 84574, 36780000, 121150000},
+    {84582, 84602, 84623, 36700000, 119150000},
+    {84631, 84661, 84682, 36727686, 119019013},
+    {84691, 84721, 84742, 36775097, 119213964},
+    {84750, 84780, 84801, 36654046, 119160620},
+    {84808, 84838, 84859, 36707185, 119126546},
+    {84866, 84896, 84917, 36520000, 118530000},
+    {84923, 84953, 69875, 36700000, 118820000},
+    {84974, 85004, 85025, 36680000, 118470000},
+    {85034, 85064, 85085, 36000000, 119400000},
+    {85094, 85124, 85145, 36880000, 118730000},
+    {85155, 85185, 85206, 36430000, 119200000},
+    {85212, 85242, 85263, 36380000, 119750000},
+    {85269, 85299, 36689, 36870000, 119400000},
+    {85320, 85340, 26220, 35420000, 116580000},
+    {85361, 85391, 85412, 35407053, 116589761},
+    {85421, 85451, 85472, 35550000, 116830000},
+    {85480, 85510, 85531, 34820000, 117130000},
+    {85539, 85569, 85590, 35000000, 116650000},
+    {85596, 85626, 85647, 35070000, 116300000},
+    {85656, 85686, 85707, 35420000, 116330000},
+    {85716, 85746, 85767, 35730000, 116480000},
+    {85776, 85806, 85827, 35670000, 117270000},
+    {85834, 85864, 85885, 35800000, 116080000},
+    {85895, 85925, 85946, 35580000, 116980000},
+    {85951, 85981, 86002, 35400000, 116970000},
+    {86011, 86031, 31059, 36200000, 117080000},
+    {86052, 86082, 86103, 36191861, 117129292},
+    {86111, 86141, 86162, 36187811, 117035625},
+    {86169, 86199, 86220, 35770000, 116800000},
+    {86229, 86259, 86280, 35930000, 116470000},
+    {86289, 86319, 86340, 35920000, 117770000},
+    {86347, 86377, 86398, 36180000, 116770000},
+    {86407, 86427, 86448, 37520000, 122120000},
+    {86455, 86485, 86506, 37500964, 122118393},
+    {86514, 86544, 86565, 37200000, 122050000},
+    {86573, 86603, 7215, 37170000, 122420000},
+    {86624, 86654, 86675, 36920000, 121530000},
+    {86682, 86702, 86723, 35420000, 119520000},
+    {86730, 86760, 32419, 35425572, 119456545},
+    {86781, 86811, 86832, 35122308, 119313276},
+    {86840, 86870, 86891, 35750000, 119200000},
+    {86898, 86925, 86946, 35580000, 118830000},
+    {86953, 86973, 16200, 35050000, 118350000},
+    {86994, 87024, 86832, 35052200, 118341997},
+    {87045, 87075, 87096, 34997378, 118279166},
+    {87106, 87136, 831, 35090285, 118397107},
+    {87157, 87187, 87208, 35550000, 118470000},
+    {87214, 87244, 87265, 34620000, 118350000},
+    {87274, 87304, 87325, 35780000, 118620000},
+    {87332, 87362, 87383, 34856822, 117999830},
+    {87391, 87418, 87439, 35270000, 117970000},
+    {87447, 87477, 87498, 35500000, 117630000},
+    {87505, 87535, 87556, 35180000, 118830000},
+    {87562, 87592, 87613, 35720000, 117930000},
+    {87621, 87651, 87672, 34920000, 118650000},
+    {87679, 87699, 87720, 37450000, 116300000},
+    {87727, 87757, 87778, 37450039, 116293689},
+    {87786, 87816, 87837, 37330000, 116570000},
+    {87846, 87876, 6004, 37650000, 116780000},
+    {87897, 87927, 87948, 37780000, 117380000},
+    {87956, 87986, 16200, 37180000, 116870000},
+    {88007, 88037, 88058, 36800000, 116750000},
+    {88063, 88093, 88114, 37170000, 116430000},
+    {88123, 88153, 88174, 36950000, 116000000},
+    {88181, 88211, 60314, 37220000, 116070000},
+    {88232, 88262, 88283, 37730000, 117230000},
+    {88290, 88320, 88341, 36930000, 116630000},
+    {88349, 88369, 88390, 36450000, 115980000},
+    {88400, 88433, 88457, 36434558, 115982803},
+    {88469, 88499, 88520, 36120000, 115780000},
+    {88527, 88554, 88575, 36230000, 115670000},
+    {88584, 88614, 88635, 36580000, 116250000},
+    {88643, 88673, 88694, 36330000, 116250000},
+    {88700, 88727, 88748, 36480000, 115430000},
+    {88757, 88787, 88808, 36870000, 116230000},
+    {88816, 88846, 88867, 36850000, 115700000},
+    {88875, 88895, 88916, 37380000, 117970000},
+    {88924, 88954, 88975, 37429914, 118013263},
+    {88984, 89014, 89035, 37700000, 118130000},
+    {89043, 89073, 19763, 37480000, 117500000},
+    {89094, 89124, 89145, 37630000, 117580000},
+    {89153, 89183, 89204, 37730000, 117600000},
+    {89209, 89239, 89260, 37150000, 118130000},
+    {89267, 89297, 89318, 36880000, 117730000},
+    {89326, 89346, 89367, 35240163, 115469125},
+    {89372, 89402, 89423, 35252768, 115411825},
+    {89429, 89459, 89480, 35070000, 115570000},
+    {89488, 89515, 89536, 34830000, 115530000},
+    {89544, 89571, 89592, 34800000, 116080000},
+    {89601, 89631, 89652, 34950000, 115880000},
+    {89660, 89690, 89711, 35400000, 116080000},
+    {89716, 89746, 16083, 35600000, 115930000},
+    {89767, 89797, 89818, 35570000, 115500000},
+    {89828, 89858, 89879, 35280000, 115080000},
+    {89888, 89908, 89929, 34750000, 113620000},
+    {89939, 89969, 89990, 34749449, 113606810},
+    {90000, 90030, 90051, 34725115, 113634118},
+    {90056, 90092, 90113, 34755588, 113671423},
+    {90123, 90153, 90174, 34801229, 113654455},
+    {90182, 90212, 90233, 34820000, 113280000},
+    {90242, 90272, 90293, 34868523, 113610847},
+    {90299, 90329, 90350, 34720000, 113970000},
+    {90359, 90389, 90410, 34770000, 112980000},
+    {90417, 90447, 90468, 34780000, 113400000},
+    {90477, 90507, 90528, 34530000, 113380000},
+    {90534, 90564, 90585, 34400000, 113730000},
+    {90594, 90624, 90645, 34470000, 113030000},
+    {90654, 90674, 90695, 34800000, 114300000},
+    {90703, 90733, 90754, 34816571, 114348807},
+    {90763, 90799, 90820, 34801246, 114358941},
+    {90827, 90857, 50876, 34789387, 114342397},
+    {90878, 90911, 90935, 34777942, 114342261},
+    {90945, 90975, 90996, 34757837, 114435475},
+    {91004, 91031, 15859, 34550000, 114780000},
+    {91052, 91082, 91103, 34480000, 114470000},
+    {91110, 91140, 91161, 34420000, 114180000},
+    {91168, 91198, 91219, 34820000, 114820000},
+    {91226, 91246, 91267, 34620000, 112450000},
+    {91275, 91305, 91326, 34684651, 112462810},
+    {91335, 91365, 91386, 34660847, 112422106},
+    {91393, 91429, 91450, 34680948, 112494099},
+    {91457, 91487, 91508, 34658969, 112389431},
+    {91515, 91545, 91566, 34900000, 112580000},
+    {91571, 91601, 91622, 34620454, 112457951},
+    {91630, 91660, 91681, 34830000, 112430000},
+    {91689, 91719, 91740, 34720000, 112150000},
+    {91746, 91776, 91797, 33780000, 111620000},
+    {91807, 91834, 91855, 34150000, 112100000},
+    {91864, 91894, 91915, 34150000, 112470000},
+    {91922, 91952, 80941, 34520000, 112170000},
+    {91973, 92003, 92024, 34380000, 111650000},
+    {92032, 92062, 92083, 34420000, 112420000},
+    {92091, 92121, 92142, 34730000, 112780000},
+    {92149, 92172, 92199, 33770000, 113180000},
+    {92212, 92245, 1675, 33738828, 113287746},
+    {92269, 92302, 92326, 33736097, 113328851},
+    {92334, 92367, 92391, 33900000, 112880000},
+    {92399, 92432, 92456, 33727101, 113314565},
+    {92463, 92496, 92520, 33880000, 113070000},
+    {92528, 92558, 92582, 33620000, 113350000},
+    {92589, 92622, 76919, 33730000, 112900000},
+    {92646, 92676, 92700, 33970000, 113220000},
+    {92708, 92741, 92765, 33300000, 113520000},
+    {92772, 92805, 92829, 34170000, 112830000},
+    {92836, 92866, 92887, 36090334, 114351020},
+    {92895, 92915, 92929, 36100000, 114380000},
+    {92936, 92966, 92987, 36107119, 114349760},
+    {92995, 93025, 93046, 36109849, 114297434},
+    {93053, 93083, 93104, 36095494, 114317515},
+    {93111, 93141, 92929, 36100000, 114380000},
+    {93162, 93192, 93213, 35920000, 114350000},
+    {93221, 93248, 93269, 35580000, 114520000},
+    {93277, 93307, 93328, 35950000, 114900000},
+    {93337, 93367, 93388, 36070000, 113820000},
+    {93396, 93416, 93437, 35750000, 114280000},
+    {93442, 93472, 93493, 35954518, 114157235},
+    {93500, 93530, 93551, 35897693, 114178367},
+    {93561, 93591, 93612, 35741365, 114292764},
+    {93618, 93645, 93666, 35670000, 114550000},
+    {93674, 93701, 15859, 35600000, 114200000},
+    {93722, 93742, 93756, 35300000, 113900000},
+    {93765, 93795, 93816, 35304436, 113869298},
+    {93823, 93853, 93874, 35302692, 113859813},
+    {93881, 93911, 93932, 35384501, 113909273},
+    {93941, 93971, 93992, 35315626, 113902867},
+    {93997, 94027, 93756, 35300000, 113900000},
+    {94048, 94078, 94099, 35270000, 113650000},
+    {94106, 94136, 94157, 35050000, 113970000},
+    {94166, 94196, 94217, 35150000, 114200000},
+    {94224, 94254, 94275, 35050000, 114420000},
+    {94283, 94313, 94334, 35200000, 114680000},
+    {94344, 94374, 94395, 35400000, 114070000},
+    {94402, 94432, 94453, 35460000, 113770000},
+    {94461, 94481, 94502, 35220000, 113250000},
+    {94510, 94540, 94561, 35240763, 113224444},
+    {94569, 94599, 94620, 35237239, 113176501},
+    {94630, 94660, 94681, 35256496, 113315856},
+    {94687, 94717, 94738, 35215021, 113248516},
+    {94747, 94777, 94798, 35230000, 113430000},
+    {94804, 94834, 94855, 35170000, 113070000},
+    {94860, 94890, 94911, 35100000, 113380000},
+    {94917, 94944, 94965, 34930000, 113080000},
+    {94973, 95003, 95024, 35080000, 112930000},
+    {95032, 95062, 95083, 34900000, 112780000},
+    {95092, 95112, 95126, 35770000, 115030000},
+    {95133, 95163, 95184, 35777256, 115068142},
+    {95192, 95222, 95243, 35900000, 115120000},
+    {95252, 95282, 95303, 36080000, 115200000},
+    {95309, 95336, 95357, 35870000, 115500000},
+    {95365, 95395, 95416, 36000000, 115850000},
+    {95424, 95454, 95126, 35770000, 115030000},
+    {95475, 95495, 95516, 34030000, 113850000},
+    {95524, 95554, 95575, 34026848, 113816689},
+    {95582, 95612, 95633, 34126222, 113816943},
+    {95640, 95670, 95691, 34100000, 114200000},
+    {95699, 95729, 52982, 33850000, 113480000},
+    {95750, 95780, 95801, 34170000, 113470000},
+    {95808, 95838, 95859, 34220000, 113770000},
+    {95867, 95887, 95908, 33580000, 114020000},
+    {95914, 95944, 95965, 33566931, 114012021},
+    {95973, 96003, 54816, 33588923, 114001045},
+    {96024, 96054, 96075, 33587914, 114087875},
+    {96084, 96114, 96135, 33430000, 113600000},
+    {96142, 96172, 96193, 33820000, 113930000},
+    {96201, 96224, 96251, 34780000, 111200000},
+    {96261, 96294, 96318, 34771855, 111182390},
+    {96324, 96357, 89592, 34700000, 111080000},
+    {96381, 96414, 96438, 34770000, 111750000},
+    {96446, 96479, 96503, 34050000, 111050000},
+    {96509, 96542, 96566, 34750000, 111870000},
+    {96571, 96604, 96628, 34520000, 110870000},
+    {96636, 96656, 96677, 33000000, 112520000},
+    {96685, 96715, 96736, 33005803, 112533748},
+    {96745, 96775, 96796, 32991878, 112522948},
+    {96803, 96833, 96854, 33500000, 112430000},
+    {96862, 96892, 96913, 33270000, 113000000},
+    {96923, 96953, 96974, 33280000, 111480000},
+    {96980, 97010, 97031, 33030000, 112230000},
+    {97040, 97070, 97091, 33050000, 111850000},
+    {97100, 97130, 97151, 33130000, 111480000},
+    {97159, 97189, 97210, 33050000, 112930000},
+    {97216, 97246, 97267, 32700000, 112830000},
+    {97274, 97304, 97325, 32520000, 112350000},
+    {97331, 97361, 97382, 32370000, 113400000},
+    {97390, 97420, 97441, 32680000, 112080000},
+    {97450, 97470, 97491, 34450000, 115650000},
+    {97500, 97530, 97551, 34445299, 115608510},
+    {97561, 97591, 97612, 34389777, 115647801},
+    {97620, 97650, 97671, 34650000, 115130000},
+    {97679, 97706, 97727, 34450000, 115070000},
+    {97735, 97765, 97786, 34450000, 115320000},
+    {97795, 97825, 97846, 34070000, 115300000},
+    {97855, 97885, 88341, 34400000, 115850000},
+    {97906, 97936, 97957, 34230000, 116130000},
+    {97963, 97993, 98014, 33920000, 116430000},
+    {98024, 98044, 98065, 32130000, 114070000},
+    {98073, 98103, 98124, 32118775, 114052843},
+    {98130, 98160, 98181, 32102981, 114119817},
+    {98190, 98220, 98241, 32200000, 114530000},
+    {98249, 98279, 98300, 32020000, 114900000},
+    {98310, 98337, 98358, 31630000, 114870000},
+    {98366, 98396, 56989, 31800000, 115400000},
+    {98417, 98447, 98468, 32180000, 115680000},
+    {98474, 98504, 98525, 32130000, 115030000},
+    {98536, 98566, 98587, 32430000, 115400000},
+    {98595, 98622, 18431, 32350000, 114730000},
+    {98643, 98663, 98684, 33620000, 114650000},
+    {98692, 98722, 98743, 33649233, 114645250},
+    {98752, 98782, 98803, 34070000, 114380000},
+    {98809, 98839, 98860, 33800000, 114530000},
+    {98866, 98896, 98917, 33530000, 114600000},
+    {98927, 98957, 98978, 33400000, 115070000},
+    {98986, 99016, 99037, 33650000, 115200000},
+    {99046, 99076, 99097, 33730000, 114880000},
+    {99106, 99136, 99157, 34070000, 114850000},
+    {99165, 99195, 99216, 33870000, 115480000},
+    {99221, 99251, 52982, 33450000, 114900000},
+    {99272, 99295, 99322, 32980000, 114020000},
+    {99332, 99365, 17919, 32974977, 113988111},
+    {99389, 99422, 99446, 33380000, 114020000},
+    {99453, 99486, 99510, 33270000, 114270000},
+    {99519, 99552, 99576, 32970000, 114630000},
+    {99583, 99616, 99640, 32600000, 114380000},
+    {99650, 99683, 99707, 32800000, 114020000},
+    {99715, 99748, 99772, 32720000, 113320000},
+    {99779, 99812, 99836, 33000000, 114350000},
+    {99842, 99875, 99899, 33150000, 114000000},
+    {99907, 99940, 99964, 32750000, 114980000},
+    {99971, 99991, 100012, 35070000, 112580000},
+    {100019, 100039, 100060, 30600000, 114300000},
+    {100066, 100096, 100117, 30602464, 114303640},
+    {100125, 100155, 100176, 30603881, 114265456},
+    {100185, 100215, 100236, 30584647, 114209454},
+    {100244, 100274, 100295, 30556365, 114213268},
+    {100303, 100333, 41434, 30556639, 114310766},
+    {100354, 100384, 20646, 30641893, 114379987},
+    {100405, 100435, 21526, 30502687, 114338416},
+    {100456, 100489, 100513, 30620000, 114130000},
+    {100522, 100552, 100573, 30311211, 114078725},
+    {100580, 100610, 100631, 30580000, 114030000},
+    {100639, 100669, 100690, 30350000, 114320000},
+    {100699, 100729, 100750, 30870000, 114370000},
+    {100758, 100788, 16879, 30850000, 114800000},
+    {100809, 100829, 100850, 30200000, 115030000},
+    {100859, 100892, 100916, 30225370, 115060521},
+    {100929, 100962, 100986, 30200000, 115120000},
+    {100996, 101026, 101047, 30180000, 114970000},
+    {101053, 101083, 101104, 30200000, 114900000},
+    {101112, 101142, 89145, 29850000, 115200000},
+    {101163, 101193, 101214, 30100000, 114970000},
+    {101219, 101239, 101260, 32636442, 110781155},
+    {101267, 101297, 101318, 32600000, 110820000},
+    {101326, 101356, 101377, 32650000, 110780000},
+    {101386, 101416, 101437, 32830000, 110820000},
+    {101445, 101475, 101496, 33000000, 110420000},
+    {101502, 101532, 75642, 32230000, 110230000},
+    {101553, 101583, 101604, 32320000, 109720000},
+    {101610, 101637, 101658, 32070000, 110730000},
+    {101667, 101700, 101724, 32550000, 111520000},
+    {101736, 101756, 101777, 30700000, 111280000},
+    {101785, 101815, 101836, 30713213, 111279987},
+    {101843, 101876, 101900, 30646665, 111355183},
+    {101910, 101940, 101961, 30695704, 111262495},
+    {101969, 101999, 102020, 30533267, 111428724},
+    {102029, 102059, 102080, 30770000, 111320000},
+    {102087, 102117, 102138, 31070000, 111630000},
+    {102145, 102175, 43841, 31350000, 110750000},
+    {102196, 102226, 102247, 30830000, 110980000},
+    {102253, 102298, 102319, 30470000, 111180000},
+    {102329, 102374, 102395, 30200000, 110670000},
+    {102402, 102432, 102453, 30400000, 111450000},
+    {102458, 102488, 102509, 30820000, 111780000},
+    {102518, 102548, 102569, 30430000, 111770000},
+    {102578, 102598, 43520, 32080000, 112200000},
+    {102619, 102649, 52982, 32012322, 112127911},
+    {102670, 102700, 102721, 32046814, 112129621},
+    {102730, 102760, 102781, 32155036, 112183184},
+    {102791, 102821, 102842, 31780000, 111830000},
+    {102851, 102881, 11997, 32270000, 111650000},
+    {102902, 102932, 102953, 31880000, 111250000},
+    {102961, 102994, 103018, 32380000, 111670000},
+    {103027, 103057, 103078, 32130000, 112750000},
+    {103086, 103116, 17919, 31720000, 112250000},
+    {103137, 103157, 103178, 30400000, 114880000},
+    {103184, 103217, 103241, 30080000, 114670000},
+    {103251, 103281, 103302, 30536795, 114724634},
+    {103310, 103340, 103361, 30403265, 114886572},
+    {103368, 103388, 103409, 31030000, 112200000},
+    {103417, 103447, 103468, 31054061, 112195668},
+    {103476, 103506, 103527, 30980000, 112200000},
+    {103534, 103564, 103585, 30700000, 112580000},
+    {103593, 103623, 103644, 31170000, 112580000},
+    {103655, 103685, 103706, 31020000, 113100000},
+    {103715, 103735, 103756, 30930000, 113920000},
+    {103764, 103794, 103815, 30919361, 113905474},
+    {103823, 103853, 103874, 31250000, 113970000},
+    {103884, 103914, 103935, 31570000, 114120000},
+    {103940, 103970, 103991, 31020000, 113750000},
+    {103999, 104029, 104050, 30950000, 113570000},
+    {104060, 104090, 104111, 31270000, 113680000},
+    {104116, 104146, 104167, 30650000, 113830000},
+    {104176, 104196, 104210, 30330000, 112230000},
+    {104219, 104249, 104270, 30320000, 112240000},
+    {104277, 104307, 104210, 30330000, 112230000},
+    {104328, 104358, 104379, 30070000, 112230000},
+    {104386, 104416, 104437, 29820000, 112880000},
+    {104444, 104474, 104495, 30030000, 112420000},
+    {104505, 104535, 104556, 29730000, 112400000},
+    {104564, 104594, 104615, 29800000, 113450000},
+    {104622, 104652, 104673, 30180000, 111770000},
+    {104680, 104700, 104721, 30450000, 114870000},
+    {104731, 104761, 104782, 30436728, 114874345},
+    {104792, 104822, 104843, 30630000, 114870000},
+    {104852, 104882, 104903, 31280000, 114620000},
+    {104910, 104940, 104961, 30780000, 115400000},
+    {104969, 104999, 105020, 30750000, 115670000},
+    {105029, 105059, 105080, 30450000, 115270000},
+    {105087, 105117, 105138, 30230000, 115430000},
+    {105145, 105175, 105196, 30080000, 115930000},
+    {105205, 105235, 105256, 31180000, 115030000},
+    {105264, 105294, 105315, 29850000, 115550000},
+    {105321, 105341, 105362, 29850000, 114320000},
+    {105371, 105401, 105422, 29855399, 114293338},
+    {105429, 105459, 105480, 29980000, 113900000},
+    {105486, 105516, 66213, 29250000, 113820000},
+    {105537, 105567, 105588, 29550000, 114030000},
+    {105598, 105628, 52078, 29600000, 114520000},
+    {105649, 105679, 105700, 29720000, 113880000},
+    {105706, 105726, 105747, 31720000, 113370000},
+    {105755, 105785, 105806, 31718168, 113364914},
+    {105814, 105841, 97727, 31855866, 113293451},
+    {105862, 105892, 105913, 31620000, 113820000},
+    {105923, 105964, 105978, 30300000, 109470000},
+    {105984, 106035, 105978, 30300000, 109470000},
+    {106056, 106107, 80082, 30300000, 108930000},
+    {106128, 106179, 106200, 30600000, 109730000},
+    {106208, 106259, 106280, 31050000, 110330000},
+    {106287, 106338, 106359, 29980000, 109480000},
+    {106366, 106417, 106438, 29680000, 109150000},
+    {106447, 106498, 106519, 29520000, 109400000},
+    {106527, 106578, 106599, 29900000, 110030000},
+    {106606, 106626, 106647, 30370000, 113450000},
+    {106655, 106675, 106696, 30420000, 112880000},
+    {106706, 106726, 106747, 30670000, 113170000},
+    {106755, 106781, 106808, 31517304, 110332175},
+    {106820, 106840, 106861, 28230000, 112930000},
+    {106870, 106900, 106921, 28188643, 113026782},
+    {106928, 106958, 106979, 28115901, 112984257},
+    {106987, 107017, 107038, 28238761, 112925947},
+    {107044, 107074, 107095, 28260664, 112979951},
+    {107101, 107131, 1808, 28140950, 113032247},
+    {107152, 107182, 107203, 28370000, 112820000},
+    {107213, 107243, 107267, 28249322, 113074938},
+    {107280, 107310, 107331, 28150000, 113630000},
+    {107339, 107369, 107390, 28250000, 112550000},
+    {107400, 107420, 107441, 27830000, 113130000},
+    {107449, 107479, 107500, 27859142, 113167724},
+    {107507, 107537, 107558, 27788234, 113146928},
+    {107565, 107595, 107616, 27878576, 113111883},
+    {107624, 107654, 107675, 27829988, 113076377},
+    {107684, 107714, 107735, 27700979, 113138276},
+    {107741, 107768, 107789, 27000000, 113330000},
+    {107797, 107827, 107848, 26800000, 113530000},
+    {107856, 107886, 95691, 26480000, 113770000},
+    {107907, 107937, 107958, 27670000, 113480000},
+    {107965, 107985, 107999, 27830000, 112930000},
+    {108008, 108038, 108059, 27859742, 112901861},
+    {108064, 108094, 108115, 27875426, 112963973},
+    {108123, 108153, 107999, 27830000, 112930000},
+    {108174, 108204, 108225, 27730000, 112530000},
+    {108236, 108266, 108287, 27930000, 112520000},
+    {108296, 108316, 108337, 26900000, 112570000},
+    {108346, 108376, 108397, 26898247, 112614875},
+    {108404, 108434, 108455, 26892260, 112611313},
+    {108463, 108493, 108514, 26946804, 112592863},
+    {108520, 108550, 108571, 26914979, 112561821},
+    {108582, 108612, 108633, 27250000, 112730000},
+    {108640, 108670, 108694, 26970000, 112370000},
+    {108707, 108737, 108758, 26730000, 112670000},
+    {108766, 108796, 42952, 27230000, 112870000},
+    {108817, 108847, 108868, 27080000, 112950000},
+    {108877, 108907, 53686, 26780000, 112120000},
+    {108928, 108958, 108979, 26420000, 112850000},
+    {108987, 109017, 50045, 26420000, 112380000},
+    {109038, 109058, 109079, 27250000, 111470000},
+    {109088, 109118, 109139, 27236036, 111490857},
+    {109150, 109180, 109201, 27224640, 111433473},
+    {109209, 109239, 109260, 27249695, 111446598},
+    {109266, 109296, 109317, 27250000, 111750000},
+    {109326, 109356, 109377, 27320000, 111450000},
+    {109385, 109415, 109439, 27000000, 111270000},
+    {109452, 109482, 109503, 27120000, 111030000},
+    {109511, 109541, 109562, 27050000, 110570000},
+    {109570, 109600, 52242, 26580000, 110150000},
+    {109621, 109651, 109672, 26430000, 110850000},
+    {109680, 109722, 109743, 26370000, 110320000},
+    {109751, 109781, 92765, 26730000, 110630000},
+    {109802, 109822, 109836, 29370000, 113120000},
+    {109844, 109877, 109901, 29374451, 113123737},
+    {109912, 109942, 101496, 29475394, 113266493},
+    {109963, 109993, 110014, 29463753, 113000664},
+    {110022, 110052, 109836, 29370000, 113120000},
+    {110073, 110103, 103302, 29520000, 112570000},
+    {110124, 110154, 110175, 28680000, 112880000},
+    {110184, 110214, 110235, 28720000, 113580000},
+    {110245, 110275, 110296, 28800000, 113080000},
+    {110302, 110332, 110353, 29480000, 113470000},
+    {110362, 110382, 110403, 29050000, 111680000},
+    {110411, 110441, 110462, 29058196, 111677574},
+    {110469, 110499, 110520, 29021660, 111675212},
+    {110530, 110560, 110581, 29420000, 112170000},
+    {110589, 110619, 110640, 28900000, 111970000},
+    {110648, 110675, 7560, 29630000, 111750000},
+    {110696, 110726, 110747, 29450000, 111650000},
+    {110753, 110783, 110804, 28900000, 111480000},
+    {110812, 110842, 110863, 29580000, 111380000},
+    {110870, 110900, 110921, 29640000, 111870000},
+    {110928, 110951, 110978, 29130000, 110470000},
+    {110990, 111023, 73987, 29122885, 110532357},
+    {111047, 111083, 111110, 29350000, 110530000},
+    {111121, 111154, 111178, 29420000, 111120000},
+    {111183, 111216, 111240, 29400000, 110150000},
+    {111248, 111268, 80941, 28600000, 112320000},
+    {111289, 111319, 111340, 28594155, 112318671},
+    {111347, 111377, 111401, 28600000, 112370000},
+    {111410, 111437, 111458, 29380000, 112400000},
+    {111466, 111496, 111517, 28530000, 112120000},
+    {111526, 111556, 111577, 28380000, 111220000},
+    {111583, 111613, 111634, 28850000, 112380000},
+    {111644, 111664, 111685, 25780000, 113020000},
+    {111694, 111724, 111745, 25787031, 113005539},
+    {111751, 111781, 111802, 25800000, 113030000},
+    {111809, 111839, 111860, 25730000, 112730000},
+    {111868, 111898, 111919, 25400000, 112950000},
+    {111927, 111957, 111978, 26130000, 113100000},
+    {111987, 112017, 112038, 25580000, 112370000},
+    {112044, 112074, 112095, 25280000, 112550000},
+    {112101, 112131, 112152, 25550000, 113680000},
+    {112160, 112190, 112211, 26080000, 113930000},
+    {112219, 112249, 112270, 26700000, 113270000},
+    {112276, 112306, 112327, 25980000, 113230000},
+    {112334, 112354, 112375, 26430000, 111620000},
+    {112384, 112414, 112435, 26225411, 111625855},
+    {112444, 112477, 112501, 26430000, 111600000},
+    {112513, 112543, 112564, 26580000, 111850000},
+    {112571, 112601, 47692, 26400000, 111280000},
+    {112622, 112652, 112673, 25970000, 111650000},
+    {112683, 112710, 112731, 25530000, 111580000},
+    {112739, 112769, 112790, 25280000, 111330000},
+    {112800, 112830, 112851, 25600000, 111930000},
+    {112860, 112890, 86832, 25370000, 112180000},
+    {112911, 112941, 112962, 25920000, 112220000},
+    {112970, 113012, 113033, 25180000, 111580000},
+    {113042, 113062, 113083, 27570000, 110000000},
+    {113091, 113121, 113142, 27582125, 110035503},
+    {113150, 113180, 113201, 27400000, 109930000},
+    {113211, 113241, 113262, 28470000, 110380000},
+    {113271, 113301, 113322, 28000000, 110180000},
+    {113329, 113359, 113380, 27920000, 110580000},
+    {113385, 113415, 113436, 26870000, 109720000},
+    {113444, 113486, 113507, 27870000, 109800000},
+    {113514, 113556, 113577, 27370000, 109170000},
+    {113586, 113628, 102569, 27450000, 109680000},
+    {113649, 113697, 104210, 26580000, 109680000},
+    {113718, 113760, 113781, 26170000, 109780000},
+    {113789, 113819, 113840, 27200000, 109820000},
+    {113850, 113870, 113891, 27730000, 112000000},
+    {113897, 113927, 113948, 27733218, 111996392},
+    {113956, 113986, 114007, 27450000, 112200000},
+    {114018, 114048, 1675, 27750000, 111300000},
+    {114069, 114102, 114126, 27680000, 111430000},
+    {114140, 114170, 114191, 27700000, 111670000},
+    {114200, 114241, 114262, 28315337, 109734439},
+    {114270, 114321, 114342, 28320000, 109730000},
+    {114349, 114400, 76108, 28220000, 110220000},
+    {114421, 114472, 114493, 27950000, 109600000},
+    {114503, 114554, 114575, 28580000, 109480000},
+    {114583, 114634, 114655, 28720000, 109650000},
+    {114663, 114714, 114735, 28620000, 109950000},
+    {114743, 114794, 114815, 29000000, 109850000},
+    {114824, 114875, 37669, 29470000, 109430000},
+    {114896, 114916, 114937, 23130000, 113270000},
+    {114947, 114977, 114998, 23128662, 113238937},
+    {115004, 115034, 115055, 23131199, 113261510},
+    {115062, 115092, 115113, 23086426, 113311983},
+    {115120, 115150, 115171, 23127209, 113355708},
+    {115178, 115208, 115229, 23159949, 113267950},
+    {115236, 115266, 49957, 23108977, 113454312},
+    {115287, 115317, 115338, 22950000, 113350000},
+    {115344, 115374, 115395, 23400000, 113220000},
+    {115401, 115431, 115452, 22804514, 113519973},
+    {115459, 115489, 115510, 23550000, 113580000},
+    {115518, 115548, 115569, 23300000, 113830000},
+    {115579, 115599, 115620, 24820000, 113600000},
+    {115629, 115659, 53100, 24800000, 113570000},
+    {115680, 115710, 55781, 24800000, 113600000},
+    {115731, 115761, 60926, 24680000, 113600000},
+    {115782, 115812, 115833, 24950000, 114070000},
+    {115841, 115871, 115892, 25080000, 113750000},
+    {115899, 115929, 115950, 24350000, 114130000},
+    {115959, 116001, 116022, 24780000, 113270000},
+    {116029, 116059, 77589, 24070000, 114200000},
+    {116080, 116110, 116131, 25130000, 113350000},
+    {116139, 116169, 116190, 25120000, 114300000},
+    {116199, 116219, 116240, 22550000, 114050000},
+    {116249, 116279, 116300, 22550875, 114126689},
+    {116306, 116336, 116357, 22524254, 114049927},
+    {116364, 116394, 43653, 22536049, 113925612},
+    {116415, 116445, 116466, 22757663, 113823646},
+    {116472, 116502, 35698, 22723802, 114242063},
+    {116523, 116553, 116574, 22559360, 114232040},
+    {116582, 116612, 9563, 22699499, 114039395},
+    {116633, 116663, 2555, 22711340, 114346006},
+    {116684, 116714, 116735, 22751918, 113930998},
+    {116745, 116765, 116786, 22270000, 113570000},
+    {116793, 116823, 102781, 22268771, 113538677},
+    {116844, 116874, 116895, 22220000, 113280000},
+    {116902, 116932, 116953, 22070000, 113400000},
+    {116960, 116980, 117001, 23350000, 116680000},
+    {117009, 117039, 117060, 23374074, 116711994},
+    {117067, 117097, 117118, 23368231, 116698910},
+    {117126, 117156, 117177, 23288688, 116722423},
+    {117186, 117216, 152, 23270000, 116600000},
+    {117237, 117267, 117288, 23252873, 116428335},
+    {117296, 117326, 117347, 23480000, 116770000},
+    {117356, 117386, 117407, 23420000, 117020000},
+    {117413, 117433, 117454, 23020000, 113120000},
+    {117461, 117491, 117512, 23012064, 113116959},
+    {117522, 117552, 117573, 23030000, 113150000},
+    {117580, 117610, 117631, 22800000, 113300000},
+    {117638, 117668, 117689, 23170000, 112870000},
+    {117697, 117727, 117748, 22900000, 112880000},
+    {117756, 117776, 117797, 22580000, 113080000},
+    {117806, 117836, 117857, 22677301, 113046009},
+    {117867, 117897, 117918, 22543698, 113129242},
+    {117927, 117957, 117978, 22470000, 113030000},
+    {117985, 118015, 86103, 22250000, 112780000},
+    {118036, 118066, 3154, 22380000, 112670000},
+    {118087, 118117, 93493, 22770000, 112970000},
+    {118138, 118168, 118189, 22180000, 112300000},
+    {118196, 118216, 118237, 21270000, 110350000},
+    {118247, 118277, 118298, 21270000, 110370000},
+    {118305, 118335, 118356, 21200000, 110400000},
+    {118364, 118394, 118415, 21230000, 110470000},
+    {118421, 118451, 118472, 21270000, 110320000},
+    {118480, 118510, 65319, 21380000, 110250000},
+    {118531, 118561, 118582, 20330000, 110170000},
+    {118588, 118618, 69992, 21620000, 110270000},
+    {118639, 118669, 118690, 20920000, 110080000},
+    {118698, 118728, 20366, 21430000, 110770000},
+    {118749, 118769, 118790, 21670000, 110920000},
+    {118798, 118828, 118849, 21644112, 110913528},
+    {118856, 118886, 118907, 21500000, 111000000},
+    {118915, 118945, 118966, 21920000, 110850000},
+    {118974, 119004, 119025, 21670000, 110630000},
+    {119033, 119063, 52301, 22350000, 110950000},
+    {119084, 119104, 119125, 23050000, 112470000},
+    {119134, 119164, 119185, 23054774, 112479651},
+    {119194, 119224, 119245, 23161286, 112562604},
+    {119252, 119282, 119303, 23030000, 112450000},
+    {119310, 119340, 119361, 23630000, 112430000},
+    {119371, 119401, 119422, 23920000, 112180000},
+    {119429, 119459, 119480, 23430000, 111500000},
+    {119488, 119518, 59686, 23150000, 111770000},
+    {119539, 119569, 119590, 23330000, 112680000},
+    {119596, 119616, 66448, 23120000, 114420000},
+    {119637, 119667, 119688, 23086635, 114377564},
+    {119697, 119727, 119748, 22800000, 114470000},
+    {119756, 119786, 119807, 23180000, 114280000},
+    {119813, 119843, 119864, 22980000, 114720000},
+    {119872, 119902, 119923, 23730000, 114250000},
+    {119931, 119951, 119972, 24280000, 116120000},
+    {119980, 120010, 120031, 24313013, 116111781},
+    {120040, 120070, 120091, 24280000, 116050000},
+    {120099, 120129, 120150, 24350000, 116700000},
+    {120155, 120185, 120206, 23770000, 116180000},
+    {120215, 120245, 120266, 23930000, 115770000},
+    {120272, 120302, 88114, 24570000, 115880000},
+    {120323, 120353, 120374, 24670000, 116170000},
+    {120383, 120413, 120434, 24150000, 115730000},
+    {120443, 120463, 120477, 22780000, 115370000},
+    {120485, 120515, 120536, 22970000, 115330000},
+    {120544, 120574, 51174, 23300000, 115650000},
+    {120595, 120625, 120646, 22950000, 115650000},
+    {120653, 120673, 120694, 23730000, 114700000},
+    {120701, 120731, 120752, 23736613, 114697814},
+    {120762, 120792, 120813, 23630000, 115180000},
+    {120819, 120849, 120870, 24100000, 115250000},
+    {120880, 120910, 120931, 24370000, 114480000},
+    {120940, 120970, 790, 24450000, 114930000},
+    {120991, 121021, 121042, 23820000, 114770000},
+    {121051, 121071, 121092, 21870000, 111980000},
+    {121102, 121132, 121153, 21864591, 111950055},
+    {121164, 121194, 121215, 21880000, 112020000},
+    {121224, 121254, 121275, 21750000, 111620000},
+    {121282, 121312, 121333, 22180000, 111780000},
+    {121342, 121362, 6804, 23700000, 113030000},
+    {121383, 121413, 121434, 23700351, 113057195},
+    {121444, 121474, 121495, 23730000, 112980000},
+    {121503, 121533, 121554, 23880000, 113530000},
+    {121561, 121591, 121612, 24480000, 112630000},
+    {121621, 121669, 35632, 24570000, 112080000},
+    {121690, 121732, 121753, 24720000, 112280000},
+    {121761, 121791, 121812, 24180000, 113400000},
+    {121819, 121849, 121870, 24780000, 112380000},
+    {121879, 121899, 121920, 23050000, 113750000},
+    {121929, 121949, 30164, 22520000, 113380000},
+    {121970, 121993, 122014, 20620476, 116883342},
+    {122022, 122042, 122063, 23670000, 116620000},
+    {122072, 122102, 122123, 23677278, 116624257},
+    {122133, 122163, 122184, 23450000, 116680000},
+    {122191, 122221, 122242, 23670000, 117000000},
+    {122250, 122270, 122291, 23550000, 116370000},
+    {122299, 122329, 7215, 23527557, 116362325},
+    {122350, 122380, 122401, 23570000, 116420000},
+    {122409, 122439, 122460, 23430000, 115830000},
+    {122466, 122496, 122517, 23030000, 116280000},
+    {122524, 122554, 122575, 23300000, 116180000},
+    {122582, 122602, 122623, 22920000, 112030000},
+    {122629, 122659, 16083, 22930769, 112038537},
+    {122680, 122710, 122731, 23080000, 112000000},
+    {122737, 122767, 47338, 22700000, 112230000},
+    {122788, 122818, 122731, 23230000, 111530000},
+    {122839, 122869, 122890, 22770000, 111570000},
+    {122898, 122930, 122951, 22820000, 108370000},
+    {122959, 123001, 120434, 22856690, 108364794},
+    {123022, 123064, 123085, 22819333, 108342075},
+    {123093, 123135, 123156, 22784481, 108269239},
+    {123165, 123210, 123234, 22835556, 108302921},
+    {123246, 123288, 123309, 22761873, 108318113},
+    {123319, 123361, 123382, 22750000, 108480000},
+    {123391, 123433, 123454, 23170000, 108270000},
+    {123461, 123503, 93104, 23180000, 107680000},
+    {123524, 123566, 43211, 23720000, 108170000},
+    {123587, 123629, 123650, 23430000, 108600000},
+    {123659, 123701, 123722, 23220000, 108800000},
+    {123730, 123769, 123790, 22680000, 109270000},
+    {123799, 123831, 123852, 24330000, 109420000},
+    {123860, 123902, 123923, 24318286, 109406128},
+    {123934, 123976, 123997, 24321256, 109447878},
+    {124004, 124046, 124067, 24338923, 109380925},
+    {124074, 124116, 124137, 24365387, 109397441},
+    {124144, 124186, 124207, 24270000, 109330000},
+    {124216, 124258, 124279, 24650000, 109230000},
+    {124288, 124330, 124351, 24480000, 109730000},
+    {124358, 124400, 124421, 25230000, 109400000},
+    {124428, 124482, 124503, 25070000, 109250000},
+    {124512, 124566, 124587, 25780000, 109600000},
+    {124596, 124628, 124649, 25280000, 110280000},
+    {124656, 124698, 124719, 25276486, 110259630},
+    {124727, 124769, 124790, 25316821, 110297114},
+    {124797, 124839, 58141, 25264533, 110276512},
+    {124860, 124902, 124923, 25255489, 110313186},
+    {124930, 124972, 10300, 25104781, 110282121},
+    {124993, 125035, 125056, 25230000, 110200000},
+    {125063, 125105, 125126, 24780000, 110480000},
+    {125135, 125177, 14828, 25420000, 110320000},
+    {125198, 125240, 71809, 25930000, 111070000},
+    {125261, 125303, 27194, 25620000, 110670000},
+    {125324, 125366, 125387, 24980000, 109980000},
+    {125394, 125436, 125457, 25480000, 111150000},
+    {125466, 125520, 125541, 25800000, 110000000},
+    {125551, 125593, 125614, 26030000, 110630000},
+    {125621, 125663, 125684, 24630000, 110630000},
+    {125691, 125745, 125766, 24830000, 110830000},
+    {125776, 125818, 125839, 24510000, 110380000},
+    {125844, 125876, 125897, 23480000, 111270000},
+    {125904, 125946, 125967, 23475489, 111315337},
+    {125974, 126016, 52406, 23488290, 111269676},
+    {126037, 126079, 126100, 23407707, 111241276},
+    {126108, 126150, 126171, 23420000, 111230000},
+    {126178, 126217, 126238, 23380000, 110920000},
+    {126247, 126289, 126310, 24200000, 110520000},
+    {126319, 126361, 126382, 22920000, 110980000},
+    {126388, 126420, 126441, 21480000, 109120000},
+    {126448, 126490, 31186, 21477389, 109112916},
+    {126511, 126553, 126574, 21451625, 109135713},
+    {126581, 126626, 126650, 21531523, 109417136},
+    {126662, 126704, 126725, 21670000, 109200000},
+    {126730, 126765, 126792, 21700000, 108350000},
+    {126806, 126851, 126875, 21645821, 108376117},
+    {126883, 126928, 96913, 21770000, 108350000},
+    {126952, 126997, 127021, 22150000, 107980000},
+    {127029, 127074, 127098, 21530000, 107970000},
+    {127107, 127139, 127160, 21950000, 108620000},
+    {127168, 127210, 127231, 21941720, 108653448},
+    {127238, 127280, 127301, 22135452, 108445100},
+    {127308, 127350, 127371, 22430000, 109300000},
+    {127380, 127422, 127443, 22270000, 109550000},
+    {127449, 127481, 127502, 23100000, 109600000},
+    {127510, 127552, 127573, 23114418, 109568038},
+    {127581, 127623, 127644, 23078489, 109595368},
+    {127652, 127694, 127715, 23129731, 109448168},
+    {127723, 127765, 74563, 23550000, 110380000},
+    {127786, 127828, 127849, 23400000, 110080000},
+    {127857, 127889, 127910, 22630000, 110170000},
+    {127916, 127958, 95801, 22630854, 110146623},
+    {127979, 128021, 128042, 22588082, 110055030},
+    {128049, 128088, 128109, 22870000, 110550000},
+    {128118, 128160, 128181, 22330000, 110270000},
+    {128189, 128231, 128252, 22280000, 109970000},
+    {128258, 128300, 128321, 22750000, 109870000},
+    {128328, 128370, 128391, 22720000, 110350000},
+    {128398, 128430, 128451, 23900000, 106620000},
+    {128457, 128499, 128520, 23904286, 106615234},
+    {128529, 128571, 128592, 23730000, 106920000},
+    {128601, 128643, 128664, 23600000, 107120000},
+    {128673, 128715, 128736, 23320000, 107580000},
+    {128744, 128786, 128807, 23330000, 106620000},
+    {128813, 128855, 128876, 23420000, 105830000},
+    {128881, 128923, 128944, 24350000, 106570000},
+    {128952, 128994, 129015, 24780000, 106550000},
+    {129020, 129062, 129083, 24300000, 106230000},
+    {129091, 129133, 45577, 24500000, 105100000},
+    {129154, 129208, 129229, 24770000, 105330000},
+    {129237, 129279, 129300, 23130000, 106420000},
+    {129307, 129339, 129360, 24420000, 111550000},
+    {129367, 129409, 129430, 24414819, 111546959},
+    {129435, 129477, 129498, 24455794, 111474379},
+    {129506, 129548, 129569, 24170000, 110800000},
+    {129578, 129620, 30164, 24530000, 111300000},
+    {129641, 129695, 129716, 24830000, 111270000},
+    {129724, 129756, 129777, 24700000, 108070000},
+    {129783, 129828, 129852, 24692532, 108033093},
+    {129866, 129908, 129929, 24500000, 108670000},
+    {129936, 129978, 129999, 24980000, 107530000},
+    {130006, 130048, 130069, 25000000, 107170000},
+    {130075, 130117, 130138, 24550000, 107050000},
+    {130147, 130189, 130210, 24520000, 107370000},
+    {130218, 130275, 130296, 24780000, 108900000},
+    {130305, 130362, 130383, 24830000, 108250000},
+    {130393, 130447, 130468, 24150000, 107250000},
+    {130473, 130527, 130548, 23930000, 108100000},
+    {130553, 130607, 130628, 23730000, 107980000},
+    {130634, 130666, 130687, 23730000, 109230000},
+    {130694, 130736, 130757, 23735568, 109226244},
+    {130765, 130807, 19679, 24070000, 108670000},
+    {130828, 130870, 102781, 23970000, 109680000},
+    {130891, 130933, 130954, 23600000, 109670000},
+    {130961, 131015, 131036, 24130000, 110180000},
+    {131043, 131085, 93493, 23820000, 108870000},
+    {131106, 131138, 131159, 22400000, 107370000},
+    {131168, 131210, 131231, 22408096, 107349303},
+    {131241, 131283, 131304, 22630000, 107900000},
+    {131310, 131352, 131373, 22130000, 107070000},
+    {131382, 131424, 131445, 22350000, 106850000},
+    {131454, 131496, 131517, 22830000, 107200000},
+    {131523, 131565, 131586, 23080000, 107130000},
+    {131595, 131637, 6237, 22120000, 106750000},
+    {131658, 131678, 131699, 20030000, 110320000},
+    {131706, 131736, 131757, 20010063, 110289269},
+    {131765, 131795, 9563, 20033058, 110324127},
+    {131816, 131846, 131867, 20005152, 110349554},
+    {131877, 131907, 131928, 20031068, 110361915},
+    {131935, 131955, 131976, 18250000, 109500000},
+    {131982, 132012, 132033, 18386043, 109731662},
+    {132041, 132071, 81731, 18283786, 109574407},
+    {132092, 132122, 132143, 18299585, 109448078},
+    {132150, 132180, 132201, 18359139, 109167778},
+    {132208, 132228, 132249, 16834380, 112328667},
+    {132256, 132289, 132310, 16833333, 112333333},
+    {132316, 132349, 115452, 8589035, 113124657},
+    {132370, 132424, 132445, 15699600, 114322167},
+    {132455, 132475, 132496, 19520000, 109570000},
+    {132504, 132527, 132445, 18780000, 109520000},
+    {132554, 132574, 132595, 19250000, 110470000},
+    {132604, 132624, 132645, 19550000, 110800000},
+    {132654, 132674, 132695, 18800000, 110400000},
+    {132703, 132723, 132744, 19100000, 108630000},
+    {132753, 132773, 132794, 19700000, 110320000},
+    {132801, 132821, 132842, 19370000, 110100000},
+    {132851, 132871, 132892, 19730000, 110000000},
+    {132901, 132921, 132942, 19920000, 109680000},
+    {132949, 132981, 133002, 19230000, 109450000},
+    {133009, 133041, 75574, 19250000, 109050000},
+    {133062, 133094, 133115, 18750000, 109170000},
+    {133122, 133154, 133175, 18500000, 110030000},
+    {133184, 133222, 133243, 18630000, 109700000},
+    {133251, 133289, 133310, 19030000, 109830000},
+    {133321, 133341, 133355, 30820000, 108400000},
+    {133363, 133383, 133397, 29720000, 107400000},
+    {133404, 133424, 133438, 29555631, 106565198},
+    {133446, 133469, 133486, 29487218, 106478450},
+    {133494, 133514, 57854, 29609572, 106570579},
+    {133528, 133551, 133568, 29543746, 106452912},
+    {133578, 133601, 133618, 29505039, 106506862},
+    {133628, 133648, 72504, 29503175, 106640668},
+    {133662, 133682, 133696, 29800000, 106400000},
+    {133703, 133723, 133737, 29030000, 106650000},
+    {133745, 133765, 133779, 29700000, 105720000},
+    {133784, 133804, 133818, 29720000, 106630000},
+    {133824, 133844, 133858, 29380000, 106520000},
+    {133864, 133884, 106696, 29530000, 108770000},
+    {133898, 133918, 133932, 29870000, 107080000},
+    {133942, 133962, 133976, 28987980, 106216458},
+    {133985, 134005, 134019, 29972084, 106276130},
+    {134027, 134047, 134061, 29750000, 105710000},
+    {134071, 134091, 134105, 29150000, 107130000},
+    {134114, 134134, 134148, 29600000, 106220000},
+    {134155, 134175, 134189, 29850000, 106050000},
+    {134199, 134219, 134233, 30180000, 105830000},
+    {134241, 134261, 134275, 29400000, 105580000},
+    {134285, 134305, 134319, 31180000, 108420000},
+    {134327, 134347, 134361, 30680000, 107800000},
+    {134371, 134391, 134405, 29330000, 107750000},
+    {134412, 134422, 134436, 29570000, 106550000},
+    {134446, 134466, 134480, 31950000, 108670000},
+    {134489, 134509, 134523, 29870000, 107730000},
+    {134530, 134550, 134564, 30330000, 107350000},
+    {134574, 134591, 134605, 30300000, 108020000},
+    {134615, 134635, 134649, 30950000, 108670000},
+    {134657, 134677, 134691, 31020000, 109470000},
+    {134699, 134719, 134733, 31080000, 109880000},
+    {134740, 134760, 51337, 31400000, 109630000},
+    {134774, 134809, 134823, 30000000, 108120000},
+    {134830, 134871, 134885, 28450000, 108980000},
+    {134893, 134934, 134948, 28850000, 108770000},
+    {134956, 134997, 135011, 29300000, 108170000},
+    {135020, 135040, 135061, 30670000, 104070000},
+    {135069, 135099, 72444, 30660094, 104078459},
+    {135120, 135150, 69044, 30676825, 104059997},
+    {135171, 135201, 135222, 30693789, 104049757},
+    {135229, 135259, 135280, 30644452, 104040937},
+    {135286, 135316, 135337, 30662519, 104098713},
+    {135346, 135379, 135403, 30570000, 104270000},
+    {135414, 135447, 135474, 30880000, 104230000},
+    {135485, 135515, 135536, 30830000, 104150000},
+    {135542, 135572, 135593, 30700000, 103830000},
+    {135602, 135632, 135653, 30580000, 103920000},
+    {135663, 135693, 135714, 30820000, 103880000},
+    {135721, 135751, 135772, 30850000, 104430000},
+    {135780, 135810, 135831, 30580000, 103520000},
+    {135836, 135866, 60483, 30200000, 103500000},
+    {135887, 135917, 135938, 30420000, 103820000},
+    {135945, 135978, 136002, 31000000, 103620000},
+    {136013, 136043, 136064, 30980000, 103930000},
+    {136073, 136103, 136124, 30420000, 103470000},
+    {136133, 136163, 136184, 30630000, 103670000},
+    {136194, 136224, 73342, 30400000, 104550000},
+    {136245, 136265, 136286, 29350000, 104780000},
+    {136293, 136326, 136350, 29340289, 104774495},
+    {136360, 136390, 136411, 29348409, 104712496},
+    {136420, 136450, 39452, 29366474, 104771271},
+    {136471, 136501, 136522, 29275637, 104871447},
+    {136529, 136556, 128109, 29470000, 104420000},
+    {136577, 136607, 31229, 29180000, 104980000},
+    {136628, 136651, 136678, 26580000, 101720000},
+    {136688, 136718, 136742, 26549961, 101702561},
+    {136749, 136779, 136803, 26601278, 101629200},
+    {136808, 136841, 136865, 26500000, 101730000},
+    {136871, 136904, 136928, 26880000, 102120000},
+    {136933, 136966, 39513, 26700000, 101850000},
+    {136990, 137010, 13910, 28870000, 105430000},
+    {137031, 137061, 137082, 28881839, 105431410},
+    {137092, 137122, 137143, 28770000, 105370000},
+    {137148, 137181, 137205, 28916219, 105434166},
+    {137215, 137242, 137263, 29150000, 105380000},
+    {137270, 137300, 137321, 28820000, 105830000},
+    {137329, 137359, 137380, 28170000, 105430000},
+    {137387, 137417, 137438, 28050000, 105820000},
+    {137444, 137464, 137485, 31130000, 104380000},
+    {137492, 137522, 137543, 31144635, 104414254},
+    {137552, 137582, 71978, 31320000, 104500000},
+    {137603, 137633, 137654, 31030000, 104680000},
+    {137665, 137695, 137716, 30980000, 104280000},
+    {137725, 137755, 137776, 31130000, 104170000},
+    {137784, 137814, 137835, 31350000, 104200000},
+    {137843, 137863, 137884, 31470000, 104730000},
+    {137893, 137923, 12113, 31457299, 104754153},
+    {137944, 137974, 107789, 31475977, 104763595},
+    {137995, 138025, 138046, 31530000, 104570000},
+    {138053, 138083, 138104, 31100000, 105080000},
+    {138111, 138141, 138162, 31220000, 105380000},
+    {138170, 138200, 138221, 31630000, 105170000},
+    {138228, 138270, 138291, 31820000, 104450000},
+    {138300, 138330, 138351, 32420000, 104530000},
+    {138358, 138388, 138409, 31780000, 104750000},
+    {138418, 138438, 138459, 32430000, 105830000},
+    {138469, 138499, 138520, 32436301, 105841516},
+    {138527, 138557, 138578, 32325169, 105960368},
+    {138586, 138616, 138637, 32646388, 105886783},
+    {138646, 138676, 138697, 32230000, 106280000},
+    {138706, 138736, 138757, 32580000, 105230000},
+    {138767, 138797, 138818, 32280000, 105520000},
+    {138825, 138855, 138876, 31730000, 105930000},
+    {138883, 138903, 52242, 30520000, 105570000},
+    {138924, 138954, 138975, 30528253, 105564881},
+    {138985, 139015, 139036, 30357912, 105452687},
+    {139041, 139071, 139092, 30780000, 105720000},
+    {139099, 139129, 139150, 30870000, 105380000},
+    {139158, 139188, 139209, 30596928, 105233583},
+    {139216, 139236, 139257, 29580000, 105050000},
+    {139266, 139296, 81380, 29589613, 105064342},
+    {139317, 139347, 127098, 29600000, 105070000},
+    {139368, 139398, 139419, 29530000, 104670000},
+    {139427, 139457, 139478, 29780000, 104850000},
+    {139486, 139516, 139537, 29640000, 105250000},
+    {139547, 139567, 139588, 29570000, 103770000},
+    {139595, 139625, 81380, 29558128, 103759120},
+    {139646, 139676, 139697, 29416042, 103548004},
+    {139704, 139737, 139761, 29409824, 103815876},
+    {139772, 139805, 139829, 29247096, 103076576},
+    {139838, 139868, 139889, 29220000, 103950000},
+    {139897, 139927, 139948, 29650000, 104070000},
+    {139956, 139986, 140007, 29730000, 103570000},
+    {140016, 140046, 140067, 28970000, 103900000},
+    {140075, 140117, 140138, 29230000, 103270000},
+    {140144, 140186, 140207, 28830000, 103550000},
+    {140214, 140247, 140271, 29600000, 103480000},
+    {140280, 140300, 140321, 30780000, 106080000},
+    {140330, 140360, 140381, 30798788, 106088383},
+    {140390, 140420, 14947, 30783941, 106114797},
+    {140441, 140471, 140492, 30761085, 106067800},
+    {140500, 140530, 140551, 31350000, 106070000},
+    {140557, 140587, 105020, 31080000, 106570000},
+    {140608, 140638, 140659, 31030000, 106420000},
+    {140666, 140696, 140717, 31270000, 106280000},
+    {140724, 140754, 140775, 31000000, 105880000},
+    {140783, 140813, 140834, 31550000, 106000000},
+    {140844, 140864, 140885, 30050000, 103830000},
+    {140893, 140923, 140944, 30045136, 103829620},
+    {140951, 140981, 141002, 30200000, 103870000},
+    {141011, 141041, 141062, 30000000, 104150000},
+    {141070, 141100, 141121, 29920000, 103370000},
+    {141128, 141158, 141179, 30020000, 103520000},
+    {141187, 141217, 141238, 29830000, 103850000},
+    {141247, 141267, 141288, 28770000, 104620000},
+    {141294, 141324, 141345, 28769139, 104617680},
+    {141353, 141383, 141404, 28850000, 104980000},
+    {141410, 141440, 141461, 28700000, 104550000},
+    {141471, 141501, 100117, 28730000, 105070000},
+    {141522, 141552, 50045, 28580000, 104920000},
+    {141573, 141600, 141621, 28430000, 104520000},
+    {141629, 141656, 141677, 28450000, 104720000},
+    {141686, 141716, 141737, 28170000, 104520000},
+    {141745, 141775, 141796, 28300000, 105230000},
+    {141804, 141834, 2555, 28830000, 104330000},
+    {141855, 141875, 141889, 30470000, 106630000},
+    {141897, 141927, 141889, 30470000, 106630000},
+    {141948, 141978, 141999, 30499085, 106889327},
+    {142008, 142038, 142059, 30550000, 106430000},
+    {142066, 142096, 142117, 30350000, 106280000},
+    {142125, 142155, 142176, 30330000, 106930000},
+    {142184, 142214, 142235, 30380000, 106770000},
+    {142243, 142263, 142284, 31220000, 107500000},
+    {142291, 142321, 142342, 31220000, 107480000},
+    {142352, 142382, 142403, 31200000, 107500000},
+    {142410, 142440, 142461, 31350000, 107720000},
+    {142469, 142499, 142520, 31080000, 107870000},
+    {142529, 142559, 142580, 30730000, 107200000},
+    {142586, 142613, 142634, 30830000, 106970000},
+    {142641, 142671, 142692, 32070000, 108030000},
+    {142700, 142720, 142741, 29980000, 103000000},
+    {142746, 142776, 88341, 30008052, 103031137},
+    {142797, 142827, 31856, 30080000, 103120000},
+    {142848, 142878, 142899, 29800000, 102850000},
+    {142908, 142938, 142959, 29350000, 102650000},
+    {142967, 142997, 143018, 29230000, 102370000},
+    {143026, 143056, 143077, 30070000, 102750000},
+    {143086, 143116, 76919, 30150000, 102920000},
+    {143137, 143167, 143188, 30370000, 102820000},
+    {143196, 143216, 143237, 31850000, 106770000},
+    {143245, 143275, 11422, 31853662, 106764727},
+    {143296, 143326, 143347, 31818471, 106482483},
+    {143354, 143384, 47062, 31920000, 107230000},
+    {143405, 143435, 143456, 32350000, 106830000},
+    {143465, 143495, 143516, 31570000, 107100000},
+    {143526, 143546, 111340, 30120000, 104650000},
+    {143567, 143597, 143618, 30110974, 104674550},
+    {143627, 143657, 143678, 30100000, 105330000},
+    {143684, 143714, 143735, 30280000, 105020000},
+    {143741, 143779, 143793, 32900000, 101700000},
+    {143797, 143848, 143872, 31900000, 102220000},
+    {143881, 143929, 143950, 31480000, 103580000},
+    {143959, 144004, 7560, 31430000, 103170000},
+    {144025, 144070, 144091, 31680000, 103850000},
+    {144099, 144147, 144168, 32630000, 103600000},
+    {144176, 144227, 144251, 33270000, 104230000},
+    {144262, 144310, 144331, 31480000, 102070000},
+    {144340, 144388, 144409, 31000000, 102370000},
+    {144417, 144465, 144486, 32070000, 102980000},
+    {144494, 144542, 144563, 32270000, 100980000},
+    {144572, 144620, 143793, 32900000, 101700000},
+    {144641, 144692, 144716, 33580000, 102950000},
+    {144725, 144773, 144794, 32800000, 102550000},
+    {144803, 144835, 144849, 31620000, 99980000},
+    {144855, 144897, 144918, 30050000, 101970000},
+    {144927, 144969, 144990, 29920000, 102230000},
+    {144997, 145039, 145060, 30880000, 101880000},
+    {145066, 145108, 145129, 29000000, 101500000},
+    {145137, 145179, 145200, 30030000, 101020000},
+    {145208, 145250, 145271, 30980000, 101120000},
+    {145277, 145319, 145340, 31400000, 100680000},
+    {145346, 145388, 144849, 31620000, 99980000},
+    {145409, 145451, 145472, 30950000, 100320000},
+    {145480, 145522, 145543, 31820000, 98580000},
+    {145548, 145590, 145611, 31220000, 98830000},
+    {145617, 145659, 145680, 32980000, 98100000},
+    {145686, 145728, 145749, 32270000, 100330000},
+    {145754, 145796, 145817, 30000000, 100270000},
+    {145824, 145866, 145887, 30000000, 99100000},
+    {145894, 145936, 52982, 28930000, 99800000},
+    {145957, 145999, 146020, 29030000, 100300000},
+    {146029, 146071, 146092, 28720000, 99280000},
+    {146099, 146131, 85885, 27859714, 102255249},
+    {146152, 146194, 146215, 27900000, 102270000},
+    {146223, 146277, 146298, 27930000, 101280000},
+    {146303, 146345, 146366, 27430000, 101500000},
+    {146374, 146416, 146437, 27400000, 102180000},
+    {146445, 146487, 146508, 26670000, 102250000},
+    {146514, 146556, 119864, 26630000, 102580000},
+    {146577, 146619, 146640, 27070000, 102770000},
+    {146648, 146690, 146711, 27380000, 102530000},
+    {146716, 146758, 146779, 27720000, 102820000},
+    {146785, 146827, 146848, 27700000, 103250000},
+    {146856, 146898, 146919, 28020000, 102850000},
+    {146927, 146969, 146990, 28320000, 102420000},
+    {146995, 147037, 147058, 28550000, 102170000},
+    {147067, 147109, 66156, 28650000, 102520000},
+    {147130, 147172, 147193, 28970000, 102770000},
+    {147200, 147242, 147263, 28330000, 103130000},
+    {147269, 147311, 147332, 28270000, 103570000},
+    {147338, 147358, 111860, 26650000, 106630000},
+    {147379, 147409, 147430, 26570000, 106720000},
+    {147438, 147468, 147489, 26620000, 106720000},
+    {147496, 147526, 147547, 26376870, 106671560},
+    {147553, 147583, 147604, 26630000, 106750000},
+    {147611, 147641, 115229, 26680000, 106650000},
+    {147662, 147695, 147719, 26605105, 106618968},
+    {147730, 147760, 147781, 27070000, 106970000},
+    {147789, 147819, 34849, 27100000, 106730000},
+    {147840, 147870, 147891, 26830000, 106580000},
+    {147898, 147928, 147949, 26550000, 106470000},
+    {147958, 147981, 148005, 26596286, 104827821},
+    {148016, 148049, 30164, 26578621, 104841031},
+    {148073, 148109, 148133, 26210000, 105470000},
+    {148140, 148173, 148197, 26550000, 104950000},
+    {148207, 148240, 148267, 25720000, 104470000},
+    {148275, 148295, 148316, 27704096, 106914418},
+    {148322, 148355, 148379, 27650000, 106920000},
+    {148391, 148421, 148442, 27730000, 106920000},
+    {148451, 148481, 68524, 27539707, 106825356},
+    {148502, 148532, 148553, 28130000, 106820000},
+    {148560, 148590, 97612, 27950000, 107180000},
+    {148611, 148641, 148662, 28550000, 107430000},
+    {148670, 148721, 148742, 28880000, 107600000},
+    {148750, 148801, 20366, 28530000, 107880000},
+    {148822, 148852, 148873, 27970000, 107720000},
+    {148882, 148912, 148933, 27770000, 107480000},
+    {148940, 148970, 148991, 27220000, 107880000},
+    {148998, 149028, 105080, 28320000, 106220000},
+    {149049, 149079, 149100, 28580000, 105700000},
+    {149108, 149138, 149159, 27820000, 106420000},
+    {149167, 149187, 149208, 26250000, 105950000},
+    {149215, 149245, 149266, 26248918, 105962121},
+    {149272, 149302, 149323, 26420000, 106250000},
+    {149330, 149360, 149381, 26320000, 105750000},
+    {149388, 149439, 149460, 26070000, 105770000},
+    {149469, 149520, 149541, 25950000, 105620000},
+    {149550, 149601, 149622, 25750000, 106080000},
+    {149628, 149648, 149669, 27300000, 105280000},
+    {149675, 149708, 149732, 27301838, 105301863},
+    {149743, 149773, 149794, 27150000, 105600000},
+    {149801, 149831, 3516, 27030000, 106030000},
+    {149852, 149882, 149903, 27470000, 106220000},
+    {149910, 149940, 149961, 26670000, 105770000},
+    {149968, 149998, 150019, 26780000, 105380000},
+    {150026, 150080, 150101, 26870000, 104280000},
+    {150109, 150139, 150160, 27130000, 104720000},
+    {150168, 150188, 150209, 27720000, 109180000},
+    {150217, 150247, 150268, 27693905, 109176533},
+    {150276, 150306, 150327, 27520000, 109200000},
+    {150335, 150365, 150386, 27700000, 108850000},
+    {150395, 150437, 150458, 27230000, 108920000},
+    {150465, 150495, 150516, 27520000, 108230000},
+    {150524, 150554, 150575, 27930000, 108250000},
+    {150581, 150632, 150653, 28000000, 108400000},
+    {150662, 150692, 150713, 28270000, 108120000},
+    {150721, 150766, 150787, 28570000, 108500000},
+    {150793, 150835, 150856, 28170000, 109200000},
+    {150864, 150908, 150932, 25090934, 104903929},
+    {150942, 150996, 151020, 25080000, 104900000},
+    {151027, 151081, 151105, 25430000, 105180000},
+    {151113, 151167, 151191, 25780000, 104950000},
+    {151196, 151250, 4164, 25830000, 105220000},
+    {151274, 151328, 151352, 25380000, 105650000},
+    {151361, 151415, 151439, 25170000, 106100000},
+    {151446, 151500, 151524, 24980000, 105820000},
+    {151531, 151585, 151609, 25120000, 105470000},
+    {151616, 151657, 151681, 26586978, 107978722},
+    {151693, 151744, 151768, 26580000, 107970000},
+    {151774, 151825, 151849, 26900000, 107900000},
+    {151859, 151910, 151934, 27030000, 108120000},
+    {151942, 151993, 152017, 26970000, 108680000},
+    {152024, 152075, 152099, 27050000, 108420000},
+    {152108, 152159, 152183, 27180000, 108820000},
+    {152191, 152242, 152266, 26920000, 109200000},
+    {152274, 152325, 117118, 26680000, 109200000},
+    {152349, 152400, 152424, 26730000, 108450000},
+    {152431, 152482, 69647, 26670000, 108320000},
+    {152506, 152557, 152581, 26230000, 109130000},
+    {152588, 152639, 152663, 25930000, 108520000},
+    {152673, 152724, 152748, 25750000, 108900000},
+    {152758, 152809, 152833, 26380000, 108070000},
+    {152841, 152892, 152916, 26500000, 107580000},
+    {152924, 152975, 152999, 26200000, 107800000},
+    {153007, 153048, 153069, 26257531, 107517933},
+    {153077, 153128, 153149, 26270000, 107520000},
+    {153155, 153206, 153227, 26700000, 107500000},
+    {153234, 153285, 153306, 25420000, 107880000},
+    {153311, 153362, 153383, 26580000, 107230000},
+    {153391, 153442, 153463, 27070000, 107470000},
+    {153470, 153521, 153542, 25830000, 107530000},
+    {153549, 153600, 153621, 25830000, 107320000},
+    {153630, 153681, 153702, 25430000, 106750000},
+    {153710, 153761, 153782, 26030000, 106450000},
+    {153792, 153843, 153864, 26450000, 106970000},
+    {153871, 153922, 153943, 26130000, 106650000},
+    {153951, 154014, 154035, 25980000, 107870000},
+    {154041, 154061, 154082, 25050000, 102720000},
+    {154090, 154120, 120266, 25045149, 102702986},
+    {154141, 154171, 154192, 25073191, 102727574},
+    {154200, 154230, 154251, 25024173, 102721977},
+    {154258, 154288, 51393, 25027343, 102704476},
+    {154309, 154339, 154360, 26080000, 103180000},
+    {154370, 154400, 154421, 24880000, 102800000},
+    {154431, 154461, 154482, 24670000, 102600000},
+    {154490, 154520, 154541, 25220000, 102500000},
+    {154547, 154577, 154598, 24920000, 103150000},
+    {154606, 154648, 154669, 24770000, 103270000},
+    {154676, 154706, 154727, 25350000, 103030000},
+    {154736, 154784, 1937, 25550000, 102470000},
+    {154805, 154853, 154874, 25570000, 103250000},
+    {154882, 154912, 154933, 24920000, 102480000},
+    {154940, 154960, 154981, 25500000, 103800000},
+    {154988, 155018, 155039, 25498258, 103803003},
+    {155045, 155075, 155096, 25620000, 103820000},
+    {155103, 155133, 155154, 25430000, 103580000},
+    {155161, 155191, 155212, 25030000, 103670000},
+    {155220, 155250, 155271, 24830000, 103980000},
+    {155279, 155309, 155330, 24880000, 104300000},
+    {155338, 155368, 47204, 25670000, 104250000},
+    {155389, 155419, 155440, 26420000, 103300000},
+    {155446, 155476, 155497, 26220000, 104100000},
+    {155505, 155525, 155546, 24350000, 102550000},
+    {155551, 155581, 155602, 24344145, 102538912},
+    {155609, 155639, 155660, 24280000, 102750000},
+    {155671, 155701, 155722, 24670000, 102920000},
+    {155733, 155763, 155784, 24120000, 102750000},
+    {155792, 155822, 155843, 24200000, 102930000},
+    {155851, 155881, 155902, 24670000, 102170000},
+    {155908, 155950, 155971, 24180000, 102400000},
+    {155977, 156025, 156046, 24070000, 101980000},
+    {156054, 156111, 111634, 23590000, 102000000},
+    {156132, 156152, 44333, 25120000, 99170000},
+    {156173, 156203, 156224, 25124018, 99164693},
+    {156233, 156263, 156284, 24730000, 99180000},
+    {156292, 156322, 156343, 24580000, 98680000},
+    {156352, 156382, 50045, 24830000, 99600000},
+    {156403, 156433, 156454, 25030000, 98500000},
+    {156464, 156484, 156505, 27330000, 103720000},
+    {156514, 156544, 156565, 27323517, 103704465},
+    {156574, 156604, 156625, 27200000, 103550000},
+    {156632, 156662, 156683, 26920000, 102920000},
+    {156691, 156721, 94217, 28120000, 104230000},
+    {156742, 156772, 65754, 27750000, 103880000},
+    {156793, 156823, 156844, 28230000, 103630000},
+    {156853, 156883, 156904, 28600000, 103950000},
+    {156913, 156943, 156964, 27450000, 104870000},
+    {156974, 157004, 154598, 27630000, 104050000},
+    {157025, 157055, 157076, 27850000, 105050000},
+    {157083, 157113, 157134, 28630000, 104400000},
+    {157141, 157161, 157182, 26880000, 100230000},
+    {157190, 157220, 11997, 26880731, 100224632},
+    {157241, 157286, 157307, 26825018, 100235831},
+    {157314, 157344, 157365, 26680000, 100750000},
+    {157375, 157405, 157426, 26630000, 101270000},
+    {157434, 157476, 157497, 27280000, 100850000},
+    {157506, 157526, 157547, 23070000, 101030000},
+    {157552, 157582, 157603, 22789886, 100975952},
+    {157609, 157660, 157681, 23141483, 101163277},
+    {157688, 157733, 157754, 23430000, 101680000},
+    {157762, 157804, 157825, 24450000, 100830000},
+    {157834, 157882, 157903, 23500000, 100700000},
+    {157910, 157970, 152099, 23900000, 100880000},
+    {157991, 158042, 121153, 22580000, 101850000},
+    {158063, 158120, 158141, 22320000, 99550000},
+    {158150, 158195, 158216, 22550000, 99930000},
+    {158224, 158266, 158287, 22630000, 99620000},
+    {158294, 158314, 158335, 23880000, 100080000},
+    {158343, 158373, 110353, 23897732, 100081275},
+    {158394, 158424, 158445, 24600000, 99920000},
+    {158454, 158481, 101437, 24450000, 100130000},
+    {158502, 158532, 158553, 24030000, 99250000},
+    {158560, 158590, 158611, 23780000, 98830000},
+    {158620, 158686, 158707, 23450000, 99850000},
+    {158719, 158767, 158788, 23550000, 99400000},
+    {158795, 158837, 158858, 23150000, 99250000},
+    {158867, 158899, 158913, 25030000, 101550000},
+    {158922, 158964, 158913, 25030000, 101550000},
+    {158985, 159027, 159048, 24700000, 101630000},
+    {159058, 159100, 159121, 25320000, 101530000},
+    {159129, 159171, 159192, 25200000, 101270000},
+    {159199, 159241, 159262, 25500000, 101230000},
+    {159268, 159310, 159331, 25730000, 101320000},
+    {159337, 159379, 159400, 26070000, 101670000},
+    {159408, 159450, 159471, 25700000, 101880000},
+    {159479, 159521, 159542, 25530000, 102400000},
+    {159549, 159591, 120646, 25150000, 102080000},
+    {159612, 159653, 159667, 23369161, 102420600},
+    {159674, 159725, 159746, 23370000, 103150000},
+    {159752, 159803, 35036, 23720000, 103270000},
+    {159824, 159875, 159896, 23370000, 103400000},
+    {159903, 159954, 159975, 24400000, 103430000},
+    {159980, 160043, 160064, 22980000, 103680000},
+    {160073, 160124, 160145, 23620000, 102830000},
+    {160154, 160205, 160226, 23720000, 102500000},
+    {160234, 160285, 76108, 24530000, 103770000},
+    {160306, 160357, 94157, 23230000, 102830000},
+    {160378, 160429, 159667, 23369161, 102420600},
+    {160450, 160525, 117118, 22779543, 103226448},
+    {160546, 160597, 160618, 23000000, 102400000},
+    {160625, 160688, 83671, 22520000, 103970000},
+    {160709, 160747, 160761, 23370000, 104250000},
+    {160769, 160817, 160761, 23370000, 104250000},
+    {160838, 160886, 10300, 23620000, 104330000},
+    {160907, 160955, 160976, 23450000, 104670000},
+    {160983, 161034, 161058, 23120000, 104700000},
+    {161065, 161113, 161134, 23020000, 104400000},
+    {161141, 161189, 161210, 24050000, 104180000},
+    {161217, 161265, 161286, 24050000, 105070000},
+    {161295, 161343, 4088, 23630000, 105620000},
+    {161364, 161402, 161429, 22010211, 100796654},
+    {161443, 161491, 161518, 22020000, 100800000},
+    {161527, 161575, 161602, 21970000, 100450000},
+    {161610, 161658, 161685, 21480000, 101570000},
+    {161692, 161724, 161738, 25600000, 100230000},
+    {161743, 161785, 161738, 25600000, 100230000},
+    {161806, 161860, 161881, 25670000, 99950000},
+    {161888, 161930, 161951, 25480000, 100550000},
+    {161960, 162002, 162023, 25830000, 100580000},
+    {162032, 162074, 162095, 25350000, 100480000},
+    {162100, 162154, 162175, 25050000, 100520000},
+    {162183, 162243, 85531, 25230000, 100300000},
+    {162264, 162306, 162327, 25470000, 99530000},
+    {162336, 162378, 51900, 25880000, 99370000},
+    {162399, 162441, 162462, 26120000, 99950000},
+    {162469, 162511, 162532, 26530000, 99900000},
+    {162542, 162584, 162605, 26570000, 100180000},
+    {162612, 162653, 162674, 24439777, 98572780},
+    {162681, 162732, 162753, 24020000, 97850000},
+    {162759, 162807, 162828, 24430000, 98580000},
+    {162836, 162887, 162908, 24820000, 98300000},
+    {162916, 162967, 65693, 24720000, 97930000},
+    {162988, 163039, 120870, 24200000, 97800000},
+    {163060, 163095, 163116, 25850000, 98850000},
+    {163124, 163169, 163190, 25970000, 98820000},
+    {163197, 163242, 163263, 26900000, 98870000},
+    {163270, 163336, 163357, 27730000, 98670000},
+    {163366, 163432, 163453, 26450000, 99420000},
+    {163461, 163493, 163514, 27822377, 99701141},
+    {163521, 163569, 163596, 27830000, 99700000},
+    {163608, 163650, 163671, 28480000, 98920000},
+    {163677, 163734, 163755, 27180000, 99280000},
+    {163761, 163787, 163808, 29650000, 91130000},
+    {163813, 163849, 163870, 29648290, 91139327},
+    {163880, 163922, 163949, 29650000, 91000000},
+    {163963, 163999, 164020, 29680000, 91350000},
+    {164025, 164061, 93388, 29900000, 91250000},
+    {164082, 164118, 164139, 30480000, 91100000},
+    {164149, 164185, 164206, 29450000, 90150000},
+    {164211, 164247, 164268, 29370000, 90730000},
+    {164275, 164317, 164344, 29830000, 91730000},
+    {164356, 164385, 164412, 29270000, 88880000},
+    {164419, 164461, 164488, 29251177, 88896504},
+    {164498, 164540, 164567, 29680000, 89100000},
+    {164576, 164615, 164639, 28920000, 89600000},
+    {164647, 164686, 164710, 28670000, 87120000},
+    {164717, 164756, 164780, 28900000, 88020000},
+    {164786, 164825, 164849, 29080000, 87630000},
+    {164854, 164893, 164917, 29300000, 87230000},
+    {164924, 164966, 164993, 29430000, 88270000},
+    {165004, 165043, 165067, 29120000, 89270000},
+    {165075, 165114, 165138, 29230000, 89830000},
+    {165144, 165183, 165207, 28570000, 89680000},
+    {165214, 165253, 165277, 28370000, 87770000},
+    {165285, 165324, 165348, 29770000, 84030000},
+    {165356, 165395, 165419, 27480000, 88900000},
+    {165426, 165465, 165489, 28850000, 85300000},
+    {165496, 165538, 165565, 28170000, 85980000},
+    {165573, 165612, 165636, 29330000, 85230000},
+    {165641, 165680, 165704, 28280000, 88520000},
+    {165711, 165737, 165758, 31130000, 97180000},
+    {165766, 165802, 165823, 31114471, 97195530},
+    {165829, 165865, 165886, 31500000, 98220000},
+    {165894, 165930, 165951, 30870000, 98270000},
+    {165959, 165998, 166022, 31220000, 96600000},
+    {166030, 166066, 166087, 31420000, 95600000},
+    {166096, 166132, 166153, 30650000, 97570000},
+    {166159, 166195, 166216, 30050000, 96920000},
+    {166221, 166257, 166278, 29670000, 97850000},
+    {166286, 166322, 166343, 29680000, 98600000},
+    {166352, 166388, 91622, 30750000, 95830000},
+    {166409, 166445, 166466, 30930000, 94700000},
+    {166473, 166499, 166520, 29680000, 94370000},
+    {166527, 166563, 166584, 29639553, 94360015},
+    {166589, 166631, 166658, 29880000, 93250000},
+    {166672, 166708, 166729, 29220000, 94220000},
+    {166735, 166771, 166792, 29330000, 95330000},
+    {166798, 166834, 166855, 29870000, 95770000},
+    {166860, 166896, 166917, 28670000, 97470000},
+    {166923, 166956, 166977, 29050000, 93070000},
+    {166986, 167012, 167033, 29246042, 91823482},
+    {167041, 167077, 167098, 29230000, 91770000},
+    {167106, 167142, 167163, 29260113, 91398688},
+    {167171, 167207, 167228, 29300000, 90980000},
+    {167235, 167271, 167292, 29270000, 92020000},
+    {167299, 167335, 167356, 29030000, 91680000},
+    {167365, 167401, 167422, 29070000, 92200000},
+    {167429, 167465, 167486, 28430000, 91430000},
+    {167493, 167529, 167550, 28380000, 90870000},
+    {167557, 167593, 167614, 29150000, 92580000},
+    {167621, 167657, 167678, 28420000, 92470000},
+    {167685, 167721, 167742, 28000000, 91950000},
+    {167748, 167787, 167811, 28970000, 90400000},
+    {167820, 167846, 167867, 31480000, 92070000},
+    {167872, 167908, 167929, 31472086, 92052347},
+    {167934, 167970, 167991, 30650000, 93250000},
+    {167997, 168033, 168054, 31480000, 93680000},
+    {168059, 168095, 168116, 32120000, 92300000},
+    {168124, 168160, 168181, 32270000, 91680000},
+    {168187, 168223, 168244, 30933115, 88707488},
+    {168252, 168285, 168306, 31880000, 93780000},
+    {168314, 168350, 168371, 31370000, 90020000},
+    {168377, 168413, 168434, 31930000, 94030000},
+    {168441, 168477, 168498, 31780000, 87230000},
+    {168503, 168539, 168560, 33188500, 88837641},
+    {168569, 168598, 168619, 31949880, 80295155},
+    {168623, 168662, 168683, 30300000, 81170000},
+    {168689, 168728, 168749, 31480000, 79800000},
+    {168755, 168794, 168815, 32500000, 80100000},
+    {168820, 168859, 168880, 33380000, 79720000},
+    {168885, 168924, 168945, 32400000, 81120000},
+    {168950, 168989, 169010, 32300000, 84070000},
+    {169016, 169055, 169076, 31020000, 85170000},
+    {169083, 169103, 37729, 34270000, 108930000},
+    {169124, 169154, 19679, 34268167, 108955979},
+    {169175, 169205, 48896, 34258026, 108936052},
+    {169226, 169256, 169277, 34266277, 108939362},
+    {169284, 169314, 169335, 34268722, 109062144},
+    {169342, 169372, 169393, 34294589, 108942067},
+    {169401, 169431, 169452, 34215017, 108921978},
+    {169458, 169488, 169509, 34663305, 109222950},
+    {169518, 169548, 169569, 34370000, 109220000},
+    {169577, 169607, 1546, 34170000, 108930000},
+    {169628, 169658, 169679, 34530000, 109080000},
+    {169687, 169717, 169738, 34100000, 108600000},
+    {169745, 169775, 169796, 34150000, 109320000},
+    {169804, 169834, 169855, 34170000, 108200000},
+    {169863, 169883, 142342, 34900000, 108930000},
+    {169904, 169934, 169955, 35069538, 109070372},
+    {169962, 169992, 170013, 35115004, 109094735},
+    {170020, 170050, 170071, 34920000, 108980000},
+    {170079, 170109, 170130, 35400000, 109120000},
+    {170136, 170156, 170177, 34370000, 107130000},
+    {170183, 170213, 93874, 34372469, 107145173},
+    {170234, 170264, 170285, 34377346, 107142006},
+    {170292, 170322, 170343, 34370000, 107370000},
+    {170352, 170382, 170403, 34520000, 107380000},
+    {170413, 170443, 170464, 34450000, 107620000},
+    {170471, 170501, 170522, 34370000, 107870000},
+    {170529, 170556, 120091, 34280000, 107750000},
+    {170577, 170604, 170625, 34900000, 106850000},
+    {170634, 170664, 170685, 34650000, 107130000},
+    {170694, 170724, 170745, 34680000, 107780000},
+    {170752, 170779, 50548, 33920000, 106520000},
+    {170800, 170830, 170851, 34070000, 107320000},
+    {170858, 170878, 170899, 34330000, 108700000},
+    {170908, 170938, 170959, 34331013, 108701605},
+    {170966, 170996, 171017, 34273385, 108079818},
+    {171026, 171056, 84682, 34363387, 108732492},
+    {171077, 171107, 71177, 34620000, 108930000},
+    {171128, 171158, 137543, 34530000, 108830000},
+    {171179, 171206, 171227, 34530000, 108230000},
+    {171236, 171266, 171287, 34480000, 108420000},
+    {171294, 171324, 171345, 34700000, 108130000},
+    {171354, 171384, 171405, 35200000, 107780000},
+    {171413, 171443, 171464, 35120000, 108330000},
+    {171470, 171500, 171521, 34780000, 108580000},
+    {171529, 171559, 171580, 34270000, 108200000},
+    {171587, 171617, 171638, 34300000, 108480000},
+    {171647, 171677, 41012, 35030000, 108080000},
+    {171698, 171718, 171739, 34500000, 109500000},
+    {171746, 171776, 171797, 34499470, 109487526},
+    {171804, 171834, 93269, 34520000, 109770000},
+    {171855, 171885, 65426, 34550000, 110230000},
+    {171906, 171936, 161738, 34800000, 109930000},
+    {171957, 171987, 172008, 35230000, 110150000},
+    {172015, 172045, 172066, 35180000, 109930000},
+    {172077, 172107, 73463, 34950000, 109580000},
+    {172128, 172158, 172179, 35180000, 109580000},
+    {172187, 172217, 6981, 34750000, 109180000},
+    {172238, 172268, 172289, 35480000, 110430000},
+    {172298, 172328, 172349, 34570000, 110080000},
+    {172356, 172376, 172397, 36600000, 109480000},
+    {172403, 172433, 172454, 36591176, 109487713},
+    {172460, 172490, 172511, 36870000, 109320000},
+    {172517, 172547, 172568, 36580000, 110000000},
+    {172577, 172607, 172628, 36880000, 110180000},
+    {172637, 172667, 172688, 37130000, 109670000},
+    {172696, 172726, 172747, 36820000, 108770000},
+    {172754, 172784, 172805, 36985299, 108105971},
+    {172810, 172840, 172861, 36280000, 109350000},
+    {172869, 172896, 172917, 35980000, 109370000},
+    {172924, 172954, 172975, 35770000, 109430000},
+    {172984, 173014, 92083, 36050000, 110170000},
+    {173035, 173065, 173086, 35580000, 109830000},
+    {173096, 173126, 173147, 35580000, 109250000},
+    {173157, 173177, 173198, 33070000, 107020000},
+    {173207, 173237, 173258, 33069634, 107027300},
+    {173265, 173295, 173316, 33000000, 106930000},
+    {173325, 173355, 173376, 33150000, 107330000},
+    {173384, 173411, 173432, 33220000, 107550000},
+    {173441, 173471, 173492, 32980000, 107770000},
+    {173500, 173527, 173548, 33150000, 106670000},
+    {173557, 173587, 173608, 32830000, 106250000},
+    {173618, 173648, 173669, 33330000, 106150000},
+    {173677, 173707, 173728, 32530000, 107900000},
+    {173735, 173765, 173786, 33620000, 106920000},
+    {173792, 173822, 173843, 33530000, 107980000},
+    {173851, 173871, 127910, 38280000, 109730000},
+    {173892, 173922, 173943, 38280000, 109750000},
+    {173950, 173980, 42952, 37950000, 109280000},
+    {174001, 174031, 174052, 39030000, 111070000},
+    {174057, 174087, 174108, 37600000, 108800000},
+    {174117, 174147, 174168, 37580000, 107600000},
+    {174177, 174207, 174228, 37500000, 110250000},
+    {174234, 174264, 174285, 37750000, 110180000},
+    {174291, 174318, 92700, 38020000, 110480000},
+    {174339, 174369, 174390, 37450000, 110730000},
+    {174395, 174425, 174446, 37080000, 110120000},
+    {174455, 174485, 174506, 37620000, 110030000},
+    {174513, 174543, 174564, 38830000, 110500000},
+    {174571, 174591, 174612, 32680000, 109020000},
+    {174619, 174649, 174670, 32697245, 109021979},
+    {174677, 174707, 174728, 32900000, 108500000},
+    {174735, 174765, 174786, 33050000, 108250000},
+    {174794, 174824, 174845, 33320000, 108320000},
+    {174854, 174884, 111340, 32520000, 108530000},
+    {174905, 174935, 174956, 32320000, 108900000},
+    {174963, 174993, 175014, 32400000, 109350000},
+    {175021, 175051, 97031, 31880000, 109520000},
+    {175072, 175102, 76263, 32830000, 109380000},
+    {175123, 175153, 175174, 32820000, 110100000},
+    {175180, 175200, 175221, 33867043, 109940250},
+    {175230, 175260, 175281, 33870000, 109930000},
+    {175291, 175321, 175342, 34080000, 110130000},
+    {175349, 175379, 175400, 33700000, 110330000},
+    {175408, 175438, 175459, 33530000, 110880000},
+    {175468, 175498, 94738, 33530000, 109880000},
+    {175519, 175549, 32289, 33430000, 109150000},
+    {175570, 175600, 175621, 33680000, 109100000},
+    {175629, 175649, 175670, 36070000, 103820000},
+    {175678, 175708, 163870, 36057398, 103822838},
+    {175729, 175762, 175786, 36066735, 103782901},
+    {175793, 175823, 175844, 36100759, 103620069},
+    {175849, 175879, 154933, 36103517, 103721545},
+    {175900, 175930, 175951, 36344498, 102860034},
+    {175958, 175988, 176009, 36730000, 103270000},
+    {176018, 176048, 176069, 36330000, 103950000},
+    {176076, 176106, 133438, 35850000, 104120000},
+    {176127, 176150, 176177, 39800000, 98270000},
+    {176187, 176207, 176228, 38500000, 102180000},
+    {176237, 176267, 144331, 38520658, 102192115},
+    {176288, 176318, 176339, 38250000, 101970000},
+    {176349, 176369, 176383, 36550000, 104180000},
+    {176390, 176420, 176383, 36550000, 104180000},
+    {176441, 176471, 176492, 36730000, 104830000},
+    {176502, 176532, 176553, 36570000, 104680000},
+    {176562, 176592, 176613, 35700000, 105050000},
+    {176621, 176651, 176672, 37150000, 104070000},
+    {176680, 176700, 176721, 34580000, 105720000},
+    {176730, 176760, 127160, 34582211, 105720263},
+    {176781, 176811, 176832, 34453491, 106072958},
+    {176838, 176868, 176889, 34750000, 106130000},
+    {176898, 176928, 176949, 34870000, 105670000},
+    {176955, 176985, 177006, 34730000, 105330000},
+    {177012, 177042, 134733, 34720000, 104880000},
+    {177063, 177108, 177132, 35000000, 106220000},
+    {177146, 177166, 63681, 37930000, 102630000},
+    {177187, 177217, 177238, 37927933, 102640457},
+    {177248, 177278, 177299, 38620000, 103080000},
+    {177306, 177336, 177357, 37470000, 102880000},
+    {177364, 177406, 152266, 36980000, 103130000},
+    {177427, 177447, 177468, 38930000, 100450000},
+    {177476, 177506, 77351, 38929192, 100476437},
+    {177527, 177572, 177593, 38830000, 99620000},
+    {177599, 177629, 177650, 38430000, 100820000},
+    {177656, 177686, 177707, 39130000, 100170000},
+    {177713, 177743, 177764, 39380000, 99820000},
+    {177771, 177801, 177822, 38780000, 101080000},
+    {177830, 177850, 177871, 35538759, 106688576},
+    {177881, 177911, 177932, 35550000, 106670000},
+    {177941, 177971, 177992, 35330000, 107370000},
+    {178002, 178032, 178053, 35070000, 107620000},
+    {178061, 178091, 178112, 35300000, 107030000},
+    {178121, 178151, 178172, 35200000, 106050000},
+    {178183, 178213, 62524, 35520000, 105720000},
+    {178234, 178264, 178285, 35220000, 106650000},
+    {178293, 178313, 178334, 39750000, 98520000},
+    {178342, 178372, 52808, 39744287, 98507262},
+    {178393, 178423, 178444, 39980000, 98900000},
+    {178450, 178480, 178501, 40830477, 95875699},
+    {178509, 178554, 178575, 39520000, 94880000},
+    {178581, 178632, 178656, 39630000, 94330000},
+    {178663, 178693, 178714, 40280000, 97050000},
+    {178720, 178750, 178771, 40130000, 94670000},
+    {178780, 178800, 69044, 35731010, 107648506},
+    {178821, 178851, 34849, 35730000, 107630000},
+    {178872, 178902, 121434, 36000000, 107880000},
+    {178923, 178950, 178971, 36580000, 107300000},
+    {178980, 179010, 179031, 36470000, 107980000},
+    {179038, 179068, 179089, 35820000, 108020000},
+    {179096, 179126, 179147, 35500000, 108370000},
+    {179157, 179184, 179205, 35500000, 107920000},
+    {179214, 179244, 152099, 35680000, 107200000},
+    {179265, 179285, 179306, 35574228, 104623146},
+    {179313, 179343, 179364, 35580000, 104620000},
+    {179371, 179401, 179422, 35200000, 105250000},
+    {179430, 179460, 179481, 35000000, 104630000},
+    {179488, 179518, 139419, 35130000, 104220000},
+    {179539, 179569, 179590, 35380000, 103870000},
+    {179597, 179624, 179645, 34850000, 104470000},
+    {179655, 179682, 179703, 34430000, 104030000},
+    {179711, 179731, 77874, 33372135, 104957384},
+    {179752, 179782, 179803, 33400000, 104920000},
+    {179808, 179835, 179856, 33730000, 105720000},
+    {179866, 179893, 94965, 32950000, 104680000},
+    {179914, 179944, 179965, 34050000, 104380000},
+    {179975, 180002, 180023, 33330000, 105600000},
+    {180032, 180062, 33677, 34020000, 105300000},
+    {180083, 180110, 7560, 34180000, 105170000},
+    {180131, 180158, 94453, 33770000, 106080000},
+    {180179, 180209, 180230, 33920000, 106300000},
+    {180240, 180272, 180286, 35600000, 103220000},
+    {180293, 180335, 180286, 35600000, 103220000},
+    {180356, 180398, 180419, 35370000, 103720000},
+    {180426, 180468, 180489, 35930000, 103320000},
+    {180498, 180540, 180561, 35480000, 103580000},
+    {180569, 180611, 180632, 35430000, 103350000},
+    {180640, 180691, 79961, 35670000, 103400000},
+    {180712, 180790, 180814, 35740000, 102850000},
+    {180824, 180856, 42400, 34984523, 102909304},
+    {180877, 180919, 180940, 34980000, 102920000},
+    {180946, 180988, 181009, 34700000, 103350000},
+    {181016, 181058, 181079, 34580000, 103500000},
+    {181086, 181128, 181149, 33780000, 104370000},
+    {181156, 181198, 181219, 34050000, 103220000},
+    {181225, 181267, 181288, 34000000, 102070000},
+    {181293, 181335, 181356, 34580000, 102480000},
+    {181361, 181403, 181424, 35200000, 102520000},
+    {181430, 181450, 181471, 36620000, 101780000},
+    {181478, 181508, 181529, 36599983, 101801772},
+    {181539, 181569, 123923, 36545706, 101703488},
+    {181590, 181620, 181641, 36628369, 101763791},
+    {181649, 181679, 181700, 36650011, 101764183},
+    {181709, 181757, 12895, 36930000, 101680000},
+    {181778, 181808, 181829, 36500000, 101570000},
+    {181840, 181870, 181891, 36680000, 101270000},
+    {181901, 181921, 181942, 36298076, 102368689},
+    {181950, 181980, 182001, 36480000, 102400000},
+    {182006, 182036, 182057, 36500000, 102120000},
+    {182064, 182112, 182133, 36330000, 102800000},
+    {182139, 182181, 182202, 36830000, 101950000},
+    {182208, 182250, 95184, 36100000, 102270000},
+    {182271, 182316, 182337, 35850000, 102480000},
+    {182344, 182376, 182397, 36970000, 100900000},
+    {182404, 182458, 182479, 37380000, 101620000},
+    {182487, 182529, 182550, 38180000, 100250000},
+    {182557, 182599, 59286, 36900000, 100980000},
+    {182620, 182662, 182683, 37330000, 100130000},
+    {182691, 182723, 182744, 35539039, 102029686},
+    {182753, 182795, 150209, 35520000, 102020000},
+    {182816, 182858, 182879, 35930000, 102030000},
+    {182887, 182929, 182950, 35030000, 101470000},
+    {182955, 183012, 183033, 34730000, 101600000},
+    {183039, 183071, 21327, 36272888, 100637856},
+    {183092, 183134, 183155, 36280000, 100620000},
+    {183162, 183204, 183225, 35250000, 100570000},
+    {183232, 183274, 183295, 36050000, 101430000},
+    {183301, 183343, 183364, 35580000, 99980000},
+    {183372, 183414, 183435, 35580000, 100750000},
+    {183442, 183474, 183495, 34471861, 100248871},
+    {183502, 183544, 183565, 34480000, 100230000},
+    {183571, 183613, 183634, 32930000, 100730000},
+    {183640, 183682, 183703, 33970000, 99900000},
+    {183709, 183751, 183772, 33750000, 99650000},
+    {183777, 183819, 183840, 33430000, 101480000},
+    {183847, 183889, 183910, 34920000, 98180000},
+    {183915, 183947, 36528, 33000000, 97020000},
+    {183961, 184003, 36528, 33000000, 97020000},
+    {184024, 184066, 184087, 32900000, 95300000},
+    {184093, 184135, 184156, 33370000, 97100000},
+    {184164, 184206, 184227, 33850000, 95620000},
+    {184234, 184276, 184297, 32200000, 96480000},
+    {184306, 184351, 184375, 34130000, 95800000},
+    {184383, 184424, 184445, 37345145, 97381439},
+    {184451, 184505, 184529, 36420000, 94900000},
+    {184536, 184590, 184614, 37370000, 97370000},
+    {184623, 184674, 184695, 37915687, 92066636},
+    {184702, 184753, 184774, 36930000, 98480000},
+    {184780, 184831, 184855, 36300000, 98080000},
+    {184861, 184912, 184933, 37300000, 99020000},
+    {184941, 184973, 184994, 38470000, 106280000},
+    {185003, 185045, 185066, 38473231, 106283917},
+    {185075, 185117, 96974, 38501659, 106157004},
+    {185138, 185180, 185201, 38473466, 106235596},
+    {185209, 185251, 123382, 38280000, 106250000},
+    {185272, 185314, 185335, 38550000, 106350000},
+    {185341, 185383, 185404, 38100000, 106330000},
+    {185411, 185446, 185473, 39020000, 106380000},
+    {185484, 185532, 185559, 39018214, 106363173},
+    {185567, 185612, 185636, 39250000, 106780000},
+    {185644, 185689, 185713, 38900000, 106530000},
+    {185721, 185753, 52923, 37980000, 106200000},
+    {185774, 185816, 185837, 37982932, 106208191},
+    {185844, 185889, 185913, 37425041, 106057655},
+    {185923, 185965, 185986, 37780000, 107400000},
+    {185993, 186035, 186056, 36980000, 105920000},
+    {186064, 186109, 186133, 38020000, 106070000},
+    {186145, 186177, 8619, 36000000, 106280000},
+    {186198, 186240, 79288, 36003901, 106283544},
+    {186261, 186303, 186324, 35970000, 105730000},
+    {186329, 186371, 186392, 35620000, 106120000},
+    {186399, 186441, 176553, 35480000, 106330000},
+    {186462, 186504, 186525, 35850000, 106630000},
+    {186534, 186566, 186587, 37520000, 105180000},
+    {186596, 186641, 186665, 37513996, 105186762},
+    {186674, 186716, 186737, 37480000, 105670000},
+    {186747, 186789, 186810, 36570000, 105650000},
+    {186818, 186859, 186892, 43820000, 87620000},
+    {186901, 186949, 186976, 43905049, 88109174},
+    {186984, 187041, 187074, 43799772, 87595062},
+    {187084, 187135, 187162, 43891543, 87590329},
+    {187169, 187223, 187253, 43831732, 87639099},
+    {187263, 187317, 187347, 43874533, 87422512},
+    {187356, 187410, 187440, 43350000, 88300000},
+    {187451, 187502, 187529, 43959738, 87688786},
+    {187536, 187593, 186892, 43590050, 87798650},
+    {187632, 187673, 187693, 45600000, 84870000},
+    {187702, 187756, 187693, 44327265, 84884620},
+    {187786, 187843, 187693, 45600000, 84870000},
+    {187876, 187930, 187960, 45700000, 85130000},
+    {187971, 188025, 188055, 46080000, 85680000},
+    {188062, 188100, 188127, 42950000, 89170000},
+    {188135, 188183, 188207, 42940904, 89182989},
+    {188216, 188264, 188288, 42870000, 90220000},
+    {188297, 188348, 188375, 42780000, 88650000},
+    {188384, 188419, 188440, 42830000, 93520000},
+    {188445, 188490, 129929, 42825474, 93513050},
+    {188511, 188574, 188598, 43600000, 93000000},
+    {188606, 188651, 60650, 43250000, 94700000},
+    {188672, 188719, 188733, 44020000, 87300000},
+    {188741, 188798, 188733, 44020000, 87300000},
+    {188819, 188876, 188897, 44150000, 87980000},
+    {188904, 188964, 188988, 44180000, 86900000},
+    {188995, 189055, 189079, 44300000, 86220000},
+    {189086, 189143, 189164, 44020000, 89580000},
+    {189170, 189233, 189260, 44000000, 89180000},
+    {189269, 189341, 189362, 43830000, 90280000},
+    {189368, 189421, 189448, 44904567, 82062877},
+    {189457, 189520, 189547, 44900000, 82070000},
+    {189552, 189621, 189654, 45170402, 82575609},
+    {189665, 189728, 189755, 44600000, 82880000},
+    {189762, 189825, 189852, 44970000, 81030000},
+    {189860, 189913, 189940, 41762611, 86142645},
+    {189953, 190019, 190049, 41770000, 86150000},
+    {190056, 190119, 190146, 41780000, 84270000},
+    {190153, 190216, 190243, 41330000, 86250000},
+    {190249, 190312, 190339, 39020000, 88170000},
+    {190348, 190411, 190438, 38130000, 85530000},
+    {190444, 190519, 190546, 42070000, 86570000},
+    {190552, 190615, 190642, 42320000, 86400000},
+    {190649, 190712, 190739, 42270000, 86870000},
+    {190746, 190809, 190836, 41980000, 86630000},
+    {190841, 190882, 190899, 41170000, 80270000},
+    {190905, 190959, 190899, 41170000, 80270000},
+    {190986, 191037, 191061, 41280000, 80230000},
+    {191067, 191118, 191142, 41720000, 82970000},
+    {191148, 191199, 191223, 41220000, 82780000},
+    {191229, 191280, 6119, 41550000, 82600000},
+    {191304, 191355, 39159, 41800000, 81870000},
+    {191379, 191430, 191454, 41220000, 79230000},
+    {191460, 191514, 191541, 40630000, 80380000},
+    {191547, 191598, 191622, 40500000, 79050000},
+    {191629, 191688, 191709, 39714112, 76164780},
+    {191716, 191788, 191812, 39720000, 76170000},
+    {191819, 191891, 191915, 39150000, 75950000},
+    {191922, 191994, 192018, 40930000, 78450000},
+    {192024, 192093, 192114, 39720000, 75250000},
+    {192120, 192158, 192172, 39470000, 75980000},
+    {192178, 192226, 192172, 39470000, 75980000},
+    {192247, 192295, 192316, 39380000, 75850000},
+    {192322, 192370, 192391, 39400000, 76050000},
+    {192398, 192449, 192473, 38930000, 76170000},
+    {192483, 192531, 192552, 38180000, 77270000},
+    {192557, 192605, 192626, 38420000, 77230000},
+    {192633, 192681, 192702, 37880000, 77420000},
+    {192710, 192761, 192785, 38900000, 77650000},
+    {192794, 192845, 192869, 39230000, 76770000},
+    {192877, 192925, 192946, 39500000, 76730000},
+    {192953, 193001, 193022, 39780000, 78550000},
+    {193028, 193100, 193130, 37760000, 75220000},
+    {193143, 193181, 193195, 37120000, 79920000},
+    {193202, 193250, 193195, 37120000, 79920000},
+    {193271, 193319, 193340, 37270000, 79730000},
+    {193345, 193393, 193414, 37620000, 78280000},
+    {193421, 193469, 193490, 37070000, 80180000},
+    {193496, 193544, 193565, 37000000, 80800000},
+    {193570, 193618, 3574, 36850000, 81670000},
+    {193639, 193687, 193708, 37070000, 82680000},
+    {193716, 193766, 193787, 43915571, 81321087},
+    {193792, 193852, 193873, 43920000, 81320000},
+    {193880, 193940, 193961, 44420000, 84900000},
+    {193968, 194034, 194061, 44205778, 80418189},
+    {194072, 194132, 193873, 43980000, 81520000},
+    {194156, 194234, 194261, 43830000, 81150000},
+    {194272, 194332, 194353, 44050000, 80880000},
+    {194362, 194422, 194443, 43480000, 82230000},
+    {194451, 194511, 194532, 43430000, 83250000},
+    {194540, 194600, 194621, 43150000, 81130000},
+    {194628, 194691, 194715, 43220000, 81830000},
+    {194722, 194785, 194809, 43780000, 82500000},
+    {194816, 194854, 194868, 46750000, 82980000},
+    {194876, 194924, 194868, 46750000, 82980000},
+    {194945, 194993, 195014, 44430000, 84680000},
+    {195019, 195067, 195088, 46530000, 83630000},
+    {195093, 195141, 139697, 44330000, 85620000},
+    {195162, 195210, 195231, 45930000, 83600000},
+    {195237, 195285, 195306, 46200000, 82980000},
+    {195312, 195381, 195411, 46800000, 85720000},
+    {195421, 195462, 195479, 47850000, 88130000},
+    {195486, 195540, 195479, 47850000, 88130000},
+    {195567, 195621, 195648, 47700000, 86850000},
+    {195656, 195707, 195731, 47000000, 89520000},
+    {195737, 195788, 195812, 47120000, 87500000},
+    {195818, 195872, 195899, 48070000, 86420000},
+    {195906, 195957, 6346, 46670000, 90380000},
+    {195981, 196035, 196062, 47430000, 85880000},
+    {196070, 196108, 196135, 44300000, 86030000},
+    {196143, 196181, 196208, 40550000, 81280000},
+    {196214, 196255, 196282, 39864316, 79066934},
+    {196292, 196330, 196357, 44165496, 87540372},
+    {196365, 196400, 196421, 47325295, 87830840},
+    {196428, 196466, 196490, 41862197, 85667920},
+    {196501, 196536, 196557, 44843199, 82351820},
+    {196566, 196607, 196634, 43943757, 81041775},
+    {196643, 196678, 196699, 37209733, 79288859},
+    {196705, 196719, 196740, 22004169, 120743889},
+    {196705, 196749, 196770, 23000000, 120200000},
+    {196705, 196705, 196777, 22620000, 120280000},
+    {196705, 196786, 196807, 22670000, 120480000},
+    {196705, 196816, 196837, 23565399, 119586273},
+    {196705, 196845, 196866, 23480000, 120430000},
+    {196705, 196872, 196893, 22750000, 121150000},
+    {196900, 196914, 196938, 23720000, 120530000},
+    {196900, 196943, 196964, 23746389, 120752502},
+    {196900, 196973, 196994, 24080000, 120530000},
+    {196900, 196900, 197001, 23920000, 120670000},
+    {196900, 197010, 197031, 24150000, 120670000},
+    {196900, 197038, 197059, 24530000, 120800000},
+    {196900, 197067, 197088, 23966391, 120969521},
+    {196900, 197093, 197114, 23980000, 121600000},
+    {197122, 197136, 197157, 24820000, 120950000},
+    {197122, 197164, 197185, 24883730, 121290428},
+    {197122, 197190, 110804, 24970000, 121300000},
+    {197122, 197122, 197211, 25047760, 121531853},
+    {197122, 197218, 40873, 24770000, 121750000},
+    {197122, 197239, 197260, 25128250, 121741898},
+    {197268, 197268, 197275, 22285521, 114157692},
+    {197268, 197285, 197292, 22316669, 114183327},
+    {197268, 197300, 197307, 22366671, 114099998},
+    {197268, 197317, 197324, 22357692, 114137613},
+    {197340, 197340, 197347, 22130000, 113330000},
+    {197340, 197353, 197363, 22126420, 113570867},
+    {197340, 197371, 197381, 22150051, 113568466},
+};
+
+// 按城市名称、行政归属、拼音排序的下标，用于二分查找
+constexpr uint16_t kCityByName[] = {
+    781, 791, 796, 790, 797, 783, 786, 788, 794, 792, 787, 793, 784, 789, 795, 785,
+    782, 3212, 2621, 2622, 2624, 2623, 2627, 2625, 2629, 2628, 2626, 2604, 2608, 2605, 2609, 2607,
+    2606, 2664, 2692, 2586, 2588, 2590, 2591, 2587, 2589, 2668, 2677, 2679, 2674, 2669, 2672, 2675,
+    2673, 2676, 2678, 2670, 2671, 2680, 2681, 2684, 2682, 2685, 2683, 2686, 2691, 2687, 2688, 2689,
+    2690, 2655, 2661, 2663, 2662, 2656, 2657, 2658, 2660, 2659, 2556, 2552, 2557, 2565, 2554, 2560,
+    2559, 2564, 2562, 2551, 2558, 2553, 2561, 2563, 2555, 2597, 2602, 2595, 2601, 2592, 2593, 2603,
+    2598, 2596, 2599, 2600, 2594, 2613, 2618, 2612, 2611, 2610, 2614, 2615, 2617, 2619, 2620, 2616,
+    2574, 2575, 2573, 2571, 2566, 2568, 2572, 2570, 2569, 2567, 2630, 2638, 2634, 2632, 2636, 2635,
+    2631, 2639, 2637, 2633, 2640, 2585, 2581, 2583, 2584, 2582, 2578, 2579, 2576, 2577, 2580, 2641,
+    2642, 2650, 2646, 2647, 2643, 2645, 2654, 2649, 2648, 2651, 2653, 2644, 2652, 2666, 2667, 2665,
+    2694, 2695, 2693, 431, 425, 426, 423, 422, 424, 430, 428, 427, 429, 421, 361, 364,
+    362, 363, 433, 432, 437, 436, 435, 438, 434, 420, 397, 412, 439, 352, 357, 351,
+    359, 358, 353, 356, 355, 360, 354, 409, 399, 406, 405, 411, 398, 407, 408, 401,
+    402, 403, 400, 404, 410, 341, 348, 343, 346, 347, 342, 350, 349, 344, 345, 413,
+    417, 416, 418, 414, 419, 415, 367, 373, 375, 376, 371, 370, 377, 368, 372, 366,
+    374, 365, 369, 384, 383, 382, 385, 379, 380, 381, 378, 386, 388, 395, 396, 391,
+    389, 394, 390, 392, 387, 393, 445, 440, 451, 447, 450, 449, 444, 443, 446, 441,
+    448, 442, 454, 453, 452, 455, 1, 4, 0, 12, 15, 14, 16, 13, 8, 11,
+    3, 6, 5, 2, 9, 7, 10, 3200, 3199, 3202, 3203, 3198, 3204, 3201, 3197, 3208,
+    3210, 3206, 3209, 3205, 3207, 3192, 3196, 3191, 3195, 3193, 3190, 3194, 585, 581, 630, 582,
+    588, 586, 590, 589, 584, 587, 583, 595, 596, 597, 591, 594, 593, 592, 636, 632,
+    638, 631, 633, 637, 634, 635, 622, 620, 619, 623, 618, 621, 629, 625, 628, 624,
+    627, 626, 617, 614, 613, 612, 611, 616, 615, 601, 602, 600, 598, 599, 604, 605,
+    608, 609, 607, 603, 606, 610, 577, 574, 578, 571, 576, 572, 580, 573, 579, 575,
+    570, 2329, 2332, 2335, 2336, 2340, 2338, 2330, 2337, 2331, 2334, 2333, 2339, 2325, 2323, 2326,
+    2324, 2327, 2328, 2442, 2441, 2449, 2436, 2448, 2443, 2445, 2440, 2447, 2444, 2438, 2451, 2439,
+    2452, 2437, 2450, 2446, 2453, 2348, 2341, 2345, 2344, 2346, 2347, 2349, 2350, 2342, 2343, 2367,
+    2360, 2361, 2358, 2368, 2362, 2365, 2366, 2359, 2363, 2364, 2397, 2393, 2394, 2398, 2395, 2396,
+    2310, 2315, 2309, 2313, 2311, 2312, 2316, 2314, 2369, 2371, 2375, 2372, 2370, 2373, 2374, 2295,
+    2297, 2296, 2292, 2293, 2298, 2294, 2260, 2263, 2269, 2267, 2255, 2250, 2265, 2258, 2254, 2259,
+    2270, 2264, 2268, 2261, 2266, 2262, 2253, 2251, 2257, 2252, 2256, 2279, 2281, 2278, 2283, 2282,
+    2280, 2290, 2291, 2289, 2285, 2288, 2284, 2286, 2287, 2417, 2420, 2421, 2433, 2432, 2418, 2435,
+    2427, 2426, 2419, 2424, 2431, 2425, 2428, 2429, 2434, 2430, 2423, 2422, 2352, 2356, 2354, 2353,
+    2355, 2351, 2357, 2303, 2306, 2302, 2307, 2305, 2308, 2300, 2301, 2304, 2299, 2274, 2277, 2275,
+    2272, 2271, 2276, 2273, 2402, 2401, 2399, 2400, 2383, 2381, 2379, 2380, 2382, 2378, 2376, 2377,
+    2322, 2319, 2321, 2318, 2320, 2317, 2403, 2409, 2413, 2411, 2408, 2405, 2406, 2416, 2415, 2407,
+    2410, 2414, 2404, 2412, 2386, 2390, 2392, 2388, 2389, 2391, 2387, 2384, 2385, 24, 27, 21,
+    18, 17, 31, 29, 28, 19, 22, 20, 26, 30, 23, 33, 25, 32, 3068, 3070,
+    3069, 3071, 3057, 3060, 3056, 3059, 3058, 3061, 3063, 3062, 3067, 3066, 3064, 3065, 3053, 3055,
+    3054, 3052, 3046, 3049, 3051, 3047, 3050, 3048, 3045, 1110, 1114, 1112, 1113, 1111, 1102, 1105,
+    1107, 1104, 1103, 1108, 1109, 1106, 1011, 1007, 1016, 1015, 1009, 1008, 1013, 1014, 1010, 1012,
+    1061, 1065, 1059, 1062, 1066, 1068, 1063, 1067, 1069, 1064, 1060, 1127, 1120, 1121, 1123, 1126,
+    1124, 1125, 1122, 1097, 1096, 1101, 1100, 1098, 1099, 1117, 1115, 1118, 1116, 1119, 1050, 1049,
+    1053, 1052, 1051, 1038, 1040, 1035, 1041, 1034, 1039, 1036, 1037, 1082, 1084, 1080, 1085, 1083,
+    1086, 1081, 1078, 1079, 1021, 1024, 1019, 1025, 1023, 1017, 1022, 1018, 1020, 1032, 1033, 1031,
+    1030, 1029, 1026, 1028, 1027, 1056, 1058, 1057, 1055, 1054, 1091, 1092, 1095, 1093, 1087, 1094,
+    1089, 1088, 1090, 1045, 1047, 1048, 1046, 1043, 1044, 1042, 1075, 1071, 1073, 1074, 1077, 1070,
+    1072, 1076, 1373, 1374, 1377, 1376, 1378, 1375, 1434, 1446, 1435, 1441, 1443, 1438, 1440, 1437,
+    1436, 1444, 1445, 1442, 1439, 1428, 1424, 1426, 1425, 1427, 1452, 1457, 1455, 1450, 1454, 1451,
+    1448, 1447, 1456, 1458, 1449, 1453, 1430, 1432, 1431, 1429, 1433, 1370, 1371, 1369, 1367, 1366,
+    1372, 1368, 1421, 1420, 1419, 1422, 1417, 1418, 1423, 1334, 1338, 1345, 1337, 1335, 1344, 1336,
+    1333, 1341, 1340, 1342, 1343, 1339, 1406, 1407, 1411, 1408, 1415, 1414, 1412, 1413, 1405, 1416,
+    1410, 1409, 1361, 1360, 1362, 1359, 1363, 1365, 1357, 1358, 1364, 1474, 1471, 1473, 1470, 1469,
+    1468, 1475, 1472, 1397, 1395, 1396, 1402, 1394, 1401, 1398, 1404, 1392, 1393, 1400, 1399, 1403,
+    1389, 1390, 1391, 1379, 1382, 1381, 1380, 1383, 1387, 1386, 1388, 1384, 1385, 1460, 1464, 1467,
+    1465, 1459, 1463, 1462, 1461, 1466, 1485, 1480, 1478, 1482, 1481, 1479, 1477, 1476, 1483, 1484,
+    1353, 1352, 1350, 1348, 1347, 1355, 1351, 1354, 1356, 1346, 1349, 309, 319, 325, 315, 318,
+    320, 316, 310, 311, 322, 324, 314, 317, 312, 323, 313, 321, 326, 337, 332, 338,
+    330, 331, 327, 339, 335, 329, 336, 333, 340, 334, 328, 227, 228, 224, 230, 234,
+    226, 231, 225, 233, 232, 229, 218, 223, 213, 222, 214, 217, 219, 216, 220, 215,
+    221, 297, 303, 298, 306, 307, 308, 300, 296, 304, 294, 295, 305, 302, 299, 301,
+    279, 272, 275, 274, 271, 277, 273, 268, 269, 270, 278, 276, 254, 255, 256, 259,
+    257, 258, 260, 266, 264, 263, 265, 267, 262, 261, 283, 282, 288, 289, 290, 286,
+    292, 293, 281, 285, 287, 291, 280, 284, 243, 249, 244, 247, 251, 252, 253, 245,
+    242, 246, 250, 241, 248, 235, 239, 240, 237, 238, 236, 2039, 2037, 2038, 2051, 2052,
+    2050, 2053, 2055, 2054, 1962, 1958, 1960, 1959, 1961, 1963, 1923, 1922, 1924, 1917, 1913, 1916,
+    1920, 1918, 1921, 1914, 1915, 1919, 2000, 2001, 1998, 1997, 1999, 2002, 2048, 2046, 2047, 2044,
+    2049, 2045, 2007, 2008, 2011, 2006, 2009, 2005, 2003, 2004, 2010, 1957, 1950, 1955, 1954, 1956,
+    1953, 1952, 1951, 2012, 2013, 2015, 2014, 1968, 1969, 1971, 1967, 1966, 1964, 1965, 1970, 2022,
+    2021, 2016, 2017, 2018, 2020, 2019, 1945, 1939, 1944, 1940, 1936, 1942, 1938, 1937, 1943, 1941,
+    2031, 2029, 2030, 2028, 2035, 2034, 2033, 2036, 2032, 1981, 1975, 1979, 1978, 1972, 1973, 1977,
+    1980, 1974, 1976, 2041, 2042, 2040, 2043, 1948, 1946, 1949, 1947, 1996, 1994, 1992, 1995, 1993,
+    1989, 1988, 1991, 1990, 1987, 1986, 1984, 1983, 1982, 1985, 2024, 2025, 2027, 2023, 2026, 1934,
+    1932, 1930, 1935, 1929, 1933, 1928, 1926, 1927, 1931, 1925, 2106, 2110, 2107, 2109, 2108, 2066,
+    2057, 2056, 2067, 2068, 2063, 2059, 2061, 2060, 2062, 2064, 2058, 2065, 2180, 2178, 2179, 2176,
+    2173, 2175, 2174, 2177, 2167, 2172, 2168, 2166, 2170, 2169, 2171, 2079, 2070, 2073, 2072, 2075,
+    2069, 2074, 2077, 2078, 2071, 2076, 2084, 2086, 2089, 2090, 2082, 2095, 2096, 2080, 2091, 2092,
+    2088, 2081, 2097, 2083, 2094, 2087, 2085, 2093, 2099, 2105, 2098, 2102, 2104, 2103, 2100, 2101,
+    2160, 2159, 2157, 2165, 2158, 2156, 2163, 2154, 2162, 2161, 2164, 2155, 2133, 2134, 2132, 2130,
+    2128, 2127, 2129, 2131, 2143, 2142, 2136, 2139, 2140, 2138, 2144, 2137, 2135, 2145, 2141, 2146,
+    2147, 2125, 2126, 2122, 2123, 2124, 2121, 2149, 2153, 2150, 2151, 2148, 2152, 2120, 2119, 2118,
+    2117, 2116, 2114, 2115, 2112, 2113, 2111, 3214, 3072, 3073, 3077, 3075, 3076, 3074, 3079, 3078,
+    3080, 3184, 3154, 3157, 3155, 3158, 3164, 3160, 3161, 3162, 3163, 3159, 3156, 3131, 3129, 3130,
+    3128, 3081, 3085, 3083, 3082, 3084, 3103, 3106, 3105, 3104, 3086, 3089, 3088, 3087, 3145, 3151,
+    3146, 3147, 3152, 3149, 3148, 3150, 3093, 3091, 3090, 3092, 3132, 3142, 3139, 3133, 3144, 3141,
+    3143, 3137, 3135, 3134, 3136, 3138, 3140, 3165, 3167, 3172, 3166, 3170, 3169, 3171, 3168, 3112,
+    3116, 3115, 3114, 3110, 3108, 3113, 3111, 3109, 3153, 3127, 3185, 3102, 3187, 3188, 3183, 3107,
+    3189, 3186, 3094, 3100, 3097, 3099, 3095, 3101, 3098, 3096, 3181, 3117, 3124, 3120, 3123, 3122,
+    3126, 3121, 3119, 3118, 3125, 3173, 3180, 3178, 3176, 3175, 3177, 3174, 3179, 3182, 3217, 807,
+    798, 801, 804, 806, 803, 808, 799, 800, 805, 809, 802, 846, 851, 850, 852, 847,
+    854, 853, 848, 849, 902, 903, 901, 904, 906, 905, 830, 829, 832, 833, 835, 834,
+    831, 824, 820, 818, 827, 825, 822, 826, 821, 828, 823, 819, 885, 884, 881, 880,
+    883, 882, 886, 817, 812, 815, 810, 814, 816, 813, 811, 898, 897, 900, 894, 895,
+    899, 896, 866, 867, 862, 863, 864, 865, 868, 869, 879, 871, 874, 873, 877, 878,
+    875, 870, 872, 876, 838, 841, 845, 840, 842, 843, 844, 839, 836, 837, 859, 857,
+    860, 861, 858, 856, 855, 890, 891, 888, 893, 892, 889, 887, 1330, 1320, 1323, 1328,
+    1321, 1331, 1322, 1327, 1332, 1326, 1324, 1329, 1325, 1243, 1248, 1255, 1256, 1253, 1250, 1246,
+    1247, 1249, 1245, 1252, 1244, 1254, 1251, 1223, 1222, 1229, 1230, 1228, 1226, 1224, 1231, 1225,
+    1227, 1293, 1296, 1283, 1286, 1284, 1287, 1294, 1288, 1289, 1290, 1295, 1291, 1292, 1285, 1300,
+    1301, 1305, 1299, 1302, 1297, 1306, 1298, 1304, 1303, 1307, 1310, 1309, 1315, 1313, 1311, 1316,
+    1314, 1319, 1308, 1318, 1317, 1312, 1259, 1257, 1258, 1236, 1233, 1232, 1235, 1234, 1241, 1238,
+    1239, 1242, 1240, 1237, 1270, 1277, 1279, 1268, 1275, 1278, 1266, 1269, 1276, 1272, 1274, 1280,
+    1271, 1282, 1281, 1265, 1267, 1264, 1273, 1262, 1261, 1263, 1260, 119, 138, 128, 142, 133,
+    127, 141, 130, 124, 134, 135, 132, 125, 131, 140, 123, 122, 120, 121, 136, 126,
+    139, 137, 143, 129, 62, 63, 66, 60, 57, 61, 64, 65, 71, 68, 59, 58,
+    70, 67, 69, 200, 193, 198, 196, 191, 192, 190, 197, 194, 199, 195, 149, 148,
+    147, 154, 150, 152, 151, 144, 157, 158, 145, 146, 153, 159, 155, 160, 156, 169,
+    166, 162, 163, 171, 170, 172, 161, 165, 167, 168, 164, 178, 187, 182, 183, 185,
+    174, 176, 173, 189, 186, 179, 184, 180, 181, 175, 177, 188, 38, 43, 52, 51,
+    56, 37, 50, 55, 42, 36, 44, 48, 46, 34, 40, 45, 39, 49, 53, 54,
+    35, 47, 41, 75, 79, 74, 76, 78, 73, 72, 77, 203, 208, 209, 210, 204,
+    202, 206, 205, 212, 201, 211, 207, 99, 103, 116, 107, 104, 108, 117, 114, 109,
+    110, 113, 112, 111, 105, 100, 101, 118, 115, 102, 106, 82, 87, 83, 89, 84,
+    94, 88, 97, 98, 86, 90, 91, 85, 81, 80, 92, 95, 96, 93, 1596, 1601,
+    1600, 1599, 1597, 1602, 1598, 1627, 1631, 1633, 1634, 1629, 1637, 1632, 1628, 1636, 1635, 1630,
+    1610, 1606, 1603, 1605, 1613, 1604, 1614, 1607, 1615, 1611, 1612, 1608, 1616, 1609, 1638, 1642,
+    1646, 1639, 1640, 1643, 1645, 1641, 1644, 1648, 1647, 1617, 1625, 1622, 1623, 1618, 1620, 1626,
+    1621, 1619, 1624, 1537, 1544, 1538, 1541, 1536, 1545, 1539, 1542, 1543, 1540, 1527, 1531, 1530,
+    1525, 1526, 1535, 1529, 1528, 1534, 1533, 1532, 1508, 1507, 1499, 1505, 1504, 1503, 1506, 1501,
+    1502, 1500, 1552, 1555, 1554, 1563, 1559, 1561, 1560, 1557, 1556, 1553, 1558, 1564, 1562, 1523,
+    1524, 1514, 1516, 1521, 1519, 1517, 1518, 1520, 1522, 1509, 1515, 1513, 1512, 1510, 1511, 1660,
+    1595, 1593, 1591, 1590, 1594, 1592, 1576, 1577, 1579, 1581, 1578, 1582, 1580, 1567, 1570, 1571,
+    1575, 1569, 1572, 1574, 1573, 1565, 1566, 1568, 1585, 1588, 1587, 1583, 1586, 1589, 1584, 1491,
+    1487, 1493, 1488, 1494, 1492, 1496, 1497, 1498, 1489, 1495, 1486, 1490, 1652, 1653, 1659, 1654,
+    1657, 1656, 1655, 1651, 1658, 1649, 1650, 1548, 1550, 1551, 1549, 1546, 1547, 997, 1003, 1004,
+    1005, 1002, 1000, 998, 1001, 999, 1006, 991, 995, 993, 987, 992, 988, 994, 996, 990,
+    989, 945, 944, 947, 950, 951, 949, 948, 946, 930, 924, 927, 921, 929, 931, 923,
+    922, 928, 926, 925, 908, 909, 917, 915, 916, 920, 911, 907, 918, 910, 919, 913,
+    914, 912, 943, 938, 940, 937, 941, 936, 932, 942, 935, 939, 933, 934, 954, 953,
+    957, 955, 952, 956, 961, 964, 962, 960, 958, 963, 959, 983, 985, 986, 984, 982,
+    978, 979, 976, 981, 975, 977, 980, 973, 972, 971, 966, 968, 974, 969, 970, 967,
+    965, 2199, 2186, 2188, 2189, 2190, 2187, 2191, 2194, 2193, 2192, 2200, 2204, 2207, 2196, 2209,
+    2195, 2201, 2202, 2198, 2206, 2181, 2184, 2182, 2185, 2183, 2203, 2210, 2197, 2205, 2208, 1773,
+    1690, 1682, 1684, 1689, 1687, 1688, 1683, 1686, 1685, 1753, 1754, 1755, 1757, 1759, 1756, 1758,
+    1775, 1729, 1728, 1726, 1725, 1727, 1731, 1730, 1732, 1701, 1693, 1698, 1696, 1691, 1702, 1703,
+    1704, 1694, 1695, 1699, 1692, 1697, 1700, 1764, 1766, 1770, 1769, 1768, 1767, 1765, 1771, 1772,
+    1669, 1674, 1666, 1661, 1670, 1665, 1672, 1662, 1663, 1668, 1664, 1671, 1667, 1673, 1774, 1776,
+    1733, 1736, 1741, 1738, 1734, 1740, 1737, 1739, 1735, 1720, 1724, 1721, 1722, 1719, 1723, 1711,
+    1709, 1714, 1713, 1707, 1712, 1706, 1708, 1705, 1710, 1717, 1716, 1718, 1715, 1763, 1761, 1762,
+    1760, 1744, 1752, 1748, 1745, 1746, 1747, 1749, 1751, 1742, 1743, 1750, 1678, 1681, 1677, 1679,
+    1680, 1675, 1676, 1902, 1900, 1898, 1899, 1901, 1903, 1829, 1838, 1831, 1834, 1832, 1833, 1830,
+    1836, 1837, 1835, 1845, 1842, 1839, 1846, 1840, 1843, 1848, 1844, 1847, 1841, 1849, 1852, 1853,
+    1851, 1850, 1887, 1891, 1885, 1893, 1888, 1897, 1890, 1894, 1889, 1896, 1895, 1886, 1892, 1791,
+    1793, 1787, 1792, 1795, 1790, 1789, 1794, 1788, 1796, 1877, 1875, 1878, 1881, 1883, 1873, 1884,
+    1880, 1876, 1882, 1879, 1874, 1904, 1797, 1799, 1801, 1800, 1798, 1802, 1909, 1907, 1910, 1905,
+    1911, 1906, 1908, 1912, 1857, 1859, 1858, 1860, 1854, 1855, 1856, 1808, 1815, 1804, 1806, 1813,
+    1814, 1807, 1812, 1810, 1811, 1803, 1809, 1805, 1819, 1817, 1827, 1818, 1826, 1821, 1828, 1824,
+    1825, 1820, 1816, 1822, 1823, 1868, 1862, 1867, 1871, 1865, 1870, 1864, 1866, 1869, 1863, 1872,
+    1861, 1779, 1786, 1780, 1781, 1783, 1785, 1778, 1777, 1784, 1782, 3215, 2976, 2982, 2977, 2981,
+    2980, 2978, 2979, 2983, 2896, 2894, 2895, 2898, 2902, 2900, 2901, 2899, 2897, 2903, 2913, 2920,
+    2919, 2916, 2918, 2917, 2914, 2915, 2963, 2959, 2958, 2965, 2962, 2964, 2960, 2961, 2940, 2934,
+    2937, 2933, 2938, 2935, 2936, 2939, 2953, 2954, 2956, 2951, 2949, 2955, 2952, 2950, 2957, 2930,
+    2932, 2926, 2929, 2927, 2928, 2931, 2922, 2924, 2925, 2921, 2923, 2986, 2987, 2985, 2992, 2990,
+    2991, 2988, 2989, 2984, 2966, 2907, 2911, 2909, 2912, 2908, 2910, 2948, 2947, 2944, 2945, 2942,
+    2941, 2943, 2946, 2906, 2905, 2904, 2975, 2970, 2971, 2974, 2968, 2969, 2967, 2973, 2972, 1157,
+    1155, 1161, 1160, 1164, 1162, 1166, 1158, 1156, 1167, 1163, 1165, 1159, 1198, 1193, 1194, 1203,
+    1195, 1200, 1199, 1202, 1197, 1201, 1196, 1142, 1147, 1143, 1144, 1145, 1148, 1146, 1215, 1218,
+    1212, 1217, 1216, 1219, 1220, 1221, 1213, 1214, 1170, 1180, 1174, 1176, 1173, 1179, 1175, 1168,
+    1172, 1171, 1178, 1177, 1169, 1188, 1184, 1191, 1189, 1190, 1181, 1185, 1182, 1186, 1187, 1183,
+    1192, 1131, 1130, 1140, 1133, 1139, 1128, 1141, 1137, 1136, 1134, 1135, 1138, 1132, 1129, 1154,
+    1150, 1151, 1153, 1152, 1149, 1208, 1205, 1209, 1206, 1211, 1210, 1207, 1204, 3213, 2745, 2753,
+    2744, 2751, 2750, 2746, 2748, 2752, 2756, 2749, 2747, 2755, 2754, 2697, 2698, 2704, 2702, 2701,
+    2696, 2703, 2700, 2699, 2719, 2715, 2718, 2707, 2720, 2709, 2717, 2723, 2716, 2711, 2705, 2712,
+    2706, 2708, 2714, 2721, 2722, 2710, 2713, 2729, 2731, 2725, 2730, 2732, 2724, 2726, 2734, 2728,
+    2733, 2727, 2735, 2740, 2742, 2738, 2737, 2743, 2736, 2741, 2739, 2768, 2759, 2762, 2767, 2766,
+    2760, 2765, 2763, 2764, 2761, 2758, 2757, 2772, 2776, 2775, 2773, 2770, 2771, 2769, 2774, 2467,
+    2468, 2466, 2490, 2485, 2487, 2488, 2491, 2486, 2489, 2493, 2494, 2499, 2492, 2498, 2497, 2500,
+    2496, 2495, 2465, 2521, 2538, 2512, 2458, 2456, 2463, 2455, 2461, 2462, 2464, 2459, 2457, 2460,
+    2454, 2482, 2484, 2481, 2479, 2478, 2473, 2474, 2476, 2472, 2480, 2471, 2475, 2483, 2477, 2470,
+    2503, 2508, 2509, 2507, 2511, 2504, 2510, 2505, 2506, 2502, 2501, 2525, 2537, 2534, 2522, 2530,
+    2531, 2528, 2527, 2524, 2533, 2529, 2526, 2535, 2536, 2523, 2532, 2550, 2545, 2549, 2544, 2543,
+    2540, 2546, 2541, 2542, 2539, 2547, 2548, 2513, 2514, 2519, 2520, 2515, 2516, 2518, 2517, 2469,
+    3216, 509, 504, 505, 510, 508, 506, 507, 471, 470, 480, 475, 477, 473, 479, 474,
+    472, 476, 478, 489, 491, 494, 495, 490, 492, 496, 493, 555, 562, 561, 556, 560,
+    559, 558, 557, 501, 498, 500, 497, 502, 503, 499, 465, 457, 459, 467, 469, 464,
+    458, 456, 468, 463, 460, 462, 466, 461, 544, 543, 545, 546, 542, 525, 524, 520,
+    523, 519, 521, 522, 569, 566, 568, 567, 563, 564, 565, 539, 537, 538, 536, 541,
+    535, 534, 540, 547, 554, 552, 549, 551, 553, 550, 548, 516, 513, 517, 518, 512,
+    514, 511, 515, 526, 529, 533, 528, 527, 530, 531, 532, 485, 486, 487, 488, 484,
+    482, 483, 481, 2211, 2239, 2217, 2242, 2219, 2218, 2229, 2227, 2240, 2238, 2214, 2221, 2243,
+    2244, 2245, 2223, 2234, 2249, 2241, 2235, 2236, 2228, 2215, 2226, 2216, 2212, 2213, 2222, 2232,
+    2230, 2246, 2247, 2220, 2233, 2248, 2237, 2231, 2225, 2224, 2813, 2815, 2822, 2809, 2823, 2819,
+    2811, 2821, 2817, 2814, 2820, 2812, 2816, 2810, 2818, 2889, 2890, 2887, 2886, 2891, 2893, 2888,
+    2892, 2879, 2875, 2881, 2882, 2884, 2876, 2877, 2885, 2878, 2880, 2883, 2807, 2800, 2805, 2808,
+    2796, 2801, 2802, 2797, 2803, 2798, 2804, 2799, 2806, 2843, 2841, 2838, 2847, 2837, 2845, 2836,
+    2840, 2839, 2842, 2846, 2844, 2849, 2848, 2870, 2871, 2873, 2867, 2865, 2862, 2863, 2864, 2872,
+    2874, 2869, 2868, 2866, 2861, 2856, 2852, 2853, 2857, 2850, 2851, 2854, 2860, 2858, 2855, 2859,
+    2825, 2826, 2835, 2829, 2828, 2833, 2824, 2827, 2830, 2832, 2831, 2834, 2785, 2790, 2778, 2782,
+    2781, 2779, 2780, 2789, 2777, 2788, 2786, 2784, 2783, 2787, 2793, 2795, 2792, 2794, 2791, 3029,
+    3024, 3030, 3025, 3026, 3027, 3028, 3002, 3005, 3006, 3003, 3007, 3004, 3001, 3012, 3008, 3011,
+    3010, 3009, 3019, 3022, 3020, 3018, 3023, 3021, 3042, 3044, 3040, 3039, 3038, 3041, 3031, 3036,
+    3037, 3033, 3035, 3032, 3034, 2994, 2995, 2997, 2996, 2998, 2999, 3000, 2993, 3014, 3015, 3017,
+    3016, 3013, 3043, 3211, 742, 746, 743, 744, 745, 713, 728, 726, 723, 722, 714, 715,
+    716, 729, 725, 719, 724, 727, 720, 718, 717, 721, 730, 734, 731, 733, 739, 732,
+    740, 741, 736, 737, 738, 735, 700, 694, 697, 698, 701, 695, 696, 699, 702, 657,
+    649, 641, 648, 646, 639, 651, 656, 652, 643, 655, 650, 653, 644, 654, 642, 640,
+    647, 645, 778, 779, 780, 776, 777, 708, 703, 712, 711, 707, 709, 710, 704, 706,
+    705, 757, 748, 755, 752, 754, 750, 747, 756, 753, 751, 749, 768, 766, 773, 770,
+    771, 767, 775, 765, 772, 774, 769, 680, 684, 677, 679, 678, 683, 682, 676, 675,
+    681, 690, 689, 691, 688, 686, 687, 693, 692, 685, 764, 763, 760, 762, 759, 761,
+    758, 667, 672, 671, 663, 670, 660, 673, 662, 665, 668, 669, 664, 674, 661, 658,
+    666, 659,
+};
+
+constexpr uint16_t kCityByAdmin[] = {
+    781, 791, 796, 790, 797, 783, 786, 788, 794, 792, 787, 793, 784, 789, 795, 785,
+    782, 2621, 2622, 2624, 2623, 2627, 2625, 2629, 2628, 2626, 2604, 2608, 2605, 2609, 2607, 2606,
+    2586, 2588, 2590, 2591, 2587, 2589, 2668, 2677, 2679, 2674, 2669, 2672, 2675, 2673, 2676, 2678,
+    2670, 2671, 2680, 2681, 2684, 2682, 2685, 2683, 2686, 2687, 2691, 2688, 2689, 2690, 2655, 2661,
+    2663, 2662, 2656, 2657, 2658, 2660, 2659, 2551, 2556, 2552, 2557, 2565, 2554, 2560, 2559, 2564,
+    2562, 2558, 2553, 2561, 2563, 2555, 2592, 2597, 2602, 2595, 2601, 2593, 2603, 2598, 2596, 2599,
+    2600, 2594, 2610, 2613, 2618, 2612, 2611, 2614, 2615, 2617, 2619, 2620, 2616, 2566, 2574, 2575,
+    2573, 2571, 2568, 2572, 2570, 2569, 2567, 2630, 2638, 2634, 2632, 2636, 2635, 2631, 2639, 2637,
+    2633, 2640, 2576, 2585, 2581, 2583, 2584, 2582, 2578, 2579, 2577, 2580, 2641, 2642, 2650, 2646,
+    2647, 2643, 2645, 2654, 2649, 2648, 2651, 2653, 2644, 2652, 2664, 2666, 2667, 2665, 2692, 2694,
+    2695, 2693, 420, 431, 425, 426, 423, 422, 424, 430, 428, 427, 429, 421, 361, 364,
+    362, 363, 432, 433, 437, 436, 435, 438, 434, 351, 352, 357, 359, 358, 353, 356,
+    355, 360, 354, 397, 409, 399, 406, 405, 411, 398, 407, 408, 401, 402, 403, 400,
+    404, 410, 341, 348, 343, 346, 347, 342, 350, 349, 344, 345, 412, 413, 417, 416,
+    418, 414, 419, 415, 365, 367, 373, 375, 376, 371, 370, 377, 368, 372, 366, 374,
+    369, 378, 384, 383, 382, 385, 379, 380, 381, 386, 387, 388, 395, 396, 391, 389,
+    394, 390, 392, 393, 439, 445, 440, 451, 447, 450, 449, 444, 443, 446, 441, 448,
+    442, 452, 454, 453, 455, 0, 1, 4, 12, 15, 14, 16, 13, 8, 11, 3,
+    6, 5, 2, 9, 7, 10, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206,
+    3207, 3208, 3209, 3210, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 581, 585, 582, 588, 586,
+    590, 589, 584, 587, 583, 591, 595, 596, 597, 594, 593, 592, 630, 636, 632, 638,
+    631, 633, 637, 634, 635, 618, 622, 620, 619, 623, 621, 624, 629, 625, 628, 627,
+    626, 611, 617, 614, 613, 612, 616, 615, 598, 601, 602, 600, 599, 603, 604, 605,
+    608, 609, 607, 606, 610, 570, 577, 574, 578, 571, 576, 572, 580, 573, 579, 575,
+    2329, 2332, 2335, 2336, 2340, 2338, 2330, 2337, 2331, 2334, 2333, 2339, 2323, 2325, 2326, 2324,
+    2327, 2328, 2436, 2442, 2441, 2449, 2448, 2443, 2445, 2440, 2447, 2444, 2438, 2451, 2439, 2452,
+    2437, 2450, 2446, 2453, 2341, 2348, 2345, 2344, 2346, 2347, 2349, 2350, 2342, 2343, 2358, 2367,
+    2360, 2361, 2368, 2362, 2365, 2366, 2359, 2363, 2364, 2393, 2397, 2394, 2398, 2395, 2396, 2309,
+    2310, 2315, 2313, 2311, 2312, 2316, 2314, 2369, 2371, 2375, 2372, 2370, 2373, 2374, 2292, 2295,
+    2297, 2296, 2293, 2298, 2294, 2250, 2260, 2263, 2269, 2267, 2255, 2265, 2258, 2254, 2259, 2270,
+    2264, 2268, 2261, 2266, 2262, 2253, 2251, 2257, 2252, 2256, 2278, 2279, 2281, 2283, 2282, 2280,
+    2284, 2290, 2291, 2289, 2285, 2288, 2286, 2287, 2417, 2420, 2421, 2433, 2432, 2418, 2435, 2427,
+    2426, 2419, 2424, 2431, 2425, 2428, 2429, 2434, 2430, 2423, 2422, 2351, 2352, 2356, 2354, 2353,
+    2355, 2357, 2299, 2303, 2306, 2302, 2307, 2305, 2308, 2300, 2301, 2304, 2271, 2274, 2277, 2275,
+    2272, 2276, 2273, 2399, 2402, 2401, 2400, 2376, 2383, 2381, 2379, 2380, 2382, 2378, 2377, 2317,
+    2322, 2319, 2321, 2318, 2320, 2403, 2409, 2413, 2411, 2408, 2405, 2406, 2416, 2415, 2407, 2410,
+    2414, 2404, 2412, 2384, 2386, 2390, 2392, 2388, 2389, 2391, 2387, 2385, 17, 24, 27, 21,
+    18, 31, 29, 28, 19, 22, 20, 26, 30, 23, 33, 25, 32, 3068, 3070, 3069,
+    3071, 3056, 3057, 3060, 3059, 3058, 3061, 3062, 3063, 3067, 3066, 3064, 3065, 3052, 3053, 3055,
+    3054, 3045, 3046, 3049, 3051, 3047, 3050, 3048, 1110, 1114, 1112, 1113, 1111, 1102, 1105, 1107,
+    1104, 1103, 1108, 1109, 1106, 1007, 1011, 1016, 1015, 1009, 1008, 1013, 1014, 1010, 1012, 1059,
+    1061, 1065, 1062, 1066, 1068, 1063, 1067, 1069, 1064, 1060, 1120, 1127, 1121, 1123, 1126, 1124,
+    1125, 1122, 1096, 1097, 1101, 1100, 1098, 1099, 1115, 1117, 1118, 1116, 1119, 1049, 1050, 1053,
+    1052, 1051, 1034, 1038, 1040, 1035, 1041, 1039, 1036, 1037, 1078, 1082, 1084, 1080, 1085, 1083,
+    1086, 1081, 1079, 1017, 1021, 1024, 1019, 1025, 1023, 1022, 1018, 1020, 1026, 1032, 1033, 1031,
+    1030, 1029, 1028, 1027, 1054, 1056, 1058, 1057, 1055, 1087, 1091, 1092, 1095, 1093, 1094, 1089,
+    1088, 1090, 1042, 1045, 1047, 1048, 1046, 1043, 1044, 1070, 1075, 1071, 1073, 1074, 1077, 1072,
+    1076, 1373, 1374, 1377, 1376, 1378, 1375, 1434, 1446, 1435, 1441, 1443, 1438, 1440, 1437, 1436,
+    1444, 1445, 1442, 1439, 1424, 1428, 1426, 1425, 1427, 1447, 1452, 1457, 1455, 1450, 1454, 1451,
+    1448, 1456, 1458, 1449, 1453, 1429, 1430, 1432, 1431, 1433, 1366, 1370, 1371, 1369, 1367, 1372,
+    1368, 1417, 1421, 1420, 1419, 1422, 1418, 1423, 1333, 1334, 1338, 1345, 1337, 1335, 1344, 1336,
+    1341, 1340, 1342, 1343, 1339, 1405, 1406, 1407, 1411, 1408, 1415, 1414, 1412, 1413, 1416, 1410,
+    1409, 1357, 1361, 1360, 1362, 1359, 1363, 1365, 1358, 1364, 1468, 1474, 1471, 1473, 1470, 1469,
+    1475, 1472, 1392, 1397, 1395, 1396, 1402, 1394, 1401, 1398, 1404, 1393, 1400, 1399, 1403, 1379,
+    1389, 1390, 1391, 1382, 1381, 1380, 1383, 1387, 1386, 1388, 1384, 1385, 1459, 1460, 1464, 1467,
+    1465, 1463, 1462, 1461, 1466, 1476, 1485, 1480, 1478, 1482, 1481, 1479, 1477, 1483, 1484, 1346,
+    1353, 1352, 1350, 1348, 1347, 1355, 1351, 1354, 1356, 1349, 309, 319, 325, 315, 318, 320,
+    316, 310, 311, 322, 324, 314, 317, 312, 323, 313, 321, 326, 327, 337, 332, 338,
+    330, 331, 339, 335, 329, 336, 333, 340, 334, 328, 224, 227, 228, 230, 234, 226,
+    231, 225, 233, 232, 229, 213, 218, 223, 222, 214, 217, 219, 216, 220, 215, 221,
+    294, 297, 303, 298, 306, 307, 308, 300, 296, 304, 295, 305, 302, 299, 301, 268,
+    279, 272, 275, 274, 271, 277, 273, 269, 270, 278, 276, 254, 255, 256, 259, 257,
+    258, 260, 261, 266, 264, 263, 265, 267, 262, 280, 283, 282, 288, 289, 290, 286,
+    292, 293, 281, 285, 287, 291, 284, 241, 243, 249, 244, 247, 251, 252, 253, 245,
+    242, 246, 250, 248, 235, 236, 239, 240, 237, 238, 2039, 2037, 2038, 2050, 2051, 2052,
+    2053, 2055, 2054, 1958, 1962, 1960, 1959, 1961, 1963, 1913, 1923, 1922, 1924, 1917, 1916, 1920,
+    1918, 1921, 1914, 1915, 1919, 1997, 2000, 2001, 1998, 1999, 2002, 2044, 2048, 2046, 2047, 2049,
+    2045, 2003, 2007, 2008, 2011, 2006, 2009, 2005, 2004, 2010, 1950, 1957, 1955, 1954, 1956, 1953,
+    1952, 1951, 2012, 2013, 2015, 2014, 1964, 1968, 1969, 1971, 1967, 1966, 1965, 1970, 2016, 2022,
+    2021, 2017, 2018, 2020, 2019, 1936, 1945, 1939, 1944, 1940, 1942, 1938, 1937, 1943, 1941, 2028,
+    2031, 2029, 2030, 2035, 2034, 2033, 2036, 2032, 1972, 1981, 1975, 1979, 1978, 1973, 1977, 1980,
+    1974, 1976, 2040, 2041, 2042, 2043, 1946, 1948, 1949, 1947, 1988, 1996, 1994, 1992, 1995, 1993,
+    1989, 1991, 1990, 1982, 1987, 1986, 1984, 1983, 1985, 2023, 2024, 2025, 2027, 2026, 1925, 1934,
+    1932, 1930, 1935, 1929, 1933, 1928, 1926, 1927, 1931, 2106, 2110, 2107, 2109, 2108, 2056, 2066,
+    2057, 2067, 2068, 2063, 2059, 2061, 2060, 2062, 2064, 2058, 2065, 2173, 2180, 2178, 2179, 2176,
+    2175, 2174, 2177, 2166, 2167, 2172, 2168, 2170, 2169, 2171, 2069, 2079, 2070, 2073, 2072, 2075,
+    2074, 2077, 2078, 2071, 2076, 2080, 2084, 2086, 2089, 2090, 2082, 2095, 2096, 2091, 2092, 2088,
+    2081, 2097, 2083, 2094, 2087, 2085, 2093, 2098, 2099, 2105, 2102, 2104, 2103, 2100, 2101, 2154,
+    2160, 2159, 2157, 2165, 2158, 2156, 2163, 2162, 2161, 2164, 2155, 2127, 2133, 2134, 2132, 2130,
+    2128, 2129, 2131, 2135, 2143, 2142, 2136, 2139, 2140, 2138, 2144, 2137, 2145, 2141, 2146, 2147,
+    2121, 2125, 2126, 2122, 2123, 2124, 2148, 2149, 2153, 2150, 2151, 2152, 2116, 2120, 2119, 2118,
+    2117, 2111, 2114, 2115, 2112, 2113, 3072, 3080, 3073, 3077, 3075, 3076, 3074, 3079, 3078, 3184,
+    3153, 3157, 3154, 3155, 3158, 3164, 3160, 3161, 3162, 3163, 3159, 3156, 3127, 3131, 3129, 3130,
+    3128, 3081, 3085, 3083, 3082, 3084, 3185, 3102, 3103, 3106, 3105, 3104, 3187, 3188, 3086, 3089,
+    3088, 3087, 3145, 3151, 3146, 3147, 3152, 3149, 3148, 3150, 3090, 3093, 3091, 3092, 3132, 3142,
+    3139, 3133, 3144, 3141, 3143, 3137, 3135, 3134, 3136, 3138, 3140, 3183, 3165, 3167, 3172, 3166,
+    3170, 3169, 3171, 3168, 3107, 3112, 3116, 3115, 3114, 3110, 3108, 3113, 3111, 3109, 3189, 3094,
+    3100, 3097, 3099, 3095, 3101, 3098, 3096, 3181, 3186, 3117, 3124, 3120, 3123, 3122, 3126, 3121,
+    3119, 3118, 3125, 3173, 3180, 3178, 3176, 3175, 3177, 3174, 3179, 3182, 798, 807, 801, 804,
+    806, 803, 808, 799, 800, 805, 809, 802, 846, 851, 850, 852, 847, 854, 853, 848,
+    849, 901, 902, 903, 904, 906, 905, 829, 830, 832, 833, 835, 834, 831, 818, 824,
+    820, 827, 825, 822, 826, 821, 828, 823, 819, 880, 885, 884, 881, 883, 882, 886,
+    810, 817, 812, 815, 814, 816, 813, 811, 894, 898, 897, 900, 895, 899, 896, 862,
+    866, 867, 863, 864, 865, 868, 869, 870, 879, 871, 874, 873, 877, 878, 875, 872,
+    876, 836, 838, 841, 845, 840, 842, 843, 844, 839, 837, 855, 859, 857, 860, 861,
+    858, 856, 887, 890, 891, 888, 893, 892, 889, 1320, 1330, 1323, 1328, 1321, 1331, 1322,
+    1327, 1332, 1326, 1324, 1329, 1325, 1243, 1248, 1255, 1256, 1253, 1250, 1246, 1247, 1249, 1245,
+    1252, 1244, 1254, 1251, 1222, 1223, 1229, 1230, 1228, 1226, 1224, 1231, 1225, 1227, 1283, 1293,
+    1296, 1286, 1284, 1287, 1294, 1288, 1289, 1290, 1295, 1291, 1292, 1285, 1297, 1300, 1301, 1305,
+    1299, 1302, 1306, 1298, 1304, 1303, 1307, 1308, 1310, 1309, 1315, 1313, 1311, 1316, 1314, 1319,
+    1318, 1317, 1312, 1257, 1259, 1258, 1232, 1236, 1233, 1235, 1234, 1237, 1241, 1238, 1239, 1242,
+    1240, 1264, 1270, 1277, 1279, 1268, 1275, 1278, 1266, 1269, 1276, 1272, 1274, 1280, 1271, 1282,
+    1281, 1265, 1267, 1273, 1260, 1262, 1261, 1263, 119, 138, 128, 142, 133, 127, 141, 130,
+    124, 134, 135, 132, 125, 131, 140, 123, 122, 120, 121, 136, 126, 139, 137, 143,
+    129, 57, 62, 63, 66, 60, 61, 64, 65, 71, 68, 59, 58, 70, 67, 69,
+    190, 200, 193, 198, 196, 191, 192, 197, 194, 199, 195, 144, 149, 148, 147, 154,
+    150, 152, 151, 157, 158, 145, 146, 153, 159, 155, 160, 156, 161, 169, 166, 162,
+    163, 171, 170, 172, 165, 167, 168, 164, 173, 178, 187, 182, 183, 185, 174, 176,
+    189, 186, 179, 184, 180, 181, 175, 177, 188, 34, 43, 38, 52, 51, 56, 37,
+    50, 55, 42, 36, 44, 48, 46, 40, 45, 39, 49, 53, 54, 35, 47, 41,
+    72, 75, 79, 74, 76, 78, 73, 77, 201, 203, 208, 209, 210, 204, 202, 206,
+    205, 212, 211, 207, 99, 103, 116, 107, 104, 108, 117, 114, 109, 110, 113, 112,
+    111, 105, 100, 101, 118, 115, 102, 106, 80, 82, 87, 83, 89, 84, 94, 88,
+    97, 98, 86, 90, 91, 85, 81, 92, 95, 96, 93, 1596, 1601, 1600, 1599, 1597,
+    1602, 1598, 1627, 1631, 1633, 1634, 1629, 1637, 1632, 1628, 1636, 1635, 1630, 1603, 1610, 1606,
+    1605, 1613, 1604, 1614, 1607, 1615, 1611, 1612, 1608, 1616, 1609, 1638, 1642, 1646, 1639, 1640,
+    1643, 1645, 1641, 1644, 1648, 1647, 1617, 1625, 1622, 1623, 1618, 1620, 1626, 1621, 1619, 1624,
+    1537, 1544, 1538, 1541, 1536, 1545, 1539, 1542, 1543, 1540, 1525, 1527, 1531, 1530, 1526, 1535,
+    1529, 1528, 1534, 1533, 1532, 1499, 1508, 1507, 1505, 1504, 1503, 1506, 1501, 1502, 1500, 1552,
+    1555, 1554, 1563, 1559, 1561, 1560, 1557, 1556, 1553, 1558, 1564, 1562, 1509, 1523, 1524, 1514,
+    1516, 1521, 1519, 1517, 1518, 1520, 1522, 1515, 1513, 1512, 1510, 1511, 1660, 1590, 1595, 1593,
+    1591, 1594, 1592, 1576, 1577, 1579, 1581, 1578, 1582, 1580, 1565, 1567, 1570, 1571, 1575, 1569,
+    1572, 1574, 1573, 1566, 1568, 1583, 1585, 1588, 1587, 1586, 1589, 1584, 1486, 1491, 1487, 1493,
+    1488, 1494, 1492, 1496, 1497, 1498, 1489, 1495, 1490, 1649, 1652, 1653, 1659, 1654, 1657, 1656,
+    1655, 1651, 1658, 1650, 1546, 1548, 1550, 1551, 1549, 1547, 997, 1003, 1004, 1005, 1002, 1000,
+    998, 1001, 999, 1006, 987, 991, 995, 993, 992, 988, 994, 996, 990, 989, 944, 945,
+    947, 950, 951, 949, 948, 946, 921, 930, 924, 927, 929, 931, 923, 922, 928, 926,
+    925, 907, 908, 909, 917, 915, 916, 920, 911, 918, 910, 919, 913, 914, 912, 932,
+    943, 938, 940, 937, 941, 936, 942, 935, 939, 933, 934, 952, 954, 953, 957, 955,
+    956, 958, 961, 964, 962, 960, 963, 959, 982, 983, 985, 986, 984, 975, 978, 979,
+    976, 981, 977, 980, 965, 973, 972, 971, 966, 968, 974, 969, 970, 967, 2199, 2186,
+    2188, 2189, 2190, 2187, 2191, 2194, 2193, 2192, 2200, 2204, 2207, 2196, 2209, 2195, 2201, 2202,
+    2198, 2206, 2181, 2184, 2182, 2185, 2183, 2203, 2210, 2197, 2205, 2208, 1773, 1682, 1690, 1684,
+    1689, 1687, 1688, 1683, 1686, 1685, 1753, 1754, 1755, 1757, 1759, 1756, 1758, 1775, 1725, 1729,
+    1728, 1726, 1727, 1731, 1730, 1732, 1691, 1701, 1693, 1698, 1696, 1702, 1703, 1704, 1694, 1695,
+    1699, 1692, 1697, 1700, 1764, 1766, 1770, 1769, 1768, 1767, 1765, 1771, 1772, 1661, 1669, 1674,
+    1666, 1670, 1665, 1672, 1662, 1663, 1668, 1664, 1671, 1667, 1673, 1774, 1776, 1733, 1736, 1741,
+    1738, 1734, 1740, 1737, 1739, 1735, 1719, 1720, 1724, 1721, 1722, 1723, 1705, 1711, 1709, 1714,
+    1713, 1707, 1712, 1706, 1708, 1710, 1715, 1717, 1716, 1718, 1760, 1763, 1761, 1762, 1742, 1744,
+    1752, 1748, 1745, 1746, 1747, 1749, 1751, 1743, 1750, 1675, 1678, 1681, 1677, 1679, 1680, 1676,
+    1898, 1902, 1900, 1899, 1901, 1903, 1829, 1838, 1831, 1834, 1832, 1833, 1830, 1836, 1837, 1835,
+    1839, 1845, 1842, 1846, 1840, 1843, 1848, 1844, 1847, 1841, 1849, 1852, 1853, 1851, 1850, 1885,
+    1887, 1891, 1893, 1888, 1897, 1890, 1894, 1889, 1896, 1895, 1886, 1892, 1787, 1791, 1793, 1792,
+    1795, 1790, 1789, 1794, 1788, 1796, 1873, 1877, 1875, 1878, 1881, 1883, 1884, 1880, 1876, 1882,
+    1879, 1874, 1797, 1799, 1801, 1800, 1798, 1802, 1904, 1909, 1907, 1910, 1905, 1911, 1906, 1908,
+    1912, 1854, 1857, 1859, 1858, 1860, 1855, 1856, 1803, 1808, 1815, 1804, 1806, 1813, 1814, 1807,
+    1812, 1810, 1811, 1809, 1805, 1816, 1819, 1817, 1827, 1818, 1826, 1821, 1828, 1824, 1825, 1820,
+    1822, 1823, 1861, 1868, 1862, 1867, 1871, 1865, 1870, 1864, 1866, 1869, 1863, 1872, 1777, 1779,
+    1786, 1780, 1781, 1783, 1785, 1778, 1784, 1782, 3215, 3216, 3217, 2976, 2982, 2977, 2981, 2980,
+    2978, 2979, 2983, 2894, 2896, 2895, 2898, 2902, 2900, 2901, 2899, 2897, 2903, 2913, 2920, 2919,
+    2916, 2918, 2917, 2914, 2915, 2958, 2963, 2959, 2965, 2962, 2964, 2960, 2961, 2933, 2940, 2934,
+    2937, 2938, 2935, 2936, 2939, 2949, 2953, 2954, 2956, 2951, 2955, 2952, 2950, 2957, 2926, 2930,
+    2932, 2929, 2927, 2928, 2931, 2921, 2922, 2924, 2925, 2923, 2984, 2986, 2987, 2985, 2992, 2990,
+    2991, 2988, 2989, 2907, 2911, 2909, 2912, 2908, 2910, 2941, 2948, 2947, 2944, 2945, 2942, 2943,
+    2946, 2904, 2906, 2905, 2966, 2975, 2970, 2971, 2974, 2968, 2969, 2967, 2973, 2972, 1155, 1157,
+    1161, 1160, 1164, 1162, 1166, 1158, 1156, 1167, 1163, 1165, 1159, 1193, 1198, 1194, 1203, 1195,
+    1200, 1199, 1202, 1197, 1201, 1196, 1142, 1147, 1143, 1144, 1145, 1148, 1146, 1212, 1215, 1218,
+    1217, 1216, 1219, 1220, 1221, 1213, 1214, 1168, 1170, 1180, 1174, 1176, 1173, 1179, 1175, 1172,
+    1171, 1178, 1177, 1169, 1181, 1188, 1184, 1191, 1189, 1190, 1185, 1182, 1186, 1187, 1183, 1192,
+    1128, 1131, 1130, 1140, 1133, 1139, 1141, 1137, 1136, 1134, 1135, 1138, 1132, 1129, 1149, 1154,
+    1150, 1151, 1153, 1152, 1204, 1208, 1205, 1209, 1206, 1211, 1210, 1207, 2744, 2745, 2753, 2746,
+    2751, 2750, 2748, 2752, 2756, 2749, 2747, 2755, 2754, 2696, 2697, 2698, 2704, 2702, 2701, 2703,
+    2700, 2699, 2705, 2719, 2715, 2718, 2707, 2720, 2709, 2717, 2723, 2716, 2711, 2712, 2706, 2708,
+    2714, 2721, 2722, 2710, 2713, 2724, 2729, 2731, 2725, 2730, 2732, 2726, 2734, 2728, 2733, 2727,
+    2735, 2736, 2740, 2742, 2738, 2737, 2743, 2741, 2739, 2757, 2768, 2759, 2762, 2767, 2766, 2760,
+    2765, 2763, 2764, 2761, 2758, 2769, 2772, 2776, 2775, 2773, 2770, 2771, 2774, 2465, 2467, 2468,
+    2469, 2466, 2485, 2490, 2487, 2488, 2491, 2486, 2489, 2492, 2493, 2494, 2499, 2498, 2497, 2500,
+    2496, 2495, 2454, 2458, 2456, 2463, 2455, 2461, 2462, 2464, 2459, 2457, 2460, 2470, 2482, 2484,
+    2481, 2479, 2478, 2473, 2474, 2476, 2472, 2480, 2471, 2475, 2483, 2477, 2501, 2503, 2508, 2509,
+    2507, 2511, 2504, 2510, 2505, 2506, 2502, 2521, 2525, 2537, 2534, 2522, 2530, 2531, 2528, 2527,
+    2524, 2533, 2529, 2526, 2535, 2536, 2523, 2532, 2538, 2550, 2545, 2549, 2544, 2543, 2540, 2546,
+    2541, 2542, 2539, 2547, 2548, 2512, 2513, 2514, 2519, 2520, 2515, 2516, 2518, 2517, 504, 509,
+    505, 510, 508, 506, 507, 470, 471, 480, 475, 477, 473, 479, 474, 472, 476, 478,
+    489, 491, 494, 495, 490, 492, 496, 493, 555, 562, 561, 556, 560, 559, 558, 557,
+    497, 501, 498, 500, 502, 503, 499, 456, 465, 457, 459, 467, 469, 464, 458, 468,
+    463, 460, 462, 466, 461, 542, 544, 543, 545, 546, 519, 525, 524, 520, 523, 521,
+    522, 563, 569, 566, 568, 567, 564, 565, 534, 539, 537, 538, 536, 541, 535, 540,
+    547, 554, 552, 549, 551, 553, 550, 548, 511, 516, 513, 517, 518, 512, 514, 515,
+    526, 529, 533, 528, 527, 530, 531, 532, 481, 485, 486, 487, 488, 484, 482, 483,
+    2237, 2211, 2239, 2217, 2242, 2219, 2218, 2229, 2227, 2240, 2238, 2214, 2221, 2243, 2244, 2245,
+    2223, 2234, 2249, 2241, 2235, 2236, 2228, 2215, 2226, 2216, 2212, 2213, 2222, 2232, 2230, 2246,
+    2247, 2220, 2233, 2248, 2231, 2225, 2224, 2809, 2813, 2815, 2822, 2823, 2819, 2811, 2821, 2817,
+    2814, 2820, 2812, 2816, 2810, 2818, 2886, 2889, 2890, 2887, 2891, 2893, 2888, 2892, 2875, 2879,
+    2881, 2882, 2884, 2876, 2877, 2885, 2878, 2880, 2883, 2796, 2807, 2800, 2805, 2808, 2801, 2802,
+    2797, 2803, 2798, 2804, 2799, 2806, 2836, 2843, 2841, 2838, 2847, 2837, 2845, 2840, 2839, 2842,
+    2846, 2844, 2849, 2848, 2862, 2870, 2871, 2873, 2867, 2865, 2863, 2864, 2872, 2874, 2869, 2868,
+    2866, 2850, 2861, 2856, 2852, 2853, 2857, 2851, 2854, 2860, 2858, 2855, 2859, 2824, 2825, 2826,
+    2835, 2829, 2828, 2833, 2827, 2830, 2832, 2831, 2834, 2777, 2785, 2790, 2778, 2782, 2781, 2779,
+    2780, 2789, 2788, 2786, 2784, 2783, 2787, 2791, 2793, 2795, 2792, 2794, 3024, 3029, 3030, 3025,
+    3026, 3027, 3028, 3001, 3002, 3005, 3006, 3003, 3007, 3004, 3008, 3012, 3011, 3010, 3009, 3018,
+    3019, 3022, 3020, 3023, 3021, 3038, 3042, 3044, 3040, 3039, 3041, 3043, 3031, 3036, 3037, 3033,
+    3035, 3032, 3034, 2993, 2994, 2995, 2997, 2996, 2998, 2999, 3000, 3013, 3014, 3015, 3017, 3016,
+    3211, 3212, 3213, 3214, 742, 746, 743, 744, 745, 713, 728, 726, 723, 722, 714, 715,
+    716, 729, 725, 719, 724, 727, 720, 718, 717, 721, 730, 731, 734, 733, 739, 732,
+    740, 741, 736, 737, 738, 735, 694, 700, 697, 698, 701, 695, 696, 699, 702, 639,
+    657, 649, 641, 648, 646, 651, 656, 652, 643, 655, 650, 653, 644, 654, 642, 640,
+    647, 645, 776, 778, 779, 780, 777, 703, 708, 712, 711, 707, 709, 710, 704, 706,
+    705, 747, 757, 748, 755, 752, 754, 750, 756, 753, 751, 749, 765, 768, 766, 773,
+    770, 771, 767, 775, 772, 774, 769, 675, 680, 684, 677, 679, 678, 683, 682, 676,
+    681, 685, 690, 689, 691, 688, 686, 687, 693, 692, 758, 764, 763, 760, 762, 759,
+    761, 658, 667, 672, 671, 663, 670, 660, 673, 662, 665, 668, 669, 664, 674, 661,
+    666, 659,
+};
+
+constexpr uint16_t kCityByPinyin[] = {
+    2403, 2414, 442, 647, 434, 3130, 759, 750, 2946, 3117, 3118, 3129, 3182, 3104, 452, 3173,
+    3174, 2769, 369, 191, 773, 2959, 2762, 1294, 662, 2712, 142, 1859, 957, 2319, 2875, 1315,
+    2520, 1731, 2565, 2898, 208, 1059, 1402, 1871, 2838, 481, 2485, 638, 1174, 2302, 1842, 133,
+    1537, 1541, 1230, 1238, 1272, 2401, 316, 377, 400, 3128, 3125, 454, 453, 2149, 3143, 1768,
+    1038, 624, 3123, 2885, 3084, 2714, 673, 2135, 2205, 611, 2832, 535, 105, 2907, 2908, 2428,
+    1918, 2459, 356, 3092, 371, 370, 2163, 2223, 2765, 1028, 3026, 1940, 306, 29, 119, 1530,
+    1011, 2796, 1909, 1711, 701, 698, 790, 2586, 2837, 2209, 351, 2392, 884, 2781, 2766, 2731,
+    2432, 652, 412, 2737, 3107, 522, 2393, 199, 2394, 763, 2219, 27, 2306, 75, 1538, 2106,
+    1862, 0, 766, 2779, 2134, 924, 561, 1819, 3185, 518, 1026, 497, 502, 2735, 2502, 2492,
+    1469, 2672, 875, 30, 813, 913, 651, 2823, 2067, 1468, 2760, 2230, 1656, 1571, 2132, 3102,
+    3116, 3103, 746, 2000, 2741, 1360, 186, 1045, 1474, 138, 1110, 2473, 3175, 3172, 2445, 1671,
+    939, 1131, 2102, 2316, 176, 2629, 173, 64, 1479, 2519, 3150, 2527, 2105, 3158, 1246, 1794,
+    1959, 35, 2786, 616, 570, 1384, 1839, 2724, 1012, 1589, 478, 3094, 3095, 1233, 2206, 1134,
+    1398, 78, 621, 784, 1815, 2363, 2590, 11, 1339, 1777, 978, 1784, 2225, 842, 2547, 1187,
+    1207, 552, 2818, 956, 1700, 582, 1404, 1562, 241, 829, 2100, 1512, 2042, 1016, 1955, 2312,
+    3, 555, 558, 573, 1954, 2040, 2730, 429, 427, 428, 2742, 2799, 3034, 88, 2997, 1827,
+    2830, 161, 165, 2994, 2250, 2557, 2853, 2697, 2895, 1956, 2255, 2579, 2238, 2203, 1481, 2996,
+    2968, 1150, 1352, 2070, 2995, 680, 404, 1889, 1861, 1759, 160, 365, 1973, 1463, 2483, 1115,
+    847, 150, 797, 2237, 1314, 2937, 1757, 1271, 2269, 2173, 1639, 2318, 584, 919, 2820, 2630,
+    2631, 1078, 1852, 931, 91, 3216, 1923, 2534, 82, 718, 2359, 2751, 2755, 2776, 629, 2274,
+    3078, 2006, 198, 196, 459, 2214, 2494, 873, 1061, 2597, 2165, 725, 985, 298, 1419, 390,
+    2668, 2669, 2828, 470, 360, 89, 2420, 1644, 504, 2889, 2970, 1098, 1046, 2701, 1703, 320,
+    1690, 2356, 890, 891, 2537, 2195, 2434, 2423, 640, 642, 1879, 2477, 703, 3028, 525, 1161,
+    224, 708, 1035, 2998, 228, 545, 1728, 3053, 3206, 2378, 1818, 2178, 12, 776, 2636, 1681,
+    2263, 2322, 1269, 2376, 2381, 2699, 2221, 1250, 2140, 2440, 1448, 2427, 2681, 1176, 580, 2509,
+    3040, 1498, 415, 541, 1616, 2694, 955, 1995, 2435, 1332, 2292, 1447, 1984, 2240, 1694, 553,
+    678, 2989, 2082, 2201, 2867, 1841, 983, 1990, 2717, 1274, 2729, 2709, 1478, 2958, 296, 127,
+    1083, 141, 2692, 748, 1877, 1720, 604, 1460, 1, 2556, 1464, 2200, 601, 734, 509, 1430,
+    2037, 178, 859, 352, 1223, 1824, 2160, 24, 602, 1485, 757, 1421, 2352, 2279, 2039, 690,
+    1188, 388, 879, 936, 445, 1310, 2982, 1669, 2115, 2325, 973, 1373, 1374, 2022, 1117, 491,
+    1948, 2164, 1989, 1251, 712, 2698, 1050, 2266, 3043, 633, 2948, 1721, 451, 2544, 3081, 3082,
+    3083, 2539, 2338, 1718, 387, 410, 455, 402, 2340, 3168, 1971, 1764, 1765, 2395, 392, 574,
+    605, 440, 1488, 2678, 2583, 393, 403, 1715, 468, 1023, 1707, 1607, 2113, 2111, 8, 336,
+    1689, 650, 1395, 299, 1580, 1423, 1013, 1014, 1442, 85, 510, 1305, 2239, 84, 2479, 927,
+    1907, 2243, 1994, 585, 62, 169, 2623, 1561, 1555, 63, 2159, 2007, 4, 1040, 796, 824,
+    2807, 2800, 1299, 1084, 1170, 431, 324, 340, 1259, 2031, 1958, 1220, 211, 2300, 2153, 1221,
+    2802, 2689, 1640, 2865, 3177, 740, 3096, 663, 1235, 2212, 2129, 2559, 1093, 76, 876, 2663,
+    2861, 126, 2833, 1141, 2540, 1778, 317, 1381, 489, 494, 2277, 614, 2175, 1938, 2845, 526,
+    532, 83, 916, 1087, 623, 670, 741, 2573, 3176, 1128, 1308, 2772, 2775, 524, 3027, 2723,
+    2122, 3012, 1343, 2112, 2123, 2918, 848, 474, 2451, 669, 2984, 2844, 1267, 858, 1264, 2927,
+    2417, 2425, 1307, 143, 3087, 40, 809, 896, 2901, 2787, 1403, 1963, 260, 2343, 1364, 2931,
+    1466, 2364, 3192, 129, 1991, 47, 886, 1985, 3039, 2774, 2642, 2628, 411, 1736, 2738, 538,
+    2096, 2747, 3019, 2273, 2727, 3160, 687, 1255, 2690, 911, 2365, 1494, 596, 193, 1489, 2554,
+    2369, 2370, 1319, 1123, 1322, 2296, 2980, 231, 881, 1945, 2662, 1992, 94, 1378, 1631, 1763,
+    192, 2309, 1198, 1913, 112, 2490, 861, 2460, 95, 1465, 2092, 860, 2944, 209, 1710, 2605,
+    1116, 3021, 2542, 1870, 2121, 2080, 3023, 2126, 1263, 1864, 2454, 223, 2924, 2291, 802, 819,
+    1129, 1502, 3024, 1112, 1634, 840, 512, 1215, 315, 359, 60, 153, 3062, 1910, 1033, 3178,
+    639, 854, 3008, 362, 1144, 488, 2107, 6, 3001, 2013, 73, 2181, 398, 754, 895, 775,
+    853, 363, 3018, 949, 922, 2187, 3038, 179, 948, 3011, 1391, 3071, 527, 857, 1916, 3090,
+    2876, 2834, 1732, 80, 419, 394, 907, 882, 1151, 1670, 81, 1047, 1843, 2851, 1394, 1665,
+    2877, 2388, 2850, 1953, 22, 1546, 1886, 2154, 2227, 19, 1437, 1007, 1772, 685, 758, 515,
+    2412, 189, 2289, 293, 3114, 1375, 2654, 3050, 348, 636, 3017, 3190, 1812, 1326, 1810, 677,
+    1811, 2864, 201, 2068, 1803, 1809, 18, 457, 2021, 2110, 2680, 305, 1547, 1970, 2172, 1856,
+    2954, 272, 3115, 1788, 3145, 3146, 20, 1048, 2829, 2016, 1476, 2500, 2981, 2148, 2985, 3211,
+    1745, 707, 2899, 2641, 2651, 1740, 2471, 1897, 787, 1553, 23, 366, 1668, 3058, 2577, 314,
+    537, 727, 2355, 2416, 866, 325, 1191, 2953, 737, 423, 588, 1921, 157, 862, 863, 1049,
+    1636, 1885, 1993, 158, 1034, 1063, 267, 13, 1030, 1645, 1336, 864, 1031, 3204, 1577, 3006,
+    736, 1425, 1635, 1349, 1742, 460, 188, 2849, 2848, 1750, 3013, 1673, 2523, 782, 1919, 1070,
+    1072, 1675, 1676, 989, 3000, 2999, 1743, 2581, 2162, 503, 1363, 2952, 2608, 1717, 1834, 1043,
+    2940, 2457, 1543, 2826, 2835, 2375, 1908, 1986, 1597, 249, 341, 1173, 1279, 1998, 2472, 2001,
+    2442, 1492, 2048, 2441, 343, 1471, 607, 2911, 3054, 812, 2549, 1891, 1564, 2974, 1999, 2574,
+    1073, 1997, 1252, 646, 1145, 683, 563, 397, 779, 634, 612, 463, 233, 3159, 3156, 1558,
+    386, 1106, 1109, 326, 837, 3097, 2788, 952, 3005, 2753, 791, 778, 1867, 2336, 2759, 2344,
+    731, 610, 1283, 1585, 217, 568, 2679, 920, 1662, 2362, 923, 2215, 2024, 2617, 2578, 2726,
+    883, 2315, 910, 1966, 1663, 1884, 2226, 2504, 1164, 1738, 1964, 2059, 806, 981, 1672, 287,
+    897, 2285, 816, 1880, 2308, 613, 2174, 2708, 2530, 878, 660, 1737, 1166, 1203, 559, 695,
+    1767, 2647, 1513, 1286, 1195, 2270, 801, 3015, 330, 1213, 587, 988, 338, 2010, 238, 735,
+    1057, 1354, 1565, 947, 3142, 821, 1533, 2870, 1411, 944, 3195, 729, 1755, 2903, 682, 2046,
+    1566, 1095, 2047, 279, 2044, 676, 1514, 581, 2720, 1146, 1353, 3180, 3100, 1103, 1133, 1333,
+    2904, 254, 255, 2155, 2410, 2905, 967, 3048, 785, 1303, 2866, 2935, 1126, 1232, 2614, 1296,
+    2615, 32, 3105, 2665, 1018, 899, 888, 301, 1719, 1005, 2939, 1724, 2912, 2147, 210, 1124,
+    38, 43, 120, 2335, 2293, 2814, 615, 2910, 3066, 1733, 1735, 1895, 869, 965, 421, 1405,
+    1179, 2251, 2333, 1177, 26, 2558, 2253, 1952, 2529, 2652, 2496, 793, 721, 1848, 1490, 2943,
+    2798, 834, 2262, 1949, 1317, 1231, 1410, 2171, 2446, 219, 1000, 1108, 268, 55, 476, 511,
+    285, 2983, 1905, 1287, 1020, 1243, 2421, 2217, 2941, 577, 357, 2409, 3029, 675, 1125, 33,
+    318, 699, 1341, 2188, 1660, 93, 203, 1284, 1484, 110, 1444, 2366, 1832, 893, 1433, 1482,
+    1499, 1781, 979, 2380, 2522, 382, 61, 1969, 2234, 2461, 554, 2643, 375, 152, 389, 2418,
+    2978, 2716, 467, 2971, 2725, 3132, 3133, 560, 976, 672, 3210, 379, 3188, 304, 1376, 3126,
+    960, 671, 373, 435, 436, 3127, 381, 380, 2934, 3212, 170, 572, 508, 237, 3120, 3108,
+    3155, 1396, 383, 353, 2551, 844, 3189, 1081, 2166, 1771, 1383, 125, 1342, 1356, 1386, 131,
+    1387, 2619, 2881, 190, 2756, 1122, 2743, 1079, 2350, 1508, 1441, 2691, 1431, 1435, 1882, 2789,
+    768, 971, 335, 2894, 523, 1510, 1712, 1350, 2696, 2711, 1934, 2207, 3002, 2453, 2535, 2728,
+    1814, 1980, 1457, 1902, 1875, 1236, 2329, 66, 2143, 2402, 1210, 121, 998, 426, 2975, 2684,
+    2235, 2061, 1414, 2436, 814, 1618, 2922, 1716, 2780, 1240, 1136, 1979, 2034, 2020, 564, 2033,
+    867, 1244, 1903, 856, 855, 2036, 1459, 534, 540, 598, 466, 2541, 1351, 248, 1152, 1169,
+    1338, 1312, 1766, 1052, 2604, 1377, 1796, 917, 2621, 103, 1309, 711, 309, 2204, 1602, 1100,
+    258, 2088, 696, 517, 513, 1874, 232, 2119, 278, 46, 2208, 2936, 2086, 3051, 1449, 562,
+    2142, 995, 413, 617, 752, 1845, 1467, 1397, 1091, 1446, 2374, 2986, 2963, 2785, 2825, 1868,
+    116, 372, 2976, 2977, 332, 1838, 2622, 282, 1434, 1452, 1595, 2806, 2930, 87, 2736, 1545,
+    2700, 1361, 2532, 2097, 2816, 484, 328, 594, 679, 808, 997, 2431, 3057, 2860, 2073, 2075,
+    608, 2074, 333, 2072, 2465, 1785, 2467, 2069, 1914, 1334, 136, 1844, 2406, 2973, 1114, 835,
+    2310, 1540, 2064, 2328, 557, 2019, 2686, 3065, 705, 565, 1941, 1192, 1951, 168, 1943, 2183,
+    1823, 666, 635, 1385, 2548, 2146, 2589, 2287, 2002, 1273, 2966, 1006, 2256, 659, 599, 1912,
+    2093, 583, 1500, 934, 2101, 1183, 2961, 2804, 1204, 2587, 106, 980, 2177, 2754, 1027, 1898,
+    222, 1899, 1102, 42, 1518, 65, 167, 71, 59, 245, 933, 2131, 2594, 2419, 2858, 2015,
+    2640, 3197, 807, 2014, 2424, 1015, 1792, 2570, 79, 58, 3109, 692, 2161, 2846, 2546, 2055,
+    1590, 1937, 1171, 2294, 1515, 2734, 2888, 1522, 2572, 3149, 1630, 1746, 1509, 1137, 2752, 1436,
+    990, 2991, 41, 2563, 1256, 1532, 2391, 1600, 2688, 1789, 1242, 1906, 2649, 2288, 1009, 1647,
+    2076, 242, 2284, 2653, 327, 475, 575, 3194, 1042, 2339, 3215, 1751, 1568, 3030, 2404, 2660,
+    2915, 3140, 2536, 2659, 2569, 3098, 122, 3041, 2733, 2683, 407, 1683, 1982, 1983, 2407, 3025,
+    2990, 681, 2065, 1132, 1892, 1976, 2452, 609, 2004, 2185, 1156, 665, 2351, 2480, 720, 2005,
+    2803, 2003, 1113, 185, 2666, 1516, 2667, 2618, 2104, 1445, 1575, 2644, 7, 3009, 1599, 2449,
+    2856, 2299, 2298, 3201, 3079, 2673, 2645, 2739, 1837, 3152, 1086, 500, 2386, 771, 1158, 789,
+    3004, 1135, 2929, 2923, 1138, 1620, 2965, 684, 2282, 15, 2869, 777, 2613, 401, 2740, 2633,
+    1382, 3147, 2704, 2337, 1477, 747, 653, 3101, 2438, 756, 1556, 2745, 384, 1180, 2218, 1957,
+    2345, 715, 1222, 1229, 1311, 2341, 2229, 2157, 501, 1313, 641, 117, 3036, 571, 1960, 108,
+    945, 2634, 2674, 2397, 798, 1189, 21, 1266, 1579, 1024, 2455, 2707, 2056, 182, 566, 1193,
+    1080, 1922, 2193, 688, 1939, 846, 3199, 2360, 1857, 1935, 954, 1603, 1808, 1709, 1606, 2852,
+    2141, 2757, 2286, 2498, 674, 1544, 2323, 104, 1610, 760, 3214, 664, 2721, 2761, 3164, 2767,
+    2702, 755, 921, 376, 1212, 1276, 2612, 1127, 929, 31, 1160, 619, 109, 1450, 2609, 1622,
+    2176, 2443, 2857, 2879, 300, 2956, 1786, 1420, 1881, 578, 2687, 2415, 935, 970, 1039, 542,
+    2553, 546, 590, 2469, 1920, 2278, 825, 2347, 1965, 1388, 2353, 2249, 2320, 3067, 1253, 2267,
+    307, 3003, 2487, 2646, 2398, 226, 2909, 239, 1525, 3193, 1355, 643, 14, 2150, 2139, 1190,
+    950, 1836, 2095, 2882, 2933, 263, 290, 3055, 1216, 2125, 1629, 172, 51, 498, 1944, 2368,
+    247, 1140, 2545, 2307, 113, 1237, 2180, 938, 277, 1443, 1344, 1653, 1454, 2009, 3148, 2261,
+    828, 1975, 1329, 2515, 2120, 1197, 2831, 2488, 792, 2610, 2444, 969, 2264, 803, 2770, 477,
+    3203, 2049, 1149, 786, 984, 323, 1576, 1582, 70, 622, 2521, 2371, 620, 1774, 2224, 733,
+    2538, 485, 1064, 2334, 67, 2495, 2815, 2512, 2805, 1111, 100, 145, 2595, 1664, 36, 101,
+    146, 2257, 1549, 1749, 851, 1813, 3112, 745, 1453, 2220, 3010, 2896, 2567, 1077, 2917, 2118,
+    2810, 770, 2029, 2951, 2314, 1346, 1578, 769, 115, 549, 3179, 530, 2872, 865, 1159, 77,
+    2516, 795, 354, 1667, 1227, 2357, 2916, 349, 999, 3061, 177, 2030, 2058, 220, 1119, 2252,
+    2949, 123, 496, 1004, 1285, 2028, 1451, 1225, 2464, 1399, 800, 72, 2117, 256, 252, 1574,
+    253, 2116, 2914, 2197, 2749, 2268, 2184, 2210, 658, 2801, 3099, 742, 2661, 92, 804, 1390,
+    276, 1505, 1551, 2084, 2493, 1876, 1172, 1082, 1275, 822, 1168, 2089, 1655, 1415, 977, 1928,
+    2566, 3037, 2703, 2750, 311, 2382, 135, 97, 975, 706, 2413, 702, 2043, 207, 2715, 1406,
+    2281, 1930, 2484, 187, 2354, 107, 2705, 2773, 1429, 2077, 2233, 130, 1427, 2045, 2533, 2078,
+    2130, 2276, 1869, 850, 852, 942, 1254, 291, 1282, 2682, 1657, 889, 3111, 1428, 1520, 1932,
+    1535, 704, 2722, 345, 2710, 2550, 2748, 1853, 2706, 200, 2079, 991, 1596, 1155, 2191, 1021,
+    1962, 2525, 2303, 2186, 1157, 2813, 2430, 2758, 3138, 118, 473, 1548, 2932, 1652, 908, 1633,
+    243, 424, 728, 1301, 781, 1208, 1345, 1491, 1241, 2066, 2886, 2890, 1617, 1320, 1323, 1642,
+    2114, 154, 1270, 961, 656, 2887, 74, 2744, 3088, 1371, 1950, 2012, 1480, 1598, 1569, 2891,
+    264, 1820, 1925, 1802, 1201, 958, 1816, 1822, 2216, 3069, 1734, 2331, 3169, 1163, 3121, 1722,
+    3074, 2321, 464, 302, 986, 964, 458, 2874, 1776, 1643, 1462, 456, 48, 2763, 1936, 212,
+    1612, 90, 1074, 877, 1348, 2524, 1281, 2588, 2297, 1790, 1806, 355, 1628, 3181, 34, 5,
+    2561, 1528, 334, 1847, 2389, 1347, 2648, 2506, 2429, 2878, 1178, 1739, 1118, 1929, 1682, 1335,
+    1367, 2324, 2330, 2246, 2571, 3052, 1401, 1217, 1041, 274, 2632, 648, 1900, 3187, 2768, 2627,
+    597, 2260, 163, 1878, 162, 1817, 556, 543, 576, 694, 1107, 3134, 2468, 2603, 3076, 3135,
+    589, 1196, 493, 1961, 1501, 137, 2342, 10, 262, 261, 1010, 904, 697, 906, 1996, 2611,
+    1143, 2507, 591, 1413, 1101, 905, 430, 644, 2408, 794, 2562, 368, 2511, 1199, 1519, 1002,
+    618, 1741, 2945, 902, 693, 1001, 1292, 2868, 753, 765, 2599, 772, 826, 1825, 2317, 1658,
+    1053, 1977, 1621, 1762, 1619, 2475, 567, 1760, 462, 2928, 181, 762, 2764, 901, 1066, 1863,
+    444, 903, 836, 1096, 2942, 443, 3165, 3166, 780, 486, 1417, 2808, 447, 845, 3202, 1370,
+    275, 514, 1092, 1291, 1065, 1130, 2531, 1646, 668, 3191, 1165, 3217, 3208, 529, 1581, 1418,
+    1968, 941, 900, 213, 3200, 894, 987, 539, 1439, 1613, 57, 724, 128, 1542, 738, 2124,
+    625, 202, 1858, 628, 744, 1846, 3207, 3144, 3163, 2591, 2103, 1372, 1085, 3073, 2179, 2138,
+    2158, 1917, 1036, 17, 3044, 2144, 1775, 830, 1337, 2390, 2913, 992, 1779, 2189, 2137, 1791,
+    230, 2528, 2925, 482, 593, 661, 730, 547, 550, 3186, 1679, 2109, 461, 483, 592, 871,
+    1147, 1615, 1069, 1756, 2377, 2791, 1896, 3020, 1304, 1055, 2827, 2580, 654, 603, 606, 739,
+    2396, 2231, 378, 1054, 918, 2232, 2501, 3014, 823, 1758, 2960, 951, 3060, 1506, 627, 9,
+    849, 2474, 3077, 3213, 1744, 3086, 632, 3183, 2202, 244, 1071, 3089, 3170, 347, 438, 358,
+    346, 479, 1293, 218, 1604, 2313, 1783, 132, 492, 1067, 767, 2518, 637, 2792, 1226, 1330,
+    2199, 149, 283, 2503, 2099, 2383, 1300, 2211, 1554, 2797, 171, 1393, 2812, 1527, 1584, 1392,
+    1424, 1563, 3110, 2824, 2499, 1408, 2675, 1507, 2695, 96, 114, 2602, 2782, 2326, 2962, 197,
+    2198, 940, 2405, 1426, 1536, 2543, 374, 1931, 2259, 994, 3106, 2655, 2656, 1412, 536, 329,
+    3119, 284, 1573, 2969, 932, 1605, 98, 2871, 657, 1666, 966, 1456, 350, 1981, 2478, 364,
+    764, 2458, 1473, 2639, 2967, 3085, 1701, 1534, 1828, 2821, 361, 1661, 1032, 2254, 418, 1017,
+    2008, 2552, 1022, 50, 1693, 841, 1926, 3184, 833, 3042, 420, 433, 1432, 1840, 1851, 2236,
+    3072, 3080, 723, 2063, 1247, 1209, 2843, 3131, 206, 416, 183, 28, 2244, 2919, 2373, 395,
+    3124, 3167, 297, 2332, 1025, 2921, 810, 2245, 251, 953, 2170, 1752, 1594, 205, 968, 726,
+    722, 1202, 414, 1331, 303, 1572, 2194, 2196, 838, 3056, 417, 2098, 909, 2992, 148, 1288,
+    1455, 1678, 1142, 600, 751, 2777, 1754, 1770, 1148, 839, 1182, 1587, 1648, 1706, 2433, 1239,
+    645, 313, 1504, 2693, 195, 448, 319, 2041, 928, 1051, 2083, 874, 1797, 1800, 1904, 1801,
+    686, 732, 1705, 1835, 246, 2671, 1708, 1947, 2169, 993, 1753, 1773, 184, 2809, 1154, 1727,
+    214, 1725, 2411, 1726, 914, 1695, 1099, 339, 1214, 1974, 289, 1625, 2437, 2, 2349, 2658,
+    1611, 2448, 1037, 2713, 551, 2462, 2950, 472, 1511, 2897, 531, 2972, 499, 912, 1224, 1641,
+    3064, 717, 2145, 1692, 439, 441, 2620, 1517, 832, 495, 1659, 962, 342, 2168, 2778, 2258,
+    1268, 1933, 295, 490, 432, 689, 1289, 2090, 2167, 569, 1278, 3022, 425, 898, 216, 166,
+    544, 2011, 2057, 2822, 3046, 2514, 691, 1698, 99, 102, 45, 2367, 331, 1495, 2133, 2513,
+    111, 3122, 37, 174, 1526, 1901, 1893, 1967, 2993, 54, 1228, 286, 2265, 56, 2426, 1205,
+    1496, 469, 1826, 2584, 719, 528, 225, 1821, 3075, 1422, 1883, 815, 1632, 1552, 1557, 743,
+    2053, 1627, 1614, 827, 1987, 406, 1257, 3161, 1497, 294, 1321, 1674, 3205, 405, 139, 1651,
+    25, 2280, 1677, 2192, 811, 2555, 521, 2664, 1748, 2482, 2081, 1075, 2247, 1248, 2463, 1570,
+    487, 2182, 1153, 946, 446, 1608, 3047, 321, 1637, 2855, 2060, 2486, 273, 1120, 1769, 2379,
+    147, 2575, 799, 1121, 1583, 1368, 783, 2564, 3007, 761, 1280, 1550, 1245, 2884, 2819, 1890,
+    124, 1978, 868, 2290, 818, 2384, 2719, 2422, 408, 2836, 630, 2283, 2839, 870, 1592, 3059,
+    2840, 872, 1805, 2670, 257, 2027, 2025, 229, 1461, 2023, 2811, 749, 788, 221, 235, 236,
+    2032, 2087, 2026, 2854, 1472, 1680, 156, 892, 880, 2510, 281, 631, 2400, 1560, 2596, 2784,
+    1586, 1795, 1194, 3113, 16, 180, 1325, 2085, 2657, 1524, 655, 2783, 1379, 2275, 1942, 2304,
+    2439, 1407, 2635, 310, 1008, 2794, 2190, 3139, 1105, 1531, 667, 1056, 2358, 2361, 1691, 312,
+    1369, 1650, 1714, 1523, 2847, 713, 714, 1297, 1702, 1302, 1316, 1019, 396, 2795, 649, 3209,
+    3153, 2560, 2601, 1696, 2348, 1601, 2582, 1438, 3045, 1539, 1730, 2035, 1089, 1060, 2685, 2387,
+    3136, 519, 1090, 1747, 2346, 1094, 164, 1260, 265, 215, 1088, 2108, 3154, 3157, 2508, 2793,
+    548, 926, 1440, 595, 972, 3093, 134, 516, 1076, 817, 1062, 1327, 1521, 1854, 1365, 1865,
+    885, 2156, 3091, 1167, 2906, 1626, 2228, 1175, 2625, 2900, 1206, 1850, 1290, 2091, 322, 292,
+    586, 937, 2979, 974, 86, 2062, 3049, 2676, 1097, 194, 2637, 2598, 2607, 2817, 1911, 1139,
+    1295, 1866, 1249, 1873, 716, 2136, 1162, 1793, 2301, 2248, 700, 266, 1104, 1697, 505, 367,
+    2017, 1591, 1860, 2585, 1888, 2638, 308, 288, 52, 1559, 2650, 1298, 3063, 2222, 1458, 1624,
+    2385, 269, 1277, 959, 2372, 1261, 1780, 3141, 943, 1799, 1068, 2450, 1915, 1829, 1833, 1830,
+    2071, 1328, 915, 465, 1798, 39, 1782, 996, 805, 1029, 1262, 2127, 2862, 2606, 2947, 3171,
+    2052, 2054, 280, 1483, 2051, 2050, 227, 175, 1003, 3196, 820, 2677, 1729, 1686, 1831, 1685,
+    2624, 1184, 2456, 2242, 2505, 2481, 344, 1044, 1324, 270, 579, 3031, 3032, 1258, 1409, 68,
+    3151, 1503, 2576, 155, 240, 2863, 930, 2213, 2902, 1588, 2128, 3033, 49, 204, 1713, 1366,
+    3016, 1924, 1761, 3137, 259, 2771, 399, 437, 409, 385, 2746, 151, 1359, 1265, 3198, 2920,
+    843, 1849, 144, 1211, 1185, 1340, 1306, 1684, 533, 2964, 2926, 1181, 250, 1529, 1470, 1972,
+    520, 2568, 1186, 774, 2311, 2447, 1593, 2151, 1988, 3162, 2592, 53, 2593, 710, 1389, 709,
+    2893, 1623, 507, 2892, 2859, 2517, 2476, 44, 1200, 450, 2955, 1807, 449, 1654, 1486, 925,
+    887, 1927, 2626, 626, 2489, 1609, 2883, 506, 2600, 2526, 2616, 2957, 1219, 2842, 3035, 1380,
+    1704, 1894, 2497, 2718, 1887, 2295, 831, 1493, 3070, 471, 2038, 2152, 2466, 3068, 2241, 1723,
+    337, 1487, 1567, 1362, 1638, 1218, 2988, 982, 2790, 480, 2938, 1400, 1946, 1804, 963, 1649,
+    391, 159, 2987, 140, 422, 1234, 1687, 1688, 1787, 1357, 2841, 1358, 2271, 1699, 2018, 2272,
+    2305, 1318, 1872, 1855, 2399, 2880, 2094, 2491, 2327, 2873, 1058, 1416, 1475, 69, 2470, 2732,
+    271, 234,
+};
+
+// 经纬度网格，第 cell 格的城市为 kCityGridCities[kCityGridStart[cell]] 到 kCityGridCities[kCityGridStart[cell + 1] - 1]
+constexpr int kCityGridLatMin = 8;
+constexpr int kCityGridLonMin = 75;
+constexpr int kCityGridCellDeg = 2;
+constexpr int kCityGridRows = 23;
+constexpr int kCityGridCols = 30;
+
+constexpr uint16_t kCityGridStart[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 5, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 26, 27, 27, 27, 33, 57, 62, 62, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 64, 77,
+    88, 100, 109, 134, 158, 186, 241, 264, 269, 279, 281, 281, 281, 281, 281, 281,
+    281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 291, 309, 338, 357,
+    372, 389, 418, 440, 468, 488, 524, 537, 542, 542, 542, 542, 542, 542, 542, 542,
+    542, 542, 542, 542, 542, 543, 543, 543, 543, 543, 545, 557, 576, 591, 624, 649,
+    673, 711, 744, 764, 787, 812, 813, 813, 813, 813, 813, 813, 813, 813, 813, 813,
+    813, 814, 817, 826, 836, 852, 857, 859, 863, 866, 876, 915, 950, 965, 984, 1012,
+    1037, 1072, 1104, 1135, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1156, 1157, 1157,
+    1158, 1160, 1161, 1164, 1169, 1173, 1180, 1186, 1196, 1242, 1276, 1293, 1305, 1331, 1372, 1396,
+    1445, 1501, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1530, 1531, 1532, 1532, 1533,
+    1533, 1535, 1535, 1538, 1542, 1547, 1553, 1560, 1578, 1591, 1611, 1634, 1674, 1708, 1746, 1786,
+    1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788,
+    1788, 1789, 1790, 1795, 1807, 1827, 1848, 1894, 1928, 1972, 2034, 2074, 2108, 2120, 2120, 2120,
+    2120, 2120, 2120, 2120, 2120, 2121, 2123, 2129, 2131, 2131, 2131, 2131, 2131, 2132, 2133, 2133,
+    2137, 2143, 2163, 2176, 2186, 2194, 2215, 2254, 2311, 2361, 2400, 2426, 2437, 2437, 2437, 2437,
+    2437, 2437, 2437, 2448, 2452, 2453, 2453, 2453, 2454, 2455, 2455, 2455, 2457, 2457, 2461, 2468,
+    2473, 2474, 2492, 2496, 2504, 2529, 2558, 2616, 2650, 2656, 2667, 2668, 2668, 2668, 2668, 2668,
+    2668, 2668, 2669, 2675, 2680, 2681, 2686, 2686, 2686, 2686, 2687, 2688, 2689, 2690, 2690, 2690,
+    2690, 2698, 2709, 2723, 2747, 2761, 2779, 2795, 2823, 2860, 2870, 2871, 2871, 2871, 2871, 2871,
+    2871, 2871, 2880, 2881, 2884, 2894, 2898, 2898, 2902, 2902, 2902, 2902, 2902, 2902, 2902, 2902,
+    2902, 2904, 2906, 2911, 2917, 2923, 2935, 2953, 2979, 2983, 2990, 2990, 2990, 2990, 2990, 2992,
+    2998, 3004, 3009, 3013, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015, 3015,
+    3016, 3017, 3018, 3020, 3026, 3035, 3053, 3060, 3078, 3086, 3086, 3086, 3086, 3086, 3089, 3090,
+    3094, 3098, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100, 3100,
+    3100, 3101, 3107, 3123, 3137, 3146, 3169, 3180, 3181, 3181, 3181, 3181, 3181, 3181, 3182, 3182,
+    3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3182, 3183, 3186, 3191,
+    3191, 3194, 3199, 3201, 3207, 3207, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208,
+    3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3208, 3209, 3210, 3213,
+    3214, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216,
+    3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3216, 3217, 3218, 3218, 3218,
+    3218, 3218, 3218,
+};
+
+constexpr uint16_t kCityGridCities[] = {
+    2193, 2194, 2191, 2192, 2200, 2186, 2187, 2188, 2189, 2190, 2195, 2196, 2197, 2198, 2199, 2201,
+    2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2666, 2667, 2111, 2112, 2113, 2115, 2116,
+    2117, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1985, 1986, 2106,
+    2107, 2108, 2109, 2110, 2181, 2182, 2183, 2184, 2185, 1984, 2023, 2024, 2025, 2026, 2039, 2626,
+    2611, 2615, 2616, 2618, 2619, 2620, 2621, 2622, 2627, 2628, 2629, 2664, 2665, 2585, 2610, 2612,
+    2613, 2617, 2641, 2647, 2648, 2650, 2651, 2653, 2642, 2643, 2644, 2646, 2652, 2654, 2655, 2656,
+    2657, 2658, 2659, 2660, 2135, 2136, 2137, 2140, 2141, 2147, 2177, 2180, 2663, 2056, 2057, 2058,
+    2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2114, 2118, 2138, 2139, 2164, 2165, 2172,
+    2173, 2174, 2175, 2176, 2178, 2179, 1987, 2068, 2103, 2105, 2119, 2120, 2121, 2122, 2123, 2124,
+    2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2166, 2167, 2169, 2170, 1962, 1963,
+    1968, 1969, 1970, 1971, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 2027, 2030, 2050,
+    2051, 2052, 2053, 2054, 2055, 2098, 2099, 2100, 2101, 2102, 1913, 1914, 1915, 1916, 1917, 1918,
+    1919, 1920, 1921, 1922, 1923, 1924, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
+    1946, 1947, 1948, 1949, 1958, 1959, 1960, 1961, 1964, 1965, 1966, 1967, 1997, 1998, 1999, 2000,
+    2001, 2002, 2016, 2017, 2022, 2028, 2029, 2031, 2037, 2038, 3211, 3212, 3213, 3214, 3215, 3216,
+    3217, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 2007, 2008, 2012, 2013, 2014, 2015, 2018, 2040,
+    2041, 2042, 2044, 2045, 2046, 2047, 2048, 2049, 1184, 1186, 1188, 1957, 2043, 3190, 3191, 3192,
+    3193, 3194, 3195, 3197, 3198, 3200, 3203, 3196, 3204, 2589, 2591, 2681, 2682, 2683, 2684, 2685,
+    2686, 2687, 2688, 2586, 2587, 2588, 2590, 2614, 2623, 2624, 2625, 2668, 2669, 2670, 2671, 2672,
+    2673, 2674, 2675, 2676, 2677, 2551, 2552, 2553, 2554, 2555, 2557, 2558, 2559, 2563, 2565, 2576,
+    2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2638,
+    2639, 2640, 2469, 2512, 2513, 2515, 2560, 2561, 2562, 2564, 2566, 2567, 2568, 2569, 2570, 2571,
+    2572, 2573, 2645, 2649, 2661, 2142, 2143, 2144, 2145, 2146, 2490, 2491, 2514, 2516, 2517, 2518,
+    2519, 2520, 2546, 2662, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2168, 2533,
+    2534, 2541, 2544, 2545, 2550, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+    2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2090, 2091, 2093, 2095, 2096, 2097, 2104,
+    2151, 2171, 1864, 1865, 1867, 1868, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 2032, 2033, 2034,
+    2036, 2089, 2092, 2148, 2149, 2150, 2152, 2153, 1264, 1265, 1266, 1268, 1269, 1270, 1271, 1273,
+    1275, 1861, 1862, 1863, 1869, 1872, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+    1935, 2020, 2021, 2035, 1206, 1207, 1208, 1209, 1210, 1267, 1272, 1274, 1277, 1279, 1280, 1282,
+    2003, 2004, 2005, 2006, 2009, 2010, 2011, 2019, 1139, 1142, 1143, 1144, 1145, 1146, 1147, 1148,
+    1154, 1161, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
+    1181, 1182, 1183, 1185, 1187, 1189, 1190, 1191, 1192, 1204, 1205, 1211, 1132, 1134, 1140, 1141,
+    1149, 1150, 1151, 1152, 1153, 3199, 3201, 3202, 3205, 3206, 3207, 3208, 3209, 3210, 2719, 2689,
+    2690, 2604, 2605, 2606, 2607, 2609, 2678, 2679, 2680, 2691, 2692, 2693, 2695, 2278, 2279, 2280,
+    2281, 2282, 2283, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2595, 2608, 2637,
+    2446, 2465, 2466, 2468, 2499, 2500, 2556, 2574, 2575, 2592, 2593, 2594, 2597, 2600, 2601, 2454,
+    2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2467, 2470, 2471, 2472, 2473, 2484,
+    2485, 2486, 2487, 2488, 2489, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2547, 2548, 2549, 2602,
+    2475, 2479, 2480, 2481, 2504, 2505, 2506, 2507, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2530,
+    2531, 2535, 2536, 2537, 2538, 2539, 2540, 2542, 2543, 1824, 1825, 1826, 1827, 1828, 1885, 1886,
+    1887, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1907, 2094, 2501, 2502, 2503, 2528, 2529,
+    2532, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811,
+    1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1873, 1874, 1875, 1876,
+    1877, 1898, 1899, 1900, 1901, 1902, 1903, 1237, 1238, 1239, 1240, 1241, 1242, 1257, 1258, 1259,
+    1283, 1284, 1286, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1787, 1788, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 1796, 1866, 1870, 1871, 1159, 1160, 1166, 1276, 1278, 1281, 1285, 1287,
+    1288, 1289, 1290, 1309, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1319, 1138, 1155, 1156, 1157,
+    1158, 1162, 1163, 1164, 1165, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
+    1215, 1216, 1318, 934, 935, 938, 939, 940, 941, 942, 1004, 1005, 1128, 1129, 1130, 1131,
+    1133, 1135, 1136, 1137, 1212, 1213, 1214, 1217, 1218, 1219, 1220, 1221, 936, 2718, 2720, 2721,
+    2722, 2705, 2706, 2709, 2710, 2711, 2712, 2713, 2717, 2723, 2702, 2703, 2707, 2708, 2714, 2715,
+    2716, 2747, 2752, 2756, 2696, 2697, 2698, 2699, 2700, 2704, 2744, 2745, 2746, 2748, 2749, 2750,
+    2751, 2753, 2754, 2755, 2736, 2737, 2738, 2739, 2743, 2740, 2741, 2694, 2732, 2733, 2742, 2433,
+    2434, 2435, 2387, 2388, 2389, 2419, 2421, 2447, 2448, 2449, 2450, 2451, 2271, 2272, 2273, 2274,
+    2275, 2276, 2277, 2326, 2327, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339,
+    2340, 2355, 2357, 2358, 2359, 2360, 2361, 2363, 2364, 2365, 2366, 2368, 2384, 2452, 2453, 2596,
+    2598, 2599, 2603, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2226, 2227,
+    2228, 2230, 2231, 2233, 2237, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2323, 2324, 2325,
+    2328, 2362, 2367, 2474, 2482, 2483, 2212, 2224, 2225, 2229, 2236, 2239, 2247, 2248, 2249, 2476,
+    2477, 2478, 2508, 2509, 2510, 1769, 1770, 1771, 1772, 1849, 1850, 1851, 1853, 1888, 1889, 1904,
+    1905, 1906, 1908, 1909, 1910, 1911, 1912, 2511, 1737, 1739, 1777, 1779, 1780, 1781, 1783, 1786,
+    1834, 1835, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1852, 1854, 1855, 1856,
+    1857, 1858, 1859, 1860, 1248, 1300, 1301, 1302, 1304, 1740, 1753, 1754, 1755, 1756, 1757, 1758,
+    1759, 1778, 1782, 1784, 1785, 1829, 1830, 1831, 1832, 1833, 1836, 1837, 1838, 1222, 1223, 1224,
+    1225, 1226, 1227, 1228, 1229, 1230, 1231, 1243, 1244, 1245, 1246, 1247, 1249, 1250, 1251, 1252,
+    1253, 1254, 1255, 1256, 1262, 1299, 1303, 1305, 1306, 1307, 1308, 1310, 1328, 1329, 1680, 1752,
+    975, 976, 977, 978, 979, 981, 1070, 1071, 1073, 1074, 1075, 1076, 1077, 1232, 1233, 1234,
+    1235, 1236, 1260, 1261, 1263, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1330, 1331, 1332,
+    918, 919, 920, 932, 933, 937, 943, 959, 962, 963, 964, 965, 966, 967, 968, 969,
+    970, 971, 972, 973, 974, 980, 993, 997, 998, 999, 1000, 1001, 1002, 1003, 1006, 921,
+    922, 923, 924, 925, 926, 927, 928, 929, 984, 987, 988, 989, 990, 991, 992, 994,
+    995, 996, 2769, 2771, 2770, 2776, 2763, 2767, 2765, 2701, 2757, 2758, 2735, 2759, 2760, 2764,
+    2766, 2728, 2729, 2731, 2734, 2427, 2428, 2724, 2725, 2726, 2727, 2730, 2417, 2424, 2425, 2426,
+    2431, 2432, 2390, 2391, 2392, 2404, 2410, 2411, 2418, 2420, 2422, 2423, 2250, 2251, 2252, 2253,
+    2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269,
+    2270, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2306, 2308, 2351, 2352,
+    2353, 2354, 2356, 2385, 2386, 2399, 2400, 2405, 2406, 2407, 2232, 2303, 2304, 2305, 2316, 2317,
+    2318, 2319, 2320, 2321, 2322, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2369,
+    2370, 2371, 2372, 2373, 2374, 2375, 2382, 2393, 2394, 2395, 2401, 2402, 1766, 2211, 2234, 2235,
+    2238, 2240, 2241, 2242, 2246, 2376, 2377, 2378, 2379, 2380, 2381, 2396, 2398, 1698, 1699, 1701,
+    1764, 1765, 1767, 1768, 1776, 2243, 2244, 2245, 2883, 1691, 1692, 1693, 1694, 1695, 1696, 1697,
+    1700, 1702, 1703, 1704, 1709, 1711, 1714, 1719, 1720, 1721, 1722, 1723, 1733, 1734, 1735, 1736,
+    1738, 1741, 1774, 1632, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
+    1673, 1674, 1678, 1679, 1681, 1715, 1716, 1717, 1718, 1724, 1725, 1726, 1727, 1728, 1729, 1730,
+    1731, 1732, 1742, 1743, 1744, 1745, 1760, 1761, 1762, 1763, 1773, 1775, 1063, 1064, 1065, 1066,
+    1067, 1068, 1069, 1102, 1103, 1104, 1105, 1107, 1108, 1109, 1633, 1675, 1676, 1677, 1746, 1747,
+    1748, 1749, 1750, 1751, 805, 806, 809, 1007, 1008, 1009, 1010, 1011, 1013, 1014, 1015, 1016,
+    1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+    1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1072, 1115, 1116, 1117, 1118, 1119, 1120,
+    1121, 1124, 1125, 1126, 1127, 808, 810, 811, 812, 813, 814, 815, 816, 817, 829, 830,
+    831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 846, 893,
+    907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 944, 945, 946, 947, 948,
+    949, 951, 952, 953, 954, 955, 956, 957, 958, 960, 961, 1122, 1123, 781, 782, 783,
+    784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 845, 851,
+    853, 930, 931, 950, 982, 983, 985, 986, 2772, 2773, 2774, 2775, 2768, 2761, 2762, 3033,
+    3035, 3036, 2429, 3031, 3032, 3034, 2413, 2430, 3026, 3027, 3028, 2403, 2412, 2414, 2415, 2416,
+    3029, 2307, 2408, 2409, 2966, 2967, 2969, 2988, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2397,
+    2807, 2852, 2856, 2857, 2858, 2860, 2968, 2971, 2974, 2975, 2383, 2850, 2851, 2853, 2854, 2855,
+    2859, 2861, 2877, 2878, 2879, 2880, 2881, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 2875,
+    2876, 2882, 2884, 2885, 2886, 2887, 2889, 2890, 2891, 2892, 2893, 1518, 1528, 1532, 1603, 1604,
+    1605, 1606, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1616, 1690, 1705, 1706, 1707, 1708, 1710,
+    1712, 1713, 1525, 1526, 1527, 1529, 1530, 1531, 1533, 1534, 1587, 1590, 1591, 1592, 1593, 1594,
+    1595, 1607, 1615, 1627, 1628, 1629, 1630, 1631, 1637, 1638, 1639, 1641, 1642, 1645, 1648, 1649,
+    1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1037, 1038, 1039, 1040, 1041, 1049,
+    1050, 1051, 1052, 1053, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1106,
+    1110, 1111, 1112, 1113, 1114, 1626, 1634, 1635, 1636, 1643, 1644, 1647, 798, 799, 800, 801,
+    802, 803, 804, 807, 826, 866, 868, 901, 902, 903, 905, 906, 1012, 1026, 1027, 1028,
+    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1086,
+    1100, 1101, 847, 848, 852, 854, 862, 863, 864, 865, 867, 869, 870, 871, 872, 873,
+    875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890,
+    891, 892, 894, 895, 896, 897, 898, 899, 900, 1085, 849, 850, 3037, 3030, 3020, 3022,
+    3023, 3024, 3025, 2983, 2984, 2985, 2990, 2991, 2992, 3007, 3013, 3014, 3015, 3016, 3017, 2902,
+    2919, 2958, 2959, 2961, 2962, 2963, 2964, 2965, 2970, 2976, 2977, 2978, 2979, 2980, 2981, 2982,
+    2986, 2987, 2989, 2804, 2911, 2913, 2914, 2915, 2916, 2917, 2918, 2920, 2933, 2934, 2938, 2939,
+    2940, 2960, 2972, 2973, 3064, 3065, 3066, 3067, 2777, 2778, 2779, 2780, 2782, 2783, 2786, 2788,
+    2790, 2791, 2794, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2805, 2806, 2808, 2809, 2810,
+    2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2935, 2936, 2937,
+    2949, 2950, 2954, 2955, 2956, 2957, 280, 282, 283, 285, 291, 292, 293, 319, 1602, 2781,
+    2784, 2785, 2787, 2789, 2792, 2793, 2795, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832,
+    2833, 2834, 2835, 2845, 2846, 2848, 2849, 2888, 254, 255, 256, 257, 259, 260, 281, 284,
+    286, 287, 288, 289, 290, 311, 312, 313, 317, 325, 1494, 1509, 1510, 1511, 1512, 1513,
+    1514, 1515, 1516, 1517, 1519, 1520, 1521, 1522, 1523, 1524, 1535, 1574, 1575, 1596, 1597, 1598,
+    1599, 1600, 1601, 1660, 258, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1495, 1496, 1497,
+    1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1542, 1543, 1544, 1546, 1547,
+    1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563,
+    1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1583, 1584, 1585, 1586, 1588, 1589,
+    1640, 1646, 824, 825, 1098, 1099, 1405, 1406, 1407, 1409, 1410, 1411, 1412, 1414, 1415, 1416,
+    1420, 1421, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1576, 1577, 1578, 1580,
+    1582, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 818, 819, 820, 821, 822, 823,
+    827, 828, 859, 904, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1408, 1413, 1422, 1433, 1434,
+    1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 855, 856, 857, 858,
+    860, 861, 874, 1349, 1429, 1430, 1431, 1432, 3144, 3139, 3148, 3145, 3146, 3147, 3149, 3150,
+    3189, 3151, 3152, 3041, 3039, 3038, 3040, 3042, 3043, 3008, 3011, 3012, 3018, 3019, 3044, 2899,
+    2921, 2922, 2924, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005,
+    3006, 3009, 3021, 2894, 2895, 2896, 2897, 2898, 2900, 2901, 2907, 2908, 2909, 2910, 2912, 2925,
+    3056, 3057, 3058, 3060, 3062, 3063, 3068, 3069, 3070, 3071, 2842, 2843, 2866, 2867, 2951, 2952,
+    2953, 3059, 318, 320, 321, 322, 332, 333, 334, 2836, 2837, 2838, 2839, 2840, 2841, 2844,
+    2847, 2864, 2868, 2869, 2871, 2872, 2873, 213, 214, 215, 216, 217, 218, 219, 220, 223,
+    244, 250, 251, 252, 253, 268, 269, 270, 275, 276, 277, 278, 279, 309, 310, 314,
+    315, 316, 323, 324, 326, 327, 328, 329, 330, 336, 337, 338, 339, 340, 42, 47,
+    49, 52, 53, 80, 81, 82, 83, 84, 85, 86, 87, 88, 90, 91, 93, 94,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 118, 235,
+    236, 237, 238, 239, 241, 242, 243, 245, 246, 247, 248, 249, 271, 272, 273, 274,
+    1536, 1537, 1538, 1539, 1540, 1541, 1545, 54, 89, 92, 95, 110, 111, 112, 113, 114,
+    115, 116, 117, 178, 183, 201, 202, 203, 204, 205, 209, 210, 211, 1333, 1335, 1336,
+    1337, 1339, 1344, 1423, 1447, 1448, 1449, 1450, 1452, 1453, 1454, 1455, 1456, 1458, 1459, 1460,
+    1461, 1462, 1463, 1464, 1465, 1466, 1467, 1579, 1581, 1334, 1338, 1340, 1341, 1342, 1343, 1345,
+    1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1373, 1374, 1375, 1376, 1377, 1378, 1397,
+    1398, 1399, 1401, 1417, 1418, 1419, 1451, 1457, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475,
+    1346, 1347, 1348, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1384, 1385, 1386, 1387, 1388, 1389,
+    1390, 1392, 1393, 1394, 1395, 1396, 1400, 1402, 1403, 1404, 1379, 1380, 1381, 1382, 1383, 1391,
+    1424, 1425, 1426, 1427, 1428, 3127, 3128, 3129, 3131, 3132, 3133, 3134, 3135, 3136, 3141, 3142,
+    3137, 3138, 3140, 3143, 3183, 3112, 3111, 2945, 2946, 2903, 2941, 2942, 2943, 2926, 2927, 2928,
+    2929, 2930, 2931, 3010, 454, 2904, 2905, 2906, 2932, 2923, 361, 362, 363, 364, 452, 453,
+    3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3061, 392, 393, 394, 395,
+    387, 388, 389, 396, 2862, 2863, 2870, 2874, 221, 222, 261, 262, 263, 264, 266, 294,
+    295, 296, 298, 300, 301, 302, 303, 304, 305, 306, 307, 308, 331, 335, 349, 391,
+    2865, 34, 35, 36, 37, 38, 39, 40, 41, 43, 44, 45, 46, 50, 51, 56,
+    126, 128, 131, 135, 141, 155, 231, 232, 233, 240, 265, 267, 297, 299, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 12, 32, 48, 55, 119, 120, 121, 122,
+    123, 124, 125, 127, 129, 130, 132, 133, 134, 136, 137, 138, 139, 140, 142, 143,
+    173, 174, 175, 176, 177, 181, 182, 184, 186, 187, 189, 190, 191, 192, 193, 194,
+    196, 197, 198, 199, 206, 207, 208, 212, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 68, 71, 79, 179, 180, 185, 188, 195, 200, 72, 73, 74, 75, 76, 78,
+    470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 509, 3130, 3117, 3118, 3119,
+    3124, 3125, 3126, 3120, 3121, 3122, 3123, 3182, 3109, 3107, 3108, 3110, 3116, 3186, 2948, 2944,
+    2947, 455, 412, 413, 414, 415, 416, 417, 418, 419, 351, 352, 353, 354, 355, 356,
+    357, 358, 359, 360, 390, 234, 341, 342, 343, 344, 345, 346, 347, 348, 350, 422,
+    426, 428, 430, 144, 145, 146, 149, 151, 152, 154, 156, 157, 224, 225, 226, 227,
+    228, 229, 230, 420, 421, 423, 424, 425, 427, 429, 431, 10, 11, 13, 15, 16,
+    147, 148, 150, 153, 158, 159, 160, 169, 447, 14, 33, 67, 69, 70, 77, 161,
+    162, 163, 164, 165, 166, 167, 168, 170, 171, 172, 375, 376, 555, 556, 557, 558,
+    559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 466, 481, 482, 483, 485,
+    486, 488, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
+    525, 530, 542, 543, 544, 545, 546, 456, 457, 458, 459, 460, 461, 462, 463, 465,
+    484, 487, 489, 490, 491, 492, 493, 494, 497, 498, 499, 500, 501, 502, 504, 505,
+    506, 507, 508, 510, 534, 535, 536, 537, 538, 539, 540, 541, 495, 503, 603, 604,
+    605, 606, 610, 611, 612, 617, 616, 3153, 3154, 3157, 3158, 3160, 3162, 3163, 3164, 3188,
+    3161, 3113, 3114, 3115, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3089, 3086, 3087,
+    3088, 3101, 3090, 3091, 3092, 3093, 440, 444, 443, 448, 439, 441, 449, 450, 451, 365,
+    366, 368, 371, 372, 373, 367, 369, 370, 374, 377, 384, 378, 381, 382, 383, 469,
+    526, 527, 528, 529, 531, 532, 533, 464, 467, 468, 496, 547, 548, 549, 550, 551,
+    552, 553, 554, 591, 592, 593, 594, 596, 597, 570, 571, 572, 573, 574, 575, 576,
+    581, 582, 583, 584, 585, 586, 588, 590, 595, 598, 599, 600, 601, 602, 607, 608,
+    609, 613, 615, 587, 614, 633, 638, 630, 631, 632, 634, 635, 636, 637, 3156, 3159,
+    3102, 3103, 3104, 3105, 3106, 3187, 3081, 3082, 3083, 3155, 3167, 3170, 3084, 3097, 3098, 3169,
+    3181, 3094, 3095, 3096, 3184, 3099, 3100, 442, 445, 446, 385, 386, 379, 436, 438, 624,
+    625, 628, 380, 618, 619, 620, 621, 622, 626, 627, 629, 577, 578, 579, 580, 589,
+    623, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 709, 710, 650, 651, 653,
+    654, 655, 656, 657, 675, 676, 677, 678, 679, 681, 742, 743, 746, 747, 748, 749,
+    750, 751, 752, 754, 755, 756, 680, 682, 683, 684, 744, 745, 753, 757, 3165, 3166,
+    3171, 3168, 3085, 3172, 3175, 3180, 3173, 3174, 3177, 3185, 3176, 3179, 434, 409, 432, 433,
+    435, 437, 664, 658, 659, 660, 661, 662, 663, 665, 666, 668, 669, 670, 706, 707,
+    708, 711, 712, 667, 673, 703, 704, 705, 765, 766, 767, 768, 769, 771, 773, 774,
+    775, 652, 713, 714, 716, 718, 723, 730, 770, 772, 649, 685, 686, 687, 688, 689,
+    690, 691, 692, 715, 717, 720, 721, 725, 728, 731, 732, 733, 734, 735, 736, 737,
+    738, 693, 694, 695, 696, 697, 698, 699, 700, 701, 739, 740, 702, 3178, 406, 399,
+    405, 407, 397, 398, 403, 404, 408, 400, 401, 674, 671, 672, 760, 763, 764, 761,
+    762, 719, 722, 724, 726, 727, 729, 741, 410, 411, 402, 776, 778, 779, 758, 759,
+    777, 780,
+};
+
+static_assert(sizeof(kCityRecords) / sizeof(kCityRecords[0]) == city_count);
+static_assert(sizeof(kCityIds) / sizeof(kCityIds[0]) == city_count);
+static_assert(sizeof(kCityByName) / sizeof(kCityByName[0]) == city_count);
+static_assert(sizeof(kCityGridStart) / sizeof(kCityGridStart[0]) == kCityGridRows * kCityGridCols + 1);
+
+const char* GetString(uint32_t offset) {
+    return kCityStringPool + offset;
+}
+
+int FindExact(const uint16_t* index, uint32_t CityRecord::*field,
+        int (*compare)(const char*, const char*), const char* key) {
+    auto end = index + city_count;
+    auto it = std::lower_bound(index, end, key, [&](uint16_t i, const char* k) {
+        return compare(GetString(kCityRecords[i].*field), k) < 0;
+    });
+    if (it != end && compare(GetString(kCityRecords[*it].*field), key) == 0) {
+        return *it;
+    }
+    return -1;
+}
+
+// 依次尝试原样、补上或去掉末尾的"区"，以及地级市本身的写法（最后一级重复，如 "广东/深圳/深圳"）。
+// 调用方常把区名末尾的"区"去掉，而少数区的名称保留了"区"，例如 "山西/太原/小店区"
+int FindVariants(const uint16_t* index, uint32_t CityRecord::*field, const std::string& key) {
+    static const std::string kDistrict = "区";
+    int city = FindExact(index, field, strcmp, key.c_str());
+    if (city < 0) {
+        city = FindExact(index, field, strcmp, (key + kDistrict).c_str());
+    }
+    if (city < 0 && key.size() > kDistrict.size() && key.ends_with(kDistrict)) {
+        city = FindExact(index, field, strcmp, key.substr(0, key.size() - kDistrict.size()).c_str());
+    }
+    if (city < 0) {
+        auto pos = key.rfind('/');
+        auto last = pos == std::string::npos ? key : key.substr(pos + 1);
+        city = FindExact(index, field, strcmp, (key + "/" + last).c_str());
+    }
+    return city;
+}
+
+// 找不到时去掉最后一级再查，例如 "广东/深圳/未知" 退回到 "广东/深圳/深圳"
+int FindByPath(const uint16_t* index, uint32_t CityRecord::*field, const char* name) {
+    std::string key(name);
+    while (!key.empty()) {
+        int city = FindVariants(index, field, key);
+        if (city >= 0) {
+            return city;
         }
+        auto pos = key.rfind('/');
+        if (pos == std::string::npos) {
+            break;
+        }
+        key.resize(pos);
+    }
+    return -1;
+}
+
+bool GetCoordinates(int index, double& lat, double& lon) {
+    if (index < 0) {
+        return false;
     }
-    return false;
+    lat = kCityRecords[index].lat / 1000000.0;
+    lon = kCityRecords[index].lon / 1000000.0;
+    return true;
+}
+
+} // namespace
+
+CityData GetCity(size_t index) {
+    auto& record = kCityRecords[index];
+    return CityData{
+        kCityIds[index],
+        GetString(record.admin),
+        GetString(record.city),
+        GetString(record.pinyin),
+        record.lat / 1000000.0,
+        record.lon / 1000000.0,
+    };
+}
+
+bool FindCityByName(const char* city_name, double& lat, double& lon) {
+    return GetCoordinates(FindByPath(kCityByName, &CityRecord::city, city_name), lat, lon);
 }
 
 bool FindCityByAdmin(const char* admin_name, double& lat, double& lon) {
-    for (size_t i = 0; i < city_count; i++) {
-        if (strstr(city_coordinates[i].admin, admin_name) != nullptr ||
-            strstr(admin_name, city_coordinates[i].admin) != nullptr) {
-            lat = city_coordinates[i].lat;
-            lon = city_coordinates[i].lon;
-            return true;
+    return GetCoordinates(FindByPath(kCityByAdmin, &CityRecord::admin, admin_name), lat, lon);
+}
+
+bool FindCityByPinyin(const char* pinyin, double& lat, double& lon) {
+    return GetCoordinates(FindExact(kCityByPinyin, &CityRecord::pinyin, strcasecmp, pinyin), lat, lon);
+}
+
+bool FindNearestCity(double lat, double lon, CityData& city) {
+    int row = std::clamp((int)std::floor((lat - kCityGridLatMin) / kCityGridCellDeg), 0, kCityGridRows - 1);
+    int col = std::clamp((int)std::floor((lon - kCityGridLonMin) / kCityGridCellDeg), 0, kCityGridCols - 1);
+    // 经度差按纬度缩放，近距离下足够准确
+    double lon_scale = std::cos(lat * M_PI / 180);
+    int best = -1;
+    double best_distance = INFINITY;
+
+    // 从所在的格子向外一圈一圈查找，第 ring 圈的城市至少相距 ring - 1 格
+    int max_ring = std::max(kCityGridRows, kCityGridCols);
+    for (int ring = 0; ring < max_ring; ring++) {
+        double bound = std::max(ring - 1, 0) * kCityGridCellDeg * std::min(lon_scale, 1.0);
+        if (best >= 0 && bound * bound > best_distance) {
+            break;
         }
+        for (int r = row - ring; r <= row + ring; r++) {
+            if (r < 0 || r >= kCityGridRows) {
+                continue;
+            }
+            bool edge_row = r == row - ring || r == row + ring;
+            for (int c = col - ring; c <= col + ring; c += edge_row ? 1 : 2 * ring) {
+                if (c >= 0 && c < kCityGridCols) {
+                    int cell = r * kCityGridCols + c;
+                    for (int i = kCityGridStart[cell]; i < kCityGridStart[cell + 1]; i++) {
+                        auto& record = kCityRecords[kCityGridCities[i]];
+                        double dlat = record.lat / 1000000.0 - lat;
+                        double dlon = (record.lon / 1000000.0 - lon) * lon_scale;
+                        double distance = dlat * dlat + dlon * dlon;
+                        if (distance < best_distance) {
+                            best_distance = distance;
+                            best = kCityGridCities[i];
+                        }
+                    }
+                }
+                if (ring == 0) {
+                    break;
+                }
+            }
+        }
+    }
+    if (best < 0) {
+        return false;
     }
-    return false;
+    city = GetCity(best);
+    return true;
 }
@@ -0,0 +1,154 @@
+#include "clock_digits.h"
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+
+#include <cstring>
+#include <algorithm>
+
+#define TAG "ClockDigits"
+
+namespace {
+
+const char* const kGlyphText[CLOCK_DIGITS_GLYPH_COUNT] = {
+    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", ":"
+};
+
+size_t AlignUp(size_t size) {
+    return (size + LV_DRAW_BUF_ALIGN - 1) & ~(size_t)(LV_DRAW_BUF_ALIGN - 1);
+}
+
+} // namespace
+
+ClockDigits::ClockDigits(lv_obj_t* parent, const lv_font_t* font, const char* text, lv_color_t text_color, lv_color_t bg_color)
+    : font_(font), text_color_(text_color), bg_color_(bg_color) {
+    container_ = lv_obj_create(parent);
+    lv_obj_remove_style_all(container_);
+    lv_obj_set_size(container_, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(container_, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(container_, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_remove_flag(container_, LV_OBJ_FLAG_SCROLLABLE);
+    // The parent may delete the container before this object is destroyed
+    lv_obj_add_event_cb(container_, [](lv_event_t* e) {
+        auto self = (ClockDigits*)lv_event_get_user_data(e);
+        self->container_ = nullptr;
+        self->slots_.clear();
+    }, LV_EVENT_DELETE, this);
+
+    RenderGlyphs();
+
+    text_ = text;
+    for (char c : text_) {
+        lv_obj_t* slot = lv_image_create(container_);
+        lv_image_set_src(slot, GetGlyph(c));
+        slots_.push_back(slot);
+    }
+}
+
+ClockDigits::~ClockDigits() {
+    if (container_ != nullptr) {
+        lv_obj_remove_event_cb_with_user_data(container_, nullptr, this);
+        lv_obj_delete(container_);
+    }
+    for (auto& glyph : glyphs_) {
+        if (glyph.data != nullptr) {
+            lv_image_cache_drop(&glyph);
+        }
+    }
+    heap_caps_free(glyph_memory_);
+}
+
+void ClockDigits::RenderGlyphs() {
+    // 所有数字使用同一宽度，数值变化时不会引起重新布局
+    int32_t digit_width = 0;
+    for (char c = '0'; c <= '9'; c++) {
+        digit_width = std::max<int32_t>(digit_width, lv_font_get_glyph_width(font_, c, 0));
+    }
+    int32_t colon_width = lv_font_get_glyph_width(font_, ':', 0) + 2 * lv_font_get_glyph_width(font_, ' ', 0);
+    int32_t height = lv_font_get_line_height(font_);
+
+    if (glyph_memory_ == nullptr) {
+        size_t offsets[CLOCK_DIGITS_GLYPH_COUNT];
+        size_t total = 0;
+        for (int i = 0; i < CLOCK_DIGITS_GLYPH_COUNT; i++) {
+            int32_t width = i < 10 ? digit_width : colon_width;
+            uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_RGB565);
+            offsets[i] = total;
+            total += AlignUp(stride * height);
+        }
+        glyph_memory_ = (uint8_t*)heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, total, MALLOC_CAP_SPIRAM);
+        if (glyph_memory_ == nullptr) {
+            glyph_memory_ = (uint8_t*)heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, total, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        }
+        if (glyph_memory_ == nullptr) {
+            ESP_LOGE(TAG, "Failed to allocate %u bytes for glyphs", total);
+            return;
+        }
+        for (int i = 0; i < CLOCK_DIGITS_GLYPH_COUNT; i++) {
+            int32_t width = i < 10 ? digit_width : colon_width;
+            uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_RGB565);
+            lv_draw_buf_init(&glyphs_[i], width, height, LV_COLOR_FORMAT_RGB565, stride,
+                glyph_memory_ + offsets[i], stride * height);
+        }
+        ESP_LOGI(TAG, "Cached %d glyphs of %ldx%ld, %u bytes", CLOCK_DIGITS_GLYPH_COUNT, digit_width, height, total);
+    }
+
+    // 背景直接画进位图，显示时只需拷贝，不需要混合
+    lv_obj_t* canvas = lv_canvas_create(container_);
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    for (int i = 0; i < CLOCK_DIGITS_GLYPH_COUNT; i++) {
+        auto& glyph = glyphs_[i];
+        lv_image_cache_drop(&glyph);
+        lv_canvas_set_draw_buf(canvas, &glyph);
+        lv_canvas_fill_bg(canvas, bg_color_, LV_OPA_COVER);
+
+        lv_layer_t layer;
+        lv_canvas_init_layer(canvas, &layer);
+        lv_draw_label_dsc_t dsc;
+        lv_draw_label_dsc_init(&dsc);
+        dsc.font = font_;
+        dsc.color = text_color_;
+        dsc.text = kGlyphText[i];
+        dsc.align = LV_TEXT_ALIGN_CENTER;
+        lv_area_t area = { 0, 0, (int32_t)glyph.header.w - 1, (int32_t)glyph.header.h - 1 };
+        lv_draw_label(&layer, &dsc, &area);
+        lv_canvas_finish_layer(canvas, &layer);
+    }
+    lv_obj_delete(canvas);
+}
+
+const lv_draw_buf_t* ClockDigits::GetGlyph(char c) const {
+    if (glyph_memory_ == nullptr) {
+        return nullptr;
+    }
+    if (c >= '0' && c <= '9') {
+        return &glyphs_[c - '0'];
+    }
+    return &glyphs_[10];
+}
+
+void ClockDigits::SetText(const char* text) {
+    if (container_ == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < slots_.size() && text[i] != '\0'; i++) {
+        if (text[i] != text_[i]) {
+            text_[i] = text[i];
+            lv_image_set_src(slots_[i], GetGlyph(text[i]));
+        }
+    }
+}
+
+void ClockDigits::SetColors(lv_color_t text_color, lv_color_t bg_color) {
+    if (container_ == nullptr || (lv_color_eq(text_color, text_color_) && lv_color_eq(bg_color, bg_color_))) {
+        return;
+    }
+    text_color_ = text_color;
+    bg_color_ = bg_color;
+    RenderGlyphs();
+    // 位图地址不变，需要让图片重新读取
+    for (size_t i = 0; i < slots_.size(); i++) {
+        lv_image_set_src(slots_[i], GetGlyph(text_[i]));
+        lv_obj_invalidate(slots_[i]);
+    }
+}
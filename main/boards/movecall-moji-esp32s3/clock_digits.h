@@ -0,0 +1,43 @@
+#ifndef CLOCK_DIGITS_H
+#define CLOCK_DIGITS_H
+
+#include <lvgl.h>
+
+#include <string>
+#include <vector>
+
+#define CLOCK_DIGITS_GLYPH_COUNT 11     // 0-9 and ':'
+
+/*
+ * 待机表盘上的数字。0-9 和冒号按字体和颜色预先渲染成不透明的 RGB565 位图并缓存在 PSRAM，
+ * 每个字符占一个固定宽度的 lv_image，SetText 只替换数值变化的那几个字符，
+ * 既不重新光栅化字形，也不会触发重新布局，每秒失效的区域只有变化的数字。
+ */
+class ClockDigits {
+public:
+    // text 决定字符个数，之后的 SetText 必须等长，只能包含数字和冒号
+    ClockDigits(lv_obj_t* parent, const lv_font_t* font, const char* text, lv_color_t text_color, lv_color_t bg_color);
+    ~ClockDigits();
+    ClockDigits(const ClockDigits&) = delete;
+    ClockDigits& operator=(const ClockDigits&) = delete;
+
+    void SetText(const char* text);
+    // Re-render the cached glyphs, used when the theme changes
+    void SetColors(lv_color_t text_color, lv_color_t bg_color);
+    lv_obj_t* GetObject() const { return container_; }
+
+private:
+    void RenderGlyphs();
+    const lv_draw_buf_t* GetGlyph(char c) const;
+
+    const lv_font_t* font_;
+    lv_color_t text_color_;
+    lv_color_t bg_color_;
+    lv_obj_t* container_ = nullptr;
+    std::vector<lv_obj_t*> slots_;
+    std::string text_;
+    uint8_t* glyph_memory_ = nullptr;
+    lv_draw_buf_t glyphs_[CLOCK_DIGITS_GLYPH_COUNT] = {};
+};
+
+#endif // CLOCK_DIGITS_H
@@ -8,6 +8,361 @@
 import csv
 import sys
 import os
+import math
+
+# 网格每格的经纬度跨度（度）
+GRID_CELL_DEG = 2
+
+
+def format_array(values, per_line=16):
+    """
+    将整数列表格式化为C++数组初始化列表
+    """
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def sorted_index(cities_data, key):
+    """
+    按字段的UTF-8字节序排序的下标（与 strcmp 一致），相同名称保持原始顺序
+    """
+    return sorted(range(len(cities_data)), key=lambda i: (key(cities_data[i]), i))
+
+
+def build_grid(cities_data):
+    """
+    将城市按经纬度分到网格中，返回网格参数、每格起始位置和城市下标
+    """
+    lat_min = math.floor(min(c['lat'] for c in cities_data))
+    lon_min = math.floor(min(c['lon'] for c in cities_data))
+    rows = int((max(c['lat'] for c in cities_data) - lat_min) // GRID_CELL_DEG) + 1
+    cols = int((max(c['lon'] for c in cities_data) - lon_min) // GRID_CELL_DEG) + 1
+    cells = [[] for _ in range(rows * cols)]
+    for i, city in enumerate(cities_data):
+        row = int((city['lat'] - lat_min) // GRID_CELL_DEG)
+        col = int((city['lon'] - lon_min) // GRID_CELL_DEG)
+        cells[row * cols + col].append(i)
+    starts = [0]
+    indices = []
+    for cell in cells:
+        indices.extend(cell)
+        starts.append(len(indices))
+    return lat_min, lon_min, rows, cols, starts, indices
+
+
+def build_string_pool(cities_data):
+    """
+    将行政归属、城市名称和拼音放入同一个字符串池，相同的字符串只保存一次
+    """
+    pool = bytearray()
+    offsets = {}
+    records = []
+    for city in cities_data:
+        record = []
+        for field in ('admin', 'city', 'pinyin'):
+            value = city[field]
+            if value not in offsets:
+                offsets[value] = len(pool)
+                pool += value.encode('utf-8') + b'\0'
+            record.append(offsets[value])
+        records.append(record)
+    return pool, records
+
+
+def to_fixed(value):
+    """
+    经纬度转为 1e-6 度的定点数
+    """
+    return int(round(value * 1000000))
+
+
+def verify_string_pool(cities_data, pool, records):
+    """
+    从字符串池和定点数还原每一行，确认与CSV数据一致
+    """
+    def read(offset):
+        return pool[offset:pool.index(b'\0', offset)].decode('utf-8')
+
+    for city, record in zip(cities_data, records):
+        restored = (read(record[0]), read(record[1]), read(record[2]))
+        if restored != (city['admin'], city['city'], city['pinyin']):
+            raise ValueError(f"字符串池校验失败: {city} -> {restored}")
+        if abs(to_fixed(city['lat']) / 1000000 - city['lat']) > 0.5e-6 or \
+                abs(to_fixed(city['lon']) / 1000000 - city['lon']) > 0.5e-6:
+            raise ValueError(f"经纬度校验失败: {city}")
+
+
+def format_pool(pool):
+    """
+    字符串池输出为相邻的字符串字面量，每个字符串一个，避免转义字符与后续字符连在一起
+    """
+    lines = []
+    for value in bytes(pool).split(b'\0')[:-1]:
+        lines.append('    "' + value.decode('utf-8') + '\\0"')
+    return "\n".join(lines)
+
+
+def write_header(output_file_path, cities_data):
+    with open(output_file_path, 'w', encoding='utf-8') as output:
+        output.write(f"""/*
+ * @Date: 2025-01-27
+ * @Description: 城市经纬度数据接口，数据在 city_data_impl.cc 中，从CSV文件自动生成
+ * @Generated: 自动生成，请勿手动编辑
+ */
+#pragma once
+#include <cstddef>
+
+struct CityData {{
+    const char* id;       // 城市ID
+    const char* admin;    // 行政归属
+    const char* city;     // 城市名称
+    const char* pinyin;   // 拼音
+    double lat;           // 纬度
+    double lon;           // 经度
+}};
+
+static const size_t city_count = {len(cities_data)};
+
+// 按下标读取城市数据，index 需小于 city_count
+CityData GetCity(size_t index);
+
+// 城市查找函数声明，名称按路径匹配，例如 "广东/深圳/南山"。区名末尾的"区"可有可无，
+// 只给到地级市（"广东/深圳"）时返回地级市本身，找不到时去掉最后一级再查
+bool FindCityByName(const char* city_name, double& lat, double& lon);
+bool FindCityByAdmin(const char* admin_name, double& lat, double& lon);
+// 拼音不区分大小写，重名时返回第一个
+bool FindCityByPinyin(const char* pinyin, double& lat, double& lon);
+// 按经纬度查找最近的城市
+bool FindNearestCity(double lat, double lon, CityData& city);
+""")
+
+
+def write_impl(impl_file, header_name, cities_data):
+    pool, records = build_string_pool(cities_data)
+    verify_string_pool(cities_data, pool, records)
+    by_name = sorted_index(cities_data, lambda c: c['city'].encode('utf-8'))
+    by_admin = sorted_index(cities_data, lambda c: c['admin'].encode('utf-8'))
+    by_pinyin = sorted_index(cities_data, lambda c: c['pinyin'].encode('utf-8').lower())
+    lat_min, lon_min, rows, cols, starts, indices = build_grid(cities_data)
+    record_lines = "\n".join(
+        f"    {{{r[0]}, {r[1]}, {r[2]}, {to_fixed(c['lat'])}, {to_fixed(c['lon'])}}},"
+        for c, r in zip(cities_data, records))
+    id_lines = "\n".join(f'    "{c["id"]}",' for c in cities_data)
+    id_size = max(len(c['id']) for c in cities_data) + 1
+    with open(impl_file, 'w', encoding='utf-8') as impl:
+        impl.write(f'''/*
+ * @Date: 2025-01-27
+ * @Description: 城市经纬度数据和查找函数实现，从CSV文件自动生成
+ * @Generated: 自动生成，请勿手动编辑
+ */
+#include "{header_name}"
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <strings.h>
+
+namespace {{
+
+// 字符串在 kCityStringPool 中的偏移，经纬度为 1e-6 度的定点数
+struct CityRecord {{
+    uint32_t admin;
+    uint32_t city;
+    uint32_t pinyin;
+    int32_t lat;
+    int32_t lon;
+}};
+
+constexpr char kCityStringPool[] =
+{format_pool(pool)};
+
+constexpr char kCityIds[][{id_size}] = {{
+{id_lines}
+}};
+
+constexpr CityRecord kCityRecords[] = {{
+{record_lines}
+}};
+
+// 按城市名称、行政归属、拼音排序的下标，用于二分查找
+constexpr uint16_t kCityByName[] = {{
+{format_array(by_name)}
+}};
+
+constexpr uint16_t kCityByAdmin[] = {{
+{format_array(by_admin)}
+}};
+
+constexpr uint16_t kCityByPinyin[] = {{
+{format_array(by_pinyin)}
+}};
+
+// 经纬度网格，第 cell 格的城市为 kCityGridCities[kCityGridStart[cell]] 到 kCityGridCities[kCityGridStart[cell + 1] - 1]
+constexpr int kCityGridLatMin = {lat_min};
+constexpr int kCityGridLonMin = {lon_min};
+constexpr int kCityGridCellDeg = {GRID_CELL_DEG};
+constexpr int kCityGridRows = {rows};
+constexpr int kCityGridCols = {cols};
+
+constexpr uint16_t kCityGridStart[] = {{
+{format_array(starts)}
+}};
+
+constexpr uint16_t kCityGridCities[] = {{
+{format_array(indices)}
+}};
+
+static_assert(sizeof(kCityRecords) / sizeof(kCityRecords[0]) == city_count);
+static_assert(sizeof(kCityIds) / sizeof(kCityIds[0]) == city_count);
+static_assert(sizeof(kCityByName) / sizeof(kCityByName[0]) == city_count);
+static_assert(sizeof(kCityGridStart) / sizeof(kCityGridStart[0]) == kCityGridRows * kCityGridCols + 1);
+
+const char* GetString(uint32_t offset) {{
+    return kCityStringPool + offset;
+}}
+
+int FindExact(const uint16_t* index, uint32_t CityRecord::*field,
+        int (*compare)(const char*, const char*), const char* key) {{
+    auto end = index + city_count;
+    auto it = std::lower_bound(index, end, key, [&](uint16_t i, const char* k) {{
+        return compare(GetString(kCityRecords[i].*field), k) < 0;
+    }});
+    if (it != end && compare(GetString(kCityRecords[*it].*field), key) == 0) {{
+        return *it;
+    }}
+    return -1;
+}}
+
+// 依次尝试原样、补上或去掉末尾的"区"，以及地级市本身的写法（最后一级重复，如 "广东/深圳/深圳"）。
+// 调用方常把区名末尾的"区"去掉，而少数区的名称保留了"区"，例如 "山西/太原/小店区"
+int FindVariants(const uint16_t* index, uint32_t CityRecord::*field, const std::string& key) {{
+    static const std::string kDistrict = "区";
+    int city = FindExact(index, field, strcmp, key.c_str());
+    if (city < 0) {{
+        city = FindExact(index, field, strcmp, (key + kDistrict).c_str());
+    }}
+    if (city < 0 && key.size() > kDistrict.size() && key.ends_with(kDistrict)) {{
+        city = FindExact(index, field, strcmp, key.substr(0, key.size() - kDistrict.size()).c_str());
+    }}
+    if (city < 0) {{
+        auto pos = key.rfind('/');
+        auto last = pos == std::string::npos ? key : key.substr(pos + 1);
+        city = FindExact(index, field, strcmp, (key + "/" + last).c_str());
+    }}
+    return city;
+}}
+
+// 找不到时去掉最后一级再查，例如 "广东/深圳/未知" 退回到 "广东/深圳/深圳"
+int FindByPath(const uint16_t* index, uint32_t CityRecord::*field, const char* name) {{
+    std::string key(name);
+    while (!key.empty()) {{
+        int city = FindVariants(index, field, key);
+        if (city >= 0) {{
+            return city;
+        }}
+        auto pos = key.rfind('/');
+        if (pos == std::string::npos) {{
+            break;
+        }}
+        key.resize(pos);
+    }}
+    return -1;
+}}
+
+bool GetCoordinates(int index, double& lat, double& lon) {{
+    if (index < 0) {{
+        return false;
+    }}
+    lat = kCityRecords[index].lat / 1000000.0;
+    lon = kCityRecords[index].lon / 1000000.0;
+    return true;
+}}
+
+}} // namespace
+
+CityData GetCity(size_t index) {{
+    auto& record = kCityRecords[index];
+    return CityData{{
+        kCityIds[index],
+        GetString(record.admin),
+        GetString(record.city),
+        GetString(record.pinyin),
+        record.lat / 1000000.0,
+        record.lon / 1000000.0,
+    }};
+}}
+
+bool FindCityByName(const char* city_name, double& lat, double& lon) {{
+    return GetCoordinates(FindByPath(kCityByName, &CityRecord::city, city_name), lat, lon);
+}}
+
+bool FindCityByAdmin(const char* admin_name, double& lat, double& lon) {{
+    return GetCoordinates(FindByPath(kCityByAdmin, &CityRecord::admin, admin_name), lat, lon);
+}}
+
+bool FindCityByPinyin(const char* pinyin, double& lat, double& lon) {{
+    return GetCoordinates(FindExact(kCityByPinyin, &CityRecord::pinyin, strcasecmp, pinyin), lat, lon);
+}}
+
+bool FindNearestCity(double lat, double lon, CityData& city) {{
+    int row = std::clamp((int)std::floor((lat - kCityGridLatMin) / kCityGridCellDeg), 0, kCityGridRows - 1);
+    int col = std::clamp((int)std::floor((lon - kCityGridLonMin) / kCityGridCellDeg), 0, kCityGridCols - 1);
+    // 经度差按纬度缩放，近距离下足够准确
+    double lon_scale = std::cos(lat * M_PI / 180);
+    int best = -1;
+    double best_distance = INFINITY;
+
+    // 从所在的格子向外一圈一圈查找，第 ring 圈的城市至少相距 ring - 1 格
+    int max_ring = std::max(kCityGridRows, kCityGridCols);
+    for (int ring = 0; ring < max_ring; ring++) {{
+        double bound = std::max(ring - 1, 0) * kCityGridCellDeg * std::min(lon_scale, 1.0);
+        if (best >= 0 && bound * bound > best_distance) {{
+            break;
+        }}
+        for (int r = row - ring; r <= row + ring; r++) {{
+            if (r < 0 || r >= kCityGridRows) {{
+                continue;
+            }}
+            bool edge_row = r == row - ring || r == row + ring;
+            for (int c = col - ring; c <= col + ring; c += edge_row ? 1 : 2 * ring) {{
+                if (c >= 0 && c < kCityGridCols) {{
+                    int cell = r * kCityGridCols + c;
+                    for (int i = kCityGridStart[cell]; i < kCityGridStart[cell + 1]; i++) {{
+                        auto& record = kCityRecords[kCityGridCities[i]];
+                        double dlat = record.lat / 1000000.0 - lat;
+                        double dlon = (record.lon / 1000000.0 - lon) * lon_scale;
+                        double distance = dlat * dlat + dlon * dlon;
+                        if (distance < best_distance) {{
+                            best_distance = distance;
+                            best = kCityGridCities[i];
+                        }}
+                    }}
+                }}
+                if (ring == 0) {{
+                    break;
+                }}
+            }}
+        }}
+    }}
+    if (best < 0) {{
+        return false;
+    }}
+    city = GetCity(best);
+    return true;
+}}
+''')
+
+    # 估算占用的 flash 空间，32位平台上旧格式每行 4 个指针和 2 个 double
+    string_bytes = sum(len(c[f].encode('utf-8')) + 1 for c in cities_data for f in ('id', 'admin', 'city', 'pinyin'))
+    old_size = len(cities_data) * 32 + string_bytes
+    new_size = len(pool) + 1 + len(cities_data) * (20 + id_size)
+    print(f"数据大小: 旧格式约 {old_size} 字节，新格式 {new_size} 字节"
+          f"（字符串池 {len(pool) + 1}，记录 {len(cities_data) * 20}，ID {len(cities_data) * id_size}），"
+          f"节省 {old_size - new_size} 字节，不含索引")
+
 
 def convert_csv_to_cpp(csv_file_path, output_file_path):
     """
@@ -106,73 +461,9 @@ def convert_csv_to_cpp(csv_file_path, output_file_path):
         print(f"成功读取 {len(cities_data)} 个城市数据")
         
         # 生成C++代码
-        with open(output_file_path, 'w', encoding='utf-8') as output:
-            output.write("""/*
- * @Date: 2025-01-27
- * @Description: 城市经纬度数据，从CSV文件自动生成
- * @Generated: 自动生成，请勿手动编辑
- */
-#pragma once
-
-struct CityData {
-    const char* id;       // 城市ID
-    const char* admin;    // 行政归属
-    const char* city;     // 城市名称
-    const char* pinyin;   // 拼音
-    double lat;           // 纬度
-    double lon;           // 经度
-};
-
-static const CityData city_coordinates[] = {
-""")
-            
-            for city in cities_data:
-                output.write(f'    {{"{city["id"]}", "{city["admin"]}", "{city["city"]}", "{city["pinyin"]}", {city["lat"]:.6f}, {city["lon"]:.6f}}},\n')
-            
-            output.write(f"""
-}};
-
-static const size_t city_count = {len(cities_data)};
-
-// 城市查找函数声明
-bool FindCityByName(const char* city_name, double& lat, double& lon);
-bool FindCityByAdmin(const char* admin_name, double& lat, double& lon);
-""")
-        
-        # 生成查找函数实现
+        write_header(output_file_path, cities_data)
         impl_file = output_file_path.replace('.h', '_impl.cc')
-        with open(impl_file, 'w', encoding='utf-8') as impl:
-            impl.write(f'''/*
- * @Date: 2025-01-27
- * @Description: 城市经纬度查找函数实现
- */
-#include "{os.path.basename(output_file_path)}"
-#include <cstring>
-
-bool FindCityByName(const char* city_name, double& lat, double& lon) {{
-    for (size_t i = 0; i < city_count; i++) {{
-        if (strstr(city_coordinates[i].city, city_name) != nullptr ||
-            strstr(city_name, city_coordinates[i].city) != nullptr) {{
-            lat = city_coordinates[i].lat;
-            lon = city_coordinates[i].lon;
-            return true;
-        }}
-    }}
-    return false;
-}}
-
-bool FindCityByAdmin(const char* admin_name, double& lat, double& lon) {{
-    for (size_t i = 0; i < city_count; i++) {{
-        if (strstr(city_coordinates[i].admin, admin_name) != nullptr ||
-            strstr(admin_name, city_coordinates[i].admin) != nullptr) {{
-            lat = city_coordinates[i].lat;
-            lon = city_coordinates[i].lon;
-            return true;
-        }}
-    }}
-    return false;
-}}
-''')
+        write_impl(impl_file, os.path.basename(output_file_path), cities_data)
         
         print(f"C++头文件已生成: {output_file_path}")
         print(f"C++实现文件已生成: {impl_file}")
@@ -200,7 +491,7 @@ bool FindCityByAdmin(const char* admin_name, double& lat, double& lon) {{
 def main():
     if len(sys.argv) != 3:
         print("用法: python csv_to_cpp.py <输入CSV文件> <输出头文件>")
-        print('示例: python csv_to_cpp.py "D:\\Download\\V3城市对应经纬度 20230505.csv" city_data.h')
+        print('示例: python csv_to_cpp.py city_data.csv city_data.h')
         return
     
     csv_file = sys.argv[1]
@@ -210,7 +501,8 @@ def main():
         print("转换完成!")
         print("使用方法:")
         print("1. 将生成的 .h 和 _impl.cc 文件包含到项目中")
-        print("2. 调用 FindCityByName() 或 FindCityByAdmin() 查找城市坐标")
+        print("2. 调用 FindCityByName()、FindCityByAdmin()、FindCityByPinyin() 查找城市坐标")
+        print("3. 调用 FindNearestCity() 按经纬度查找最近的城市")
     else:
         print("转换失败!")
 
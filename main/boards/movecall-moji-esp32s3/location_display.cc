@@ -15,6 +15,7 @@ namespace LocationDisplay {
 static std::string api_key = "你的key";
 static std::string current_location = "正在获取地址...";
 static bool is_initialized = false;
+static bool location_valid = false;
 static esp_http_client_handle_t http_client = nullptr;
 
 // HTTP响应回调函数
@@ -206,13 +207,16 @@ std::string GetCurrentLocation() {
     free(buffer);
     
     current_location = location_str;
+    location_valid = true;
     ESP_LOGI(TAG, "获取到地址: %s", location_str.c_str());
     
     return location_str;
 }
 
-void UpdateLocation() {
+bool UpdateLocation() {
+    location_valid = false;
     GetCurrentLocation();
+    return location_valid;
 }
 
 std::string GetLocationString() {
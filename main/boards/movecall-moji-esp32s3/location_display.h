@@ -14,8 +14,8 @@ namespace LocationDisplay {
     // 获取当前地址信息
     std::string GetCurrentLocation();
     
-    // 更新地址信息
-    void UpdateLocation();
+    // 更新地址信息，成功获取到地址时返回 true
+    bool UpdateLocation();
     
     // 设置腾讯地图API密钥
     void SetApiKey(const std::string& key);
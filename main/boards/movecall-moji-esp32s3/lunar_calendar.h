@@ -10,6 +10,22 @@
 #include <ctime>
 
 namespace LunarCalendar {
+    struct LunarDate {
+        int year;
+        int month;
+        int day;
+        bool is_leap;   // 闰月
+    };
+
+    // 公历转农历，支持 1900-01-31 到农历2099年末，超出范围返回 false
+    bool SolarToLunar(int year, int month, int day, LunarDate& lunar);
+
     // 根据公历日期获取农历日期字符串
     std::string GetLunarDate(int year, int month, int day);
-} 
\ No newline at end of file
+
+    // 获取当天的节气名称（1900-2100年），不是节气返回 nullptr
+    const char* GetSolarTerm(int year, int month, int day);
+
+    // 获取当天的节日名称，农历节日优先，没有节日返回 nullptr
+    const char* GetFestival(int year, int month, int day);
+}
@@ -0,0 +1,466 @@
+/*
+ * @Description: 农历和节气查找表，由 lunar_table.py 生成
+ * @Generated: 自动生成，请勿手动编辑
+ */
+#pragma once
+#include <cstdint>
+
+static constexpr int kLunarFirstYear = 1900;
+static constexpr int kLunarYearCount = 200;
+
+// 农历每年正月初一距1970-01-01的天数，最后一项为表格结束的日期
+static constexpr int32_t kLunarNewYearDays[] = {
+    -25537, -25153, -24799, -24444, -24061, -23707, -23352, -22968, -22614, -22259,
+    -21875, -21521, -21137, -20783, -20429, -20045, -19691, -19336, -18952, -18597,
+    -18213, -17859, -17505, -17121, -16767, -16413, -16028, -15674, -15319, -14935,
+    -14581, -14198, -13844, -13489, -13105, -12750, -12396, -12012, -11658, -11274,
+    -10920, -10566, -10182, -9827, -9473, -9088, -8734, -8380, -7996, -7642,
+    -7258, -6904, -6549, -6165, -5811, -5456, -5072, -4718, -4335, -3980,
+    -3626, -3242, -2887, -2533, -2149, -1794, -1441, -1057, -702, -318,
+    36, 391, 775, 1129, 1483, 1867, 2221, 2605, 2959, 3314,
+    3698, 4053, 4407, 4791, 5145, 5529, 5883, 6237, 6621, 6976,
+    7331, 7715, 8069, 8423, 8806, 9161, 9545, 9899, 10254, 10638,
+    10992, 11346, 11730, 12084, 12439, 12823, 13177, 13562, 13916, 14270,
+    14654, 15008, 15362, 15746, 16101, 16485, 16839, 17194, 17578, 17932,
+    18286, 18670, 19024, 19379, 19763, 20117, 20501, 20855, 21209, 21593,
+    21948, 22302, 22686, 23041, 23425, 23779, 24133, 24517, 24871, 25225,
+    25609, 25964, 26319, 26703, 27057, 27441, 27795, 28149, 28533, 28887,
+    29242, 29626, 29981, 30365, 30719, 31073, 31456, 31811, 32165, 32549,
+    32904, 33258, 33642, 33996, 34380, 34734, 35089, 35473, 35827, 36182,
+    36566, 36920, 37304, 37658, 38012, 38396, 38751, 39105, 39489, 39844,
+    40198, 40582, 40936, 41320, 41674, 42029, 42413, 42767, 43122, 43505,
+    43859, 44243, 44597, 44952, 45336, 45691, 46045, 46429, 46783, 47137,
+    47521,
+};
+
+// 每年的闰月，0 表示没有闰月
+static constexpr uint8_t kLunarLeapMonth[] = {
+    8, 0, 0, 5, 0, 0, 4, 0, 0, 2, 0, 6, 0, 0, 5, 0, 0, 2, 0, 7,
+    0, 0, 5, 0, 0, 4, 0, 0, 2, 0, 6, 0, 0, 5, 0, 0, 3, 0, 7, 0,
+    0, 6, 0, 0, 4, 0, 0, 2, 0, 7, 0, 0, 5, 0, 0, 3, 0, 8, 0, 0,
+    6, 0, 0, 4, 0, 0, 3, 0, 7, 0, 0, 5, 0, 0, 4, 0, 8, 0, 0, 6,
+    0, 0, 4, 0, 10, 0, 0, 6, 0, 0, 5, 0, 0, 3, 0, 8, 0, 0, 5, 0,
+    0, 4, 0, 0, 2, 0, 7, 0, 0, 5, 0, 0, 4, 0, 9, 0, 0, 6, 0, 0,
+    4, 0, 0, 2, 0, 6, 0, 0, 5, 0, 0, 3, 0, 11, 0, 0, 6, 0, 0, 5,
+    0, 0, 2, 0, 7, 0, 0, 5, 0, 0, 3, 0, 8, 0, 0, 6, 0, 0, 4, 0,
+    0, 3, 0, 7, 0, 0, 5, 0, 0, 4, 0, 8, 0, 0, 6, 0, 0, 4, 0, 0,
+    3, 0, 7, 0, 0, 5, 0, 0, 4, 0, 8, 0, 0, 6, 0, 0, 4, 0, 0, 2,
+};
+
+// 各月（闰月排在同名月份之后）相对正月初一的起始天数，没有闰月的年份最后一项重复
+static constexpr uint16_t kLunarMonthStart[][14] = {
+    {0, 29, 59, 88, 117, 147, 176, 206, 236, 265, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 265, 295, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 264, 294, 324, 353, 383},
+    {0, 30, 60, 89, 119, 148, 177, 207, 236, 265, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 149, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 118, 147, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 88, 118, 148, 177, 207, 236, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 295, 324, 354, 384},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 177, 207, 236, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 178, 207, 237, 266, 295, 325, 354, 384},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 266, 296, 325, 354, 354},
+    {0, 30, 60, 89, 119, 148, 178, 208, 237, 267, 296, 326, 355, 355},
+    {0, 30, 59, 88, 118, 147, 177, 207, 236, 266, 296, 325, 355, 384},
+    {0, 30, 59, 88, 118, 147, 177, 206, 236, 266, 295, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 265, 294, 324, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 264, 294, 324, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 119, 148, 177, 207, 236, 265, 295, 324, 354, 384},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 265, 295, 324, 354, 354},
+    {0, 29, 59, 89, 118, 148, 178, 207, 237, 266, 296, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 267, 296, 326, 355, 385},
+    {0, 29, 58, 88, 117, 147, 176, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 59, 88, 118, 147, 177, 206, 236, 265, 295, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 264, 294, 324, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 264, 294, 324, 354, 354},
+    {0, 29, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 383},
+    {0, 30, 60, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 60, 90, 119, 149, 178, 208, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 89, 118, 148, 177, 207, 237, 266, 296, 325, 354, 384},
+    {0, 29, 59, 88, 118, 148, 177, 207, 236, 266, 296, 325, 355, 355},
+    {0, 29, 58, 88, 117, 147, 176, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 59, 88, 118, 147, 176, 206, 236, 265, 295, 325, 355, 384},
+    {0, 30, 59, 88, 118, 147, 176, 206, 235, 265, 295, 325, 354, 354},
+    {0, 30, 60, 89, 118, 148, 177, 206, 236, 265, 295, 325, 354, 384},
+    {0, 30, 60, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 149, 178, 208, 237, 266, 296, 325, 355, 384},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 207, 236, 266, 296, 325, 355, 385},
+    {0, 29, 58, 88, 117, 146, 176, 205, 235, 265, 295, 324, 354, 354},
+    {0, 30, 59, 88, 118, 147, 176, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 384},
+    {0, 30, 59, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 89, 118, 148, 178, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 177, 206, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 177, 206, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 266, 295, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 265, 294, 324, 354, 384},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 383},
+    {0, 30, 60, 90, 119, 149, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 266, 296, 325, 355, 384},
+    {0, 30, 59, 89, 118, 148, 177, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 265, 295, 325, 355, 384},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 265, 295, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 264, 294, 324, 353, 353},
+    {0, 30, 60, 90, 119, 149, 178, 207, 237, 266, 295, 325, 355, 384},
+    {0, 30, 60, 89, 119, 149, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 148, 177, 207, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 118, 147, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 88, 118, 147, 177, 207, 236, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 177, 207, 236, 265, 295, 325, 354, 384},
+    {0, 30, 60, 89, 119, 148, 177, 207, 236, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 178, 207, 237, 266, 295, 325, 354, 384},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 266, 296, 325, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 208, 237, 267, 296, 326, 355, 355},
+    {0, 30, 59, 88, 118, 147, 177, 207, 236, 266, 296, 325, 355, 384},
+    {0, 30, 59, 88, 118, 147, 177, 206, 236, 266, 295, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 384},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 119, 148, 177, 207, 236, 265, 295, 324, 354, 384},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 265, 295, 324, 354, 354},
+    {0, 29, 59, 89, 118, 148, 178, 207, 237, 266, 296, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 267, 296, 326, 355, 384},
+    {0, 30, 59, 89, 118, 148, 177, 207, 237, 266, 296, 326, 355, 355},
+    {0, 30, 59, 88, 118, 147, 177, 206, 236, 265, 295, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 264, 294, 324, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 264, 294, 324, 354, 354},
+    {0, 29, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 354},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 265, 295, 324, 354, 383},
+    {0, 30, 60, 90, 119, 149, 178, 208, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 89, 118, 148, 177, 207, 237, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 118, 147, 177, 206, 236, 266, 296, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 207, 237, 266, 296, 326, 355, 355},
+    {0, 30, 59, 88, 118, 147, 176, 206, 236, 265, 295, 325, 354, 384},
+    {0, 30, 59, 88, 118, 147, 176, 206, 235, 265, 295, 325, 354, 354},
+    {0, 30, 60, 89, 118, 148, 177, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 384},
+    {0, 30, 60, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 149, 178, 208, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 148, 177, 207, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 118, 147, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 207, 236, 266, 296, 325, 355, 385},
+    {0, 29, 58, 88, 117, 146, 176, 205, 235, 265, 295, 324, 354, 354},
+    {0, 30, 59, 88, 118, 147, 176, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 384},
+    {0, 30, 59, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 266, 296, 325, 355, 384},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 177, 206, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 206, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 266, 295, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 265, 294, 324, 354, 384},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 206, 236, 265, 294, 324, 354, 354},
+    {0, 29, 59, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 177, 206, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 265, 295, 325, 355, 384},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 148, 177, 207, 236, 265, 295, 325, 354, 354},
+    {0, 30, 60, 90, 119, 149, 178, 207, 237, 266, 295, 325, 355, 384},
+    {0, 30, 60, 89, 119, 148, 178, 207, 237, 266, 295, 325, 355, 355},
+    {0, 29, 59, 88, 118, 148, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 29, 59, 89, 118, 148, 177, 207, 237, 266, 296, 325, 355, 384},
+    {0, 30, 59, 88, 118, 147, 177, 207, 236, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 177, 207, 236, 265, 295, 324, 354, 384},
+    {0, 30, 60, 89, 119, 148, 177, 207, 236, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 178, 207, 237, 266, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 149, 178, 208, 237, 267, 296, 326, 355, 384},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 267, 296, 326, 355, 355},
+    {0, 29, 59, 88, 118, 147, 177, 207, 236, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 324, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 384},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 207, 236, 265, 295, 324, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 266, 295, 325, 354, 384},
+    {0, 29, 59, 89, 118, 148, 178, 207, 237, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 267, 296, 326, 355, 355},
+    {0, 29, 59, 88, 118, 147, 177, 206, 236, 266, 295, 325, 355, 384},
+    {0, 30, 59, 88, 118, 147, 176, 206, 236, 265, 295, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 264, 294, 324, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 205, 235, 264, 294, 324, 354, 354},
+    {0, 29, 59, 89, 118, 147, 177, 206, 235, 265, 294, 324, 354, 354},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 265, 295, 324, 354, 383},
+    {0, 30, 60, 90, 119, 149, 178, 208, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 89, 118, 148, 177, 207, 237, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 207, 237, 266, 296, 326, 355, 384},
+    {0, 30, 59, 89, 118, 148, 177, 207, 236, 266, 296, 326, 355, 355},
+    {0, 30, 59, 89, 118, 147, 176, 206, 235, 265, 295, 325, 354, 354},
+    {0, 30, 60, 89, 118, 148, 177, 206, 236, 265, 295, 325, 355, 384},
+    {0, 30, 60, 89, 118, 148, 177, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 384},
+    {0, 30, 60, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 149, 178, 208, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 148, 177, 207, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 118, 147, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 207, 236, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 265, 295, 325, 354, 384},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 384},
+    {0, 30, 59, 89, 118, 148, 177, 206, 236, 265, 295, 324, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 119, 148, 178, 207, 237, 266, 296, 325, 355, 384},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 177, 206, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 266, 296, 325, 355, 384},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 266, 295, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 265, 294, 324, 354, 354},
+    {0, 30, 59, 89, 118, 148, 177, 206, 236, 265, 294, 324, 354, 384},
+    {0, 29, 59, 89, 118, 148, 177, 206, 236, 265, 294, 324, 354, 354},
+    {0, 29, 59, 89, 119, 148, 177, 207, 236, 266, 295, 324, 354, 384},
+    {0, 29, 59, 89, 118, 148, 177, 207, 236, 266, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 148, 178, 207, 237, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 177, 206, 236, 266, 295, 325, 354, 384},
+    {0, 29, 59, 88, 117, 147, 176, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 236, 265, 295, 325, 355, 355},
+    {0, 29, 59, 88, 118, 147, 176, 206, 235, 264, 294, 324, 354, 383},
+    {0, 30, 60, 89, 119, 148, 177, 206, 236, 265, 295, 325, 354, 354},
+    {0, 30, 60, 90, 119, 149, 178, 207, 237, 266, 295, 325, 355, 384},
+    {0, 30, 60, 89, 119, 148, 178, 207, 237, 266, 295, 325, 354, 354},
+    {0, 30, 60, 89, 119, 149, 178, 208, 237, 267, 296, 326, 355, 355},
+    {0, 29, 59, 89, 118, 148, 177, 207, 237, 266, 296, 325, 355, 384},
+    {0, 29, 59, 88, 118, 147, 177, 207, 236, 266, 296, 325, 355, 355},
+    {0, 29, 59, 88, 117, 147, 176, 206, 235, 265, 295, 325, 354, 354},
+    {0, 30, 59, 89, 118, 147, 177, 206, 235, 265, 295, 325, 354, 384},
+    {0, 30, 59, 89, 118, 147, 176, 206, 235, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 148, 177, 206, 236, 265, 295, 324, 354, 354},
+    {0, 30, 60, 89, 119, 149, 178, 207, 237, 266, 295, 325, 354, 384},
+};
+
+// 公历 1900-2100 年，第 i 个节气（0 为小寒）的日期为 kSolarTermBaseDay[i] 加上偏移，
+// 偏移每个字节存两个节气，低4位为单数
+static constexpr int kSolarTermFirstYear = 1900;
+static constexpr int kSolarTermYearCount = 201;
+
+static constexpr uint8_t kSolarTermBaseDay[24] = {
+    4, 19, 3, 18, 4, 19, 4, 19, 4, 20, 4, 20,
+    6, 22, 6, 22, 6, 22, 7, 22, 6, 21, 6, 21,
+};
+
+static constexpr uint8_t kSolarTermOffsets[][12] = {
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x33, 0x22, 0x23, 0x23, 0x22, 0x23, 0x23, 0x22, 0x22, 0x22},
+    {0x23, 0x22, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x33, 0x22, 0x23, 0x23, 0x22, 0x23, 0x23, 0x22, 0x22, 0x22},
+    {0x23, 0x22, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x33, 0x22, 0x23, 0x23, 0x22, 0x23, 0x23, 0x22, 0x22, 0x22},
+    {0x23, 0x22, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x12},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x32, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x21, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x22, 0x32, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x22, 0x11, 0x11, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x12},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22},
+    {0x22, 0x22, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x21, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x12},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x22, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x22, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x22, 0x11},
+    {0x12, 0x11, 0x22, 0x21, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x12},
+    {0x22, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x22, 0x12},
+    {0x22, 0x11, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x22, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x22, 0x22, 0x11},
+    {0x22, 0x11, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x22, 0x11},
+    {0x22, 0x11, 0x11, 0x10, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x22, 0x11, 0x12, 0x22, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x21, 0x12, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x22, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x10, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11},
+    {0x12, 0x11, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x10, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x10, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x11, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x01},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11},
+    {0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x11, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00},
+    {0x01, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00},
+    {0x11, 0x00, 0x11, 0x10, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01},
+    {0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},
+};
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+生成农历和节气查找表 lunar_calendar_data.h
+农历数据来自 LUNAR_INFO，节气按太阳视黄经计算（北京时间）
+"""
+
+import math
+import sys
+from datetime import date, datetime, timedelta
+
+FIRST_YEAR = 1900
+
+# 每个数据的最后4位代表闰月，第5位代表闰月是否为大月，前12位代表每个月的大小月情况（1为大月30天，0为小月29天）
+# 2033年按紫金山天文台的结果为闰十一月（0x04afb），常见数据表中的闰七月（0x04bd7）是错误的
+LUNAR_INFO = [
+    0x04bd8, 0x04ae0, 0x0a570, 0x054d5, 0x0d260, 0x0d950, 0x16554, 0x056a0, 0x09ad0, 0x055d2,
+    0x04ae0, 0x0a5b6, 0x0a4d0, 0x0d250, 0x1d255, 0x0b540, 0x0d6a0, 0x0ada2, 0x095b0, 0x14977,
+    0x04970, 0x0a4b0, 0x0b4b5, 0x06a50, 0x06d40, 0x1ab54, 0x02b60, 0x09570, 0x052f2, 0x04970,
+    0x06566, 0x0d4a0, 0x0ea50, 0x06e95, 0x05ad0, 0x02b60, 0x186e3, 0x092e0, 0x1c8d7, 0x0c950,
+    0x0d4a0, 0x1d8a6, 0x0b550, 0x056a0, 0x1a5b4, 0x025d0, 0x092d0, 0x0d2b2, 0x0a950, 0x0b557,
+    0x06ca0, 0x0b550, 0x15355, 0x04da0, 0x0a5b0, 0x14573, 0x052b0, 0x0a9a8, 0x0e950, 0x06aa0,
+    0x0aea6, 0x0ab50, 0x04b60, 0x0aae4, 0x0a570, 0x05260, 0x0f263, 0x0d950, 0x05b57, 0x056a0,
+    0x096d0, 0x04dd5, 0x04ad0, 0x0a4d0, 0x0d4d4, 0x0d250, 0x0d558, 0x0b540, 0x0b6a0, 0x195a6,
+    0x095b0, 0x049b0, 0x0a974, 0x0a4b0, 0x0b27a, 0x06a50, 0x06d40, 0x0af46, 0x0ab60, 0x09570,
+    0x04af5, 0x04970, 0x064b0, 0x074a3, 0x0ea50, 0x06b58, 0x055c0, 0x0ab60, 0x096d5, 0x092e0,
+    0x0c960, 0x0d954, 0x0d4a0, 0x0da50, 0x07552, 0x056a0, 0x0abb7, 0x025d0, 0x092d0, 0x0cab5,
+    0x0a950, 0x0b4a0, 0x0baa4, 0x0ad50, 0x055d9, 0x04ba0, 0x0a5b0, 0x15176, 0x052b0, 0x0a930,
+    0x07954, 0x06aa0, 0x0ad50, 0x05b52, 0x04b60, 0x0a6e6, 0x0a4e0, 0x0d260, 0x0ea65, 0x0d530,
+    0x05aa0, 0x076a3, 0x096d0, 0x04afb, 0x04ad0, 0x0a4d0, 0x1d0b6, 0x0d250, 0x0d520, 0x0dd45,
+    0x0b5a0, 0x056d0, 0x055b2, 0x049b0, 0x0a577, 0x0a4b0, 0x0aa50, 0x1b255, 0x06d20, 0x0ada0,
+    0x14b63, 0x09370, 0x049f8, 0x04970, 0x064b0, 0x168a6, 0x0ea50, 0x06b20, 0x1a6c4, 0x0aae0,
+    0x0a2e0, 0x0d2e3, 0x0c960, 0x0d557, 0x0d4a0, 0x0da50, 0x05d55, 0x056a0, 0x0a6d0, 0x055d4,
+    0x052d0, 0x0a9b8, 0x0a950, 0x0b4a0, 0x0b6a6, 0x0ad50, 0x055a0, 0x0aba4, 0x0a5b0, 0x052b0,
+    0x0b273, 0x06930, 0x07337, 0x06aa0, 0x0ad50, 0x14b55, 0x04b60, 0x0a570, 0x054e4, 0x0d160,
+    0x0e968, 0x0d520, 0x0daa0, 0x16aa6, 0x056d0, 0x04ae0, 0x0a9d4, 0x0a2d0, 0x0d150, 0x0f252,
+]
+
+# 农历1900年正月初一
+FIRST_NEW_YEAR = date(1900, 1, 31)
+EPOCH = date(1970, 1, 1)
+
+
+def month_lengths(info):
+    """
+    返回一年中按顺序排列的各月天数，闰月排在同名月份之后
+    """
+    leap = info & 0xf
+    lengths = []
+    for month in range(1, 13):
+        lengths.append(30 if info & (0x10000 >> month) else 29)
+        if month == leap:
+            lengths.append(30 if info & 0x10000 else 29)
+    return lengths
+
+
+def sun_longitude(jde):
+    """
+    太阳视黄经（度），Meeus《天文算法》第25章低精度算法，误差约0.01度
+    """
+    t = (jde - 2451545.0) / 36525
+    l0 = 280.46646 + 36000.76983 * t + 0.0003032 * t * t
+    m = math.radians(357.52911 + 35999.05029 * t - 0.0001537 * t * t)
+    c = (1.914602 - 0.004817 * t - 0.000014 * t * t) * math.sin(m) \
+        + (0.019993 - 0.000101 * t) * math.sin(2 * m) + 0.000289 * math.sin(3 * m)
+    omega = math.radians(125.04 - 1934.136 * t)
+    return (l0 + c - 0.00569 - 0.00478 * math.sin(omega)) % 360
+
+
+def julian_day(dt):
+    return (dt - datetime(2000, 1, 1, 12)).total_seconds() / 86400 + 2451545.0
+
+
+def solar_term_date(year, index):
+    """
+    第 index 个节气（0 为小寒）在北京时间的日期
+    """
+    target = (285 + 15 * index) % 360
+    # 从大致日期开始用牛顿法迭代
+    guess = datetime(year, 1, 6) + timedelta(days=index * 365.2422 / 24)
+    jde = julian_day(guess)
+    for _ in range(20):
+        diff = (target - sun_longitude(jde) + 180) % 360 - 180
+        jde += diff / 360 * 365.2422
+        if abs(diff) < 1e-7:
+            break
+    # 忽略 ΔT（1900-2100年间不超过约3分钟），转为北京时间
+    moment = datetime(2000, 1, 1, 12) + timedelta(days=jde - 2451545.0, hours=8)
+    return moment.date()
+
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    output_path = sys.argv[1] if len(sys.argv) > 1 else "lunar_calendar_data.h"
+
+    # 农历：每年正月初一距1970-01-01的天数，以及各月相对正月初一的起始天数
+    new_years = []
+    month_starts = []
+    new_year = FIRST_NEW_YEAR
+    for info in LUNAR_INFO:
+        new_years.append((new_year - EPOCH).days)
+        starts = [0]
+        for length in month_lengths(info):
+            starts.append(starts[-1] + length)
+        # 没有闰月的年份补齐到14项
+        while len(starts) < 14:
+            starts.append(starts[-1])
+        month_starts.append(starts)
+        new_year += timedelta(days=starts[13])
+    new_years.append((new_year - EPOCH).days)
+
+    # 节气：每年24个节气的日期，存为相对最早日期的偏移，两个节气一个字节
+    last_year = FIRST_YEAR + len(LUNAR_INFO)
+    term_days = [[solar_term_date(year, i).day for i in range(24)] for year in range(FIRST_YEAR, last_year + 1)]
+    for year in range(FIRST_YEAR, last_year + 1):
+        for i in range(24):
+            assert solar_term_date(year, i).month == i // 2 + 1
+    base_days = [min(days[i] for days in term_days) for i in range(24)]
+    term_offsets = []
+    for days in term_days:
+        for i in range(0, 24, 2):
+            low = days[i] - base_days[i]
+            high = days[i + 1] - base_days[i + 1]
+            assert low < 16 and high < 16
+            term_offsets.append(low | (high << 4))
+
+    with open(output_path, "w", encoding="utf-8") as output:
+        output.write(f"""/*
+ * @Description: 农历和节气查找表，由 lunar_table.py 生成
+ * @Generated: 自动生成，请勿手动编辑
+ */
+#pragma once
+#include <cstdint>
+
+static constexpr int kLunarFirstYear = {FIRST_YEAR};
+static constexpr int kLunarYearCount = {len(LUNAR_INFO)};
+
+// 农历每年正月初一距1970-01-01的天数，最后一项为表格结束的日期
+static constexpr int32_t kLunarNewYearDays[] = {{
+{format_array(new_years, 10)}
+}};
+
+// 每年的闰月，0 表示没有闰月
+static constexpr uint8_t kLunarLeapMonth[] = {{
+{format_array([info & 0xf for info in LUNAR_INFO], 20)}
+}};
+
+// 各月（闰月排在同名月份之后）相对正月初一的起始天数，没有闰月的年份最后一项重复
+static constexpr uint16_t kLunarMonthStart[][14] = {{
+""")
+        for starts in month_starts:
+            output.write("    {" + ", ".join(str(v) for v in starts) + "},\n")
+        output.write(f"""}};
+
+// 公历 {FIRST_YEAR}-{last_year} 年，第 i 个节气（0 为小寒）的日期为 kSolarTermBaseDay[i] 加上偏移，
+// 偏移每个字节存两个节气，低4位为单数
+static constexpr int kSolarTermFirstYear = {FIRST_YEAR};
+static constexpr int kSolarTermYearCount = {last_year - FIRST_YEAR + 1};
+
+static constexpr uint8_t kSolarTermBaseDay[24] = {{
+{format_array(base_days, 12)}
+}};
+
+static constexpr uint8_t kSolarTermOffsets[][12] = {{
+""")
+        for year in range(last_year - FIRST_YEAR + 1):
+            row = term_offsets[year * 12:(year + 1) * 12]
+            output.write("    {" + ", ".join(f"0x{v:02x}" for v in row) + "},\n")
+        output.write("};\n")
+    print(f"已生成 {output_path}")
+
+
+if __name__ == "__main__":
+    main()
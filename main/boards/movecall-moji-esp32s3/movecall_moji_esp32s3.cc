@@ -34,6 +34,8 @@ const ThemeColors LIGHT_THEME = {
 // #include "lunar_calendar.h"  // 注释掉农历日历头文件
 #include "location_display.h"
 #include "weather_display.h"  // 添加地址显示头文件
+#include "weather_service.h"
+#include "clock_digits.h"
 
 #include <esp_log.h>
 #include <driver/i2c_master.h>
@@ -45,8 +47,12 @@ const ThemeColors LIGHT_THEME = {
 #include <font_awesome_symbols.h>
 #include <esp_lcd_panel_vendor.h> // 确保有 LCD_RGB_ELEMENT_ORDER_BGR 宏
 
-// 全局分针指针
-lv_obj_t* minute_lbl = nullptr;
+// 表盘数字，主题切换时需要重新渲染
+ClockDigits* hour_digits = nullptr;
+ClockDigits* minute_digits = nullptr;
+ClockDigits* second_digits = nullptr;
+// 每秒失效的像素数，用于评估待机表盘的刷新开销
+static uint32_t clock_invalidated_pixels = 0;
 
 #define DISPLAY_RGB_ORDER  LCD_RGB_ELEMENT_ORDER_BGR
 #define TAG "movecall-moji-esp32s3"
@@ -145,6 +151,8 @@ public:
         ESP_LOGI(TAG, "构造函数中初始化天气显示模块");
         WeatherDisplay::Init();
         WeatherDisplay::SetApiKey("你的私key");
+        // 地址和天气在后台任务中获取，不阻塞 UI
+        WeatherService::GetInstance().Start();
         
         SetupTab1();
         SetupTab2();
@@ -670,12 +678,9 @@ void SetupTab1() {
         lv_obj_set_style_bg_color(tab2, tab2_bg, 0);
         lv_obj_set_style_bg_opa(tab2, LV_OPA_COVER, 0);
 
-        // 创建秒钟标签，使用time30字体
-        lv_obj_t *second_label = lv_label_create(tab2);
-        lv_obj_set_style_text_font(second_label, &time40, 0);
-        lv_obj_set_style_text_color(second_label, tab2_text, 0);
-        lv_obj_align(second_label, LV_ALIGN_TOP_MID, 0, 10);    
-        lv_label_set_text(second_label, "00");
+        // 创建秒钟数字，使用time40字体
+        ::second_digits = new ClockDigits(tab2, &time40, "00", tab2_text, tab2_bg);
+        lv_obj_align(::second_digits->GetObject(), LV_ALIGN_TOP_MID, 0, 10);
         
         // Create date label directly on tab2
         lv_obj_t *date_label = lv_label_create(tab2);
@@ -707,17 +712,11 @@ void SetupTab1() {
         // 设置容器位置为屏幕中央
         lv_obj_align(time_container, LV_ALIGN_CENTER, 0, 0);
         
-        // 创建小时标签
-        lv_obj_t *hour_label = lv_label_create(time_container);
-        lv_obj_set_style_text_font(hour_label, &time70, 0);
-        lv_obj_set_style_text_color(hour_label, tab2_text, 0);
-        lv_label_set_text(hour_label, "00 :");
+        // 创建小时数字，冒号两侧留出空格的宽度
+        ::hour_digits = new ClockDigits(time_container, &time70, "00:", tab2_text, tab2_bg);
         
-        // 创建分钟标签，使用橙色显示
-        lv_obj_t *minute_label = lv_label_create(time_container);
-        lv_obj_set_style_text_font(minute_label, &time70, 0);
-        lv_obj_set_style_text_color(minute_label, lv_color_hex(0x95EC69), 0); // 橙色
-        lv_label_set_text(minute_label, " 00");
+        // 创建分钟数字，使用强调色显示
+        ::minute_digits = new ClockDigits(time_container, &time70, "00", GetMinuteColor(), tab2_bg);
         
         // Create location label directly on tab2 (replacing lunar label)
         lv_obj_t *location_label = lv_label_create(tab2);
@@ -729,27 +728,27 @@ void SetupTab1() {
         lv_label_set_text(location_label, "正在获取地址...");
         lv_obj_align(location_label, LV_ALIGN_BOTTOM_MID, 0, -36);
         
+        // 统计每秒失效的区域，只计表盘页面可见时的刷新，聊天页面的刷新不计入
+        static lv_obj_t* clock_tabview = tabview_;
+        lv_display_add_event_cb(display_, [](lv_event_t* e) {
+            if (lv_tabview_get_tab_active(clock_tabview) != 1) {
+                return;
+            }
+            auto area = (const lv_area_t*)lv_event_get_param(e);
+            clock_invalidated_pixels += lv_area_get_size(area);
+        }, LV_EVENT_INVALIDATE_AREA, nullptr);
+
         // 定时器更新时间
-        static lv_obj_t* hour_lbl = hour_label;
-        static lv_obj_t* second_lbl = second_label;
         static lv_obj_t* date_lbl = date_label;
         //static lv_obj_t* year_lbl = year_label;
         static lv_obj_t* weekday_lbl = weekday_label;
         static lv_obj_t* location_lbl = location_label;  // 替换农历标签为地址标签
         
-        // 使用全局变量来跟踪更新状态
-        static bool location_updated = false;
-        static bool weather_updated = false;
-
-        
-        // 注意：此时地址显示模块还没有初始化，所以不立即更新
-        // 初始化会在SetupUI函数中进行
-        
         ESP_LOGI(TAG, "创建定时器");
         lv_timer_create([](lv_timer_t *t) {
             
 
-            if (!hour_lbl || !::minute_lbl || !second_lbl || 
+            if (!::hour_digits || !::minute_digits || !::second_digits ||
                 !date_lbl || !weekday_lbl || !location_lbl) {
                 ESP_LOGE(TAG, "定时器标签检查失败");
                 return;
@@ -762,19 +761,33 @@ void SetupTab1() {
             time(&now);
             localtime_r(&now, &timeinfo);
             
-            // 格式化时、分、秒
-            char hour_str[6];
+            // 上一秒内失效的像素，每分钟按表盘实际显示的秒数输出一次平均值
+            static uint32_t invalidated_total = 0;
+            static uint32_t invalidated_ticks = 0;
+            if (lv_tabview_get_tab_active(clock_tabview) == 1) {
+                invalidated_total += clock_invalidated_pixels;
+                invalidated_ticks++;
+            }
+            clock_invalidated_pixels = 0;
+            if (timeinfo.tm_sec == 0 && invalidated_ticks > 0) {
+                ESP_LOGI(TAG, "Clock invalidated %lu px/s over %lu s", invalidated_total / invalidated_ticks,
+                    invalidated_ticks);
+                invalidated_total = 0;
+                invalidated_ticks = 0;
+            }
+
+            // 格式化时、分、秒，只有数值变化的数字会被重绘
+            char hour_str[4];
             char minute_str[3];
             char second_str[3];
             
-            sprintf(hour_str, "%02d : ", timeinfo.tm_hour);
-            sprintf(minute_str, "%02d", timeinfo.tm_min);
-            sprintf(second_str, "%02d", timeinfo.tm_sec);
+            snprintf(hour_str, sizeof(hour_str), "%02d:", timeinfo.tm_hour);
+            snprintf(minute_str, sizeof(minute_str), "%02d", timeinfo.tm_min);
+            snprintf(second_str, sizeof(second_str), "%02d", timeinfo.tm_sec);
             
-            // 更新时间标签
-            lv_label_set_text(hour_lbl, hour_str);
-            lv_label_set_text(::minute_lbl, minute_str);
-            lv_label_set_text(second_lbl, second_str);
+            ::hour_digits->SetText(hour_str);
+            ::minute_digits->SetText(minute_str);
+            ::second_digits->SetText(second_str);
             
             // Format year
             char year_str[12];
@@ -790,10 +803,13 @@ void SetupTab1() {
             // Get day of week in Chinese
             const char *weekdays[] = {"周日", "周一", "周二", "周三", "周四", "周五", "周六"};
             
-            // Update date and weekday labels
-            lv_label_set_text(date_lbl, date_str);
+            // Update date and weekday labels, they only change once a day
+            if (strcmp(lv_label_get_text(date_lbl), date_str) != 0) {
+                lv_label_set_text(date_lbl, date_str);
+            }
             
-            if (timeinfo.tm_wday >= 0 && timeinfo.tm_wday < 7) {
+            if (timeinfo.tm_wday >= 0 && timeinfo.tm_wday < 7 &&
+                strcmp(lv_label_get_text(weekday_lbl), weekdays[timeinfo.tm_wday]) != 0) {
                 lv_label_set_text(weekday_lbl, weekdays[timeinfo.tm_wday]);
             }
             
@@ -805,76 +821,25 @@ void SetupTab1() {
             // );
             // lv_label_set_text(lunar_lbl, lunar_date.c_str());
             
-            // 更新计数器（每秒增加1）
-            static int update_counter = 0;  // 用于2小时更新计数
-            static int display_mode_counter = 0;  // 用于显示切换计数
-            update_counter++;
-            display_mode_counter++;
-            
-            // 第一次更新地址和天气（开机时）
-            if (!location_updated || !weather_updated) {
-                ESP_LOGI(TAG, "首次更新地址和天气");
-                // 更新地址
-                LocationDisplay::UpdateLocation();
-                std::string location_str = LocationDisplay::GetLocationString();
-                
-                // 只有获取到真实地址才标记为已更新
-                if (location_str != "地址服务未初始化" && 
-                    location_str != "正在获取地址..." && 
-                    location_str != "WiFi未连接" &&
-                    location_str != "网络请求失败" &&
-                    location_str != "服务器响应错误") {
-                    location_updated = true;
-                    lv_label_set_text(location_lbl, location_str.c_str());
-                    ESP_LOGI(TAG, "地址更新成功: %s", location_str.c_str());
-                    
-                    // 获取到地址后更新天气
-                    if (!weather_updated) {
-                        WeatherDisplay::UpdateWeather(location_str);
-                        std::string weather_str = WeatherDisplay::GetWeatherString();
-                        if (weather_str != "获取中..." && 
-                            weather_str != "服务未初始化" &&
-                            weather_str != "API密钥未设置") {
-                            weather_updated = true;
-                            ESP_LOGI(TAG, "天气更新成功: %s", weather_str.c_str());
-                        }
-                    }
-                }
-            } else {
-                // 每2小时（7200秒）更新一次数据
-                if (update_counter >= 7200) {
-                    ESP_LOGI(TAG, "执行2小时定时更新");
-                    update_counter = 0;
-                    LocationDisplay::UpdateLocation();
-                    std::string location_str = LocationDisplay::GetLocationString();
-                    if (location_str != "地址服务未初始化" && 
-                        location_str != "正在获取地址..." && 
-                        location_str != "WiFi未连接") {
-                        ESP_LOGI(TAG, "地址更新成功: %s", location_str.c_str());
-                        WeatherDisplay::UpdateWeather(location_str);
-                        std::string weather_str = WeatherDisplay::GetWeatherString();
-                        ESP_LOGI(TAG, "天气更新成功: %s", weather_str.c_str());
-                    }
-                }
-                
-                // 交替显示地址和天气（15秒地址，20秒天气）
-                if (display_mode_counter >= 35) {  // 15 + 20 = 35秒一个完整周期
-                    display_mode_counter = 0;
-                }
-                
-                if (display_mode_counter < 15) {  // 显示地址
-                    std::string location_str = LocationDisplay::GetLocationString();
-                    lv_label_set_text(location_lbl, location_str.c_str());
-                } else {  // 显示天气
-                    std::string weather_str = WeatherDisplay::GetWeatherString();
-                    lv_label_set_text(location_lbl, weather_str.c_str());
+            // 地址和天气由后台任务获取，这里只读取最新的快照（15秒地址，20秒天气交替显示）
+            static int display_mode_counter = 0;
+            display_mode_counter = (display_mode_counter + 1) % 35;
+            auto snapshot = WeatherService::GetInstance().GetSnapshot();
+            const char* info_str = "正在获取地址...";
+            if (!snapshot->location.empty()) {
+                if (display_mode_counter < 15 || snapshot->weather.empty()) {
+                    info_str = snapshot->location.c_str();
+                } else {
+                    info_str = snapshot->weather.c_str();
                 }
             }
+            if (strcmp(lv_label_get_text(location_lbl), info_str) != 0) {
+                lv_label_set_text(location_lbl, info_str);
+            }
             
             lv_unlock();
             
         }, 1000, NULL);
-        ::minute_lbl = minute_label;
     }
 
     void UpdateTab2Theme() {
@@ -892,6 +857,11 @@ void SetupTab1() {
             lv_obj_set_style_text_color(tab2, tab2_text, 0);
             UpdateTab2Theme_Recursive(tab2, tab2_text);
         }
+        if (::hour_digits) {
+            ::hour_digits->SetColors(tab2_text, tab2_bg);
+            ::minute_digits->SetColors(GetMinuteColor(), tab2_bg);
+            ::second_digits->SetColors(tab2_text, tab2_bg);
+        }
     }
 
     void SetupUI() {
@@ -1168,17 +1138,16 @@ void SetupTab1() {
 private:
     // 静态回调函数
  
+    lv_color_t GetMinuteColor() {
+        if (current_theme_name_ == "light" || current_theme_name_ == "LIGHT") {
+            return lv_color_hex(0x95EC69); // 绿色
+        }
+        return lv_color_hex(0xFFA500); // 橙色
+    }
+
     void UpdateTab2Theme_Recursive(lv_obj_t* obj, lv_color_t tab2_text) {
         if (lv_obj_check_type(obj, &lv_label_class)) {
-            if (obj == ::minute_lbl) {
-                if (current_theme_name_ == "light" || current_theme_name_ == "LIGHT") {
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0x95EC69), 0); // 绿色
-                } else {
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0xFFA500), 0); // 橙色
-                }
-            } else {
-                lv_obj_set_style_text_color(obj, tab2_text, 0);
-            }
+            lv_obj_set_style_text_color(obj, tab2_text, 0);
         }
         // 递归遍历所有子对象
         uint32_t cnt = lv_obj_get_child_cnt(obj);
@@ -261,8 +261,8 @@ WeatherInfo GetWeatherByAddress(const std::string& address) {
     return weather;
 }
 
-void UpdateWeather(const std::string& address) {
-    GetWeatherByAddress(address);
+bool UpdateWeather(const std::string& address) {
+    return GetWeatherByAddress(address).is_valid;
 }
 
 const char* GetWeatherString() {
@@ -27,6 +27,6 @@ namespace WeatherDisplay {
     // 获取天气显示字符串
     const char* GetWeatherString();
     
-    // 更新天气信息
-    void UpdateWeather(const std::string& address);
+    // 更新天气信息，成功获取到天气时返回 true
+    bool UpdateWeather(const std::string& address);
 }
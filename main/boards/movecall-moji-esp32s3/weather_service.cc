@@ -0,0 +1,84 @@
+#include "weather_service.h"
+#include "location_display.h"
+#include "weather_display.h"
+#include "settings.h"
+
+#include <esp_log.h>
+#include <wifi_station.h>
+#include <algorithm>
+
+#define TAG "WeatherService"
+
+WeatherService::WeatherService() {
+    // 读取上次缓存的结果
+    auto snapshot = std::make_shared<WeatherSnapshot>();
+    Settings settings("weather", false);
+    snapshot->location = settings.GetString("location");
+    snapshot->weather = settings.GetString("weather");
+    snapshot->from_cache = !snapshot->location.empty();
+    snapshot_ = std::move(snapshot);
+}
+
+void WeatherService::Start() {
+    if (task_handle_ != nullptr) {
+        return;
+    }
+    xTaskCreate([](void* arg) {
+        auto service = (WeatherService*)arg;
+        service->FetchTask();
+        vTaskDelete(NULL);
+    }, "weather_fetch", 4096 * 2, this, 2, &task_handle_);
+}
+
+std::shared_ptr<const WeatherSnapshot> WeatherService::GetSnapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshot_;
+}
+
+void WeatherService::Publish(std::shared_ptr<const WeatherSnapshot> snapshot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot_ = std::move(snapshot);
+}
+
+void WeatherService::FetchTask() {
+    int failures = 0;
+    while (true) {
+        if (!WifiStation::GetInstance().IsConnected()) {
+            vTaskDelay(pdMS_TO_TICKS(WEATHER_WIFI_CHECK_INTERVAL_MS));
+            continue;
+        }
+
+        uint32_t delay_ms;
+        if (Fetch()) {
+            failures = 0;
+            delay_ms = WEATHER_REFRESH_INTERVAL_MS;
+        } else {
+            delay_ms = std::min<uint32_t>(WEATHER_RETRY_MIN_MS << std::min(failures, 8), WEATHER_RETRY_MAX_MS);
+            failures++;
+            ESP_LOGW(TAG, "Fetch failed (%d), retry in %lu ms", failures, delay_ms);
+        }
+        vTaskDelay(pdMS_TO_TICKS(delay_ms));
+    }
+}
+
+bool WeatherService::Fetch() {
+    if (!LocationDisplay::UpdateLocation()) {
+        return false;
+    }
+
+    // 天气获取失败时保留上次的天气
+    auto snapshot = std::make_shared<WeatherSnapshot>(*GetSnapshot());
+    snapshot->location = LocationDisplay::GetLocationString();
+    bool weather_ok = WeatherDisplay::UpdateWeather(snapshot->location);
+    if (weather_ok) {
+        snapshot->weather = WeatherDisplay::GetWeatherString();
+    }
+    snapshot->from_cache = false;
+
+    Settings settings("weather", true);
+    settings.SetString("location", snapshot->location);
+    settings.SetString("weather", snapshot->weather);
+    ESP_LOGI(TAG, "Location: %s, weather: %s", snapshot->location.c_str(), snapshot->weather.c_str());
+    Publish(std::move(snapshot));
+    return weather_ok;
+}
@@ -0,0 +1,51 @@
+/*
+ * @Description: 地址和天气的后台获取服务
+ */
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define WEATHER_REFRESH_INTERVAL_MS (2 * 60 * 60 * 1000)
+#define WEATHER_RETRY_MIN_MS 5000
+#define WEATHER_RETRY_MAX_MS (10 * 60 * 1000)
+#define WEATHER_WIFI_CHECK_INTERVAL_MS 2000
+
+// 发布后不再修改，读取方持有 shared_ptr 即可安全访问
+struct WeatherSnapshot {
+    std::string location;       // 为空表示还没有获取到地址
+    std::string weather;        // 为空表示还没有获取到天气
+    bool from_cache = false;
+};
+
+/*
+ * 在独立任务中请求地址和天气，失败时按指数退避重试，结果缓存在 NVS 中，
+ * 重启后立即显示上次的结果。UI 定时器只读取快照，不会被 HTTP 请求阻塞。
+ */
+class WeatherService {
+public:
+    static WeatherService& GetInstance() {
+        static WeatherService instance;
+        return instance;
+    }
+    WeatherService(const WeatherService&) = delete;
+    WeatherService& operator=(const WeatherService&) = delete;
+
+    void Start();
+    std::shared_ptr<const WeatherSnapshot> GetSnapshot();
+
+private:
+    WeatherService();
+
+    std::mutex mutex_;
+    std::shared_ptr<const WeatherSnapshot> snapshot_;
+    TaskHandle_t task_handle_ = nullptr;
+
+    void FetchTask();
+    bool Fetch();
+    void Publish(std::shared_ptr<const WeatherSnapshot> snapshot);
+};
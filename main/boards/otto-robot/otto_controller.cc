@@ -5,7 +5,10 @@
 #include <cJSON.h>
 #include <esp_log.h>
 
+#include <atomic>
 #include <cstring>
+#include <mutex>
+#include <stdexcept>
 
 #include "application.h"
 #include "board.h"
@@ -24,6 +27,9 @@ private:
     QueueHandle_t action_queue_;
     bool has_hands_ = false;
     bool is_action_in_progress_ = false;
+    // 每次停止加一，入队时记下当时的值，早于最近一次停止的动作出队后直接丢弃
+    std::atomic<uint32_t> stop_generation_{0};
+    std::mutex stop_mutex_;
 
     struct OttoActionParams {
         int action_type;
@@ -31,6 +37,7 @@ private:
         int speed;
         int direction;
         int amount;
+        uint32_t generation;
     };
 
     enum ActionType {
@@ -60,8 +67,17 @@ private:
 
         while (true) {
             if (xQueueReceive(controller->action_queue_, &params, pdMS_TO_TICKS(1000)) == pdTRUE) {
+                // 检查和 Resume() 与停止工具互斥，停止不会夹在两者之间被 Resume() 撤销
+                {
+                    std::lock_guard<std::mutex> lock(controller->stop_mutex_);
+                    if (params.generation != controller->stop_generation_.load()) {
+                        ESP_LOGI(TAG, "丢弃停止前的动作: %d", params.action_type);
+                        continue;
+                    }
+                    controller->is_action_in_progress_ = true;
+                    controller->otto_.Resume();
+                }
                 ESP_LOGI(TAG, "执行动作: %d", params.action_type);
-                controller->is_action_in_progress_ = true;
 
                 switch (params.action_type) {
                     case ACTION_WALK:
@@ -130,6 +146,8 @@ private:
                 if (params.action_type != ACTION_HOME) {
                     controller->otto_.Home(params.action_type < ACTION_HANDS_UP);
                 }
+                // 动作只是规划入队，等舵机执行完或者被取消
+                controller->otto_.WaitUntilIdle();
                 controller->is_action_in_progress_ = false;
                 vTaskDelay(pdMS_TO_TICKS(20));
             }
@@ -143,6 +161,7 @@ private:
         }
     }
 
+    // 队列满时抛出异常，由 McpServer 把错误返回给调用方
     void QueueAction(int action_type, int steps, int speed, int direction, int amount) {
         // 检查手部动作
         if ((action_type >= ACTION_HANDS_UP && action_type <= ACTION_HAND_WAVE) && !has_hands_) {
@@ -153,8 +172,13 @@ private:
         ESP_LOGI(TAG, "动作控制: 类型=%d, 步数=%d, 速度=%d, 方向=%d, 幅度=%d", action_type, steps,
                  speed, direction, amount);
 
-        OttoActionParams params = {action_type, steps, speed, direction, amount};
-        xQueueSend(action_queue_, &params, portMAX_DELAY);
+        OttoActionParams params = {action_type, steps, speed, direction, amount,
+                                   stop_generation_.load()};
+        // 不阻塞调用工具的线程
+        if (xQueueSend(action_queue_, &params, 0) != pdTRUE) {
+            ESP_LOGW(TAG, "动作队列已满，忽略动作: %d", action_type);
+            throw std::runtime_error("Action queue is full, wait for the current actions to finish");
+        }
         StartActionTaskIfNeeded();
     }
 
@@ -358,12 +382,13 @@ public:
         // 系统工具
         mcp_server.AddTool("self.otto.stop", "立即停止", PropertyList(),
                            [this](const PropertyList& properties) -> ReturnValue {
-                               if (action_task_handle_ != nullptr) {
-                                   vTaskDelete(action_task_handle_);
-                                   action_task_handle_ = nullptr;
+                               // 清空队列并取消正在执行的动作，舵机停在当前位置后复位
+                               {
+                                   std::lock_guard<std::mutex> lock(stop_mutex_);
+                                   stop_generation_++;
+                                   xQueueReset(action_queue_);
+                                   otto_.Stop();
                                }
-                               is_action_in_progress_ = false;
-                               xQueueReset(action_queue_);
 
                                QueueAction(ACTION_HOME, 1, 1000, 1, 0);
                                return true;
@@ -12,41 +12,28 @@
 #define TAG "OttoEmojiDisplay"
 
 // 表情映射表 - 将原版21种表情映射到现有6个GIF
-const OttoEmojiDisplay::EmotionMap OttoEmojiDisplay::emotion_maps_[] = {
-    // 中性/平静类表情 -> staticstate
-    {"neutral", &staticstate},
-    {"relaxed", &staticstate},
-    {"sleepy", &staticstate},
-
-    // 积极/开心类表情 -> happy
-    {"happy", &happy},
-    {"laughing", &happy},
-    {"funny", &happy},
-    {"loving", &happy},
-    {"confident", &happy},
-    {"winking", &happy},
-    {"cool", &happy},
-    {"delicious", &happy},
-    {"kissy", &happy},
-    {"silly", &happy},
-
-    // 悲伤类表情 -> sad
-    {"sad", &sad},
-    {"crying", &sad},
-
-    // 愤怒类表情 -> anger
-    {"angry", &anger},
-
-    // 惊讶类表情 -> scare
-    {"surprised", &scare},
-    {"shocked", &scare},
-
-    // 思考/困惑类表情 -> buxue
-    {"thinking", &buxue},
-    {"confused", &buxue},
-    {"embarrassed", &buxue},
-
-    {nullptr, nullptr}  // 结束标记
+const lv_img_dsc_t* const OttoEmojiDisplay::emotion_gifs_[kEmotionCount] = {
+    &staticstate,  // neutral
+    &happy,        // happy
+    &happy,        // laughing
+    &happy,        // funny
+    &sad,          // sad
+    &anger,        // angry
+    &sad,          // crying
+    &happy,        // loving
+    &buxue,        // embarrassed
+    &scare,        // surprised
+    &scare,        // shocked
+    &buxue,        // thinking
+    &happy,        // winking
+    &happy,        // cool
+    &staticstate,  // relaxed
+    &happy,        // delicious
+    &happy,        // kissy
+    &happy,        // confident
+    &staticstate,  // sleepy
+    &happy,        // silly
+    &buxue,        // confused
 };
 
 OttoEmojiDisplay::OttoEmojiDisplay(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_handle_t panel,
@@ -111,23 +98,14 @@ void OttoEmojiDisplay::SetupGifContainer() {
     LcdDisplay::SetTheme("dark");
 }
 
-void OttoEmojiDisplay::SetEmotion(const char* emotion) {
-    if (!emotion || !emotion_gif_) {
+void OttoEmojiDisplay::SetEmotion(Emotion emotion) {
+    if (!emotion_gif_ || emotion >= kEmotionCount) {
         return;
     }
 
     DisplayLockGuard lock(this);
-
-    for (const auto& map : emotion_maps_) {
-        if (map.name && strcmp(map.name, emotion) == 0) {
-            lv_gif_set_src(emotion_gif_, map.gif);
-            ESP_LOGI(TAG, "设置表情: %s", emotion);
-            return;
-        }
-    }
-
-    lv_gif_set_src(emotion_gif_, &staticstate);
-    ESP_LOGI(TAG, "未知表情'%s'，使用默认", emotion);
+    lv_gif_set_src(emotion_gif_, emotion_gifs_[emotion]);
+    ESP_LOGI(TAG, "设置表情: %s", EmotionToString(emotion));
 }
 
 void OttoEmojiDisplay::SetChatMessage(const char* role, const char* content) {
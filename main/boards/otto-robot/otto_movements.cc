@@ -2,13 +2,11 @@
 
 #include <algorithm>
 
-#include "oscillator.h"
-
 static const char* TAG = "OttoMovements";
 
 #define HAND_HOME_POSITION 45
 
-Otto::Otto() {
+Otto::Otto() : motion_(SERVO_COUNT) {
     is_otto_resting_ = false;
     has_hands_ = false;
     // 初始化所有舵机管脚为-1（未连接）
@@ -22,10 +20,6 @@ Otto::~Otto() {
     DetachServos();
 }
 
-unsigned long IRAM_ATTR millis() {
-    return (unsigned long)(esp_timer_get_time() / 1000ULL);
-}
-
 void Otto::Init(int left_leg, int right_leg, int left_foot, int right_foot, int left_hand,
                 int right_hand) {
     servo_pins_[LEFT_LEG] = left_leg;
@@ -48,7 +42,7 @@ void Otto::Init(int left_leg, int right_leg, int left_foot, int right_foot, int
 void Otto::AttachServos() {
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].Attach(servo_pins_[i]);
+            motion_.Attach(i, servo_pins_[i]);
         }
     }
 }
@@ -56,7 +50,7 @@ void Otto::AttachServos() {
 void Otto::DetachServos() {
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].Detach();
+            motion_.Detach(i);
         }
     }
 }
@@ -78,66 +72,38 @@ void Otto::SetTrims(int left_leg, int right_leg, int left_foot, int right_foot,
 
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].SetTrim(servo_trim_[i]);
+            motion_.SetTrim(i, servo_trim_[i]);
         }
     }
 }
 
+///////////////////////////////////////////////////////////////////
+//-- MOTION QUEUE -----------------------------------------------//
+///////////////////////////////////////////////////////////////////
+void Otto::Stop() {
+    motion_.Cancel();
+    // 舵机可能停在半路，下一次 Home() 需要重新复位
+    is_otto_resting_ = false;
+}
+
+void Otto::Resume() {
+    motion_.Resume();
+}
+
+void Otto::WaitUntilIdle() {
+    motion_.WaitUntilIdle();
+}
+
 ///////////////////////////////////////////////////////////////////
 //-- BASIC MOTION FUNCTIONS -------------------------------------//
 ///////////////////////////////////////////////////////////////////
-void Otto::MoveServos(int time, int servo_target[]) {
+bool Otto::MoveServos(int time, int servo_target[]) {
     if (GetRestState() == true) {
         SetRestState(false);
     }
 
-    final_time_ = millis() + time;
-    if (time > 10) {
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1) {
-                increment_[i] = (servo_target[i] - servo_[i].GetPosition()) / (time / 10.0);
-            }
-        }
-
-        for (int iteration = 1; millis() < final_time_; iteration++) {
-            partial_time_ = millis() + 10;
-            for (int i = 0; i < SERVO_COUNT; i++) {
-                if (servo_pins_[i] != -1) {
-                    servo_[i].SetPosition(servo_[i].GetPosition() + increment_[i]);
-                }
-            }
-            vTaskDelay(pdMS_TO_TICKS(10));
-        }
-    } else {
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1) {
-                servo_[i].SetPosition(servo_target[i]);
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(time));
-    }
-
-    // final adjustment to the target.
-    bool f = true;
-    int adjustment_count = 0;
-    while (f && adjustment_count < 10) {
-        f = false;
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1 && servo_target[i] != servo_[i].GetPosition()) {
-                f = true;
-                break;
-            }
-        }
-        if (f) {
-            for (int i = 0; i < SERVO_COUNT; i++) {
-                if (servo_pins_[i] != -1) {
-                    servo_[i].SetPosition(servo_target[i]);
-                }
-            }
-            vTaskDelay(pdMS_TO_TICKS(10));
-            adjustment_count++;
-        }
-    };
+    // 所有舵机按最小加加速度曲线同时到达目标，Stop() 之后不会入队
+    return motion_.Move(servo_target, time);
 }
 
 void Otto::MoveSingle(int position, int servo_number) {
@@ -151,33 +117,19 @@ void Otto::MoveSingle(int position, int servo_number) {
     }
 
     if (servo_number >= 0 && servo_number < SERVO_COUNT && servo_pins_[servo_number] != -1) {
-        servo_[servo_number].SetPosition(position);
+        int target[SERVO_COUNT] = {};
+        target[servo_number] = position;
+        motion_.Move(target, 0, 1 << servo_number);
     }
 }
 
 void Otto::OscillateServos(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
                            double phase_diff[SERVO_COUNT], float cycle = 1) {
+    int center[SERVO_COUNT];
     for (int i = 0; i < SERVO_COUNT; i++) {
-        if (servo_pins_[i] != -1) {
-            servo_[i].SetO(offset[i]);
-            servo_[i].SetA(amplitude[i]);
-            servo_[i].SetT(period);
-            servo_[i].SetPh(phase_diff[i]);
-        }
+        center[i] = offset[i] + 90;
     }
-
-    double ref = millis();
-    double end_time = period * cycle + ref;
-
-    while (millis() < end_time) {
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            if (servo_pins_[i] != -1) {
-                servo_[i].Refresh();
-            }
-        }
-        vTaskDelay(5);
-    }
-    vTaskDelay(pdMS_TO_TICKS(10));
+    motion_.Oscillate(amplitude, center, phase_diff, period, cycle);
 }
 
 void Otto::Execute(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
@@ -186,16 +138,8 @@ void Otto::Execute(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int peri
         SetRestState(false);
     }
 
-    int cycles = (int)steps;
-
-    //-- Execute complete cycles
-    if (cycles >= 1)
-        for (int i = 0; i < cycles; i++)
-            OscillateServos(amplitude, offset, period, phase_diff);
-
-    //-- Execute the final not complete cycle
-    OscillateServos(amplitude, offset, period, phase_diff, (float)steps - cycles);
-    vTaskDelay(pdMS_TO_TICKS(10));
+    //-- All the cycles, including the final not complete one, run as one continuous oscillation
+    OscillateServos(amplitude, offset, period, phase_diff, steps);
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -216,7 +160,7 @@ void Otto::Home(bool hands_down) {
                     }
                 } else {
                     // 如果不需要复位手部，保持当前位置
-                    homes[i] = servo_[i].GetPosition();
+                    homes[i] = motion_.GetPosition(i);
                 }
             } else {
                 // 腿部和脚部舵机始终复位
@@ -224,11 +168,15 @@ void Otto::Home(bool hands_down) {
             }
         }
 
-        MoveServos(500, homes);
-        is_otto_resting_ = true;
+        if (MoveServos(500, homes)) {
+            is_otto_resting_ = true;
+        }
     }
 
-    vTaskDelay(pdMS_TO_TICKS(200));
+    // Stop() 可能正好在复位动作入队后取消，这时后面的 Hold 也会失败，舵机不一定在初始位置
+    if (!motion_.Hold(200)) {
+        is_otto_resting_ = false;
+    }
 }
 
 bool Otto::GetRestState() {
@@ -366,7 +314,7 @@ void Otto::Bend(int steps, int period, int dir) {
     for (int i = 0; i < steps; i++) {
         MoveServos(T2 / 2, bend1);
         MoveServos(T2 / 2, bend2);
-        vTaskDelay(pdMS_TO_TICKS(period * 0.8));
+        motion_.Hold(period * 4 / 5);
         MoveServos(500, homes);
     }
 }
@@ -417,7 +365,7 @@ void Otto::ShakeLeg(int steps, int period, int dir) {
         MoveServos(500, homes);  // Return to home position
     }
 
-    vTaskDelay(pdMS_TO_TICKS(period));
+    motion_.Hold(period);
 }
 
 //---------------------------------------------------------
@@ -607,10 +555,10 @@ void Otto::HandsUp(int period, int dir) {
         target[RIGHT_HAND] = 10;
     } else if (dir == 1) {
         target[LEFT_HAND] = 170;
-        target[RIGHT_HAND] = servo_[RIGHT_HAND].GetPosition();
+        target[RIGHT_HAND] = motion_.GetPosition(RIGHT_HAND);
     } else if (dir == -1) {
         target[RIGHT_HAND] = 10;
-        target[LEFT_HAND] = servo_[LEFT_HAND].GetPosition();
+        target[LEFT_HAND] = motion_.GetPosition(LEFT_HAND);
     }
 
     MoveServos(period, target);
@@ -630,9 +578,9 @@ void Otto::HandsDown(int period, int dir) {
     int target[SERVO_COUNT] = {90, 90, 90, 90, HAND_HOME_POSITION, 180 - HAND_HOME_POSITION};
 
     if (dir == 1) {
-        target[RIGHT_HAND] = servo_[RIGHT_HAND].GetPosition();
+        target[RIGHT_HAND] = motion_.GetPosition(RIGHT_HAND);
     } else if (dir == -1) {
-        target[LEFT_HAND] = servo_[LEFT_HAND].GetPosition();
+        target[LEFT_HAND] = motion_.GetPosition(LEFT_HAND);
     }
 
     MoveServos(period, target);
@@ -659,7 +607,7 @@ void Otto::HandWave(int period, int dir) {
     int current_positions[SERVO_COUNT];
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            current_positions[i] = servo_[i].GetPosition();
+            current_positions[i] = motion_.GetPosition(i);
         } else {
             current_positions[i] = 90;
         }
@@ -674,24 +622,24 @@ void Otto::HandWave(int period, int dir) {
 
     current_positions[servo_index] = position;
     MoveServos(300, current_positions);
-    vTaskDelay(pdMS_TO_TICKS(300));
+    motion_.Hold(300);
 
     // 左右摆动5次
     for (int i = 0; i < 5; i++) {
         if (servo_index == LEFT_HAND) {
             current_positions[servo_index] = position - 30;
             MoveServos(period / 10, current_positions);
-            vTaskDelay(pdMS_TO_TICKS(period / 10));
+            motion_.Hold(period / 10);
             current_positions[servo_index] = position + 30;
             MoveServos(period / 10, current_positions);
         } else {
             current_positions[servo_index] = position + 30;
             MoveServos(period / 10, current_positions);
-            vTaskDelay(pdMS_TO_TICKS(period / 10));
+            motion_.Hold(period / 10);
             current_positions[servo_index] = position - 30;
             MoveServos(period / 10, current_positions);
         }
-        vTaskDelay(pdMS_TO_TICKS(period / 10));
+        motion_.Hold(period / 10);
     }
 
     if (servo_index == LEFT_HAND) {
@@ -715,7 +663,7 @@ void Otto::HandWaveBoth(int period) {
     int current_positions[SERVO_COUNT];
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            current_positions[i] = servo_[i].GetPosition();
+            current_positions[i] = motion_.GetPosition(i);
         } else {
             current_positions[i] = 90;
         }
@@ -749,7 +697,7 @@ void Otto::HandWaveBoth(int period) {
 void Otto::EnableServoLimit(int diff_limit) {
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].SetLimiter(diff_limit);
+            motion_.SetSpeedLimit(i, diff_limit);
         }
     }
 }
@@ -757,7 +705,7 @@ void Otto::EnableServoLimit(int diff_limit) {
 void Otto::DisableServoLimit() {
     for (int i = 0; i < SERVO_COUNT; i++) {
         if (servo_pins_[i] != -1) {
-            servo_[i].DisableLimiter();
+            motion_.SetSpeedLimit(i, 0);
         }
     }
 }
@@ -6,7 +6,14 @@
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "oscillator.h"
+#include "servo_motion.h"
+
+#include <atomic>
+#include <cmath>
+
+#ifndef DEG2RAD
+#define DEG2RAD(g) ((g) * M_PI) / 180
+#endif
 
 //-- Constants
 #define FORWARD 1
@@ -46,8 +53,14 @@ public:
     void SetTrims(int left_leg, int right_leg, int left_foot, int right_foot, int left_hand = 0,
                   int right_hand = 0);
 
+    //-- Motion queue. The functions below only plan their motions and return
+    //-- once the last segment is queued, Stop() drops everything until Resume()
+    void Stop();
+    void Resume();
+    void WaitUntilIdle();
+
     //-- Predetermined Motion Functions
-    void MoveServos(int time, int servo_target[]);
+    bool MoveServos(int time, int servo_target[]);
     void MoveSingle(int position, int servo_number);
     void OscillateServos(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
                          double phase_diff[SERVO_COUNT], float cycle);
@@ -86,16 +99,12 @@ public:
     void DisableServoLimit();
 
 private:
-    Oscillator servo_[SERVO_COUNT];
+    ServoMotion motion_;
 
     int servo_pins_[SERVO_COUNT];
     int servo_trim_[SERVO_COUNT];
 
-    unsigned long final_time_;
-    unsigned long partial_time_;
-    float increment_[SERVO_COUNT];
-
-    bool is_otto_resting_;
+    std::atomic<bool> is_otto_resting_;  // Stop() clears it from the MCP thread
     bool has_hands_;  // 是否有手部舵机
 
     void Execute(int amplitude[SERVO_COUNT], int offset[SERVO_COUNT], int period,
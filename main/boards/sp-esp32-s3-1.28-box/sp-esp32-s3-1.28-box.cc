@@ -22,6 +22,7 @@
 #include <esp_lcd_panel_vendor.h>
 #include <driver/spi_common.h>
 #include "power_save_timer.h"
+#include "settings.h"
 #include <esp_sleep.h>
 #include <driver/rtc_io.h>
 
@@ -129,6 +130,7 @@ private:
             // 启用保持功能，确保睡眠期间电平不变
             rtc_gpio_hold_en(GPIO_NUM_3);
             esp_lcd_panel_disp_on_off(panel_, false); //关闭显示
+            Settings::Flush();
             esp_deep_sleep_start();
         });
         power_save_timer_->SetEnabled(true);
@@ -90,29 +90,34 @@ void Display::ShowNotification(const char* notification, int duration_ms) {
     ESP_ERROR_CHECK(esp_timer_start_once(notification_timer_, duration_ms * 1000));
 }
 
+bool Display::SetLabelTextIfChanged(lv_obj_t* label, const char* text) {
+    if (label == nullptr || text == nullptr) {
+        return false;
+    }
+    // lv_label_set_text 即使内容相同也会重新排版并使整个标签失效
+    const char* current = lv_label_get_text(label);
+    if (current != nullptr && strcmp(current, text) == 0) {
+        return false;
+    }
+    lv_label_set_text(label, text);
+    status_bar_invalidations_++;
+    return true;
+}
+
 void Display::UpdateStatusBar(bool update_all) {
     auto& app = Application::GetInstance();
     auto& board = Board::GetInstance();
     auto codec = board.GetAudioCodec();
 
-    // Update mute icon
-    {
-        DisplayLockGuard lock(this);
-        if (mute_label_ == nullptr) {
-            return;
-        }
-
-        // 如果静音状态改变，则更新图标
-        if (codec->output_volume() == 0 && !muted_) {
-            muted_ = true;
-            lv_label_set_text(mute_label_, FONT_AWESOME_VOLUME_MUTE);
-        } else if (codec->output_volume() > 0 && muted_) {
-            muted_ = false;
-            lv_label_set_text(mute_label_, "");
-        }
+    if (mute_label_ == nullptr) {
+        return;
     }
 
+    // 先在锁外收集状态，再在同一次加锁中只更新内容发生变化的标签
+    bool muted = codec->output_volume() == 0;
+
     // Update time
+    char time_str[16] = {0};
     if (app.GetDeviceState() == kDeviceStateIdle) {
         if (last_status_update_time_ + std::chrono::seconds(10) < std::chrono::system_clock::now()) {
             // Set status to clock "HH:MM"
@@ -120,9 +125,7 @@ void Display::UpdateStatusBar(bool update_all) {
             struct tm* tm = localtime(&now);
             // Check if the we have already set the time
             if (tm->tm_year >= 2025 - 1900) {
-                char time_str[16];
                 strftime(time_str, sizeof(time_str), "%H:%M  ", tm);
-                SetStatus(time_str);
             } else {
                 ESP_LOGW(TAG, "System time is not set, tm_year: %d", tm->tm_year);
             }
@@ -133,10 +136,11 @@ void Display::UpdateStatusBar(bool update_all) {
     // 更新电池图标
     int battery_level;
     bool charging, discharging;
-    const char* icon = nullptr;
+    const char* battery_icon = nullptr;
+    bool show_low_battery = false;
     if (board.GetBatteryLevel(battery_level, charging, discharging)) {
         if (charging) {
-            icon = FONT_AWESOME_BATTERY_CHARGING;
+            battery_icon = FONT_AWESOME_BATTERY_CHARGING;
         } else {
             const char* levels[] = {
                 FONT_AWESOME_BATTERY_EMPTY, // 0-19%
@@ -146,31 +150,14 @@ void Display::UpdateStatusBar(bool update_all) {
                 FONT_AWESOME_BATTERY_FULL, // 80-99%
                 FONT_AWESOME_BATTERY_FULL, // 100%
             };
-            icon = levels[battery_level / 20];
-        }
-        DisplayLockGuard lock(this);
-        if (battery_label_ != nullptr && battery_icon_ != icon) {
-            battery_icon_ = icon;
-            lv_label_set_text(battery_label_, battery_icon_);
-        }
-
-        if (low_battery_popup_ != nullptr) {
-            if (strcmp(icon, FONT_AWESOME_BATTERY_EMPTY) == 0 && discharging) {
-                if (lv_obj_has_flag(low_battery_popup_, LV_OBJ_FLAG_HIDDEN)) { // 如果低电量提示框隐藏，则显示
-                    lv_obj_clear_flag(low_battery_popup_, LV_OBJ_FLAG_HIDDEN);
-                    app.PlaySound(Lang::Sounds::P3_LOW_BATTERY);
-                }
-            } else {
-                // Hide the low battery popup when the battery is not empty
-                if (!lv_obj_has_flag(low_battery_popup_, LV_OBJ_FLAG_HIDDEN)) { // 如果低电量提示框显示，则隐藏
-                    lv_obj_add_flag(low_battery_popup_, LV_OBJ_FLAG_HIDDEN);
-                }
-            }
+            battery_icon = levels[battery_level / 20];
         }
+        show_low_battery = strcmp(battery_icon, FONT_AWESOME_BATTERY_EMPTY) == 0 && discharging;
     }
 
     // 每 10 秒更新一次网络图标
     static int seconds_counter = 0;
+    const char* network_icon = nullptr;
     if (update_all || seconds_counter++ % 10 == 0) {
         // 升级固件时，不读取 4G 网络状态，避免占用 UART 资源
         auto device_state = Application::GetInstance().GetDeviceState();
@@ -182,65 +169,105 @@ void Display::UpdateStatusBar(bool update_all) {
             kDeviceStateActivating,
         };
         if (std::find(allowed_states.begin(), allowed_states.end(), device_state) != allowed_states.end()) {
-            icon = board.GetNetworkStateIcon();
-            if (network_label_ != nullptr && icon != nullptr && network_icon_ != icon) {
-                DisplayLockGuard lock(this);
-                network_icon_ = icon;
-                lv_label_set_text(network_label_, network_icon_);
+            network_icon = board.GetNetworkStateIcon();
+        }
+    }
+
+    bool play_low_battery_sound = false;
+    {
+        DisplayLockGuard lock(this);
+
+        // 如果静音状态改变，则更新图标
+        if (update_all || muted != muted_) {
+            muted_ = muted;
+            SetLabelTextIfChanged(mute_label_, muted_ ? FONT_AWESOME_VOLUME_MUTE : "");
+        }
+
+        if (time_str[0] != '\0' && status_label_ != nullptr) {
+            // 时间只在分钟变化时才真正改变，其余时刻不触碰标签
+            if (SetLabelTextIfChanged(status_label_, time_str)) {
+                lv_obj_clear_flag(status_label_, LV_OBJ_FLAG_HIDDEN);
+                lv_obj_add_flag(notification_label_, LV_OBJ_FLAG_HIDDEN);
+                last_status_update_time_ = std::chrono::system_clock::now();
+            }
+        }
+
+        if (battery_icon != nullptr) {
+            if (battery_label_ != nullptr && battery_icon_ != battery_icon) {
+                battery_icon_ = battery_icon;
+                SetLabelTextIfChanged(battery_label_, battery_icon_);
+            }
+
+            if (low_battery_popup_ != nullptr) {
+                bool hidden = lv_obj_has_flag(low_battery_popup_, LV_OBJ_FLAG_HIDDEN);
+                if (show_low_battery && hidden) { // 如果低电量提示框隐藏，则显示
+                    lv_obj_clear_flag(low_battery_popup_, LV_OBJ_FLAG_HIDDEN);
+                    status_bar_invalidations_++;
+                    play_low_battery_sound = true;
+                } else if (!show_low_battery && !hidden) { // 如果低电量提示框显示，则隐藏
+                    lv_obj_add_flag(low_battery_popup_, LV_OBJ_FLAG_HIDDEN);
+                    status_bar_invalidations_++;
+                }
             }
         }
+
+        if (network_label_ != nullptr && network_icon != nullptr && network_icon_ != network_icon) {
+            network_icon_ = network_icon;
+            SetLabelTextIfChanged(network_label_, network_icon_);
+        }
     }
 
     esp_pm_lock_release(pm_lock_);
+
+    if (play_low_battery_sound) {
+        app.PlaySound(Lang::Sounds::P3_LOW_BATTERY);
+    }
+
+    // 每分钟统计一次状态栏失效次数
+    int64_t now_us = esp_timer_get_time();
+    if (now_us - status_bar_stats_start_us_ >= 60 * 1000 * 1000) {
+        ESP_LOGD(TAG, "Status bar invalidations in the last minute: %d", status_bar_invalidations_);
+        last_status_bar_invalidations_ = status_bar_invalidations_;
+        status_bar_invalidations_ = 0;
+        status_bar_stats_start_us_ = now_us;
+    }
 }
 
 
 void Display::SetEmotion(const char* emotion) {
-    struct Emotion {
-        const char* icon;
-        const char* text;
-    };
+    SetEmotion(emotion != nullptr ? EmotionFromString(emotion) : kEmotionNeutral);
+}
 
-    static const std::vector<Emotion> emotions = {
-        {FONT_AWESOME_EMOJI_NEUTRAL, "neutral"},
-        {FONT_AWESOME_EMOJI_HAPPY, "happy"},
-        {FONT_AWESOME_EMOJI_LAUGHING, "laughing"},
-        {FONT_AWESOME_EMOJI_FUNNY, "funny"},
-        {FONT_AWESOME_EMOJI_SAD, "sad"},
-        {FONT_AWESOME_EMOJI_ANGRY, "angry"},
-        {FONT_AWESOME_EMOJI_CRYING, "crying"},
-        {FONT_AWESOME_EMOJI_LOVING, "loving"},
-        {FONT_AWESOME_EMOJI_EMBARRASSED, "embarrassed"},
-        {FONT_AWESOME_EMOJI_SURPRISED, "surprised"},
-        {FONT_AWESOME_EMOJI_SHOCKED, "shocked"},
-        {FONT_AWESOME_EMOJI_THINKING, "thinking"},
-        {FONT_AWESOME_EMOJI_WINKING, "winking"},
-        {FONT_AWESOME_EMOJI_COOL, "cool"},
-        {FONT_AWESOME_EMOJI_RELAXED, "relaxed"},
-        {FONT_AWESOME_EMOJI_DELICIOUS, "delicious"},
-        {FONT_AWESOME_EMOJI_KISSY, "kissy"},
-        {FONT_AWESOME_EMOJI_CONFIDENT, "confident"},
-        {FONT_AWESOME_EMOJI_SLEEPY, "sleepy"},
-        {FONT_AWESOME_EMOJI_SILLY, "silly"},
-        {FONT_AWESOME_EMOJI_CONFUSED, "confused"}
+void Display::SetEmotion(Emotion emotion) {
+    static const char* const icons[kEmotionCount] = {
+        FONT_AWESOME_EMOJI_NEUTRAL,
+        FONT_AWESOME_EMOJI_HAPPY,
+        FONT_AWESOME_EMOJI_LAUGHING,
+        FONT_AWESOME_EMOJI_FUNNY,
+        FONT_AWESOME_EMOJI_SAD,
+        FONT_AWESOME_EMOJI_ANGRY,
+        FONT_AWESOME_EMOJI_CRYING,
+        FONT_AWESOME_EMOJI_LOVING,
+        FONT_AWESOME_EMOJI_EMBARRASSED,
+        FONT_AWESOME_EMOJI_SURPRISED,
+        FONT_AWESOME_EMOJI_SHOCKED,
+        FONT_AWESOME_EMOJI_THINKING,
+        FONT_AWESOME_EMOJI_WINKING,
+        FONT_AWESOME_EMOJI_COOL,
+        FONT_AWESOME_EMOJI_RELAXED,
+        FONT_AWESOME_EMOJI_DELICIOUS,
+        FONT_AWESOME_EMOJI_KISSY,
+        FONT_AWESOME_EMOJI_CONFIDENT,
+        FONT_AWESOME_EMOJI_SLEEPY,
+        FONT_AWESOME_EMOJI_SILLY,
+        FONT_AWESOME_EMOJI_CONFUSED,
     };
-    
-    // 查找匹配的表情
-    std::string_view emotion_view(emotion);
-    auto it = std::find_if(emotions.begin(), emotions.end(),
-        [&emotion_view](const Emotion& e) { return e.text == emotion_view; });
-    
+
     DisplayLockGuard lock(this);
     if (emotion_label_ == nullptr) {
         return;
     }
-
-    // 如果找到匹配的表情就显示对应图标，否则显示默认的neutral表情
-    if (it != emotions.end()) {
-        lv_label_set_text(emotion_label_, it->icon);
-    } else {
-        lv_label_set_text(emotion_label_, FONT_AWESOME_EMOJI_NEUTRAL);
-    }
+    lv_label_set_text(emotion_label_, icons[emotion < kEmotionCount ? emotion : kEmotionNeutral]);
 }
 
 void Display::SetIcon(const char* icon) {
@@ -272,9 +299,9 @@ void Display::SetTheme(const std::string& theme_name) {
 void Display::ShowStandbyScreen(bool show) {
     if (show) {
         SetChatMessage("system", "");
-        SetEmotion("sleepy");
+        SetEmotion(kEmotionSleepy);
     } else {
         SetChatMessage("system", "");
-        SetEmotion("neutral");
+        SetEmotion(kEmotionNeutral);
     }
 }
\ No newline at end of file
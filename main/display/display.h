@@ -9,6 +9,8 @@
 #include <string>
 #include <chrono>
 
+#include "emotion.h"
+
 struct DisplayFonts {
     const lv_font_t* text_font = nullptr;
     const lv_font_t* icon_font = nullptr;
@@ -23,7 +25,8 @@ public:
     virtual void SetStatus(const char* status);
     virtual void ShowNotification(const char* notification, int duration_ms = 3000);
     virtual void ShowNotification(const std::string &notification, int duration_ms = 3000);
-    virtual void SetEmotion(const char* emotion);
+    void SetEmotion(const char* emotion);
+    virtual void SetEmotion(Emotion emotion);
     virtual void SetChatMessage(const char* role, const char* content);
     virtual void SetIcon(const char* icon);
     virtual void SetPreviewImage(const lv_img_dsc_t* image);
@@ -34,6 +37,8 @@ public:
 
     inline int width() const { return width_; }
     inline int height() const { return height_; }
+    // 上一个完整分钟内状态栏标签的实际更新次数
+    inline int status_bar_invalidations_per_minute() const { return last_status_bar_invalidations_; }
 
 protected:
     int width_ = 0;
@@ -58,8 +63,14 @@ protected:
     std::string current_theme_name_;
 
     std::chrono::system_clock::time_point last_status_update_time_;
+    int status_bar_invalidations_ = 0;
+    int last_status_bar_invalidations_ = 0;
+    int64_t status_bar_stats_start_us_ = 0;
     esp_timer_handle_t notification_timer_ = nullptr;
 
+    // 仅在文本变化时调用 lv_label_set_text，调用方需持有显示锁
+    bool SetLabelTextIfChanged(lv_obj_t* label, const char* text);
+
     friend class DisplayLockGuard;
     virtual bool Lock(int timeout_ms = 0) = 0;
     virtual void Unlock() = 0;
@@ -0,0 +1,114 @@
+#ifndef EMOTION_H
+#define EMOTION_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+// 服务端下发的表情，顺序与 kEmotionNames 一致
+enum Emotion : uint8_t {
+    kEmotionNeutral,
+    kEmotionHappy,
+    kEmotionLaughing,
+    kEmotionFunny,
+    kEmotionSad,
+    kEmotionAngry,
+    kEmotionCrying,
+    kEmotionLoving,
+    kEmotionEmbarrassed,
+    kEmotionSurprised,
+    kEmotionShocked,
+    kEmotionThinking,
+    kEmotionWinking,
+    kEmotionCool,
+    kEmotionRelaxed,
+    kEmotionDelicious,
+    kEmotionKissy,
+    kEmotionConfident,
+    kEmotionSleepy,
+    kEmotionSilly,
+    kEmotionConfused,
+    kEmotionCount
+};
+
+inline constexpr std::array<std::string_view, kEmotionCount> kEmotionNames = {
+    "neutral",
+    "happy",
+    "laughing",
+    "funny",
+    "sad",
+    "angry",
+    "crying",
+    "loving",
+    "embarrassed",
+    "surprised",
+    "shocked",
+    "thinking",
+    "winking",
+    "cool",
+    "relaxed",
+    "delicious",
+    "kissy",
+    "confident",
+    "sleepy",
+    "silly",
+    "confused",
+};
+
+namespace emotion_detail {
+
+// FNV-1a，种子经过挑选，使上面 21 个名字在 32 个槽位中没有冲突
+inline constexpr uint32_t kHashSeed = 0x811cbd8e;
+inline constexpr size_t kSlotCount = 32;
+inline constexpr uint8_t kEmptySlot = 0xFF;
+
+constexpr size_t Slot(std::string_view name) {
+    uint32_t hash = kHashSeed;
+    for (char c : name) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return (hash >> 24) & (kSlotCount - 1);
+}
+
+constexpr std::array<uint8_t, kSlotCount> BuildSlots() {
+    std::array<uint8_t, kSlotCount> slots{};
+    for (auto& slot : slots) {
+        slot = kEmptySlot;
+    }
+    for (size_t i = 0; i < kEmotionNames.size(); i++) {
+        slots[Slot(kEmotionNames[i])] = static_cast<uint8_t>(i);
+    }
+    return slots;
+}
+
+inline constexpr std::array<uint8_t, kSlotCount> kSlots = BuildSlots();
+
+} // namespace emotion_detail
+
+// 一次哈希加一次字符串比较；未知表情返回 kEmotionNeutral
+constexpr Emotion EmotionFromString(std::string_view name) {
+    uint8_t index = emotion_detail::kSlots[emotion_detail::Slot(name)];
+    if (index != emotion_detail::kEmptySlot && kEmotionNames[index] == name) {
+        return static_cast<Emotion>(index);
+    }
+    return kEmotionNeutral;
+}
+
+constexpr const char* EmotionToString(Emotion emotion) {
+    return emotion < kEmotionCount ? kEmotionNames[emotion].data() : kEmotionNames[kEmotionNeutral].data();
+}
+
+// 编译期校验：每个表情名都能映射回自身（即哈希无冲突），未知名字回退到 neutral
+constexpr bool VerifyEmotionTable() {
+    for (size_t i = 0; i < kEmotionNames.size(); i++) {
+        if (EmotionFromString(kEmotionNames[i]) != static_cast<Emotion>(i)) {
+            return false;
+        }
+    }
+    return EmotionFromString("") == kEmotionNeutral &&
+           EmotionFromString("unknown") == kEmotionNeutral &&
+           EmotionFromString("Happy") == kEmotionNeutral;
+}
+static_assert(VerifyEmotionTable(), "Emotion perfect hash has collisions, pick a new kHashSeed");
+
+#endif // EMOTION_H
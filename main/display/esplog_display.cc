@@ -26,9 +26,9 @@ void EspLogDisplay::ShowNotification(const std::string &notification, int durati
 }
 
 
-void EspLogDisplay::SetEmotion(const char* emotion)
+void EspLogDisplay::SetEmotion(Emotion emotion)
 {
-    ESP_LOGW(TAG, "SetEmotion: %s", emotion);
+    ESP_LOGW(TAG, "SetEmotion: %s", EmotionToString(emotion));
 }
 
 void EspLogDisplay::SetIcon(const char* icon)
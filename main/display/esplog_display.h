@@ -13,7 +13,8 @@ public:
     virtual void SetStatus(const char* status);
     virtual void ShowNotification(const char* notification, int duration_ms = 3000);
     virtual void ShowNotification(const std::string &notification, int duration_ms = 3000);
-    virtual void SetEmotion(const char* emotion) override;
+    using Display::SetEmotion;
+    virtual void SetEmotion(Emotion emotion) override;
     virtual void SetChatMessage(const char* role, const char* content) override; 
     virtual void SetIcon(const char* icon) override;
     virtual inline void SetPreviewImage(const lv_img_dsc_t* image) override {}
@@ -833,53 +833,38 @@ void LcdDisplay::SetPreviewImage(const lv_img_dsc_t* img_dsc) {
 }
 #endif
 
-void LcdDisplay::SetEmotion(const char* emotion) {
-    struct Emotion {
-        const char* icon;
-        const char* text;
+void LcdDisplay::SetEmotion(Emotion emotion) {
+    static const char* const emojis[kEmotionCount] = {
+        "😶", // neutral
+        "🙂", // happy
+        "😆", // laughing
+        "😂", // funny
+        "😔", // sad
+        "😠", // angry
+        "😭", // crying
+        "😍", // loving
+        "😳", // embarrassed
+        "😯", // surprised
+        "😱", // shocked
+        "🤔", // thinking
+        "😉", // winking
+        "😎", // cool
+        "😌", // relaxed
+        "🤤", // delicious
+        "😘", // kissy
+        "😏", // confident
+        "😴", // sleepy
+        "😜", // silly
+        "🙄", // confused
     };
 
-    static const std::vector<Emotion> emotions = {
-        {"😶", "neutral"},
-        {"🙂", "happy"},
-        {"😆", "laughing"},
-        {"😂", "funny"},
-        {"😔", "sad"},
-        {"😠", "angry"},
-        {"😭", "crying"},
-        {"😍", "loving"},
-        {"😳", "embarrassed"},
-        {"😯", "surprised"},
-        {"😱", "shocked"},
-        {"🤔", "thinking"},
-        {"😉", "winking"},
-        {"😎", "cool"},
-        {"😌", "relaxed"},
-        {"🤤", "delicious"},
-        {"😘", "kissy"},
-        {"😏", "confident"},
-        {"😴", "sleepy"},
-        {"😜", "silly"},
-        {"🙄", "confused"}
-    };
-    
-    // 查找匹配的表情
-    std::string_view emotion_view(emotion);
-    auto it = std::find_if(emotions.begin(), emotions.end(),
-        [&emotion_view](const Emotion& e) { return e.text == emotion_view; });
-
     DisplayLockGuard lock(this);
     if (emotion_label_ == nullptr) {
         return;
     }
 
-    // 如果找到匹配的表情就显示对应图标，否则显示默认的neutral表情
     lv_obj_set_style_text_font(emotion_label_, fonts_.emoji_font, 0);
-    if (it != emotions.end()) {
-        lv_label_set_text(emotion_label_, it->icon);
-    } else {
-        lv_label_set_text(emotion_label_, "😶");
-    }
+    lv_label_set_text(emotion_label_, emojis[emotion < kEmotionCount ? emotion : kEmotionNeutral]);
 
 #if !CONFIG_USE_WECHAT_MESSAGE_STYLE
     // 显示emotion_label_，隐藏preview_image_
@@ -48,7 +48,8 @@ protected:
     
 public:
     ~LcdDisplay();
-    virtual void SetEmotion(const char* emotion) override;
+    using Display::SetEmotion;
+    virtual void SetEmotion(Emotion emotion) override;
     virtual void SetIcon(const char* icon) override;
     virtual void SetPreviewImage(const lv_img_dsc_t* img_dsc) override;
 #if CONFIG_USE_WECHAT_MESSAGE_STYLE
@@ -1,16 +1,19 @@
 #include "circular_strip.h"
 #include "application.h"
 #include <esp_log.h>
+#include <soc/soc_caps.h>
+#include <cstring>
+#include <algorithm>
 
 #define TAG "CircularStrip"
 
-#define BLINK_INFINITE -1
-
 CircularStrip::CircularStrip(gpio_num_t gpio, uint8_t max_leds) : max_leds_(max_leds) {
     // If the gpio is not connected, you should use NoLed class
     assert(gpio != GPIO_NUM_NC);
 
     colors_.resize(max_leds_);
+    output_.resize(max_leds_);
+    last_output_.resize(max_leds_);
 
     led_strip_config_t strip_config = {};
     strip_config.strip_gpio_num = gpio;
@@ -21,159 +24,168 @@ CircularStrip::CircularStrip(gpio_num_t gpio, uint8_t max_leds) : max_leds_(max_
     led_strip_rmt_config_t rmt_config = {};
     rmt_config.resolution_hz = 10 * 1000 * 1000; // 10MHz
 
-    ESP_ERROR_CHECK(led_strip_new_rmt_device(&strip_config, &rmt_config, &led_strip_));
+#if SOC_RMT_SUPPORT_DMA
+    // The whole strip is sent by DMA instead of refilling the RMT memory from interrupts
+    rmt_config.mem_block_symbols = 1024;
+    rmt_config.flags.with_dma = true;
+    if (led_strip_new_rmt_device(&strip_config, &rmt_config, &led_strip_) != ESP_OK) {
+        ESP_LOGW(TAG, "RMT DMA channel not available, using RMT memory");
+        rmt_config.mem_block_symbols = 0;
+        rmt_config.flags.with_dma = false;
+        led_strip_ = nullptr;
+    }
+#endif
+    if (led_strip_ == nullptr) {
+        ESP_ERROR_CHECK(led_strip_new_rmt_device(&strip_config, &rmt_config, &led_strip_));
+    }
     led_strip_clear(led_strip_);
 
     esp_timer_create_args_t strip_timer_args = {
         .callback = [](void *arg) {
             auto strip = static_cast<CircularStrip*>(arg);
             std::lock_guard<std::mutex> lock(strip->mutex_);
-            if (strip->strip_callback_ != nullptr) {
-                strip->strip_callback_();
-            }
+            strip->OnFrame();
         },
         .arg = this,
         .dispatch_method = ESP_TIMER_TASK,
         .name = "strip_timer",
-        .skip_unhandled_events = false,
+        .skip_unhandled_events = true,
     };
     ESP_ERROR_CHECK(esp_timer_create(&strip_timer_args, &strip_timer_));
+
+    esp_timer_create_args_t level_timer_args = {
+        .callback = [](void *arg) {
+            auto strip = static_cast<CircularStrip*>(arg);
+            std::lock_guard<std::mutex> lock(strip->mutex_);
+            strip->OnLevelMeter();
+        },
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "level_timer",
+        .skip_unhandled_events = true,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&level_timer_args, &level_timer_));
 }
 
 CircularStrip::~CircularStrip() {
     esp_timer_stop(strip_timer_);
+    esp_timer_delete(strip_timer_);
+    esp_timer_stop(level_timer_);
+    esp_timer_delete(level_timer_);
     if (led_strip_ != nullptr) {
         led_strip_del(led_strip_);
     }
 }
 
-
-void CircularStrip::SetAllColor(StripColor color) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    esp_timer_stop(strip_timer_);
-    for (int i = 0; i < max_leds_; i++) {
-        colors_[i] = color;
-        led_strip_set_pixel(led_strip_, i, color.red, color.green, color.blue);
+void CircularStrip::OnFrame() {
+    bool finished = animation_.frame_count() == 0;
+    if (!finished) {
+        animation_.GetFrame(frame_index_, colors_.data());
+        if (frame_index_ + 1 < animation_.frame_count()) {
+            frame_index_++;
+        } else if (animation_.loop()) {
+            frame_index_ = 0;
+        } else {
+            finished = true;
+        }
+    }
+    if (finished) {
+        esp_timer_stop(strip_timer_);
     }
-    led_strip_refresh(led_strip_);
+    Refresh();
 }
 
-void CircularStrip::SetSingleColor(uint8_t index, StripColor color) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    esp_timer_stop(strip_timer_);
-    colors_[index] = color;
-    led_strip_set_pixel(led_strip_, index, color.red, color.green, color.blue);
-    led_strip_refresh(led_strip_);
+void CircularStrip::OnLevelMeter() {
+    // Rise at once, fall back slowly so short syllables stay visible
+    uint8_t target = Application::GetInstance().GetAudioService().GetInputLevel().Meter();
+    level_ = target > level_ ? target : std::max<int>(target, level_ - LEVEL_METER_DECAY);
+    Refresh();
 }
 
-void CircularStrip::Blink(StripColor color, int interval_ms) {
-    for (int i = 0; i < max_leds_; i++) {
-        colors_[i] = color;
+void CircularStrip::Refresh() {
+    output_ = colors_;
+    if (level_meter_) {
+        OverlayLevelMeter(output_.data(), max_leds_, level_, level_color_);
     }
-    StartStripTask(interval_ms, [this]() {
-        static bool on = true;
-        if (on) {
-            for (int i = 0; i < max_leds_; i++) {
-                led_strip_set_pixel(led_strip_, i, colors_[i].red, colors_[i].green, colors_[i].blue);
-            }
-            led_strip_refresh(led_strip_);
-        } else {
-            led_strip_clear(led_strip_);
-        }
-        on = !on;
-    });
-}
-
-void CircularStrip::FadeOut(int interval_ms) {
-    StartStripTask(interval_ms, [this]() {
-        bool all_off = true;
-        for (int i = 0; i < max_leds_; i++) {
-            colors_[i].red /= 2;
-            colors_[i].green /= 2;
-            colors_[i].blue /= 2;
-            if (colors_[i].red != 0 || colors_[i].green != 0 || colors_[i].blue != 0) {
-                all_off = false;
-            }
-            led_strip_set_pixel(led_strip_, i, colors_[i].red, colors_[i].green, colors_[i].blue);
-        }
-        if (all_off) {
-            led_strip_clear(led_strip_);
-            esp_timer_stop(strip_timer_);
-        } else {
-            led_strip_refresh(led_strip_);
-        }
-    });
-}
 
-void CircularStrip::Breathe(StripColor low, StripColor high, int interval_ms) {
-    StartStripTask(interval_ms, [this, low, high]() {
-        static bool increase = true;
-        static StripColor color = low;
-        if (increase) {
-            if (color.red < high.red) {
-                color.red++;
-            }
-            if (color.green < high.green) {
-                color.green++;
-            }
-            if (color.blue < high.blue) {
-                color.blue++;
-            }
-            if (color.red == high.red && color.green == high.green && color.blue == high.blue) {
-                increase = false;
-            }
-        } else {
-            if (color.red > low.red) {
-                color.red--;
-            }
-            if (color.green > low.green) {
-                color.green--;
-            }
-            if (color.blue > low.blue) {
-                color.blue--;
-            }
-            if (color.red == low.red && color.green == low.green && color.blue == low.blue) {
-                increase = true;
-            }
-        }
+    // 颜色没有变化时不刷新，静止的画面不占用 RMT
+    if (!output_valid_ || memcmp(output_.data(), last_output_.data(), max_leds_ * sizeof(StripColor)) != 0) {
         for (int i = 0; i < max_leds_; i++) {
-            led_strip_set_pixel(led_strip_, i, color.red, color.green, color.blue);
+            led_strip_set_pixel(led_strip_, i, output_[i].red, output_[i].green, output_[i].blue);
         }
         led_strip_refresh(led_strip_);
-    });
-}
-
-void CircularStrip::Scroll(StripColor low, StripColor high, int length, int interval_ms) {
-    for (int i = 0; i < max_leds_; i++) {
-        colors_[i] = low;
+        std::swap(output_, last_output_);
+        output_valid_ = true;
     }
-    StartStripTask(interval_ms, [this, low, high, length]() {
-        static int offset = 0;
-        for (int i = 0; i < max_leds_; i++) {
-            colors_[i] = low;
-        }
-        for (int j = 0; j < length; j++) {
-            int i = (offset + j) % max_leds_;
-            colors_[i] = high;
-        }
-        for (int i = 0; i < max_leds_; i++) {
-            led_strip_set_pixel(led_strip_, i, colors_[i].red, colors_[i].green, colors_[i].blue);
-        }
-        led_strip_refresh(led_strip_);
-        offset = (offset + 1) % max_leds_;
-    });
 }
 
-void CircularStrip::StartStripTask(int interval_ms, std::function<void()> cb) {
+void CircularStrip::Play(StripAnimation&& animation, int interval_ms) {
     if (led_strip_ == nullptr) {
         return;
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
     esp_timer_stop(strip_timer_);
-    
-    strip_callback_ = cb;
-    esp_timer_start_periodic(strip_timer_, interval_ms * 1000);
+    animation_ = std::move(animation);
+    frame_index_ = 0;
+
+    // The first frame is shown at once, a still frame does not need the timer
+    OnFrame();
+    if (animation_.frame_count() > 1 && interval_ms > 0) {
+        esp_timer_start_periodic(strip_timer_, interval_ms * 1000);
+    }
+}
+
+void CircularStrip::EnableLevelMeter(bool enable, StripColor color) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    level_color_ = color;
+    level_ = 0;
+    if (enable == level_meter_) {
+        return;
+    }
+    level_meter_ = enable;
+    if (enable) {
+        esp_timer_start_periodic(level_timer_, LEVEL_METER_INTERVAL_MS * 1000);
+    } else {
+        // Take the meter off a still frame too
+        esp_timer_stop(level_timer_);
+        Refresh();
+    }
+}
+
+void CircularStrip::SetAllColor(StripColor color) {
+    Play(StripAnimation::Solid(std::vector<StripColor>(max_leds_, color)), 0);
+}
+
+void CircularStrip::SetSingleColor(uint8_t index, StripColor color) {
+    std::vector<StripColor> colors;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        colors = colors_;
+    }
+    colors[index] = color;
+    Play(StripAnimation::Solid(colors), 0);
+}
+
+void CircularStrip::Blink(StripColor color, int interval_ms) {
+    Play(StripAnimation::Blink(max_leds_, color), interval_ms);
+}
+
+void CircularStrip::FadeOut(int interval_ms) {
+    std::vector<StripColor> colors;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        colors = colors_;
+    }
+    Play(StripAnimation::FadeOut(colors, 8), interval_ms);
+}
+
+void CircularStrip::Breathe(StripColor low, StripColor high, int interval_ms) {
+    Play(StripAnimation::Breathe(max_leds_, low, high), interval_ms);
+}
+
+void CircularStrip::Scroll(StripColor low, StripColor high, int length, int interval_ms) {
+    Play(StripAnimation::Scroll(max_leds_, low, high, length), interval_ms);
 }
 
 void CircularStrip::SetBrightness(uint8_t default_brightness, uint8_t low_brightness) {
@@ -185,6 +197,8 @@ void CircularStrip::SetBrightness(uint8_t default_brightness, uint8_t low_bright
 void CircularStrip::OnStateChanged() {
     auto& app = Application::GetInstance();
     auto device_state = app.GetDeviceState();
+    StripColor level_color = { default_brightness_, default_brightness_, default_brightness_ };
+    EnableLevelMeter(device_state == kDeviceStateListening, level_color);
     switch (device_state) {
         case kDeviceStateStarting: {
             StripColor low = { 0, 0, 0 };
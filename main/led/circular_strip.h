@@ -2,6 +2,7 @@
 #define _CIRCULAR_STRIP_H_
 
 #include "led.h"
+#include "strip_animation.h"
 #include <driver/gpio.h>
 #include <led_strip.h>
 #include <esp_timer.h>
@@ -11,10 +12,8 @@
 
 #define DEFAULT_BRIGHTNESS 32
 #define LOW_BRIGHTNESS 4
-
-struct StripColor {
-    uint8_t red = 0, green = 0, blue = 0;
-};
+#define LEVEL_METER_INTERVAL_MS 50  // The meter is redrawn at this rate whatever the animation does
+#define LEVEL_METER_DECAY 24        // Per meter update, in 0-255 level units
 
 class CircularStrip : public Led {
 public:
@@ -28,23 +27,33 @@ public:
     void Blink(StripColor color, int interval_ms);
     void Breathe(StripColor low, StripColor high, int interval_ms);
     void Scroll(StripColor low, StripColor high, int length, int interval_ms);
+    // Play a compiled animation, one frame every interval_ms
+    void Play(StripAnimation&& animation, int interval_ms);
+    // Draw a microphone level meter over the current animation
+    void EnableLevelMeter(bool enable, StripColor color = {});
 
 private:
     std::mutex mutex_;
-    TaskHandle_t blink_task_ = nullptr;
     led_strip_handle_t led_strip_ = nullptr;
     int max_leds_ = 0;
-    std::vector<StripColor> colors_;
-    int blink_counter_ = 0;
-    int blink_interval_ms_ = 0;
+    std::vector<StripColor> colors_;        // Colors of the current frame before the overlay
+    std::vector<StripColor> output_;        // Colors sent to the strip
+    std::vector<StripColor> last_output_;
+    bool output_valid_ = false;
     esp_timer_handle_t strip_timer_ = nullptr;
-    std::function<void()> strip_callback_ = nullptr;
+    esp_timer_handle_t level_timer_ = nullptr;
+    StripAnimation animation_;
+    size_t frame_index_ = 0;
+    bool level_meter_ = false;
+    StripColor level_color_;
+    uint8_t level_ = 0;
 
     uint8_t default_brightness_ = DEFAULT_BRIGHTNESS;
     uint8_t low_brightness_ = LOW_BRIGHTNESS;
 
-    void StartStripTask(int interval_ms, std::function<void()> cb);
-    void Rainbow(StripColor low, StripColor high, int interval_ms);
+    void OnFrame();
+    void OnLevelMeter();
+    void Refresh();
     void FadeOut(int interval_ms);
 };
 
@@ -9,6 +9,7 @@
 #define LOW_BRIGHTNESS 2
 
 #define BLINK_INFINITE -1
+#define LEVEL_METER_INTERVAL_MS 50
 
 
 SingleLed::SingleLed(gpio_num_t gpio) {
@@ -61,6 +62,7 @@ void SingleLed::TurnOn() {
     
     std::lock_guard<std::mutex> lock(mutex_);
     esp_timer_stop(blink_timer_);
+    level_meter_ = false;
     led_strip_set_pixel(led_strip_, 0, r_, g_, b_);
     led_strip_refresh(led_strip_);
 }
@@ -72,6 +74,7 @@ void SingleLed::TurnOff() {
 
     std::lock_guard<std::mutex> lock(mutex_);
     esp_timer_stop(blink_timer_);
+    level_meter_ = false;
     led_strip_clear(led_strip_);
 }
 
@@ -94,14 +97,39 @@ void SingleLed::StartBlinkTask(int times, int interval_ms) {
 
     std::lock_guard<std::mutex> lock(mutex_);
     esp_timer_stop(blink_timer_);
+    level_meter_ = false;
     
     blink_counter_ = times * 2;
     blink_interval_ms_ = interval_ms;
     esp_timer_start_periodic(blink_timer_, interval_ms * 1000);
 }
 
+void SingleLed::StartLevelMeter(int interval_ms) {
+    if (led_strip_ == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    esp_timer_stop(blink_timer_);
+    level_meter_ = true;
+    level_brightness_ = 0;
+    esp_timer_start_periodic(blink_timer_, interval_ms * 1000);
+}
+
 void SingleLed::OnBlinkTimer() {
     std::lock_guard<std::mutex> lock(mutex_);
+    if (level_meter_) {
+        // 红色亮度跟随麦克风音量，只有亮度变化时才刷新
+        int meter = Application::GetInstance().GetAudioService().GetInputLevel().Meter();
+        uint8_t brightness = LOW_BRIGHTNESS + (HIGH_BRIGHTNESS - LOW_BRIGHTNESS) * meter / 255;
+        if (brightness != level_brightness_) {
+            level_brightness_ = brightness;
+            led_strip_set_pixel(led_strip_, 0, brightness, 0, 0);
+            led_strip_refresh(led_strip_);
+        }
+        return;
+    }
+
     blink_counter_--;
     if (blink_counter_ & 1) {
         led_strip_set_pixel(led_strip_, 0, r_, g_, b_);
@@ -137,12 +165,7 @@ void SingleLed::OnStateChanged() {
             break;
         case kDeviceStateListening:
         case kDeviceStateAudioTesting:
-            if (app.IsVoiceDetected()) {
-                SetColor(HIGH_BRIGHTNESS, 0, 0);
-            } else {
-                SetColor(LOW_BRIGHTNESS, 0, 0);
-            }
-            TurnOn();
+            StartLevelMeter(LEVEL_METER_INTERVAL_MS);
             break;
         case kDeviceStateSpeaking:
             SetColor(0, DEFAULT_BRIGHTNESS, 0);
@@ -23,6 +23,8 @@ private:
     int blink_counter_ = 0;
     int blink_interval_ms_ = 0;
     esp_timer_handle_t blink_timer_ = nullptr;
+    bool level_meter_ = false;
+    uint8_t level_brightness_ = 0;
 
     void StartBlinkTask(int times, int interval_ms);
     void OnBlinkTimer();
@@ -30,6 +32,7 @@ private:
     void BlinkOnce();
     void Blink(int times, int interval_ms);
     void StartContinuousBlink(int interval_ms);
+    void StartLevelMeter(int interval_ms);
     void TurnOn();
     void TurnOff();
     void SetColor(uint8_t r, uint8_t g, uint8_t b);
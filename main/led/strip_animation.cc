@@ -0,0 +1,155 @@
+#include "strip_animation.h"
+
+#include <cmath>
+#include <algorithm>
+
+StripGamma::StripGamma() {
+    for (int value = 0; value < 256; value++) {
+        to_perceptual_[value] = std::lround(65535.0f * std::pow(value / 255.0f, 1.0f / STRIP_GAMMA));
+    }
+    for (int i = 0; i <= 256; i++) {
+        float perceptual = std::min(i * 256, 65535) / 65535.0f;
+        to_linear_[i] = std::lround(255.0f * 256.0f * std::pow(perceptual, STRIP_GAMMA));
+    }
+}
+
+uint8_t StripGamma::ToLinear(uint16_t perceptual) const {
+    // Linear interpolation between the table entries, accurate to far below one PWM step
+    int index = perceptual >> 8;
+    int fraction = perceptual & 0xFF;
+    int value = to_linear_[index] + (((to_linear_[index + 1] - to_linear_[index]) * fraction) >> 8);
+    return std::min((value + 128) >> 8, 255);
+}
+
+StripAnimation::StripAnimation(int leds, bool uniform, bool loop)
+    : leds_(leds), width_(uniform ? 1 : leds), loop_(loop) {
+}
+
+void StripAnimation::AddKeyframe(int tick, const StripColor* colors, bool step) {
+    keyframes_.push_back({ tick, step, keyframe_colors_.size() });
+    keyframe_colors_.insert(keyframe_colors_.end(), colors, colors + width_);
+}
+
+void StripAnimation::AddKeyframe(int tick, StripColor color, bool step) {
+    keyframes_.push_back({ tick, step, keyframe_colors_.size() });
+    keyframe_colors_.insert(keyframe_colors_.end(), width_, color);
+}
+
+void StripAnimation::Compile() {
+    if (keyframes_.empty()) {
+        frame_count_ = 0;
+        return;
+    }
+    std::stable_sort(keyframes_.begin(), keyframes_.end(), [](const Keyframe& a, const Keyframe& b) {
+        return a.tick < b.tick;
+    });
+    // The last keyframe of a loop is the first frame of the next cycle
+    int last_tick = keyframes_.back().tick - keyframes_.front().tick;
+    frame_count_ = loop_ && last_tick > 0 ? last_tick : last_tick + 1;
+    frames_.resize(frame_count_ * width_);
+
+    auto& gamma = StripGamma::GetInstance();
+    auto blend = [&gamma](uint8_t from, uint8_t to, int position, int length) -> uint8_t {
+        int p0 = gamma.ToPerceptual(from);
+        int p1 = gamma.ToPerceptual(to);
+        return gamma.ToLinear(p0 + (p1 - p0) * position / length);
+    };
+
+    size_t segment = 0;
+    for (size_t frame = 0; frame < frame_count_; frame++) {
+        int tick = keyframes_.front().tick + frame;
+        while (segment + 1 < keyframes_.size() && keyframes_[segment + 1].tick <= tick) {
+            segment++;
+        }
+        auto& from = keyframes_[segment];
+        const StripColor* from_colors = &keyframe_colors_[from.offset];
+        StripColor* output = &frames_[frame * width_];
+        if (from.step || tick == from.tick || segment + 1 == keyframes_.size()) {
+            std::copy(from_colors, from_colors + width_, output);
+            continue;
+        }
+
+        auto& to = keyframes_[segment + 1];
+        const StripColor* to_colors = &keyframe_colors_[to.offset];
+        int position = tick - from.tick;
+        int length = to.tick - from.tick;
+        for (int i = 0; i < width_; i++) {
+            output[i].red = blend(from_colors[i].red, to_colors[i].red, position, length);
+            output[i].green = blend(from_colors[i].green, to_colors[i].green, position, length);
+            output[i].blue = blend(from_colors[i].blue, to_colors[i].blue, position, length);
+        }
+    }
+    keyframes_.clear();
+    keyframe_colors_.clear();
+}
+
+void StripAnimation::GetFrame(size_t index, StripColor* output) const {
+    const StripColor* frame = &frames_[index * width_];
+    if (width_ == 1) {
+        std::fill(output, output + leds_, frame[0]);
+    } else {
+        std::copy(frame, frame + width_, output);
+    }
+}
+
+StripAnimation StripAnimation::Solid(const std::vector<StripColor>& colors) {
+    bool uniform = std::all_of(colors.begin(), colors.end(), [&colors](const StripColor& color) {
+        return color.red == colors[0].red && color.green == colors[0].green && color.blue == colors[0].blue;
+    });
+    StripAnimation animation(colors.size(), uniform, false);
+    animation.AddKeyframe(0, colors.data());
+    animation.Compile();
+    return animation;
+}
+
+StripAnimation StripAnimation::Blink(int leds, StripColor color) {
+    StripAnimation animation(leds, true, true);
+    animation.AddKeyframe(0, color, true);
+    animation.AddKeyframe(1, StripColor{}, true);
+    animation.AddKeyframe(2, color, true);
+    animation.Compile();
+    return animation;
+}
+
+StripAnimation StripAnimation::Breathe(int leds, StripColor low, StripColor high) {
+    // One tick for every PWM step of the channel that changes most, like the original stepping
+    int steps = std::max({ std::abs(high.red - low.red), std::abs(high.green - low.green),
+        std::abs(high.blue - low.blue), 1 });
+    StripAnimation animation(leds, true, true);
+    animation.AddKeyframe(0, low);
+    animation.AddKeyframe(steps, high);
+    animation.AddKeyframe(steps * 2, low);
+    animation.Compile();
+    return animation;
+}
+
+StripAnimation StripAnimation::Scroll(int leds, StripColor low, StripColor high, int length) {
+    StripAnimation animation(leds, false, true);
+    std::vector<StripColor> colors(leds);
+    for (int offset = 0; offset <= leds; offset++) {
+        std::fill(colors.begin(), colors.end(), low);
+        for (int j = 0; j < length; j++) {
+            colors[(offset + j) % leds] = high;
+        }
+        animation.AddKeyframe(offset, colors.data(), true);
+    }
+    animation.Compile();
+    return animation;
+}
+
+StripAnimation StripAnimation::FadeOut(const std::vector<StripColor>& from, int ticks) {
+    StripAnimation animation(from.size(), false, false);
+    animation.AddKeyframe(0, from.data());
+    animation.AddKeyframe(ticks, StripColor{});
+    animation.Compile();
+    return animation;
+}
+
+void OverlayLevelMeter(StripColor* colors, int leds, uint8_t level, StripColor color) {
+    int count = (level * leds + 254) / 255;
+    for (int i = 0; i < count; i++) {
+        colors[i].red = std::max(colors[i].red, color.red);
+        colors[i].green = std::max(colors[i].green, color.green);
+        colors[i].blue = std::max(colors[i].blue, color.blue);
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef _STRIP_ANIMATION_H_
+#define _STRIP_ANIMATION_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#define STRIP_GAMMA 2.2f
+
+struct StripColor {
+    uint8_t red = 0, green = 0, blue = 0;
+};
+
+// 伽马查找表，动画在感知亮度空间中插值，避免低亮度时的跳变
+class StripGamma {
+public:
+    static const StripGamma& GetInstance() {
+        static StripGamma instance;
+        return instance;
+    }
+
+    // 0-255 PWM value to perceived brightness in 0-65535
+    uint16_t ToPerceptual(uint8_t value) const { return to_perceptual_[value]; }
+    uint8_t ToLinear(uint16_t perceptual) const;
+
+private:
+    StripGamma();
+
+    uint16_t to_perceptual_[256];
+    uint16_t to_linear_[257];   // Q8 PWM value at every 256 steps of perceived brightness
+};
+
+/*
+ * 关键帧动画，播放前编译成逐帧的颜色表，定时器每一帧只需要拷贝。
+ * 所有灯珠同色的动画每帧只保存一个颜色。
+ */
+class StripAnimation {
+public:
+    StripAnimation() = default;
+    // A looping animation wraps from its last keyframe back to the first, which must be equal
+    StripAnimation(int leds, bool uniform, bool loop);
+
+    // colors holds one color per led, or a single color for uniform animations.
+    // A step keyframe holds its colors until the next one instead of fading.
+    void AddKeyframe(int tick, const StripColor* colors, bool step = false);
+    void AddKeyframe(int tick, StripColor color, bool step = false);
+    void Compile();
+
+    size_t frame_count() const { return frame_count_; }
+    bool loop() const { return loop_; }
+    void GetFrame(size_t index, StripColor* output) const;
+
+    static StripAnimation Solid(const std::vector<StripColor>& colors);
+    static StripAnimation Blink(int leds, StripColor color);
+    static StripAnimation Breathe(int leds, StripColor low, StripColor high);
+    static StripAnimation Scroll(int leds, StripColor low, StripColor high, int length);
+    static StripAnimation FadeOut(const std::vector<StripColor>& from, int ticks);
+
+private:
+    struct Keyframe {
+        int tick;
+        bool step;
+        size_t offset;      // First color in keyframe_colors_
+    };
+
+    int leds_ = 0;
+    int width_ = 0;         // Colors per frame, 1 for uniform animations
+    bool loop_ = false;
+    std::vector<Keyframe> keyframes_;
+    std::vector<StripColor> keyframe_colors_;
+    std::vector<StripColor> frames_;
+    size_t frame_count_ = 0;
+};
+
+// 在动画帧上叠加音量条：从第一个灯珠开始点亮 level 对应的数量，每个通道取较大值
+void OverlayLevelMeter(StripColor* colors, int leds, uint8_t level, StripColor color);
+
+#endif // _STRIP_ANIMATION_H_
@@ -0,0 +1,112 @@
+#ifndef _MAIN_TASK_H_
+#define _MAIN_TASK_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// 主循环任务的优先级，数值越小越先执行。
+// 协议消息、状态切换和跟随状态的显示更新都用 kSchedulePriorityProtocol，保持它们之间的顺序；
+// 统计上报等可以推迟的任务用 kSchedulePriorityBackground
+enum SchedulePriority {
+    kSchedulePriorityProtocol,
+    kSchedulePriorityBackground,
+    kSchedulePriorityCount
+};
+
+/*
+ * 只能移动的 void() 可调用对象。捕获的数据不超过 kInlineSize 时直接存放在对象内部，
+ * 不像 std::function 那样每次都在堆上分配
+ */
+class MainTask {
+public:
+    static constexpr size_t kInlineSize = 40;
+
+    MainTask() = default;
+
+    template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, MainTask>>>
+    MainTask(F&& callable) {
+        using Callable = std::decay_t<F>;
+        if constexpr (sizeof(Callable) <= kInlineSize && alignof(Callable) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible_v<Callable>) {
+            new (storage_) Callable(std::forward<F>(callable));
+            ops_ = &kInlineOps<Callable>;
+        } else {
+            *reinterpret_cast<Callable**>(storage_) = new Callable(std::forward<F>(callable));
+            ops_ = &kHeapOps<Callable>;
+        }
+    }
+
+    MainTask(MainTask&& other) noexcept {
+        if (other.ops_ != nullptr) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    MainTask& operator=(MainTask&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            if (other.ops_ != nullptr) {
+                other.ops_->move(storage_, other.storage_);
+                ops_ = other.ops_;
+                other.ops_ = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    MainTask(const MainTask&) = delete;
+    MainTask& operator=(const MainTask&) = delete;
+
+    ~MainTask() {
+        Reset();
+    }
+
+    void operator()() {
+        if (ops_ != nullptr) {
+            ops_->invoke(storage_);
+        }
+    }
+
+    explicit operator bool() const { return ops_ != nullptr; }
+
+private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        // Move the callable from src to dst and destroy the one in src
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* storage);
+    };
+
+    template<typename Callable>
+    static constexpr Ops kInlineOps = {
+        [](void* storage) { (*static_cast<Callable*>(storage))(); },
+        [](void* dst, void* src) {
+            new (dst) Callable(std::move(*static_cast<Callable*>(src)));
+            static_cast<Callable*>(src)->~Callable();
+        },
+        [](void* storage) { static_cast<Callable*>(storage)->~Callable(); },
+    };
+
+    template<typename Callable>
+    static constexpr Ops kHeapOps = {
+        [](void* storage) { (**static_cast<Callable**>(storage))(); },
+        [](void* dst, void* src) { *static_cast<Callable**>(dst) = *static_cast<Callable**>(src); },
+        [](void* storage) { delete *static_cast<Callable**>(storage); },
+    };
+
+    alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+    const Ops* ops_ = nullptr;
+
+    void Reset() {
+        if (ops_ != nullptr) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+};
+
+#endif // _MAIN_TASK_H_
@@ -8,20 +8,32 @@
 #include <esp_app_desc.h>
 #include <algorithm>
 #include <cstring>
-#include <esp_pthread.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 #include "application.h"
 #include "display.h"
 #include "board.h"
+#include "profiler.h"
 
 #define TAG "MCP"
 
 #define DEFAULT_TOOLCALL_STACK_SIZE 6144
+#define LARGE_TOOLCALL_STACK_SIZE 12288
+// 每组工作任务的数量和排队上限，排满后直接返回错误
+#define MCP_NORMAL_WORKER_COUNT 2
+#define MCP_LARGE_WORKER_COUNT 1
+#define MCP_MAX_PENDING_CALLS 4
+
+static const int kWorkerStackSizes[kMcpWorkerClassCount] = { DEFAULT_TOOLCALL_STACK_SIZE, LARGE_TOOLCALL_STACK_SIZE };
+static const int kWorkerCounts[kMcpWorkerClassCount] = { MCP_NORMAL_WORKER_COUNT, MCP_LARGE_WORKER_COUNT };
 
 McpServer::McpServer() {
 }
 
 McpServer::~McpServer() {
+    tool_index_.clear();
     for (auto tool : tools_) {
         delete tool;
     }
@@ -95,6 +107,9 @@ void McpServer::AddCommonTools() {
                 Property("question", kPropertyTypeString)
             }),
             [camera](const PropertyList& properties) -> ReturnValue {
+                // 两个工作线程可能同时拍照，拍照和上传必须是同一张照片
+                static std::mutex photo_mutex;
+                std::lock_guard<std::mutex> lock(photo_mutex);
                 if (!camera->Capture()) {
                     return "{\"success\": false, \"message\": \"Failed to capture photo\"}";
                 }
@@ -105,17 +120,43 @@ void McpServer::AddCommonTools() {
 
     // Restore the original tools list to the end of the tools list
     tools_.insert(tools_.end(), original_tools.begin(), original_tools.end());
+
+    AddTool("self.get_system_profile",
+        "Provides the performance profile of the device for diagnosing stutter: CPU usage and free stack of each task, "
+        "and the recent history of free heap and audio frame counts.",
+        PropertyList(),
+        [](const PropertyList& properties) -> ReturnValue {
+            return Profiler::GetInstance().GetJson();
+        });
+
+    AddTool("self.get_tool_call_stats",
+        "Provides the statistics of the tool calls handled by the device, including the call count, "
+        "the average and maximum execution time, and the time spent waiting in the queue.",
+        PropertyList(),
+        [this](const PropertyList& properties) -> ReturnValue {
+            return GetToolStatsJson();
+        });
 }
 
 void McpServer::AddTool(McpTool* tool) {
     // Prevent adding duplicate tools
-    if (std::find_if(tools_.begin(), tools_.end(), [tool](const McpTool* t) { return t->name() == tool->name(); }) != tools_.end()) {
+    if (tool_index_.find(tool->name()) != tool_index_.end()) {
         ESP_LOGW(TAG, "Tool %s already added", tool->name().c_str());
+        delete tool;
         return;
     }
 
     ESP_LOGI(TAG, "Add tool: %s", tool->name().c_str());
     tools_.push_back(tool);
+    tool_index_.emplace(tool->name(), tool);
+
+    tools_list_pages_.clear();
+    tools_list_cursors_.clear();
+    if (tools_list_sent_) {
+        // The server has already fetched the list, tell it to fetch again
+        tools_list_sent_ = false;
+        Application::GetInstance().SendMcpMessage("{\"jsonrpc\":\"2.0\",\"method\":\"notifications/tools/list_changed\"}");
+    }
 }
 
 void McpServer::AddTool(const std::string& name, const std::string& description, const PropertyList& properties, std::function<ReturnValue(const PropertyList&)> callback) {
@@ -193,7 +234,7 @@ void McpServer::ParseMessage(const cJSON* json) {
             }
         }
         auto app_desc = esp_app_get_description();
-        std::string message = "{\"protocolVersion\":\"2024-11-05\",\"capabilities\":{\"tools\":{}},\"serverInfo\":{\"name\":\"" BOARD_NAME "\",\"version\":\"";
+        std::string message = "{\"protocolVersion\":\"2024-11-05\",\"capabilities\":{\"tools\":{\"listChanged\":true}},\"serverInfo\":{\"name\":\"" BOARD_NAME "\",\"version\":\"";
         message += app_desc->version;
         message += "\"}}";
         ReplyResult(id_int, message);
@@ -254,114 +295,224 @@ void McpServer::ReplyError(int id, const std::string& message) {
     Application::GetInstance().SendMcpMessage(payload);
 }
 
-void McpServer::GetToolsList(int id, const std::string& cursor) {
-    const int max_payload_size = 8000;
-    std::string json = "{\"tools\":[";
-    
-    bool found_cursor = cursor.empty();
+void McpServer::BuildToolsListPages() {
+    const size_t max_payload_size = 8000;
+    tools_list_pages_.clear();
+    tools_list_cursors_.clear();
+
     auto it = tools_.begin();
-    std::string next_cursor = "";
-    
     while (it != tools_.end()) {
-        // 如果我们还没有找到起始位置，继续搜索
-        if (!found_cursor) {
-            if ((*it)->name() == cursor) {
-                found_cursor = true;
-            } else {
-                ++it;
-                continue;
+        ToolsListPage page;
+        std::string json = "{\"tools\":[";
+        auto first = it;
+        while (it != tools_.end()) {
+            // 添加tool前检查大小，预留 nextCursor 的空间
+            std::string tool_json = (*it)->to_json();
+            if (json.length() + tool_json.length() + 30 > max_payload_size) {
+                break;
             }
+            if (it != first) {
+                json += ",";
+            }
+            json += tool_json;
+            ++it;
         }
-        
-        // 添加tool前检查大小
-        std::string tool_json = (*it)->to_json() + ",";
-        if (json.length() + tool_json.length() + 30 > max_payload_size) {
-            // 如果添加这个tool会超出大小限制，设置next_cursor并退出循环
-            next_cursor = (*it)->name();
-            break;
+
+        tools_list_cursors_[(*first)->name()] = tools_list_pages_.size();
+        if (it == first) {
+            // 单个tool就超出了大小限制，请求到这一页时返回错误
+            page.error = "Failed to add tool " + (*it)->name() + " because of payload size limit";
+            ESP_LOGE(TAG, "tools/list: %s", page.error.c_str());
+            ++it;
+        } else if (it == tools_.end()) {
+            page.json = json + "]}";
+        } else {
+            page.json = json + "],\"nextCursor\":\"" + (*it)->name() + "\"}";
         }
-        
-        json += tool_json;
-        ++it;
+        tools_list_pages_.push_back(std::move(page));
     }
-    
-    if (json.back() == ',') {
-        json.pop_back();
+    ESP_LOGI(TAG, "tools/list: %u tools in %u pages", tools_.size(), tools_list_pages_.size());
+}
+
+void McpServer::GetToolsList(int id, const std::string& cursor) {
+    if (tools_list_pages_.empty() && !tools_.empty()) {
+        BuildToolsListPages();
     }
-    
-    if (json.back() == '[' && !tools_.empty()) {
-        // 如果没有添加任何tool，返回错误
-        ESP_LOGE(TAG, "tools/list: Failed to add tool %s because of payload size limit", next_cursor.c_str());
-        ReplyError(id, "Failed to add tool " + next_cursor + " because of payload size limit");
+    tools_list_sent_ = true;
+
+    if (tools_list_pages_.empty()) {
+        ReplyResult(id, "{\"tools\":[]}");
         return;
     }
 
-    if (next_cursor.empty()) {
-        json += "]}";
-    } else {
-        json += "],\"nextCursor\":\"" + next_cursor + "\"}";
+    size_t index = 0;
+    if (!cursor.empty()) {
+        auto it = tools_list_cursors_.find(cursor);
+        if (it == tools_list_cursors_.end()) {
+            ESP_LOGE(TAG, "tools/list: Invalid cursor %s", cursor.c_str());
+            ReplyError(id, "Invalid cursor: " + cursor);
+            return;
+        }
+        index = it->second;
     }
-    
-    ReplyResult(id, json);
+
+    auto& page = tools_list_pages_[index];
+    if (!page.error.empty()) {
+        ReplyError(id, page.error);
+        return;
+    }
+    ReplyResult(id, page.json);
 }
 
 void McpServer::DoToolCall(int id, const std::string& tool_name, const cJSON* tool_arguments, int stack_size) {
-    auto tool_iter = std::find_if(tools_.begin(), tools_.end(), 
-                                 [&tool_name](const McpTool* tool) { 
-                                     return tool->name() == tool_name; 
-                                 });
-    
-    if (tool_iter == tools_.end()) {
+    auto tool_iter = tool_index_.find(tool_name);
+    if (tool_iter == tool_index_.end()) {
         ESP_LOGE(TAG, "tools/call: Unknown tool: %s", tool_name.c_str());
         ReplyError(id, "Unknown tool: " + tool_name);
         return;
     }
+    McpTool* tool = tool_iter->second;
 
-    PropertyList arguments = (*tool_iter)->properties();
+    PropertyList arguments;
     try {
-        for (auto& argument : arguments) {
-            bool found = false;
-            if (cJSON_IsObject(tool_arguments)) {
-                auto value = cJSON_GetObjectItem(tool_arguments, argument.name().c_str());
-                if (argument.type() == kPropertyTypeBoolean && cJSON_IsBool(value)) {
-                    argument.set_value<bool>(value->valueint == 1);
-                    found = true;
-                } else if (argument.type() == kPropertyTypeInteger && cJSON_IsNumber(value)) {
-                    argument.set_value<int>(value->valueint);
-                    found = true;
-                } else if (argument.type() == kPropertyTypeString && cJSON_IsString(value)) {
-                    argument.set_value<std::string>(value->valuestring);
-                    found = true;
+        arguments = tool->properties().Bind(tool_arguments);
+    } catch (const std::exception& e) {
+        ESP_LOGE(TAG, "tools/call: %s", e.what());
+        ReplyError(id, e.what());
+        return;
+    }
+
+    // 超出工作任务栈大小的调用单独创建任务，和以前一样按请求的栈大小运行
+    if (stack_size > LARGE_TOOLCALL_STACK_SIZE) {
+        auto call = new McpToolCall{id, tool, std::move(arguments), esp_timer_get_time()};
+        auto ret = xTaskCreate([](void* arg) {
+            auto call = (McpToolCall*)arg;
+            McpServer::GetInstance().RunToolCall(*call);
+            delete call;
+            vTaskDelete(NULL);
+        }, "tool_call_large", stack_size, call, 1, nullptr);
+        if (ret != pdPASS) {
+            delete call;
+            ESP_LOGE(TAG, "tools/call: Failed to create task with stack size %d for %s", stack_size, tool_name.c_str());
+            ReplyError(id, "Not enough memory to run tool: " + tool_name);
+        }
+        return;
+    }
+
+    auto worker_class = stack_size > DEFAULT_TOOLCALL_STACK_SIZE ? kMcpWorkerLarge : kMcpWorkerNormal;
+    bool busy = false;
+    bool no_worker = false;
+    {
+        std::lock_guard<std::mutex> lock(calls_mutex_);
+        // Use worker tasks to call the tool to avoid blocking the main thread
+        if (workers_started_[worker_class] == 0) {
+            for (int i = 0; i < kWorkerCounts[worker_class]; i++) {
+                auto ret = xTaskCreate([](void* arg) {
+                    McpServer::GetInstance().WorkerLoop((McpWorkerClass)(intptr_t)arg);
+                    vTaskDelete(NULL);
+                }, "tool_call", kWorkerStackSizes[worker_class], (void*)(intptr_t)worker_class, 1, nullptr);
+                if (ret != pdPASS) {
+                    ESP_LOGE(TAG, "tools/call: Failed to create worker with stack size %d", kWorkerStackSizes[worker_class]);
+                    break;
                 }
+                workers_started_[worker_class]++;
             }
+        }
 
-            if (!argument.has_default_value() && !found) {
-                ESP_LOGE(TAG, "tools/call: Missing valid argument: %s", argument.name().c_str());
-                ReplyError(id, "Missing valid argument: " + argument.name());
-                return;
-            }
+        // 一个工作任务都没有时下次调用再重试创建
+        no_worker = workers_started_[worker_class] == 0;
+        auto& pending = pending_calls_[worker_class];
+        busy = pending.size() >= MCP_MAX_PENDING_CALLS;
+        if (!busy && !no_worker) {
+            pending.push_back(McpToolCall{id, tool, std::move(arguments), esp_timer_get_time()});
         }
+    }
+
+    if (no_worker) {
+        ReplyError(id, "Not enough memory to run tool: " + tool_name);
+        return;
+    }
+    if (busy) {
+        ESP_LOGW(TAG, "tools/call: Too many pending calls, rejecting %s", tool_name.c_str());
+        ReplyError(id, "Device is busy, too many pending tool calls");
+        return;
+    }
+    calls_cv_[worker_class].notify_one();
+}
+
+void McpServer::WorkerLoop(McpWorkerClass worker_class) {
+    while (true) {
+        std::unique_lock<std::mutex> lock(calls_mutex_);
+        calls_cv_[worker_class].wait(lock, [this, worker_class]() { return !pending_calls_[worker_class].empty(); });
+        auto call = std::move(pending_calls_[worker_class].front());
+        pending_calls_[worker_class].pop_front();
+        lock.unlock();
+
+        RunToolCall(call);
+    }
+}
+
+void McpServer::RunToolCall(McpToolCall& call) {
+    auto start_time = esp_timer_get_time();
+    try {
+        ReplyResult(call.id, call.tool->Call(call.arguments));
     } catch (const std::exception& e) {
         ESP_LOGE(TAG, "tools/call: %s", e.what());
-        ReplyError(id, e.what());
-        return;
+        ReplyError(call.id, e.what());
     }
+    auto end_time = esp_timer_get_time();
 
-    // Start a task to receive data with stack size
-    esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
-    cfg.thread_name = "tool_call";
-    cfg.stack_size = stack_size;
-    cfg.prio = 1;
-    esp_pthread_set_cfg(&cfg);
-
-    // Use a thread to call the tool to avoid blocking the main thread
-    tool_call_thread_ = std::thread([this, id, tool_iter, arguments = std::move(arguments)]() {
-        try {
-            ReplyResult(id, (*tool_iter)->Call(arguments));
-        } catch (const std::exception& e) {
-            ESP_LOGE(TAG, "tools/call: %s", e.what());
-            ReplyError(id, e.what());
+    std::lock_guard<std::mutex> lock(calls_mutex_);
+    auto& stats = tool_stats_[call.tool];
+    stats.calls++;
+    stats.total_us += end_time - start_time;
+    stats.max_us = std::max(stats.max_us, end_time - start_time);
+    stats.total_queue_us += start_time - call.enqueue_time;
+    stats.max_queue_us = std::max(stats.max_queue_us, start_time - call.enqueue_time);
+}
+
+void McpServer::CancelPendingCalls() {
+    std::deque<McpToolCall> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(calls_mutex_);
+        for (auto& pending : pending_calls_) {
+            while (!pending.empty()) {
+                cancelled.push_back(std::move(pending.front()));
+                pending.pop_front();
+            }
         }
-    });
-    tool_call_thread_.detach();
-}
\ No newline at end of file
+    }
+    for (auto& call : cancelled) {
+        ESP_LOGI(TAG, "tools/call: Cancelled %s", call.tool->name().c_str());
+        ReplyError(call.id, "Tool call cancelled");
+    }
+}
+
+std::string McpServer::GetToolStatsJson() {
+    cJSON* json = cJSON_CreateObject();
+    cJSON* tools = cJSON_CreateArray();
+    {
+        std::lock_guard<std::mutex> lock(calls_mutex_);
+        for (auto& [tool, stats] : tool_stats_) {
+            cJSON* item = cJSON_CreateObject();
+            cJSON_AddStringToObject(item, "name", tool->name().c_str());
+            cJSON_AddNumberToObject(item, "calls", stats.calls);
+            cJSON_AddNumberToObject(item, "avg_ms", stats.total_us / stats.calls / 1000);
+            cJSON_AddNumberToObject(item, "max_ms", stats.max_us / 1000);
+            cJSON_AddNumberToObject(item, "avg_queue_ms", stats.total_queue_us / stats.calls / 1000);
+            cJSON_AddNumberToObject(item, "max_queue_ms", stats.max_queue_us / 1000);
+            cJSON_AddItemToArray(tools, item);
+        }
+        int pending = 0;
+        for (auto& calls : pending_calls_) {
+            pending += calls.size();
+        }
+        cJSON_AddNumberToObject(json, "pending", pending);
+    }
+    cJSON_AddItemToObject(json, "tools", tools);
+    auto json_str = cJSON_PrintUnformatted(json);
+    std::string result(json_str);
+    cJSON_free(json_str);
+    cJSON_Delete(json);
+    return result;
+}
@@ -2,18 +2,23 @@
 #define MCP_SERVER_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <functional>
 #include <variant>
 #include <optional>
 #include <stdexcept>
-#include <thread>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
 
 #include <cJSON.h>
 
 // 添加类型别名
 using ReturnValue = std::variant<bool, int, std::string>;
+using PropertyValue = std::variant<bool, int, std::string>;
 
 enum PropertyType {
     kPropertyTypeBoolean,
@@ -25,7 +30,7 @@ class Property {
 private:
     std::string name_;
     PropertyType type_;
-    std::variant<bool, int, std::string> value_;
+    PropertyValue value_;
     bool has_default_value_;
     std::optional<int> min_value_;  // 新增：整数最小值
     std::optional<int> max_value_;  // 新增：整数最大值
@@ -67,21 +72,27 @@ public:
     inline int min_value() const { return min_value_.value_or(0); }
     inline int max_value() const { return max_value_.value_or(0); }
 
+    inline const PropertyValue& default_value() const { return value_; }
+
     template<typename T>
     inline T value() const {
         return std::get<T>(value_);
     }
 
+    // 对整数值进行范围检查
+    inline void CheckRange(int value) const {
+        if (min_value_.has_value() && value < min_value_.value()) {
+            throw std::invalid_argument("Value is below minimum allowed: " + std::to_string(min_value_.value()));
+        }
+        if (max_value_.has_value() && value > max_value_.value()) {
+            throw std::invalid_argument("Value exceeds maximum allowed: " + std::to_string(max_value_.value()));
+        }
+    }
+
     template<typename T>
     inline void set_value(const T& value) {
-        // 添加对设置的整数值进行范围检查
         if constexpr (std::is_same_v<T, int>) {
-            if (min_value_.has_value() && value < min_value_.value()) {
-                throw std::invalid_argument("Value is below minimum allowed: " + std::to_string(min_value_.value()));
-            }
-            if (max_value_.has_value() && value > max_value_.value()) {
-                throw std::invalid_argument("Value exceeds maximum allowed: " + std::to_string(max_value_.value()));
-            }
+            CheckRange(value);
         }
         value_ = value;
     }
@@ -121,28 +132,104 @@ public:
     }
 };
 
+// 参数的只读视图：名字和类型来自工具定义，值来自本次调用
+class PropertyRef {
+private:
+    const Property& property_;
+    const PropertyValue& value_;
+
+public:
+    PropertyRef(const Property& property, const PropertyValue& value) : property_(property), value_(value) {}
+
+    inline const std::string& name() const { return property_.name(); }
+    inline PropertyType type() const { return property_.type(); }
+
+    template<typename T>
+    inline T value() const {
+        return std::get<T>(value_);
+    }
+};
+
 class PropertyList {
 private:
     std::vector<Property> properties_;
+    // 名字到下标的索引，只在工具定义中建立，绑定后的列表通过 schema_ 查找
+    std::map<std::string, size_t, std::less<>> index_;
+    // 绑定调用参数后指向工具的参数定义，values_ 与其中的参数一一对应，不复制 Property
+    const PropertyList* schema_ = nullptr;
+    std::vector<PropertyValue> values_;
+
+    inline const std::vector<Property>& definitions() const {
+        return schema_ != nullptr ? schema_->properties_ : properties_;
+    }
+
+    inline PropertyRef At(size_t index) const {
+        const auto& property = definitions()[index];
+        return PropertyRef(property, schema_ != nullptr ? values_[index] : property.default_value());
+    }
 
 public:
+    // 按定义顺序遍历参数，绑定后的列表给出本次调用的值
+    class Iterator {
+    private:
+        const PropertyList* list_;
+        size_t index_;
+
+    public:
+        Iterator(const PropertyList* list, size_t index) : list_(list), index_(index) {}
+        PropertyRef operator*() const { return list_->At(index_); }
+        Iterator& operator++() {
+            index_++;
+            return *this;
+        }
+        bool operator!=(const Iterator& other) const { return index_ != other.index_; }
+    };
+
     PropertyList() = default;
-    PropertyList(const std::vector<Property>& properties) : properties_(properties) {}
+    PropertyList(const std::vector<Property>& properties) {
+        for (const auto& property : properties) {
+            AddProperty(property);
+        }
+    }
     void AddProperty(const Property& property) {
+        index_.emplace(property.name(), properties_.size());
         properties_.push_back(property);
     }
 
-    const Property& operator[](const std::string& name) const {
+    PropertyRef operator[](const std::string_view& name) const {
+        const auto& index = schema_ != nullptr ? schema_->index_ : index_;
+        auto it = index.find(name);
+        if (it == index.end()) {
+            throw std::runtime_error("Property not found: " + std::string(name));
+        }
+        return At(it->second);
+    }
+
+    // Bind the JSON arguments of a call to typed values, throws if a required argument is missing or out of range
+    PropertyList Bind(const cJSON* arguments) const {
+        PropertyList bound;
+        bound.schema_ = this;
+        bound.values_.reserve(properties_.size());
         for (const auto& property : properties_) {
-            if (property.name() == name) {
-                return property;
+            auto value = cJSON_IsObject(arguments) ? cJSON_GetObjectItem(arguments, property.name().c_str()) : nullptr;
+            if (property.type() == kPropertyTypeBoolean && cJSON_IsBool(value)) {
+                bound.values_.emplace_back(cJSON_IsTrue(value) != 0);
+            } else if (property.type() == kPropertyTypeInteger && cJSON_IsNumber(value)) {
+                property.CheckRange(value->valueint);
+                bound.values_.emplace_back(value->valueint);
+            } else if (property.type() == kPropertyTypeString && cJSON_IsString(value)) {
+                bound.values_.emplace_back(std::string(value->valuestring));
+            } else if (property.has_default_value()) {
+                bound.values_.push_back(property.default_value());
+            } else {
+                throw std::invalid_argument("Missing valid argument: " + property.name());
             }
         }
-        throw std::runtime_error("Property not found: " + name);
+        return bound;
     }
 
-    auto begin() { return properties_.begin(); }
-    auto end() { return properties_.end(); }
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, definitions().size()); }
 
     std::vector<std::string> GetRequired() const {
         std::vector<std::string> required;
@@ -249,6 +336,28 @@ public:
     }
 };
 
+// 工具调用按所需的栈大小分到不同的工作任务组
+enum McpWorkerClass {
+    kMcpWorkerNormal,
+    kMcpWorkerLarge,
+    kMcpWorkerClassCount
+};
+
+struct McpToolCall {
+    int id;
+    McpTool* tool;
+    PropertyList arguments;
+    int64_t enqueue_time;
+};
+
+struct McpToolStats {
+    uint32_t calls = 0;
+    int64_t total_us = 0;
+    int64_t max_us = 0;
+    int64_t total_queue_us = 0;
+    int64_t max_queue_us = 0;
+};
+
 class McpServer {
 public:
     static McpServer& GetInstance() {
@@ -261,6 +370,8 @@ public:
     void AddTool(const std::string& name, const std::string& description, const PropertyList& properties, std::function<ReturnValue(const PropertyList&)> callback);
     void ParseMessage(const cJSON* json);
     void ParseMessage(const std::string& message);
+    // Drop the tool calls that have not started yet, running calls finish normally
+    void CancelPendingCalls();
 
 private:
     McpServer();
@@ -272,10 +383,31 @@ private:
     void ReplyError(int id, const std::string& message);
 
     void GetToolsList(int id, const std::string& cursor);
+    void BuildToolsListPages();
     void DoToolCall(int id, const std::string& tool_name, const cJSON* tool_arguments, int stack_size);
+    void WorkerLoop(McpWorkerClass worker_class);
+    void RunToolCall(McpToolCall& call);
+    std::string GetToolStatsJson();
 
     std::vector<McpTool*> tools_;
-    std::thread tool_call_thread_;
+    // 按名字索引工具，键引用 McpTool 中的名字
+    std::unordered_map<std::string_view, McpTool*> tool_index_;
+
+    // tools/list 的分页结果只在工具变化后重新生成，cursor 为每页第一个工具的名字
+    struct ToolsListPage {
+        std::string json;
+        std::string error;
+    };
+    std::vector<ToolsListPage> tools_list_pages_;
+    std::unordered_map<std::string, size_t> tools_list_cursors_;
+    bool tools_list_sent_ = false;
+
+    // 固定数量的工作任务执行工具调用，第一次用到时才创建
+    std::mutex calls_mutex_;
+    std::condition_variable calls_cv_[kMcpWorkerClassCount];
+    std::deque<McpToolCall> pending_calls_[kMcpWorkerClassCount];
+    int workers_started_[kMcpWorkerClassCount] = {};
+    std::unordered_map<const McpTool*, McpToolStats> tool_stats_;
 };
 
 #endif // MCP_SERVER_H
@@ -7,9 +7,11 @@
 #include <esp_log.h>
 #include <esp_partition.h>
 #include <esp_ota_ops.h>
-#include <esp_app_format.h>
 #include <esp_efuse.h>
 #include <esp_efuse_table.h>
+#include <esp_timer.h>
+#include <mbedtls/sha256.h>
+#include <freertos/FreeRTOS.h>
 #ifdef SOC_HMAC_SUPPORTED
 #include <esp_hmac.h>
 #endif
@@ -142,17 +144,14 @@ bool Ota::CheckVersion() {
     has_mqtt_config_ = false;
     cJSON *mqtt = cJSON_GetObjectItem(root, "mqtt");
     if (cJSON_IsObject(mqtt)) {
+        // Unchanged values are not written, all changes are committed together
         Settings settings("mqtt", true);
         cJSON *item = NULL;
         cJSON_ArrayForEach(item, mqtt) {
             if (cJSON_IsString(item)) {
-                if (settings.GetString(item->string) != item->valuestring) {
-                    settings.SetString(item->string, item->valuestring);
-                }
+                settings.SetString(item->string, item->valuestring);
             } else if (cJSON_IsNumber(item)) {
-                if (settings.GetInt(item->string) != item->valueint) {
-                    settings.SetInt(item->string, item->valueint);
-                }
+                settings.SetInt(item->string, item->valueint);
             }
         }
         has_mqtt_config_ = true;
@@ -163,17 +162,14 @@ bool Ota::CheckVersion() {
     has_websocket_config_ = false;
     cJSON *websocket = cJSON_GetObjectItem(root, "websocket");
     if (cJSON_IsObject(websocket)) {
+        // Unchanged values are not written, all changes are committed together
         Settings settings("websocket", true);
         cJSON *item = NULL;
         cJSON_ArrayForEach(item, websocket) {
             if (cJSON_IsString(item)) {
-                if (settings.GetString(item->string) != item->valuestring) {
-                    settings.SetString(item->string, item->valuestring);
-                }
+                settings.SetString(item->string, item->valuestring);
             } else if (cJSON_IsNumber(item)) {
-                if (settings.GetInt(item->string) != item->valueint) {
-                    settings.SetInt(item->string, item->valueint);
-                }
+                settings.SetInt(item->string, item->valueint);
             }
         }
         has_websocket_config_ = true;
@@ -217,6 +213,19 @@ bool Ota::CheckVersion() {
         if (cJSON_IsString(url)) {
             firmware_url_ = url->valuestring;
         }
+        // Optional, the hex SHA-256 of the whole image, verified while downloading
+        cJSON *sha256 = cJSON_GetObjectItem(firmware, "sha256");
+        firmware_sha256_ = cJSON_IsString(sha256) ? sha256->valuestring : "";
+        // Optional, delta patches keyed by the source version
+        patch_url_.clear();
+        cJSON *patches = cJSON_GetObjectItem(firmware, "patches");
+        if (cJSON_IsObject(patches)) {
+            cJSON *patch = cJSON_GetObjectItem(patches, current_version_.c_str());
+            if (cJSON_IsString(patch)) {
+                patch_url_ = patch->valuestring;
+                ESP_LOGI(TAG, "Delta patch available from %s", current_version_.c_str());
+            }
+        }
 
         if (cJSON_IsString(version) && cJSON_IsString(url)) {
             // Check if the version is newer, for example, 0.1.0 is newer than 0.0.1
@@ -260,6 +269,270 @@ void Ota::MarkCurrentVersionValid() {
     }
 }
 
+namespace {
+
+/*
+ * 差分升级补丁格式（小端）：
+ *   OtaPatchHeader
+ *   若干指令：
+ *     0x01 COPY   u32 source_offset, u32 length  从正在运行的分区复制
+ *     0x02 INSERT u32 length, 随后 length 字节   直接写入补丁中的数据
+ *     0x00 END
+ * 补丁由 scripts/ota_delta.py 生成
+ */
+#define OTA_PATCH_MAGIC "XZDP"
+#define OTA_PATCH_VERSION 1
+
+struct OtaPatchHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t target_size;
+    uint8_t source_sha256[32];
+    uint8_t target_sha256[32];
+} __attribute__((packed));
+
+enum OtaPatchOp : uint8_t {
+    kOtaPatchOpEnd = 0,
+    kOtaPatchOpCopy = 1,
+    kOtaPatchOpInsert = 2,
+};
+
+// 流式应用补丁，内存占用只有 OtaWriter 的缓冲区和几个字节的指令参数
+class OtaPatcher {
+public:
+    OtaPatcher(OtaWriter& writer, const esp_partition_t* source, const esp_partition_t* target)
+        : writer_(writer), source_(source), target_(target) {}
+
+    bool Feed(const uint8_t* data, size_t len) {
+        size_t pos = 0;
+        while (pos < len && !failed_) {
+            switch (state_) {
+            case kStateHeader:
+            case kStateOpcode:
+            case kStateArgs:
+                pos += Collect(data + pos, len - pos);
+                break;
+            case kStateInsertData: {
+                size_t n = std::min((size_t)remaining_, len - pos);
+                if (!Emit(data + pos, n)) {
+                    return false;
+                }
+                pos += n;
+                remaining_ -= n;
+                if (remaining_ == 0) {
+                    Expect(kStateOpcode, 1);
+                }
+                break;
+            }
+            case kStateDone:
+                // Ignore trailing data
+                return true;
+            }
+        }
+        return !failed_;
+    }
+
+    // Flush the last block, returns true if the END op was reached and the size matches
+    bool Finish() {
+        if (failed_ || state_ != kStateDone) {
+            ESP_LOGE(TAG, "Patch is incomplete");
+            return false;
+        }
+        if (block_ != nullptr && block_->len > 0) {
+            writer_.Submit(block_);
+            block_ = nullptr;
+        }
+        if (output_ != header_.target_size) {
+            ESP_LOGE(TAG, "Patched image size mismatch, expected %lu, got %u", header_.target_size, output_);
+            return false;
+        }
+        return true;
+    }
+
+    const OtaPatchHeader& header() const { return header_; }
+
+private:
+    enum State {
+        kStateHeader,
+        kStateOpcode,
+        kStateArgs,
+        kStateInsertData,
+        kStateDone,
+    };
+
+    OtaWriter& writer_;
+    const esp_partition_t* source_;
+    const esp_partition_t* target_;
+    OtaPatchHeader header_ = {};
+    State state_ = kStateHeader;
+    uint8_t args_[sizeof(OtaPatchHeader)];
+    size_t args_len_ = 0;
+    size_t args_needed_ = sizeof(OtaPatchHeader);
+    uint8_t op_ = kOtaPatchOpEnd;
+    uint32_t remaining_ = 0;
+    size_t output_ = 0;
+    OtaBlock* block_ = nullptr;
+    bool failed_ = false;
+
+    void Expect(State state, size_t bytes) {
+        state_ = state;
+        args_len_ = 0;
+        args_needed_ = bytes;
+    }
+
+    static uint32_t ReadU32(const uint8_t* p) {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    size_t Collect(const uint8_t* data, size_t len) {
+        size_t n = std::min(args_needed_ - args_len_, len);
+        memcpy(args_ + args_len_, data, n);
+        args_len_ += n;
+        if (args_len_ == args_needed_) {
+            OnArgs();
+        }
+        return n;
+    }
+
+    void OnArgs() {
+        switch (state_) {
+        case kStateHeader:
+            memcpy(&header_, args_, sizeof(header_));
+            failed_ = !VerifySource();
+            Expect(kStateOpcode, 1);
+            break;
+        case kStateOpcode:
+            op_ = args_[0];
+            if (op_ == kOtaPatchOpEnd) {
+                state_ = kStateDone;
+            } else if (op_ == kOtaPatchOpCopy) {
+                Expect(kStateArgs, 8);
+            } else if (op_ == kOtaPatchOpInsert) {
+                Expect(kStateArgs, 4);
+            } else {
+                ESP_LOGE(TAG, "Invalid patch op: %u", op_);
+                failed_ = true;
+            }
+            break;
+        case kStateArgs:
+            if (op_ == kOtaPatchOpCopy) {
+                uint32_t offset = ReadU32(args_);
+                uint32_t length = ReadU32(args_ + 4);
+                if (offset + (uint64_t)length > header_.source_size) {
+                    ESP_LOGE(TAG, "Patch copy out of range: %lu+%lu", offset, length);
+                    failed_ = true;
+                    break;
+                }
+                failed_ = !EmitFromSource(offset, length);
+                Expect(kStateOpcode, 1);
+            } else {
+                remaining_ = ReadU32(args_);
+                if (remaining_ == 0) {
+                    Expect(kStateOpcode, 1);
+                } else {
+                    state_ = kStateInsertData;
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool VerifySource() {
+        if (memcmp(header_.magic, OTA_PATCH_MAGIC, 4) != 0 || header_.version != OTA_PATCH_VERSION) {
+            ESP_LOGE(TAG, "Invalid patch header");
+            return false;
+        }
+        if (header_.source_size > source_->size || header_.target_size > target_->size) {
+            ESP_LOGE(TAG, "Patch sizes do not fit the partitions");
+            return false;
+        }
+
+        // 补丁必须基于当前正在运行的固件生成
+        block_ = writer_.AcquireBlock();
+        block_->offset = 0;
+        block_->len = 0;
+        mbedtls_sha256_context sha256;
+        mbedtls_sha256_init(&sha256);
+        mbedtls_sha256_starts(&sha256, 0);
+        for (size_t pos = 0; pos < header_.source_size; pos += block_->capacity) {
+            size_t len = std::min(block_->capacity, (size_t)(header_.source_size - pos));
+            if (esp_partition_read(source_, pos, block_->data, len) != ESP_OK) {
+                mbedtls_sha256_free(&sha256);
+                return false;
+            }
+            mbedtls_sha256_update(&sha256, block_->data, len);
+        }
+        uint8_t digest[32];
+        mbedtls_sha256_finish(&sha256, digest);
+        mbedtls_sha256_free(&sha256);
+        if (memcmp(digest, header_.source_sha256, sizeof(digest)) != 0) {
+            ESP_LOGE(TAG, "Patch was not generated for the running firmware");
+            return false;
+        }
+        return true;
+    }
+
+    // Make sure there is a block with free space
+    bool PrepareBlock() {
+        if (block_ != nullptr && block_->len == block_->capacity) {
+            writer_.Submit(block_);
+            block_ = nullptr;
+        }
+        if (block_ == nullptr) {
+            block_ = writer_.AcquireBlock();
+            block_->offset = output_;
+            block_->len = 0;
+        }
+        return !writer_.failed();
+    }
+
+    bool Emit(const uint8_t* data, size_t len) {
+        if (output_ + len > header_.target_size) {
+            ESP_LOGE(TAG, "Patched image exceeds target size");
+            return false;
+        }
+        while (len > 0) {
+            if (!PrepareBlock()) {
+                return false;
+            }
+            size_t n = std::min(block_->capacity - block_->len, len);
+            memcpy(block_->data + block_->len, data, n);
+            block_->len += n;
+            output_ += n;
+            data += n;
+            len -= n;
+        }
+        return true;
+    }
+
+    bool EmitFromSource(uint32_t offset, uint32_t len) {
+        if (output_ + len > header_.target_size) {
+            ESP_LOGE(TAG, "Patched image exceeds target size");
+            return false;
+        }
+        while (len > 0) {
+            if (!PrepareBlock()) {
+                return false;
+            }
+            size_t n = std::min(block_->capacity - block_->len, (size_t)len);
+            if (esp_partition_read(source_, offset, block_->data + block_->len, n) != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to read running partition at 0x%lx", offset);
+                return false;
+            }
+            block_->len += n;
+            output_ += n;
+            offset += n;
+            len -= n;
+        }
+        return true;
+    }
+};
+
+} // namespace
+
 bool Ota::Upgrade(const std::string& firmware_url) {
     ESP_LOGI(TAG, "Upgrading firmware from %s", firmware_url.c_str());
     esp_ota_handle_t update_handle = 0;
@@ -270,108 +543,150 @@ bool Ota::Upgrade(const std::string& firmware_url) {
     }
 
     ESP_LOGI(TAG, "Writing to partition %s at offset 0x%lx", update_partition->label, update_partition->address);
-    bool image_header_checked = false;
-    std::string image_header;
+    // esp_ota_begin 只用于分区和回滚状态检查；数据直接写入分区，这样可以从任意扇区边界续传，
+    // 镜像由 esp_ota_set_boot_partition 在最后校验
+    if (esp_ota_begin(update_partition, OTA_WITH_SEQUENTIAL_WRITES, &update_handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to begin OTA");
+        return false;
+    }
+    esp_ota_abort(update_handle);
+
+    OtaDownloader downloader(Board::GetInstance().GetNetwork(), update_partition, firmware_url);
+    downloader.OnProgress(upgrade_callback_);
+    uint8_t sha256[32];
+    bool downloaded = downloader.Download(sha256);
+    upgrade_stats_ = downloader.stats();
+    if (!downloaded) {
+        return false;
+    }
+
+    if (!firmware_sha256_.empty()) {
+        char sha256_hex[65];
+        for (int i = 0; i < 32; i++) {
+            sprintf(sha256_hex + i * 2, "%02x", sha256[i]);
+        }
+        if (strcasecmp(sha256_hex, firmware_sha256_.c_str()) != 0) {
+            ESP_LOGE(TAG, "SHA-256 mismatch, expected %s, got %s", firmware_sha256_.c_str(), sha256_hex);
+            OtaDownloader::ClearResumeState();
+            return false;
+        }
+        ESP_LOGI(TAG, "SHA-256 verified: %s", sha256_hex);
+    }
+
+    esp_err_t err = esp_ota_set_boot_partition(update_partition);
+    OtaDownloader::ClearResumeState();
+    if (err != ESP_OK) {
+        if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
+            ESP_LOGE(TAG, "Image validation failed, image is corrupted");
+        } else {
+            ESP_LOGE(TAG, "Failed to set boot partition: %s", esp_err_to_name(err));
+        }
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Firmware upgrade successful");
+    return true;
+}
+
+bool Ota::UpgradeFromPatch(const std::string& patch_url) {
+    ESP_LOGI(TAG, "Upgrading firmware with patch %s", patch_url.c_str());
+    auto running_partition = esp_ota_get_running_partition();
+    auto update_partition = esp_ota_get_next_update_partition(NULL);
+    if (running_partition == NULL || update_partition == NULL) {
+        ESP_LOGE(TAG, "Failed to get OTA partitions");
+        return false;
+    }
+
+    esp_ota_handle_t update_handle = 0;
+    if (esp_ota_begin(update_partition, OTA_WITH_SEQUENTIAL_WRITES, &update_handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to begin OTA");
+        return false;
+    }
+    esp_ota_abort(update_handle);
 
     auto network = Board::GetInstance().GetNetwork();
     auto http = network->CreateHttp(0);
-    if (!http->Open("GET", firmware_url)) {
+    if (!http->Open("GET", patch_url)) {
         ESP_LOGE(TAG, "Failed to open HTTP connection");
         return false;
     }
-
     if (http->GetStatusCode() != 200) {
-        ESP_LOGE(TAG, "Failed to get firmware, status code: %d", http->GetStatusCode());
+        ESP_LOGE(TAG, "Failed to get patch, status code: %d", http->GetStatusCode());
         return false;
     }
+    size_t patch_size = http->GetBodyLength();
 
-    size_t content_length = http->GetBodyLength();
-    if (content_length == 0) {
-        ESP_LOGE(TAG, "Failed to get content length");
+    // 补丁不支持续传，中断后从头开始。补丁会从头改写更新分区，
+    // 先清除完整镜像的续传记录，否则回退到完整升级时会接着已被覆盖的数据续传
+    OtaDownloader::ClearResumeState();
+    OtaWriter writer(update_partition, 0, false);
+    if (!writer.Start()) {
         return false;
     }
+    OtaPatcher patcher(writer, running_partition, update_partition);
 
-    char buffer[512];
-    size_t total_read = 0, recent_read = 0;
+    char buffer[1024];
+    size_t received = 0, recent_read = 0;
+    bool success = true;
     auto last_calc_time = esp_timer_get_time();
-    while (true) {
+    while (patch_size == 0 || received < patch_size) {
         int ret = http->Read(buffer, sizeof(buffer));
         if (ret < 0) {
-            ESP_LOGE(TAG, "Failed to read HTTP data: %s", esp_err_to_name(ret));
-            return false;
+            ESP_LOGE(TAG, "Failed to read patch: %s", esp_err_to_name(ret));
+            success = false;
+            break;
         }
-
-        // Calculate speed and progress every second
+        if (ret == 0) {
+            break;
+        }
+        received += ret;
         recent_read += ret;
-        total_read += ret;
-        if (esp_timer_get_time() - last_calc_time >= 1000000 || ret == 0) {
-            size_t progress = total_read * 100 / content_length;
-            ESP_LOGI(TAG, "Progress: %u%% (%u/%u), Speed: %uB/s", progress, total_read, content_length, recent_read);
+        if (!patcher.Feed((const uint8_t*)buffer, ret)) {
+            success = false;
+            break;
+        }
+
+        if (esp_timer_get_time() - last_calc_time >= 1000000 || received == patch_size) {
+            size_t progress = patch_size > 0 ? received * 100 / patch_size : 0;
+            ESP_LOGI(TAG, "Patch progress: %u%% (%u/%u), Speed: %uB/s", progress, received, patch_size, recent_read);
             if (upgrade_callback_) {
                 upgrade_callback_(progress, recent_read);
             }
             last_calc_time = esp_timer_get_time();
             recent_read = 0;
         }
-
-        if (ret == 0) {
-            break;
-        }
-
-        if (!image_header_checked) {
-            image_header.append(buffer, ret);
-            if (image_header.size() >= sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t)) {
-                esp_app_desc_t new_app_info;
-                memcpy(&new_app_info, image_header.data() + sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t), sizeof(esp_app_desc_t));
-                ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
-
-                auto current_version = esp_app_get_description()->version;
-                if (memcmp(new_app_info.version, current_version, sizeof(new_app_info.version)) == 0) {
-                    ESP_LOGE(TAG, "Firmware version is the same, skipping upgrade");
-                    return false;
-                }
-
-                if (esp_ota_begin(update_partition, OTA_WITH_SEQUENTIAL_WRITES, &update_handle)) {
-                    esp_ota_abort(update_handle);
-                    ESP_LOGE(TAG, "Failed to begin OTA");
-                    return false;
-                }
-
-                image_header_checked = true;
-                std::string().swap(image_header);
-            }
-        }
-        auto err = esp_ota_write(update_handle, buffer, ret);
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to write OTA data: %s", esp_err_to_name(err));
-            esp_ota_abort(update_handle);
-            return false;
-        }
     }
     http->Close();
 
-    esp_err_t err = esp_ota_end(update_handle);
-    if (err != ESP_OK) {
-        if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
-            ESP_LOGE(TAG, "Image validation failed, image is corrupted");
-        } else {
-            ESP_LOGE(TAG, "Failed to end OTA: %s", esp_err_to_name(err));
-        }
+    success = success && patcher.Finish();
+    uint8_t sha256[32];
+    if (!writer.Finish(sha256) || !success) {
+        return false;
+    }
+    if (memcmp(sha256, patcher.header().target_sha256, sizeof(sha256)) != 0) {
+        ESP_LOGE(TAG, "Patched image SHA-256 mismatch");
         return false;
     }
+    ESP_LOGI(TAG, "Patch applied, %u bytes downloaded for a %lu bytes image", received, patcher.header().target_size);
 
-    err = esp_ota_set_boot_partition(update_partition);
+    esp_err_t err = esp_ota_set_boot_partition(update_partition);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to set boot partition: %s", esp_err_to_name(err));
         return false;
     }
-
     ESP_LOGI(TAG, "Firmware upgrade successful");
     return true;
 }
 
 bool Ota::StartUpgrade(std::function<void(int progress, size_t speed)> callback) {
     upgrade_callback_ = callback;
+    // 优先使用差分补丁，失败时回退到完整固件
+    if (!patch_url_.empty()) {
+        if (UpgradeFromPatch(patch_url_)) {
+            return true;
+        }
+        ESP_LOGW(TAG, "Delta upgrade failed, falling back to full image");
+    }
     return Upgrade(firmware_url_);
 }
 
@@ -6,6 +6,7 @@
 
 #include <esp_err.h>
 #include "board.h"
+#include "ota_download.h"
 
 class Ota {
 public:
@@ -28,6 +29,7 @@ public:
     const std::string& GetActivationMessage() const { return activation_message_; }
     const std::string& GetActivationCode() const { return activation_code_; }
     std::string GetCheckVersionUrl();
+    const OtaUpgradeStats& GetUpgradeStats() const { return upgrade_stats_; }
 
 private:
     std::string activation_message_;
@@ -42,11 +44,15 @@ private:
     std::string current_version_;
     std::string firmware_version_;
     std::string firmware_url_;
+    std::string firmware_sha256_;
+    std::string patch_url_;
     std::string activation_challenge_;
     std::string serial_number_;
     int activation_timeout_ms_ = 30000;
+    OtaUpgradeStats upgrade_stats_ = {};
 
     bool Upgrade(const std::string& firmware_url);
+    bool UpgradeFromPatch(const std::string& patch_url);
     std::function<void(int progress, size_t speed)> upgrade_callback_;
     std::vector<int> ParseVersion(const std::string& version);
     bool IsNewVersionAvailable(const std::string& currentVersion, const std::string& newVersion);
@@ -0,0 +1,400 @@
+#include "ota_download.h"
+#include "settings.h"
+
+#include <esp_log.h>
+#include <esp_app_desc.h>
+#include <esp_app_format.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <spi_flash_mmap.h>
+
+#include <cstring>
+#include <algorithm>
+
+#define TAG "Ota"
+
+OtaWriter::OtaWriter(const esp_partition_t* partition, size_t offset, bool save_progress)
+    : partition_(partition), erased_until_(offset), written_(offset), last_saved_(offset), save_progress_(save_progress) {
+    mbedtls_sha256_init(&sha256_);
+    mbedtls_sha256_starts(&sha256_, 0);
+}
+
+OtaWriter::~OtaWriter() {
+    if (task_ != nullptr) {
+        // Stop the writer task if it is still running
+        OtaBlock* end = nullptr;
+        xQueueSend(filled_blocks_, &end, portMAX_DELAY);
+        xSemaphoreTake(done_, portMAX_DELAY);
+    }
+    for (auto& block : blocks_) {
+        if (block.data != nullptr) {
+            heap_caps_free(block.data);
+        }
+    }
+    if (free_blocks_ != nullptr) {
+        vQueueDelete(free_blocks_);
+    }
+    if (filled_blocks_ != nullptr) {
+        vQueueDelete(filled_blocks_);
+    }
+    if (done_ != nullptr) {
+        vSemaphoreDelete(done_);
+    }
+    mbedtls_sha256_free(&sha256_);
+}
+
+bool OtaWriter::Start() {
+    free_blocks_ = xQueueCreate(OTA_BUFFER_COUNT, sizeof(OtaBlock*));
+    filled_blocks_ = xQueueCreate(OTA_BUFFER_COUNT + 1, sizeof(OtaBlock*));
+    done_ = xSemaphoreCreateBinary();
+    if (free_blocks_ == nullptr || filled_blocks_ == nullptr || done_ == nullptr) {
+        ESP_LOGE(TAG, "Failed to create OTA writer queues");
+        return false;
+    }
+    // PSRAM 上使用大缓冲区；没有 PSRAM 时逐级减小到一个 flash 扇区，宁可慢一些也不放弃升级
+    static const struct {
+        size_t size;
+        uint32_t caps;
+    } candidates[] = {
+        {OTA_BUFFER_SIZE, MALLOC_CAP_SPIRAM},
+        {OTA_BUFFER_MIN_SIZE, MALLOC_CAP_8BIT},
+        {OTA_BUFFER_MIN_SIZE / 2, MALLOC_CAP_8BIT},
+        {OTA_BUFFER_SECTOR_SIZE, MALLOC_CAP_8BIT},
+    };
+    int count = 0;
+    for (auto& candidate : candidates) {
+        count = 0;
+        for (auto& block : blocks_) {
+            block.capacity = candidate.size;
+            block.data = (uint8_t*)heap_caps_malloc(block.capacity, candidate.caps);
+            if (block.data == nullptr) {
+                break;
+            }
+            count++;
+        }
+        // 至少双缓冲才能让网络和 flash 并行；最小的块只有一个也能串行完成
+        bool last = &candidate == &candidates[sizeof(candidates) / sizeof(candidates[0]) - 1];
+        if (count >= 2 || (last && count >= 1)) {
+            break;
+        }
+        for (auto& block : blocks_) {
+            heap_caps_free(block.data);
+            block.data = nullptr;
+        }
+        count = 0;
+    }
+    if (count == 0) {
+        ESP_LOGE(TAG, "Failed to allocate OTA buffer");
+        return false;
+    }
+    for (auto& block : blocks_) {
+        if (block.data != nullptr) {
+            OtaBlock* ptr = &block;
+            xQueueSend(free_blocks_, &ptr, 0);
+        }
+    }
+    ESP_LOGI(TAG, "Using %d OTA buffers of %u bytes", count, blocks_[0].capacity);
+
+    // 续传时先把已写入的部分从 flash 读回来计算哈希
+    if (written_ > 0) {
+        ESP_LOGI(TAG, "Hashing %u bytes already written", written_);
+        uint8_t* buffer = blocks_[0].data;
+        for (size_t pos = 0; pos < written_; pos += blocks_[0].capacity) {
+            size_t len = std::min(blocks_[0].capacity, written_ - pos);
+            if (esp_partition_read(partition_, pos, buffer, len) != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to read back partition at 0x%x", pos);
+                return false;
+            }
+            mbedtls_sha256_update(&sha256_, buffer, len);
+        }
+    }
+
+    xTaskCreate([](void* arg) {
+        auto writer = (OtaWriter*)arg;
+        writer->WriterTask();
+        vTaskDelete(NULL);
+    }, "ota_writer", 4096, this, 4, &task_);
+    return task_ != nullptr;
+}
+
+OtaBlock* OtaWriter::AcquireBlock() {
+    OtaBlock* block = nullptr;
+    if (xQueueReceive(free_blocks_, &block, 0) != pdTRUE) {
+        auto start_time = esp_timer_get_time();
+        xQueueReceive(free_blocks_, &block, portMAX_DELAY);
+        flash_wait_us_ += esp_timer_get_time() - start_time;
+    }
+    return block;
+}
+
+void OtaWriter::Submit(OtaBlock* block) {
+    xQueueSend(filled_blocks_, &block, portMAX_DELAY);
+}
+
+bool OtaWriter::Finish(uint8_t sha256[32]) {
+    OtaBlock* end = nullptr;
+    xQueueSend(filled_blocks_, &end, portMAX_DELAY);
+    xSemaphoreTake(done_, portMAX_DELAY);
+    task_ = nullptr;
+    if (failed_) {
+        return false;
+    }
+    mbedtls_sha256_finish(&sha256_, sha256);
+    return true;
+}
+
+void OtaWriter::WriterTask() {
+    while (true) {
+        OtaBlock* block = nullptr;
+        xQueueReceive(filled_blocks_, &block, portMAX_DELAY);
+        if (block == nullptr) {
+            break;
+        }
+        auto start_time = esp_timer_get_time();
+        if (!failed_ && !WriteBlock(*block)) {
+            failed_ = true;
+        }
+        flash_write_us_ += esp_timer_get_time() - start_time;
+        // Return the buffer to the receiver
+        xQueueSend(free_blocks_, &block, portMAX_DELAY);
+    }
+    xSemaphoreGive(done_);
+}
+
+bool OtaWriter::WriteBlock(const OtaBlock& block) {
+    // 每个块都从扇区边界开始，写入前擦除它覆盖的扇区
+    size_t end = block.offset + block.len;
+    if (end > erased_until_) {
+        size_t erase_end = (end + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+        auto err = esp_partition_erase_range(partition_, erased_until_, erase_end - erased_until_);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to erase OTA partition: %s", esp_err_to_name(err));
+            return false;
+        }
+        erased_until_ = erase_end;
+    }
+
+    auto err = esp_partition_write(partition_, block.offset, block.data, block.len);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write OTA data: %s", esp_err_to_name(err));
+        return false;
+    }
+    mbedtls_sha256_update(&sha256_, block.data, block.len);
+    written_ = end;
+
+    if (save_progress_ && written_ - last_saved_ >= OTA_RESUME_SAVE_INTERVAL) {
+        Settings settings("ota", true);
+        settings.SetInt("offset", written_);
+        last_saved_ = written_;
+    }
+    return true;
+}
+
+OtaDownloader::OtaDownloader(NetworkInterface* network, const esp_partition_t* partition, const std::string& url)
+    : network_(network), partition_(partition), url_(url) {
+}
+
+void OtaDownloader::ClearResumeState() {
+    Settings settings("ota", true);
+    settings.EraseAll();
+}
+
+// Open the firmware URL and position the body at the given offset
+std::unique_ptr<Http> OtaDownloader::OpenAt(size_t position) {
+    auto http = network_->CreateHttp(0);
+    if (position > 0) {
+        http->SetHeader("Range", "bytes=" + std::to_string(position) + "-");
+    }
+    if (!http->Open("GET", url_)) {
+        ESP_LOGE(TAG, "Failed to open HTTP connection");
+        return nullptr;
+    }
+    auto status_code = http->GetStatusCode();
+    size_t body_length = http->GetBodyLength();
+    if (status_code == 206) {
+        image_size_ = position + body_length;
+        return http;
+    }
+    if (status_code != 200) {
+        ESP_LOGE(TAG, "Failed to get firmware, status code: %d", status_code);
+        return nullptr;
+    }
+    image_size_ = body_length;
+    if (position > 0) {
+        // 服务器不支持 Range 请求，丢弃已经收到的部分
+        ESP_LOGW(TAG, "Server ignored range request, skipping %u bytes", position);
+        char discard[512];
+        size_t skipped = 0;
+        while (skipped < position) {
+            int ret = http->Read(discard, std::min(sizeof(discard), position - skipped));
+            if (ret <= 0) {
+                return nullptr;
+            }
+            skipped += ret;
+        }
+    }
+    return http;
+}
+
+bool OtaDownloader::Download(uint8_t sha256[32]) {
+    // 如果上次下载同一个固件时中断，则从保存的位置继续
+    size_t offset = 0;
+    size_t saved_size = 0;
+    {
+        Settings settings("ota", false);
+        if (settings.GetString("url") == url_ && settings.GetString("partition") == partition_->label) {
+            offset = settings.GetInt("offset");
+            saved_size = settings.GetInt("size");
+        }
+    }
+
+    image_size_ = 0;
+    stats_ = {};
+    auto start_time = esp_timer_get_time();
+
+    auto http = OpenAt(offset);
+    stats_.connect_us = esp_timer_get_time() - start_time;
+    if (http && offset > 0 && image_size_ != saved_size) {
+        ESP_LOGW(TAG, "Firmware size changed (%u -> %u), restarting download", saved_size, image_size_);
+        http->Close();
+        offset = 0;
+        http = OpenAt(0);
+    }
+    if (!http) {
+        return false;
+    }
+    if (image_size_ == 0) {
+        ESP_LOGE(TAG, "Failed to get content length");
+        return false;
+    }
+    if (image_size_ > partition_->size) {
+        ESP_LOGE(TAG, "Firmware size %u exceeds partition size %lu", image_size_, partition_->size);
+        return false;
+    }
+
+    if (offset > 0) {
+        ESP_LOGI(TAG, "Resuming download at %u/%u", offset, image_size_);
+    } else {
+        Settings settings("ota", true);
+        settings.EraseAll();
+        settings.SetString("url", url_);
+        settings.SetString("partition", partition_->label);
+        settings.SetInt("size", image_size_);
+        settings.SetInt("offset", 0);
+    }
+
+    OtaWriter writer(partition_, offset);
+    if (!writer.Start()) {
+        return false;
+    }
+
+    size_t received = offset, recent_read = 0;
+    int retries = 0;
+    OtaBlock* block = nullptr;
+    bool success = true;
+    // 每块填充的字节数，按扇区对齐以便断点续传；网速越快块越大，减少写任务的切换
+    size_t fill_target = OTA_BUFFER_MIN_SIZE;
+    size_t block_target = 0;
+    int64_t first_byte_time = 0;
+    auto last_calc_time = esp_timer_get_time();
+    while (received < image_size_) {
+        if (block == nullptr) {
+            block = writer.AcquireBlock();
+            block->offset = received;
+            block->len = 0;
+            block_target = std::min(fill_target, block->capacity);
+        }
+        if (writer.failed()) {
+            success = false;
+            break;
+        }
+
+        size_t to_read = std::min(block_target - block->len, image_size_ - received);
+        int ret = http ? http->Read((char*)block->data + block->len, to_read) : -1;
+        if (ret <= 0) {
+            // 连接中断，从已接收的位置重新请求
+            if (http) {
+                ESP_LOGW(TAG, "Connection lost at %u/%u: %s", received, image_size_, ret < 0 ? esp_err_to_name(ret) : "EOF");
+                http->Close();
+                http.reset();
+            }
+            if (++retries > OTA_MAX_RETRIES) {
+                ESP_LOGE(TAG, "Too many retries, giving up");
+                success = false;
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(1000 << (retries - 1)));
+            size_t expected_size = image_size_;
+            http = OpenAt(received);
+            if (http && image_size_ != expected_size) {
+                ESP_LOGE(TAG, "Firmware size changed during download");
+                success = false;
+                break;
+            }
+            continue;
+        }
+        retries = 0;
+        if (first_byte_time == 0) {
+            first_byte_time = esp_timer_get_time();
+            stats_.first_byte_us = first_byte_time - start_time;
+        }
+
+        block->len += ret;
+        received += ret;
+        recent_read += ret;
+
+        // Calculate speed and progress every second
+        if (esp_timer_get_time() - last_calc_time >= 1000000 || received == image_size_) {
+            size_t progress = received * 100 / image_size_;
+            ESP_LOGI(TAG, "Progress: %u%% (%u/%u), Speed: %uB/s", progress, received, image_size_, recent_read);
+            if (progress_callback_) {
+                progress_callback_(progress, recent_read);
+            }
+            size_t target = (size_t)((uint64_t)recent_read * OTA_FILL_TIME_MS / 1000) & ~(SPI_FLASH_SEC_SIZE - 1);
+            fill_target = std::min(std::max(target, (size_t)OTA_BUFFER_MIN_SIZE), writer.block_capacity());
+            last_calc_time = esp_timer_get_time();
+            recent_read = 0;
+        }
+
+        if (block->len < block_target && received < image_size_) {
+            continue;
+        }
+
+        if (block->offset == 0) {
+            if (block->len < sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t)) {
+                ESP_LOGE(TAG, "Firmware image is too small");
+                success = false;
+                break;
+            }
+            esp_app_desc_t new_app_info;
+            memcpy(&new_app_info, block->data + sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t), sizeof(esp_app_desc_t));
+            ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
+
+            auto current_version = esp_app_get_description()->version;
+            if (memcmp(new_app_info.version, current_version, sizeof(new_app_info.version)) == 0) {
+                ESP_LOGE(TAG, "Firmware version is the same, skipping upgrade");
+                ClearResumeState();
+                success = false;
+                break;
+            }
+        }
+        writer.Submit(block);
+        block = nullptr;
+    }
+    if (http) {
+        http->Close();
+    }
+
+    bool written = writer.Finish(sha256);
+    auto end_time = esp_timer_get_time();
+    if (first_byte_time > 0 && end_time > first_byte_time) {
+        stats_.steady_rate = (uint64_t)(received - offset) * 1000000 / (end_time - first_byte_time);
+    }
+    stats_.flash_wait_us = writer.flash_wait_us();
+    stats_.flash_write_us = writer.flash_write_us();
+    stats_.block_size = fill_target;
+    ESP_LOGI(TAG, "OTA timing: connect %lldms, first byte %lldms, steady %uB/s, flash wait %lldms, flash write %lldms, block %u",
+        stats_.connect_us / 1000, stats_.first_byte_us / 1000, stats_.steady_rate,
+        stats_.flash_wait_us / 1000, stats_.flash_write_us / 1000, stats_.block_size);
+    return written && success;
+}
@@ -0,0 +1,111 @@
+#ifndef _OTA_DOWNLOAD_H
+#define _OTA_DOWNLOAD_H
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <esp_partition.h>
+#include <mbedtls/sha256.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <http.h>
+#include <network_interface.h>
+
+// 有 PSRAM 时使用大缓冲区，按实测网速决定每块实际填充多少再交给写 flash 的任务
+#define OTA_BUFFER_SIZE (64 * 1024)
+#define OTA_BUFFER_MIN_SIZE (16 * 1024)
+#define OTA_BUFFER_SECTOR_SIZE (4 * 1024)   // Smallest fallback without PSRAM
+#define OTA_BUFFER_COUNT 3
+#define OTA_FILL_TIME_MS 250
+#define OTA_MAX_RETRIES 5
+#define OTA_RESUME_SAVE_INTERVAL (64 * 1024)
+
+// 最近一次升级各阶段的耗时，用于分析升级慢在网络还是 flash
+struct OtaUpgradeStats {
+    int64_t connect_us;
+    int64_t first_byte_us;
+    size_t steady_rate;
+    int64_t flash_wait_us;
+    int64_t flash_write_us;
+    size_t block_size;
+};
+
+struct OtaBlock {
+    uint8_t* data;
+    size_t capacity;
+    size_t len;
+    size_t offset;
+};
+
+/*
+ * 后台写 flash 的任务：网络接收与 flash 擦写通过双缓冲并行进行，
+ * 同时在写入时计算 SHA-256，并定期把已写入的位置保存到 NVS 以便断点续传
+ */
+class OtaWriter {
+public:
+    OtaWriter(const esp_partition_t* partition, size_t offset, bool save_progress = true);
+    ~OtaWriter();
+
+    bool Start();
+    // Blocks until a buffer is free, the waiting time means the flash is slower than the network
+    OtaBlock* AcquireBlock();
+    void Submit(OtaBlock* block);
+    // Wait for all submitted blocks to be written, and get the image hash
+    bool Finish(uint8_t sha256[32]);
+
+    bool failed() const { return failed_; }
+    size_t written() const { return written_; }
+    size_t block_capacity() const { return blocks_[0].capacity; }
+    int64_t flash_wait_us() const { return flash_wait_us_; }
+    int64_t flash_write_us() const { return flash_write_us_; }
+
+private:
+    const esp_partition_t* partition_;
+    OtaBlock blocks_[OTA_BUFFER_COUNT] = {};
+    QueueHandle_t free_blocks_ = nullptr;
+    QueueHandle_t filled_blocks_ = nullptr;
+    SemaphoreHandle_t done_ = nullptr;
+    TaskHandle_t task_ = nullptr;
+    mbedtls_sha256_context sha256_;
+    size_t erased_until_;
+    volatile size_t written_;
+    size_t last_saved_;
+    bool save_progress_;
+    volatile bool failed_ = false;
+    int64_t flash_wait_us_ = 0;
+    int64_t flash_write_us_ = 0;
+
+    void WriterTask();
+    bool WriteBlock(const OtaBlock& block);
+};
+
+/*
+ * 完整固件镜像的下载：数据直接写入更新分区，连接中断后用 Range 请求从已接收的位置继续，
+ * 重启后从 NVS 中保存的位置续传
+ */
+class OtaDownloader {
+public:
+    OtaDownloader(NetworkInterface* network, const esp_partition_t* partition, const std::string& url);
+
+    void OnProgress(std::function<void(int progress, size_t speed)> callback) { progress_callback_ = callback; }
+    // 成功时给出整个镜像（包括续传前已写入的部分）的 SHA-256
+    bool Download(uint8_t sha256[32]);
+    const OtaUpgradeStats& stats() const { return stats_; }
+
+    static void ClearResumeState();
+
+private:
+    NetworkInterface* network_;
+    const esp_partition_t* partition_;
+    std::string url_;
+    size_t image_size_ = 0;
+    OtaUpgradeStats stats_ = {};
+    std::function<void(int progress, size_t speed)> progress_callback_;
+
+    std::unique_ptr<Http> OpenAt(size_t position);
+};
+
+#endif // _OTA_DOWNLOAD_H
@@ -0,0 +1,272 @@
+#include "profiler.h"
+#include "application.h"
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <cJSON.h>
+
+#include <cstring>
+#include <algorithm>
+
+#define TAG "Profiler"
+
+Profiler::Profiler() {
+}
+
+Profiler::~Profiler() {
+    if (timer_ != nullptr) {
+        esp_timer_stop(timer_);
+        esp_timer_delete(timer_);
+    }
+    free(task_status_);
+}
+
+void Profiler::Start() {
+    if (timer_ != nullptr) {
+        return;
+    }
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+    task_status_ = (TaskStatus_t*)malloc(sizeof(TaskStatus_t) * PROFILER_MAX_TASKS);
+    if (task_status_ == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate task status buffer");
+        return;
+    }
+#else
+    ESP_LOGW(TAG, "CONFIG_FREERTOS_USE_TRACE_FACILITY is disabled, only heap and audio are sampled");
+#endif
+
+    esp_timer_create_args_t timer_args = {
+        .callback = [](void* arg) {
+            auto profiler = (Profiler*)arg;
+            profiler->Sample();
+        },
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "profiler",
+        .skip_unhandled_events = true,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &timer_));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(timer_, PROFILER_SAMPLE_INTERVAL_MS * 1000));
+}
+
+void Profiler::Sample() {
+    auto start_time = esp_timer_get_time();
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Tasks, uxTaskGetSystemState() only exists with the trace facility enabled
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+    configRUN_TIME_COUNTER_TYPE total_run_time = 0;
+    UBaseType_t count = 0;
+    if (uxTaskGetNumberOfTasks() <= PROFILER_MAX_TASKS) {
+        count = uxTaskGetSystemState(task_status_, PROFILER_MAX_TASKS, &total_run_time);
+    }
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    configRUN_TIME_COUNTER_TYPE elapsed = (total_run_time - last_total_run_time_) * CONFIG_FREERTOS_NUMBER_OF_CORES;
+    bool has_cpu = last_total_run_time_ != 0 && elapsed > 0;
+    last_total_run_time_ = total_run_time;
+#endif
+
+    for (int i = 0; i < task_count_; i++) {
+        tasks_[i].alive = false;
+    }
+    for (UBaseType_t i = 0; i < count; i++) {
+        auto& status = task_status_[i];
+        ProfilerTaskStats* stats = nullptr;
+        for (int j = 0; j < task_count_; j++) {
+            if (tasks_[j].handle == status.xHandle) {
+                stats = &tasks_[j];
+                break;
+            }
+        }
+        [[maybe_unused]] bool is_new = stats == nullptr;
+        if (is_new) {
+            // Reuse the slot of a task that has been deleted
+            for (int j = 0; j < task_count_ && stats == nullptr; j++) {
+                if (tasks_[j].handle == nullptr) {
+                    stats = &tasks_[j];
+                }
+            }
+            if (stats == nullptr) {
+                if (task_count_ >= PROFILER_MAX_TASKS) {
+                    continue;
+                }
+                stats = &tasks_[task_count_++];
+            }
+            memset(stats, 0, sizeof(*stats));
+            strncpy(stats->name, status.pcTaskName, sizeof(stats->name) - 1);
+            stats->handle = status.xHandle;
+            stats->min_free_stack = UINT32_MAX;
+        }
+        stats->alive = true;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        if (has_cpu && !is_new) {
+            configRUN_TIME_COUNTER_TYPE task_elapsed = status.ulRunTimeCounter - stats->last_run_time;
+            stats->cpu_percent = std::min<uint64_t>(100, (uint64_t)task_elapsed * 100 / elapsed);
+            stats->max_cpu_percent = std::max(stats->max_cpu_percent, stats->cpu_percent);
+        }
+        stats->last_run_time = status.ulRunTimeCounter;
+#endif
+        // The stack is measured in bytes on ESP-IDF
+        stats->min_free_stack = std::min<uint32_t>(stats->min_free_stack, status.usStackHighWaterMark);
+    }
+    for (int i = 0; i < task_count_; i++) {
+        if (!tasks_[i].alive) {
+            tasks_[i].handle = nullptr;
+        }
+    }
+#endif
+
+    // Heap and audio
+    auto& sample = history_[history_head_];
+    sample.time_us = start_time;
+    sample.free_internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    sample.min_free_internal = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    sample.free_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    sample.min_free_psram = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+    auto audio = Application::GetInstance().GetAudioService().GetDebugStatistics();
+    sample.audio.input_count = audio.input_count - last_audio_.input_count;
+    sample.audio.decode_count = audio.decode_count - last_audio_.decode_count;
+    sample.audio.encode_count = audio.encode_count - last_audio_.encode_count;
+    sample.audio.playback_count = audio.playback_count - last_audio_.playback_count;
+    last_audio_ = audio;
+    history_head_ = (history_head_ + 1) % PROFILER_HISTORY_SIZE;
+    history_count_ = std::min(history_count_ + 1, PROFILER_HISTORY_SIZE);
+
+    sample_cost_us_ = esp_timer_get_time() - start_time;
+
+#if CONFIG_PROFILER_LOG_SUMMARY
+    if (++samples_since_summary_ >= CONFIG_PROFILER_LOG_SUMMARY_SAMPLES) {
+        samples_since_summary_ = 0;
+        LogSummary();
+    }
+#endif
+}
+
+// 汇总环形缓冲中的采样，只打印几行，避免刷屏
+void Profiler::LogSummary() {
+    uint32_t min_free_internal = UINT32_MAX, min_free_psram = UINT32_MAX;
+    DebugStatistics audio = {};
+    for (int i = 0; i < history_count_; i++) {
+        auto& sample = history_[(history_head_ - history_count_ + i + PROFILER_HISTORY_SIZE) % PROFILER_HISTORY_SIZE];
+        min_free_internal = std::min(min_free_internal, sample.free_internal);
+        min_free_psram = std::min(min_free_psram, sample.free_psram);
+        audio.input_count += sample.audio.input_count;
+        audio.decode_count += sample.audio.decode_count;
+        audio.encode_count += sample.audio.encode_count;
+        audio.playback_count += sample.audio.playback_count;
+    }
+    ESP_LOGI(TAG, "Last %d s: free internal >= %lu, free psram >= %lu, audio in %lu enc %lu dec %lu play %lu, sample cost %lld us",
+        history_count_ * PROFILER_SAMPLE_INTERVAL_MS / 1000, min_free_internal, min_free_psram,
+        audio.input_count, audio.encode_count, audio.decode_count, audio.playback_count, sample_cost_us_);
+
+    const ProfilerTaskStats* busiest = nullptr;
+    const ProfilerTaskStats* lowest_stack = nullptr;
+    for (int i = 0; i < task_count_; i++) {
+        auto& task = tasks_[i];
+        if (task.handle == nullptr) {
+            continue;
+        }
+        if (busiest == nullptr || task.cpu_percent > busiest->cpu_percent) {
+            busiest = &task;
+        }
+        if (lowest_stack == nullptr || task.min_free_stack < lowest_stack->min_free_stack) {
+            lowest_stack = &task;
+        }
+    }
+    if (busiest != nullptr) {
+        ESP_LOGI(TAG, "Busiest task %s %u%% (max %u%%), lowest stack %s %lu bytes", busiest->name,
+            busiest->cpu_percent, busiest->max_cpu_percent, lowest_stack->name, lowest_stack->min_free_stack);
+    }
+}
+
+std::string Profiler::GetJson() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddNumberToObject(root, "uptime_s", esp_timer_get_time() / 1000000);
+    cJSON_AddNumberToObject(root, "interval_ms", PROFILER_SAMPLE_INTERVAL_MS);
+    cJSON_AddNumberToObject(root, "sample_cost_us", sample_cost_us_);
+
+    // Tasks sorted by the CPU usage of the last interval
+    std::vector<const ProfilerTaskStats*> tasks;
+    for (int i = 0; i < task_count_; i++) {
+        if (tasks_[i].handle != nullptr) {
+            tasks.push_back(&tasks_[i]);
+        }
+    }
+    std::sort(tasks.begin(), tasks.end(), [](auto a, auto b) { return a->cpu_percent > b->cpu_percent; });
+    cJSON* task_array = cJSON_CreateArray();
+    for (auto task : tasks) {
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", task->name);
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        cJSON_AddNumberToObject(item, "cpu", task->cpu_percent);
+        cJSON_AddNumberToObject(item, "max_cpu", task->max_cpu_percent);
+#endif
+        cJSON_AddNumberToObject(item, "min_free_stack", task->min_free_stack);
+        cJSON_AddItemToArray(task_array, item);
+    }
+    cJSON_AddItemToObject(root, "tasks", task_array);
+
+    // Oldest sample first
+    cJSON* history = cJSON_CreateArray();
+    for (int i = 0; i < history_count_; i++) {
+        auto& sample = history_[(history_head_ - history_count_ + i + PROFILER_HISTORY_SIZE) % PROFILER_HISTORY_SIZE];
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "time_s", sample.time_us / 1000000);
+        cJSON_AddNumberToObject(item, "free_internal", sample.free_internal);
+        cJSON_AddNumberToObject(item, "min_free_internal", sample.min_free_internal);
+        cJSON_AddNumberToObject(item, "free_psram", sample.free_psram);
+        cJSON_AddNumberToObject(item, "min_free_psram", sample.min_free_psram);
+        cJSON_AddNumberToObject(item, "audio_input", sample.audio.input_count);
+        cJSON_AddNumberToObject(item, "audio_decode", sample.audio.decode_count);
+        cJSON_AddNumberToObject(item, "audio_encode", sample.audio.encode_count);
+        cJSON_AddNumberToObject(item, "audio_playback", sample.audio.playback_count);
+        cJSON_AddItemToArray(history, item);
+    }
+    cJSON_AddItemToObject(root, "history", history);
+
+    auto json_str = cJSON_PrintUnformatted(root);
+    std::string result(json_str);
+    cJSON_free(json_str);
+    cJSON_Delete(root);
+    return result;
+}
+
+std::vector<uint8_t> Profiler::GetTelemetryFrame() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (history_count_ == 0) {
+        return {};
+    }
+
+    std::vector<const ProfilerTaskStats*> tasks;
+    for (int i = 0; i < task_count_; i++) {
+        if (tasks_[i].handle != nullptr) {
+            tasks.push_back(&tasks_[i]);
+        }
+    }
+    size_t task_count = std::min(tasks.size(), (size_t)PROFILER_TELEMETRY_TASKS);
+    std::partial_sort(tasks.begin(), tasks.begin() + task_count, tasks.end(),
+        [](auto a, auto b) { return a->cpu_percent > b->cpu_percent; });
+
+    std::vector<uint8_t> frame(sizeof(ProfilerTelemetry) + task_count * sizeof(ProfilerTelemetryTask));
+    auto telemetry = (ProfilerTelemetry*)frame.data();
+    auto& sample = history_[(history_head_ - 1 + PROFILER_HISTORY_SIZE) % PROFILER_HISTORY_SIZE];
+    telemetry->version = 1;
+    telemetry->task_count = task_count;
+    telemetry->uptime_ms = sample.time_us / 1000;
+    telemetry->free_internal = sample.free_internal;
+    telemetry->min_free_internal = sample.min_free_internal;
+    telemetry->free_psram = sample.free_psram;
+    telemetry->min_free_psram = sample.min_free_psram;
+    telemetry->audio_input = sample.audio.input_count;
+    telemetry->audio_decode = sample.audio.decode_count;
+    telemetry->audio_encode = sample.audio.encode_count;
+    telemetry->audio_playback = sample.audio.playback_count;
+    for (size_t i = 0; i < task_count; i++) {
+        auto& item = telemetry->tasks[i];
+        strncpy(item.name, tasks[i]->name, sizeof(item.name));
+        item.cpu_percent = tasks[i]->cpu_percent;
+        item.min_free_stack = std::min<uint32_t>(tasks[i]->min_free_stack, UINT16_MAX);
+    }
+    return frame;
+}
@@ -0,0 +1,101 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+
+#include "audio_service.h"
+
+#define PROFILER_SAMPLE_INTERVAL_MS 5000
+#define PROFILER_MAX_TASKS 40
+#define PROFILER_HISTORY_SIZE 12
+#define PROFILER_TELEMETRY_TASKS 8
+
+struct ProfilerTaskStats {
+    char name[configMAX_TASK_NAME_LEN];
+    TaskHandle_t handle;
+    configRUN_TIME_COUNTER_TYPE last_run_time;
+    uint8_t cpu_percent;        // 最近一个采样周期
+    uint8_t max_cpu_percent;
+    uint32_t min_free_stack;    // 栈剩余的最小值（字节）
+    bool alive;
+};
+
+// 每个采样周期的系统状态，音频计数为该周期内的增量
+struct ProfilerSample {
+    int64_t time_us;
+    uint32_t free_internal;
+    uint32_t min_free_internal;
+    uint32_t free_psram;
+    uint32_t min_free_psram;
+    DebugStatistics audio;
+};
+
+// 通过协议通道发送的紧凑遥测帧（小端）
+struct ProfilerTelemetryTask {
+    char name[12];
+    uint8_t cpu_percent;
+    uint8_t reserved;
+    uint16_t min_free_stack;
+} __attribute__((packed));
+
+struct ProfilerTelemetry {
+    uint8_t version;
+    uint8_t task_count;
+    uint16_t reserved;
+    uint32_t uptime_ms;
+    uint32_t free_internal;
+    uint32_t min_free_internal;
+    uint32_t free_psram;
+    uint32_t min_free_psram;
+    uint32_t audio_input;
+    uint32_t audio_decode;
+    uint32_t audio_encode;
+    uint32_t audio_playback;
+    ProfilerTelemetryTask tasks[];
+} __attribute__((packed));
+
+/*
+ * 周期采样各任务的 CPU 占用、栈剩余和堆的最小值，保存在固定大小的环形缓冲中，
+ * 用于在没有串口的情况下排查卡顿
+ */
+class Profiler {
+public:
+    static Profiler& GetInstance() {
+        static Profiler instance;
+        return instance;
+    }
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void Start();
+    std::string GetJson();
+    std::vector<uint8_t> GetTelemetryFrame();
+
+private:
+    Profiler();
+    ~Profiler();
+
+    void Sample();
+    void LogSummary();
+
+    std::mutex mutex_;
+    esp_timer_handle_t timer_ = nullptr;
+    TaskStatus_t* task_status_ = nullptr;
+    ProfilerTaskStats tasks_[PROFILER_MAX_TASKS] = {};
+    int task_count_ = 0;
+    configRUN_TIME_COUNTER_TYPE last_total_run_time_ = 0;
+    ProfilerSample history_[PROFILER_HISTORY_SIZE] = {};
+    int history_head_ = 0;
+    int history_count_ = 0;
+    DebugStatistics last_audio_ = {};
+    int64_t sample_cost_us_ = 0;
+    int samples_since_summary_ = 0;
+};
+
+#endif // _PROFILER_H_
@@ -8,6 +8,10 @@ void Protocol::OnIncomingJson(std::function<void(const cJSON* root)> callback) {
     on_incoming_json_ = callback;
 }
 
+void Protocol::OnIncomingMcp(std::function<void(const std::string& payload)> callback) {
+    on_incoming_mcp_ = callback;
+}
+
 void Protocol::OnIncomingAudio(std::function<void(std::unique_ptr<AudioStreamPacket> packet)> callback) {
     on_incoming_audio_ = callback;
 }
@@ -11,13 +11,25 @@ struct AudioStreamPacket {
     int sample_rate = 0;
     int frame_duration = 0;
     uint32_t timestamp = 0;
+    uint32_t trace_id = 0;      // 本地音频链路追踪的帧 id，不会发送
     std::vector<uint8_t> payload;
 };
 
+// 二进制帧的消息类型，MCP 类型需要在 hello 中协商 mcp_binary 特性
+enum BinaryMessageType {
+    kBinaryMessageTypeAudio = 0,
+    kBinaryMessageTypeJson = 1,
+    kBinaryMessageTypeMcp = 2,
+    kBinaryMessageTypeTelemetry = 3,
+};
+
+// 大的 MCP 消息拆成多帧发送，除最后一帧外都在 reserved 中置该标志
+#define BINARY_FLAG_MORE_FRAGMENTS 0x01
+
 struct BinaryProtocol2 {
     uint16_t version;
-    uint16_t type;          // Message type (0: OPUS, 1: JSON)
-    uint32_t reserved;      // Reserved for future use
+    uint16_t type;          // Message type (0: OPUS, 1: JSON, 2: MCP)
+    uint32_t reserved;      // Flags, see BINARY_FLAG_MORE_FRAGMENTS
     uint32_t timestamp;     // Timestamp in milliseconds (used for server-side AEC)
     uint32_t payload_size;  // Payload size in bytes
     uint8_t payload[];      // Payload data
@@ -25,7 +37,7 @@ struct BinaryProtocol2 {
 
 struct BinaryProtocol3 {
     uint8_t type;
-    uint8_t reserved;
+    uint8_t reserved;       // Flags, see BINARY_FLAG_MORE_FRAGMENTS
     uint16_t payload_size;
     uint8_t payload[];
 } __attribute__((packed));
@@ -57,6 +69,7 @@ public:
 
     void OnIncomingAudio(std::function<void(std::unique_ptr<AudioStreamPacket> packet)> callback);
     void OnIncomingJson(std::function<void(const cJSON* root)> callback);
+    void OnIncomingMcp(std::function<void(const std::string& payload)> callback);
     void OnAudioChannelOpened(std::function<void()> callback);
     void OnAudioChannelClosed(std::function<void()> callback);
     void OnNetworkError(std::function<void(const std::string& message)> callback);
@@ -71,9 +84,12 @@ public:
     virtual void SendStopListening();
     virtual void SendAbortSpeaking(AbortReason reason);
     virtual void SendMcpMessage(const std::string& message);
+    // Only supported by transports with binary frames
+    virtual bool SendTelemetry(const std::vector<uint8_t>& data) { return false; }
 
 protected:
     std::function<void(const cJSON* root)> on_incoming_json_;
+    std::function<void(const std::string& payload)> on_incoming_mcp_;
     std::function<void(std::unique_ptr<AudioStreamPacket> packet)> on_incoming_audio_;
     std::function<void()> on_audio_channel_opened_;
     std::function<void()> on_audio_channel_closed_;
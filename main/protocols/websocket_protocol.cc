@@ -5,6 +5,7 @@
 #include "settings.h"
 
 #include <cstring>
+#include <algorithm>
 #include <cJSON.h>
 #include <esp_log.h>
 #include <arpa/inet.h>
@@ -57,6 +58,79 @@ bool WebsocketProtocol::SendAudio(std::unique_ptr<AudioStreamPacket> packet) {
     }
 }
 
+// 按协商的协议版本打包二进制帧，版本 1 没有帧头
+bool WebsocketProtocol::SendBinary(BinaryMessageType type, uint32_t flags, uint32_t timestamp, const uint8_t* payload, size_t size) {
+    if (websocket_ == nullptr || !websocket_->IsConnected()) {
+        return false;
+    }
+
+    std::string serialized;
+    if (version_ == 2) {
+        serialized.resize(sizeof(BinaryProtocol2) + size);
+        auto bp2 = (BinaryProtocol2*)serialized.data();
+        bp2->version = htons(version_);
+        bp2->type = htons(type);
+        bp2->reserved = htonl(flags);
+        bp2->timestamp = htonl(timestamp);
+        bp2->payload_size = htonl(size);
+        memcpy(bp2->payload, payload, size);
+    } else if (version_ == 3) {
+        serialized.resize(sizeof(BinaryProtocol3) + size);
+        auto bp3 = (BinaryProtocol3*)serialized.data();
+        bp3->type = type;
+        bp3->reserved = flags;
+        bp3->payload_size = htons(size);
+        memcpy(bp3->payload, payload, size);
+    } else {
+        return websocket_->Send(payload, size, true);
+    }
+    return websocket_->Send(serialized.data(), serialized.size(), true);
+}
+
+void WebsocketProtocol::SendMcpMessage(const std::string& payload) {
+    if (!mcp_binary_ || (version_ != 2 && version_ != 3)) {
+        Protocol::SendMcpMessage(payload);
+        return;
+    }
+
+    // JSON-RPC 原文直接放在二进制帧中，不再作为字符串转义一次
+    auto data = (const uint8_t*)payload.data();
+    size_t offset = 0;
+    do {
+        size_t size = std::min(payload.size() - offset, (size_t)WEBSOCKET_MCP_FRAGMENT_SIZE);
+        uint32_t flags = offset + size < payload.size() ? BINARY_FLAG_MORE_FRAGMENTS : 0;
+        if (!SendBinary(kBinaryMessageTypeMcp, flags, 0, data + offset, size)) {
+            ESP_LOGE(TAG, "Failed to send MCP message");
+            return;
+        }
+        offset += size;
+    } while (offset < payload.size());
+}
+
+bool WebsocketProtocol::SendTelemetry(const std::vector<uint8_t>& data) {
+    // 只有服务器在 hello 中同意后才发送，避免不认识的服务器把遥测帧当成音频
+    if (!telemetry_ || (version_ != 2 && version_ != 3)) {
+        return false;
+    }
+    return SendBinary(kBinaryMessageTypeTelemetry, 0, 0, data.data(), data.size());
+}
+
+void WebsocketProtocol::ParseBinaryMcp(const uint8_t* payload, size_t size, bool more_fragments) {
+    if (incoming_mcp_.size() + size > WEBSOCKET_MCP_MAX_MESSAGE_SIZE) {
+        ESP_LOGE(TAG, "MCP message is too large, dropped");
+        incoming_mcp_.clear();
+        return;
+    }
+    incoming_mcp_.append((const char*)payload, size);
+    if (more_fragments) {
+        return;
+    }
+    if (on_incoming_mcp_ != nullptr) {
+        on_incoming_mcp_(incoming_mcp_);
+    }
+    incoming_mcp_.clear();
+}
+
 bool WebsocketProtocol::SendText(const std::string& text) {
     if (websocket_ == nullptr || !websocket_->IsConnected()) {
         return false;
@@ -89,6 +163,9 @@ bool WebsocketProtocol::OpenAudioChannel() {
     }
 
     error_occurred_ = false;
+    mcp_binary_ = false;
+    telemetry_ = false;
+    incoming_mcp_.clear();
 
     auto network = Board::GetInstance().GetNetwork();
     websocket_ = network->CreateWebSocket(1);
@@ -110,7 +187,15 @@ bool WebsocketProtocol::OpenAudioChannel() {
 
     websocket_->OnData([this](const char* data, size_t len, bool binary) {
         if (binary) {
-            if (on_incoming_audio_ != nullptr) {
+            if (version_ == 2 && len >= sizeof(BinaryProtocol2) && ntohs(((BinaryProtocol2*)data)->type) == kBinaryMessageTypeMcp) {
+                auto bp2 = (BinaryProtocol2*)data;
+                size_t size = std::min((size_t)ntohl(bp2->payload_size), len - sizeof(BinaryProtocol2));
+                ParseBinaryMcp(bp2->payload, size, ntohl(bp2->reserved) & BINARY_FLAG_MORE_FRAGMENTS);
+            } else if (version_ == 3 && len >= sizeof(BinaryProtocol3) && ((BinaryProtocol3*)data)->type == kBinaryMessageTypeMcp) {
+                auto bp3 = (BinaryProtocol3*)data;
+                size_t size = std::min((size_t)ntohs(bp3->payload_size), len - sizeof(BinaryProtocol3));
+                ParseBinaryMcp(bp3->payload, size, bp3->reserved & BINARY_FLAG_MORE_FRAGMENTS);
+            } else if (on_incoming_audio_ != nullptr) {
                 if (version_ == 2) {
                     BinaryProtocol2* bp2 = (BinaryProtocol2*)data;
                     bp2->version = ntohs(bp2->version);
@@ -209,6 +294,12 @@ std::string WebsocketProtocol::GetHelloMessage() {
     cJSON_AddBoolToObject(features, "aec", true);
 #endif
     cJSON_AddBoolToObject(features, "mcp", true);
+    if (version_ == 2 || version_ == 3) {
+        cJSON_AddBoolToObject(features, "mcp_binary", true);
+#if CONFIG_SEND_PROFILER_TELEMETRY
+        cJSON_AddBoolToObject(features, "telemetry", true);
+#endif
+    }
     cJSON_AddItemToObject(root, "features", features);
     cJSON_AddStringToObject(root, "transport", "websocket");
     cJSON* audio_params = cJSON_CreateObject();
@@ -237,6 +328,19 @@ void WebsocketProtocol::ParseServerHello(const cJSON* root) {
         ESP_LOGI(TAG, "Session ID: %s", session_id_.c_str());
     }
 
+    // 服务器同意后 MCP 消息改用二进制帧，否则仍然使用文本
+    auto features = cJSON_GetObjectItem(root, "features");
+    if (cJSON_IsObject(features)) {
+        mcp_binary_ = cJSON_IsTrue(cJSON_GetObjectItem(features, "mcp_binary"));
+        if (mcp_binary_) {
+            ESP_LOGI(TAG, "MCP binary frames enabled");
+        }
+        telemetry_ = cJSON_IsTrue(cJSON_GetObjectItem(features, "telemetry"));
+        if (telemetry_) {
+            ESP_LOGI(TAG, "Telemetry frames enabled");
+        }
+    }
+
     auto audio_params = cJSON_GetObjectItem(root, "audio_params");
     if (cJSON_IsObject(audio_params)) {
         auto sample_rate = cJSON_GetObjectItem(audio_params, "sample_rate");
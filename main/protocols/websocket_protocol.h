@@ -9,6 +9,8 @@
 #include <freertos/event_groups.h>
 
 #define WEBSOCKET_PROTOCOL_SERVER_HELLO_EVENT (1 << 0)
+#define WEBSOCKET_MCP_FRAGMENT_SIZE 8192
+#define WEBSOCKET_MCP_MAX_MESSAGE_SIZE (64 * 1024)
 
 class WebsocketProtocol : public Protocol {
 public:
@@ -20,13 +22,20 @@ public:
     bool OpenAudioChannel() override;
     void CloseAudioChannel() override;
     bool IsAudioChannelOpened() const override;
+    void SendMcpMessage(const std::string& payload) override;
+    bool SendTelemetry(const std::vector<uint8_t>& data) override;
 
 private:
     EventGroupHandle_t event_group_handle_;
     std::unique_ptr<WebSocket> websocket_;
     int version_ = 1;
+    bool mcp_binary_ = false;
+    bool telemetry_ = false;
+    std::string incoming_mcp_;
 
     void ParseServerHello(const cJSON* root);
+    void ParseBinaryMcp(const uint8_t* payload, size_t size, bool more_fragments);
+    bool SendBinary(BinaryMessageType type, uint32_t flags, uint32_t timestamp, const uint8_t* payload, size_t size);
     bool SendText(const std::string& text) override;
     std::string GetHelloMessage();
 };
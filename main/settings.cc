@@ -1,87 +1,388 @@
 #include "settings.h"
 
 #include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_system.h>
 #include <nvs_flash.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
 
 #define TAG "Settings"
 
+// 最后一次修改后等待多久提交，连续修改时最多推迟多久
+#define SETTINGS_COMMIT_DELAY_MS 1000
+#define SETTINGS_COMMIT_MAX_DELAY_MS 5000
+#define SETTINGS_COMMIT_TASK_STACK_SIZE 4096
+
+namespace {
+
+struct SettingsEntry {
+    bool is_string = false;
+    int32_t int_value = 0;
+    std::string str_value;
+    bool erased = false;
+    bool dirty = false;
+};
+
+struct SettingsNamespace {
+    std::map<std::string, SettingsEntry> entries;
+    bool erase_all = false;
+    bool dirty = false;
+};
+
+class SettingsCache {
+public:
+    static SettingsCache& GetInstance() {
+        static SettingsCache instance;
+        return instance;
+    }
+
+    std::mutex& mutex() { return mutex_; }
+
+    // Load the namespace from NVS on first use, the caller must hold the mutex
+    SettingsNamespace& Load(const std::string& ns) {
+        auto it = namespaces_.find(ns);
+        if (it != namespaces_.end()) {
+            return it->second;
+        }
+        auto& space = namespaces_[ns];
+
+        nvs_handle_t handle = 0;
+        if (nvs_open(ns.c_str(), NVS_READONLY, &handle) != ESP_OK) {
+            return space;
+        }
+        nvs_iterator_t iterator = nullptr;
+        esp_err_t err = nvs_entry_find(NVS_DEFAULT_PART_NAME, ns.c_str(), NVS_TYPE_ANY, &iterator);
+        while (err == ESP_OK) {
+            nvs_entry_info_t info;
+            nvs_entry_info(iterator, &info);
+            if (info.type == NVS_TYPE_I32) {
+                SettingsEntry entry;
+                if (nvs_get_i32(handle, info.key, &entry.int_value) == ESP_OK) {
+                    space.entries[info.key] = std::move(entry);
+                }
+            } else if (info.type == NVS_TYPE_STR) {
+                size_t length = 0;
+                if (nvs_get_str(handle, info.key, nullptr, &length) == ESP_OK) {
+                    SettingsEntry entry;
+                    entry.is_string = true;
+                    entry.str_value.resize(length);
+                    if (nvs_get_str(handle, info.key, entry.str_value.data(), &length) == ESP_OK) {
+                        while (!entry.str_value.empty() && entry.str_value.back() == '\0') {
+                            entry.str_value.pop_back();
+                        }
+                        space.entries[info.key] = std::move(entry);
+                    }
+                }
+            }
+            err = nvs_entry_next(&iterator);
+        }
+        nvs_release_iterator(iterator);
+        nvs_close(handle);
+        ESP_LOGD(TAG, "Loaded %u keys from namespace %s", space.entries.size(), ns.c_str());
+        return space;
+    }
+
+    // Restart the debounce timer, unless changes have been pending for too long
+    void ScheduleCommit() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto now = esp_timer_get_time();
+        if (esp_timer_is_active(commit_timer_)) {
+            if (now - first_pending_time_ >= SETTINGS_COMMIT_MAX_DELAY_MS * 1000LL) {
+                return;
+            }
+            esp_timer_stop(commit_timer_);
+        } else {
+            first_pending_time_ = now;
+        }
+        esp_timer_start_once(commit_timer_, SETTINGS_COMMIT_DELAY_MS * 1000);
+    }
+
+    void Flush() {
+        // 同一时间只允许一个提交，保证同一个键的多次修改按顺序写入
+        std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+
+        struct PendingNamespace {
+            std::string ns;
+            bool erase_all;
+            std::vector<std::pair<std::string, SettingsEntry>> entries;
+        };
+        std::vector<PendingNamespace> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            esp_timer_stop(commit_timer_);
+            for (auto& [ns, space] : namespaces_) {
+                if (!space.dirty) {
+                    continue;
+                }
+                PendingNamespace item{ns, space.erase_all, {}};
+                for (auto it = space.entries.begin(); it != space.entries.end();) {
+                    if (it->second.dirty) {
+                        item.entries.emplace_back(it->first, it->second);
+                        it->second.dirty = false;
+                    }
+                    if (it->second.erased) {
+                        it = space.entries.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+                space.erase_all = false;
+                space.dirty = false;
+                pending.push_back(std::move(item));
+            }
+        }
+
+        // 每个命名空间只打开一次并提交一次
+        size_t keys = 0;
+        for (auto& item : pending) {
+            nvs_handle_t handle = 0;
+            esp_err_t err = nvs_open(item.ns.c_str(), NVS_READWRITE, &handle);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to open namespace %s: %s", item.ns.c_str(), esp_err_to_name(err));
+                continue;
+            }
+            if (item.erase_all) {
+                err = nvs_erase_all(handle);
+                if (err != ESP_OK) {
+                    ESP_LOGE(TAG, "Failed to erase namespace %s: %s", item.ns.c_str(), esp_err_to_name(err));
+                }
+            }
+            for (auto& [key, entry] : item.entries) {
+                if (entry.erased) {
+                    err = nvs_erase_key(handle, key.c_str());
+                    if (err == ESP_ERR_NVS_NOT_FOUND) {
+                        err = ESP_OK;
+                    }
+                } else if (entry.is_string) {
+                    err = nvs_set_str(handle, key.c_str(), entry.str_value.c_str());
+                } else {
+                    err = nvs_set_i32(handle, key.c_str(), entry.int_value);
+                }
+                if (err != ESP_OK) {
+                    ESP_LOGE(TAG, "Failed to write %s.%s: %s", item.ns.c_str(), key.c_str(), esp_err_to_name(err));
+                }
+            }
+            err = nvs_commit(handle);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to commit namespace %s: %s", item.ns.c_str(), esp_err_to_name(err));
+            }
+            nvs_close(handle);
+            keys += item.entries.size();
+        }
+        if (!pending.empty()) {
+            ESP_LOGD(TAG, "Committed %u keys in %u namespaces", keys, pending.size());
+        }
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        esp_timer_stop(commit_timer_);
+        namespaces_.clear();
+    }
+
+    void AddCallback(const std::string& ns, std::function<void(const std::string& key)> callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callbacks_.emplace_back(ns, std::move(callback));
+    }
+
+    std::vector<std::function<void(const std::string& key)>> GetCallbacks(const std::string& ns) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::function<void(const std::string& key)>> result;
+        for (auto& [callback_ns, callback] : callbacks_) {
+            if (callback_ns == ns) {
+                result.push_back(callback);
+            }
+        }
+        return result;
+    }
+
+private:
+    std::mutex mutex_;
+    std::mutex flush_mutex_;
+    std::map<std::string, SettingsNamespace> namespaces_;
+    std::vector<std::pair<std::string, std::function<void(const std::string& key)>>> callbacks_;
+    esp_timer_handle_t commit_timer_ = nullptr;
+    TaskHandle_t commit_task_ = nullptr;
+    int64_t first_pending_time_ = 0;
+
+    SettingsCache() {
+        // NVS 提交可能要擦除扇区，放在低优先级任务里执行，不阻塞其他 esp_timer 回调
+        xTaskCreate([](void* arg) {
+            auto cache = (SettingsCache*)arg;
+            while (true) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                cache->Flush();
+            }
+        }, "settings_commit", SETTINGS_COMMIT_TASK_STACK_SIZE, this, 1, &commit_task_);
+
+        esp_timer_create_args_t timer_args = {
+            .callback = [](void* arg) {
+                auto cache = (SettingsCache*)arg;
+                if (cache->commit_task_ != nullptr) {
+                    xTaskNotifyGive(cache->commit_task_);
+                } else {
+                    cache->Flush();
+                }
+            },
+            .arg = this,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "settings_commit",
+            .skip_unhandled_events = true,
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &commit_timer_));
+        // 重启前提交尚未写入的修改，注册失败时重启前最后几秒的修改可能丢失
+        esp_err_t err = esp_register_shutdown_handler([]() {
+            SettingsCache::GetInstance().Flush();
+        });
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to register shutdown handler: %s, changes made right before a restart may be lost",
+                esp_err_to_name(err));
+        }
+    }
+};
+
+} // namespace
+
 Settings::Settings(const std::string& ns, bool read_write) : ns_(ns), read_write_(read_write) {
-    nvs_open(ns.c_str(), read_write_ ? NVS_READWRITE : NVS_READONLY, &nvs_handle_);
+    auto& cache = SettingsCache::GetInstance();
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    cache.Load(ns_);
 }
 
 Settings::~Settings() {
-    if (nvs_handle_ != 0) {
-        if (read_write_ && dirty_) {
-            ESP_ERROR_CHECK(nvs_commit(nvs_handle_));
-        }
-        nvs_close(nvs_handle_);
+    if (dirty_) {
+        SettingsCache::GetInstance().ScheduleCommit();
     }
 }
 
 std::string Settings::GetString(const std::string& key, const std::string& default_value) {
-    if (nvs_handle_ == 0) {
-        return default_value;
-    }
-
-    size_t length = 0;
-    if (nvs_get_str(nvs_handle_, key.c_str(), nullptr, &length) != ESP_OK) {
+    auto& cache = SettingsCache::GetInstance();
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    auto& space = cache.Load(ns_);
+    auto it = space.entries.find(key);
+    if (it == space.entries.end() || it->second.erased || !it->second.is_string) {
         return default_value;
     }
-
-    std::string value;
-    value.resize(length);
-    ESP_ERROR_CHECK(nvs_get_str(nvs_handle_, key.c_str(), value.data(), &length));
-    while (!value.empty() && value.back() == '\0') {
-        value.pop_back();
-    }
-    return value;
+    return it->second.str_value;
 }
 
 void Settings::SetString(const std::string& key, const std::string& value) {
-    if (read_write_) {
-        ESP_ERROR_CHECK(nvs_set_str(nvs_handle_, key.c_str(), value.c_str()));
-        dirty_ = true;
-    } else {
+    if (!read_write_) {
         ESP_LOGW(TAG, "Namespace %s is not open for writing", ns_.c_str());
+        return;
+    }
+    auto& cache = SettingsCache::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex());
+        auto& space = cache.Load(ns_);
+        auto it = space.entries.find(key);
+        if (it != space.entries.end() && !it->second.erased && it->second.is_string && it->second.str_value == value) {
+            return;
+        }
+        auto& entry = space.entries[key];
+        entry.is_string = true;
+        entry.str_value = value;
+        entry.erased = false;
+        entry.dirty = true;
+        space.dirty = true;
     }
+    dirty_ = true;
+    NotifyChange(key);
 }
 
 int32_t Settings::GetInt(const std::string& key, int32_t default_value) {
-    if (nvs_handle_ == 0) {
-        return default_value;
-    }
-
-    int32_t value;
-    if (nvs_get_i32(nvs_handle_, key.c_str(), &value) != ESP_OK) {
+    auto& cache = SettingsCache::GetInstance();
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    auto& space = cache.Load(ns_);
+    auto it = space.entries.find(key);
+    if (it == space.entries.end() || it->second.erased || it->second.is_string) {
         return default_value;
     }
-    return value;
+    return it->second.int_value;
 }
 
 void Settings::SetInt(const std::string& key, int32_t value) {
-    if (read_write_) {
-        ESP_ERROR_CHECK(nvs_set_i32(nvs_handle_, key.c_str(), value));
-        dirty_ = true;
-    } else {
+    if (!read_write_) {
         ESP_LOGW(TAG, "Namespace %s is not open for writing", ns_.c_str());
+        return;
     }
+    auto& cache = SettingsCache::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex());
+        auto& space = cache.Load(ns_);
+        auto it = space.entries.find(key);
+        if (it != space.entries.end() && !it->second.erased && !it->second.is_string && it->second.int_value == value) {
+            return;
+        }
+        auto& entry = space.entries[key];
+        entry.is_string = false;
+        entry.int_value = value;
+        entry.str_value.clear();
+        entry.erased = false;
+        entry.dirty = true;
+        space.dirty = true;
+    }
+    dirty_ = true;
+    NotifyChange(key);
 }
 
 void Settings::EraseKey(const std::string& key) {
-    if (read_write_) {
-        auto ret = nvs_erase_key(nvs_handle_, key.c_str());
-        if (ret != ESP_ERR_NVS_NOT_FOUND) {
-            ESP_ERROR_CHECK(ret);
-        }
-    } else {
+    if (!read_write_) {
         ESP_LOGW(TAG, "Namespace %s is not open for writing", ns_.c_str());
+        return;
+    }
+    auto& cache = SettingsCache::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex());
+        auto& space = cache.Load(ns_);
+        auto it = space.entries.find(key);
+        if (it == space.entries.end() || it->second.erased) {
+            return;
+        }
+        it->second.erased = true;
+        it->second.dirty = true;
+        space.dirty = true;
     }
+    dirty_ = true;
+    NotifyChange(key);
 }
 
 void Settings::EraseAll() {
-    if (read_write_) {
-        ESP_ERROR_CHECK(nvs_erase_all(nvs_handle_));
-    } else {
+    if (!read_write_) {
         ESP_LOGW(TAG, "Namespace %s is not open for writing", ns_.c_str());
+        return;
+    }
+    auto& cache = SettingsCache::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex());
+        auto& space = cache.Load(ns_);
+        space.entries.clear();
+        space.erase_all = true;
+        space.dirty = true;
+    }
+    dirty_ = true;
+    NotifyChange("");
+}
+
+void Settings::Flush() {
+    SettingsCache::GetInstance().Flush();
+}
+
+void Settings::Reset() {
+    SettingsCache::GetInstance().Reset();
+}
+
+void Settings::OnChange(const std::string& ns, std::function<void(const std::string& key)> callback) {
+    SettingsCache::GetInstance().AddCallback(ns, std::move(callback));
+}
+
+void Settings::NotifyChange(const std::string& key) {
+    for (auto& callback : SettingsCache::GetInstance().GetCallbacks(ns_)) {
+        callback(key);
     }
 }
@@ -2,8 +2,14 @@
 #define SETTINGS_H
 
 #include <string>
+#include <functional>
 #include <nvs_flash.h>
 
+/*
+ * 各命名空间第一次使用时从 NVS 整体读入内存，之后的读写都只访问内存。
+ * 修改在 Settings 析构后延迟批量提交到 NVS，重启前会自动提交，
+ * 深度睡眠和关机前需要调用 Flush()。
+ */
 class Settings {
 public:
     Settings(const std::string& ns, bool read_write = false);
@@ -16,11 +22,19 @@ public:
     void EraseKey(const std::string& key);
     void EraseAll();
 
+    // Write all pending changes to NVS now
+    static void Flush();
+    // Drop the cache and pending changes, call after erasing the NVS partition
+    static void Reset();
+    // Called after a value in the namespace changes, key is empty when the whole namespace is erased
+    static void OnChange(const std::string& ns, std::function<void(const std::string& key)> callback);
+
 private:
     std::string ns_;
-    nvs_handle_t nvs_handle_ = 0;
     bool read_write_ = false;
     bool dirty_ = false;
+
+    void NotifyChange(const std::string& key);
 };
 
 #endif
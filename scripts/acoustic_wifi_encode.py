@@ -0,0 +1,136 @@
+import argparse
+import math
+import random
+import struct
+import wave
+
+
+'''
+  Encode WiFi credentials for acoustic provisioning (CONFIG_USE_ACOUSTIC_WIFI_PROVISIONING)
+  and save them as a WAV file that can be played to the device.
+
+  Frame: preamble | sync word 0x2DD4 | FEC(version, length, CRC-8) | FEC(payload, CRC-16)
+  The payload is the SSID length, the SSID and the password. FEC is the K=7 rate 1/2
+  convolutional code (171, 133 octal) terminated with 6 zero bits.
+'''
+
+SYNC_WORD = 0x2DD4
+FRAME_VERSION = 1
+POLYNOMIAL_A = 0x79
+POLYNOMIAL_B = 0x5B
+
+MODES = {
+    # name: (mark Hz, space Hz, bits per second)
+    "normal": (1800, 1500, 100),
+    "fast": (1800, 1400, 200),
+}
+
+
+def crc8(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def to_bits(data):
+    return [(byte >> (7 - i)) & 1 for byte in data for i in range(8)]
+
+
+def convolutional_encode(data):
+    bits = to_bits(data) + [0] * 6
+    state = 0
+    coded = []
+    for bit in bits:
+        reg = (bit << 6) | state
+        coded.append(bin(reg & POLYNOMIAL_A).count("1") & 1)
+        coded.append(bin(reg & POLYNOMIAL_B).count("1") & 1)
+        state = reg >> 1
+    return coded
+
+
+def frame_bits(ssid, password):
+    ssid = ssid.encode("utf-8")
+    password = password.encode("utf-8")
+    if not 0 < len(ssid) <= 32 or len(password) > 64:
+        raise ValueError("SSID must be 1-32 bytes and password at most 64 bytes")
+    payload = bytes([len(ssid)]) + ssid + password
+    header = bytes([FRAME_VERSION, len(payload)])
+    header += bytes([crc8(header)])
+    crc = crc16(payload, crc16(header))
+    bits = [1, 0] * 16
+    bits += [(SYNC_WORD >> (15 - i)) & 1 for i in range(16)]
+    bits += convolutional_encode(header)
+    bits += convolutional_encode(payload + struct.pack(">H", crc))
+    return bits
+
+
+def legacy_bits(ssid, password):
+    # Unframed format understood by older firmware
+    text = (ssid + "\n" + password).encode("utf-8")
+    checksum = sum(text) & 0xFF
+    return to_bits(b"\x01\x02" + text + bytes([checksum]) + b"\x03\x04")
+
+
+def modulate(bits, mark, space, bit_rate, sample_rate, amplitude):
+    # Continuous phase FSK
+    samples = []
+    phase = 0.0
+    samples_per_bit = sample_rate / bit_rate
+    for index, bit in enumerate(bits):
+        frequency = mark if bit else space
+        for _ in range(round((index + 1) * samples_per_bit) - round(index * samples_per_bit)):
+            phase += 2 * math.pi * frequency / sample_rate
+            samples.append(amplitude * math.sin(phase))
+    return samples
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encode WiFi credentials as an AFSK WAV file")
+    parser.add_argument("ssid")
+    parser.add_argument("password")
+    parser.add_argument("-o", "--output", default="wifi_config.wav")
+    parser.add_argument("--mode", choices=list(MODES.keys()) + ["legacy"], default="normal")
+    parser.add_argument("--sample-rate", type=int, default=16000)
+    parser.add_argument("--repeat", type=int, default=3, help="Number of times the frame is sent")
+    parser.add_argument("--snr", type=float, help="Add white noise at this SNR in dB, for testing")
+    args = parser.parse_args()
+
+    if args.mode == "legacy":
+        mark, space, bit_rate = MODES["normal"]
+        bits = legacy_bits(args.ssid, args.password)
+    else:
+        mark, space, bit_rate = MODES[args.mode]
+        bits = frame_bits(args.ssid, args.password)
+
+    amplitude = 16000
+    gap = [0.0] * (args.sample_rate // 5)
+    samples = list(gap)
+    for _ in range(args.repeat):
+        samples += modulate(bits, mark, space, bit_rate, args.sample_rate, amplitude)
+        samples += gap
+
+    if args.snr is not None:
+        sigma = amplitude / math.sqrt(2) / (10 ** (args.snr / 20))
+        samples = [s + random.gauss(0, sigma) for s in samples]
+
+    with wave.open(args.output, "wb") as wav_file:
+        wav_file.setnchannels(1)
+        wav_file.setsampwidth(2)
+        wav_file.setframerate(args.sample_rate)
+        wav_file.writeframes(b"".join(struct.pack("<h", max(-32768, min(32767, int(s)))) for s in samples))
+    print(f"Saved {len(bits)} bits x {args.repeat} ({len(samples) / args.sample_rate:.1f} s) to {args.output}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,17 +1,83 @@
 import socket
 import wave
+import json
+import threading
 import argparse
 
 
 '''
-  Create a UDP socket and bind it to the server's IP:8000.
+  Create a UDP socket and bind it to the server's IP:port (default 8000).
   Listen for incoming messages and print them to the console.
   Save the audio to a WAV file.
+
+  Audio trace chunks are sent by the device to port + 1. Every datagram is a
+  JSON object {"export": N, "seq": S, "events": [...]}, the last chunk of an
+  export also has "last": true. The chunks of one export are reassembled and
+  saved as audio_trace_<N>.json, open it with chrome://tracing or Perfetto.
 '''
-def main(samplerate, channels):
+def save_trace(export_id, chunks, last_seq):
+    missing = [seq for seq in range(last_seq + 1) if seq not in chunks]
+    events = []
+    for seq in sorted(chunks):
+        events.extend(chunks[seq])
+    filename = f"audio_trace_{export_id}.json"
+    with open(filename, "w") as f:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, f)
+    if missing:
+        print(f"Trace {export_id}: missing chunks {missing}, saved {len(events)} events to {filename}")
+    else:
+        print(f"Trace {export_id}: saved {len(events)} events in {len(chunks)} chunks to {filename}")
+
+
+def receive_traces(port, stop_event):
+    trace_socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    trace_socket.bind(('0.0.0.0', port))
+    trace_socket.settimeout(1.0)
+    print(f"Receiving audio traces on 0.0.0.0:{port}...")
+
+    # export id -> {"chunks": {seq: events}, "last": seq of the last chunk or None}
+    exports = {}
+    try:
+        while not stop_event.is_set():
+            try:
+                message, address = trace_socket.recvfrom(65536)
+            except socket.timeout:
+                continue
+            try:
+                chunk = json.loads(message)
+                export_id = int(chunk["export"])
+                seq = int(chunk["seq"])
+                events = chunk["events"]
+            except (ValueError, KeyError, TypeError) as e:
+                print(f"Invalid trace chunk from {address}: {e}")
+                continue
+
+            # 设备重启后导出序号从 1 重新开始，收到更早序号的分块时丢弃未完成的旧数据
+            if export_id not in exports and any(known > export_id for known in exports):
+                exports.clear()
+            state = exports.setdefault(export_id, {"chunks": {}, "last": None})
+            state["chunks"][seq] = events
+            if chunk.get("last"):
+                state["last"] = seq
+            if state["last"] is not None and len(state["chunks"]) == state["last"] + 1:
+                save_trace(export_id, state["chunks"], state["last"])
+                del exports[export_id]
+    finally:
+        # 丢包导致不完整的导出也保存下来，并提示缺少的分块
+        for export_id, state in exports.items():
+            last_seq = state["last"] if state["last"] is not None else max(state["chunks"])
+            save_trace(export_id, state["chunks"], last_seq)
+        trace_socket.close()
+
+
+def main(samplerate, channels, port):
     # Create a UDP socket
     server_socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
-    server_socket.bind(('0.0.0.0', 8000))
+    server_socket.bind(('0.0.0.0', port))
+
+    stop_event = threading.Event()
+    trace_thread = threading.Thread(target=receive_traces, args=(port + 1, stop_event))
+    trace_thread.start()
 
     # Create WAV file with parameters
     filename = f"{samplerate}_{channels}.wav"
@@ -20,35 +86,39 @@ def main(samplerate, channels):
     wav_file.setsampwidth(2)            # 2 bytes per sample (16-bit)
     wav_file.setframerate(samplerate)   # samplerate parameter
 
-    print(f"Start saving audio from 0.0.0.0:8000 to {filename}...")
+    print(f"Start saving audio from 0.0.0.0:{port} to {filename}...")
 
     try:
         while True:
             # Receive a message from the client
             message, address = server_socket.recvfrom(8000)
-            
+
             # Write PCM data to WAV file
             wav_file.writeframes(message)
 
             # Print length of the message
             print(f"Received {len(message)} bytes from {address}")
-    
+
     except KeyboardInterrupt:
         print("\nStopping recording...")
-    
+
     finally:
         # Close files and socket
+        stop_event.set()
+        trace_thread.join()
         wav_file.close()
         server_socket.close()
         print(f"WAV file '{filename}' saved successfully")
 
 
 if __name__ == "__main__":
-    parser = argparse.ArgumentParser(description='UDP音频数据接收器，保存为WAV文件')
-    parser.add_argument('--samplerate', '-s', type=int, default=16000, 
+    parser = argparse.ArgumentParser(description='UDP音频数据接收器，保存为WAV文件，并把音频链路追踪保存为 Chrome trace 文件')
+    parser.add_argument('--samplerate', '-s', type=int, default=16000,
                         help='采样率 (默认: 16000)')
-    parser.add_argument('--channels', '-c', type=int, default=2, 
+    parser.add_argument('--channels', '-c', type=int, default=2,
                         help='声道数 (默认: 2)')
-    
+    parser.add_argument('--port', '-p', type=int, default=8000,
+                        help='PCM 数据端口，追踪数据使用下一个端口 (默认: 8000)')
+
     args = parser.parse_args()
-    main(args.samplerate, args.channels)
+    main(args.samplerate, args.channels, args.port)
@@ -0,0 +1,164 @@
+#! /usr/bin/env python3
+import argparse
+import hashlib
+import struct
+import sys
+
+'''
+  生成和校验差分升级补丁，格式与 main/ota.cc 中的 OtaPatcher 一致（小端）：
+    header: "XZDP", u32 version, u32 source_size, u32 target_size,
+            source sha256[32], target sha256[32]
+    ops:    0x01 COPY   u32 source_offset, u32 length
+            0x02 INSERT u32 length, data
+            0x00 END
+
+  用法：
+    ota_delta.py create old.bin new.bin patch.bin
+    ota_delta.py apply old.bin patch.bin out.bin
+    ota_delta.py verify old.bin new.bin
+'''
+
+MAGIC = b"XZDP"
+VERSION = 1
+HEADER = struct.Struct("<4sIII32s32s")
+OP_END = 0
+OP_COPY = 1
+OP_INSERT = 2
+
+# 源文件按 BLOCK_STEP 对齐的位置建立 BLOCK_SIZE 字节窗口的索引
+BLOCK_SIZE = 32
+BLOCK_STEP = 16
+# 短于该长度的匹配不如直接插入划算（COPY 指令本身占 9 字节）
+MIN_COPY = 24
+
+
+def build_index(source):
+    index = {}
+    for offset in range(0, len(source) - BLOCK_SIZE + 1, BLOCK_STEP):
+        index.setdefault(source[offset:offset + BLOCK_SIZE], offset)
+    return index
+
+
+def find_match(source, target, pos, index):
+    src = index.get(target[pos:pos + BLOCK_SIZE])
+    if src is None:
+        return None, 0
+    length = BLOCK_SIZE
+    while pos + length < len(target) and src + length < len(source) and target[pos + length] == source[src + length]:
+        length += 1
+    return src, length
+
+
+def create_patch(source, target):
+    index = build_index(source)
+    ops = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        if literal:
+            ops.extend(struct.pack("<BI", OP_INSERT, len(literal)))
+            ops.extend(literal)
+            literal.clear()
+
+    pos = 0
+    while pos < len(target):
+        src, length = find_match(source, target, pos, index)
+        if src is None or length < MIN_COPY:
+            literal.append(target[pos])
+            pos += 1
+            continue
+        end = pos + length
+        # 索引只覆盖对齐位置，向前扩展匹配，吃掉与源文件相同的待插入字节
+        while literal and src > 0 and source[src - 1] == literal[-1]:
+            literal.pop()
+            src -= 1
+            length += 1
+        flush_literal()
+        ops.extend(struct.pack("<BII", OP_COPY, src, length))
+        pos = end
+    flush_literal()
+    ops.append(OP_END)
+
+    header = HEADER.pack(MAGIC, VERSION, len(source), len(target),
+                         hashlib.sha256(source).digest(), hashlib.sha256(target).digest())
+    return header + bytes(ops)
+
+
+def apply_patch(source, patch):
+    magic, version, source_size, target_size, source_sha256, target_sha256 = HEADER.unpack_from(patch, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("invalid patch header")
+    if source_size != len(source) or hashlib.sha256(source).digest() != source_sha256:
+        raise ValueError("patch was not generated for this source image")
+
+    output = bytearray()
+    pos = HEADER.size
+    while True:
+        op = patch[pos]
+        pos += 1
+        if op == OP_END:
+            break
+        elif op == OP_COPY:
+            offset, length = struct.unpack_from("<II", patch, pos)
+            pos += 8
+            if offset + length > source_size:
+                raise ValueError("copy out of range")
+            output.extend(source[offset:offset + length])
+        elif op == OP_INSERT:
+            (length,) = struct.unpack_from("<I", patch, pos)
+            pos += 4
+            output.extend(patch[pos:pos + length])
+            pos += length
+        else:
+            raise ValueError(f"invalid op {op} at {pos - 1}")
+
+    if len(output) != target_size or hashlib.sha256(output).digest() != target_sha256:
+        raise ValueError("patched image does not match the target")
+    return bytes(output)
+
+
+def read_file(path):
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def write_file(path, data):
+    with open(path, "wb") as f:
+        f.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create and verify delta OTA patches")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+    create = subparsers.add_parser("create", help="create a patch from old to new firmware")
+    create.add_argument("source")
+    create.add_argument("target")
+    create.add_argument("patch")
+    apply = subparsers.add_parser("apply", help="apply a patch to the old firmware")
+    apply.add_argument("source")
+    apply.add_argument("patch")
+    apply.add_argument("output")
+    verify = subparsers.add_parser("verify", help="create a patch in memory and check it reproduces the new firmware")
+    verify.add_argument("source")
+    verify.add_argument("target")
+    args = parser.parse_args()
+
+    if args.command == "create":
+        source, target = read_file(args.source), read_file(args.target)
+        patch = create_patch(source, target)
+        apply_patch(source, patch)
+        write_file(args.patch, patch)
+        print(f"Patch: {len(patch)} bytes, {len(patch) * 100 / len(target):.1f}% of {len(target)} bytes")
+    elif args.command == "apply":
+        write_file(args.output, apply_patch(read_file(args.source), read_file(args.patch)))
+    elif args.command == "verify":
+        source, target = read_file(args.source), read_file(args.target)
+        patch = create_patch(source, target)
+        if apply_patch(source, patch) != target:
+            print("Verification failed")
+            sys.exit(1)
+        print(f"OK, patch is {len(patch)} bytes ({len(patch) * 100 / len(target):.1f}%)")
+
+
+if __name__ == "__main__":
+    main()
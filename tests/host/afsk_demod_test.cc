@@ -0,0 +1,163 @@
+#include "afsk_demod.h"
+#include "afsk_signal.h"
+#include "test_util.h"
+
+#include <chrono>
+
+using namespace audio_wifi_config;
+
+// 旧版发送端的无帧格式：\x01\x02 | 文本 | 校验和 | \x03\x04
+static std::vector<int> LegacyBits(const std::string& text) {
+    std::string data = "\x01\x02" + text;
+    data += (char)AudioDataBuffer::CalculateChecksum(text);
+    data += "\x03\x04";
+    return AfskBytesToBits(data);
+}
+
+// 和接收循环一样每次读 30ms
+static std::vector<float> Demodulate(AudioSignalProcessor& processor, const std::vector<int16_t>& samples,
+                                     size_t stride = 1, size_t chunk = 480) {
+    std::vector<float> probabilities;
+    float block[64];
+    size_t frames = samples.size() / stride;
+    for (size_t i = 0; i < frames; i += chunk) {
+        size_t count = processor.ProcessAudioSamples(samples.data() + i * stride, std::min(chunk, frames - i),
+                                                     stride, block, 64);
+        probabilities.insert(probabilities.end(), block, block + count);
+    }
+    return probabilities;
+}
+
+static bool DecodeLegacy(const std::vector<float>& probabilities, const std::string& text) {
+    AudioDataBuffer buffer;
+    for (size_t i = 0; i < probabilities.size(); i += 3) {
+        size_t count = std::min<size_t>(3, probabilities.size() - i);
+        if (buffer.ProcessProbabilityData(probabilities.data() + i, count, 0.5f) && buffer.decoded_text.has_value()) {
+            if (*buffer.decoded_text == text) {
+                return true;
+            }
+            buffer.decoded_text.reset();
+        }
+    }
+    return false;
+}
+
+// 硬判决比特序列与发送比特对齐最好的位置上的误码数，重复发送时即最好的一次
+static size_t BitErrors(const std::vector<float>& probabilities, const std::vector<int>& bits) {
+    size_t best = bits.size();
+    for (size_t offset = 0; offset + bits.size() <= probabilities.size(); offset++) {
+        size_t errors = 0;
+        for (size_t i = 0; i < bits.size() && errors < best; i++) {
+            errors += (probabilities[offset + i] > 0.5f) != (bits[i] != 0);
+        }
+        best = std::min(best, errors);
+    }
+    return best;
+}
+
+// 按发送脚本的默认方式（重复 3 次）发送旧格式，统计解码率、误码率和每秒音频的处理时间
+static void TestLegacyChannel() {
+    const std::string text = "MyWifi-5G\nsecret-password-123";
+    const int kTrials = 10;
+    std::mt19937 rng(1);
+    auto bits = LegacyBits(text);
+    for (double snr_db : {20.0, 6.0, 0.0, -3.0}) {
+        for (double drift : {0.0, 0.01, -0.03, 0.03}) {
+            int decoded = 0;
+            size_t bit_errors = 0;
+            double cpu_s = 0.0, audio_s = 0.0;
+            for (int trial = 0; trial < kTrials; trial++) {
+                AfskChannel channel;
+                channel.snr_db = snr_db;
+                channel.drift = drift;
+                channel.offset_s = 0.2 + std::uniform_real_distribution<double>(0.0, 0.05)(rng);
+                channel.repeat = 3;
+                auto samples = AfskModulate(bits, kMarkFrequency, kSpaceFrequency, kBitRate, channel, rng);
+
+                AudioSignalProcessor processor(kMarkFrequency, kSpaceFrequency, kBitRate);
+                auto start = std::chrono::steady_clock::now();
+                auto probabilities = Demodulate(processor, samples);
+                cpu_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                audio_s += samples.size() / (double)kInputSampleRate;
+
+                decoded += DecodeLegacy(probabilities, text);
+                bit_errors += BitErrors(probabilities, bits);
+            }
+            double bit_error_rate = (double)bit_errors / (bits.size() * kTrials);
+            printf("SNR %3.0f dB, drift %+2.0f%%: decoded %2d/%d, BER %.4f, %.0f us per second of audio\n",
+                   snr_db, drift * 100, decoded, kTrials, bit_error_rate, cpu_s / audio_s * 1e6);
+            if (snr_db >= 0.0) {
+                CHECK_EQ(decoded, kTrials);
+            }
+            if (snr_db >= 6.0) {
+                CHECK_EQ(bit_errors, 0u);
+            }
+        }
+    }
+}
+
+// 输出只取决于采样本身，与每次读取的长度无关
+static void TestChunkSize() {
+    std::mt19937 rng(2);
+    AfskChannel channel;
+    channel.snr_db = 10.0;
+    channel.offset_s = 0.013;
+    auto samples = AfskModulate(LegacyBits("chunk\ntest"), kMarkFrequency, kSpaceFrequency, kBitRate, channel, rng);
+
+    AudioSignalProcessor reference_processor(kMarkFrequency, kSpaceFrequency, kBitRate);
+    auto reference = Demodulate(reference_processor, samples);
+    for (size_t chunk : {1, 37, 512, 4096}) {
+        AudioSignalProcessor processor(kMarkFrequency, kSpaceFrequency, kBitRate);
+        auto probabilities = Demodulate(processor, samples, 1, chunk);
+        CHECK_EQ(probabilities.size(), reference.size());
+        for (size_t i = 0; i < reference.size(); i++) {
+            CHECK(std::fabs(probabilities[i] - reference[i]) < 1e-6f);
+        }
+    }
+}
+
+// 带参考通道的双声道输入只解调第一个声道
+static void TestInterleavedChannels() {
+    const std::string text = "stereo\npassword";
+    std::mt19937 rng(3);
+    AfskChannel channel;
+    channel.snr_db = 10.0;
+    channel.offset_s = 0.2;
+    auto mono = AfskModulate(LegacyBits(text), kMarkFrequency, kSpaceFrequency, kBitRate, channel, rng);
+
+    // 参考通道放一个落在 space 频点上的强干扰，解调器读到它就会解错
+    std::vector<int16_t> stereo;
+    for (size_t i = 0; i < mono.size(); i++) {
+        stereo.push_back(mono[i]);
+        stereo.push_back((int16_t)std::lround(20000 * std::sin(2 * M_PI * kSpaceFrequency * i / 16000.0)));
+    }
+    AudioSignalProcessor processor(kMarkFrequency, kSpaceFrequency, kBitRate);
+    CHECK(DecodeLegacy(Demodulate(processor, stereo, 2), text));
+}
+
+// 快速模式的比特在安静环境下没有误码
+static void TestFastMode() {
+    std::mt19937 rng(4);
+    std::vector<int> bits;
+    for (int i = 0; i < 400; i++) {
+        bits.push_back(std::uniform_int_distribution<int>(0, 1)(rng));
+    }
+    for (double drift : {0.0, -0.02, 0.02}) {
+        AfskChannel channel;
+        channel.snr_db = 20.0;
+        channel.drift = drift;
+        channel.offset_s = 0.1;
+        auto samples = AfskModulate(bits, kFastMarkFrequency, kFastSpaceFrequency, kFastBitRate, channel, rng);
+        AudioSignalProcessor processor(kFastMarkFrequency, kFastSpaceFrequency, kFastBitRate);
+        CHECK_EQ(BitErrors(Demodulate(processor, samples), bits), 0u);
+    }
+}
+
+int main() {
+    TestLegacyChannel();
+    TestChunkSize();
+    TestInterleavedChannels();
+    TestFastMode();
+    printf("afsk_demod_test passed\n");
+    return 0;
+}
@@ -0,0 +1,217 @@
+#include "afsk_demod.h"
+#include "afsk_frame.h"
+#include "afsk_signal.h"
+#include "test_util.h"
+
+#include <cstring>
+
+using namespace audio_wifi_config;
+
+// scripts/acoustic_wifi_encode.py 的帧编码，测试可以在其中注入错误
+static void ConvolutionalEncode(const std::string& data, std::vector<int>& bits) {
+    auto input = AfskBytesToBits(data);
+    input.resize(input.size() + kFrameTailBits, 0);
+    uint8_t state = 0;
+    for (int bit : input) {
+        uint8_t reg = (bit << 6) | state;
+        bits.push_back(__builtin_popcount(reg & 0x79) & 1);
+        bits.push_back(__builtin_popcount(reg & 0x5B) & 1);
+        state = reg >> 1;
+    }
+}
+
+struct FrameFaults {
+    uint8_t version = kFrameVersion;
+    uint8_t header_crc_xor = 0;
+    uint16_t payload_crc_xor = 0;
+};
+
+static std::vector<int> FrameBits(const std::string& ssid, const std::string& password,
+                                  const FrameFaults& faults = FrameFaults()) {
+    std::string payload = (char)ssid.size() + ssid + password;
+    uint8_t header[kFrameHeaderSize] = {faults.version, (uint8_t)payload.size(), 0};
+    header[2] = Crc8(header, 2) ^ faults.header_crc_xor;
+    uint16_t crc = Crc16((const uint8_t*)payload.data(), payload.size(), Crc16(header, kFrameHeaderSize));
+    crc ^= faults.payload_crc_xor;
+
+    std::vector<int> bits;
+    for (int i = 0; i < 16; i++) {
+        bits.push_back(1);
+        bits.push_back(0);
+    }
+    for (int i = 15; i >= 0; i--) {
+        bits.push_back((kFrameSyncWord >> i) & 1);
+    }
+    ConvolutionalEncode(std::string((const char*)header, kFrameHeaderSize), bits);
+    ConvolutionalEncode(payload + (char)(crc >> 8) + (char)(crc & 0xFF), bits);
+    return bits;
+}
+
+// 没有经过调制的理想软判决
+static std::vector<float> IdealProbabilities(const std::vector<int>& bits) {
+    std::vector<float> probabilities;
+    for (int bit : bits) {
+        probabilities.push_back(bit ? 1.0f : 0.0f);
+    }
+    return probabilities;
+}
+
+// 和接收循环一样逐块送入，返回收到的所有负载
+static std::vector<std::string> Decode(FrameDecoder& decoder, const std::vector<float>& probabilities) {
+    std::vector<std::string> payloads;
+    for (size_t i = 0; i < probabilities.size(); i += 3) {
+        if (decoder.ProcessProbabilityData(probabilities.data() + i, std::min<size_t>(3, probabilities.size() - i))) {
+            payloads.push_back(*decoder.decoded_payload);
+            decoder.decoded_payload.reset();
+        }
+    }
+    return payloads;
+}
+
+static void TestCrc() {
+    const uint8_t check[] = "123456789";
+    CHECK_EQ(Crc8(check, 9), 0xF4);
+    CHECK_EQ(Crc16(check, 9), 0x29B1);
+}
+
+// 与发送脚本逐比特一致：python3 -c "import acoustic_wifi_encode as e; print(e.frame_bits('xiaozhi', '12345678'))"
+static void TestMatchesEncoderScript() {
+    const char* golden = "aaaaaaaa2dd40003bfcc450ebb70036bcd599da5545499f60db6819e9da6d3e01334c80f0c67a75c6088bbb3712404f6f6b177";
+    auto bits = FrameBits("xiaozhi", "12345678");
+    CHECK_EQ(bits.size(), 408u);
+    for (size_t i = 0; i < bits.size(); i++) {
+        int nibble = golden[i / 4] <= '9' ? golden[i / 4] - '0' : golden[i / 4] - 'a' + 10;
+        CHECK_EQ(bits[i], (nibble >> (3 - i % 4)) & 1);
+    }
+}
+
+static void TestParseCredentials() {
+    std::string ssid, password;
+    CHECK(ParseCredentials(std::string("\x04") + "home" + "pass word", ssid, password));
+    CHECK_EQ(ssid, std::string("home"));
+    CHECK_EQ(password, std::string("pass word"));
+    CHECK(ParseCredentials(std::string("\x04") + "open", ssid, password));
+    CHECK(password.empty());
+    CHECK(!ParseCredentials("", ssid, password));
+    CHECK(!ParseCredentials(std::string("\x00", 1) + "x", ssid, password));
+    CHECK(!ParseCredentials(std::string("\x05") + "home", ssid, password));
+}
+
+// 最长的 SSID 和密码，以及 SSID 中的换行和非 ASCII 字符都能原样收到
+static void TestPayloads() {
+    const std::pair<std::string, std::string> credentials[] = {
+        {"a", ""},
+        {"line\nbreak", "pa\nss"},
+        {"小智的WiFi", "密码1234"},
+        {std::string(32, 'S'), std::string(64, 'p')},
+    };
+    for (const auto& [ssid, password] : credentials) {
+        FrameDecoder decoder("test");
+        auto payloads = Decode(decoder, IdealProbabilities(FrameBits(ssid, password)));
+        CHECK_EQ(payloads.size(), 1u);
+        std::string got_ssid, got_password;
+        CHECK(ParseCredentials(payloads[0], got_ssid, got_password));
+        CHECK_EQ(got_ssid, ssid);
+        CHECK_EQ(got_password, password);
+    }
+}
+
+// 卷积码纠正分散的比特错误，同步字允许 1 个错误
+static void TestErrorCorrection() {
+    auto bits = FrameBits("xiaozhi", "12345678");
+    const size_t coded_start = 48;
+    for (size_t i = coded_start + 3; i < bits.size(); i += 17) {
+        bits[i] ^= 1;
+    }
+    bits[32 + 5] ^= 1;
+    FrameDecoder decoder("test");
+    auto payloads = Decode(decoder, IdealProbabilities(bits));
+    CHECK_EQ(payloads.size(), 1u);
+    CHECK_EQ(payloads[0], std::string("\x07xiaozhi12345678"));
+}
+
+// 校验不通过或版本不认识的帧不会交给 ConnectToWifi，之后的正确帧照常接收
+static void TestRejectedFrames() {
+    FrameFaults bad_header;
+    bad_header.header_crc_xor = 0x01;
+    FrameFaults bad_payload;
+    bad_payload.payload_crc_xor = 0x8000;
+    FrameFaults bad_version;
+    bad_version.version = kFrameVersion + 1;
+
+    // 超出纠错能力的突发错误
+    auto burst = FrameBits("xiaozhi", "12345678");
+    for (size_t i = 200; i < 240; i++) {
+        burst[i] ^= 1;
+    }
+
+    for (const auto& bits : {FrameBits("xiaozhi", "12345678", bad_header), FrameBits("xiaozhi", "12345678", bad_payload),
+                             FrameBits("xiaozhi", "12345678", bad_version), burst}) {
+        FrameDecoder decoder("test");
+        auto probabilities = IdealProbabilities(bits);
+        auto good = IdealProbabilities(FrameBits("good", "frame"));
+        CHECK(Decode(decoder, probabilities).empty());
+        CHECK(!decoder.decoded_payload.has_value());
+        auto payloads = Decode(decoder, good);
+        CHECK_EQ(payloads.size(), 1u);
+        CHECK_EQ(payloads[0], std::string("\x04goodframe"));
+    }
+}
+
+// 经过调制解调和噪声信道后两种比特率都能收到
+static void TestChannel() {
+    struct Mode {
+        const char* name;
+        size_t mark, space, bit_rate;
+        double min_snr_db;
+    };
+    const Mode modes[] = {
+        {"normal", kMarkFrequency, kSpaceFrequency, kBitRate, 0.0},
+        {"fast", kFastMarkFrequency, kFastSpaceFrequency, kFastBitRate, 6.0},
+    };
+    const int kTrials = 10;
+    std::mt19937 rng(5);
+    auto bits = FrameBits("MyWifi-5G", "secret-password-123");
+    for (const auto& mode : modes) {
+        for (double snr_db : {20.0, 6.0, 0.0, -3.0}) {
+            int decoded = 0;
+            for (int trial = 0; trial < kTrials; trial++) {
+                AfskChannel channel;
+                channel.snr_db = snr_db;
+                channel.drift = std::uniform_real_distribution<double>(-0.03, 0.03)(rng);
+                channel.offset_s = 0.2 + std::uniform_real_distribution<double>(0.0, 0.05)(rng);
+                auto samples = AfskModulate(bits, mode.mark, mode.space, mode.bit_rate, channel, rng);
+
+                AudioSignalProcessor processor(mode.mark, mode.space, mode.bit_rate);
+                FrameDecoder decoder(mode.name);
+                float probabilities[16];
+                bool received = false;
+                for (size_t i = 0; i < samples.size(); i += 480) {
+                    size_t count = processor.ProcessAudioSamples(samples.data() + i, std::min<size_t>(480, samples.size() - i),
+                                                                 1, probabilities, 16);
+                    if (decoder.ProcessProbabilityData(probabilities, count)) {
+                        CHECK_EQ(*decoder.decoded_payload, std::string("\x09MyWifi-5Gsecret-password-123"));
+                        received = true;
+                    }
+                }
+                decoded += received;
+            }
+            printf("%s, SNR %3.0f dB: decoded %2d/%d\n", mode.name, snr_db, decoded, kTrials);
+            if (snr_db >= mode.min_snr_db) {
+                CHECK_EQ(decoded, kTrials);
+            }
+        }
+    }
+}
+
+int main() {
+    TestCrc();
+    TestMatchesEncoderScript();
+    TestParseCredentials();
+    TestPayloads();
+    TestErrorCorrection();
+    TestRejectedFrames();
+    TestChannel();
+    printf("afsk_frame_test passed\n");
+    return 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// 与 scripts/acoustic_wifi_encode.py 相同的连续相位 FSK 调制，另外可以加入噪声、
+// 发送端时钟偏差和起始偏移，用来模拟扬声器到麦克风的信道
+struct AfskChannel {
+    double snr_db = 40.0;       // 白噪声信噪比
+    double drift = 0.0;         // 发送端比特率偏差，0.01 表示慢 1%
+    double offset_s = 0.0;      // 信号前的静音
+    int repeat = 1;             // 与发送脚本一样重复发送，中间隔 200ms 静音
+    double amplitude = 16000.0;
+};
+
+inline std::vector<int> AfskBytesToBits(const std::string& data) {
+    std::vector<int> bits;
+    for (unsigned char byte : data) {
+        for (int i = 7; i >= 0; i--) {
+            bits.push_back((byte >> i) & 1);
+        }
+    }
+    return bits;
+}
+
+inline std::vector<int16_t> AfskModulate(const std::vector<int>& bits, int mark, int space, int bit_rate,
+                                         const AfskChannel& channel, std::mt19937& rng) {
+    const double sample_rate = 16000.0;
+    std::vector<double> signal(std::lround(channel.offset_s * sample_rate), 0.0);
+    double samples_per_bit = sample_rate / bit_rate * (1.0 + channel.drift);
+    double phase = 0.0;
+    for (int n = 0; n < channel.repeat; n++) {
+        for (size_t i = 0; i < bits.size(); i++) {
+            long count = std::lround((i + 1) * samples_per_bit) - std::lround(i * samples_per_bit);
+            for (long j = 0; j < count; j++) {
+                phase += 2 * M_PI * (bits[i] ? mark : space) / sample_rate;
+                signal.push_back(channel.amplitude * std::sin(phase));
+            }
+        }
+        // 间隔的静音也让解调器输出最后几个比特
+        signal.resize(signal.size() + sample_rate / 5, 0.0);
+    }
+
+    std::normal_distribution<double> noise(0.0, channel.amplitude / std::sqrt(2.0) / std::pow(10.0, channel.snr_db / 20));
+    std::vector<int16_t> samples;
+    samples.reserve(signal.size());
+    for (double value : signal) {
+        samples.push_back((int16_t)std::clamp(std::lround(value + noise(rng)), -32768L, 32767L));
+    }
+    return samples;
+}
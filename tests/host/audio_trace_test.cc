@@ -0,0 +1,160 @@
+#include "audio/audio_trace.h"
+#include "test_util.h"
+
+#include <cJSON.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+// 导出的每个分块都必须能单独解析，按 export/seq 重新拼接后得到完整的事件列表
+struct ExportedTrace {
+    std::vector<std::string> chunks;
+    std::vector<cJSON*> events;
+    std::vector<cJSON*> documents;
+
+    ~ExportedTrace() {
+        for (auto document : documents) {
+            cJSON_Delete(document);
+        }
+    }
+};
+
+static void Parse(ExportedTrace& trace, uint32_t export_id) {
+    CHECK(!trace.chunks.empty());
+    for (size_t i = 0; i < trace.chunks.size(); i++) {
+        // 分块大小不超过一个 UDP 数据报能可靠发送的范围
+        CHECK(trace.chunks[i].size() < AUDIO_TRACE_CHUNK_SIZE + 200);
+        cJSON* document = cJSON_Parse(trace.chunks[i].c_str());
+        CHECK(document != nullptr);
+        trace.documents.push_back(document);
+        CHECK_EQ((uint32_t)cJSON_GetObjectItem(document, "export")->valuedouble, export_id);
+        CHECK_EQ((size_t)cJSON_GetObjectItem(document, "seq")->valuedouble, i);
+        auto last = cJSON_GetObjectItem(document, "last");
+        CHECK_EQ(last != nullptr && cJSON_IsTrue(last), i + 1 == trace.chunks.size());
+        cJSON* event;
+        cJSON_ArrayForEach(event, cJSON_GetObjectItem(document, "events")) {
+            trace.events.push_back(event);
+        }
+    }
+}
+
+static std::string Str(cJSON* event, const char* name) {
+    return cJSON_GetObjectItem(event, name)->valuestring;
+}
+
+static int64_t Num(cJSON* event, const char* name) {
+    return (int64_t)cJSON_GetObjectItem(event, name)->valuedouble;
+}
+
+static void TestExport() {
+    AudioTrace trace;
+    CHECK_EQ(trace.NewFrameId(), 0u);
+    trace.Initialize();
+
+    // 两个上行帧在流水线上交错，第一帧 20 ms，第二帧 30 ms
+    uint32_t up1 = trace.NewFrameId();
+    uint32_t up2 = trace.NewFrameId();
+    trace.Record(kAudioTraceCapture, up1, 1000);
+    trace.Record(kAudioTraceAfeOut, up1, 3000);
+    trace.Record(kAudioTraceCapture, up2, 4000);
+    trace.Record(kAudioTraceEncodeStart, up1, 5000);
+    trace.Record(kAudioTraceAfeOut, up2, 6000);
+    trace.Record(kAudioTraceEncodeEnd, up1, 15000);
+    trace.Record(kAudioTraceSend, up1, 21000);
+    trace.Record(kAudioTraceEncodeStart, up2, 16000);
+    trace.Record(kAudioTraceEncodeEnd, up2, 26000);
+    trace.Record(kAudioTraceSend, up2, 34000);
+    // 一个下行帧 50 ms
+    uint32_t down = trace.NewFrameId();
+    trace.Record(kAudioTraceReceive, down, 100000);
+    trace.Record(kAudioTraceDecode, down, 110000);
+    trace.Record(kAudioTracePlayback, down, 150000);
+    // 未完成的帧不计入延迟
+    uint32_t partial = trace.NewFrameId();
+    trace.Record(kAudioTraceCapture, partial, 200000);
+    trace.Record(kAudioTraceAfeOut, partial, 202000);
+    trace.Record(kAudioTraceCapture, 0, 300000);
+
+    ExportedTrace exported;
+    AudioTraceStats stats;
+    size_t frames = trace.Export([&](const std::string& chunk) { exported.chunks.push_back(chunk); }, &stats);
+    CHECK_EQ(frames, 4u);
+    CHECK_EQ(stats.frames, 4u);
+    CHECK_EQ(stats.uplink_frames, 2);
+    CHECK_EQ(stats.uplink_avg_us, 25000);
+    CHECK_EQ(stats.uplink_max_us, 30000);
+    CHECK_EQ(stats.downlink_frames, 1);
+    CHECK_EQ(stats.downlink_avg_us, 50000);
+    CHECK_EQ(stats.downlink_max_us, 50000);
+
+    Parse(exported, 1);
+    // 上行每帧 4 个区间，下行 2 个，未完成的帧 1 个，每个区间一对 b/e 事件
+    CHECK_EQ(exported.events.size(), (size_t)(4 + 4 + 2 + 1) * 2);
+
+    std::map<std::string, int64_t> durations;
+    for (size_t i = 0; i < exported.events.size(); i += 2) {
+        auto begin = exported.events[i];
+        auto end = exported.events[i + 1];
+        CHECK(Str(begin, "ph") == "b");
+        CHECK(Str(end, "ph") == "e");
+        CHECK(Str(begin, "name") == Str(end, "name"));
+        CHECK_EQ(Num(begin, "id"), Num(end, "id"));
+        CHECK_EQ(Num(begin, "tid"), Str(begin, "cat") == "uplink" ? 1 : 2);
+        durations[Str(begin, "name") + "/" + std::to_string(Num(begin, "id"))] = Num(end, "ts") - Num(begin, "ts");
+    }
+    CHECK_EQ(durations["afe/" + std::to_string(up1)], 2000);
+    CHECK_EQ(durations["encode_queue/" + std::to_string(up1)], 2000);
+    CHECK_EQ(durations["encode/" + std::to_string(up1)], 10000);
+    CHECK_EQ(durations["send_queue/" + std::to_string(up1)], 6000);
+    CHECK_EQ(durations["encode_queue/" + std::to_string(up2)], 10000);
+    CHECK_EQ(durations["send_queue/" + std::to_string(up2)], 8000);
+    CHECK_EQ(durations["decode/" + std::to_string(down)], 10000);
+    CHECK_EQ(durations["playback/" + std::to_string(down)], 40000);
+    CHECK_EQ(durations["afe/" + std::to_string(partial)], 2000);
+
+    // 再次导出只包含新记录的帧，没有新记录时不输出
+    ExportedTrace empty;
+    CHECK_EQ(trace.Export([&](const std::string& chunk) { empty.chunks.push_back(chunk); }, &stats), 0u);
+    CHECK(empty.chunks.empty());
+    CHECK_EQ(stats.frames, 0u);
+}
+
+static void TestChunking() {
+    AudioTrace trace;
+    trace.Initialize();
+    // 足够多的帧使导出分成多个分块，并让环形缓冲回绕一次
+    const int kFrames = AUDIO_TRACE_RING_SIZE / 3 + 100;
+    for (int i = 0; i < kFrames; i++) {
+        uint32_t frame_id = trace.NewFrameId();
+        int64_t start = 1000000 + i * 60000;
+        trace.Record(kAudioTraceReceive, frame_id, start);
+        trace.Record(kAudioTraceDecode, frame_id, start + 5000);
+        trace.Record(kAudioTracePlayback, frame_id, start + 60000 + (i % 10) * 1000);
+    }
+    // 最早的 298 条被覆盖：前 99 帧整帧丢失，第 100 帧只剩 decode -> playback，不计入延迟
+    ExportedTrace exported;
+    AudioTraceStats stats;
+    size_t frames = trace.Export([&](const std::string& chunk) { exported.chunks.push_back(chunk); }, &stats);
+    CHECK(exported.chunks.size() > 10);
+    Parse(exported, 1);
+    CHECK_EQ(frames, (size_t)AUDIO_TRACE_RING_SIZE / 3 + 1);
+    CHECK_EQ(stats.downlink_frames, AUDIO_TRACE_RING_SIZE / 3);
+    CHECK_EQ(stats.downlink_max_us, 69000);
+    CHECK_EQ(exported.events.size(), (size_t)(stats.downlink_frames * 2 + 1) * 2);
+
+    // 导出序号递增，接收端据此区分不同的导出
+    uint32_t frame_id = trace.NewFrameId();
+    trace.Record(kAudioTraceReceive, frame_id, 1);
+    trace.Record(kAudioTracePlayback, frame_id, 2);
+    ExportedTrace next;
+    trace.Export([&](const std::string& chunk) { next.chunks.push_back(chunk); });
+    Parse(next, 2);
+}
+
+int main() {
+    TestExport();
+    TestChunking();
+    printf("audio_trace_test passed\n");
+    return 0;
+}
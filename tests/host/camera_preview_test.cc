@@ -0,0 +1,105 @@
+#include "camera_preview.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <random>
+
+// 逐像素的参考实现：最近邻取样加 __builtin_bswap16
+static std::vector<uint16_t> Reference(const std::vector<uint16_t>& src, int src_width, int src_height,
+                                       int width, int height) {
+    std::vector<uint16_t> dst(width * height);
+    for (int y = 0; y < height; y++) {
+        int src_y = (int)std::floor((y + 0.5) * src_height / height);
+        for (int x = 0; x < width; x++) {
+            int src_x = (int)std::floor((x + 0.5) * src_width / width);
+            dst[y * width + x] = __builtin_bswap16(src[src_y * src_width + src_x]);
+        }
+    }
+    return dst;
+}
+
+static std::vector<uint16_t> RandomFrame(int width, int height, std::mt19937& rng) {
+    std::vector<uint16_t> frame(width * height);
+    for (auto& pixel : frame) {
+        pixel = rng();
+    }
+    return frame;
+}
+
+static void CheckSize(CameraPreviewScaler& scaler, int src_width, int src_height, int max_width, std::mt19937& rng) {
+    CHECK(scaler.Prepare(src_width, src_height, max_width));
+    int width = scaler.width();
+    int height = scaler.height();
+    if (max_width <= 0 || max_width >= src_width) {
+        CHECK_EQ(width, src_width);
+        CHECK_EQ(height, src_height);
+    } else {
+        CHECK_EQ(width, max_width);
+        CHECK_EQ(height, src_height * max_width / src_width);
+    }
+
+    auto src = RandomFrame(src_width, src_height, rng);
+    // 多留一个哨兵像素，检查没有越界写入
+    std::vector<uint16_t> dst(width * height + 1, 0xA5A5);
+    scaler.Convert(src.data(), dst.data());
+    CHECK_EQ(dst.back(), 0xA5A5);
+    dst.pop_back();
+    if (dst != Reference(src, src_width, src_height, width, height)) {
+        fprintf(stderr, "Preview %dx%d -> %dx%d does not match the reference\n", src_width, src_height, width, height);
+        exit(1);
+    }
+}
+
+static void TestSizes() {
+    struct Size {
+        int src_width, src_height, max_width;
+    };
+    const Size sizes[] = {
+        {320, 240, 0},      // 原尺寸，成对交换
+        {320, 240, 320},
+        {320, 240, 480},    // 不放大
+        {5, 3, 0},          // 像素总数为奇数，最后一个单独交换
+        {7, 7, 0},
+        {320, 240, 160},    // 整数倍缩小
+        {640, 480, 160},
+        {320, 240, 224},    // 非整数倍
+        {640, 480, 173},
+        {321, 239, 100},    // 奇数宽高
+        {96, 96, 95},
+        {800, 600, 3},
+        {240, 320, 120},    // 竖屏
+    };
+    std::mt19937 rng(1);
+    for (const auto& size : sizes) {
+        CameraPreviewScaler scaler;
+        CheckSize(scaler, size.src_width, size.src_height, size.max_width, rng);
+    }
+}
+
+// 源分辨率变化而目标尺寸不变时列映射也要重建
+static void TestFrameSizeChange() {
+    std::mt19937 rng(2);
+    CameraPreviewScaler scaler;
+    CheckSize(scaler, 320, 240, 160, rng);
+    CheckSize(scaler, 640, 480, 160, rng);
+    CheckSize(scaler, 640, 480, 160, rng);
+    CheckSize(scaler, 480, 360, 160, rng);
+    CheckSize(scaler, 160, 120, 160, rng);
+    CheckSize(scaler, 320, 240, 160, rng);
+    CheckSize(scaler, 321, 241, 0, rng);
+}
+
+static void TestEmpty() {
+    CameraPreviewScaler scaler;
+    CHECK(!scaler.Prepare(0, 240, 160));
+    CHECK(!scaler.Prepare(320, 0, 160));
+    CHECK(!scaler.Prepare(400, 1, 200));     // 高度缩到 0
+}
+
+int main() {
+    TestSizes();
+    TestFrameSizeChange();
+    TestEmpty();
+    printf("camera_preview_test passed\n");
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include "circular_strip.h"
+#include "application.h"
+#include "test_util.h"
+
+#include <string>
+
+// 每次刷新记为 "时间ms: 各灯 RGB"，与下面的黄金帧逐帧比较
+static std::vector<std::string> TakeFrames() {
+    auto strip = led_strip_stub_last();
+    std::vector<std::string> frames;
+    for (const auto& frame : strip->frames) {
+        char text[16];
+        snprintf(text, sizeof(text), "%lld:", (long long)(frame.time_us / 1000));
+        std::string line = text;
+        for (const auto& pixel : frame.pixels) {
+            snprintf(text, sizeof(text), " %02x%02x%02x", pixel[0], pixel[1], pixel[2]);
+            line += text;
+        }
+        frames.push_back(line);
+    }
+    strip->frames.clear();
+    return frames;
+}
+
+static void CheckFrames(const std::vector<std::string>& expected) {
+    auto frames = TakeFrames();
+    if (frames != expected) {
+        fprintf(stderr, "Frames do not match, got:\n");
+        for (const auto& frame : frames) {
+            fprintf(stderr, "        \"%s\",\n", frame.c_str());
+        }
+        exit(1);
+    }
+}
+
+static void SetInputLevel(uint16_t rms) {
+    AudioLevel level;
+    level.rms = rms;
+    level.peak = rms;
+    Application::GetInstance().GetAudioService().SetInputLevel(level);
+}
+
+// 闪烁动画按自己的间隔出帧，没有变化的帧不刷新
+static void TestBlink() {
+    CircularStrip strip(GPIO_NUM_48, 4);
+    TakeFrames();
+    strip.Blink({4, 4, 32}, 500);
+    esp_timer_stub_advance(2000 * 1000);
+    CheckFrames({
+        "0: 040420 040420 040420 040420",
+        "500: 000000 000000 000000 000000",
+        "1000: 040420 040420 040420 040420",
+        "1500: 000000 000000 000000 000000",
+        "2000: 040420 040420 040420 040420",
+    });
+}
+
+// 电平表按 LEVEL_METER_INTERVAL_MS 更新，与下面动画的 500ms 间隔无关
+static void TestLevelMeterCadence() {
+    CircularStrip strip(GPIO_NUM_48, 4);
+    TakeFrames();
+    SetInputLevel(32767);
+    strip.EnableLevelMeter(true, {32, 32, 32});
+    strip.Blink({4, 4, 32}, 500);
+    esp_timer_stub_advance(100 * 1000);
+    SetInputLevel(0);
+    esp_timer_stub_advance(600 * 1000);
+    CheckFrames({
+        "2000: 040420 040420 040420 040420",
+        "2050: 202020 202020 202020 202020",
+        "2250: 202020 202020 202020 040420",
+        "2400: 202020 202020 040420 040420",
+        "2500: 202020 202020 000000 000000",
+        "2500: 202020 000000 000000 000000",
+        "2650: 000000 000000 000000 000000",
+    });
+
+    // 关闭后电平表立即从画面上去掉，之后只剩动画的帧
+    strip.EnableLevelMeter(false);
+    esp_timer_stub_advance(1000 * 1000);
+    CheckFrames({
+        "3000: 040420 040420 040420 040420",
+        "3500: 000000 000000 000000 000000",
+    });
+}
+
+// 状态切换：聆听时显示电平表，说话时停止，静止画面不再刷新
+static void TestStateChanges() {
+    auto& app = Application::GetInstance();
+    CircularStrip strip(GPIO_NUM_48, 4);
+    TakeFrames();
+    SetInputLevel(4096);
+    app.SetDeviceState(kDeviceStateListening);
+    strip.OnStateChanged();
+    esp_timer_stub_advance(200 * 1000);
+    SetInputLevel(0);
+    app.SetDeviceState(kDeviceStateSpeaking);
+    strip.OnStateChanged();
+    esp_timer_stub_advance(1000 * 1000);
+    CheckFrames({
+        "3700: 200404 200404 200404 200404",
+        "3750: 202020 202020 202020 200404",
+        "3900: 200404 200404 200404 200404",
+        "3900: 042004 042004 042004 042004",
+    });
+}
+
+int main() {
+    TestBlink();
+    TestLevelMeterCadence();
+    TestStateChanges();
+    printf("circular_strip_test passed\n");
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include "city_data.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 逐行比较 GetCity() 和生成表格用的 CSV：字符串完全相同，经纬度误差不超过定点数的半个单位
+int main() {
+    std::ifstream file(CITY_DATA_CSV);
+    CHECK(file.is_open());
+
+    std::string line;
+    std::getline(file, line);   // 表头
+    size_t index = 0;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            continue;
+        }
+        std::vector<std::string> fields;
+        std::stringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, ',')) {
+            fields.push_back(field);
+        }
+        CHECK_EQ(fields.size(), (size_t)7);
+        CHECK(index < city_count);
+
+        auto city = GetCity(index);
+        CHECK_EQ(std::string(city.id), fields[1]);
+        CHECK_EQ(std::string(city.admin), fields[2]);
+        CHECK_EQ(std::string(city.city), fields[3]);
+        CHECK_EQ(std::string(city.pinyin), fields[4]);
+        CHECK(std::fabs(city.lat - std::stod(fields[5])) <= 0.5e-6);
+        CHECK(std::fabs(city.lon - std::stod(fields[6])) <= 0.5e-6);
+        index++;
+    }
+    CHECK_EQ(index, city_count);
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include "city_data.h"
+#include "test_util.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+
+static bool SameCoordinates(double lat, double lon, const CityData& city) {
+    return lat == city.lat && lon == city.lon;
+}
+
+static const CityData* FindByCityName(const char* name) {
+    static CityData city;
+    for (size_t i = 0; i < city_count; i++) {
+        city = GetCity(i);
+        if (strcmp(city.city, name) == 0) {
+            return &city;
+        }
+    }
+    return nullptr;
+}
+
+// 每一行都能用自己的名称和行政归属找到，重名时找到的是同名的某一行
+static void TestEveryRow() {
+    for (size_t i = 0; i < city_count; i++) {
+        auto city = GetCity(i);
+        double lat, lon;
+        CHECK(FindCityByName(city.city, lat, lon));
+        CHECK(SameCoordinates(lat, lon, *FindByCityName(city.city)));
+        CHECK(FindCityByAdmin(city.admin, lat, lon));
+        CHECK(FindCityByPinyin(city.pinyin, lat, lon));
+    }
+}
+
+// weather_display.cc 把区名末尾的"区"去掉后再查，名称保留"区"的行也要能找到
+static void TestDistrictSuffix() {
+    static const std::string kDistrict = "区";
+    int rows = 0;
+    for (size_t i = 0; i < city_count; i++) {
+        auto city = GetCity(i);
+        std::string name = city.city;
+        if (!name.ends_with(kDistrict) || name.rfind('/') == std::string::npos) {
+            continue;
+        }
+        rows++;
+        double lat, lon;
+        std::string stripped = name.substr(0, name.size() - kDistrict.size());
+        CHECK(FindCityByName(stripped.c_str(), lat, lon));
+        // "安徽/黄山/黄山" 这样去掉后正好是地级市本身的，完整匹配优先
+        auto exact = FindByCityName(stripped.c_str());
+        CHECK(SameCoordinates(lat, lon, exact != nullptr ? *exact : *FindByCityName(city.city)));
+    }
+    CHECK(rows > 0);
+
+    double lat, lon;
+    CHECK(FindCityByName("山西/太原/小店", lat, lon));
+    CHECK(SameCoordinates(lat, lon, *FindByCityName("山西/太原/小店区")));
+    CHECK(FindCityByName("江苏/淮安/淮阴", lat, lon));
+    CHECK(SameCoordinates(lat, lon, *FindByCityName("江苏/淮安/淮阴区")));
+    // 多带了"区"的也能找到
+    CHECK(FindCityByName("广东/深圳/南山区", lat, lon));
+    CHECK(SameCoordinates(lat, lon, *FindByCityName("广东/深圳/南山")));
+}
+
+// 只给到地级市时返回地级市本身，未知的区退回到所在的地级市
+static void TestPrefecture() {
+    double lat, lon;
+    CHECK(FindCityByName("广东/深圳", lat, lon));
+    CHECK(SameCoordinates(lat, lon, *FindByCityName("广东/深圳/深圳")));
+    CHECK(FindCityByName("广东/深圳/未知", lat, lon));
+    CHECK(SameCoordinates(lat, lon, *FindByCityName("广东/深圳/深圳")));
+    CHECK(FindCityByName("北京", lat, lon));
+    CHECK(SameCoordinates(lat, lon, *FindByCityName("北京/北京")));
+    CHECK(FindCityByAdmin("广东省/深圳市/未知区", lat, lon));
+    CHECK(!FindCityByName("不存在", lat, lon));
+    CHECK(!FindCityByName("", lat, lon));
+    CHECK(FindCityByPinyin("BEIJING", lat, lon));
+    CHECK(!FindCityByPinyin("nowhere", lat, lon));
+}
+
+static void TestNearest() {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> lat_dist(0, 60), lon_dist(70, 140);
+    for (int k = 0; k < 5000; k++) {
+        double lat = lat_dist(rng), lon = lon_dist(rng);
+        CityData nearest;
+        CHECK(FindNearestCity(lat, lon, nearest));
+
+        double scale = std::cos(lat * M_PI / 180);
+        double best = INFINITY;
+        for (size_t i = 0; i < city_count; i++) {
+            auto city = GetCity(i);
+            double dlat = city.lat - lat, dlon = (city.lon - lon) * scale;
+            best = std::min(best, dlat * dlat + dlon * dlon);
+        }
+        double dlat = nearest.lat - lat, dlon = (nearest.lon - lon) * scale;
+        CHECK(std::fabs(dlat * dlat + dlon * dlon - best) < 1e-12);
+    }
+}
+
+// 和原来按 strstr 逐行扫描的查找比较耗时
+static void Benchmark() {
+    auto scan = [](const char* name, double& lat, double& lon) {
+        for (size_t i = 0; i < city_count; i++) {
+            auto city = GetCity(i);
+            if (strstr(city.city, name) != nullptr || strstr(name, city.city) != nullptr) {
+                lat = city.lat;
+                lon = city.lon;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    double lat, lon, sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < city_count; i++) {
+        scan(GetCity(i).city, lat, lon);
+        sink += lat;
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < city_count; i++) {
+        FindCityByName(GetCity(i).city, lat, lon);
+        sink += lat;
+    }
+    auto end = std::chrono::steady_clock::now();
+    printf("FindCityByName: scan %.2f us, index %.2f us per lookup (%g)\n",
+        std::chrono::duration<double, std::micro>(middle - start).count() / city_count,
+        std::chrono::duration<double, std::micro>(end - middle).count() / city_count, sink);
+}
+
+int main() {
+    TestEveryRow();
+    TestDistrictSuffix();
+    TestPrefecture();
+    TestNearest();
+    Benchmark();
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "display/emotion.h"
+#include "test_util.h"
+
+#include <cstring>
+#include <string>
+
+// 服务端可能下发的全部表情，独立于 kEmotionNames 维护，名字拼错或漏掉时这里会失败
+static const char* const kServerEmotions[] = {
+    "neutral", "happy", "laughing", "funny", "sad", "angry", "crying",
+    "loving", "embarrassed", "surprised", "shocked", "thinking", "winking", "cool",
+    "relaxed", "delicious", "kissy", "confident", "sleepy", "silly", "confused",
+};
+
+static void TestServerEmotions() {
+    CHECK_EQ(sizeof(kServerEmotions) / sizeof(kServerEmotions[0]), (size_t)kEmotionCount);
+    bool seen[kEmotionCount] = {};
+    for (const char* name : kServerEmotions) {
+        Emotion emotion = EmotionFromString(name);
+        CHECK(strcmp(name, "neutral") == 0 || emotion != kEmotionNeutral);
+        CHECK(strcmp(EmotionToString(emotion), name) == 0);
+        CHECK(!seen[emotion]);
+        seen[emotion] = true;
+    }
+}
+
+static void TestRoundTrip() {
+    for (int i = 0; i < kEmotionCount; i++) {
+        auto emotion = static_cast<Emotion>(i);
+        CHECK_EQ(EmotionFromString(EmotionToString(emotion)), emotion);
+    }
+    CHECK(strcmp(EmotionToString(kEmotionCount), "neutral") == 0);
+    CHECK(strcmp(EmotionToString(static_cast<Emotion>(0xFF)), "neutral") == 0);
+}
+
+// 未知名字、大小写不同、前后多余字符都回退到 neutral
+static void TestFallback() {
+    const char* const unknown[] = {
+        "", "unknown", "Happy", "HAPPY", "happy ", " happy", "happ", "happyy",
+        "sad\n", "neutral2", "love", "embarrased", "😊", "confused-face",
+    };
+    for (const char* name : unknown) {
+        CHECK_EQ(EmotionFromString(name), kEmotionNeutral);
+    }
+    CHECK_EQ(EmotionFromString(std::string_view("happy\0x", 7)), kEmotionNeutral);
+
+    // 与已知表情落在同一个槽位的其他字符串也不能误判
+    int collisions = 0;
+    std::string name = "aaaa";
+    for (int i = 0; i < 26 * 26 * 26 * 26; i++) {
+        int value = i;
+        for (int j = 0; j < 4; j++) {
+            name[j] = 'a' + value % 26;
+            value /= 26;
+        }
+        Emotion emotion = EmotionFromString(name);
+        if (emotion != kEmotionNeutral) {
+            CHECK(name == EmotionToString(emotion));
+            collisions++;
+        }
+    }
+    CHECK_EQ(collisions, 1);    // 四个小写字母的表情只有 cool
+}
+
+int main() {
+    TestServerEmotions();
+    TestRoundTrip();
+    TestFallback();
+    printf("emotion_test passed\n");
+    return 0;
+}
@@ -0,0 +1,253 @@
+#include "jpeg_budget.h"
+#include "test_util.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <jpeglib.h>
+
+// 上传预算和 chunk arena 与 esp32_camera.h 一致
+#define EXPLAIN_UPLOAD_BUDGET (48 * 1024)
+#define JPEG_CHUNK_SIZE 4096
+
+/*
+ * 主机上用 libjpeg 代替 fmt2jpg_cb：摄像头的 RGB565 是大端序，转换成 RGB888 后编码，
+ * 输出按 fmt2jpg_cb 的方式分小段回调，再像 OnJpegData 一样拷贝进 4KB 的块。
+ * 绝对耗时只代表主机，用来比较不同预算和帧尺寸之间的相对变化。
+ */
+struct Frame {
+    std::string name;
+    int width;
+    int height;
+    std::vector<uint16_t> pixels;   // Big endian RGB565, as the camera sends it
+};
+
+struct ChunkSink {
+    jpeg_destination_mgr manager;
+    uint8_t buffer[512];            // fmt2jpg_cb 也是用一个小的输出缓冲区分段回调
+    uint8_t chunk[JPEG_CHUNK_SIZE];
+    size_t chunk_len;
+    size_t total;
+    int chunks;
+
+    void Append(const uint8_t* data, size_t len) {
+        while (len > 0) {
+            size_t n = std::min(JPEG_CHUNK_SIZE - chunk_len, len);
+            memcpy(chunk + chunk_len, data, n);
+            chunk_len += n;
+            total += n;
+            data += n;
+            len -= n;
+            if (chunk_len == JPEG_CHUNK_SIZE) {
+                chunks++;
+                chunk_len = 0;
+            }
+        }
+    }
+};
+
+static size_t EncodeJpeg(const uint16_t* pixels, int width, int height, int quality, int* chunks) {
+    static ChunkSink sink;
+    sink.chunk_len = 0;
+    sink.total = 0;
+    sink.chunks = 0;
+    sink.manager.init_destination = [](j_compress_ptr cinfo) {
+        cinfo->dest->next_output_byte = sink.buffer;
+        cinfo->dest->free_in_buffer = sizeof(sink.buffer);
+    };
+    sink.manager.empty_output_buffer = [](j_compress_ptr cinfo) -> boolean {
+        sink.Append(sink.buffer, sizeof(sink.buffer));
+        cinfo->dest->next_output_byte = sink.buffer;
+        cinfo->dest->free_in_buffer = sizeof(sink.buffer);
+        return TRUE;
+    };
+    sink.manager.term_destination = [](j_compress_ptr cinfo) {
+        sink.Append(sink.buffer, sizeof(sink.buffer) - cinfo->dest->free_in_buffer);
+    };
+
+    jpeg_compress_struct cinfo;
+    jpeg_error_mgr error;
+    cinfo.err = jpeg_std_error(&error);
+    jpeg_create_compress(&cinfo);
+    cinfo.dest = &sink.manager;
+    cinfo.image_width = width;
+    cinfo.image_height = height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+
+    std::vector<uint8_t> row(width * 3);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        const uint16_t* in = pixels + cinfo.next_scanline * width;
+        for (int x = 0; x < width; x++) {
+            uint16_t pixel = __builtin_bswap16(in[x]);
+            row[x * 3] = ((pixel >> 11) & 0x1F) * 255 / 31;
+            row[x * 3 + 1] = ((pixel >> 5) & 0x3F) * 255 / 63;
+            row[x * 3 + 2] = (pixel & 0x1F) * 255 / 31;
+        }
+        JSAMPROW rows[1] = {row.data()};
+        jpeg_write_scanlines(&cinfo, rows, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    *chunks = sink.chunks + (sink.chunk_len > 0);
+    return sink.total;
+}
+
+// 没有录制的帧时合成一个室内场景：平滑的光照、几块有边缘的物体、传感器噪声
+static Frame SyntheticFrame(const char* name, int width, int height, int objects, double noise, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> sensor(0.0, noise);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    struct Box {
+        double x0, y0, x1, y1, r, g, b, stripes;
+    };
+    std::vector<Box> boxes;
+    for (int i = 0; i < objects; i++) {
+        double x = uniform(rng), y = uniform(rng);
+        boxes.push_back({x, y, x + 0.1 + 0.3 * uniform(rng), y + 0.1 + 0.3 * uniform(rng),
+                         255 * uniform(rng), 255 * uniform(rng), 255 * uniform(rng),
+                         uniform(rng) < 0.3 ? 10 + 40 * uniform(rng) : 0});
+    }
+
+    Frame frame{name, width, height, std::vector<uint16_t>(width * height)};
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            double u = (double)x / width, v = (double)y / height;
+            double light = 0.6 + 0.4 * std::cos(3.0 * (u - 0.3)) * std::cos(2.0 * (v - 0.4));
+            double r = 180 * light, g = 170 * light, b = 150 * light;
+            for (const auto& box : boxes) {
+                if (u >= box.x0 && u < box.x1 && v >= box.y0 && v < box.y1) {
+                    double shade = box.stripes > 0 && std::sin(box.stripes * u * M_PI * 2) > 0 ? 0.6 : 1.0;
+                    r = box.r * light * shade;
+                    g = box.g * light * shade;
+                    b = box.b * light * shade;
+                }
+            }
+            auto channel = [&](double value, int bits) {
+                int max = (1 << bits) - 1;
+                return (int)std::clamp(std::lround((value + sensor(rng)) * max / 255), 0L, (long)max);
+            };
+            uint16_t pixel = (channel(r, 5) << 11) | (channel(g, 6) << 5) | channel(b, 5);
+            frame.pixels[y * width + x] = __builtin_bswap16(pixel);
+        }
+    }
+    return frame;
+}
+
+// CAMERA_FRAMES_DIR 中的 <名字>_<宽>x<高>.rgb565 是从 fb_->buf 原样保存的帧
+static std::vector<Frame> LoadRecordedFrames(const char* directory) {
+    std::vector<Frame> frames;
+    DIR* dir = opendir(directory);
+    if (dir == nullptr) {
+        return frames;
+    }
+    while (auto entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        int width = 0, height = 0;
+        size_t underscore = name.rfind('_');
+        if (underscore == std::string::npos || name.size() < 7 || name.substr(name.size() - 7) != ".rgb565" ||
+            sscanf(name.c_str() + underscore + 1, "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0) {
+            continue;
+        }
+        FILE* file = fopen((std::string(directory) + "/" + name).c_str(), "rb");
+        if (file == nullptr) {
+            continue;
+        }
+        Frame frame{name, width, height, std::vector<uint16_t>(width * height)};
+        size_t read = fread(frame.pixels.data(), 2, frame.pixels.size(), file);
+        fclose(file);
+        if (read == frame.pixels.size()) {
+            frames.push_back(std::move(frame));
+        }
+    }
+    closedir(dir);
+    return frames;
+}
+
+static void TestDownscale() {
+    const uint16_t in[5 * 4] = {
+        1, 2, 3, 4, 5,
+        6, 7, 8, 9, 10,
+        11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20,
+    };
+    uint16_t out[4] = {};
+    DownscaleRgb565(in, 5, 4, 2, out);
+    CHECK(out[0] == 1 && out[1] == 3 && out[2] == 11 && out[3] == 13);
+}
+
+// 非 RGB565 帧不能缩小，预算很小时也只降低质量
+static void TestChooseWithoutDownscale() {
+    JpegBudget budget;
+    auto params = budget.Choose(1600, 1200, false, 1024);
+    CHECK_EQ(params.downscale, 1);
+    CHECK_EQ(params.quality, 60);
+    params = budget.Choose(320, 240, true, EXPLAIN_UPLOAD_BUDGET);
+    CHECK_EQ(params.downscale, 1);
+    CHECK_EQ(params.quality, 80);
+}
+
+// 连续拍照，预算估计逐步修正，稳定后上传大小应当在预算附近
+static void BenchmarkFrames(const std::vector<Frame>& frames) {
+    const int kShots = 5;
+    for (const auto& frame : frames) {
+        JpegBudget budget;
+        std::vector<uint16_t> scaled(frame.pixels.size());
+        for (int shot = 0; shot < kShots; shot++) {
+            auto params = budget.Choose(frame.width, frame.height, true, EXPLAIN_UPLOAD_BUDGET);
+            auto start = std::chrono::steady_clock::now();
+            const uint16_t* pixels = frame.pixels.data();
+            int width = frame.width, height = frame.height;
+            if (params.downscale > 1) {
+                DownscaleRgb565(pixels, width, height, params.downscale, scaled.data());
+                pixels = scaled.data();
+                width /= params.downscale;
+                height /= params.downscale;
+            }
+            int chunks = 0;
+            size_t size = EncodeJpeg(pixels, width, height, params.quality, &chunks);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            budget.Update(params, frame.width, frame.height, size);
+
+            printf("%-16s %4dx%-4d shot %d: quality %d, downscale %d, %6zu bytes (%2d chunks), %.2f bytes/pixel, %6.2f ms\n",
+                   frame.name.c_str(), frame.width, frame.height, shot, params.quality, params.downscale, size, chunks,
+                   budget.bytes_per_pixel(), ms);
+            // 估计收敛后，除非最小的一档仍然超出预算，否则不应该超出太多
+            bool smallest = params.quality == 40 && params.downscale == 2;
+            if (shot >= 2 && !smallest) {
+                CHECK(size <= EXPLAIN_UPLOAD_BUDGET * 5 / 4);
+            }
+        }
+    }
+}
+
+int main() {
+    TestDownscale();
+    TestChooseWithoutDownscale();
+
+    std::vector<Frame> frames;
+    if (const char* directory = getenv("CAMERA_FRAMES_DIR")) {
+        frames = LoadRecordedFrames(directory);
+        printf("%zu recorded frames from %s\n", frames.size(), directory);
+    }
+    if (frames.empty()) {
+        frames.push_back(SyntheticFrame("qvga_desk", 320, 240, 6, 2.0, 1));
+        frames.push_back(SyntheticFrame("vga_desk", 640, 480, 6, 2.0, 2));
+        frames.push_back(SyntheticFrame("vga_cluttered", 640, 480, 30, 4.0, 3));
+        frames.push_back(SyntheticFrame("svga_noisy", 800, 600, 20, 8.0, 4));
+        frames.push_back(SyntheticFrame("uxga_noisy", 1600, 1200, 40, 12.0, 5));
+    }
+    BenchmarkFrames(frames);
+    printf("jpeg_budget_bench passed\n");
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "lunar_calendar.h"
+#include "test_util.h"
+
+#include <chrono>
+#include <cstring>
+#include <string>
+
+using namespace std::chrono;
+
+// 与 lunar_table.py 相同的原始数据：最后4位为闰月，第5位为闰月是否为大月，前12位为各月大小
+static const unsigned int kLunarInfo[] = {
+    0x04bd8, 0x04ae0, 0x0a570, 0x054d5, 0x0d260, 0x0d950, 0x16554, 0x056a0, 0x09ad0, 0x055d2,
+    0x04ae0, 0x0a5b6, 0x0a4d0, 0x0d250, 0x1d255, 0x0b540, 0x0d6a0, 0x0ada2, 0x095b0, 0x14977,
+    0x04970, 0x0a4b0, 0x0b4b5, 0x06a50, 0x06d40, 0x1ab54, 0x02b60, 0x09570, 0x052f2, 0x04970,
+    0x06566, 0x0d4a0, 0x0ea50, 0x06e95, 0x05ad0, 0x02b60, 0x186e3, 0x092e0, 0x1c8d7, 0x0c950,
+    0x0d4a0, 0x1d8a6, 0x0b550, 0x056a0, 0x1a5b4, 0x025d0, 0x092d0, 0x0d2b2, 0x0a950, 0x0b557,
+    0x06ca0, 0x0b550, 0x15355, 0x04da0, 0x0a5b0, 0x14573, 0x052b0, 0x0a9a8, 0x0e950, 0x06aa0,
+    0x0aea6, 0x0ab50, 0x04b60, 0x0aae4, 0x0a570, 0x05260, 0x0f263, 0x0d950, 0x05b57, 0x056a0,
+    0x096d0, 0x04dd5, 0x04ad0, 0x0a4d0, 0x0d4d4, 0x0d250, 0x0d558, 0x0b540, 0x0b6a0, 0x195a6,
+    0x095b0, 0x049b0, 0x0a974, 0x0a4b0, 0x0b27a, 0x06a50, 0x06d40, 0x0af46, 0x0ab60, 0x09570,
+    0x04af5, 0x04970, 0x064b0, 0x074a3, 0x0ea50, 0x06b58, 0x055c0, 0x0ab60, 0x096d5, 0x092e0,
+    0x0c960, 0x0d954, 0x0d4a0, 0x0da50, 0x07552, 0x056a0, 0x0abb7, 0x025d0, 0x092d0, 0x0cab5,
+    0x0a950, 0x0b4a0, 0x0baa4, 0x0ad50, 0x055d9, 0x04ba0, 0x0a5b0, 0x15176, 0x052b0, 0x0a930,
+    0x07954, 0x06aa0, 0x0ad50, 0x05b52, 0x04b60, 0x0a6e6, 0x0a4e0, 0x0d260, 0x0ea65, 0x0d530,
+    0x05aa0, 0x076a3, 0x096d0, 0x04afb, 0x04ad0, 0x0a4d0, 0x1d0b6, 0x0d250, 0x0d520, 0x0dd45,
+    0x0b5a0, 0x056d0, 0x055b2, 0x049b0, 0x0a577, 0x0a4b0, 0x0aa50, 0x1b255, 0x06d20, 0x0ada0,
+    0x14b63, 0x09370, 0x049f8, 0x04970, 0x064b0, 0x168a6, 0x0ea50, 0x06b20, 0x1a6c4, 0x0aae0,
+    0x0a2e0, 0x0d2e3, 0x0c960, 0x0d557, 0x0d4a0, 0x0da50, 0x05d55, 0x056a0, 0x0a6d0, 0x055d4,
+    0x052d0, 0x0a9b8, 0x0a950, 0x0b4a0, 0x0b6a6, 0x0ad50, 0x055a0, 0x0aba4, 0x0a5b0, 0x052b0,
+    0x0b273, 0x06930, 0x07337, 0x06aa0, 0x0ad50, 0x14b55, 0x04b60, 0x0a570, 0x054e4, 0x0d160,
+    0x0e968, 0x0d520, 0x0daa0, 0x16aa6, 0x056d0, 0x04ae0, 0x0a9d4, 0x0a2d0, 0x0d150, 0x0f252,
+};
+
+// 从 1900-01-31（农历1900年正月初一）开始按原始数据逐日推算，和查表结果逐日比较
+static void TestAgainstLunarInfo() {
+    sys_days day = year(1900) / January / 31;
+    LunarCalendar::LunarDate lunar;
+    CHECK(!LunarCalendar::SolarToLunar(1900, 1, 30, lunar));
+
+    int count = 0;
+    for (int y = 0; y < 200; y++) {
+        unsigned info = kLunarInfo[y];
+        int leap = info & 0xf;
+        for (int m = 1; m <= 12; m++) {
+            for (int pass = 0; pass < (m == leap ? 2 : 1); pass++) {
+                bool is_leap = pass == 1;
+                int length = is_leap ? (info & 0x10000 ? 30 : 29) : (info & (0x10000 >> m) ? 30 : 29);
+                for (int d = 1; d <= length; d++, day += std::chrono::days(1), count++) {
+                    year_month_day date(day);
+                    CHECK(LunarCalendar::SolarToLunar((int)date.year(), (unsigned)date.month(), (unsigned)date.day(), lunar));
+                    CHECK_EQ(lunar.year, 1900 + y);
+                    CHECK_EQ(lunar.month, m);
+                    CHECK_EQ(lunar.day, d);
+                    CHECK_EQ(lunar.is_leap, is_leap);
+                }
+            }
+        }
+    }
+    year_month_day end(day);
+    CHECK(!LunarCalendar::SolarToLunar((int)end.year(), (unsigned)end.month(), (unsigned)end.day(), lunar));
+    printf("Checked %d days up to %d-%02u-%02u\n", count, (int)end.year(), (unsigned)end.month(), (unsigned)end.day());
+}
+
+// 公开发布的日期，不依赖上面的原始数据
+struct GoldenDate {
+    int year, month, day;
+    const char* lunar;
+    const char* festival;
+    const char* solar_term;
+};
+
+static const GoldenDate kGoldenDates[] = {
+    {1900, 1, 31, "农历庚子年正月初一", "春节", nullptr},
+    {1949, 10, 1, "农历己丑年八月初十", "国庆节", nullptr},
+    {1984, 11, 23, "农历甲子年闰十月初一", nullptr, nullptr},
+    {2000, 2, 5, "农历庚辰年正月初一", "春节", nullptr},
+    {2001, 5, 23, "农历辛巳年闰四月初一", nullptr, nullptr},
+    {2004, 3, 21, "农历甲申年闰二月初一", nullptr, nullptr},
+    {2006, 8, 24, "农历丙戌年闰七月初一", nullptr, nullptr},
+    {2008, 2, 7, "农历戊子年正月初一", "春节", nullptr},
+    {2009, 6, 23, "农历己丑年闰五月初一", nullptr, nullptr},
+    {2012, 5, 21, "农历壬辰年闰四月初一", nullptr, nullptr},
+    {2014, 10, 24, "农历甲午年闰九月初一", nullptr, nullptr},
+    {2017, 7, 23, "农历丁酉年闰六月初一", nullptr, nullptr},
+    {2020, 5, 23, "农历庚子年闰四月初一", nullptr, nullptr},
+    {2020, 6, 25, "农历庚子年五月初五", "端午节", nullptr},
+    {2023, 1, 22, "农历癸卯年正月初一", "春节", nullptr},
+    {2023, 3, 22, "农历癸卯年闰二月初一", nullptr, nullptr},
+    {2023, 4, 20, "农历癸卯年三月初一", nullptr, "谷雨"},
+    {2023, 12, 22, "农历癸卯年冬月初十", nullptr, "冬至"},
+    {2024, 2, 4, "农历癸卯年腊月廿五", nullptr, "立春"},
+    {2024, 2, 9, "农历癸卯年腊月三十", "除夕", nullptr},
+    {2024, 2, 10, "农历甲辰年正月初一", "春节", nullptr},
+    {2024, 2, 24, "农历甲辰年正月十五", "元宵节", nullptr},
+    {2024, 4, 4, "农历甲辰年二月廿六", nullptr, "清明"},
+    {2024, 6, 21, "农历甲辰年五月十六", nullptr, "夏至"},
+    {2024, 9, 17, "农历甲辰年八月十五", "中秋节", nullptr},
+    {2024, 12, 21, "农历甲辰年冬月廿一", nullptr, "冬至"},
+    {2025, 1, 28, "农历甲辰年腊月廿九", "除夕", nullptr},
+    {2025, 1, 29, "农历乙巳年正月初一", "春节", nullptr},
+    {2025, 2, 3, "农历乙巳年正月初六", nullptr, "立春"},
+    {2025, 7, 25, "农历乙巳年闰六月初一", nullptr, nullptr},
+    {2025, 8, 29, "农历乙巳年七月初七", "七夕", nullptr},
+    {2025, 10, 6, "农历乙巳年八月十五", "中秋节", nullptr},
+    {2026, 2, 17, "农历丙午年正月初一", "春节", nullptr},
+    {2033, 12, 22, "农历癸丑年闰冬月初一", nullptr, nullptr},
+};
+
+static bool SameName(const char* a, const char* b) {
+    return a == nullptr || b == nullptr ? a == b : strcmp(a, b) == 0;
+}
+
+static void TestGoldenDates() {
+    for (auto& golden : kGoldenDates) {
+        auto lunar = LunarCalendar::GetLunarDate(golden.year, golden.month, golden.day);
+        auto festival = LunarCalendar::GetFestival(golden.year, golden.month, golden.day);
+        auto solar_term = LunarCalendar::GetSolarTerm(golden.year, golden.month, golden.day);
+        if (lunar != golden.lunar || !SameName(festival, golden.festival) || !SameName(solar_term, golden.solar_term)) {
+            fprintf(stderr, "%d-%02d-%02d: %s %s %s\n", golden.year, golden.month, golden.day, lunar.c_str(),
+                festival ? festival : "-", solar_term ? solar_term : "-");
+        }
+        CHECK_EQ(lunar, std::string(golden.lunar));
+        CHECK(SameName(festival, golden.festival));
+        CHECK(SameName(solar_term, golden.solar_term));
+    }
+}
+
+// 每年正好 24 个节气，按顺序每月两个
+static void TestSolarTermsPerYear() {
+    for (int y = 1900; y <= 2100; y++) {
+        int count = 0;
+        for (sys_days day = year(y) / January / 1; day < sys_days(year(y + 1) / January / 1); day += std::chrono::days(1)) {
+            year_month_day date(day);
+            if (LunarCalendar::GetSolarTerm(y, (unsigned)date.month(), (unsigned)date.day()) != nullptr) {
+                count++;
+            }
+        }
+        CHECK_EQ(count, 24);
+    }
+    CHECK(LunarCalendar::GetSolarTerm(1899, 12, 22) == nullptr);
+    CHECK(LunarCalendar::GetSolarTerm(2101, 1, 5) == nullptr);
+}
+
+int main() {
+    TestAgainstLunarInfo();
+    TestGoldenDates();
+    TestSolarTermsPerYear();
+    return 0;
+}
@@ -0,0 +1,215 @@
+#include "mcp_server.h"
+#include "test_util.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * 工具调用的分发开销：按名字找到工具，把 JSON 参数绑定成 PropertyList，回调里按名字取参数，
+ * 再生成返回结果。和 McpServer 一样用 string_view 索引工具；JSON 解析用的是主机上的 cJSON 替身，
+ * 不计入耗时。
+ */
+#define TOOL_COUNT 64
+#define ITERATIONS 20000
+
+static const char* kPropertyNames[] = {
+    "volume", "brightness", "theme", "question", "steps", "speed", "direction", "enabled",
+};
+
+struct BenchTool {
+    std::unique_ptr<McpTool> tool;
+    cJSON* arguments;
+    std::vector<std::string> names;
+};
+
+static int PropertySum(const PropertyRef& property) {
+    if (property.type() == kPropertyTypeInteger) {
+        return property.value<int>();
+    } else if (property.type() == kPropertyTypeString) {
+        return property.value<std::string>().size();
+    }
+    return property.value<bool>() ? 1 : 0;
+}
+
+static int IndexedSum(const PropertyList& bound, const std::vector<std::string>& names) {
+    int sum = 0;
+    for (const auto& name : names) {
+        sum += PropertySum(bound[name]);
+    }
+    return sum;
+}
+
+// 改动前绑定列表的查找方式：逐个比较参数定义的名字，作为对照
+static int LinearSum(const PropertyList& schema, const PropertyList& bound, const std::vector<std::string>& names) {
+    int sum = 0;
+    for (const auto& name : names) {
+        auto it = bound.begin();
+        for (auto property : schema) {
+            if (property.name() == name) {
+                sum += PropertySum(*it);
+                break;
+            }
+            ++it;
+        }
+    }
+    return sum;
+}
+
+static std::vector<BenchTool> MakeTools() {
+    std::vector<BenchTool> tools;
+    for (int i = 0; i < TOOL_COUNT; i++) {
+        BenchTool bench;
+        PropertyList properties;
+        std::string arguments = "{";
+        int count = i % 7;
+        for (int j = 0; j < count; j++) {
+            std::string name = kPropertyNames[(i + j) % 8];
+            if (j % 3 != 2 && arguments.size() > 1) {
+                arguments += ",";
+            }
+            switch (j % 3) {
+            case 0:
+                properties.AddProperty(Property(name, kPropertyTypeInteger, 0, 1000));
+                arguments += "\"" + name + "\":" + std::to_string(i * 10 + j);
+                break;
+            case 1:
+                properties.AddProperty(Property(name, kPropertyTypeString));
+                arguments += "\"" + name + "\":\"value " + std::to_string(i) + "\"";
+                break;
+            default:
+                // 可选参数，调用时不给出，使用默认值
+                properties.AddProperty(Property(name, kPropertyTypeBoolean, true));
+                break;
+            }
+            bench.names.push_back(name);
+        }
+        arguments += "}";
+        bench.arguments = cJSON_Parse(arguments.c_str());
+        CHECK(bench.arguments != nullptr);
+
+        auto names = bench.names;
+        bench.tool = std::make_unique<McpTool>("self.bench.tool_" + std::to_string(i), "Benchmark tool", properties,
+            [names](const PropertyList& properties) -> ReturnValue {
+                return IndexedSum(properties, names);
+            });
+        tools.push_back(std::move(bench));
+    }
+    return tools;
+}
+
+static void TestBoundList() {
+    PropertyList schema({
+        Property("volume", kPropertyTypeInteger, 0, 100),
+        Property("theme", kPropertyTypeString, std::string("dark")),
+        Property("enabled", kPropertyTypeBoolean),
+    });
+    cJSON* arguments = cJSON_Parse("{\"volume\": 42, \"enabled\": false}");
+    auto bound = schema.Bind(arguments);
+    cJSON_Delete(arguments);
+
+    CHECK_EQ(bound["volume"].value<int>(), 42);
+    CHECK(bound["theme"].value<std::string>() == "dark");
+    CHECK_EQ(bound["enabled"].value<bool>(), false);
+    CHECK(schema["theme"].value<std::string>() == "dark");
+
+    // 绑定后的列表按定义顺序遍历，给出本次调用的值
+    std::vector<std::string> names;
+    for (auto property : bound) {
+        names.push_back(property.name());
+    }
+    CHECK(names == std::vector<std::string>({"volume", "theme", "enabled"}));
+    auto it = bound.begin();
+    CHECK_EQ((*it).value<int>(), 42);
+
+    bool thrown = false;
+    try {
+        bound["missing"];
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    // 缺少必需参数、超出范围时绑定失败
+    thrown = false;
+    cJSON* out_of_range = cJSON_Parse("{\"volume\": 101, \"enabled\": true}");
+    try {
+        schema.Bind(out_of_range);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    cJSON_Delete(out_of_range);
+    CHECK(thrown);
+    thrown = false;
+    try {
+        schema.Bind(nullptr);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+int main() {
+    TestBoundList();
+
+    auto tools = MakeTools();
+    std::unordered_map<std::string_view, McpTool*> tool_index;
+    for (auto& bench : tools) {
+        tool_index.emplace(bench.tool->name(), bench.tool.get());
+    }
+    std::vector<std::string> call_names;
+    for (auto& bench : tools) {
+        call_names.push_back(bench.tool->name());
+    }
+
+    using Clock = std::chrono::steady_clock;
+    int64_t lookup_ns = 0, bind_ns = 0, call_ns = 0;
+    size_t checksum = 0;
+    for (int n = 0; n < ITERATIONS; n++) {
+        size_t i = (n * 37) % TOOL_COUNT;
+        auto start = Clock::now();
+        auto it = tool_index.find(call_names[i]);
+        CHECK(it != tool_index.end());
+        auto tool = it->second;
+        auto found = Clock::now();
+        auto bound = tool->properties().Bind(tools[i].arguments);
+        auto bound_time = Clock::now();
+        auto result = tool->Call(bound);
+        auto end = Clock::now();
+        lookup_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(found - start).count();
+        bind_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(bound_time - found).count();
+        call_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - bound_time).count();
+        checksum += result.size();
+    }
+
+    // 只比较回调里按名字取参数的部分
+    int64_t indexed_ns = 0, linear_ns = 0;
+    for (int n = 0; n < ITERATIONS; n++) {
+        size_t i = (n * 37) % TOOL_COUNT;
+        const auto& schema = tools[i].tool->properties();
+        auto bound = schema.Bind(tools[i].arguments);
+        auto start = Clock::now();
+        int indexed = IndexedSum(bound, tools[i].names);
+        auto middle = Clock::now();
+        int linear = LinearSum(schema, bound, tools[i].names);
+        auto end = Clock::now();
+        CHECK_EQ(indexed, linear);
+        indexed_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(middle - start).count();
+        linear_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - middle).count();
+    }
+
+    printf("%d tools, %d calls: lookup %.0f ns, bind %.0f ns, call %.0f ns per call (checksum %zu)\n",
+           TOOL_COUNT, ITERATIONS, (double)lookup_ns / ITERATIONS, (double)bind_ns / ITERATIONS,
+           (double)call_ns / ITERATIONS, checksum);
+    printf("argument access: index %.0f ns, linear scan %.0f ns per call\n",
+           (double)indexed_ns / ITERATIONS, (double)linear_ns / ITERATIONS);
+
+    for (auto& bench : tools) {
+        cJSON_Delete(bench.arguments);
+    }
+    printf("mcp_dispatch_bench passed\n");
+    return 0;
+}
@@ -0,0 +1,444 @@
+#include "ota_download.h"
+#include "settings.h"
+#include "test_util.h"
+
+#include <esp_app_desc.h>
+#include <esp_app_format.h>
+#include <esp_timer.h>
+#include <nvs.h>
+#include <spi_flash_mmap.h>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+/*
+ * 用假的 HTTP 服务器驱动 OtaDownloader：在未对齐的位置断开连接、拒绝重连、忽略 Range、
+ * 中途换成另一个大小的镜像，最后比较分区内容和 SHA-256 是否与源镜像一致
+ */
+struct FakeServer {
+    std::vector<uint8_t> image;
+    bool supports_range = true;
+    int status_override = 0;
+    std::deque<size_t> drops;       // Absolute offsets where the connection breaks, each used once
+    int refuse_per_drop = 0;        // Open() calls that fail after each break
+    size_t max_read = 1460;
+    int64_t us_per_byte = 10;       // 100KB/s on the fake clock
+
+    int refuse = 0;
+    int opens = 0;
+    size_t bytes_sent = 0;
+    std::vector<std::string> ranges;
+    std::vector<int> statuses;
+};
+
+class FakeHttp : public Http {
+public:
+    FakeHttp(FakeServer& server) : server_(server) {}
+
+    void SetTimeout(int) override {}
+    void SetHeader(const std::string& key, const std::string& value) override {
+        if (key == "Range") {
+            range_ = value;
+        }
+    }
+    void SetContent(std::string&&) override {}
+
+    bool Open(const std::string& method, const std::string&) override {
+        CHECK(method == "GET");
+        server_.opens++;
+        server_.ranges.push_back(range_);
+        if (server_.refuse > 0) {
+            server_.refuse--;
+            server_.statuses.push_back(0);
+            return false;
+        }
+        size_t start = 0;
+        if (!range_.empty()) {
+            CHECK(sscanf(range_.c_str(), "bytes=%zu-", &start) == 1);
+        }
+        if (server_.status_override != 0) {
+            status_ = server_.status_override;
+        } else if (start > 0 && server_.supports_range) {
+            status_ = 206;
+            position_ = start;
+        } else {
+            status_ = 200;
+            position_ = 0;
+        }
+        server_.statuses.push_back(status_);
+        open_ = true;
+        return true;
+    }
+
+    void Close() override {
+        open_ = false;
+    }
+
+    int Read(char* buffer, size_t buffer_size) override {
+        if (!open_) {
+            return -1;
+        }
+        auto& drops = server_.drops;
+        if (!drops.empty() && drops.front() == position_) {
+            drops.pop_front();
+            server_.refuse = server_.refuse_per_drop;
+            open_ = false;
+            return -1;
+        }
+        size_t len = std::min({buffer_size, server_.max_read, server_.image.size() - position_});
+        if (!drops.empty() && drops.front() > position_) {
+            len = std::min(len, drops.front() - position_);
+        }
+        memcpy(buffer, server_.image.data() + position_, len);
+        position_ += len;
+        server_.bytes_sent += len;
+        esp_timer_stub_advance(len * server_.us_per_byte);
+        return len;
+    }
+
+    int Write(const char*, size_t) override {
+        return -1;
+    }
+    int GetStatusCode() override {
+        return status_;
+    }
+    std::string GetResponseHeader(const std::string&) const override {
+        return "";
+    }
+    size_t GetBodyLength() override {
+        return status_ == 206 ? server_.image.size() - position_ : server_.image.size();
+    }
+    std::string ReadAll() override {
+        return "";
+    }
+
+private:
+    FakeServer& server_;
+    std::string range_;
+    bool open_ = false;
+    int status_ = 0;
+    size_t position_ = 0;
+};
+
+class FakeNetwork : public NetworkInterface {
+public:
+    FakeNetwork(FakeServer& server) : server_(server) {}
+
+    std::unique_ptr<Http> CreateHttp(int) override {
+        return std::make_unique<FakeHttp>(server_);
+    }
+
+private:
+    FakeServer& server_;
+};
+
+static const char* kUrl = "http://ota.example.com/xiaozhi.bin";
+static esp_partition_t partition = {0x110000, 1024 * 1024, "ota_0"};
+
+static std::vector<uint8_t> MakeImage(size_t size, const char* version, uint32_t seed) {
+    std::vector<uint8_t> image(size);
+    for (auto& byte : image) {
+        seed = seed * 1103515245 + 12345;
+        byte = seed >> 16;
+    }
+    esp_app_desc_t desc = {};
+    strcpy(desc.version, version);
+    memcpy(image.data() + sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t), &desc, sizeof(desc));
+    return image;
+}
+
+static std::vector<uint8_t> Sha256(const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> digest(32);
+    mbedtls_sha256(data.data(), data.size(), digest.data(), 0);
+    return digest;
+}
+
+static bool PartitionHolds(const std::vector<uint8_t>& image) {
+    auto& flash = esp_partition_stub_data(&partition);
+    return memcmp(flash.data(), image.data(), image.size()) == 0;
+}
+
+static int SavedOffset() {
+    Settings settings("ota", false);
+    return settings.GetInt("offset", -1);
+}
+
+// 重启：等延迟提交写入 NVS 后丢弃内存中的设置，flash 保留
+static void Reboot() {
+    esp_timer_stub_advance(10 * 1000 * 1000);
+    Settings::Reset();
+    freertos_stub_delayed_ticks = 0;
+    esp_partition_stub_counters() = {};
+}
+
+// 全新的设备：NVS 为空，分区内容未擦除
+static void PowerOn() {
+    Settings::Reset();
+    nvs_stub_reset();
+    esp_partition_stub_data(&partition).assign(partition.size, 0x5A);
+    esp_partition_stub_on_write(nullptr);
+    freertos_stub_delayed_ticks = 0;
+    esp_partition_stub_counters() = {};
+}
+
+// 每次写入前检查续传位置：落后已写入的位置不超过保存间隔，两次保存之间至少相隔一个间隔
+struct SaveTracker {
+    std::vector<int> saved;
+    bool ok = true;
+
+    void Attach() {
+        esp_partition_stub_on_write([this](size_t offset, size_t) {
+            int value = SavedOffset();
+            if (value < 0 || offset - value >= OTA_RESUME_SAVE_INTERVAL) {
+                ok = false;
+            }
+            if (saved.empty() || saved.back() != value) {
+                saved.push_back(value);
+            }
+        });
+    }
+
+    void Check() {
+        esp_partition_stub_on_write(nullptr);
+        CHECK(ok);
+        for (size_t i = 1; i < saved.size(); i++) {
+            CHECK(saved[i] - saved[i - 1] >= OTA_RESUME_SAVE_INTERVAL);
+            CHECK(saved[i] % SPI_FLASH_SEC_SIZE == 0);
+        }
+    }
+};
+
+static void TestSha256() {
+    static const uint8_t abc[32] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+    };
+    CHECK(memcmp(Sha256({'a', 'b', 'c'}).data(), abc, 32) == 0);
+
+    // 分段更新与一次性计算一致
+    auto data = MakeImage(10000, "x", 7);
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    for (size_t pos = 0; pos < data.size(); pos += 777) {
+        mbedtls_sha256_update(&ctx, data.data() + pos, std::min<size_t>(777, data.size() - pos));
+    }
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&ctx, digest);
+    CHECK(memcmp(digest, Sha256(data).data(), 32) == 0);
+}
+
+// 支持 Range 的服务器：每次断开后从已收到的字节处以 206 续传，不重复下载
+static void TestResumeWithRange() {
+    PowerOn();
+    FakeServer server;
+    server.image = MakeImage(300 * 1024 + 777, "2.0.0", 1);
+    server.drops = {5001, 70001, 133333, 299999};
+    FakeNetwork network(server);
+    SaveTracker tracker;
+    tracker.Attach();
+
+    OtaDownloader downloader(&network, &partition, kUrl);
+    int last_progress = -1;
+    downloader.OnProgress([&](int progress, size_t) {
+        CHECK(progress >= last_progress);
+        last_progress = progress;
+    });
+    uint8_t sha256[32];
+    CHECK(downloader.Download(sha256));
+    tracker.Check();
+
+    CHECK(memcmp(sha256, Sha256(server.image).data(), 32) == 0);
+    CHECK(PartitionHolds(server.image));
+    CHECK_EQ(last_progress, 100);
+    CHECK_EQ(server.bytes_sent, server.image.size());
+    CHECK(server.ranges == std::vector<std::string>({"", "bytes=5001-", "bytes=70001-", "bytes=133333-", "bytes=299999-"}));
+    CHECK(server.statuses == std::vector<int>({200, 206, 206, 206, 206}));
+    // 每次重连都成功，重试计数复位，只等待第一档退避
+    CHECK_EQ(freertos_stub_delayed_ticks, (TickType_t)4 * pdMS_TO_TICKS(1000));
+    CHECK(tracker.saved.size() >= 4);
+    CHECK(downloader.stats().block_size % SPI_FLASH_SEC_SIZE == 0);
+    CHECK(downloader.stats().block_size >= OTA_BUFFER_MIN_SIZE);
+}
+
+// 服务器忽略 Range 时返回 200 和完整内容，丢弃已经写入的部分再继续
+static void TestServerIgnoresRange() {
+    PowerOn();
+    FakeServer server;
+    server.image = MakeImage(250 * 1024 + 3, "2.0.0", 2);
+    server.supports_range = false;
+    server.drops = {40000, 200001};
+    FakeNetwork network(server);
+
+    OtaDownloader downloader(&network, &partition, kUrl);
+    uint8_t sha256[32];
+    CHECK(downloader.Download(sha256));
+
+    CHECK(memcmp(sha256, Sha256(server.image).data(), 32) == 0);
+    CHECK(PartitionHolds(server.image));
+    CHECK(server.ranges == std::vector<std::string>({"", "bytes=40000-", "bytes=200001-"}));
+    CHECK(server.statuses == std::vector<int>({200, 200, 200}));
+    CHECK_EQ(server.bytes_sent, server.image.size() + 40000 + 200001);
+}
+
+// 服务器一直连不上时按 1s、2s、4s… 退避，超过重试次数后放弃
+static void TestRetryBackoff() {
+    PowerOn();
+    FakeServer server;
+    server.image = MakeImage(200 * 1024 + 5, "2.0.0", 3);
+    server.drops = {100003, 150001};
+    server.refuse_per_drop = 3;
+    FakeNetwork network(server);
+
+    uint8_t sha256[32];
+    {
+        OtaDownloader downloader(&network, &partition, kUrl);
+        CHECK(downloader.Download(sha256));
+    }
+    CHECK(PartitionHolds(server.image));
+    CHECK(memcmp(sha256, Sha256(server.image).data(), 32) == 0);
+    // 1s + 2s + 4s 之后第四次重连成功，下一次断开重新从 1s 开始
+    CHECK_EQ(freertos_stub_delayed_ticks, (TickType_t)2 * pdMS_TO_TICKS(1000 + 2000 + 4000 + 8000));
+    CHECK_EQ(server.opens, 1 + 4 + 4);
+
+    PowerOn();
+    server = FakeServer();
+    server.image = MakeImage(200 * 1024 + 5, "2.0.0", 3);
+    server.drops = {100003};
+    server.refuse_per_drop = 100;
+    {
+        OtaDownloader downloader(&network, &partition, kUrl);
+        CHECK(!downloader.Download(sha256));
+    }
+    TickType_t total = 0;
+    for (int i = 0; i < OTA_MAX_RETRIES; i++) {
+        total += pdMS_TO_TICKS(1000 << i);
+    }
+    CHECK_EQ(freertos_stub_delayed_ticks, total);
+    CHECK_EQ(server.opens, 1 + OTA_MAX_RETRIES);
+}
+
+// 下载到一半断电，重启后从 NVS 中保存的位置续传，已写入的部分从 flash 读回计算哈希
+static void TestResumeAfterReboot() {
+    for (bool corrupt : {false, true}) {
+        PowerOn();
+        FakeServer server;
+        server.image = MakeImage(400 * 1024 + 99, "2.0.0", 4);
+        server.drops = {210011};
+        server.refuse_per_drop = 100;
+        FakeNetwork network(server);
+        uint8_t sha256[32];
+        {
+            OtaDownloader downloader(&network, &partition, kUrl);
+            CHECK(!downloader.Download(sha256));
+        }
+        int saved = SavedOffset();
+        CHECK(saved >= OTA_RESUME_SAVE_INTERVAL);
+        CHECK(saved <= 210011);
+        CHECK(210011 - saved < OTA_RESUME_SAVE_INTERVAL + OTA_BUFFER_SIZE);
+        CHECK_EQ(saved % SPI_FLASH_SEC_SIZE, 0);
+        if (corrupt) {
+            esp_partition_stub_data(&partition)[saved / 2] ^= 0x01;
+        }
+
+        Reboot();
+        server.drops.clear();
+        server.refuse = 0;
+        server.ranges.clear();
+        server.bytes_sent = 0;
+        SaveTracker tracker;
+        tracker.Attach();
+        OtaDownloader downloader(&network, &partition, kUrl);
+        CHECK(downloader.Download(sha256));
+        tracker.Check();
+        CHECK(server.ranges == std::vector<std::string>({"bytes=" + std::to_string(saved) + "-"}));
+        CHECK_EQ(server.bytes_sent, server.image.size() - saved);
+        CHECK_EQ(esp_partition_stub_counters().bytes_read, (size_t)saved);
+        CHECK_EQ(tracker.saved.front(), saved);
+        // 读回的是 flash 里真实的数据，损坏的字节会让哈希与源镜像不一致
+        bool matches = memcmp(sha256, Sha256(server.image).data(), 32) == 0;
+        CHECK(matches == !corrupt);
+        CHECK(PartitionHolds(server.image) == !corrupt);
+    }
+}
+
+// 保存的续传记录属于另一个大小的镜像时，从头重新下载
+static void TestSizeChangedRestarts() {
+    PowerOn();
+    FakeServer server;
+    server.image = MakeImage(300 * 1024, "2.0.0", 5);
+    server.drops = {180000};
+    server.refuse_per_drop = 100;
+    FakeNetwork network(server);
+    uint8_t sha256[32];
+    {
+        OtaDownloader downloader(&network, &partition, kUrl);
+        CHECK(!downloader.Download(sha256));
+    }
+    int saved = SavedOffset();
+    CHECK(saved > 0);
+
+    Reboot();
+    server = FakeServer();
+    server.image = MakeImage(320 * 1024 + 17, "2.0.1", 6);
+    OtaDownloader downloader(&network, &partition, kUrl);
+    CHECK(downloader.Download(sha256));
+    CHECK(server.ranges == std::vector<std::string>({"bytes=" + std::to_string(saved) + "-", ""}));
+    CHECK(server.statuses == std::vector<int>({206, 200}));
+    CHECK_EQ(esp_partition_stub_counters().bytes_read, (size_t)0);
+    CHECK(memcmp(sha256, Sha256(server.image).data(), 32) == 0);
+    CHECK(PartitionHolds(server.image));
+}
+
+static void TestRejectedDownloads() {
+    PowerOn();
+    FakeServer server;
+    server.image = MakeImage(100 * 1024, "2.0.0", 7);
+    server.status_override = 404;
+    FakeNetwork network(server);
+    uint8_t sha256[32];
+    {
+        OtaDownloader downloader(&network, &partition, kUrl);
+        CHECK(!downloader.Download(sha256));
+    }
+    CHECK_EQ(esp_partition_stub_counters().bytes_written, (size_t)0);
+
+    // 和正在运行的版本相同：不写入，并清除续传记录
+    PowerOn();
+    server = FakeServer();
+    server.image = MakeImage(100 * 1024, esp_app_get_description()->version, 8);
+    {
+        OtaDownloader downloader(&network, &partition, kUrl);
+        CHECK(!downloader.Download(sha256));
+    }
+    CHECK_EQ(esp_partition_stub_counters().bytes_written, (size_t)0);
+    CHECK_EQ(SavedOffset(), -1);
+
+    // 镜像比分区还大
+    PowerOn();
+    server = FakeServer();
+    server.image = MakeImage(partition.size + 1, "2.0.0", 9);
+    {
+        OtaDownloader downloader(&network, &partition, kUrl);
+        CHECK(!downloader.Download(sha256));
+    }
+    CHECK_EQ(esp_partition_stub_counters().bytes_written, (size_t)0);
+}
+
+int main() {
+    // Settings 的提交任务要在启用线程之前创建，这样提交由 esp_timer 回调同步完成
+    Settings::Reset();
+    freertos_stub_threads = true;
+    TestSha256();
+    TestResumeWithRange();
+    TestServerIgnoresRange();
+    TestRetryBackoff();
+    TestResumeAfterReboot();
+    TestSizeChangedRestarts();
+    TestRejectedDownloads();
+    printf("ota_resume_test passed\n");
+    return 0;
+}
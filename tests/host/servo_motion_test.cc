@@ -0,0 +1,232 @@
+#include "servo_motion.h"
+#include "otto_movements.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+// 与浮点参考比较定点数的正弦表、最小加加速度曲线和振荡轨迹
+static void TestTrajectoryAccuracy() {
+    double sine_error = 0.0;
+    for (uint64_t phase = 0; phase < (1ull << 32); phase += 9973) {
+        double reference = 32767.0 * std::sin(2 * M_PI * phase / 4294967296.0);
+        sine_error = std::max(sine_error, std::fabs(ServoSine(phase) - reference));
+    }
+    CHECK(sine_error < 8.0);    // Q15, about 0.02 degrees on a 90 degree swing
+
+    double min_jerk_error = 0.0;
+    for (int progress = 0; progress <= 65536; progress++) {
+        double t = progress / 65536.0;
+        double reference = 65536.0 * t * t * t * (10 - 15 * t + 6 * t * t);
+        min_jerk_error = std::max(min_jerk_error, std::fabs(ServoMinJerk(progress) - reference));
+    }
+    CHECK(min_jerk_error < 16.0);   // Q16, under 0.05 degrees on a full 180 degree move
+    CHECK_EQ(ServoMinJerk(0), 0);
+    CHECK_EQ(ServoMinJerk(65536), 65536);
+
+    // 走路时腿和脚相差 90 度的振荡
+    const int period_ms = 1000;
+    const int amplitude[4] = {30, 30, 30, 30};
+    const int center[4] = {90, 90, 95, 85};
+    const double phase[4] = {0, 0, -M_PI / 2, -M_PI / 2};
+    ServoSegment segment;
+    segment.type = kServoSegmentOscillate;
+    segment.ticks = 300;
+    segment.mask = 0x0F;
+    segment.phase_step = (uint64_t(1) << 32) * SERVO_MOTION_TICK_MS / period_ms;
+    for (int i = 0; i < 4; i++) {
+        segment.position[i] = center[i];
+        segment.amplitude[i] = amplitude[i];
+        double cycle = phase[i] / (2 * M_PI);
+        segment.phase[i] = std::lround((cycle - std::floor(cycle)) * 65536);
+    }
+    int32_t start[4] = {}, positions[4];
+    double oscillation_error = 0.0;
+    for (uint32_t tick = 1; tick <= segment.ticks; tick++) {
+        ServoSegmentPositions(segment, start, 4, tick, positions);
+        for (int i = 0; i < 4; i++) {
+            double reference = center[i] + amplitude[i] *
+                std::sin(2 * M_PI * (tick - 1) * SERVO_MOTION_TICK_MS / period_ms + phase[i]);
+            oscillation_error = std::max(oscillation_error, std::fabs(positions[i] / 256.0 - reference));
+        }
+    }
+    CHECK(oscillation_error < 0.01);
+
+    // 移动单调地到达目标，中点正好在一半
+    ServoSegment move;
+    move.type = kServoSegmentMove;
+    move.ticks = 50;
+    move.mask = 0x01;
+    move.position[0] = 150;
+    int32_t from[1] = {90 * 256};
+    int32_t last = from[0];
+    for (uint32_t tick = 1; tick <= move.ticks; tick++) {
+        ServoSegmentPositions(move, from, 1, tick, positions);
+        CHECK(positions[0] >= last);
+        last = positions[0];
+        if (tick == 25) {
+            CHECK_EQ(positions[0], 120 * 256);
+        }
+    }
+    CHECK_EQ(last, 150 * 256);
+}
+
+// 每 50ms 记录一次两个舵机通道的占空比
+static std::vector<std::string> RunAndSample(ServoMotion& motion, int duration_ms) {
+    std::vector<std::string> samples;
+    for (int time_ms = 0; time_ms < duration_ms; time_ms += 50) {
+        esp_timer_stub_advance(50 * 1000);
+        char text[32];
+        snprintf(text, sizeof(text), "%4d: %u %u", time_ms + 50, ledc_stub().duty[LEDC_CHANNEL_1],
+                 ledc_stub().duty[LEDC_CHANNEL_1 + 1]);
+        samples.push_back(text);
+    }
+    return samples;
+}
+
+static void CheckSamples(const std::vector<std::string>& samples, const std::vector<std::string>& expected) {
+    if (samples != expected) {
+        fprintf(stderr, "Samples do not match, got:\n");
+        for (const auto& sample : samples) {
+            fprintf(stderr, "        \"%s\",\n", sample.c_str());
+        }
+        exit(1);
+    }
+}
+
+// 13 位占空比，20ms 周期下 0 度为 500us，180 度为 2500us
+static uint32_t Duty(int degrees) {
+    int64_t pulse = SERVO_MIN_PULSEWIDTH_US * 256 +
+        (int64_t)degrees * 256 * (SERVO_MAX_PULSEWIDTH_US - SERVO_MIN_PULSEWIDTH_US) / 180;
+    return (pulse * ((1 << LEDC_TIMER_13_BIT) - 1) + SERVO_PWM_PERIOD_US * 128) / (SERVO_PWM_PERIOD_US * 256);
+}
+
+// 移动、保持、振荡、再移动回中间，整段轨迹与黄金输出逐点比较
+static void TestGoldenTrajectory() {
+    ServoMotion motion(2);
+    motion.Attach(0, 10);
+    motion.Attach(1, 11);
+    ledc_stub().writes = 0;
+
+    const int targets[2] = {150, 30};
+    const int amplitude[2] = {30, 15};
+    const int center[2] = {120, 60};
+    const double phase[2] = {0, M_PI / 2};
+    const int home[2] = {90, 90};
+    CHECK(motion.Move(targets, 500));
+    CHECK(motion.Hold(200));
+    CHECK(motion.Oscillate(amplitude, center, phase, 400, 1.5f));
+    CHECK(motion.Move(home, 300));
+    CHECK_EQ(motion.GetPosition(0), 90);
+    CHECK(motion.IsBusy());
+
+    CheckSamples(RunAndSample(motion, 1700), {
+        "  50: 617 612",
+        " 100: 630 599",
+        " 150: 659 570",
+        " 200: 701 528",
+        " 250: 751 478",
+        " 300: 801 428",
+        " 350: 843 386",
+        " 400: 872 357",
+        " 450: 885 344",
+        " 500: 887 341",
+        " 550: 887 341",
+        " 600: 887 341",
+        " 650: 887 341",
+        " 700: 887 341",
+        " 750: 831 533",
+        " 800: 886 488",
+        " 850: 861 438",
+        " 900: 772 410",
+        " 950: 671 423",
+        "1000: 616 467",
+        "1050: 640 518",
+        "1100: 729 545",
+        "1150: 831 533",
+        "1200: 886 488",
+        "1250: 861 438",
+        "1300: 772 410",
+        "1350: 767 418",
+        "1400: 739 453",
+        "1450: 693 512",
+        "1500: 647 572",
+        "1550: 620 607",
+        "1600: 614 614",
+        "1650: 614 614",
+        "1700: 614 614",
+    });
+
+    // 正好停在目标上，定时器空闲，只写入变化了的占空比
+    CHECK(!motion.IsBusy());
+    CHECK_EQ(ledc_stub().duty[LEDC_CHANNEL_1], Duty(90));
+    CHECK_EQ(ledc_stub().duty[LEDC_CHANNEL_1 + 1], Duty(90));
+    CHECK(ledc_stub().writes < 170 * 2);
+    int writes = ledc_stub().writes;
+    esp_timer_stub_advance(1000 * 1000);
+    CHECK_EQ(ledc_stub().writes, writes);
+}
+
+// 取消后舵机停在原地，Resume() 之前不再接受新动作，之后从停下的位置继续
+static void TestCancel() {
+    ServoMotion motion(1);
+    motion.Attach(0, 10);
+    const int start[1] = {0};
+    const int target[1] = {180};
+    CHECK(motion.Move(start, 10));
+    esp_timer_stub_advance(100 * 1000);
+    CHECK(motion.Move(target, 1000));
+    esp_timer_stub_advance(500 * 1000);
+    motion.Cancel();
+    uint32_t stopped = ledc_stub().duty[LEDC_CHANNEL_1];
+    CHECK_EQ(motion.GetPosition(0), 90);
+    CHECK(!motion.IsBusy());
+
+    CHECK(!motion.Move(start, 100));
+    CHECK(!motion.Hold(100));
+    esp_timer_stub_advance(500 * 1000);
+    CHECK_EQ(ledc_stub().duty[LEDC_CHANNEL_1], stopped);
+
+    motion.Resume();
+    CHECK(motion.Move(target, 100));
+    esp_timer_stub_advance(10 * 1000);
+    CHECK(ledc_stub().duty[LEDC_CHANNEL_1] >= stopped);
+    esp_timer_stub_advance(200 * 1000);
+    CHECK_EQ(ledc_stub().duty[LEDC_CHANNEL_1], Duty(180));
+}
+
+// Home() 只在复位动作真正入队后才记为休息状态
+static void TestOttoRestState() {
+    Otto otto;
+    otto.Init(1, 2, 3, 4, 5, 6);
+    otto.Home();
+    CHECK(otto.GetRestState());
+    esp_timer_stub_advance(1000 * 1000);
+
+    otto.Walk(1, 1000);
+    CHECK(!otto.GetRestState());
+    esp_timer_stub_advance(300 * 1000);
+    otto.Stop();
+    CHECK(!otto.GetRestState());
+
+    // 还没有 Resume()，复位动作被拒绝，不能算作已复位
+    otto.Home();
+    CHECK(!otto.GetRestState());
+    CHECK(!otto.MoveServos(100, std::vector<int>(SERVO_COUNT, 90).data()));
+
+    otto.Resume();
+    otto.Home();
+    CHECK(otto.GetRestState());
+    esp_timer_stub_advance(1000 * 1000);
+    CHECK_EQ(ledc_stub().duty[LEDC_CHANNEL_1], Duty(90));
+}
+
+int main() {
+    TestTrajectoryAccuracy();
+    TestGoldenTrajectory();
+    TestCancel();
+    TestOttoRestState();
+    printf("servo_motion_test passed\n");
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include "settings.h"
+#include "test_util.h"
+
+#include <esp_timer.h>
+#include <nvs.h>
+
+#include <string>
+
+static void SeedNamespace() {
+    nvs_handle_t handle;
+    nvs_open("wifi", NVS_READWRITE, &handle);
+    nvs_set_str(handle, "ssid", "home");
+    nvs_set_i32(handle, "channel", 6);
+    nvs_commit(handle);
+    nvs_close(handle);
+    nvs_stub_counters() = NvsStubCounters();
+}
+
+// 命名空间只从 NVS 读一次，之后的读取都命中缓存
+static void TestLoadOnce() {
+    nvs_stub_reset();
+    Settings::Reset();
+    SeedNamespace();
+
+    for (int i = 0; i < 10; i++) {
+        Settings settings("wifi");
+        CHECK_EQ(settings.GetString("ssid"), std::string("home"));
+        CHECK_EQ(settings.GetInt("channel"), 6);
+        CHECK_EQ(settings.GetString("missing", "default"), std::string("default"));
+        CHECK_EQ(settings.GetInt("ssid", -1), -1);
+    }
+    auto& counters = nvs_stub_counters();
+    CHECK_EQ(counters.opens, 1);
+    // 字符串读两次（长度和内容），整数读一次
+    CHECK_EQ(counters.reads, 3);
+    CHECK_EQ(counters.writes, 0);
+    CHECK_EQ(counters.commits, 0);
+}
+
+// 连续修改在防抖时间内合并成一次提交，未改变的值不写入
+static void TestCoalescedCommit() {
+    nvs_stub_reset();
+    Settings::Reset();
+    SeedNamespace();
+
+    for (int i = 0; i < 5; i++) {
+        Settings settings("wifi", true);
+        settings.SetInt("channel", 6);
+        settings.SetInt("retries", i);
+        settings.SetString("ssid", "office");
+        esp_timer_stub_advance(100 * 1000);
+    }
+    CHECK_EQ(nvs_stub_counters().commits, 0);
+    esp_timer_stub_advance(1000 * 1000);
+
+    auto& counters = nvs_stub_counters();
+    CHECK_EQ(counters.commits, 1);
+    // Only the final value of each changed key is written
+    CHECK_EQ(counters.writes, 2);
+
+    Settings::Reset();
+    Settings settings("wifi");
+    CHECK_EQ(settings.GetInt("retries"), 4);
+    CHECK_EQ(settings.GetString("ssid"), std::string("office"));
+    CHECK_EQ(settings.GetInt("channel"), 6);
+}
+
+// 一直有修改时，最迟在最大延迟后提交
+static void TestMaxDelay() {
+    nvs_stub_reset();
+    Settings::Reset();
+
+    for (int i = 0; i < 80; i++) {
+        Settings settings("counter", true);
+        settings.SetInt("value", i);
+        esp_timer_stub_advance(100 * 1000);
+    }
+    auto commits = nvs_stub_counters().commits;
+    CHECK(commits >= 1);
+    CHECK(commits <= 2);
+}
+
+static void TestEraseAndFlush() {
+    nvs_stub_reset();
+    Settings::Reset();
+    SeedNamespace();
+
+    {
+        Settings settings("wifi", true);
+        settings.EraseKey("ssid");
+        settings.EraseKey("missing");
+        CHECK_EQ(settings.GetString("ssid", "none"), std::string("none"));
+    }
+    // 深度睡眠和关机路径直接提交，不等防抖定时器
+    Settings::Flush();
+    CHECK_EQ(nvs_stub_counters().commits, 1);
+    CHECK_EQ(nvs_stub_counters().writes, 1);
+    esp_timer_stub_advance(10 * 1000 * 1000);
+    CHECK_EQ(nvs_stub_counters().commits, 1);
+
+    {
+        Settings settings("wifi", true);
+        settings.EraseAll();
+        settings.SetInt("channel", 11);
+    }
+    Settings::Flush();
+    Settings::Reset();
+    Settings settings("wifi");
+    CHECK_EQ(settings.GetInt("channel"), 11);
+    CHECK_EQ(settings.GetString("ssid", "none"), std::string("none"));
+}
+
+static void TestReadOnly() {
+    nvs_stub_reset();
+    Settings::Reset();
+    SeedNamespace();
+
+    {
+        Settings settings("wifi");
+        settings.SetInt("channel", 1);
+        CHECK_EQ(settings.GetInt("channel"), 6);
+    }
+    Settings::Flush();
+    CHECK_EQ(nvs_stub_counters().writes, 0);
+    CHECK_EQ(nvs_stub_counters().commits, 0);
+}
+
+static void TestChangeCallback() {
+    nvs_stub_reset();
+    Settings::Reset();
+
+    std::string changed;
+    int calls = 0;
+    Settings::OnChange("display", [&](const std::string& key) {
+        changed = key;
+        calls++;
+    });
+    Settings settings("display", true);
+    settings.SetInt("brightness", 50);
+    CHECK_EQ(changed, std::string("brightness"));
+    settings.SetInt("brightness", 50);
+    CHECK_EQ(calls, 1);
+    settings.EraseAll();
+    CHECK_EQ(changed, std::string(""));
+    CHECK_EQ(calls, 2);
+}
+
+int main() {
+    TestLoadOnce();
+    TestCoalescedCommit();
+    TestMaxDelay();
+    TestEraseAndFlush();
+    TestReadOnly();
+    TestChangeCallback();
+    return 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "device_state.h"
+#include "audio/audio_level.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// 只提供被测代码用到的接口，状态和输入电平由测试直接设置
+class AudioService {
+public:
+    bool ReadAudioData(std::vector<int16_t>& data, int sample_rate, int samples) { return false; }
+    AudioLevel GetInputLevel() const { return input_level_; }
+    void SetInputLevel(AudioLevel level) { input_level_ = level; }
+
+private:
+    AudioLevel input_level_;
+};
+
+class Application {
+public:
+    static Application& GetInstance() {
+        static Application instance;
+        return instance;
+    }
+
+    DeviceState GetDeviceState() const { return device_state_; }
+    void SetDeviceState(DeviceState state) { device_state_ = state; }
+    AudioService& GetAudioService() { return audio_service_; }
+
+private:
+    DeviceState device_state_ = kDeviceStateUnknown;
+    AudioService audio_service_;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+class AudioCodec {
+public:
+    int input_channels() const { return 1; }
+};
+
+class Board {
+public:
+    static Board& GetInstance() {
+        static Board instance;
+        return instance;
+    }
+    AudioCodec* GetAudioCodec() { return &audio_codec_; }
+
+private:
+    AudioCodec audio_codec_;
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+
+class WifiConfigurationAp {
+public:
+    bool ConnectToWifi(const std::string& ssid, const std::string& password) { return false; }
+    void Save(const std::string& ssid, const std::string& password) {}
+};
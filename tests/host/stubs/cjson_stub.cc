@@ -0,0 +1,512 @@
+#include "cJSON.h"
+
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <strings.h>
+
+namespace {
+
+cJSON* NewItem(int type) {
+    auto item = (cJSON*)calloc(1, sizeof(cJSON));
+    item->type = type;
+    return item;
+}
+
+char* Duplicate(const char* string) {
+    size_t len = strlen(string) + 1;
+    auto copy = (char*)malloc(len);
+    memcpy(copy, string, len);
+    return copy;
+}
+
+void SetNumber(cJSON* item, double number) {
+    item->valuedouble = number;
+    if (number >= INT_MAX) {
+        item->valueint = INT_MAX;
+    } else if (number <= (double)INT_MIN) {
+        item->valueint = INT_MIN;
+    } else {
+        item->valueint = (int)number;
+    }
+}
+
+class Parser {
+public:
+    Parser(const char* text) : p_(text) {}
+
+    cJSON* ParseDocument() {
+        cJSON* item = ParseValue();
+        SkipSpace();
+        if (item != nullptr && *p_ != '\0') {
+            cJSON_Delete(item);
+            return nullptr;
+        }
+        return item;
+    }
+
+private:
+    const char* p_;
+
+    void SkipSpace() {
+        while (*p_ != '\0' && isspace((unsigned char)*p_)) {
+            p_++;
+        }
+    }
+
+    bool Consume(const char* word) {
+        size_t len = strlen(word);
+        if (strncmp(p_, word, len) != 0) {
+            return false;
+        }
+        p_ += len;
+        return true;
+    }
+
+    static void AppendUtf8(std::string& out, unsigned code) {
+        if (code < 0x80) {
+            out += (char)code;
+        } else if (code < 0x800) {
+            out += (char)(0xC0 | (code >> 6));
+            out += (char)(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += (char)(0xE0 | (code >> 12));
+            out += (char)(0x80 | ((code >> 6) & 0x3F));
+            out += (char)(0x80 | (code & 0x3F));
+        } else {
+            out += (char)(0xF0 | (code >> 18));
+            out += (char)(0x80 | ((code >> 12) & 0x3F));
+            out += (char)(0x80 | ((code >> 6) & 0x3F));
+            out += (char)(0x80 | (code & 0x3F));
+        }
+    }
+
+    bool ParseHex(unsigned& code) {
+        char hex[5] = {};
+        for (int i = 0; i < 4; i++) {
+            if (!isxdigit((unsigned char)p_[i])) {
+                return false;
+            }
+            hex[i] = p_[i];
+        }
+        p_ += 4;
+        code = strtoul(hex, nullptr, 16);
+        return true;
+    }
+
+    char* ParseString() {
+        if (*p_ != '"') {
+            return nullptr;
+        }
+        p_++;
+        std::string out;
+        while (*p_ != '"') {
+            if (*p_ == '\0') {
+                return nullptr;
+            }
+            if (*p_ != '\\') {
+                out += *p_++;
+                continue;
+            }
+            p_++;
+            char escape = *p_++;
+            switch (escape) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                unsigned code = 0;
+                if (!ParseHex(code)) {
+                    return nullptr;
+                }
+                if (code >= 0xD800 && code < 0xDC00 && p_[0] == '\\' && p_[1] == 'u') {
+                    p_ += 2;
+                    unsigned low = 0;
+                    if (!ParseHex(low)) {
+                        return nullptr;
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                AppendUtf8(out, code);
+                break;
+            }
+            default:
+                return nullptr;
+            }
+        }
+        p_++;
+        return Duplicate(out.c_str());
+    }
+
+    cJSON* ParseValue() {
+        SkipSpace();
+        if (Consume("null")) {
+            return NewItem(cJSON_NULL);
+        }
+        if (Consume("true")) {
+            auto item = NewItem(cJSON_True);
+            item->valueint = 1;
+            return item;
+        }
+        if (Consume("false")) {
+            return NewItem(cJSON_False);
+        }
+        if (*p_ == '"') {
+            char* string = ParseString();
+            if (string == nullptr) {
+                return nullptr;
+            }
+            auto item = NewItem(cJSON_String);
+            item->valuestring = string;
+            return item;
+        }
+        if (*p_ == '-' || isdigit((unsigned char)*p_)) {
+            char* end = nullptr;
+            double number = strtod(p_, &end);
+            if (end == p_) {
+                return nullptr;
+            }
+            p_ = end;
+            auto item = NewItem(cJSON_Number);
+            SetNumber(item, number);
+            return item;
+        }
+        if (*p_ == '[' || *p_ == '{') {
+            bool object = *p_ == '{';
+            char close = object ? '}' : ']';
+            p_++;
+            auto container = NewItem(object ? cJSON_Object : cJSON_Array);
+            SkipSpace();
+            if (*p_ == close) {
+                p_++;
+                return container;
+            }
+            while (true) {
+                char* key = nullptr;
+                if (object) {
+                    SkipSpace();
+                    key = ParseString();
+                    SkipSpace();
+                    if (key == nullptr || *p_ != ':') {
+                        free(key);
+                        cJSON_Delete(container);
+                        return nullptr;
+                    }
+                    p_++;
+                }
+                cJSON* child = ParseValue();
+                if (child == nullptr) {
+                    free(key);
+                    cJSON_Delete(container);
+                    return nullptr;
+                }
+                child->string = key;
+                cJSON_AddItemToArray(container, child);
+                SkipSpace();
+                if (*p_ == ',') {
+                    p_++;
+                    continue;
+                }
+                if (*p_ == close) {
+                    p_++;
+                    return container;
+                }
+                cJSON_Delete(container);
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+};
+
+void PrintString(std::string& out, const char* string) {
+    out += '"';
+    for (const char* p = string; *p != '\0'; p++) {
+        unsigned char c = *p;
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\b': out += "\\b"; break;
+        case '\f': out += "\\f"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (c < 0x20) {
+                char buffer[8];
+                snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                out += buffer;
+            } else {
+                out += (char)c;
+            }
+        }
+    }
+    out += '"';
+}
+
+void PrintValue(std::string& out, const cJSON* item, bool formatted, int depth) {
+    switch (item->type & 0xFF) {
+    case cJSON_NULL:
+        out += "null";
+        break;
+    case cJSON_False:
+        out += "false";
+        break;
+    case cJSON_True:
+        out += "true";
+        break;
+    case cJSON_Number: {
+        // 和 cJSON 一样，能精确表示的整数按整数输出，其余尽量用 15 位有效数字
+        char buffer[32];
+        double d = item->valuedouble;
+        if (std::isnan(d) || std::isinf(d)) {
+            snprintf(buffer, sizeof(buffer), "null");
+        } else if (d == (double)item->valueint) {
+            snprintf(buffer, sizeof(buffer), "%d", item->valueint);
+        } else {
+            snprintf(buffer, sizeof(buffer), "%1.15g", d);
+            if (strtod(buffer, nullptr) != d) {
+                snprintf(buffer, sizeof(buffer), "%1.17g", d);
+            }
+        }
+        out += buffer;
+        break;
+    }
+    case cJSON_String:
+        PrintString(out, item->valuestring != nullptr ? item->valuestring : "");
+        break;
+    case cJSON_Array:
+    case cJSON_Object: {
+        bool object = (item->type & 0xFF) == cJSON_Object;
+        out += object ? '{' : '[';
+        for (const cJSON* child = item->child; child != nullptr; child = child->next) {
+            if (formatted) {
+                out += '\n';
+                out.append(depth + 1, '\t');
+            }
+            if (object) {
+                PrintString(out, child->string != nullptr ? child->string : "");
+                out += formatted ? ":\t" : ":";
+            }
+            PrintValue(out, child, formatted, depth + 1);
+            if (child->next != nullptr) {
+                out += ',';
+            }
+        }
+        if (formatted && item->child != nullptr) {
+            out += '\n';
+            out.append(depth, '\t');
+        }
+        out += object ? '}' : ']';
+        break;
+    }
+    }
+}
+
+char* Print(const cJSON* item, bool formatted) {
+    if (item == nullptr) {
+        return nullptr;
+    }
+    std::string out;
+    PrintValue(out, item, formatted, 0);
+    return Duplicate(out.c_str());
+}
+
+} // namespace
+
+cJSON* cJSON_Parse(const char* value) {
+    if (value == nullptr) {
+        return nullptr;
+    }
+    return Parser(value).ParseDocument();
+}
+
+char* cJSON_Print(const cJSON* item) {
+    return Print(item, true);
+}
+
+char* cJSON_PrintUnformatted(const cJSON* item) {
+    return Print(item, false);
+}
+
+void cJSON_Delete(cJSON* item) {
+    while (item != nullptr) {
+        cJSON* next = item->next;
+        cJSON_Delete(item->child);
+        free(item->valuestring);
+        free(item->string);
+        free(item);
+        item = next;
+    }
+}
+
+void cJSON_free(void* object) {
+    free(object);
+}
+
+int cJSON_GetArraySize(const cJSON* array) {
+    int size = 0;
+    for (const cJSON* child = array != nullptr ? array->child : nullptr; child != nullptr; child = child->next) {
+        size++;
+    }
+    return size;
+}
+
+cJSON* cJSON_GetArrayItem(const cJSON* array, int index) {
+    cJSON* child = array != nullptr ? array->child : nullptr;
+    while (child != nullptr && index-- > 0) {
+        child = child->next;
+    }
+    return child;
+}
+
+// 和 cJSON 一样，名字比较不区分大小写
+cJSON* cJSON_GetObjectItem(const cJSON* object, const char* string) {
+    if (object == nullptr || string == nullptr) {
+        return nullptr;
+    }
+    for (cJSON* child = object->child; child != nullptr; child = child->next) {
+        if (child->string != nullptr && strcasecmp(child->string, string) == 0) {
+            return child;
+        }
+    }
+    return nullptr;
+}
+
+cJSON_bool cJSON_IsInvalid(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_Invalid;
+}
+
+cJSON_bool cJSON_IsFalse(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_False;
+}
+
+cJSON_bool cJSON_IsTrue(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_True;
+}
+
+cJSON_bool cJSON_IsBool(const cJSON* item) {
+    return item != nullptr && (item->type & (cJSON_True | cJSON_False)) != 0;
+}
+
+cJSON_bool cJSON_IsNull(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_NULL;
+}
+
+cJSON_bool cJSON_IsNumber(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_Number;
+}
+
+cJSON_bool cJSON_IsString(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_String;
+}
+
+cJSON_bool cJSON_IsArray(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_Array;
+}
+
+cJSON_bool cJSON_IsObject(const cJSON* item) {
+    return item != nullptr && (item->type & 0xFF) == cJSON_Object;
+}
+
+cJSON* cJSON_CreateNull() {
+    return NewItem(cJSON_NULL);
+}
+
+cJSON* cJSON_CreateBool(cJSON_bool boolean) {
+    auto item = NewItem(boolean ? cJSON_True : cJSON_False);
+    item->valueint = boolean ? 1 : 0;
+    return item;
+}
+
+cJSON* cJSON_CreateNumber(double num) {
+    auto item = NewItem(cJSON_Number);
+    SetNumber(item, num);
+    return item;
+}
+
+cJSON* cJSON_CreateString(const char* string) {
+    auto item = NewItem(cJSON_String);
+    item->valuestring = Duplicate(string != nullptr ? string : "");
+    return item;
+}
+
+cJSON* cJSON_CreateArray() {
+    return NewItem(cJSON_Array);
+}
+
+cJSON* cJSON_CreateObject() {
+    return NewItem(cJSON_Object);
+}
+
+cJSON_bool cJSON_AddItemToArray(cJSON* array, cJSON* item) {
+    if (array == nullptr || item == nullptr || array == item) {
+        return 0;
+    }
+    if (array->child == nullptr) {
+        array->child = item;
+        item->prev = item;
+    } else {
+        // 和 cJSON 一样，第一个元素的 prev 指向最后一个元素
+        cJSON* last = array->child->prev;
+        last->next = item;
+        item->prev = last;
+        array->child->prev = item;
+    }
+    item->next = nullptr;
+    return 1;
+}
+
+cJSON_bool cJSON_AddItemToObject(cJSON* object, const char* string, cJSON* item) {
+    if (object == nullptr || string == nullptr || item == nullptr) {
+        return 0;
+    }
+    free(item->string);
+    item->string = Duplicate(string);
+    return cJSON_AddItemToArray(object, item);
+}
+
+cJSON* cJSON_AddNullToObject(cJSON* object, const char* name) {
+    auto item = cJSON_CreateNull();
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+cJSON* cJSON_AddBoolToObject(cJSON* object, const char* name, cJSON_bool boolean) {
+    auto item = cJSON_CreateBool(boolean);
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+cJSON* cJSON_AddNumberToObject(cJSON* object, const char* name, double number) {
+    auto item = cJSON_CreateNumber(number);
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+cJSON* cJSON_AddStringToObject(cJSON* object, const char* name, const char* string) {
+    auto item = cJSON_CreateString(string);
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+cJSON* cJSON_AddObjectToObject(cJSON* object, const char* name) {
+    auto item = cJSON_CreateObject();
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+cJSON* cJSON_AddArrayToObject(cJSON* object, const char* name) {
+    auto item = cJSON_CreateArray();
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
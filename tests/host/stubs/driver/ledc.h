@@ -0,0 +1,84 @@
+#pragma once
+
+#include "esp_err.h"
+
+#include <cstdint>
+
+// 主机上的 LEDC 替身，记录每个通道当前的占空比和写入次数
+typedef enum {
+    LEDC_LOW_SPEED_MODE,
+} ledc_mode_t;
+
+typedef enum {
+    LEDC_TIMER_13_BIT = 13,
+} ledc_timer_bit_t;
+
+typedef enum {
+    LEDC_TIMER_0,
+    LEDC_TIMER_1,
+} ledc_timer_t;
+
+typedef enum {
+    LEDC_AUTO_CLK,
+} ledc_clk_cfg_t;
+
+typedef enum {
+    LEDC_INTR_DISABLE,
+} ledc_intr_type_t;
+
+typedef enum {
+    LEDC_CHANNEL_0,
+    LEDC_CHANNEL_1,
+    LEDC_CHANNEL_MAX = 8,
+} ledc_channel_t;
+
+typedef struct {
+    ledc_mode_t speed_mode;
+    ledc_timer_bit_t duty_resolution;
+    ledc_timer_t timer_num;
+    uint32_t freq_hz;
+    ledc_clk_cfg_t clk_cfg;
+} ledc_timer_config_t;
+
+typedef struct {
+    int gpio_num;
+    ledc_mode_t speed_mode;
+    ledc_channel_t channel;
+    ledc_intr_type_t intr_type;
+    ledc_timer_t timer_sel;
+    uint32_t duty;
+    int hpoint;
+} ledc_channel_config_t;
+
+struct LedcStub {
+    uint32_t duty[LEDC_CHANNEL_MAX];
+    int writes;
+};
+
+inline LedcStub& ledc_stub() {
+    static LedcStub stub = {};
+    return stub;
+}
+
+inline esp_err_t ledc_timer_config(const ledc_timer_config_t*) {
+    return ESP_OK;
+}
+
+inline esp_err_t ledc_channel_config(const ledc_channel_config_t* config) {
+    ledc_stub().duty[config->channel] = config->duty;
+    return ESP_OK;
+}
+
+inline esp_err_t ledc_stop(ledc_mode_t, ledc_channel_t, uint32_t) {
+    return ESP_OK;
+}
+
+inline esp_err_t ledc_set_duty(ledc_mode_t, ledc_channel_t channel, uint32_t duty) {
+    ledc_stub().duty[channel] = duty;
+    ledc_stub().writes++;
+    return ESP_OK;
+}
+
+inline esp_err_t ledc_update_duty(ledc_mode_t, ledc_channel_t) {
+    return ESP_OK;
+}
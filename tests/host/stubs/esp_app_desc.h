@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+typedef struct {
+    uint32_t magic_word;
+    uint32_t secure_version;
+    uint32_t reserv1[2];
+    char version[32];
+    char project_name[32];
+    char time[16];
+    char date[16];
+    char idf_ver[32];
+    uint8_t app_elf_sha256[32];
+    uint32_t reserv2[20];
+} esp_app_desc_t;
+
+// 主机测试中正在运行的固件版本固定为 1.0.0
+inline const esp_app_desc_t* esp_app_get_description() {
+    static const esp_app_desc_t desc = {0xABCD5432, 0, {}, "1.0.0", "xiaozhi"};
+    return &desc;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// 只保证大小和 esp_app_desc_t 的位置与真实镜像一致
+typedef struct {
+    uint8_t magic;
+    uint8_t segment_count;
+    uint8_t spi_mode;
+    uint8_t spi_speed_size;
+    uint32_t entry_addr;
+    uint8_t reserved[16];
+} __attribute__((packed)) esp_image_header_t;
+
+typedef struct {
+    uint32_t load_addr;
+    uint32_t data_len;
+} esp_image_segment_header_t;
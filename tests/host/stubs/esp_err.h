@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_NVS_NOT_FOUND 0x1102
+
+inline const char* esp_err_to_name(esp_err_t err) {
+    return err == ESP_OK ? "ESP_OK" : "ESP_ERR";
+}
+
+#define ESP_ERROR_CHECK(x) do {                                     \
+        esp_err_t err_ = (x);                                       \
+        if (err_ != ESP_OK) {                                       \
+            fprintf(stderr, "%s failed: %d\n", #x, err_);           \
+            abort();                                                \
+        }                                                           \
+    } while (0)
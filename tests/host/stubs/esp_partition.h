@@ -0,0 +1,30 @@
+#pragma once
+
+#include "esp_err.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+typedef struct {
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size);
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size);
+
+// 内存中的 flash 替身：擦除后为 0xFF，写入只能把 1 改成 0，和 NOR flash 一样
+struct EspPartitionStubCounters {
+    size_t bytes_read = 0;
+    size_t bytes_written = 0;
+    size_t bytes_erased = 0;
+};
+
+std::vector<uint8_t>& esp_partition_stub_data(const esp_partition_t* partition);
+EspPartitionStubCounters& esp_partition_stub_counters();
+// Called after every write, from the writing thread
+void esp_partition_stub_on_write(std::function<void(size_t offset, size_t size)> callback);
@@ -0,0 +1,65 @@
+#include "esp_partition.h"
+
+#include <cstring>
+#include <map>
+
+namespace {
+
+std::map<const esp_partition_t*, std::vector<uint8_t>> flash;
+EspPartitionStubCounters counters;
+std::function<void(size_t offset, size_t size)> on_write;
+
+} // namespace
+
+std::vector<uint8_t>& esp_partition_stub_data(const esp_partition_t* partition) {
+    auto& data = flash[partition];
+    if (data.size() != partition->size) {
+        // 未擦除的 flash 内容不确定，用固定的花样让漏掉的擦除在比较时暴露出来
+        data.assign(partition->size, 0x5A);
+    }
+    return data;
+}
+
+EspPartitionStubCounters& esp_partition_stub_counters() {
+    return counters;
+}
+
+void esp_partition_stub_on_write(std::function<void(size_t offset, size_t size)> callback) {
+    on_write = callback;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size) {
+    auto& data = esp_partition_stub_data(partition);
+    if (src_offset + size > data.size()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(dst, data.data() + src_offset, size);
+    counters.bytes_read += size;
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size) {
+    auto& data = esp_partition_stub_data(partition);
+    if (dst_offset + size > data.size()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    auto bytes = (const uint8_t*)src;
+    for (size_t i = 0; i < size; i++) {
+        data[dst_offset + i] &= bytes[i];
+    }
+    counters.bytes_written += size;
+    if (on_write) {
+        on_write(dst_offset, size);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    auto& data = esp_partition_stub_data(partition);
+    if (offset % 4096 != 0 || size % 4096 != 0 || offset + size > data.size()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(data.data() + offset, 0xFF, size);
+    counters.bytes_erased += size;
+    return ESP_OK;
+}
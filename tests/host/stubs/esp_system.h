@@ -0,0 +1,12 @@
+#pragma once
+
+#include "esp_err.h"
+
+typedef void (*shutdown_handler_t)(void);
+
+inline esp_err_t esp_register_shutdown_handler(shutdown_handler_t) {
+    return ESP_OK;
+}
+
+inline void esp_restart(void) {
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "esp_err.h"
+
+#include <cstdint>
+
+// 主机上的 esp_timer 替身，时间只在测试调用 esp_timer_stub_advance() 时前进
+typedef enum {
+    ESP_TIMER_TASK,
+    ESP_TIMER_ISR,
+} esp_timer_dispatch_t;
+
+typedef void (*esp_timer_cb_t)(void* arg);
+
+typedef struct {
+    esp_timer_cb_t callback;
+    void* arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char* name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+typedef struct esp_timer* esp_timer_handle_t;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+esp_err_t esp_timer_delete(esp_timer_handle_t timer);
+bool esp_timer_is_active(esp_timer_handle_t timer);
+int64_t esp_timer_get_time();
+
+// Move the clock forward and run every callback that falls due, in time order
+void esp_timer_stub_advance(int64_t us);
@@ -0,0 +1,93 @@
+#include "esp_timer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+struct esp_timer {
+    esp_timer_create_args_t args;
+    bool active = false;
+    int64_t due = 0;
+    uint64_t period = 0;
+};
+
+namespace {
+
+// 被测代码的后台线程也会读时间
+std::atomic<int64_t> now_us = 0;
+std::vector<esp_timer*> timers;
+
+} // namespace
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle) {
+    auto timer = new esp_timer;
+    timer->args = *args;
+    timers.push_back(timer);
+    *handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    if (timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = true;
+    timer->due = now_us + timeout_us;
+    timer->period = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us) {
+    if (timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = true;
+    timer->due = now_us + period_us;
+    timer->period = period_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    timers.erase(std::remove(timers.begin(), timers.end(), timer), timers.end());
+    delete timer;
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer) {
+    return timer->active;
+}
+
+int64_t esp_timer_get_time() {
+    return now_us;
+}
+
+void esp_timer_stub_advance(int64_t us) {
+    int64_t end = now_us + us;
+    while (true) {
+        esp_timer* next = nullptr;
+        for (auto timer : timers) {
+            if (timer->active && timer->due <= end && (next == nullptr || timer->due < next->due)) {
+                next = timer;
+            }
+        }
+        if (next == nullptr) {
+            break;
+        }
+        now_us = next->due;
+        if (next->period > 0) {
+            next->due += next->period;
+        } else {
+            next->active = false;
+        }
+        next->args.callback(next->args.arg);
+    }
+    now_us = end;
+}
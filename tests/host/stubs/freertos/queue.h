@@ -0,0 +1,80 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// 用互斥锁和条件变量实现的队列，配合 task.h 中的线程任务使用
+struct QueueDefinition {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t item_size;
+};
+
+typedef QueueDefinition* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    auto queue = new QueueDefinition;
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+inline bool freertos_stub_wait(QueueDefinition* queue, std::unique_lock<std::mutex>& lock, TickType_t ticks, auto ready) {
+    if (ticks == portMAX_DELAY) {
+        queue->changed.wait(lock, ready);
+        return true;
+    }
+    return queue->changed.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), ready);
+}
+
+// 条件变量在持锁时通知，对方醒来后队列可能立即被删除
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!freertos_stub_wait(queue, lock, ticks, [queue] { return queue->items.size() < queue->length; })) {
+        return pdFALSE;
+    }
+    std::vector<uint8_t> data(queue->item_size);
+    if (queue->item_size > 0) {
+        memcpy(data.data(), item, queue->item_size);
+    }
+    queue->items.push_back(std::move(data));
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!freertos_stub_wait(queue, lock, ticks, [queue] { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    if (queue->item_size > 0) {
+        memcpy(item, queue->items.front().data(), queue->item_size);
+    }
+    queue->items.pop_front();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReset(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->items.clear();
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->items.size();
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "queue.h"
+
+// 和 FreeRTOS 一样，信号量是元素大小为 0 的队列
+typedef QueueHandle_t SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xQueueCreate(1, 0);
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    return xQueueReceive(semaphore, nullptr, ticks);
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    vQueueDelete(semaphore);
+}
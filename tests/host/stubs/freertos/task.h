@@ -0,0 +1,49 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+#include <thread>
+
+/*
+ * 主机测试默认不运行 FreeRTOS 任务，创建总是失败，被测代码走自己的降级路径。
+ * 需要后台任务的测试把 freertos_stub_threads 设为 true，任务在分离的线程中运行。
+ */
+typedef struct tskTaskControlBlock* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+struct tskTaskControlBlock {
+};
+
+inline bool freertos_stub_threads = false;
+// vTaskDelay 不真正等待，只累计请求的节拍数
+inline TickType_t freertos_stub_delayed_ticks = 0;
+
+inline BaseType_t xTaskCreate(TaskFunction_t function, const char*, uint32_t, void* arg, UBaseType_t, TaskHandle_t* handle) {
+    static tskTaskControlBlock task;
+    if (!freertos_stub_threads) {
+        if (handle != nullptr) {
+            *handle = nullptr;
+        }
+        return pdFAIL;
+    }
+    std::thread(function, arg).detach();
+    if (handle != nullptr) {
+        *handle = &task;
+    }
+    return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t) {
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) {
+    return 0;
+}
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t) {
+    return pdPASS;
+}
+
+inline void vTaskDelay(TickType_t ticks) {
+    freertos_stub_delayed_ticks += ticks;
+}
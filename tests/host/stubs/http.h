@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+// 与 esp-ml307 组件的 Http 接口一致，主机测试用自己的实现代替真正的连接
+class Http {
+public:
+    virtual ~Http() = default;
+    virtual void SetTimeout(int timeout_ms) = 0;
+    virtual void SetHeader(const std::string& key, const std::string& value) = 0;
+    virtual void SetContent(std::string&& content) = 0;
+    virtual bool Open(const std::string& method, const std::string& url) = 0;
+    virtual void Close() = 0;
+    virtual int Read(char* buffer, size_t buffer_size) = 0;
+    virtual int Write(const char* buffer, size_t buffer_size) = 0;
+    virtual int GetStatusCode() = 0;
+    virtual std::string GetResponseHeader(const std::string& key) const = 0;
+    virtual size_t GetBodyLength() = 0;
+    virtual std::string ReadAll() = 0;
+};
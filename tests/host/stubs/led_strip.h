@@ -0,0 +1,90 @@
+#pragma once
+
+#include "esp_err.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// 主机上的 LED 灯带替身，记录每次刷新时的颜色和时间
+typedef enum {
+    LED_PIXEL_FORMAT_GRB,
+    LED_PIXEL_FORMAT_GRBW,
+} led_pixel_format_t;
+
+typedef enum {
+    LED_MODEL_WS2812,
+    LED_MODEL_SK6812,
+} led_model_t;
+
+typedef struct {
+    int strip_gpio_num;
+    uint32_t max_leds;
+    led_pixel_format_t led_pixel_format;
+    led_model_t led_model;
+} led_strip_config_t;
+
+typedef struct {
+    uint32_t resolution_hz;
+    size_t mem_block_symbols;
+    struct {
+        uint32_t with_dma : 1;
+    } flags;
+} led_strip_rmt_config_t;
+
+struct LedStripFrame {
+    int64_t time_us;
+    std::vector<std::array<uint8_t, 3>> pixels;
+};
+
+struct led_strip_t {
+    std::vector<std::array<uint8_t, 3>> pixels;
+    std::vector<LedStripFrame> frames;
+};
+
+typedef led_strip_t* led_strip_handle_t;
+
+// The strip created last, so tests can read what the driver under test sent
+inline led_strip_handle_t& led_strip_stub_last() {
+    static led_strip_handle_t strip = nullptr;
+    return strip;
+}
+
+inline esp_err_t led_strip_new_rmt_device(const led_strip_config_t* config, const led_strip_rmt_config_t*,
+                                          led_strip_handle_t* handle) {
+    *handle = new led_strip_t;
+    (*handle)->pixels.resize(config->max_leds);
+    led_strip_stub_last() = *handle;
+    return ESP_OK;
+}
+
+inline esp_err_t led_strip_set_pixel(led_strip_handle_t strip, uint32_t index, uint32_t red, uint32_t green,
+                                     uint32_t blue) {
+    if (index >= strip->pixels.size()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    strip->pixels[index] = {(uint8_t)red, (uint8_t)green, (uint8_t)blue};
+    return ESP_OK;
+}
+
+int64_t esp_timer_get_time();
+
+inline esp_err_t led_strip_refresh(led_strip_handle_t strip) {
+    strip->frames.push_back({esp_timer_get_time(), strip->pixels});
+    return ESP_OK;
+}
+
+inline esp_err_t led_strip_clear(led_strip_handle_t strip) {
+    for (auto& pixel : strip->pixels) {
+        pixel = {0, 0, 0};
+    }
+    return ESP_OK;
+}
+
+inline esp_err_t led_strip_del(led_strip_handle_t strip) {
+    if (led_strip_stub_last() == strip) {
+        led_strip_stub_last() = nullptr;
+    }
+    delete strip;
+    return ESP_OK;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <memory>
+
+#include "http.h"
+
+// 只保留主机测试用到的 CreateHttp
+class NetworkInterface {
+public:
+    virtual ~NetworkInterface() = default;
+    virtual std::unique_ptr<Http> CreateHttp(int connect_id = -1) = 0;
+};
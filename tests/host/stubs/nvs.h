@@ -0,0 +1,57 @@
+#pragma once
+
+#include "esp_err.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#define NVS_DEFAULT_PART_NAME "nvs"
+#define NVS_KEY_NAME_MAX_SIZE 16
+
+typedef uint32_t nvs_handle_t;
+
+typedef enum {
+    NVS_READONLY,
+    NVS_READWRITE,
+} nvs_open_mode_t;
+
+typedef enum {
+    NVS_TYPE_I32 = 0x14,
+    NVS_TYPE_STR = 0x21,
+    NVS_TYPE_ANY = 0xff,
+} nvs_type_t;
+
+typedef struct {
+    char namespace_name[NVS_KEY_NAME_MAX_SIZE];
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    nvs_type_t type;
+} nvs_entry_info_t;
+
+typedef struct nvs_opaque_iterator_t* nvs_iterator_t;
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle);
+void nvs_close(nvs_handle_t handle);
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char* key, int32_t* out_value);
+esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length);
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char* key, int32_t value);
+esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value);
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key);
+esp_err_t nvs_erase_all(nvs_handle_t handle);
+esp_err_t nvs_commit(nvs_handle_t handle);
+esp_err_t nvs_entry_find(const char* part_name, const char* namespace_name, nvs_type_t type,
+                         nvs_iterator_t* output_iterator);
+esp_err_t nvs_entry_next(nvs_iterator_t* iterator);
+esp_err_t nvs_entry_info(const nvs_iterator_t iterator, nvs_entry_info_t* out_info);
+void nvs_release_iterator(nvs_iterator_t iterator);
+
+// 内存中的 NVS 替身，记录每类操作的次数
+struct NvsStubCounters {
+    int opens = 0;
+    int reads = 0;
+    int writes = 0;
+    int commits = 0;
+};
+
+NvsStubCounters& nvs_stub_counters();
+// Drop every stored key and zero the counters
+void nvs_stub_reset();
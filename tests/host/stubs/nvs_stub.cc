@@ -0,0 +1,198 @@
+#include "nvs.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct NvsValue {
+    nvs_type_t type;
+    int32_t int_value;
+    std::string str_value;
+};
+
+struct NvsHandle {
+    std::string ns;
+    nvs_open_mode_t mode;
+};
+
+std::map<std::string, std::map<std::string, NvsValue>> storage;
+std::map<nvs_handle_t, NvsHandle> handles;
+nvs_handle_t next_handle = 1;
+NvsStubCounters counters;
+
+NvsHandle* FindHandle(nvs_handle_t handle) {
+    auto it = handles.find(handle);
+    return it == handles.end() ? nullptr : &it->second;
+}
+
+esp_err_t Write(nvs_handle_t handle, const char* key, const NvsValue& value) {
+    auto h = FindHandle(handle);
+    if (h == nullptr || h->mode != NVS_READWRITE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    counters.writes++;
+    storage[h->ns][key] = value;
+    return ESP_OK;
+}
+
+const NvsValue* Read(nvs_handle_t handle, const char* key, nvs_type_t type) {
+    auto h = FindHandle(handle);
+    if (h == nullptr) {
+        return nullptr;
+    }
+    counters.reads++;
+    auto ns = storage.find(h->ns);
+    if (ns == storage.end()) {
+        return nullptr;
+    }
+    auto it = ns->second.find(key);
+    if (it == ns->second.end() || it->second.type != type) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+} // namespace
+
+struct nvs_opaque_iterator_t {
+    std::string ns;
+    std::vector<std::pair<std::string, nvs_type_t>> entries;
+    size_t index = 0;
+};
+
+NvsStubCounters& nvs_stub_counters() {
+    return counters;
+}
+
+void nvs_stub_reset() {
+    storage.clear();
+    handles.clear();
+    counters = NvsStubCounters();
+}
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle) {
+    counters.opens++;
+    // 和真实 NVS 一样，只读方式打开不存在的命名空间会失败
+    if (open_mode == NVS_READONLY && storage.find(name) == storage.end()) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    storage[name];
+    *out_handle = next_handle++;
+    handles[*out_handle] = {name, open_mode};
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    handles.erase(handle);
+}
+
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char* key, int32_t* out_value) {
+    auto value = Read(handle, key, NVS_TYPE_I32);
+    if (value == nullptr) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    *out_value = value->int_value;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length) {
+    auto value = Read(handle, key, NVS_TYPE_STR);
+    if (value == nullptr) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    size_t required = value->str_value.size() + 1;
+    if (out_value == nullptr) {
+        *length = required;
+        return ESP_OK;
+    }
+    if (*length < required) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(out_value, value->str_value.c_str(), required);
+    *length = required;
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char* key, int32_t value) {
+    return Write(handle, key, {NVS_TYPE_I32, value, ""});
+}
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value) {
+    return Write(handle, key, {NVS_TYPE_STR, 0, value});
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key) {
+    auto h = FindHandle(handle);
+    if (h == nullptr || h->mode != NVS_READWRITE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    counters.writes++;
+    return storage[h->ns].erase(key) > 0 ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle) {
+    auto h = FindHandle(handle);
+    if (h == nullptr || h->mode != NVS_READWRITE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    counters.writes++;
+    storage[h->ns].clear();
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    if (FindHandle(handle) == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    counters.commits++;
+    return ESP_OK;
+}
+
+esp_err_t nvs_entry_find(const char*, const char* namespace_name, nvs_type_t type,
+                         nvs_iterator_t* output_iterator) {
+    auto ns = storage.find(namespace_name);
+    if (ns == storage.end()) {
+        *output_iterator = nullptr;
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    auto iterator = new nvs_opaque_iterator_t;
+    iterator->ns = namespace_name;
+    for (auto& [key, value] : ns->second) {
+        if (type == NVS_TYPE_ANY || type == value.type) {
+            iterator->entries.emplace_back(key, value.type);
+        }
+    }
+    if (iterator->entries.empty()) {
+        delete iterator;
+        *output_iterator = nullptr;
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    *output_iterator = iterator;
+    return ESP_OK;
+}
+
+esp_err_t nvs_entry_next(nvs_iterator_t* iterator) {
+    if (++(*iterator)->index >= (*iterator)->entries.size()) {
+        delete *iterator;
+        *iterator = nullptr;
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t nvs_entry_info(const nvs_iterator_t iterator, nvs_entry_info_t* out_info) {
+    auto& [key, type] = iterator->entries[iterator->index];
+    strncpy(out_info->namespace_name, iterator->ns.c_str(), NVS_KEY_NAME_MAX_SIZE - 1);
+    out_info->namespace_name[NVS_KEY_NAME_MAX_SIZE - 1] = '\0';
+    strncpy(out_info->key, key.c_str(), NVS_KEY_NAME_MAX_SIZE - 1);
+    out_info->key[NVS_KEY_NAME_MAX_SIZE - 1] = '\0';
+    out_info->type = type;
+    return ESP_OK;
+}
+
+void nvs_release_iterator(nvs_iterator_t iterator) {
+    delete iterator;
+}
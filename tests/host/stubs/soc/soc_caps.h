@@ -0,0 +1,3 @@
+#pragma once
+
+// 主机上没有 RMT，所有能力都不定义
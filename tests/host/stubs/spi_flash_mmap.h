@@ -0,0 +1,3 @@
+#pragma once
+
+#define SPI_FLASH_SEC_SIZE 4096
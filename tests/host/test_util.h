@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+// 主机测试不依赖测试框架，失败时打印位置并以非零状态退出
+#define CHECK(condition) do {                                                   \
+        if (!(condition)) {                                                     \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            exit(1);                                                            \
+        }                                                                       \
+    } while (0)
+
+#define CHECK_EQ(a, b) do {                                                     \
+        auto a_ = (a);                                                          \
+        auto b_ = (b);                                                          \
+        if (!(a_ == b_)) {                                                      \
+            fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed\n", __FILE__, __LINE__, #a, #b); \
+            exit(1);                                                            \
+        }                                                                       \
+    } while (0)